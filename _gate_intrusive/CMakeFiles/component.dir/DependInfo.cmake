@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ftxui/component/animation.cpp" "CMakeFiles/component.dir/src/ftxui/component/animation.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/animation.cpp.o.d"
+  "/root/repo/src/ftxui/component/async.cpp" "CMakeFiles/component.dir/src/ftxui/component/async.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/async.cpp.o.d"
+  "/root/repo/src/ftxui/component/button.cpp" "CMakeFiles/component.dir/src/ftxui/component/button.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/button.cpp.o.d"
+  "/root/repo/src/ftxui/component/catch_event.cpp" "CMakeFiles/component.dir/src/ftxui/component/catch_event.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/catch_event.cpp.o.d"
+  "/root/repo/src/ftxui/component/checkbox.cpp" "CMakeFiles/component.dir/src/ftxui/component/checkbox.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/checkbox.cpp.o.d"
+  "/root/repo/src/ftxui/component/collapsible.cpp" "CMakeFiles/component.dir/src/ftxui/component/collapsible.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/collapsible.cpp.o.d"
+  "/root/repo/src/ftxui/component/component.cpp" "CMakeFiles/component.dir/src/ftxui/component/component.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/component.cpp.o.d"
+  "/root/repo/src/ftxui/component/component_options.cpp" "CMakeFiles/component.dir/src/ftxui/component/component_options.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/component_options.cpp.o.d"
+  "/root/repo/src/ftxui/component/container.cpp" "CMakeFiles/component.dir/src/ftxui/component/container.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/container.cpp.o.d"
+  "/root/repo/src/ftxui/component/deferred.cpp" "CMakeFiles/component.dir/src/ftxui/component/deferred.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/deferred.cpp.o.d"
+  "/root/repo/src/ftxui/component/dropdown.cpp" "CMakeFiles/component.dir/src/ftxui/component/dropdown.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/dropdown.cpp.o.d"
+  "/root/repo/src/ftxui/component/event.cpp" "CMakeFiles/component.dir/src/ftxui/component/event.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/event.cpp.o.d"
+  "/root/repo/src/ftxui/component/filter_menu.cpp" "CMakeFiles/component.dir/src/ftxui/component/filter_menu.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/filter_menu.cpp.o.d"
+  "/root/repo/src/ftxui/component/frame_broadcast.cpp" "CMakeFiles/component.dir/src/ftxui/component/frame_broadcast.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/frame_broadcast.cpp.o.d"
+  "/root/repo/src/ftxui/component/fuzzy_finder.cpp" "CMakeFiles/component.dir/src/ftxui/component/fuzzy_finder.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/fuzzy_finder.cpp.o.d"
+  "/root/repo/src/ftxui/component/hoverable.cpp" "CMakeFiles/component.dir/src/ftxui/component/hoverable.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/hoverable.cpp.o.d"
+  "/root/repo/src/ftxui/component/input.cpp" "CMakeFiles/component.dir/src/ftxui/component/input.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/input.cpp.o.d"
+  "/root/repo/src/ftxui/component/input_recording.cpp" "CMakeFiles/component.dir/src/ftxui/component/input_recording.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/input_recording.cpp.o.d"
+  "/root/repo/src/ftxui/component/lazy.cpp" "CMakeFiles/component.dir/src/ftxui/component/lazy.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/lazy.cpp.o.d"
+  "/root/repo/src/ftxui/component/log_view.cpp" "CMakeFiles/component.dir/src/ftxui/component/log_view.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/log_view.cpp.o.d"
+  "/root/repo/src/ftxui/component/loop.cpp" "CMakeFiles/component.dir/src/ftxui/component/loop.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/loop.cpp.o.d"
+  "/root/repo/src/ftxui/component/maybe.cpp" "CMakeFiles/component.dir/src/ftxui/component/maybe.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/maybe.cpp.o.d"
+  "/root/repo/src/ftxui/component/memo.cpp" "CMakeFiles/component.dir/src/ftxui/component/memo.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/memo.cpp.o.d"
+  "/root/repo/src/ftxui/component/menu.cpp" "CMakeFiles/component.dir/src/ftxui/component/menu.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/menu.cpp.o.d"
+  "/root/repo/src/ftxui/component/modal.cpp" "CMakeFiles/component.dir/src/ftxui/component/modal.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/modal.cpp.o.d"
+  "/root/repo/src/ftxui/component/observable.cpp" "CMakeFiles/component.dir/src/ftxui/component/observable.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/observable.cpp.o.d"
+  "/root/repo/src/ftxui/component/output_sink.cpp" "CMakeFiles/component.dir/src/ftxui/component/output_sink.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/output_sink.cpp.o.d"
+  "/root/repo/src/ftxui/component/radiobox.cpp" "CMakeFiles/component.dir/src/ftxui/component/radiobox.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/radiobox.cpp.o.d"
+  "/root/repo/src/ftxui/component/renderer.cpp" "CMakeFiles/component.dir/src/ftxui/component/renderer.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/renderer.cpp.o.d"
+  "/root/repo/src/ftxui/component/resizable_split.cpp" "CMakeFiles/component.dir/src/ftxui/component/resizable_split.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/resizable_split.cpp.o.d"
+  "/root/repo/src/ftxui/component/screen_interactive.cpp" "CMakeFiles/component.dir/src/ftxui/component/screen_interactive.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/screen_interactive.cpp.o.d"
+  "/root/repo/src/ftxui/component/session_server.cpp" "CMakeFiles/component.dir/src/ftxui/component/session_server.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/session_server.cpp.o.d"
+  "/root/repo/src/ftxui/component/slider.cpp" "CMakeFiles/component.dir/src/ftxui/component/slider.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/slider.cpp.o.d"
+  "/root/repo/src/ftxui/component/spinner.cpp" "CMakeFiles/component.dir/src/ftxui/component/spinner.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/spinner.cpp.o.d"
+  "/root/repo/src/ftxui/component/terminal_input_parser.cpp" "CMakeFiles/component.dir/src/ftxui/component/terminal_input_parser.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/terminal_input_parser.cpp.o.d"
+  "/root/repo/src/ftxui/component/text_area.cpp" "CMakeFiles/component.dir/src/ftxui/component/text_area.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/text_area.cpp.o.d"
+  "/root/repo/src/ftxui/component/tracer.cpp" "CMakeFiles/component.dir/src/ftxui/component/tracer.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/tracer.cpp.o.d"
+  "/root/repo/src/ftxui/component/tree_view.cpp" "CMakeFiles/component.dir/src/ftxui/component/tree_view.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/tree_view.cpp.o.d"
+  "/root/repo/src/ftxui/component/util.cpp" "CMakeFiles/component.dir/src/ftxui/component/util.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/util.cpp.o.d"
+  "/root/repo/src/ftxui/component/worker_pool.cpp" "CMakeFiles/component.dir/src/ftxui/component/worker_pool.cpp.o" "gcc" "CMakeFiles/component.dir/src/ftxui/component/worker_pool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_intrusive/CMakeFiles/dom.dir/DependInfo.cmake"
+  "/root/repo/_gate_intrusive/CMakeFiles/screen.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,75 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ftxui/dom/automerge.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/automerge.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/automerge.cpp.o.d"
+  "/root/repo/src/ftxui/dom/blink.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/blink.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/blink.cpp.o.d"
+  "/root/repo/src/ftxui/dom/bold.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/bold.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/bold.cpp.o.d"
+  "/root/repo/src/ftxui/dom/border.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/border.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/border.cpp.o.d"
+  "/root/repo/src/ftxui/dom/box_helper.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/box_helper.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/box_helper.cpp.o.d"
+  "/root/repo/src/ftxui/dom/cached.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/cached.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/cached.cpp.o.d"
+  "/root/repo/src/ftxui/dom/canvas.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/canvas.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/canvas.cpp.o.d"
+  "/root/repo/src/ftxui/dom/clear_under.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/clear_under.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/clear_under.cpp.o.d"
+  "/root/repo/src/ftxui/dom/color.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/color.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/color.cpp.o.d"
+  "/root/repo/src/ftxui/dom/columnar_table.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/columnar_table.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/columnar_table.cpp.o.d"
+  "/root/repo/src/ftxui/dom/composite_decorator.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/composite_decorator.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/composite_decorator.cpp.o.d"
+  "/root/repo/src/ftxui/dom/dbox.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/dbox.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/dbox.cpp.o.d"
+  "/root/repo/src/ftxui/dom/dim.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/dim.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/dim.cpp.o.d"
+  "/root/repo/src/ftxui/dom/flex.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/flex.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/flex.cpp.o.d"
+  "/root/repo/src/ftxui/dom/flexbox.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/flexbox.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/flexbox.cpp.o.d"
+  "/root/repo/src/ftxui/dom/flexbox_config.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/flexbox_config.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/flexbox_config.cpp.o.d"
+  "/root/repo/src/ftxui/dom/flexbox_helper.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/flexbox_helper.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/flexbox_helper.cpp.o.d"
+  "/root/repo/src/ftxui/dom/focus.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/focus.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/focus.cpp.o.d"
+  "/root/repo/src/ftxui/dom/frame.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/frame.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/frame.cpp.o.d"
+  "/root/repo/src/ftxui/dom/frame_arena.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/frame_arena.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/frame_arena.cpp.o.d"
+  "/root/repo/src/ftxui/dom/gauge.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/gauge.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/gauge.cpp.o.d"
+  "/root/repo/src/ftxui/dom/gradient.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/gradient.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/gradient.cpp.o.d"
+  "/root/repo/src/ftxui/dom/graph.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/graph.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/graph.cpp.o.d"
+  "/root/repo/src/ftxui/dom/gridbox.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/gridbox.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/gridbox.cpp.o.d"
+  "/root/repo/src/ftxui/dom/hbox.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/hbox.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/hbox.cpp.o.d"
+  "/root/repo/src/ftxui/dom/heatmap.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/heatmap.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/heatmap.cpp.o.d"
+  "/root/repo/src/ftxui/dom/hit_index.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/hit_index.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/hit_index.cpp.o.d"
+  "/root/repo/src/ftxui/dom/inverted.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/inverted.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/inverted.cpp.o.d"
+  "/root/repo/src/ftxui/dom/key_cache.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/key_cache.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/key_cache.cpp.o.d"
+  "/root/repo/src/ftxui/dom/layout_pool.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/layout_pool.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/layout_pool.cpp.o.d"
+  "/root/repo/src/ftxui/dom/log_buffer.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/log_buffer.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/log_buffer.cpp.o.d"
+  "/root/repo/src/ftxui/dom/mapped_file.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/mapped_file.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/mapped_file.cpp.o.d"
+  "/root/repo/src/ftxui/dom/node.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/node.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/node.cpp.o.d"
+  "/root/repo/src/ftxui/dom/node_decorator.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/node_decorator.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/node_decorator.cpp.o.d"
+  "/root/repo/src/ftxui/dom/paragraph.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/paragraph.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/paragraph.cpp.o.d"
+  "/root/repo/src/ftxui/dom/profiler.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/profiler.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/profiler.cpp.o.d"
+  "/root/repo/src/ftxui/dom/reflect.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/reflect.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/reflect.cpp.o.d"
+  "/root/repo/src/ftxui/dom/retained.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/retained.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/retained.cpp.o.d"
+  "/root/repo/src/ftxui/dom/scroll_indicator.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/scroll_indicator.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/scroll_indicator.cpp.o.d"
+  "/root/repo/src/ftxui/dom/separator.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/separator.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/separator.cpp.o.d"
+  "/root/repo/src/ftxui/dom/shared.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/shared.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/shared.cpp.o.d"
+  "/root/repo/src/ftxui/dom/size.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/size.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/size.cpp.o.d"
+  "/root/repo/src/ftxui/dom/spinner.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/spinner.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/spinner.cpp.o.d"
+  "/root/repo/src/ftxui/dom/static_layout.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/static_layout.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/static_layout.cpp.o.d"
+  "/root/repo/src/ftxui/dom/strikethrough.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/strikethrough.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/strikethrough.cpp.o.d"
+  "/root/repo/src/ftxui/dom/style.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/style.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/style.cpp.o.d"
+  "/root/repo/src/ftxui/dom/table.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/table.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/table.cpp.o.d"
+  "/root/repo/src/ftxui/dom/text.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/text.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/text.cpp.o.d"
+  "/root/repo/src/ftxui/dom/text_document.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/text_document.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/text_document.cpp.o.d"
+  "/root/repo/src/ftxui/dom/time_series.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/time_series.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/time_series.cpp.o.d"
+  "/root/repo/src/ftxui/dom/underlined.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/underlined.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/underlined.cpp.o.d"
+  "/root/repo/src/ftxui/dom/underlined_double.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/underlined_double.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/underlined_double.cpp.o.d"
+  "/root/repo/src/ftxui/dom/util.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/util.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/util.cpp.o.d"
+  "/root/repo/src/ftxui/dom/vbox.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/vbox.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/vbox.cpp.o.d"
+  "/root/repo/src/ftxui/dom/virtual_list.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/virtual_list.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/virtual_list.cpp.o.d"
+  "/root/repo/src/ftxui/dom/virtual_table.cpp" "CMakeFiles/dom.dir/src/ftxui/dom/virtual_table.cpp.o" "gcc" "CMakeFiles/dom.dir/src/ftxui/dom/virtual_table.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_intrusive/CMakeFiles/screen.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
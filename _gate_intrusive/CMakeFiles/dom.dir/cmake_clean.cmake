@@ -0,0 +1,121 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dom.dir/src/ftxui/dom/automerge.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/automerge.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/blink.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/blink.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/bold.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/bold.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/border.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/border.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/box_helper.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/box_helper.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/cached.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/cached.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/canvas.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/canvas.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/clear_under.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/clear_under.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/color.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/color.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/columnar_table.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/columnar_table.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/composite_decorator.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/composite_decorator.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/dbox.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/dbox.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/dim.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/dim.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/flex.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/flex.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/flexbox.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/flexbox.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/flexbox_config.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/flexbox_config.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/flexbox_helper.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/flexbox_helper.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/focus.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/focus.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/frame.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/frame.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/frame_arena.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/frame_arena.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/gauge.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/gauge.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/gradient.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/gradient.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/graph.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/graph.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/gridbox.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/gridbox.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/hbox.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/hbox.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/heatmap.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/heatmap.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/hit_index.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/hit_index.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/inverted.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/inverted.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/key_cache.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/key_cache.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/layout_pool.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/layout_pool.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/log_buffer.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/log_buffer.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/mapped_file.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/mapped_file.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/node.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/node.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/node_decorator.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/node_decorator.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/paragraph.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/paragraph.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/profiler.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/profiler.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/reflect.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/reflect.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/retained.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/retained.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/scroll_indicator.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/scroll_indicator.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/separator.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/separator.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/shared.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/shared.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/size.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/size.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/spinner.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/spinner.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/static_layout.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/static_layout.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/strikethrough.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/strikethrough.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/style.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/style.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/table.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/table.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/text.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/text.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/text_document.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/text_document.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/time_series.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/time_series.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/underlined.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/underlined.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/underlined_double.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/underlined_double.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/util.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/util.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/vbox.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/vbox.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/virtual_list.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/virtual_list.cpp.o.d"
+  "CMakeFiles/dom.dir/src/ftxui/dom/virtual_table.cpp.o"
+  "CMakeFiles/dom.dir/src/ftxui/dom/virtual_table.cpp.o.d"
+  "libftxui-dom.a"
+  "libftxui-dom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui-benchmark-latency.dir/src/ftxui/component/benchmark_latency.cpp.o"
+  "CMakeFiles/ftxui-benchmark-latency.dir/src/ftxui/component/benchmark_latency.cpp.o.d"
+  "ftxui-benchmark-latency"
+  "ftxui-benchmark-latency-3.0.0"
+  "ftxui-benchmark-latency.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui-benchmark-latency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ftxui/component/benchmark_test.cpp" "CMakeFiles/ftxui-benchmark.dir/src/ftxui/component/benchmark_test.cpp.o" "gcc" "CMakeFiles/ftxui-benchmark.dir/src/ftxui/component/benchmark_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/benchmark_allocations.cpp" "CMakeFiles/ftxui-benchmark.dir/src/ftxui/dom/benchmark_allocations.cpp.o" "gcc" "CMakeFiles/ftxui-benchmark.dir/src/ftxui/dom/benchmark_allocations.cpp.o.d"
+  "/root/repo/src/ftxui/dom/benchmark_test.cpp" "CMakeFiles/ftxui-benchmark.dir/src/ftxui/dom/benchmark_test.cpp.o" "gcc" "CMakeFiles/ftxui-benchmark.dir/src/ftxui/dom/benchmark_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/benchmark_test.cpp" "CMakeFiles/ftxui-benchmark.dir/src/ftxui/screen/benchmark_test.cpp.o" "gcc" "CMakeFiles/ftxui-benchmark.dir/src/ftxui/screen/benchmark_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_intrusive/CMakeFiles/dom.dir/DependInfo.cmake"
+  "/root/repo/_gate_intrusive/CMakeFiles/component.dir/DependInfo.cmake"
+  "/root/repo/_gate_intrusive/CMakeFiles/screen.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui-benchmark.dir/src/ftxui/component/benchmark_test.cpp.o"
+  "CMakeFiles/ftxui-benchmark.dir/src/ftxui/component/benchmark_test.cpp.o.d"
+  "CMakeFiles/ftxui-benchmark.dir/src/ftxui/dom/benchmark_allocations.cpp.o"
+  "CMakeFiles/ftxui-benchmark.dir/src/ftxui/dom/benchmark_allocations.cpp.o.d"
+  "CMakeFiles/ftxui-benchmark.dir/src/ftxui/dom/benchmark_test.cpp.o"
+  "CMakeFiles/ftxui-benchmark.dir/src/ftxui/dom/benchmark_test.cpp.o.d"
+  "CMakeFiles/ftxui-benchmark.dir/src/ftxui/screen/benchmark_test.cpp.o"
+  "CMakeFiles/ftxui-benchmark.dir/src/ftxui/screen/benchmark_test.cpp.o.d"
+  "ftxui-benchmark"
+  "ftxui-benchmark-3.0.0"
+  "ftxui-benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
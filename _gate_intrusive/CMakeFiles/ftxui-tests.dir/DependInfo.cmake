@@ -0,0 +1,107 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ftxui/component/animation_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/animation_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/animation_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/async_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/async_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/async_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/button_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/button_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/button_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/catch_event_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/catch_event_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/catch_event_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/collapsible_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/collapsible_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/collapsible_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/component_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/component_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/component_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/container_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/container_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/container_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/deferred_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/deferred_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/deferred_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/dropdown_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/dropdown_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/dropdown_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/filter_menu_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/filter_menu_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/filter_menu_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/frame_broadcast_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/frame_broadcast_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/frame_broadcast_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/fuzzy_finder_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/fuzzy_finder_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/fuzzy_finder_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/hoverable_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/hoverable_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/hoverable_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/input_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/input_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/input_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/log_view_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/log_view_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/log_view_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/memo_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/memo_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/memo_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/menu_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/menu_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/menu_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/modal_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/modal_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/modal_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/observable_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/observable_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/observable_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/output_sink_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/output_sink_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/output_sink_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/radiobox_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/radiobox_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/radiobox_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/receiver_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/receiver_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/receiver_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/resizable_split_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/resizable_split_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/resizable_split_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/screen_interactive_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/screen_interactive_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/screen_interactive_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/session_server_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/session_server_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/session_server_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/slider_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/slider_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/slider_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/spinner_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/spinner_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/spinner_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/terminal_input_parser_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/terminal_input_parser_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/terminal_input_parser_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/text_area_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/text_area_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/text_area_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/toggle_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/toggle_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/toggle_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/tracer_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/tracer_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/tracer_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/tree_view_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/tree_view_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/tree_view_test.cpp.o.d"
+  "/root/repo/src/ftxui/component/worker_pool_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/worker_pool_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/component/worker_pool_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/blink_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/blink_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/blink_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/bold_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/bold_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/bold_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/border_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/border_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/border_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/cached_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/cached_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/cached_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/canvas_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/canvas_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/canvas_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/color_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/color_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/color_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/columnar_table_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/columnar_table_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/columnar_table_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/dbox_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/dbox_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/dbox_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/dim_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/dim_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/dim_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/flexbox_helper_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/flexbox_helper_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/flexbox_helper_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/flexbox_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/flexbox_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/flexbox_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/frame_arena_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/frame_arena_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/frame_arena_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/frame_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/frame_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/frame_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/gauge_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gauge_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gauge_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/gradient_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gradient_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gradient_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/graph_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/graph_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/graph_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/gridbox_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gridbox_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/gridbox_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/hbox_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/hbox_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/hbox_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/heatmap_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/heatmap_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/heatmap_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/hit_index_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/hit_index_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/hit_index_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/key_cache_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/key_cache_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/key_cache_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/layout_pool_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/layout_pool_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/layout_pool_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/log_buffer_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/log_buffer_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/log_buffer_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/mapped_file_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/mapped_file_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/mapped_file_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/node_ptr_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_ptr_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_ptr_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/node_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/node_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/paragraph_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/paragraph_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/paragraph_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/profiler_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/profiler_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/profiler_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/retained_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/retained_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/retained_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/scroll_indicator_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/scroll_indicator_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/scroll_indicator_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/separator_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/separator_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/separator_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/shared_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/shared_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/shared_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/spinner_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/spinner_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/spinner_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/static_layout_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/static_layout_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/static_layout_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/style_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/style_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/style_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/table_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/table_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/table_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/text_document_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/text_document_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/text_document_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/text_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/text_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/text_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/time_series_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/time_series_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/time_series_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/underlined_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/underlined_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/underlined_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/util_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/util_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/util_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/vbox_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/vbox_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/vbox_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/virtual_list_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/virtual_list_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/virtual_list_test.cpp.o.d"
+  "/root/repo/src/ftxui/dom/virtual_table_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/virtual_table_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/dom/virtual_table_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/color_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/color_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/color_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/cursor_motion_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/cursor_motion_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/cursor_motion_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/frame_protocol_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/frame_protocol_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/frame_protocol_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/glyph_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/glyph_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/glyph_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/output_breakdown_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/output_breakdown_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/output_breakdown_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/row_compare_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/row_compare_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/row_compare_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/screen_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/screen_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/screen_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/screen_view_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/screen_view_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/screen_view_test.cpp.o.d"
+  "/root/repo/src/ftxui/screen/string_test.cpp" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/string_test.cpp.o" "gcc" "CMakeFiles/ftxui-tests.dir/src/ftxui/screen/string_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_intrusive/CMakeFiles/component.dir/DependInfo.cmake"
+  "/root/repo/_gate_intrusive/CMakeFiles/dom.dir/DependInfo.cmake"
+  "/root/repo/_gate_intrusive/CMakeFiles/screen.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ftxui/screen/box.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/box.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/box.cpp.o.d"
+  "/root/repo/src/ftxui/screen/color.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/color.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/color.cpp.o.d"
+  "/root/repo/src/ftxui/screen/color_info.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/color_info.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/color_info.cpp.o.d"
+  "/root/repo/src/ftxui/screen/cursor_motion.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/cursor_motion.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/cursor_motion.cpp.o.d"
+  "/root/repo/src/ftxui/screen/frame_protocol.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/frame_protocol.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/frame_protocol.cpp.o.d"
+  "/root/repo/src/ftxui/screen/glyph.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/glyph.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/glyph.cpp.o.d"
+  "/root/repo/src/ftxui/screen/output_breakdown.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/output_breakdown.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/output_breakdown.cpp.o.d"
+  "/root/repo/src/ftxui/screen/row_compare.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/row_compare.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/row_compare.cpp.o.d"
+  "/root/repo/src/ftxui/screen/screen.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/screen.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/screen.cpp.o.d"
+  "/root/repo/src/ftxui/screen/screen_view.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/screen_view.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/screen_view.cpp.o.d"
+  "/root/repo/src/ftxui/screen/string.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/string.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/string.cpp.o.d"
+  "/root/repo/src/ftxui/screen/terminal.cpp" "CMakeFiles/screen.dir/src/ftxui/screen/terminal.cpp.o" "gcc" "CMakeFiles/screen.dir/src/ftxui/screen/terminal.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
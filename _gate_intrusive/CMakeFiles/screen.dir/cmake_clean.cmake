@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/screen.dir/src/ftxui/screen/box.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/box.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/color.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/color.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/color_info.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/color_info.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/cursor_motion.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/cursor_motion.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/frame_protocol.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/frame_protocol.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/glyph.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/glyph.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/output_breakdown.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/output_breakdown.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/row_compare.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/row_compare.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/screen.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/screen.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/screen_view.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/screen_view.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/string.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/string.cpp.o.d"
+  "CMakeFiles/screen.dir/src/ftxui/screen/terminal.cpp.o"
+  "CMakeFiles/screen.dir/src/ftxui/screen/terminal.cpp.o.d"
+  "libftxui-screen.a"
+  "libftxui-screen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/screen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
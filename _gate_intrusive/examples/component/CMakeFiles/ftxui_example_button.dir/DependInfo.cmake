@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/component/button.cpp" "examples/component/CMakeFiles/ftxui_example_button.dir/button.cpp.o" "gcc" "examples/component/CMakeFiles/ftxui_example_button.dir/button.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_intrusive/CMakeFiles/component.dir/DependInfo.cmake"
+  "/root/repo/_gate_intrusive/CMakeFiles/dom.dir/DependInfo.cmake"
+  "/root/repo/_gate_intrusive/CMakeFiles/screen.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
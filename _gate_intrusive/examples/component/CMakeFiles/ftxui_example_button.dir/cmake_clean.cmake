@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_button.dir/button.cpp.o"
+  "CMakeFiles/ftxui_example_button.dir/button.cpp.o.d"
+  "ftxui_example_button"
+  "ftxui_example_button.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_button.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
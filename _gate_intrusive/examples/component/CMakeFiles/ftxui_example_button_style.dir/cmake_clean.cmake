@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_button_style.dir/button_style.cpp.o"
+  "CMakeFiles/ftxui_example_button_style.dir/button_style.cpp.o.d"
+  "ftxui_example_button_style"
+  "ftxui_example_button_style.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_button_style.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_custom_loop.dir/custom_loop.cpp.o"
+  "CMakeFiles/ftxui_example_custom_loop.dir/custom_loop.cpp.o.d"
+  "ftxui_example_custom_loop"
+  "ftxui_example_custom_loop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_custom_loop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
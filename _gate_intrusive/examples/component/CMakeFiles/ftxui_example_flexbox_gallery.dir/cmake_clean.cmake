@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_flexbox_gallery.dir/flexbox_gallery.cpp.o"
+  "CMakeFiles/ftxui_example_flexbox_gallery.dir/flexbox_gallery.cpp.o.d"
+  "ftxui_example_flexbox_gallery"
+  "ftxui_example_flexbox_gallery.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_flexbox_gallery.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_focus_cursor.dir/focus_cursor.cpp.o"
+  "CMakeFiles/ftxui_example_focus_cursor.dir/focus_cursor.cpp.o.d"
+  "ftxui_example_focus_cursor"
+  "ftxui_example_focus_cursor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_focus_cursor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
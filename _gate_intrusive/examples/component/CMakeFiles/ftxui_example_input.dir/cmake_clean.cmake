@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_input.dir/input.cpp.o"
+  "CMakeFiles/ftxui_example_input.dir/input.cpp.o.d"
+  "ftxui_example_input"
+  "ftxui_example_input.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_input.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_maybe.dir/maybe.cpp.o"
+  "CMakeFiles/ftxui_example_maybe.dir/maybe.cpp.o.d"
+  "ftxui_example_maybe"
+  "ftxui_example_maybe.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_maybe.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
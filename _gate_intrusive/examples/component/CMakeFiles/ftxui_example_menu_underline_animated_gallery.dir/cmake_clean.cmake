@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_menu_underline_animated_gallery.dir/menu_underline_animated_gallery.cpp.o"
+  "CMakeFiles/ftxui_example_menu_underline_animated_gallery.dir/menu_underline_animated_gallery.cpp.o.d"
+  "ftxui_example_menu_underline_animated_gallery"
+  "ftxui_example_menu_underline_animated_gallery.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_menu_underline_animated_gallery.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_modal_dialog.dir/modal_dialog.cpp.o"
+  "CMakeFiles/ftxui_example_modal_dialog.dir/modal_dialog.cpp.o.d"
+  "ftxui_example_modal_dialog"
+  "ftxui_example_modal_dialog.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_modal_dialog.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
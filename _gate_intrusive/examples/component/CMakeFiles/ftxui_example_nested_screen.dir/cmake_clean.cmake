@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_nested_screen.dir/nested_screen.cpp.o"
+  "CMakeFiles/ftxui_example_nested_screen.dir/nested_screen.cpp.o.d"
+  "ftxui_example_nested_screen"
+  "ftxui_example_nested_screen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_nested_screen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_print_key_press.dir/print_key_press.cpp.o"
+  "CMakeFiles/ftxui_example_print_key_press.dir/print_key_press.cpp.o.d"
+  "ftxui_example_print_key_press"
+  "ftxui_example_print_key_press.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_print_key_press.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
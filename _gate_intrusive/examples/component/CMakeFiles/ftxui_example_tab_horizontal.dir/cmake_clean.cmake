@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_tab_horizontal.dir/tab_horizontal.cpp.o"
+  "CMakeFiles/ftxui_example_tab_horizontal.dir/tab_horizontal.cpp.o.d"
+  "ftxui_example_tab_horizontal"
+  "ftxui_example_tab_horizontal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_tab_horizontal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_toggle.dir/toggle.cpp.o"
+  "CMakeFiles/ftxui_example_toggle.dir/toggle.cpp.o.d"
+  "ftxui_example_toggle"
+  "ftxui_example_toggle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_toggle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_with_restored_io.dir/with_restored_io.cpp.o"
+  "CMakeFiles/ftxui_example_with_restored_io.dir/with_restored_io.cpp.o.d"
+  "ftxui_example_with_restored_io"
+  "ftxui_example_with_restored_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_with_restored_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_border.dir/border.cpp.o"
+  "CMakeFiles/ftxui_example_border.dir/border.cpp.o.d"
+  "ftxui_example_border"
+  "ftxui_example_border.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_border.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_canvas.dir/canvas.cpp.o"
+  "CMakeFiles/ftxui_example_canvas.dir/canvas.cpp.o.d"
+  "ftxui_example_canvas"
+  "ftxui_example_canvas.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_canvas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_color_info_palette256.dir/color_info_palette256.cpp.o"
+  "CMakeFiles/ftxui_example_color_info_palette256.dir/color_info_palette256.cpp.o.d"
+  "ftxui_example_color_info_palette256"
+  "ftxui_example_color_info_palette256.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_color_info_palette256.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
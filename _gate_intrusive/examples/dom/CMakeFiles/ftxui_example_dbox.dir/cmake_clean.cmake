@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_dbox.dir/dbox.cpp.o"
+  "CMakeFiles/ftxui_example_dbox.dir/dbox.cpp.o.d"
+  "ftxui_example_dbox"
+  "ftxui_example_dbox.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_dbox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
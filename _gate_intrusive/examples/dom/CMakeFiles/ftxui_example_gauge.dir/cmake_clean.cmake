@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_gauge.dir/gauge.cpp.o"
+  "CMakeFiles/ftxui_example_gauge.dir/gauge.cpp.o.d"
+  "ftxui_example_gauge"
+  "ftxui_example_gauge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_gauge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
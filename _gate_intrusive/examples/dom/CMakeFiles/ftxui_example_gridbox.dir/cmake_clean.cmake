@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_gridbox.dir/gridbox.cpp.o"
+  "CMakeFiles/ftxui_example_gridbox.dir/gridbox.cpp.o.d"
+  "ftxui_example_gridbox"
+  "ftxui_example_gridbox.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_gridbox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
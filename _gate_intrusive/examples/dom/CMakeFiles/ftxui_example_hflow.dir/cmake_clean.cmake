@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_hflow.dir/hflow.cpp.o"
+  "CMakeFiles/ftxui_example_hflow.dir/hflow.cpp.o.d"
+  "ftxui_example_hflow"
+  "ftxui_example_hflow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_hflow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_html_like.dir/html_like.cpp.o"
+  "CMakeFiles/ftxui_example_html_like.dir/html_like.cpp.o.d"
+  "ftxui_example_html_like"
+  "ftxui_example_html_like.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_html_like.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_paragraph.dir/paragraph.cpp.o"
+  "CMakeFiles/ftxui_example_paragraph.dir/paragraph.cpp.o.d"
+  "ftxui_example_paragraph"
+  "ftxui_example_paragraph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_paragraph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
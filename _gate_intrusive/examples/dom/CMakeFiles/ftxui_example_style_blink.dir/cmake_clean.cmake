@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_style_blink.dir/style_blink.cpp.o"
+  "CMakeFiles/ftxui_example_style_blink.dir/style_blink.cpp.o.d"
+  "ftxui_example_style_blink"
+  "ftxui_example_style_blink.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_style_blink.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_style_bold.dir/style_bold.cpp.o"
+  "CMakeFiles/ftxui_example_style_bold.dir/style_bold.cpp.o.d"
+  "ftxui_example_style_bold"
+  "ftxui_example_style_bold.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_style_bold.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_style_color.dir/style_color.cpp.o"
+  "CMakeFiles/ftxui_example_style_color.dir/style_color.cpp.o.d"
+  "ftxui_example_style_color"
+  "ftxui_example_style_color.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_style_color.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
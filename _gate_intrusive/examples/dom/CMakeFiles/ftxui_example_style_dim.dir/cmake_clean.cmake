@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_style_dim.dir/style_dim.cpp.o"
+  "CMakeFiles/ftxui_example_style_dim.dir/style_dim.cpp.o.d"
+  "ftxui_example_style_dim"
+  "ftxui_example_style_dim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_style_dim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_style_strikethrough.dir/style_strikethrough.cpp.o"
+  "CMakeFiles/ftxui_example_style_strikethrough.dir/style_strikethrough.cpp.o.d"
+  "ftxui_example_style_strikethrough"
+  "ftxui_example_style_strikethrough.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_style_strikethrough.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
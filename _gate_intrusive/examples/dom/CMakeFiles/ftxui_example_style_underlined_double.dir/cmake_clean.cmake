@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_style_underlined_double.dir/style_underlined_double.cpp.o"
+  "CMakeFiles/ftxui_example_style_underlined_double.dir/style_underlined_double.cpp.o.d"
+  "ftxui_example_style_underlined_double"
+  "ftxui_example_style_underlined_double.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_style_underlined_double.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ftxui_example_vbox_hbox.dir/vbox_hbox.cpp.o"
+  "CMakeFiles/ftxui_example_vbox_hbox.dir/vbox_hbox.cpp.o.d"
+  "ftxui_example_vbox_hbox"
+  "ftxui_example_vbox_hbox.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ftxui_example_vbox_hbox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_intrusive/ftxui-tests[1]_tests.cmake")
+  include("/root/repo/_gate_intrusive/ftxui-tests[1]_tests.cmake")
+else()
+  add_test(ftxui-tests_NOT_BUILT ftxui-tests_NOT_BUILT)
+endif()
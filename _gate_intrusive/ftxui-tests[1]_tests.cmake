@@ -0,0 +1,1121 @@
+add_test([=[AnimationTest.StartAndEnd]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=AnimationTest.StartAndEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AnimationTest.StartAndEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AnimationTest.Scheduler]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=AnimationTest.Scheduler]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AnimationTest.Scheduler]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncTest.WithoutScreen]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=AsyncTest.WithoutScreen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncTest.WithoutScreen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncTest.ResumedByTheLoop]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=AsyncTest.ResumedByTheLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncTest.ResumedByTheLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncTest.Exception]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=AsyncTest.Exception]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncTest.Exception]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AsyncTest.Cancel]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=AsyncTest.Cancel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AsyncTest.Cancel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ButtonTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ButtonTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ButtonTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ButtonTest.StringViewLabel]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ButtonTest.StringViewLabel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ButtonTest.StringViewLabel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ButtonTest.Animation]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ButtonTest.Animation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ButtonTest.Animation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ButtonTest.TransformCached]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ButtonTest.TransformCached]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ButtonTest.TransformCached]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CatchEventTest.Filter]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CatchEventTest.Filter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CatchEventTest.Filter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollapsibleTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CollapsibleTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollapsibleTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollapsibleTest.Factory]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CollapsibleTest.Factory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollapsibleTest.Factory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.DeleteParentFirst]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.DeleteParentFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.DeleteParentFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.DeleteChildFirst]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.DeleteChildFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.DeleteChildFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.Detach]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.Detach]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.Detach]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.DetachAllChildren]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.DetachAllChildren]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.DetachAllChildren]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.Add]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.Add]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.Add]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.ChildAt]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.ChildAt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.ChildAt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.HorizontalEvent]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.HorizontalEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.HorizontalEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.VerticalEvent]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.VerticalEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.VerticalEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.SetActiveChild]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.SetActiveChild]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.SetActiveChild]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.TakeFocus]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.TakeFocus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.TakeFocus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.TabFocusable]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.TabFocusable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.TabFocusable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.LazyTab]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.LazyTab]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.LazyTab]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.TabAnimatesTheTabShown]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.TabAnimatesTheTabShown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.TabAnimatesTheTabShown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.MaybeAnimatesWhenShown]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.MaybeAnimatesWhenShown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.MaybeAnimatesWhenShown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ContainerTest.VirtualVertical]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ContainerTest.VirtualVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ContainerTest.VirtualVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ComponentTest.NonFocusableAreNotFocused]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ComponentTest.NonFocusableAreNotFocused]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ComponentTest.NonFocusableAreNotFocused]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ComponentTest.FocusCache]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ComponentTest.FocusCache]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ComponentTest.FocusCache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ComponentTest.HandleEventWithoutCopy]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ComponentTest.HandleEventWithoutCopy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ComponentTest.HandleEventWithoutCopy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DeferredTest.Placeholder]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=DeferredTest.Placeholder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DeferredTest.Placeholder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DeferredTest.WithoutScreen]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=DeferredTest.WithoutScreen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DeferredTest.WithoutScreen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DropdownTest.ListBuiltWhenOpened]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=DropdownTest.ListBuiltWhenOpened]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DropdownTest.ListBuiltWhenOpened]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FilterIndexTest.Refine]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FilterIndexTest.Refine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FilterIndexTest.Refine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FilterIndexTest.Refresh]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FilterIndexTest.Refresh]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FilterIndexTest.Refresh]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FilterMenuTest.TypeAhead]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FilterMenuTest.TypeAhead]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FilterMenuTest.TypeAhead]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameBroadcastTest.SameBytesForEveryViewer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameBroadcastTest.SameBytesForEveryViewer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameBroadcastTest.SameBytesForEveryViewer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameBroadcastTest.SlowViewerGetsKeyframes]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameBroadcastTest.SlowViewerGetsKeyframes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameBroadcastTest.SlowViewerGetsKeyframes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameBroadcastTest.DisconnectedViewer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameBroadcastTest.DisconnectedViewer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameBroadcastTest.DisconnectedViewer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameBroadcastTest.ScreenInteractive]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameBroadcastTest.ScreenInteractive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameBroadcastTest.ScreenInteractive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FuzzyIndexTest.Score]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FuzzyIndexTest.Score]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FuzzyIndexTest.Score]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FuzzyIndexTest.BestMatches]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FuzzyIndexTest.BestMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FuzzyIndexTest.BestMatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FuzzyFinderTest.TypeAhead]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FuzzyFinderTest.TypeAhead]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FuzzyFinderTest.TypeAhead]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HoverableTest.BasicBool]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HoverableTest.BasicBool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HoverableTest.BasicBool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HoverableTest.BasicCallback]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HoverableTest.BasicCallback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HoverableTest.BasicCallback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HoverableTest.BasicBoolCallback]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HoverableTest.BasicBoolCallback]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HoverableTest.BasicBoolCallback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HoverableTest.Coverage]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HoverableTest.Coverage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HoverableTest.Coverage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Init]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.Init]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Init]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Type]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.Type]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Type]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Paste]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.Paste]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Paste]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.TypePassword]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.TypePassword]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.TypePassword]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Arrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.Arrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Arrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Insert]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Insert]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Home]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.Home]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Home]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.End]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.End]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.End]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Delete]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.Delete]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Delete]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.Backspace]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.Backspace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.Backspace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.EditUnicode]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.EditUnicode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.EditUnicode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.ContentModifiedOutside]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.ContentModifiedOutside]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.ContentModifiedOutside]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.MouseClick]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.MouseClick]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.MouseClick]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.MouseClickComplex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.MouseClickComplex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.MouseClickComplex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.CtrlArrowLeft]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.CtrlArrowLeft]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.CtrlArrowLeft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.CtrlArrowLeft2]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.CtrlArrowLeft2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.CtrlArrowLeft2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.CtrlArrowRight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.CtrlArrowRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.CtrlArrowRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.CtrlArrowRight2]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.CtrlArrowRight2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.CtrlArrowRight2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.CtrlArrowAfterEdit]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.CtrlArrowAfterEdit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.CtrlArrowAfterEdit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.GapBuffer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.GapBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.GapBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InputTest.GapBufferOnChange]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=InputTest.GapBufferOnChange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InputTest.GapBufferOnChange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogViewTest.FollowAndScroll]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LogViewTest.FollowAndScroll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogViewTest.FollowAndScroll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemoTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MemoTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.RemoveEntries]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.RemoveEntries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.RemoveEntries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.DirectionDown]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.DirectionDown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.DirectionDown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.DirectionsUp]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.DirectionsUp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.DirectionsUp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.DirectionsRight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.DirectionsRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.DirectionsRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.DirectionsLeft]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.DirectionsLeft]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.DirectionsLeft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.AnimationsHorizontal]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.AnimationsHorizontal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.AnimationsHorizontal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.AnimationsVertical]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.AnimationsVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.AnimationsVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.Virtualized]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.Virtualized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.Virtualized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.MemoryUsage]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.MemoryUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.MemoryUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MenuTest.Adapter]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MenuTest.Adapter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MenuTest.Adapter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ModalTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ModalTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ModalTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ModalTest.FreezeMain]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ModalTest.FreezeMain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ModalTest.FreezeMain]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObservableTest.MemoRendersOnChange]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ObservableTest.MemoRendersOnChange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObservableTest.MemoRendersOnChange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObservableTest.NestedMemo]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ObservableTest.NestedMemo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObservableTest.NestedMemo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObservableTest.Ref]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ObservableTest.Ref]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObservableTest.Ref]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObservableTest.ConstStringRefVersion]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ObservableTest.ConstStringRefVersion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObservableTest.ConstStringRefVersion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObservableTest.Input]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ObservableTest.Input]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObservableTest.Input]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputSinkTest.WriteOnFlush]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=OutputSinkTest.WriteOnFlush]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputSinkTest.WriteOnFlush]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputSinkTest.NonBlockingPartialWrites]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=OutputSinkTest.NonBlockingPartialWrites]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputSinkTest.NonBlockingPartialWrites]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputSinkTest.WriterThread]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=OutputSinkTest.WriterThread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputSinkTest.WriterThread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputSinkTest.WriteDeferred]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=OutputSinkTest.WriteDeferred]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputSinkTest.WriteDeferred]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationArrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.NavigationArrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationArrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationArrowVim]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.NavigationArrowVim]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationArrowVim]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationTab]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.NavigationTab]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationTab]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationHome]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.NavigationHome]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationHome]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationPageDown]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.NavigationPageDown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationPageDown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationPageUp]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.NavigationPageUp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationPageUp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.NavigationEnd]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.NavigationEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.NavigationEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.EventSpace]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.EventSpace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.EventSpace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.RemoveEntries]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.RemoveEntries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.RemoveEntries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RadioboxTest.Virtualized]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RadioboxTest.Virtualized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RadioboxTest.Virtualized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Receiver.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.BasicWithThread]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Receiver.BasicWithThread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.BasicWithThread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.ManyProducers]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Receiver.ManyProducers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.ManyProducers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.SendAll]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Receiver.SendAll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.SendAll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Receiver.MoveOnly]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Receiver.MoveOnly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Receiver.MoveOnly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicLeft]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ResizableSplit.BasicLeft]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicLeft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicRight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ResizableSplit.BasicRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicTop]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ResizableSplit.BasicTop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicTop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.BasicBottom]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ResizableSplit.BasicBottom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.BasicBottom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResizableSplit.DragReusesThePanes]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ResizableSplit.DragReusesThePanes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResizableSplit.DragReusesThePanes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGTERM]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.Signal_SIGTERM]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGTERM]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGSEGV]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.Signal_SIGSEGV]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGSEGV]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGINT]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.Signal_SIGINT]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGINT]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGILL]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.Signal_SIGILL]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGILL]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGABRT]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.Signal_SIGABRT]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGABRT]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Signal_SIGFPE]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.Signal_SIGFPE]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Signal_SIGFPE]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PostEventToNonActive]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.PostEventToNonActive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PostEventToNonActive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PostTaskToNonActive]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.PostTaskToNonActive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PostTaskToNonActive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.AnimationFrame]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.AnimationFrame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.AnimationFrame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.CoalesceEvents]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.CoalesceEvents]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.CoalesceEvents]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PriorityLanes]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.PriorityLanes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PriorityLanes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.MaxFrameRate]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.MaxFrameRate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.MaxFrameRate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ResizeDebounce]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.ResizeDebounce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ResizeDebounce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.FrameBudget]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.FrameBudget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.FrameBudget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.MouseMotionOnDemand]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.MouseMotionOnDemand]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.MouseMotionOnDemand]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.RedrawOnlyHandledEvents]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.RedrawOnlyHandledEvents]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.RedrawOnlyHandledEvents]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PostBatch]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.PostBatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PostBatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.InputStatistics]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.InputStatistics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.InputStatistics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.InputRecordingSerialize]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.InputRecordingSerialize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.InputRecordingSerialize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Replay]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.Replay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Replay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Headless]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.Headless]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Headless]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.Stats]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.Stats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.Stats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PasteAsTyped]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.PasteAsTyped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PasteAsTyped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PipelinedRender]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.PipelinedRender]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PipelinedRender]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.PrintStatic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.PrintStatic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.PrintStatic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.WatchSlowFrames]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.WatchSlowFrames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.WatchSlowFrames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.CursorPositionReport]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.CursorPositionReport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.CursorPositionReport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.ProbeTerminal]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.ProbeTerminal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.ProbeTerminal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.UpdateState]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.UpdateState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.UpdateState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.RunAsync]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.RunAsync]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.RunAsync]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.FrameProtocol]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.FrameProtocol]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.FrameProtocol]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.HostEventLoop]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.HostEventLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.HostEventLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenInteractive.NonInteractiveOutput]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenInteractive.NonInteractiveOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenInteractive.NonInteractiveOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SessionServerTest.Sessions]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SessionServerTest.Sessions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SessionServerTest.Sessions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SessionServerTest.Resize]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SessionServerTest.Resize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SessionServerTest.Resize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Right]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SliderTest.Right]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Right]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Left]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SliderTest.Left]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Left]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Down]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SliderTest.Down]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Down]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Up]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SliderTest.Up]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Up]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SliderTest.Focus]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SliderTest.Focus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SliderTest.Focus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.FollowsTheClock]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SpinnerTest.FollowsTheClock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.FollowsTheClock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.Spinner1]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SpinnerTest.Spinner1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.Spinner1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.Spinner2]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SpinnerTest.Spinner2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.Spinner2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.Spinner3]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SpinnerTest.Spinner3]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.Spinner3]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpinnerTest.Spinner4]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SpinnerTest.Spinner4]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpinnerTest.Spinner4]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.Character]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.Character]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.Character]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.Buffer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.Buffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.Buffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.Paste]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.Paste]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.Paste]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.EscapeKeyWithoutWaiting]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.EscapeKeyWithoutWaiting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.EscapeKeyWithoutWaiting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.EscapeKeyNotEnoughWait]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.EscapeKeyNotEnoughWait]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.EscapeKeyNotEnoughWait]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.EscapeKeyEnoughWait]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.EscapeKeyEnoughWait]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.EscapeKeyEnoughWait]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.HasPending]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.HasPending]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.HasPending]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseLeftClickPressed]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.MouseLeftClickPressed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseLeftClickPressed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseLeftClickReleased]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.MouseLeftClickReleased]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseLeftClickReleased]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseReporting]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.MouseReporting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseReporting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseMiddleClick]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.MouseMiddleClick]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseMiddleClick]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.MouseRightClick]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.MouseRightClick]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.MouseRightClick]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.ModeReporting]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.ModeReporting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.ModeReporting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.DeviceAttributes]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.DeviceAttributes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.DeviceAttributes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.TerminalVersion]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.TerminalVersion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.TerminalVersion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.UTF8]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.UTF8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.UTF8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.NewLine]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.NewLine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.NewLine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.Control]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.Control]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.Control]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Event.Special]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=Event.Special]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Event.Special]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextAreaTest.Type]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextAreaTest.Type]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextAreaTest.Type]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextAreaTest.Paste]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextAreaTest.Paste]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextAreaTest.Paste]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextAreaTest.VerticalMoves]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextAreaTest.VerticalMoves]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextAreaTest.VerticalMoves]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextAreaTest.Render]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextAreaTest.Render]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextAreaTest.Render]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextAreaTest.LargeContent]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextAreaTest.LargeContent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextAreaTest.LargeContent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextAreaTest.MouseClick]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextAreaTest.MouseClick]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextAreaTest.MouseClick]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.leftRightArrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ToggleTest.leftRightArrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.leftRightArrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.Tab]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ToggleTest.Tab]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.Tab]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.OnChange]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ToggleTest.OnChange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.OnChange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.OnEnter]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ToggleTest.OnEnter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.OnEnter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ToggleTest.RemoveEntries]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ToggleTest.RemoveEntries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ToggleTest.RemoveEntries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TracerTest.Json]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TracerTest.Json]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TracerTest.Json]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TracerTest.ScreenInteractive]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TracerTest.ScreenInteractive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TracerTest.ScreenInteractive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TreeViewTest.ExpandAndCollapse]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TreeViewTest.ExpandAndCollapse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TreeViewTest.ExpandAndCollapse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TreeViewTest.Async]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TreeViewTest.Async]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TreeViewTest.Async]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkerPoolTest.RunsEveryJob]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=WorkerPoolTest.RunsEveryJob]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkerPoolTest.RunsEveryJob]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkerPoolTest.NestedJobsAreStolen]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=WorkerPoolTest.NestedJobsAreStolen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkerPoolTest.NestedJobsAreStolen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BlinkTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BlinkTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BlinkTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoldTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BoldTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoldTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Default]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BorderTest.Default]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Default]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Light]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BorderTest.Light]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Light]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Double]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BorderTest.Double]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Double]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Rounded]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BorderTest.Rounded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Rounded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Heavy]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BorderTest.Heavy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Heavy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Empty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BorderTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Styled]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BorderTest.Styled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Styled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.WithPixel]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BorderTest.WithPixel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.WithPixel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BorderTest.Window]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=BorderTest.Window]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BorderTest.Window]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CachedTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.Moved]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CachedTest.Moved]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.Moved]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.MovedReflect]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CachedTest.MovedReflect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.MovedReflect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.Resized]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CachedTest.Resized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.Resized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.PartiallyVisible]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CachedTest.PartiallyVisible]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.PartiallyVisible]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.PartiallyHidden]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CachedTest.PartiallyHidden]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.PartiallyHidden]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.HiddenBySameLayer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CachedTest.HiddenBySameLayer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.HiddenBySameLayer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CachedTest.KeyCache]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CachedTest.KeyCache]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CachedTest.KeyCache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldPoint]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.GoldPoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldPoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldPointColor]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.GoldPointColor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldPointColor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldBlock]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.GoldBlock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldBlock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldBlockColor]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.GoldBlockColor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldBlockColor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.GoldText]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.GoldText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.GoldText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawPoints]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.DrawPoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawPoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawPointPolyline]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.DrawPointPolyline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawPointPolyline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.Scroll]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.Scroll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.Scroll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.ScrollBlockAndText]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.ScrollBlockAndText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.ScrollBlockAndText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.Wide]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.Wide]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.Wide]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.DrawImage]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.DrawImage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.DrawImage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CanvasTest.ImageElement]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CanvasTest.ImageElement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CanvasTest.ImageElement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Foreground]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.Foreground]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Foreground]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Background]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.Background]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Background]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintTransparent]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.PrintTransparent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintTransparent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintColor16]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.PrintColor16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintColor16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintColor256]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.PrintColor256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintColor256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintTrueCOlor]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.PrintTrueCOlor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintTrueCOlor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.PrintAppend]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.PrintAppend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.PrintAppend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.FallbackTo256]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.FallbackTo256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.FallbackTo256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.FallbackTo256Nearest]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.FallbackTo256Nearest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.FallbackTo256Nearest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.FallbackTo16]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.FallbackTo16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.FallbackTo16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Litterals]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.Litterals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Litterals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Interpolate]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.Interpolate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Interpolate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.Pack]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.Pack]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.Pack]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColorTest.HSV]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColorTest.HSV]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColorTest.HSV]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColumnarTableTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColumnarTableTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColumnarTableTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColumnarTableTest.FormatOnlyVisibleRows]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColumnarTableTest.FormatOnlyVisibleRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColumnarTableTest.FormatOnlyVisibleRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ColumnarTableTest.ShorterColumn]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ColumnarTableTest.ShorterColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ColumnarTableTest.ShorterColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBoxTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=DBoxTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBoxTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBoxTest.OpaqueLayerHidesTheLowerOnes]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=DBoxTest.OpaqueLayerHidesTheLowerOnes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBoxTest.OpaqueLayerHidesTheLowerOnes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBoxTest.OpaqueLayerClipsTheLowerOnes]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=DBoxTest.OpaqueLayerClipsTheLowerOnes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBoxTest.OpaqueLayerClipsTheLowerOnes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBoxTest.OpaqueModal]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=DBoxTest.OpaqueModal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBoxTest.OpaqueModal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBoxTest.OpaqueLayerHidesTheLowerChildren]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=DBoxTest.OpaqueLayerHidesTheLowerChildren]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBoxTest.OpaqueLayerHidesTheLowerChildren]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DimTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=DimTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DimTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.BasicRow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxHelperTest.BasicRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.BasicRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.BasicColumn]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxHelperTest.BasicColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.BasicColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.BasicRowInversed]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxHelperTest.BasicRowInversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.BasicRowInversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.BasicColumnInversed]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxHelperTest.BasicColumnInversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.BasicColumnInversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxHelperTest.ReuseWorkspace]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxHelperTest.ReuseWorkspace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxHelperTest.ReuseWorkspace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.BasicRow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.BasicRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.BasicRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.BasicRowInversed]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.BasicRowInversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.BasicRowInversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.BasicColumn]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.BasicColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.BasicColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.BasicColumnInversed]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.BasicColumnInversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.BasicColumnInversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.JustifyContentCenter]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.JustifyContentCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.JustifyContentCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.JustifyContentSpaceBetween]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.JustifyContentSpaceBetween]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.JustifyContentSpaceBetween]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.JustifyContentSpaceAround]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.JustifyContentSpaceAround]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.JustifyContentSpaceAround]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.JustifyContentSpaceEvenly]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.JustifyContentSpaceEvenly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.JustifyContentSpaceEvenly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignItemsFlexEnd]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.AlignItemsFlexEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignItemsFlexEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignItemsCenter]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.AlignItemsCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignItemsCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentFlexEnd]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.AlignContentFlexEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentFlexEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentCenter]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.AlignContentCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentSpaceBetween]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.AlignContentSpaceBetween]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentSpaceBetween]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentSpaceAround]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.AlignContentSpaceAround]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentSpaceAround]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.AlignContentSpaceEvenly]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.AlignContentSpaceEvenly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.AlignContentSpaceEvenly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.GapX]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.GapX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.GapX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.GapX2]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.GapX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.GapX2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.GapY]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.GapY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.GapY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.Focus]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.Focus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.Focus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlexboxTest.RenderAgain]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FlexboxTest.RenderAgain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlexboxTest.RenderAgain]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameArenaTest.Current]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameArenaTest.Current]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameArenaTest.Current]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameArenaTest.Render]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameArenaTest.Render]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameArenaTest.Render]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameArenaTest.ElementOutlivesReset]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameArenaTest.ElementOutlivesReset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameArenaTest.ElementOutlivesReset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameArenaTest.ElementOutlivesArena]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameArenaTest.ElementOutlivesArena]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameArenaTest.ElementOutlivesArena]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameArenaTest.MemoryResource]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameArenaTest.MemoryResource]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameArenaTest.MemoryResource]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameTest.Scrollable]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameTest.Scrollable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameTest.Scrollable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameTest.ScrollableFocus]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameTest.ScrollableFocus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameTest.ScrollableFocus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameTest.ScrollableVirtual]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameTest.ScrollableVirtual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameTest.ScrollableVirtual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.ZeroHorizontal]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GaugeTest.ZeroHorizontal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.ZeroHorizontal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.HalfHorizontal]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GaugeTest.HalfHorizontal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.HalfHorizontal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.OneHorizontal]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GaugeTest.OneHorizontal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.OneHorizontal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.ZeroVertical]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GaugeTest.ZeroVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.ZeroVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.HalfVertical]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GaugeTest.HalfVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.HalfVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GaugeTest.OneVertical]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GaugeTest.OneVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GaugeTest.OneVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GradientTest.Stops]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GradientTest.Stops]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GradientTest.Stops]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GradientTest.StopsKeepEnds]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GradientTest.StopsKeepEnds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GradientTest.StopsKeepEnds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GradientTest.Linear]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GradientTest.Linear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GradientTest.Linear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GradientTest.LinearVertical]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GradientTest.LinearVertical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GradientTest.LinearVertical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GradientTest.Radial]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GradientTest.Radial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GradientTest.Radial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GraphTest.Buffer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GraphTest.Buffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GraphTest.Buffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.UnfilledRectangular]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.UnfilledRectangular]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.UnfilledRectangular]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.DifferentSize]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.DifferentSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.DifferentSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.CenterFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.CenterFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.CenterFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.CenterFlexCross]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.CenterFlexCross]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.CenterFlexCross]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.CenterShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.CenterShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.CenterShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.CenterShrinkColumn]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.CenterShrinkColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.CenterShrinkColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Vertical_NoFlex_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Vertical_NoFlex_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Vertical_NoFlex_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexGrow_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_FlexGrow_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexGrow_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Vertical_FlexGrow_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Vertical_FlexGrow_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Vertical_FlexGrow_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_FlexGrow_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_FlexGrow_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_FlexGrow_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_NoFlex_FlexGrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexGrow_NoFlex_FlexGrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_FlexGrow_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexGrow_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexGrow_FlexGrow_FlexGrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_FlexGrow_FlexGrow_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexGrow_FlexGrow_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexShrink_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_FlexShrink_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexShrink_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_FlexShrink_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_FlexShrink_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_FlexShrink_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_NoFlex_NoFlex_FlexShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_NoFlex_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_NoFlex_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexShrink_NoFlex_FlexShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_FlexShrink_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexShrink_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexShrink_FlexShrink_FlexShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_FlexShrink_FlexShrink_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexShrink_FlexShrink_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Horizontal_FlexGrow_NoFlex_FlewShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Horizontal_FlexGrow_NoFlex_FlewShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Horizontal_FlexGrow_NoFlex_FlewShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.MissingCells]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.MissingCells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.MissingCells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.Focus]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.Focus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.Focus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GridboxTest.PinnedColumnWidths]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GridboxTest.PinnedColumnWidths]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GridboxTest.PinnedColumnWidths]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.NoFlex_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexGrow_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.FlexGrow_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexGrow_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_FlexGrow_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.NoFlex_FlexGrow_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_FlexGrow_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_NoFlex_FlexGrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.NoFlex_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexGrow_NoFlex_FlexGrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.FlexGrow_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexGrow_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexGrow_FlexGrow_FlexGrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.FlexGrow_FlexGrow_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexGrow_FlexGrow_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexShrink_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.FlexShrink_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexShrink_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_FlexShrink_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.NoFlex_FlexShrink_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_FlexShrink_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.NoFlex_NoFlex_FlexShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.NoFlex_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.NoFlex_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexShrink_NoFlex_FlexShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.FlexShrink_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexShrink_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexShrink_FlexShrink_FlexShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.FlexShrink_FlexShrink_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexShrink_FlexShrink_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.FlexGrow_NoFlex_FlewShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.FlexGrow_NoFlex_FlewShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.FlexGrow_NoFlex_FlewShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HBoxTest.VariadicArguments]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HBoxTest.VariadicArguments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HBoxTest.VariadicArguments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HeatmapTest.ColorMap]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HeatmapTest.ColorMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HeatmapTest.ColorMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HeatmapTest.Render]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HeatmapTest.Render]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HeatmapTest.Render]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HeatmapTest.HalfBlocks]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HeatmapTest.HalfBlocks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HeatmapTest.HalfBlocks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HitIndexTest.Empty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HitIndexTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HitIndexTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HitIndexTest.Reflect]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=HitIndexTest.Reflect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HitIndexTest.Reflect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KeyCacheTest.NoCache]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=KeyCacheTest.NoCache]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KeyCacheTest.NoCache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KeyCacheTest.Reuse]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=KeyCacheTest.Reuse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KeyCacheTest.Reuse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KeyCacheTest.SameFrame]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=KeyCacheTest.SameFrame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KeyCacheTest.SameFrame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KeyCacheTest.UnusedKeysAreReleased]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=KeyCacheTest.UnusedKeysAreReleased]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KeyCacheTest.UnusedKeysAreReleased]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KeyCacheTest.Render]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=KeyCacheTest.Render]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KeyCacheTest.Render]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutPoolTest.ParallelFor]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LayoutPoolTest.ParallelFor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutPoolTest.ParallelFor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutPoolTest.Scope]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LayoutPoolTest.Scope]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutPoolTest.Scope]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutPoolTest.SameAsSerial]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LayoutPoolTest.SameAsSerial]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutPoolTest.SameAsSerial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutPoolTest.Frame]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LayoutPoolTest.Frame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutPoolTest.Frame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutPoolTest.ParallelRender]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LayoutPoolTest.ParallelRender]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutPoolTest.ParallelRender]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LayoutPoolTest.ParallelRenderFrame]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LayoutPoolTest.ParallelRenderFrame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LayoutPoolTest.ParallelRenderFrame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogBufferTest.RingBuffer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LogBufferTest.RingBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogBufferTest.RingBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogBufferTest.SplitLines]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LogBufferTest.SplitLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogBufferTest.SplitLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogBufferTest.Fullwidth]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LogBufferTest.Fullwidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogBufferTest.Fullwidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogBufferTest.RenderTail]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LogBufferTest.RenderTail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogBufferTest.RenderTail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LogBufferTest.RenderFromTheBottom]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=LogBufferTest.RenderFromTheBottom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LogBufferTest.RenderFromTheBottom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MappedFileTest.Missing]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MappedFileTest.Missing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MappedFileTest.Missing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MappedFileTest.Empty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MappedFileTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MappedFileTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MappedFileTest.Lines]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MappedFileTest.Lines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MappedFileTest.Lines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MappedFileTest.ManyLines]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MappedFileTest.ManyLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MappedFileTest.ManyLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MappedFileTest.Render]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MappedFileTest.Render]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MappedFileTest.Render]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MappedFileTest.Hex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=MappedFileTest.Hex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MappedFileTest.Hex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodePtrTest.Null]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodePtrTest.Null]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodePtrTest.Null]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodePtrTest.Lifetime]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodePtrTest.Lifetime]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodePtrTest.Lifetime]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodePtrTest.Arena]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodePtrTest.Arena]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodePtrTest.Arena]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodePtrTest.Render]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodePtrTest.Render]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodePtrTest.Render]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.OnePass]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodeTest.OnePass]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.OnePass]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.Measured]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodeTest.Measured]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.Measured]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.Iterations]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodeTest.Iterations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.Iterations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.LayoutThenRender]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodeTest.LayoutThenRender]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.LayoutThenRender]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.ParagraphConverges]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodeTest.ParagraphConverges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.ParagraphConverges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.RenderTiled]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodeTest.RenderTiled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.RenderTiled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NodeTest.RenderConcurrently]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=NodeTest.RenderConcurrently]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NodeTest.RenderConcurrently]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.Left]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ParagraphTest.Left]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.Left]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.Right]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ParagraphTest.Right]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.Right]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.Center]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ParagraphTest.Center]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.Center]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.Justify]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ParagraphTest.Justify]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.Justify]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.LongWordIsTruncated]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ParagraphTest.LongWordIsTruncated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.LongWordIsTruncated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.Requirement]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ParagraphTest.Requirement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.Requirement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParagraphTest.RenderAgain]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ParagraphTest.RenderAgain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParagraphTest.RenderAgain]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfilerTest.Report]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ProfilerTest.Report]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfilerTest.Report]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfilerTest.NotActive]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ProfilerTest.NotActive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfilerTest.NotActive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfilerTest.DebugOverlay]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ProfilerTest.DebugOverlay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfilerTest.DebugOverlay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfilerTest.DescribeTree]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ProfilerTest.DescribeTree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfilerTest.DescribeTree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfilerTest.DescribeTreeMemory]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ProfilerTest.DescribeTreeMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfilerTest.DescribeTreeMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetainedTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RetainedTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetainedTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetainedTest.Version]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RetainedTest.Version]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetainedTest.Version]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetainedTest.WithinIterations]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RetainedTest.WithinIterations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetainedTest.WithinIterations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetainedTest.Paragraph]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RetainedTest.Paragraph]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetainedTest.Paragraph]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScrollIndicator.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScrollIndicator.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScrollIndicator.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Default]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SeparatorTest.Default]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Default]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Light]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SeparatorTest.Light]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Light]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Double]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SeparatorTest.Double]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Double]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Heavy]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SeparatorTest.Heavy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Heavy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Empty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SeparatorTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.Styled]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SeparatorTest.Styled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.Styled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SeparatorTest.WithPixel]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SeparatorTest.WithPixel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SeparatorTest.WithPixel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SharedTest.SameAsCopies]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SharedTest.SameAsCopies]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SharedTest.SameAsCopies]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SharedTest.Layers]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SharedTest.Layers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SharedTest.Layers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SharedTest.LayoutPool]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=SharedTest.LayoutPool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SharedTest.LayoutPool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StaticLayoutTest.HBox]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StaticLayoutTest.HBox]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StaticLayoutTest.HBox]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StaticLayoutTest.VBox]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StaticLayoutTest.VBox]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StaticLayoutTest.VBox]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StaticLayoutTest.Requirement]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StaticLayoutTest.Requirement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StaticLayoutTest.Requirement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StyleTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.Fold]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StyleTest.Fold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.Fold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.InnerColorWins]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StyleTest.InnerColorWins]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.InnerColorWins]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.InvertedToggles]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StyleTest.InvertedToggles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.InvertedToggles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StyleTest.SharedChildIsNotModified]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StyleTest.SharedChildIsNotModified]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StyleTest.SharedChildIsNotModified]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.Empty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorVerticalEmpty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SeparatorVerticalEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorVerticalEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorHorizontalEmpty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SeparatorHorizontalEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorHorizontalEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorHorizontalLight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SeparatorHorizontalLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorHorizontalLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorVerticalLight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SeparatorVerticalLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorVerticalLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorLight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SeparatorLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorVerticalHorizontalLight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SeparatorVerticalHorizontalLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorVerticalHorizontalLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SeparatorHorizontalVerticalLight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SeparatorHorizontalVerticalLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SeparatorHorizontalVerticalLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.BorderLight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.BorderLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.BorderLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.BorderSeparatorLight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.BorderSeparatorLight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.BorderSeparatorLight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectRow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SelectRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectRowNegative]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SelectRowNegative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectRowNegative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectColumn]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SelectColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectColumnNegative]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SelectColumnNegative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectColumnNegative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.CrossingBorders]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.CrossingBorders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.CrossingBorders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.CrossingBordersLightAndDouble]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.CrossingBordersLightAndDouble]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.CrossingBordersLightAndDouble]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectColumns]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SelectColumns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectColumns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectRows]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SelectRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectRectangle]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SelectRectangle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectRectangle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectColumnsNegative]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SelectColumnsNegative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectColumnsNegative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.SelectInverted]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.SelectInverted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.SelectInverted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.ColumnFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.ColumnFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.ColumnFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.ColumnFlexCenter]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.ColumnFlexCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.ColumnFlexCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.ColumnCenter]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.ColumnCenter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.ColumnCenter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.ColumnFlexTwo]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.ColumnFlexTwo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.ColumnFlexTwo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.RowFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.RowFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.RowFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.RowFlexTwo]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.RowFlexTwo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.RowFlexTwo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.Merge]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.Merge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.Merge]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TableTest.Style]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TableTest.Style]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TableTest.Style]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextDocumentTest.Lines]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextDocumentTest.Lines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextDocumentTest.Lines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextDocumentTest.ManyBlocks]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextDocumentTest.ManyBlocks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextDocumentTest.ManyBlocks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextDocumentTest.Render]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextDocumentTest.Render]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextDocumentTest.Render]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextDocumentTest.Wrap]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextDocumentTest.Wrap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextDocumentTest.Wrap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextDocumentTest.Frame]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextDocumentTest.Frame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextDocumentTest.Frame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextDocumentTest.WrapFrame]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextDocumentTest.WrapFrame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextDocumentTest.WrapFrame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenHeightSmaller]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.ScreenHeightSmaller]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenHeightSmaller]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenSmaller]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.ScreenSmaller]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenSmaller]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenFit]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.ScreenFit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenFit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenBigger]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.ScreenBigger]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenBigger]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.ScreenBigger2]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.ScreenBigger2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.ScreenBigger2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.CJK]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.CJK]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.CJK]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.CJK_2]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.CJK_2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.CJK_2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.CJK_3]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.CJK_3]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.CJK_3]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.CombiningCharacters]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.CombiningCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.CombiningCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.CombiningCharactersWithSpace]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.CombiningCharactersWithSpace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.CombiningCharactersWithSpace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.Numbers]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.Numbers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.Numbers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextTest.Textf]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TextTest.Textf]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextTest.Textf]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.RingBuffer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TimeSeriesTest.RingBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.RingBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.DecimateKeepsSpikes]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TimeSeriesTest.DecimateKeepsSpikes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.DecimateKeepsSpikes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.DecimateIncrementally]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TimeSeriesTest.DecimateIncrementally]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.DecimateIncrementally]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.Render]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TimeSeriesTest.Render]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.Render]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.RunningRange]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TimeSeriesTest.RunningRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.RunningRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.Sparkline]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TimeSeriesTest.Sparkline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.Sparkline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeSeriesTest.SparklineBraille]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=TimeSeriesTest.SparklineBraille]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeSeriesTest.SparklineBraille]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnderlinedTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=UnderlinedTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnderlinedTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UtilTest.ComposeOrder]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=UtilTest.ComposeOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UtilTest.ComposeOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UtilTest.ComposeAsDecorator]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=UtilTest.ComposeAsDecorator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UtilTest.ComposeAsDecorator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UtilTest.PipeElements]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=UtilTest.PipeElements]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UtilTest.PipeElements]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UtilTest.PipeAssign]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=UtilTest.PipeAssign]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UtilTest.PipeAssign]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UtilTest.FitLayout]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=UtilTest.FitLayout]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UtilTest.FitLayout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.NoFlex_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexGrow_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.FlexGrow_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexGrow_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_FlexGrow_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.NoFlex_FlexGrow_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_FlexGrow_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_NoFlex_FlexGrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.NoFlex_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexGrow_NoFlex_FlexGrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.FlexGrow_NoFlex_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexGrow_NoFlex_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexGrow_FlexGrow_FlexGrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.FlexGrow_FlexGrow_FlexGrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexGrow_FlexGrow_FlexGrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexShrink_NoFlex_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.FlexShrink_NoFlex_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexShrink_NoFlex_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_FlexShrink_NoFlex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.NoFlex_FlexShrink_NoFlex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_FlexShrink_NoFlex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.NoFlex_NoFlex_FlexShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.NoFlex_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.NoFlex_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexShrink_NoFlex_FlexShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.FlexShrink_NoFlex_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexShrink_NoFlex_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexShrink_FlexShrink_FlexShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.FlexShrink_FlexShrink_FlexShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexShrink_FlexShrink_FlexShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxText.FlexGrow_NoFlex_FlewShrink]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxText.FlexGrow_NoFlex_FlewShrink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxText.FlexGrow_NoFlex_FlewShrink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxTest.OffscreenChildrenAreNotDrawn]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxTest.OffscreenChildrenAreNotDrawn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxTest.OffscreenChildrenAreNotDrawn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VBoxTest.OffscreenReflect]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VBoxTest.OffscreenReflect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VBoxTest.OffscreenReflect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualListTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualListTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualListTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualListTest.OnlyVisibleRowsAreCreated]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualListTest.OnlyVisibleRowsAreCreated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualListTest.OnlyVisibleRowsAreCreated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualListTest.RowHeight]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualListTest.RowHeight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualListTest.RowHeight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualListTest.Empty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualListTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualListTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualTableTest.SameAsTable]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualTableTest.SameAsTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualTableTest.SameAsTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualTableTest.Style]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualTableTest.Style]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualTableTest.Style]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualTableTest.Separator]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualTableTest.Separator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualTableTest.Separator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualTableTest.OnlyVisibleRowsAreCreated]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualTableTest.OnlyVisibleRowsAreCreated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualTableTest.OnlyVisibleRowsAreCreated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualTableTest.AlternateRowWhileScrolled]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualTableTest.AlternateRowWhileScrolled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualTableTest.AlternateRowWhileScrolled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[VirtualTableTest.ColumnWidth]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=VirtualTableTest.ColumnWidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[VirtualTableTest.ColumnWidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CursorMotionTest.Relative]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CursorMotionTest.Relative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CursorMotionTest.Relative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CursorMotionTest.CarriageReturnAndLineFeed]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CursorMotionTest.CarriageReturnAndLineFeed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CursorMotionTest.CarriageReturnAndLineFeed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CursorMotionTest.AbsoluteColumn]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CursorMotionTest.AbsoluteColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CursorMotionTest.AbsoluteColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CursorMotionTest.AbsolutePosition]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=CursorMotionTest.AbsolutePosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CursorMotionTest.AbsolutePosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameProtocolTest.RoundTrip]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameProtocolTest.RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameProtocolTest.RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameProtocolTest.Styles]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameProtocolTest.Styles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameProtocolTest.Styles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameProtocolTest.Delta]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameProtocolTest.Delta]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameProtocolTest.Delta]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameProtocolTest.Stream]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameProtocolTest.Stream]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameProtocolTest.Stream]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameProtocolTest.Malformed]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameProtocolTest.Malformed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameProtocolTest.Malformed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameProtocolTest.Snapshot]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameProtocolTest.Snapshot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameProtocolTest.Snapshot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FrameProtocolTest.Recording]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=FrameProtocolTest.Recording]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FrameProtocolTest.Recording]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlyphTest.Default]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GlyphTest.Default]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlyphTest.Default]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlyphTest.Inline]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GlyphTest.Inline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlyphTest.Inline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlyphTest.Interned]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GlyphTest.Interned]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlyphTest.Interned]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlyphTest.Width]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GlyphTest.Width]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlyphTest.Width]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlyphTest.Fullwidth]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GlyphTest.Fullwidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlyphTest.Fullwidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GlyphTest.Narrow]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=GlyphTest.Narrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GlyphTest.Narrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputBreakdownTest.Kinds]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=OutputBreakdownTest.Kinds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputBreakdownTest.Kinds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputBreakdownTest.Screen]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=OutputBreakdownTest.Screen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputBreakdownTest.Screen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowCompareTest.MatchesScalar]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RowCompareTest.MatchesScalar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowCompareTest.MatchesScalar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowCompareTest.DifferingColumns]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RowCompareTest.DifferingColumns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowCompareTest.DifferingColumns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowCompareTest.DifferingStyle]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=RowCompareTest.DifferingStyle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowCompareTest.DifferingStyle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.Row]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.Row]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.Row]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.MemoryUsage]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.MemoryUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.MemoryUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.InternedMemoryUsage]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.InternedMemoryUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.InternedMemoryUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.Clear]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.Clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.Clear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.SwapPixels]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.SwapPixels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.SwapPixels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.Subscreen]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.Subscreen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.Subscreen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ParallelOutput]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ParallelOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ParallelOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringReuseBuffer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringReuseBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringReuseBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ApplyShader]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ApplyShader]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ApplyShader]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ApplyShaderAutoMergeRegion]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ApplyShaderAutoMergeRegion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ApplyShaderAutoMergeRegion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ResetPosition]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ResetPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ResetPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.StyleMergedSequence]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.StyleMergedSequence]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.StyleMergedSequence]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.StyleIncrementalTransition]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.StyleIncrementalTransition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.StyleIncrementalTransition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.StyleResetTransition]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.StyleResetTransition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.StyleResetTransition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.StyleRepeatedTransition]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.StyleRepeatedTransition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.StyleRepeatedTransition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToPlainText]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToPlainText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToPlainText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.NoColorSupport]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.NoColorSupport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.NoColorSupport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.NoColor]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.NoColor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.NoColor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.EraseLine]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.EraseLine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.EraseLine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.Repeat]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.Repeat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.Repeat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.RowHash]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.RowHash]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.RowHash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringRowDiff]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringRowDiff]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringRowDiff]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringScrollDiffUp]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringScrollDiffUp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringScrollDiffUp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringScrollDiffDown]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringScrollDiffDown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringScrollDiffDown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringScrollDiffNoShift]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringScrollDiffNoShift]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringScrollDiffNoShift]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffIdentical]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringDiffIdentical]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffIdentical]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffSingleCell]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringDiffSingleCell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffSingleCell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffMergeSmallGaps]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringDiffMergeSmallGaps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffMergeSmallGaps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffFullWidth]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringDiffFullWidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffFullWidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.ToStringDiffResized]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.ToStringDiffResized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.ToStringDiffResized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.StyleSpans]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.StyleSpans]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.StyleSpans]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.Rects]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.Rects]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.Rects]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.PrintStreamed]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.PrintStreamed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.PrintStreamed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenTest.PrintToFile]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenTest.PrintToFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenTest.PrintToFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenViewTest.Basic]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenViewTest.Basic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenViewTest.Basic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenViewTest.Clip]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenViewTest.Clip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenViewTest.Clip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenViewTest.Nested]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenViewTest.Nested]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenViewTest.Nested]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScreenViewTest.Empty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=ScreenViewTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScreenViewTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.StringWidth]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.StringWidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.StringWidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.StringWidthTableBoundaries]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.StringWidthTableBoundaries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.StringWidthTableBoundaries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.StringWidthLongAscii]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.StringWidthLongAscii]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.StringWidthLongAscii]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.Utf8ToGlyphs]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.Utf8ToGlyphs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.Utf8ToGlyphs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.GraphemeClusters]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.GraphemeClusters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.GraphemeClusters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.Glyphs]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.Glyphs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.Glyphs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.GlyphCount]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.GlyphCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.GlyphCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.GlyphPosition]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.GlyphPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.GlyphPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.CellToGlyphIndex]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.CellToGlyphIndex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.CellToGlyphIndex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.Utf8ToWordBreakProperty]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.Utf8ToWordBreakProperty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.Utf8ToWordBreakProperty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.to_string]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.to_string]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.to_string]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.to_wstring]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.to_wstring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.to_wstring]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.ConversionLong]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.ConversionLong]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.ConversionLong]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringTest.ConversionBuffer]=]  /root/repo/_gate_intrusive/ftxui-tests-3.0.0 [==[--gtest_filter=StringTest.ConversionBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringTest.ConversionBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_intrusive SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  ftxui-tests_TESTS AnimationTest.StartAndEnd AnimationTest.Scheduler AsyncTest.WithoutScreen AsyncTest.ResumedByTheLoop AsyncTest.Exception AsyncTest.Cancel ButtonTest.Basic ButtonTest.StringViewLabel ButtonTest.Animation ButtonTest.TransformCached CatchEventTest.Filter CollapsibleTest.Basic CollapsibleTest.Factory ContainerTest.DeleteParentFirst ContainerTest.DeleteChildFirst ContainerTest.Detach ContainerTest.DetachAllChildren ContainerTest.Add ContainerTest.ChildAt ContainerTest.HorizontalEvent ContainerTest.VerticalEvent ContainerTest.SetActiveChild ContainerTest.TakeFocus ContainerTest.TabFocusable ContainerTest.LazyTab ContainerTest.TabAnimatesTheTabShown ContainerTest.MaybeAnimatesWhenShown ContainerTest.VirtualVertical ComponentTest.NonFocusableAreNotFocused ComponentTest.FocusCache ComponentTest.HandleEventWithoutCopy DeferredTest.Placeholder DeferredTest.WithoutScreen DropdownTest.ListBuiltWhenOpened FilterIndexTest.Refine FilterIndexTest.Refresh FilterMenuTest.TypeAhead FrameBroadcastTest.SameBytesForEveryViewer FrameBroadcastTest.SlowViewerGetsKeyframes FrameBroadcastTest.DisconnectedViewer FrameBroadcastTest.ScreenInteractive FuzzyIndexTest.Score FuzzyIndexTest.BestMatches FuzzyFinderTest.TypeAhead HoverableTest.BasicBool HoverableTest.BasicCallback HoverableTest.BasicBoolCallback HoverableTest.Coverage InputTest.Init InputTest.Type InputTest.Paste InputTest.TypePassword InputTest.Arrow InputTest.Insert InputTest.Home InputTest.End InputTest.Delete InputTest.Backspace InputTest.EditUnicode InputTest.ContentModifiedOutside InputTest.MouseClick InputTest.MouseClickComplex InputTest.CtrlArrowLeft InputTest.CtrlArrowLeft2 InputTest.CtrlArrowRight InputTest.CtrlArrowRight2 InputTest.CtrlArrowAfterEdit InputTest.GapBuffer InputTest.GapBufferOnChange LogViewTest.FollowAndScroll MemoTest.Basic MenuTest.RemoveEntries MenuTest.DirectionDown MenuTest.DirectionsUp MenuTest.DirectionsRight MenuTest.DirectionsLeft MenuTest.AnimationsHorizontal MenuTest.AnimationsVertical MenuTest.Virtualized MenuTest.MemoryUsage MenuTest.Adapter ModalTest.Basic ModalTest.FreezeMain ObservableTest.MemoRendersOnChange ObservableTest.NestedMemo ObservableTest.Ref ObservableTest.ConstStringRefVersion ObservableTest.Input OutputSinkTest.WriteOnFlush OutputSinkTest.NonBlockingPartialWrites OutputSinkTest.WriterThread OutputSinkTest.WriteDeferred RadioboxTest.NavigationArrow RadioboxTest.NavigationArrowVim RadioboxTest.NavigationTab RadioboxTest.NavigationHome RadioboxTest.NavigationPageDown RadioboxTest.NavigationPageUp RadioboxTest.NavigationEnd RadioboxTest.EventSpace RadioboxTest.RemoveEntries RadioboxTest.Virtualized Receiver.Basic Receiver.BasicWithThread Receiver.ManyProducers Receiver.SendAll Receiver.MoveOnly ResizableSplit.BasicLeft ResizableSplit.BasicRight ResizableSplit.BasicTop ResizableSplit.BasicBottom ResizableSplit.DragReusesThePanes ScreenInteractive.Signal_SIGTERM ScreenInteractive.Signal_SIGSEGV ScreenInteractive.Signal_SIGINT ScreenInteractive.Signal_SIGILL ScreenInteractive.Signal_SIGABRT ScreenInteractive.Signal_SIGFPE ScreenInteractive.PostEventToNonActive ScreenInteractive.PostTaskToNonActive ScreenInteractive.AnimationFrame ScreenInteractive.CoalesceEvents ScreenInteractive.PriorityLanes ScreenInteractive.MaxFrameRate ScreenInteractive.ResizeDebounce ScreenInteractive.FrameBudget ScreenInteractive.MouseMotionOnDemand ScreenInteractive.RedrawOnlyHandledEvents ScreenInteractive.PostBatch ScreenInteractive.InputStatistics ScreenInteractive.InputRecordingSerialize ScreenInteractive.Replay ScreenInteractive.Headless ScreenInteractive.Stats ScreenInteractive.PasteAsTyped ScreenInteractive.PipelinedRender ScreenInteractive.PrintStatic ScreenInteractive.WatchSlowFrames ScreenInteractive.CursorPositionReport ScreenInteractive.ProbeTerminal ScreenInteractive.UpdateState ScreenInteractive.RunAsync ScreenInteractive.FrameProtocol ScreenInteractive.HostEventLoop ScreenInteractive.NonInteractiveOutput SessionServerTest.Sessions SessionServerTest.Resize SliderTest.Right SliderTest.Left SliderTest.Down SliderTest.Up SliderTest.Focus SpinnerTest.FollowsTheClock SpinnerTest.Spinner1 SpinnerTest.Spinner2 SpinnerTest.Spinner3 SpinnerTest.Spinner4 Event.Character Event.Buffer Event.Paste Event.EscapeKeyWithoutWaiting Event.EscapeKeyNotEnoughWait Event.EscapeKeyEnoughWait Event.HasPending Event.MouseLeftClickPressed Event.MouseLeftClickReleased Event.MouseReporting Event.MouseMiddleClick Event.MouseRightClick Event.ModeReporting Event.DeviceAttributes Event.TerminalVersion Event.UTF8 Event.NewLine Event.Control Event.Special TextAreaTest.Type TextAreaTest.Paste TextAreaTest.VerticalMoves TextAreaTest.Render TextAreaTest.LargeContent TextAreaTest.MouseClick ToggleTest.leftRightArrow ToggleTest.Tab ToggleTest.OnChange ToggleTest.OnEnter ToggleTest.RemoveEntries TracerTest.Json TracerTest.ScreenInteractive TreeViewTest.ExpandAndCollapse TreeViewTest.Async WorkerPoolTest.RunsEveryJob WorkerPoolTest.NestedJobsAreStolen BlinkTest.Basic BoldTest.Basic BorderTest.Default BorderTest.Light BorderTest.Double BorderTest.Rounded BorderTest.Heavy BorderTest.Empty BorderTest.Styled BorderTest.WithPixel BorderTest.Window CachedTest.Basic CachedTest.Moved CachedTest.MovedReflect CachedTest.Resized CachedTest.PartiallyVisible CachedTest.PartiallyHidden CachedTest.HiddenBySameLayer CachedTest.KeyCache CanvasTest.GoldPoint CanvasTest.GoldPointColor CanvasTest.GoldBlock CanvasTest.GoldBlockColor CanvasTest.GoldText CanvasTest.DrawPoints CanvasTest.DrawPointPolyline CanvasTest.Scroll CanvasTest.ScrollBlockAndText CanvasTest.Wide CanvasTest.DrawImage CanvasTest.ImageElement ColorTest.Foreground ColorTest.Background ColorTest.PrintTransparent ColorTest.PrintColor16 ColorTest.PrintColor256 ColorTest.PrintTrueCOlor ColorTest.PrintAppend ColorTest.FallbackTo256 ColorTest.FallbackTo256Nearest ColorTest.FallbackTo16 ColorTest.Litterals ColorTest.Interpolate ColorTest.Pack ColorTest.HSV ColumnarTableTest.Basic ColumnarTableTest.FormatOnlyVisibleRows ColumnarTableTest.ShorterColumn DBoxTest.Basic DBoxTest.OpaqueLayerHidesTheLowerOnes DBoxTest.OpaqueLayerClipsTheLowerOnes DBoxTest.OpaqueModal DBoxTest.OpaqueLayerHidesTheLowerChildren DimTest.Basic FlexboxHelperTest.BasicRow FlexboxHelperTest.BasicColumn FlexboxHelperTest.BasicRowInversed FlexboxHelperTest.BasicColumnInversed FlexboxHelperTest.ReuseWorkspace FlexboxTest.BasicRow FlexboxTest.BasicRowInversed FlexboxTest.BasicColumn FlexboxTest.BasicColumnInversed FlexboxTest.JustifyContentCenter FlexboxTest.JustifyContentSpaceBetween FlexboxTest.JustifyContentSpaceAround FlexboxTest.JustifyContentSpaceEvenly FlexboxTest.AlignItemsFlexEnd FlexboxTest.AlignItemsCenter FlexboxTest.AlignContentFlexEnd FlexboxTest.AlignContentCenter FlexboxTest.AlignContentSpaceBetween FlexboxTest.AlignContentSpaceAround FlexboxTest.AlignContentSpaceEvenly FlexboxTest.GapX FlexboxTest.GapX2 FlexboxTest.GapY FlexboxTest.Focus FlexboxTest.RenderAgain FrameArenaTest.Current FrameArenaTest.Render FrameArenaTest.ElementOutlivesReset FrameArenaTest.ElementOutlivesArena FrameArenaTest.MemoryResource FrameTest.Scrollable FrameTest.ScrollableFocus FrameTest.ScrollableVirtual GaugeTest.ZeroHorizontal GaugeTest.HalfHorizontal GaugeTest.OneHorizontal GaugeTest.ZeroVertical GaugeTest.HalfVertical GaugeTest.OneVertical GradientTest.Stops GradientTest.StopsKeepEnds GradientTest.Linear GradientTest.LinearVertical GradientTest.Radial GraphTest.Buffer GridboxTest.UnfilledRectangular GridboxTest.DifferentSize GridboxTest.CenterFlex GridboxTest.CenterFlexCross GridboxTest.CenterShrink GridboxTest.CenterShrinkColumn GridboxTest.Horizontal_NoFlex_NoFlex_NoFlex GridboxTest.Vertical_NoFlex_NoFlex_NoFlex GridboxTest.Horizontal_FlexGrow_NoFlex_NoFlex GridboxTest.Vertical_FlexGrow_NoFlex_NoFlex GridboxTest.Horizontal_NoFlex_FlexGrow_NoFlex GridboxTest.Horizontal_NoFlex_NoFlex_FlexGrow GridboxTest.Horizontal_FlexGrow_NoFlex_FlexGrow GridboxTest.Horizontal_FlexGrow_FlexGrow_FlexGrow GridboxTest.Horizontal_FlexShrink_NoFlex_NoFlex GridboxTest.Horizontal_NoFlex_FlexShrink_NoFlex GridboxTest.Horizontal_NoFlex_NoFlex_FlexShrink GridboxTest.Horizontal_FlexShrink_NoFlex_FlexShrink GridboxTest.Horizontal_FlexShrink_FlexShrink_FlexShrink GridboxTest.Horizontal_FlexGrow_NoFlex_FlewShrink GridboxTest.MissingCells GridboxTest.Focus GridboxTest.PinnedColumnWidths HBoxTest.NoFlex_NoFlex_NoFlex HBoxTest.FlexGrow_NoFlex_NoFlex HBoxTest.NoFlex_FlexGrow_NoFlex HBoxTest.NoFlex_NoFlex_FlexGrow HBoxTest.FlexGrow_NoFlex_FlexGrow HBoxTest.FlexGrow_FlexGrow_FlexGrow HBoxTest.FlexShrink_NoFlex_NoFlex HBoxTest.NoFlex_FlexShrink_NoFlex HBoxTest.NoFlex_NoFlex_FlexShrink HBoxTest.FlexShrink_NoFlex_FlexShrink HBoxTest.FlexShrink_FlexShrink_FlexShrink HBoxTest.FlexGrow_NoFlex_FlewShrink HBoxTest.VariadicArguments HeatmapTest.ColorMap HeatmapTest.Render HeatmapTest.HalfBlocks HitIndexTest.Empty HitIndexTest.Reflect KeyCacheTest.NoCache KeyCacheTest.Reuse KeyCacheTest.SameFrame KeyCacheTest.UnusedKeysAreReleased KeyCacheTest.Render LayoutPoolTest.ParallelFor LayoutPoolTest.Scope LayoutPoolTest.SameAsSerial LayoutPoolTest.Frame LayoutPoolTest.ParallelRender LayoutPoolTest.ParallelRenderFrame LogBufferTest.RingBuffer LogBufferTest.SplitLines LogBufferTest.Fullwidth LogBufferTest.RenderTail LogBufferTest.RenderFromTheBottom MappedFileTest.Missing MappedFileTest.Empty MappedFileTest.Lines MappedFileTest.ManyLines MappedFileTest.Render MappedFileTest.Hex NodePtrTest.Null NodePtrTest.Lifetime NodePtrTest.Arena NodePtrTest.Render NodeTest.OnePass NodeTest.Measured NodeTest.Iterations NodeTest.LayoutThenRender NodeTest.ParagraphConverges NodeTest.RenderTiled NodeTest.RenderConcurrently ParagraphTest.Left ParagraphTest.Right ParagraphTest.Center ParagraphTest.Justify ParagraphTest.LongWordIsTruncated ParagraphTest.Requirement ParagraphTest.RenderAgain ProfilerTest.Report ProfilerTest.NotActive ProfilerTest.DebugOverlay ProfilerTest.DescribeTree ProfilerTest.DescribeTreeMemory RetainedTest.Basic RetainedTest.Version RetainedTest.WithinIterations RetainedTest.Paragraph ScrollIndicator.Basic SeparatorTest.Default SeparatorTest.Light SeparatorTest.Double SeparatorTest.Heavy SeparatorTest.Empty SeparatorTest.Styled SeparatorTest.WithPixel SharedTest.SameAsCopies SharedTest.Layers SharedTest.LayoutPool StaticLayoutTest.HBox StaticLayoutTest.VBox StaticLayoutTest.Requirement StyleTest.Basic StyleTest.Fold StyleTest.InnerColorWins StyleTest.InvertedToggles StyleTest.SharedChildIsNotModified TableTest.Empty TableTest.Basic TableTest.SeparatorVerticalEmpty TableTest.SeparatorHorizontalEmpty TableTest.SeparatorHorizontalLight TableTest.SeparatorVerticalLight TableTest.SeparatorLight TableTest.SeparatorVerticalHorizontalLight TableTest.SeparatorHorizontalVerticalLight TableTest.BorderLight TableTest.BorderSeparatorLight TableTest.SelectRow TableTest.SelectRowNegative TableTest.SelectColumn TableTest.SelectColumnNegative TableTest.CrossingBorders TableTest.CrossingBordersLightAndDouble TableTest.SelectColumns TableTest.SelectRows TableTest.SelectRectangle TableTest.SelectColumnsNegative TableTest.SelectInverted TableTest.ColumnFlex TableTest.ColumnFlexCenter TableTest.ColumnCenter TableTest.ColumnFlexTwo TableTest.RowFlex TableTest.RowFlexTwo TableTest.Merge TableTest.Style TextDocumentTest.Lines TextDocumentTest.ManyBlocks TextDocumentTest.Render TextDocumentTest.Wrap TextDocumentTest.Frame TextDocumentTest.WrapFrame TextTest.ScreenHeightSmaller TextTest.ScreenSmaller TextTest.ScreenFit TextTest.ScreenBigger TextTest.ScreenBigger2 TextTest.CJK TextTest.CJK_2 TextTest.CJK_3 TextTest.CombiningCharacters TextTest.CombiningCharactersWithSpace TextTest.Numbers TextTest.Textf TimeSeriesTest.RingBuffer TimeSeriesTest.DecimateKeepsSpikes TimeSeriesTest.DecimateIncrementally TimeSeriesTest.Render TimeSeriesTest.RunningRange TimeSeriesTest.Sparkline TimeSeriesTest.SparklineBraille UnderlinedTest.Basic UtilTest.ComposeOrder UtilTest.ComposeAsDecorator UtilTest.PipeElements UtilTest.PipeAssign UtilTest.FitLayout VBoxText.NoFlex_NoFlex_NoFlex VBoxText.FlexGrow_NoFlex_NoFlex VBoxText.NoFlex_FlexGrow_NoFlex VBoxText.NoFlex_NoFlex_FlexGrow VBoxText.FlexGrow_NoFlex_FlexGrow VBoxText.FlexGrow_FlexGrow_FlexGrow VBoxText.FlexShrink_NoFlex_NoFlex VBoxText.NoFlex_FlexShrink_NoFlex VBoxText.NoFlex_NoFlex_FlexShrink VBoxText.FlexShrink_NoFlex_FlexShrink VBoxText.FlexShrink_FlexShrink_FlexShrink VBoxText.FlexGrow_NoFlex_FlewShrink VBoxTest.OffscreenChildrenAreNotDrawn VBoxTest.OffscreenReflect VirtualListTest.Basic VirtualListTest.OnlyVisibleRowsAreCreated VirtualListTest.RowHeight VirtualListTest.Empty VirtualTableTest.SameAsTable VirtualTableTest.Style VirtualTableTest.Separator VirtualTableTest.OnlyVisibleRowsAreCreated VirtualTableTest.AlternateRowWhileScrolled VirtualTableTest.ColumnWidth CursorMotionTest.Relative CursorMotionTest.CarriageReturnAndLineFeed CursorMotionTest.AbsoluteColumn CursorMotionTest.AbsolutePosition FrameProtocolTest.RoundTrip FrameProtocolTest.Styles FrameProtocolTest.Delta FrameProtocolTest.Stream FrameProtocolTest.Malformed FrameProtocolTest.Snapshot FrameProtocolTest.Recording GlyphTest.Default GlyphTest.Inline GlyphTest.Interned GlyphTest.Width GlyphTest.Fullwidth GlyphTest.Narrow OutputBreakdownTest.Kinds OutputBreakdownTest.Screen RowCompareTest.MatchesScalar RowCompareTest.DifferingColumns RowCompareTest.DifferingStyle ScreenTest.Row ScreenTest.MemoryUsage ScreenTest.InternedMemoryUsage ScreenTest.Clear ScreenTest.SwapPixels ScreenTest.Subscreen ScreenTest.ParallelOutput ScreenTest.ToStringReuseBuffer ScreenTest.ApplyShader ScreenTest.ApplyShaderAutoMergeRegion ScreenTest.ResetPosition ScreenTest.StyleMergedSequence ScreenTest.StyleIncrementalTransition ScreenTest.StyleResetTransition ScreenTest.StyleRepeatedTransition ScreenTest.ToPlainText ScreenTest.NoColorSupport ScreenTest.NoColor ScreenTest.EraseLine ScreenTest.Repeat ScreenTest.RowHash ScreenTest.ToStringRowDiff ScreenTest.ToStringScrollDiffUp ScreenTest.ToStringScrollDiffDown ScreenTest.ToStringScrollDiffNoShift ScreenTest.ToStringDiffIdentical ScreenTest.ToStringDiffSingleCell ScreenTest.ToStringDiffMergeSmallGaps ScreenTest.ToStringDiffFullWidth ScreenTest.ToStringDiffResized ScreenTest.StyleSpans ScreenTest.Rects ScreenTest.PrintStreamed ScreenTest.PrintToFile ScreenViewTest.Basic ScreenViewTest.Clip ScreenViewTest.Nested ScreenViewTest.Empty StringTest.StringWidth StringTest.StringWidthTableBoundaries StringTest.StringWidthLongAscii StringTest.Utf8ToGlyphs StringTest.GraphemeClusters StringTest.Glyphs StringTest.GlyphCount StringTest.GlyphPosition StringTest.CellToGlyphIndex StringTest.Utf8ToWordBreakProperty StringTest.to_string StringTest.to_wstring StringTest.ConversionLong StringTest.ConversionBuffer)
@@ -8,14 +8,31 @@ endif()
 include(cmake/ftxui_find_google_benchmark.cmake)
 
 add_executable(ftxui-benchmark
+  src/ftxui/component/benchmark_test.cpp
+  src/ftxui/dom/benchmark_allocations.cpp
   src/ftxui/dom/benchmark_test.cpp
+  src/ftxui/screen/benchmark_test.cpp
   )
 ftxui_set_options(ftxui-benchmark)
 target_link_libraries(ftxui-benchmark
   PRIVATE dom
+  PRIVATE component
   PRIVATE benchmark::benchmark
   PRIVATE benchmark::benchmark_main
   )
 target_include_directories(ftxui-benchmark
   PRIVATE src
   )
+
+# The end to end latency, from a keystroke to the frame it produces, of an
+# application running on a pseudo-terminal.
+add_executable(ftxui-benchmark-latency
+  src/ftxui/component/benchmark_latency.cpp
+  )
+ftxui_set_options(ftxui-benchmark-latency)
+if (FTXUI_BUILD_EXAMPLES)
+  target_compile_definitions(ftxui-benchmark-latency
+    PRIVATE FTXUI_LATENCY_APPLICATION="$<TARGET_FILE:ftxui_example_input>"
+    )
+  add_dependencies(ftxui-benchmark-latency ftxui_example_input)
+endif()
@@ -81,10 +81,22 @@ function(ftxui_set_options library)
     target_compile_definitions(${library}
       PRIVATE "FTXUI_MICROSOFT_TERMINAL_FALLBACK")
   endif()
+
+  # Changes the Element type. This must be seen by the library users as well.
+  if (FTXUI_INTRUSIVE_ELEMENT)
+    target_compile_definitions(${library}
+      PUBLIC "FTXUI_INTRUSIVE_ELEMENT")
+  endif()
+
+  # Changes the nodes allocated by MakeNode. This must be seen by the library
+  # users as well.
+  if (FTXUI_PROFILE)
+    target_compile_definitions(${library}
+      PUBLIC "FTXUI_PROFILE")
+  endif()
 endfunction()
 
 if (EMSCRIPTEN)
   string(APPEND CMAKE_CXX_FLAGS " -s USE_PTHREADS")
-  string(APPEND CMAKE_EXE_LINKER_FLAGS " -s ASYNCIFY")
   string(APPEND CMAKE_EXE_LINKER_FLAGS " -s PROXY_TO_PTHREAD")
 endif()
@@ -9,42 +9,91 @@ include(cmake/ftxui_find_google_test.cmake)
 
 add_executable(ftxui-tests
   src/ftxui/component/animation_test.cpp
+  src/ftxui/component/async_test.cpp
   src/ftxui/component/button_test.cpp
+  src/ftxui/component/catch_event_test.cpp
   src/ftxui/component/collapsible_test.cpp
   src/ftxui/component/component_test.cpp
   src/ftxui/component/component_test.cpp
   src/ftxui/component/container_test.cpp
+  src/ftxui/component/deferred_test.cpp
+  src/ftxui/component/dropdown_test.cpp
+  src/ftxui/component/filter_menu_test.cpp
+  src/ftxui/component/frame_broadcast_test.cpp
+  src/ftxui/component/fuzzy_finder_test.cpp
   src/ftxui/component/hoverable_test.cpp
   src/ftxui/component/input_test.cpp
+  src/ftxui/component/log_view_test.cpp
+  src/ftxui/component/memo_test.cpp
   src/ftxui/component/menu_test.cpp
   src/ftxui/component/modal_test.cpp
+  src/ftxui/component/observable_test.cpp
+  src/ftxui/component/output_sink_test.cpp
   src/ftxui/component/radiobox_test.cpp
   src/ftxui/component/receiver_test.cpp
   src/ftxui/component/resizable_split_test.cpp
   src/ftxui/component/screen_interactive_test.cpp
+  src/ftxui/component/session_server_test.cpp
   src/ftxui/component/slider_test.cpp
+  src/ftxui/component/spinner_test.cpp
   src/ftxui/component/terminal_input_parser_test.cpp
+  src/ftxui/component/text_area_test.cpp
   src/ftxui/component/toggle_test.cpp
+  src/ftxui/component/tracer_test.cpp
+  src/ftxui/component/tree_view_test.cpp
+  src/ftxui/component/worker_pool_test.cpp
   src/ftxui/dom/blink_test.cpp
   src/ftxui/dom/bold_test.cpp
   src/ftxui/dom/border_test.cpp
+  src/ftxui/dom/cached_test.cpp
   src/ftxui/dom/canvas_test.cpp
   src/ftxui/dom/color_test.cpp
+  src/ftxui/dom/columnar_table_test.cpp
   src/ftxui/dom/dbox_test.cpp
   src/ftxui/dom/dim_test.cpp
   src/ftxui/dom/flexbox_helper_test.cpp
   src/ftxui/dom/flexbox_test.cpp
+  src/ftxui/dom/frame_arena_test.cpp
+  src/ftxui/dom/frame_test.cpp
   src/ftxui/dom/gauge_test.cpp
+  src/ftxui/dom/gradient_test.cpp
+  src/ftxui/dom/graph_test.cpp
   src/ftxui/dom/gridbox_test.cpp
   src/ftxui/dom/hbox_test.cpp
+  src/ftxui/dom/heatmap_test.cpp
+  src/ftxui/dom/hit_index_test.cpp
+  src/ftxui/dom/key_cache_test.cpp
+  src/ftxui/dom/layout_pool_test.cpp
+  src/ftxui/dom/log_buffer_test.cpp
+  src/ftxui/dom/mapped_file_test.cpp
+  src/ftxui/dom/node_ptr_test.cpp
+  src/ftxui/dom/node_test.cpp
+  src/ftxui/dom/paragraph_test.cpp
+  src/ftxui/dom/profiler_test.cpp
+  src/ftxui/dom/retained_test.cpp
   src/ftxui/dom/scroll_indicator_test.cpp
   src/ftxui/dom/separator_test.cpp
+  src/ftxui/dom/shared_test.cpp
   src/ftxui/dom/spinner_test.cpp
+  src/ftxui/dom/static_layout_test.cpp
+  src/ftxui/dom/style_test.cpp
   src/ftxui/dom/table_test.cpp
+  src/ftxui/dom/text_document_test.cpp
   src/ftxui/dom/text_test.cpp
+  src/ftxui/dom/time_series_test.cpp
   src/ftxui/dom/underlined_test.cpp
+  src/ftxui/dom/util_test.cpp
   src/ftxui/dom/vbox_test.cpp
+  src/ftxui/dom/virtual_list_test.cpp
+  src/ftxui/dom/virtual_table_test.cpp
   src/ftxui/screen/color_test.cpp
+  src/ftxui/screen/cursor_motion_test.cpp
+  src/ftxui/screen/frame_protocol_test.cpp
+  src/ftxui/screen/glyph_test.cpp
+  src/ftxui/screen/output_breakdown_test.cpp
+  src/ftxui/screen/row_compare_test.cpp
+  src/ftxui/screen/screen_test.cpp
+  src/ftxui/screen/screen_view_test.cpp
   src/ftxui/screen/string_test.cpp
 )
 
@@ -0,0 +1,197 @@
+// frame_decoder.js
+//
+// The reference decoder of the frame protocol of FTXUI, for a web client. See
+// include/ftxui/screen/frame_protocol.hpp for the format, and
+// ScreenInteractive::FrameProtocol() for the server side.
+//
+// Usage:
+//   const decoder = new FrameDecoder(document.getElementById("screen"));
+//   socket.binaryType = "arraybuffer";
+//   socket.onmessage = e => decoder.push(new Uint8Array(e.data));
+//   // The input is sent like a terminal input:
+//   socket.send(new TextEncoder().encode("q"));
+
+const kPalette16 = [
+  "#000000", "#800000", "#008000", "#808000",
+  "#000080", "#800080", "#008080", "#c0c0c0",
+  "#808080", "#ff0000", "#00ff00", "#ffff00",
+  "#0000ff", "#ff00ff", "#00ffff", "#ffffff",
+];
+
+function palette256(index) {
+  if (index < 16) {
+    return kPalette16[index];
+  }
+  if (index >= 232) {
+    const v = 8 + 10 * (index - 232);
+    return `rgb(${v},${v},${v})`;
+  }
+  const i = index - 16;
+  const level = c => c == 0 ? 0 : 55 + 40 * c;
+  const r = level(Math.floor(i / 36));
+  const g = level(Math.floor(i / 6) % 6);
+  const b = level(i % 6);
+  return `rgb(${r},${g},${b})`;
+}
+
+class Reader {
+  constructor(bytes) {
+    this.bytes = bytes;
+    this.offset = 0;
+  }
+
+  byte() {
+    if (this.offset >= this.bytes.length) {
+      throw new RangeError("truncated message");
+    }
+    return this.bytes[this.offset++];
+  }
+
+  // Unsigned LEB128.
+  varint() {
+    let value = 0;
+    let scale = 1;
+    for (;;) {
+      const byte = this.byte();
+      value += (byte & 0x7f) * scale;
+      if ((byte & 0x80) == 0) {
+        return value;
+      }
+      scale *= 128;
+    }
+  }
+
+  bytesView(length) {
+    if (this.offset + length > this.bytes.length) {
+      throw new RangeError("truncated message");
+    }
+    const view = this.bytes.subarray(this.offset, this.offset + length);
+    this.offset += length;
+    return view;
+  }
+
+  color() {
+    switch (this.byte()) {
+      case 0: return null;  // The default color.
+      case 1: return kPalette16[this.byte()];
+      case 2: return palette256(this.byte());
+      case 3: return `rgb(${this.byte()},${this.byte()},${this.byte()})`;
+      default: throw new RangeError("invalid color");
+    }
+  }
+}
+
+class FrameDecoder {
+  // |container|: the element receiving one <span> per cell.
+  constructor(container) {
+    this.container = container;
+    this.pending = new Uint8Array(0);
+    this.textDecoder = new TextDecoder();
+    this.dimx = 0;
+    this.dimy = 0;
+    this.cells = [];
+    this.glyphs = [];
+    this.styles = [];
+    this.cursor = { x: 0, y: 0, shape: 0 };
+  }
+
+  // Append the bytes received from the server, and apply the messages they
+  // complete.
+  push(bytes) {
+    const data = new Uint8Array(this.pending.length + bytes.length);
+    data.set(this.pending);
+    data.set(bytes, this.pending.length);
+
+    let offset = 0;
+    for (;;) {
+      const reader = new Reader(data.subarray(offset));
+      let size;
+      try {
+        size = reader.varint();
+      } catch (e) {
+        break;
+      }
+      if (reader.offset + size > reader.bytes.length) {
+        break;
+      }
+      this.decode(new Reader(reader.bytesView(size)));
+      offset += reader.offset;
+    }
+    this.pending = data.slice(offset);
+  }
+
+  decode(reader) {
+    if (reader.byte() == 0) {
+      this.resize(reader.varint(), reader.varint());
+    }
+
+    const glyph_count = reader.varint();
+    for (let i = 0; i < glyph_count; ++i) {
+      this.glyphs.push(this.textDecoder.decode(reader.bytesView(reader.varint())));
+    }
+
+    const style_count = reader.varint();
+    for (let i = 0; i < style_count; ++i) {
+      const attributes = reader.byte();
+      this.styles.push(this.css(attributes, reader.color(), reader.color()));
+    }
+
+    const run_count = reader.varint();
+    for (let i = 0; i < run_count; ++i) {
+      const y = reader.varint();
+      const x = reader.varint();
+      const length = reader.varint();
+      for (let j = 0; j < length; ++j) {
+        const cell = this.cells[y * this.dimx + x + j];
+        cell.textContent = this.glyphs[reader.varint()];
+        cell.style.cssText = this.styles[reader.varint()];
+      }
+    }
+
+    this.cursor = { x: reader.varint(), y: reader.varint(), shape: reader.byte() };
+  }
+
+  // A key frame: a blank screen, and empty tables.
+  resize(dimx, dimy) {
+    this.dimx = dimx;
+    this.dimy = dimy;
+    this.glyphs = [];
+    this.styles = [];
+    this.cells = [];
+    this.container.replaceChildren();
+    this.container.style.whiteSpace = "pre";
+    this.container.style.fontFamily = "monospace";
+    for (let y = 0; y < dimy; ++y) {
+      const line = document.createElement("div");
+      for (let x = 0; x < dimx; ++x) {
+        const cell = document.createElement("span");
+        cell.textContent = " ";
+        line.appendChild(cell);
+        this.cells.push(cell);
+      }
+      this.container.appendChild(line);
+    }
+  }
+
+  css(attributes, foreground, background) {
+    if (attributes & (1 << 3)) {  // Inverted.
+      [foreground, background] = [background || "#ffffff", foreground || "#000000"];
+    }
+    const decorations = [];
+    if (attributes & (1 << 4) || attributes & (1 << 5)) {
+      decorations.push("underline");
+    }
+    if (attributes & (1 << 6)) {
+      decorations.push("line-through");
+    }
+    let css = "";
+    if (foreground) css += `color:${foreground};`;
+    if (background) css += `background-color:${background};`;
+    if (attributes & (1 << 1)) css += "font-weight:bold;";
+    if (attributes & (1 << 2)) css += "opacity:0.6;";
+    if (attributes & (1 << 0)) css += "animation:ftxui-blink 1s step-end infinite;";
+    if (decorations.length) css += `text-decoration:${decorations.join(" ")};`;
+    if (attributes & (1 << 5)) css += "text-decoration-style:double;";
+    return css;
+  }
+}
@@ -2,7 +2,12 @@
 #define FTXUI_ANIMATION_HPP
 
 #include <chrono>      // for milliseconds, duration, steady_clock, time_point
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint8_t
 #include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <mutex>       // for mutex
+#include <vector>      // for vector
 
 #include "ftxui/component/event.hpp"
 
@@ -20,6 +25,14 @@ using Clock = std::chrono::steady_clock;
 using TimePoint = std::chrono::time_point<Clock>;
 using Duration = std::chrono::duration<double>;
 
+// Like RequestAnimationFrame(), for a single frame drawn at |time|. The loop
+// sleeps until then, instead of drawing every animation frame in between.
+void RequestAnimationFrameAt(TimePoint time);
+
+// The time of the active ScreenInteractive. It is virtual for a Headless()
+// screen. Without active screen, this is Clock::now().
+TimePoint Now();
+
 // Parameter of Component::OnAnimation(param).
 class Params {
  public:
@@ -86,8 +99,49 @@ float BackInOut(float p);
 float BounceIn(float p);
 float BounceOut(float p);
 float BounceInOut(float p);
+
+// The functions above, called through a switch instead of a std::function.
+enum class Kind : uint8_t {
+  Linear,
+  QuadraticIn,
+  QuadraticOut,
+  QuadraticInOut,
+  CubicIn,
+  CubicOut,
+  CubicInOut,
+  QuarticIn,
+  QuarticOut,
+  QuarticInOut,
+  QuinticIn,
+  QuinticOut,
+  QuinticInOut,
+  SineIn,
+  SineOut,
+  SineInOut,
+  CircularIn,
+  CircularOut,
+  CircularInOut,
+  ExponentialIn,
+  ExponentialOut,
+  ExponentialInOut,
+  ElasticIn,
+  ElasticOut,
+  ElasticInOut,
+  BackIn,
+  BackOut,
+  BackInOut,
+  BounceIn,
+  BounceOut,
+  BounceInOut,
+  Custom,  // Any other function.
+};
+float Ease(Kind kind, float p);
 }  // namespace easing
 
+class Scheduler;
+
+// Animate |*from| toward |to|. The state is kept by the Scheduler current when
+// it was created, while the Animator is alive.
 class Animator {
  public:
   Animator(float* from,
@@ -95,18 +149,90 @@ class Animator {
            Duration duration = std::chrono::milliseconds(250),
            easing::Function easing_function = easing::Linear,
            Duration delay = std::chrono::milliseconds(0));
-
+  Animator(const Animator& other);
+  Animator(Animator&& other) noexcept;
+  Animator& operator=(const Animator& other);
+  Animator& operator=(Animator&& other) noexcept;
+  ~Animator();
+
+  // Step the animation, unless its Scheduler is driven by the active
+  // ScreenInteractive.
   void OnAnimation(Params&);
 
-  float to() const { return to_; }
+  float to() const;
 
  private:
-  float* value_;
-  float from_;
-  float to_;
-  Duration duration_;
-  easing::Function easing_function_;
-  Duration current_;
+  std::shared_ptr<Scheduler> scheduler_;
+  int slot_ = -1;
+};
+
+// Steps the Animators once per animation frame. Their state is stored in
+// contiguous arrays, and only the running ones are visited.
+//
+// Every ScreenInteractive owns one, holding the animators created while it is
+// active on the current thread, and drives it instead of walking the
+// components. The animators created while no screen is active belong to the
+// Default() one, and are stepped by their components.
+class Scheduler {
+ public:
+  Scheduler() = default;
+  Scheduler(const Scheduler&) = delete;
+  Scheduler& operator=(const Scheduler&) = delete;
+
+  // The scheduler of the screen active on the current thread, or Default().
+  static Scheduler& Get();
+  // The scheduler of the animators created while no screen is active.
+  static Scheduler& Default();
+
+  // Step the running animators. Return whether some are still running.
+  bool OnAnimation(Params& params);
+  size_t running() const;
+
+ private:
+  friend class Animator;
+
+  // Like Get(). Defined by ScreenInteractive.
+  static std::shared_ptr<Scheduler> Current();
+  static const std::shared_ptr<Scheduler>& DefaultPointer();
+  // Whether this scheduler is driven by the active ScreenInteractive. Defined
+  // by ScreenInteractive.
+  bool Driven() const;
+
+  int Add(float* value,
+          float to,
+          Duration duration,
+          easing::Function easing_function,
+          Duration delay);
+  int Copy(int slot);
+  void Remove(int slot);
+  // Return whether the animator of |slot| is still running.
+  bool Step(int slot, Duration duration);
+  float To(int slot);
+
+  // Unlocked versions of the above.
+  int AddLocked(float* value,
+                float to,
+                Duration duration,
+                easing::Function easing_function,
+                Duration delay);
+  bool StepLocked(int slot, Duration duration);
+  void SetRunning(int slot, bool running);
+
+  // Defined by ScreenInteractive.
+  void RequestFrame();
+
+  // Guards the arrays. The Default() scheduler is shared by the threads.
+  mutable std::mutex mutex_;
+  std::vector<float*> value_;
+  std::vector<float> from_;
+  std::vector<float> to_;
+  std::vector<double> duration_;
+  std::vector<double> current_;
+  std::vector<easing::Kind> kind_;
+  std::vector<easing::Function> custom_;  // For easing::Kind::Custom only.
+  std::vector<int> running_index_;        // Into |running_|, or -1.
+  std::vector<int> running_;
+  std::vector<int> free_;
 };
 
 }  // namespace animation
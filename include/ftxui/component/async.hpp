@@ -0,0 +1,249 @@
+#ifndef FTXUI_COMPONENT_ASYNC_HPP
+#define FTXUI_COMPONENT_ASYNC_HPP
+
+#include <coroutine>    // for coroutine_handle, noop_coroutine, suspend_never
+#include <exception>    // for exception_ptr, current_exception, rethrow_exception
+#include <functional>   // for function
+#include <memory>       // for make_shared, shared_ptr
+#include <optional>     // for optional
+#include <type_traits>  // for invoke_result_t, is_void_v
+#include <utility>      // for move, exchange
+
+#include "ftxui/component/task.hpp"  // for Closure
+
+namespace ftxui {
+
+// Run |work| with ScreenInteractive::RunAsync(), then |done| by the loop of the
+// screen active at the time of the call. Without active screen, both run
+// immediately.
+void RunInBackground(std::function<void()> work, Closure done);
+
+template <class T>
+class Async;
+
+namespace async_internal {
+
+template <class T>
+struct PromiseBase {
+  std::coroutine_handle<> continuation;
+  std::exception_ptr exception;
+
+  std::suspend_never initial_suspend() noexcept { return {}; }
+
+  // The frame is kept until the Async is destroyed. The coroutine awaiting
+  // it, if any, continues.
+  auto final_suspend() noexcept {
+    struct Final {
+      bool await_ready() noexcept { return false; }
+      std::coroutine_handle<> await_suspend(
+          std::coroutine_handle<> /*handle*/) noexcept {
+        return continuation ? continuation : std::noop_coroutine();
+      }
+      void await_resume() noexcept {}
+      std::coroutine_handle<> continuation;
+    };
+    return Final{continuation};
+  }
+
+  void unhandled_exception() { exception = std::current_exception(); }
+};
+
+template <class T>
+struct Promise : PromiseBase<T> {
+  std::optional<T> value;
+  Async<T> get_return_object();
+  void return_value(T v) { value = std::move(v); }
+};
+
+template <>
+struct Promise<void> : PromiseBase<void> {
+  Async<void> get_return_object();
+  void return_void() {}
+};
+
+// The state shared by a Background() awaiter and its thread.
+template <class T>
+struct BackgroundState {
+  std::function<T()> work;
+  std::optional<T> value;
+  std::exception_ptr exception;
+  bool cancelled = false;  // Only accessed by the loop.
+};
+
+template <>
+struct BackgroundState<void> {
+  std::function<void()> work;
+  std::exception_ptr exception;
+  bool cancelled = false;
+};
+
+}  // namespace async_internal
+
+/// @brief A coroutine started by the loop of a ScreenInteractive, like an
+/// event handler, and resumed by the same loop. It can `co_await` some work
+/// run on another thread with Background(), or another Async. Meanwhile, the
+/// loop keeps handling the events.
+///
+/// The Async owns the coroutine: destroying it cancels the coroutine. It is
+/// never resumed again, and the result of the pending Background() work is
+/// dropped. Keep it in the component using it, so that the work stops with the
+/// component.
+///
+/// It must be created, and destroyed, by the thread running the loop.
+///
+/// ### Example
+///
+/// ```cpp
+/// class Weather : public ComponentBase {
+///   Async<> Refresh() {
+///     status_ = "loading...";
+///     status_ = co_await Background([] { return FetchWeather(); });
+///   }
+///   bool OnEvent(Event event) override {
+///     if (event == Event::Character('r')) {
+///       refresh_ = Refresh();  // Cancels the previous refresh, if any.
+///       return true;
+///     }
+///     return false;
+///   }
+///   std::string status_;
+///   Async<> refresh_;
+/// };
+/// ```
+///
+/// @ingroup component
+template <class T = void>
+class Async {
+ public:
+  using promise_type = async_internal::Promise<T>;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  Async() = default;
+  explicit Async(Handle handle) : handle_(handle) {}
+  Async(Async&& other) noexcept
+      : handle_(std::exchange(other.handle_, nullptr)) {}
+  Async& operator=(Async&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  Async(const Async&) = delete;
+  Async& operator=(const Async&) = delete;
+  ~Async() { Reset(); }
+
+  // Whether the coroutine returned, or threw.
+  bool Done() const { return handle_ && handle_.done(); }
+
+  // The value returned by the coroutine, once Done(). Rethrows what it threw.
+  decltype(auto) Get() {
+    if (handle_.promise().exception) {
+      std::rethrow_exception(handle_.promise().exception);
+    }
+    if constexpr (!std::is_void_v<T>) {
+      return *handle_.promise().value;
+    }
+  }
+
+  // Cancel the coroutine, if it didn't return yet.
+  void Reset() {
+    if (handle_) {
+      handle_.destroy();
+      handle_ = nullptr;
+    }
+  }
+
+  // Awaiting an Async from another coroutine.
+  bool await_ready() const { return !handle_ || handle_.done(); }
+  void await_suspend(std::coroutine_handle<> continuation) {
+    handle_.promise().continuation = continuation;
+  }
+  decltype(auto) await_resume() { return Get(); }
+
+ private:
+  Handle handle_ = nullptr;
+};
+
+/// @brief Run |work| on the worker threads of the screen, from an Async
+/// coroutine. The coroutine is resumed by the loop with the result of |work|,
+/// or the exception it threw. The screen must outlive the work.
+/// @ingroup component
+template <class F>
+auto Background(F work) {
+  using T = std::invoke_result_t<F&>;
+  using State = async_internal::BackgroundState<T>;
+
+  class Awaiter {
+   public:
+    explicit Awaiter(std::shared_ptr<State> state) : state_(std::move(state)) {}
+    Awaiter(Awaiter&&) = default;
+    Awaiter(const Awaiter&) = delete;
+    Awaiter& operator=(const Awaiter&) = delete;
+    Awaiter& operator=(Awaiter&&) = delete;
+    // Destroyed before being resumed when the coroutine is cancelled.
+    ~Awaiter() {
+      if (state_) {
+        state_->cancelled = true;
+      }
+    }
+
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<> handle) {
+      std::shared_ptr<State> state = state_;
+      RunInBackground(
+          [state] {
+            try {
+              if constexpr (std::is_void_v<T>) {
+                state->work();
+              } else {
+                state->value = state->work();
+              }
+            } catch (...) {
+              state->exception = std::current_exception();
+            }
+          },
+          [state, handle] {
+            if (!state->cancelled) {
+              handle.resume();
+            }
+          });
+    }
+    T await_resume() {
+      if (state_->exception) {
+        std::rethrow_exception(state_->exception);
+      }
+      if constexpr (!std::is_void_v<T>) {
+        return std::move(*state_->value);
+      }
+    }
+
+   private:
+    std::shared_ptr<State> state_;
+  };
+
+  auto state = std::make_shared<State>();
+  state->work = std::move(work);
+  return Awaiter(std::move(state));
+}
+
+namespace async_internal {
+
+template <class T>
+Async<T> Promise<T>::get_return_object() {
+  return Async<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Async<void> Promise<void>::get_return_object() {
+  return Async<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+}  // namespace async_internal
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_ASYNC_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
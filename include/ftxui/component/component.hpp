@@ -1,29 +1,45 @@
 #ifndef FTXUI_COMPONENT_HPP
 #define FTXUI_COMPONENT_HPP
 
+#include <chrono>      // for milliseconds
+#include <cstddef>     // for size_t
 #include <functional>  // for function
+#include <future>      // for future
 #include <memory>      // for make_shared, shared_ptr
 #include <string>      // for wstring
+#include <type_traits>  // for is_base_of_v
 #include <utility>     // for forward
 #include <vector>      // for vector
 
 #include "ftxui/component/component_base.hpp"  // for Component, Components
 #include "ftxui/component/component_options.hpp"  // for ButtonOption, CheckboxOption, MenuOption
-#include "ftxui/dom/elements.hpp"  // for Element
+#include "ftxui/component/event.hpp"  // for EventFilter, EventFilter::All
+#include "ftxui/dom/elements.hpp"     // for Element
 #include "ftxui/util/ref.hpp"  // for ConstRef, Ref, ConstStringRef, ConstStringListRef, StringRef
 
 namespace ftxui {
 struct ButtonOption;
 struct CheckboxOption;
 struct Event;
+class FuzzyIndex;
+class SearchIndex;
 struct InputOption;
+struct TextAreaOption;
 struct MenuOption;
+struct ModalOption;
 struct RadioboxOption;
+struct TreeEntry;
+struct TreeViewOption;
+class ScreenInteractive;
 struct MenuEntryOption;
 
 template <class T, class... Args>
 std::shared_ptr<T> Make(Args&&... args) {
-  return std::make_shared<T>(std::forward<Args>(args)...);
+  auto component = std::make_shared<T>(std::forward<Args>(args)...);
+  if constexpr (std::is_base_of_v<ComponentBase, T>) {
+    static_cast<ComponentBase*>(component.get())->allocated_size_ = sizeof(T);
+  }
+  return component;
 }
 
 // Pipe operator to decorate components.
@@ -37,9 +53,14 @@ Component& operator|=(Component& component, ElementDecorator decorator);
 namespace Container {
 Component Vertical(Components children);
 Component Vertical(Components children, int* selector);
+Component VirtualVertical(Components children,
+                          int* selector = nullptr,
+                          int row_height = 1);
 Component Horizontal(Components children);
 Component Horizontal(Components children, int* selector);
 Component Tab(Components children, int* selector);
+Component LazyTab(std::vector<std::function<Component()>> factories,
+                  int* selector);
 
 }  // namespace Container
 
@@ -55,12 +76,20 @@ Component Input(StringRef content,
                 ConstStringRef placeholder,
                 Ref<InputOption> option = {});
 
+Component TextArea(StringRef content, Ref<TextAreaOption> option = {});
+
 Component Menu(ConstStringListRef entries,
                int* selected_,
                Ref<MenuOption> = MenuOption::Vertical());
 Component MenuEntry(ConstStringRef label, Ref<MenuEntryOption> = {});
 
 Component Dropdown(ConstStringListRef entries, int* selected);
+Component FilterMenu(SearchIndex* index,
+                     int* selected,
+                     Ref<MenuOption> option = MenuOption::Vertical());
+Component FuzzyFinder(FuzzyIndex* index,
+                      int* selected,
+                      Ref<MenuOption> option = MenuOption::Vertical());
 
 Component Radiobox(ConstStringListRef entries,
                    int* selected_,
@@ -99,20 +128,43 @@ Component Renderer(std::function<Element()>);
 Component Renderer(std::function<Element(bool /* focused */)>);
 ComponentDecorator Renderer(ElementDecorator);
 
-Component CatchEvent(Component child, std::function<bool(Event)>);
-ComponentDecorator CatchEvent(std::function<bool(Event)> on_event);
+Component CatchEvent(Component child,
+                     std::function<bool(Event)>,
+                     EventFilter filter = EventFilter::All);
+ComponentDecorator CatchEvent(std::function<bool(Event)> on_event,
+                              EventFilter filter = EventFilter::All);
 
 Component Maybe(Component, const bool* show);
 Component Maybe(Component, std::function<bool()>);
+Component Maybe(std::function<Component()> factory, const bool* show);
+Component Maybe(std::function<Component()> factory, std::function<bool()>);
 ComponentDecorator Maybe(const bool* show);
 ComponentDecorator Maybe(std::function<bool()>);
 
-Component Modal(Component main, Component modal, const bool* show_modal);
-ComponentDecorator Modal(Component modal, const bool* show_modal);
+Component Lazy(std::function<Component()> factory);
+
+Component Deferred(std::function<Element()> content, Element placeholder);
+Component Deferred(std::future<Element> content, Element placeholder);
+
+Component Memo(Component, std::function<size_t()> deps);
+Component Memo(Component);
+ComponentDecorator Memo(std::function<size_t()> deps);
+ComponentDecorator Memo();
+
+Component Modal(Component main,
+                Component modal,
+                const bool* show_modal,
+                Ref<ModalOption> option = {});
+ComponentDecorator Modal(Component modal,
+                         const bool* show_modal,
+                         Ref<ModalOption> option = {});
 
 Component Collapsible(ConstStringRef label,
                       Component child,
                       Ref<bool> show = false);
+Component Collapsible(ConstStringRef label,
+                      std::function<Component()> factory,
+                      Ref<bool> show = false);
 
 Component Hoverable(Component component, bool* hover);
 Component Hoverable(Component component,
@@ -125,6 +177,15 @@ ComponentDecorator Hoverable(std::function<void()> on_enter,
                              std::function<void()> on_leave);
 ComponentDecorator Hoverable(std::function<void(bool)> on_change);
 
+Component LogView(LogBuffer* buffer);
+Component TreeView(std::vector<TreeEntry> roots,
+                   Ref<TreeViewOption> option = {});
+Component Spinner(int charset_index,
+                  std::chrono::milliseconds period =
+                      std::chrono::milliseconds(80));
+std::function<void(std::string)> LogAppender(LogBuffer* buffer,
+                                             ScreenInteractive* screen);
+
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_COMPONENT_HPP */
@@ -1,8 +1,9 @@
 #ifndef FTXUI_COMPONENT_BASE_HPP
 #define FTXUI_COMPONENT_BASE_HPP
 
-#include <memory>  // for unique_ptr
-#include <vector>  // for vector
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr, unique_ptr
+#include <vector>   // for vector
 
 #include "ftxui/component/captured_mouse.hpp"  // for CaptureMouse
 #include "ftxui/dom/elements.hpp"              // for Element
@@ -12,6 +13,7 @@ namespace ftxui {
 class Delegate;
 class Focus;
 struct Event;
+struct TreeReport;
 
 namespace animation {
 class Params;
@@ -46,6 +48,11 @@ class ComponentBase {
   // Returns whether the event was handled or not.
   virtual bool OnEvent(Event);
 
+  // Same as OnEvent, without copying the event. The parents dispatch the
+  // events through it. By default, it calls OnEvent, so that overriding either
+  // of them is enough.
+  virtual bool HandleEvent(const Event&);
+
   // Handle an animation step.
   virtual void OnAnimation(animation::Params& params);
 
@@ -75,15 +82,73 @@ class ComponentBase {
   // Configure all the ancestors to give focus to this component.
   void TakeFocus();
 
+  // Request a new frame, after a change not reported by OnEvent().
+  void Invalidate();
+
+  // Called while rendering, to receive the mouse movements without a button
+  // pressed, to show where the mouse hovers. See
+  // ScreenInteractive::MouseMotionOnDemand().
+  void RequestMouseMotion();
+
+  // The bytes of memory held by this component, without its children: the
+  // object allocated by Make(), and the memory it allocated, like its list of
+  // children. Override it to add the latter.
+  virtual size_t MemoryUsage() const;
+
+  // While alive, Focused() reuses the state computed for the component and
+  // its ancestors, on the current thread. Meanwhile, the focus must only be
+  // changed by SetActiveChild(Component), TakeFocus(), Add() or Detach(). It
+  // is used while the components are rendered.
+  class FocusCacheScope {
+   public:
+    FocusCacheScope();
+    ~FocusCacheScope();
+    FocusCacheScope(const FocusCacheScope&) = delete;
+    FocusCacheScope(FocusCacheScope&&) = delete;
+    FocusCacheScope& operator=(const FocusCacheScope&) = delete;
+    FocusCacheScope& operator=(FocusCacheScope&&) = delete;
+
+   private:
+    size_t previous_;
+  };
+
  protected:
   CapturedMouse CaptureMouse(const Event& event);
 
+  // Give the |event| to the children, until one handles it.
+  bool DispatchToChildren(const Event& event);
+
   Components children_;
 
  private:
+  bool ActivePath() const;
+  bool CachedFocusable() const;
+
   ComponentBase* parent_ = nullptr;
+  // The size of the object allocated by Make().
+  size_t allocated_size_ = sizeof(ComponentBase);
+  template <class T, class... Args>
+  friend std::shared_ptr<T> Make(Args&&... args);
+  friend TreeReport DescribeTree(const ComponentBase& root, size_t largest);
+
+  // Whether the default OnEvent() or HandleEvent() is calling the other one.
+  // Reaching the second default means neither is overridden.
+  bool in_on_event_ = false;
+  bool in_handle_event_ = false;
+
+  // See FocusCacheScope. The values are valid when their generation is the
+  // current one.
+  mutable size_t active_path_generation_ = 0;
+  mutable size_t focusable_generation_ = 0;
+  mutable bool active_path_ = false;
+  mutable bool focusable_ = false;
 };
 
+// Count the components of the tree of |root|, with the memory they hold, and
+// find its |largest| biggest subtrees. See DescribeTree(const Node&).
+TreeReport DescribeTree(const ComponentBase& root,
+                        size_t largest = 5);  // NOLINT
+
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_COMPONENT_BASE_HPP */
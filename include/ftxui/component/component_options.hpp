@@ -2,12 +2,14 @@
 #define FTXUI_COMPONENT_COMPONENT_OPTIONS_HPP
 
 #include <chrono>                         // for milliseconds
+#include <cstdint>                        // for uint64_t
 #include <ftxui/component/animation.hpp>  // for Duration, QuadraticInOut, Function
 #include <ftxui/dom/elements.hpp>  // for Element, GaugeDirection, GaugeDirection::Right
 #include <ftxui/util/ref.hpp>  // for Ref, ConstRef
 #include <functional>          // for function
 #include <optional>            // for optional
 #include <string>              // for string
+#include <vector>              // for vector
 
 #include "ftxui/screen/color.hpp"  // for Color, Color::GrayDark, Color::White
 
@@ -16,6 +18,10 @@ namespace ftxui {
 /// @brief arguments for |ButtonOption::transform|, |CheckboxOption::transform|,
 /// |Radiobox::transform|, |MenuEntryOption::transform|,
 /// |MenuOption::transform|.
+///
+/// The buttons, checkboxes, menus and toggles reuse the Element produced by
+/// their transform for as long as the EntryState stays the same. The transform
+/// must depend only on it.
 struct EntryState {
   std::string label;  /// < The label to display.
   bool state;         /// < The state of the button/checkbox/radiobox
@@ -92,6 +98,10 @@ struct MenuOption {
   std::function<Element()> elements_prefix;
   std::function<Element()> elements_infix;
   std::function<Element()> elements_postfix;
+  // Create the elements of the visible entries only, to display huge lists in
+  // a frame. The entries must be one line tall. Vertical menus only. The
+  // |elements_infix| isn't used.
+  bool virtualized = false;
 
   // Observers:
   std::function<void()> on_change;  ///> Called when the selected entry changes.
@@ -136,7 +146,7 @@ struct CheckboxOption {
 /// @brief Option for the Input component.
 /// @ingroup component
 struct InputOption {
-  /// Called when the content changes.
+  /// Called when the content changes, once the content is updated.
   std::function<void()> on_change = [] {};
   /// Called when the user presses enter.
   std::function<void()> on_enter = [] {};
@@ -144,11 +154,40 @@ struct InputOption {
   /// Obscure the input content using '*'.
   Ref<bool> password = false;
 
+  /// Edit the content in a gap buffer, for long texts. Only the part around
+  /// the cursor is drawn. The content is updated once per frame, and before
+  /// |on_change| and |on_enter|, instead of after every edit.
+  Ref<bool> gap_buffer = false;
+
   /// When set different from -1, this attributes is used to store the cursor
   /// position.
   Ref<int> cursor_position = -1;
 };
 
+/// @brief Option for the TextArea component.
+/// @ingroup component
+struct TextAreaOption {
+  /// Called after every edit, once the content is updated. Without it, the
+  /// content is updated once per frame, instead of after every edit.
+  std::function<void()> on_change = [] {};
+
+  /// When set different from -1, these attributes are used to store the
+  /// cursor position: its line, and its glyph within the line.
+  Ref<int> cursor_line = -1;
+  Ref<int> cursor_column = -1;
+};
+
+/// @brief Option for the Modal component.
+/// @ingroup component
+struct ModalOption {
+  /// While the modal is shown, draw the pixels of the main component rendered
+  /// when it opened, instead of rendering it again every frame. It is rendered
+  /// again when the terminal is resized.
+  bool freeze_main = false;
+  /// Dim the main component while the modal is shown.
+  bool dim_main = false;
+};
+
 /// @brief Option for the Radiobox component.
 /// @ingroup component
 struct RadioboxOption {
@@ -157,6 +196,9 @@ struct RadioboxOption {
 
   // Style:
   std::function<Element(const EntryState&)> transform;
+  // Create the elements of the visible entries only, to display huge lists in
+  // a frame. The entries must be one line tall.
+  bool virtualized = false;
 
   // Observers:
   /// Called when the selected entry changes.
@@ -164,6 +206,33 @@ struct RadioboxOption {
   Ref<int> focused_entry = 0;
 };
 
+/// @brief An entry of a TreeView.
+/// @ingroup component
+struct TreeEntry {
+  std::string label;
+  /// Identifies the entry among every entry of the tree.
+  uint64_t id = 0;
+  /// Whether the entry has children, loaded when it is expanded.
+  bool expandable = false;
+};
+
+/// @brief Option for the TreeView component.
+/// @ingroup component
+struct TreeViewOption {
+  /// The children of |parent|. Called once per entry, the first time it is
+  /// expanded.
+  std::function<std::vector<TreeEntry>(const TreeEntry& parent)> children;
+  /// Call |children| on the worker threads of the screen, instead of the loop.
+  /// Meanwhile, the entry is displayed loading.
+  bool async = false;
+
+  // Observers:
+  /// Called when the selected entry changes.
+  std::function<void(const TreeEntry&)> on_change;
+  /// Called when the user presses enter.
+  std::function<void(const TreeEntry&)> on_enter;
+};
+
 // @brief Option for the `Slider` component.
 // @ingroup component
 template <typename T>
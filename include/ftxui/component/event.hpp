@@ -2,6 +2,7 @@
 #define FTXUI_COMPONENT_EVENT_HPP
 
 #include <ftxui/component/mouse.hpp>  // for Mouse
+#include <cstdint>  // for uint64_t
 #include <functional>
 #include <string>  // for string, operator==
 #include <vector>
@@ -11,6 +12,32 @@ namespace ftxui {
 class ScreenInteractive;
 class ComponentBase;
 
+/// @brief The kinds of events. A mask of them lets an event handler, like
+/// CatchEvent(), receive only the events it can handle.
+/// @ingroup component
+enum class EventFilter : uint8_t {
+  None = 0,
+  Character = 1 << 0,    // Event::is_character().
+  Special = 1 << 1,      // The other keys, like Event::Return.
+  MouseMove = 1 << 2,    // The mouse moves, without a button pressed.
+  MouseButton = 1 << 3,  // The other mouse events, including the wheel.
+  Paste = 1 << 4,        // Event::is_paste().
+  Custom = 1 << 5,       // Event::Custom.
+  Reporting = 1 << 6,    // The replies of the terminal.
+
+  Keyboard = Character | Special | Paste,
+  Mouse = MouseMove | MouseButton,
+  All = 0x7F,
+};
+
+constexpr EventFilter operator|(EventFilter a, EventFilter b) {
+  return EventFilter(uint8_t(a) | uint8_t(b));
+}
+
+constexpr EventFilter operator&(EventFilter a, EventFilter b) {
+  return EventFilter(uint8_t(a) & uint8_t(b));
+}
+
 /// @brief Represent an event. It can be key press event, a terminal resize, or
 /// more ...
 ///
@@ -31,6 +58,10 @@ struct Event {
   static Event Special(std::string);
   static Event Mouse(std::string, Mouse mouse);
   static Event CursorReporting(std::string, int x, int y);
+  static Event ModeReporting(std::string, int mode, int value);
+  static Event DeviceAttributes(std::string, bool secondary, int type);
+  static Event TerminalVersion(std::string);
+  static Event Paste(std::string text);
 
   // --- Arrow ---
   static const Event ArrowLeft;
@@ -67,14 +98,45 @@ struct Event {
 
   bool is_mouse() const { return type_ == Type::Mouse; }
   struct Mouse& mouse() { return mouse_; }
+  const struct Mouse& mouse() const { return mouse_; }
 
   bool is_cursor_reporting() const { return type_ == Type::CursorReporting; }
   int cursor_x() const { return cursor_.x; }
   int cursor_y() const { return cursor_.y; }
 
+  // Reply to a DEC private mode request (DECRPM).
+  bool is_mode_reporting() const { return type_ == Type::ModeReporting; }
+  int mode() const { return mode_reporting_.mode; }
+  int mode_value() const { return mode_reporting_.value; }
+
+  // Reply to a primary (DA1) or secondary (DA2) device attributes request.
+  bool is_device_attributes() const { return type_ == Type::DeviceAttributes; }
+  bool is_secondary() const { return device_attributes_.secondary; }
+  // The first parameter: the conformance level for DA1, the terminal type for
+  // DA2.
+  int device_type() const { return device_attributes_.type; }
+
+  // Reply to XTVERSION: the name and the version of the terminal.
+  bool is_terminal_version() const { return type_ == Type::TerminalVersion; }
+  std::string terminal_version() const;
+
+  // Text pasted at once, when the terminal supports the bracketed paste mode.
+  // The new lines are "\n".
+  bool is_paste() const { return type_ == Type::Paste; }
+  std::string paste() const;
+
   const std::string& input() const { return input_; }
 
-  bool operator==(const Event& other) const { return input_ == other.input_; }
+  // The kind of the event, one of the EventFilter bits.
+  EventFilter filter() const;
+
+  // The inputs of up to 7 bytes, like every key, are compared through |key_|.
+  bool operator==(const Event& other) const {
+    if (key_ != other.key_) {
+      return false;
+    }
+    return key_ != 0 || input_ == other.input_;
+  }
   bool operator!=(const Event& other) const { return !operator==(other); }
 
   //--- State section ----------------------------------------------------------
@@ -88,6 +150,10 @@ struct Event {
     Character,
     Mouse,
     CursorReporting,
+    ModeReporting,
+    DeviceAttributes,
+    TerminalVersion,
+    Paste,
   };
   Type type_ = Type::Unknown;
 
@@ -96,11 +162,27 @@ struct Event {
     int y;
   };
 
+  struct ModeReporting {
+    int mode;
+    int value;
+  };
+
+  struct DeviceAttributes {
+    bool secondary;
+    int type;
+  };
+
   union {
     struct Mouse mouse_;
     struct Cursor cursor_;
+    struct ModeReporting mode_reporting_;
+    struct DeviceAttributes device_attributes_;
   };
+  void SetInput(std::string input);
   std::string input_;
+  // |input_| packed with its size, when it fits. 0 otherwise. Equal keys means
+  // equal inputs.
+  uint64_t key_ = 0;
 };
 
 }  // namespace ftxui
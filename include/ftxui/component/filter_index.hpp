@@ -0,0 +1,91 @@
+#ifndef FTXUI_COMPONENT_FILTER_INDEX_HPP
+#define FTXUI_COMPONENT_FILTER_INDEX_HPP
+
+#include <cstddef>      // for size_t
+#include <memory>       // for shared_ptr
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/util/ref.hpp"  // for ConstStringListRef
+
+namespace ftxui {
+
+/// @brief The entries of a list matching a query, found while the user types.
+/// The list of entries of FilterMenu(). See FilterIndex and FuzzyIndex.
+/// @ingroup component
+class SearchIndex : public ConstStringListRef::Adapter {
+ public:
+  // Search the entries matching |query|. The previous search is cancelled.
+  virtual void SetQuery(std::string_view query) = 0;
+  virtual const std::string& query() const = 0;
+  // Whether some entries are still being scanned.
+  virtual bool searching() const = 0;
+  // The index, in the entries, of the |i|-th match.
+  virtual size_t EntryIndex(size_t i) const = 0;
+};
+
+/// @brief The entries of a list containing a query, for a type-ahead search.
+/// It is the list of entries of a Menu, see FilterMenu().
+///
+/// The entries are scanned in chunks on the worker threads of the active
+/// screen, and the matches of every chunk are appended, in order, as soon as
+/// the chunks before it are done. Typing never blocks the loop, and the first
+/// matches are displayed before the scan completes. When the query refines the
+/// previous one, only the previous matches are scanned again.
+///
+/// The matching is a case-insensitive (ASCII) substring search. The entries
+/// must outlive the index, and not change while searching. Call Refresh() after
+/// changing them. The index must be used from the loop.
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<std::string> files = ListFiles();
+/// FilterIndex index(&files);
+/// index.SetQuery("main");
+/// ...
+/// const std::string& file = files[index.EntryIndex(selected)];
+/// ```
+///
+/// @ingroup component
+class FilterIndex : public SearchIndex {
+ public:
+  explicit FilterIndex(const std::vector<std::string>* entries);
+  ~FilterIndex() override;
+  FilterIndex(const FilterIndex&) = delete;
+  FilterIndex(FilterIndex&&) = delete;
+  FilterIndex& operator=(const FilterIndex&) = delete;
+  FilterIndex& operator=(FilterIndex&&) = delete;
+
+  void SetQuery(std::string_view query) override;
+  // Search again every entry, after they changed.
+  void Refresh();
+  const std::string& query() const override { return query_; }
+  bool searching() const override;
+  size_t EntryIndex(size_t i) const override { return matches_[i]; }
+
+  // The matches found so far.
+  size_t size() const override { return matches_.size(); }
+  std::string_view operator[](size_t i) const override;
+  size_t version() const override { return version_; }
+
+ private:
+  struct Search;
+  void Start(std::shared_ptr<const std::vector<size_t>> candidates);
+  void OnChunkDone(Search& search, size_t chunk);
+
+  const std::vector<std::string>* entries_;
+  std::string query_;
+  std::vector<size_t> matches_;
+  size_t version_ = 1;
+  std::shared_ptr<Search> search_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_FILTER_INDEX_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,107 @@
+#ifndef FTXUI_COMPONENT_FRAME_BROADCAST_HPP
+#define FTXUI_COMPONENT_FRAME_BROADCAST_HPP
+
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <functional>          // for function
+#include <memory>              // for shared_ptr, unique_ptr
+#include <mutex>               // for mutex
+#include <string>              // for string
+#include <string_view>         // for string_view
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+/// @brief Mirror the frames of a ScreenInteractive to read-only viewers.
+///
+/// Every frame is serialized once, as the escape sequences updating the
+/// previous one, and the same buffer is sent to every viewer. Each viewer is
+/// written to from its own thread, so that a slow viewer doesn't delay the
+/// others, nor the application. A viewer still busy with an older frame skips
+/// the next ones: it is sent a keyframe, redrawing the whole screen, once it
+/// caught up.
+///
+/// The viewers display the frame from the top-left corner of their terminal.
+///
+/// ### Example
+///
+/// ```cpp
+/// FrameBroadcast broadcast;
+/// broadcast.AddViewer(FrameBroadcast::FileDescriptorSink(socket));
+/// screen.Broadcast(&broadcast);
+/// screen.Loop(component);
+/// ```
+///
+/// @ingroup component
+class FrameBroadcast {
+ public:
+  // Write |data| to a viewer. Returns false when the viewer is gone. Called
+  // from the thread of the viewer.
+  using Sink = std::function<bool(std::string_view data)>;
+
+#if !defined(_WIN32)
+  // A Sink writing to |fd|, like a socket or a pseudo-terminal.
+  static Sink FileDescriptorSink(int fd);
+#endif
+
+  FrameBroadcast() = default;
+  ~FrameBroadcast();
+  FrameBroadcast(const FrameBroadcast&) = delete;
+  FrameBroadcast(FrameBroadcast&&) = delete;
+  FrameBroadcast& operator=(const FrameBroadcast&) = delete;
+  FrameBroadcast& operator=(FrameBroadcast&&) = delete;
+
+  // Add a viewer. It is sent a keyframe of the last frame, if any. Returns its
+  // identifier.
+  int AddViewer(Sink sink);
+  // Remove a viewer, after the buffer it is writing, if any, is written.
+  void RemoveViewer(int id);
+
+  struct ViewerStats {
+    size_t diffs = 0;      // The frames sent as a diff.
+    size_t keyframes = 0;  // The frames sent as a keyframe.
+    size_t skipped = 0;    // The frames skipped, while the viewer was busy.
+    bool connected = false;
+  };
+  ViewerStats Stats(int id);
+
+  // Send |frame| to the viewers. Called by ScreenInteractive after drawing
+  // every frame. See ScreenInteractive::Broadcast().
+  void Publish(const Screen& frame);
+
+ private:
+  using Buffer = std::shared_ptr<const std::string>;
+  struct Viewer {
+    int id = 0;
+    Sink sink;
+    std::thread thread;
+    std::condition_variable cv;
+    // Guarded by |mutex_|:
+    Buffer pending;  // Not taken by the thread yet.
+    bool stop = false;
+    ViewerStats stats;
+  };
+  void ViewerLoop(Viewer* viewer);
+  Buffer Keyframe();
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<Viewer>> viewers_;  // Guarded by |mutex_|.
+  int next_id_ = 0;
+
+  // The frame published last, and the one before it. Accessed by Publish()
+  // and AddViewer() only, with |mutex_| held.
+  Screen previous_{0, 0};
+  Screen current_{0, 0};
+  Buffer keyframe_;  // The keyframe of |previous_|, built on demand.
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_FRAME_BROADCAST_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,96 @@
+#ifndef FTXUI_COMPONENT_FUZZY_INDEX_HPP
+#define FTXUI_COMPONENT_FUZZY_INDEX_HPP
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t, uint64_t
+#include <memory>       // for shared_ptr
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/component/filter_index.hpp"  // for SearchIndex
+
+namespace ftxui {
+
+/// @brief The best entries of a list for a fuzzy query, like fzf. The
+/// characters of the query must appear in the entry, in order, not necessarily
+/// consecutively. The matches are ranked by score: consecutive characters, and
+/// the ones starting a word, like after a '/', score higher, and the gaps
+/// between them lower. Only the |max_matches| best ones are kept.
+///
+/// The entries are scanned in chunks on the worker threads of the active
+/// screen. The entries lacking some characters of the query are skipped using
+/// a bitmask of the characters of every entry, computed once. The best matches
+/// of the chunks are merged by the loop while they arrive, and a new query
+/// cancels the chunks not scanned yet.
+///
+/// The matching ignores the case (ASCII). The entries must outlive the index,
+/// and not change while searching. Call Refresh() after changing them. The
+/// index must be used from the loop.
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<std::string> paths = ListFiles();
+/// FuzzyIndex index(&paths);
+/// int selected = 0;
+/// auto finder = FuzzyFinder(&index, &selected);
+/// ```
+///
+/// @ingroup component
+class FuzzyIndex : public SearchIndex {
+ public:
+  explicit FuzzyIndex(const std::vector<std::string>* entries,
+                      size_t max_matches = 1000);  // NOLINT
+  ~FuzzyIndex() override;
+  FuzzyIndex(const FuzzyIndex&) = delete;
+  FuzzyIndex(FuzzyIndex&&) = delete;
+  FuzzyIndex& operator=(const FuzzyIndex&) = delete;
+  FuzzyIndex& operator=(FuzzyIndex&&) = delete;
+
+  void SetQuery(std::string_view query) override;
+  // Search again every entry, after they changed.
+  void Refresh();
+  const std::string& query() const override { return query_; }
+  bool searching() const override;
+  size_t EntryIndex(size_t i) const override;
+  // The score of the |i|-th match, for a non-empty query. Higher is better.
+  int score(size_t i) const { return matches_[i].score; }
+
+  // The best matches found so far. Every entry for the empty query.
+  size_t size() const override;
+  std::string_view operator[](size_t i) const override;
+  size_t version() const override { return version_; }
+
+  // The score of |text| for |query|, already lowercase. -1 if it doesn't
+  // match.
+  static int Score(std::string_view text, std::string_view query);
+
+  struct Match {
+    int score = 0;
+    uint32_t length = 0;  // Shorter entries win the ties.
+    size_t index = 0;
+  };
+
+ private:
+  struct Bags;
+  struct Search;
+  void Start();
+  void OnChunkDone(Search& search, std::vector<Match>& matches);
+
+  const std::vector<std::string>* entries_;
+  size_t max_matches_;
+  std::shared_ptr<Bags> bags_;
+  std::string query_;
+  std::vector<Match> matches_;
+  size_t version_ = 1;
+  std::shared_ptr<Search> search_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_FUZZY_INDEX_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
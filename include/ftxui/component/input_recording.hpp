@@ -0,0 +1,56 @@
+#ifndef FTXUI_COMPONENT_INPUT_RECORDING_HPP
+#define FTXUI_COMPONENT_INPUT_RECORDING_HPP
+
+#include <chrono>       // for microseconds
+#include <cstddef>      // for size_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace ftxui {
+
+// The input read from the terminal by a ScreenInteractive, and the resizes of
+// the terminal, in the order they happened. See ScreenInteractive::RecordInput
+// and ScreenInteractive::Replay.
+struct InputRecording {
+  struct Entry {
+    // Since the start of the recording.
+    std::chrono::microseconds time{0};
+    // The raw bytes read from the terminal. Empty for a resize.
+    std::string input;
+    // The size of the terminal after a resize.
+    int dimx = 0;
+    int dimy = 0;
+
+    bool is_resize() const { return input.empty(); }
+  };
+  std::vector<Entry> entries;
+
+  // A text format, one entry per line, suitable to be checked in:
+  //   <microseconds> input <bytes in hexadecimal>
+  //   <microseconds> resize <dimx> <dimy>
+  std::string Serialize() const;
+  // The malformed lines are skipped.
+  static InputRecording Parse(std::string_view data);
+};
+
+// What ScreenInteractive::Replay measured, for every entry of the recording.
+struct ReplayReport {
+  struct Frame {
+    // The index of the entry drawn by this frame.
+    size_t entry = 0;
+    // From the input being parsed to the frame being flushed.
+    std::chrono::microseconds latency{0};
+    // The bytes written toward the terminal.
+    size_t output_bytes = 0;
+  };
+  std::vector<Frame> frames;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_INPUT_RECORDING_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,133 @@
+#ifndef FTXUI_COMPONENT_OBSERVABLE_HPP
+#define FTXUI_COMPONENT_OBSERVABLE_HPP
+
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr, make_shared
+#include <utility>  // for move, pair
+#include <vector>   // for vector
+
+namespace ftxui {
+
+/// @brief The part of Observable<T> independent of T: a version incremented
+/// by every change, and the record of the reads made while rendering.
+/// @ingroup component
+class ObservableBase {
+ public:
+  // The version of an observable, kept alive by the readers.
+  using Version = std::shared_ptr<const size_t>;
+  // The versions read, and their value at the time.
+  using Reads = std::vector<std::pair<Version, size_t>>;
+
+  ObservableBase();
+  virtual ~ObservableBase();
+  ObservableBase(const ObservableBase&) = delete;
+  ObservableBase(ObservableBase&&) = delete;
+  ObservableBase& operator=(const ObservableBase&) = delete;
+  ObservableBase& operator=(ObservableBase&&) = delete;
+
+  size_t version() const { return *version_; }
+
+  // Record the observables read on the current thread, for the lifetime of the
+  // scope. The rendering of the components happens in a scope. The nested
+  // scopes report their reads to the enclosing one too.
+  class ReadScope {
+   public:
+    ReadScope();
+    ~ReadScope();
+    ReadScope(const ReadScope&) = delete;
+    ReadScope(ReadScope&&) = delete;
+    ReadScope& operator=(const ReadScope&) = delete;
+    ReadScope& operator=(ReadScope&&) = delete;
+
+    const Reads& reads() const { return reads_; }
+    // Report |reads|, recorded earlier, as if they were read again.
+    static void Report(const Reads& reads);
+
+   private:
+    friend ObservableBase;
+    ReadScope* previous_;
+    Reads reads_;
+  };
+
+  // Whether any of |reads| changed since it was recorded.
+  static bool Changed(const Reads& reads);
+
+ protected:
+  // Record a read in the current ReadScope.
+  void Read() const;
+  // Increment the version, and request a new frame.
+  void Changed();
+  // A read within a ReadScope, a change outside. See Observable::Access().
+  void Accessed();
+
+ private:
+  std::shared_ptr<size_t> version_;
+};
+
+/// @brief A value whose changes are observed: the components reading it are
+/// redrawn when it is set, and only those when they are decorated with Memo().
+///
+/// It can be passed where a `Ref<T>` is accepted, like a `T*`. The components
+/// access the value through the Ref while rendering, and while handling the
+/// events. The accesses made while rendering are reads. The other ones may
+/// write, so they count as changes.
+///
+/// It must be used by the thread running the loop.
+///
+/// ### Example
+///
+/// ```cpp
+/// Observable<std::string> name("Alice");
+/// auto input = Input(&name);
+/// auto greeting = Renderer([&] { return text("Hello " + name.Get()); })
+///               | Memo();
+/// ...
+/// name.Set("Bob");  // Redraws |input| and |greeting|.
+/// ```
+///
+/// @ingroup component
+template <class T>
+class Observable : public ObservableBase {
+ public:
+  using value_type = T;
+
+  Observable() = default;
+  explicit Observable(T value) : value_(std::move(value)) {}
+
+  // The value. Records the read.
+  const T& Get() const {
+    Read();
+    return value_;
+  }
+  const T& operator()() const { return Get(); }
+  const T& operator*() const { return Get(); }
+  const T* operator->() const { return &Get(); }
+
+  void Set(T value) {
+    value_ = std::move(value);
+    Changed();
+  }
+
+  // The value, to be modified in place. Counts as a change.
+  T& Mutable() {
+    Changed();
+    return value_;
+  }
+
+  // The value, for the Ref<T> adapters. See the class comment.
+  T& Access() {
+    Accessed();
+    return value_;
+  }
+
+ private:
+  T value_{};
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_OBSERVABLE_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,15 +1,12 @@
 #ifndef FTXUI_COMPONENT_RECEIVER_HPP_
 #define FTXUI_COMPONENT_RECEIVER_HPP_
 
-#include <algorithm>           // for copy
-#include <atomic>              // for atomic, __atomic_base
-#include <condition_variable>  // for condition_variable
-#include <functional>
-#include <iostream>
+#include <atomic>   // for atomic, memory_order
+#include <cstdint>  // for uint32_t
 #include <memory>   // for unique_ptr, make_unique
-#include <mutex>    // for mutex, unique_lock
-#include <queue>    // for queue
+#include <span>     // for span
 #include <utility>  // for move
+#include <vector>   // for vector
 
 namespace ftxui {
 
@@ -52,6 +49,12 @@ template <class T>
 class SenderImpl {
  public:
   void Send(T t) { receiver_->Receive(std::move(t)); }
+  // Send every element of |ts|, in order, waking up the receiver once.
+  void SendAll(std::vector<T>& ts) {
+    receiver_->ReceiveBatch(ts);
+    ts.clear();
+  }
+  void SendAll(std::span<T> ts) { receiver_->ReceiveBatch(ts); }
   ~SenderImpl() { receiver_->ReleaseSender(); }
 
   Sender<T> Clone() { return receiver_->MakeSender(); }
@@ -62,69 +65,123 @@ class SenderImpl {
   ReceiverImpl<T>* receiver_;
 };
 
+// A lock-free multi-producer single-consumer queue. The senders push nodes on
+// |head_| with a single exchange. The consumer pops them from |tail_|. The
+// consumer sleeps on |events_|, a futex on Linux, incremented after every push
+// and every release of a sender.
 template <class T>
 class ReceiverImpl {
  public:
   Sender<T> MakeSender() {
-    std::unique_lock<std::mutex> lock(mutex_);
     senders_++;
     return std::unique_ptr<SenderImpl<T>>(new SenderImpl<T>(this));
   }
-  ReceiverImpl() { senders_ = 0; }
-
-  bool Receive(T* t) {
-    while (senders_ || !queue_.empty()) {
-      std::unique_lock<std::mutex> lock(mutex_);
-      if (queue_.empty())
-        notifier_.wait(lock);
-      if (queue_.empty())
-        continue;
-      *t = std::move(queue_.front());
-      queue_.pop();
-      return true;
+  ReceiverImpl() : head_(&stub_), tail_(&stub_) {}
+  ~ReceiverImpl() {
+    T t;
+    while (Pop(&t)) {
+    }
+    if (tail_ != &stub_) {
+      delete tail_;
     }
-    return false;
   }
+  ReceiverImpl(const ReceiverImpl&) = delete;
+  ReceiverImpl(ReceiverImpl&&) = delete;
+  ReceiverImpl& operator=(const ReceiverImpl&) = delete;
+  ReceiverImpl& operator=(ReceiverImpl&&) = delete;
 
-  bool ReceiveNonBlocking(T* t) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (queue_.empty())
-      return false;
-    *t = queue_.front();
-    queue_.pop();
-    return true;
+  bool Receive(T* t) {
+    while (true) {
+      const uint32_t events = events_.load(std::memory_order_acquire);
+      if (Pop(t)) {
+        return true;
+      }
+      // Reading |senders_| before the queue: the last sender can't push
+      // anything after releasing itself.
+      if (senders_ == 0) {
+        return Pop(t);
+      }
+      events_.wait(events, std::memory_order_acquire);
+    }
   }
 
-  bool HasPending() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return !queue_.empty();
+  // Like Receive(), these are only called by the consumer.
+  bool ReceiveNonBlocking(T* t) { return Pop(t); }
+  // Append every pending value to |out|. Return whether there was any.
+  bool ReceiveAll(std::vector<T>* out) {
+    const size_t size = out->size();
+    T t;
+    while (Pop(&t)) {
+      out->push_back(std::move(t));
+    }
+    return out->size() != size;
   }
+  bool HasPending() { return tail_->next.load(std::memory_order_acquire); }
 
-  bool HasQuitted() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return queue_.empty() && !senders_;
-  }
+  bool HasQuitted() { return senders_ == 0 && !HasPending(); }
 
  private:
   friend class SenderImpl<T>;
 
+  struct Node {
+    std::atomic<Node*> next = nullptr;
+    T value;
+  };
+
   void Receive(T t) {
-    {
-      std::unique_lock<std::mutex> lock(mutex_);
-      queue_.push(std::move(t));
+    Node* node = new Node{nullptr, std::move(t)};
+    Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+    // Until then, the consumer sees the queue ending at |previous|.
+    previous->next.store(node, std::memory_order_release);
+    Notify();
+  }
+
+  // Link the nodes ahead, and publish them with a single exchange.
+  void ReceiveBatch(std::span<T> ts) {
+    if (ts.empty()) {
+      return;
+    }
+    Node* first = new Node{nullptr, std::move(ts[0])};
+    Node* last = first;
+    for (size_t i = 1; i < ts.size(); ++i) {
+      Node* node = new Node{nullptr, std::move(ts[i])};
+      last->next.store(node, std::memory_order_relaxed);
+      last = node;
     }
-    notifier_.notify_one();
+    Node* previous = head_.exchange(last, std::memory_order_acq_rel);
+    previous->next.store(first, std::memory_order_release);
+    Notify();
   }
 
   void ReleaseSender() {
     senders_--;
-    notifier_.notify_one();
+    Notify();
+  }
+
+  void Notify() {
+    events_.fetch_add(1, std::memory_order_release);
+    events_.notify_one();
+  }
+
+  // Consumer only.
+  bool Pop(T* t) {
+    Node* next = tail_->next.load(std::memory_order_acquire);
+    if (!next) {
+      return false;
+    }
+    *t = std::move(next->value);
+    if (tail_ != &stub_) {
+      delete tail_;
+    }
+    tail_ = next;
+    return true;
   }
 
-  std::mutex mutex_;
-  std::queue<T> queue_;
-  std::condition_variable notifier_;
-  std::atomic<int> senders_;
+  Node stub_;
+  std::atomic<Node*> head_;
+  Node* tail_;
+  std::atomic<uint32_t> events_ = 0;
+  std::atomic<int> senders_ = 0;
 };
 
 template <class T>
@@ -1,27 +1,53 @@
 #ifndef FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 #define FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 
+#include <array>                         // for array
 #include <atomic>                        // for atomic
+#include <chrono>                        // for milliseconds
+#include <condition_variable>            // for condition_variable
+#include <cstddef>                       // for size_t
+#include <cstdint>                       // for uint64_t
+#include <deque>                         // for deque
 #include <ftxui/component/receiver.hpp>  // for Receiver, Sender
 #include <functional>                    // for function
 #include <memory>                        // for shared_ptr
+#include <mutex>                         // for mutex
+#include <span>                          // for span
 #include <string>                        // for string
+#include <string_view>                   // for string_view
 #include <thread>                        // for thread
+#include <unordered_map>                 // for unordered_map
 #include <variant>                       // for variant
+#include <vector>                        // for vector
 
 #include "ftxui/component/animation.hpp"       // for TimePoint
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
 #include "ftxui/component/event.hpp"           // for Event
-#include "ftxui/component/task.hpp"            // for Task, Closure
+#include "ftxui/component/input_recording.hpp"  // for InputRecording, ReplayReport
+#include "ftxui/component/task.hpp"            // for Task, Closure, InlineClosure
+#include "ftxui/component/tracer.hpp"          // for Tracer
+#include "ftxui/dom/elements.hpp"              // for Element
+#include "ftxui/dom/frame_arena.hpp"           // for FrameArena
+#include "ftxui/dom/hit_index.hpp"             // for HitIndex
+#include "ftxui/dom/key_cache.hpp"             // for KeyCache
+#include "ftxui/dom/layout_pool.hpp"           // for LayoutPool
+#include "ftxui/dom/profiler.hpp"              // for Profiler, ProfileReport
+#include "ftxui/dom/requirement.hpp"           // for Requirement
+#include "ftxui/screen/frame_protocol.hpp"     // for FrameEncoder
+#include "ftxui/screen/output_breakdown.hpp"   // for OutputBreakdown
 #include "ftxui/screen/screen.hpp"             // for Screen
+#include "ftxui/screen/terminal.hpp"           // for Capabilities, Dimensions
 
 namespace ftxui {
 class ComponentBase;
+class FrameBroadcast;
 class Loop;
 struct Event;
 
 using Component = std::shared_ptr<ComponentBase>;
 class ScreenInteractivePrivate;
+class TerminalInputParser;
+class WorkerPool;
 
 class ScreenInteractive : public Screen {
  public:
@@ -30,6 +56,14 @@ class ScreenInteractive : public Screen {
   static ScreenInteractive Fullscreen();
   static ScreenInteractive FitComponent();
   static ScreenInteractive TerminalOutput();
+  // A screen of a fixed size, not connected to the terminal. See FeedInput(),
+  // AdvanceTime() and TakeOutput().
+  static ScreenInteractive Headless(int dimx, int dimy);
+  // A screen of a fixed size, for a remote terminal, like one connected
+  // through SSH. See SessionServer.
+  static ScreenInteractive Session(int dimx, int dimy);
+
+  ~ScreenInteractive();
 
   // Return the currently active screen, nullptr if none.
   static ScreenInteractive* Active();
@@ -41,11 +75,262 @@ class ScreenInteractive : public Screen {
 
   // Post tasks to be executed by the loop.
   void Post(Task task);
+  void PostBatch(std::span<Task> tasks);
   void PostEvent(Event event);
   void RequestAnimationFrame();
+  void RequestAnimationFrameAt(animation::TimePoint time);
+  // Run |work| on the pool of worker threads of the screen, then |done| by the
+  // loop. The completions arriving together are posted as a single task. Call
+  // it from the loop, or from a |work|.
+  void RunAsync(Closure work, Closure done = nullptr);
+  // Change the size of a FixedSize(), Headless() or Session() screen, like
+  // after the remote terminal was resized. Call it from the loop.
+  void SetDimensions(int dimx, int dimy);
+  // Print |element| once, above the frame, into the terminal history. It
+  // isn't rendered again: only the frame below it is redrawn. Meant for the
+  // finalized content of a growing history, like logs. Call it from the loop.
+  void PrintStatic(Element element);
+
+  // Run |update| by the loop, and draw a new frame. The updates posted with
+  // the same |key| until then replace each other: only the last one runs. Can
+  // be called from any thread.
+  void UpdateState(const void* key, Closure update);
+  // Draw a new frame, after a change of the state displayed by the components.
+  // Can be called from any thread.
+  void RequestRedraw();
 
   CapturedMouse CaptureMouse();
 
+  // Called while rendering, by the components showing where the mouse hovers.
+  // See MouseMotionOnDemand().
+  void RequestMouseMotion();
+
+  // The rate of the animation frames, while a component requests them. The
+  // frames are aligned on multiples of 1/fps. Defaults to 60.
+  void AnimationFrameRate(int fps);
+  // Degrade the animations while the frames take longer than |budget| to draw:
+  // they get fewer frames, and jump to their end when far over budget. This
+  // leaves the time to the updates of the content. 0, the default, disables it.
+  void FrameBudget(std::chrono::microseconds budget);
+  // How many animation periods separate the animation frames, because of
+  // FrameBudget(). 1 when the frames are within budget.
+  int AnimationSlowdown() const { return animation_slowdown_; }
+
+  // Draw at most |fps| frames per second. The invalidations arriving in
+  // between are drawn together, at the end of the frame interval. The keyboard
+  // input is drawn at most |input_latency| after it arrived, without waiting
+  // for the end of the interval. 0 fps, the default, draws after every batch of
+  // tasks.
+  void MaxFrameRate(int fps, std::chrono::milliseconds input_latency =
+                                 std::chrono::milliseconds(0));
+
+  // Wait |delay| after the terminal was resized before drawing, so that a burst
+  // of resizes, like while dragging the border of the window, is drawn once,
+  // at the latest size. Defaults to 20ms. 0 draws after every resize.
+  void ResizeDebounce(std::chrono::milliseconds delay);
+
+  // Only redraw the cells modified since the previous frame, instead of the
+  // whole screen. Disabled by default.
+  void TrackDamage(bool enable = true);
+
+  // Only redraw the lines modified since the previous frame. This is cheaper
+  // than TrackDamage(), no copy of the previous frame is kept. Disabled by
+  // default.
+  void TrackRowDamage(bool enable = true);
+
+  // With TrackDamage(), let the terminal scroll the lines that moved
+  // vertically, using scroll regions. Only used by the fullscreen dimension.
+  // Disabled by default.
+  void ScrollRegions(bool enable = true);
+
+  // Erase the trailing blanks of the lines, and repeat the runs of an identical
+  // character using REP when the terminal supports it. Disabled by default.
+  void RunLengthOutput(bool enable = true);
+
+  // Ask the terminal to display every frame atomically, using the synchronized
+  // update mode (DEC private mode 2026), when it supports it. Disabled by
+  // default.
+  void SynchronizedUpdate(bool enable = true);
+
+  // Query what the terminal supports when installed, using DA1, DA2, XTVERSION
+  // and DECRQM. The replies are handled asynchronously, and update
+  // Terminal::GetCapabilities(), kept per $TERM for the next screens. Disabled
+  // by default.
+  void ProbeTerminal(bool enable = true);
+  // What the terminal supports, probed or guessed.
+  const Terminal::Capabilities& Capabilities() const { return capabilities_; }
+
+  // Write the frames to the terminal from a dedicated thread. When the terminal
+  // is slow, the frames are skipped instead of blocking the event handling.
+  // Disabled by default.
+  void ThreadedOutput(bool enable = true);
+
+  // Encode the frames into escape sequences from the writer thread of
+  // ThreadedOutput(), while the loop handles the next events. The components
+  // are still rendered, laid out and drawn from the loop. Disabled by default.
+  void PipelinedRender(bool enable = true);
+
+  // Write the frames using the binary protocol of FrameEncoder, for a thin
+  // client drawing the cells itself, instead of escape sequences. Meant for a
+  // Session(). Disabled by default.
+  void FrameProtocol(bool enable = true);
+
+  // Also send every frame to the read-only viewers of |broadcast|. nullptr
+  // stops. See FrameBroadcast.
+  void Broadcast(FrameBroadcast* broadcast);
+
+  // Allocate the Elements rendered by the components from an arena reused
+  // from one frame to the next, instead of the heap. Disabled by default.
+  void ArenaAllocation(bool enable = true);
+
+  // Lay out the large independent children of the containers on a pool of
+  // threads. The layout is identical to the serial one. Disabled by default.
+  void ParallelLayout(bool enable = true);
+
+  // Draw the large children of the containers whose boxes don't overlap on the
+  // same pool of threads. Disabled by default.
+  void ParallelRender(bool enable = true);
+
+  // Encode the large frames into the terminal output by bands of rows, on the
+  // same pool of threads. Disabled by default.
+  void ParallelOutput(bool enable = true);
+
+  // Don't dispatch the mouse movements hitting none of the boxes captured by
+  // reflect() during the last frame. Disabled by default.
+  void MouseHitTest(bool enable = true);
+
+  // Only ask the terminal to report the mouse movements without a button
+  // pressed while a component rendered by the last frame called
+  // RequestMouseMotion(). Otherwise, only the clicks and the drags are
+  // reported. Disabled by default.
+  void MouseMotionOnDemand(bool enable = true);
+
+  // Measure the layout and the drawing of every type of node, during every
+  // frame. The nodes are only measured when FTXUI is built with the
+  // FTXUI_PROFILE CMake option. Disabled by default.
+  void Profile(bool enable = true);
+  // What Profile() measured during the last frame.
+  const ProfileReport& FrameProfile() const { return frame_profile_; }
+
+  // Before handling a batch of pending events, drop the mouse movements and
+  // the terminal resizes immediately followed by another one. Only the latest
+  // is handled. Disabled by default.
+  void CoalesceEvents(bool enable = true);
+
+  // Handle the pending tasks by priority instead of in order: the events
+  // first, then the closures posted with Post(), then the animation frames.
+  // Once the closures and the animation frames took |budget| in a frame, the
+  // others wait until it is drawn. A zero |budget| doesn't limit them.
+  // Disabled by default.
+  void PriorityLanes(bool enable = true,
+                     std::chrono::microseconds budget =
+                         std::chrono::milliseconds(8));  // NOLINT
+
+  // When the standard output isn't a terminal, like a pipe, a file or a CI
+  // log, write the frames as plain text, without escape sequences: the last
+  // one on exit, and one every |interval| when it isn't zero. The terminal
+  // isn't configured, and its input isn't read. Disabled by default.
+  void NonInteractiveOutput(bool enable = true,
+                            std::chrono::milliseconds interval = {});
+
+  // How the terminal input was read, since the screen was created. POSIX only.
+  struct InputReadStatistics {
+    size_t buffer_size = 0;  // The size of the buffer read into.
+    size_t reads = 0;        // The number of read() returning some input.
+    size_t bytes = 0;        // The total number of bytes read.
+    size_t largest = 0;      // The largest number of bytes read at once.
+    size_t full = 0;         // The number of reads filling the whole buffer.
+  };
+  InputReadStatistics InputStatistics() const;
+
+  // What a frame cost. See KeepStats().
+  struct FrameStats {
+    // The time spent:
+    std::chrono::nanoseconds events{0};   // Handling the tasks before the frame.
+    std::chrono::nanoseconds render{0};   // In Component::Render().
+    std::chrono::nanoseconds layout{0};   // In ComputeRequirement(), SetBox().
+    std::chrono::nanoseconds draw{0};     // Drawing the Elements on the Screen.
+    std::chrono::nanoseconds shaders{0};  // In Screen::ApplyShader().
+    std::chrono::nanoseconds encode{0};   // In Screen::ToString(), or its diff.
+    std::chrono::nanoseconds write{0};    // Writing toward the terminal.
+
+    size_t output_bytes = 0;   // Written toward the terminal.
+    OutputBreakdown output;    // The same bytes, by kind.
+    size_t cells_changed = 0;  // Since the previous frame. See below.
+    size_t tasks = 0;          // Handled before the frame.
+    size_t queue_depth = 0;    // The most tasks found pending at once.
+  };
+  // Keep the statistics of the last |frames| frames. 0 disables them. Disabled
+  // by default. The cells changed are counted exactly with TrackDamage(), by
+  // whole lines with TrackRowDamage(), and are every cell otherwise.
+  void KeepStats(size_t frames = 120);
+  // The statistics of the last frames, oldest first.
+  std::vector<FrameStats> Stats() const;
+
+  // Same as Screen::MemoryUsage(), adding the previous frames kept to draw the
+  // next ones, the output buffers, the statistics and the arena of the
+  // Elements. The Elements and the components are described by DescribeTree().
+  size_t MemoryUsage() const;
+
+  // A frame slower than the threshold of WatchSlowFrames().
+  struct SlowFrame {
+    // The time spent handling the tasks before the frame, and drawing it.
+    std::chrono::nanoseconds duration{0};
+    FrameStats stats;       // The time of every step.
+    TreeReport tree;        // The Elements drawn.
+    ProfileReport profile;  // What Profile() measured, when enabled.
+
+    // A summary, a few lines long.
+    std::string ToString() const;
+  };
+  // Call |callback| with the frames slower than |threshold|: the time of their
+  // steps, and the shape of the Elements they drew. An empty |callback| stops
+  // watching. The steps are only measured while watching.
+  void WatchSlowFrames(std::chrono::microseconds threshold,
+                       std::function<void(const SlowFrame&)> callback);
+  // Append the summary of the slow frames to the file at |path|.
+  void WatchSlowFrames(std::chrono::microseconds threshold,
+                       const std::string& path);
+
+  // Record the tasks, the steps of the frames, the reads of the input and the
+  // animation wake ups into |tracer|. nullptr stops. See Tracer.
+  void Trace(Tracer* tracer);
+
+  // Append the input read from the terminal, and the terminal resizes, to
+  // |recording|, until RecordInput(nullptr) is called. The recording is only
+  // read once the loop exited. POSIX only.
+  void RecordInput(InputRecording* recording);
+
+  // Run the loop on |component|, feeding it the |recording| as if it was read
+  // from the terminal, and drawing after every entry. The entries are fed
+  // without waiting; their times only time out the incomplete escape
+  // sequences. The resizes change the size of a FixedSize() screen.
+  ReplayReport Replay(Component component, const InputRecording& recording);
+
+  // For the Headless() screens, while the loop runs. Drive the loop using
+  // Loop::RunOnce().
+  // Parse |input| as if it was read from the terminal.
+  void FeedInput(std::string_view input);
+  // Move the clock of the screen forward. It times out the incomplete escape
+  // sequences, and sends the animation frames. The clock starts at zero.
+  void AdvanceTime(animation::Clock::duration duration);
+  // The bytes written toward the terminal since the last call.
+  std::string TakeOutput();
+
+  // Let a host event loop, like epoll or asio, drive the screen, without any
+  // thread. The host passes the terminal input to FeedInput(), calls Tick() at
+  // NextTick(), and Loop::RunOnce() after them and whenever TaskFd() is
+  // readable. Set before the loop starts. Disabled by default.
+  void HostEventLoop(bool enable = true);
+  // Readable while the tasks posted from any thread, or the signals, wait for
+  // Loop::RunOnce(). -1 without HostEventLoop(). POSIX only.
+  int TaskFd() const;
+  // Time out the incomplete escape sequences, and post the animation frame due
+  // by now.
+  void Tick();
+  // When Tick() must be called next. TimePoint::max() when nothing is due.
+  animation::TimePoint NextTick();
+
   // Decorate a function. The outputted one will execute similarly to the
   // inputted one, but with the currently active screen terminal hooks
   // temporarily uninstalled.
@@ -59,6 +344,7 @@ class ScreenInteractive : public Screen {
 
   void PreMain();
   void PostMain();
+  void StartAnimations();
 
   bool HasQuitted();
   void RunOnce(Component component);
@@ -66,9 +352,35 @@ class ScreenInteractive : public Screen {
 
   void HandleTask(Component component, Task& task);
   void Draw(Component component);
+  Dimensions FrameDimensions(const Requirement& requirement,
+                             Dimensions terminal) const;
+  void DrawPlainText(Component component);
+  void WritePlainText(Component component);
+  size_t CellsChanged() const;
+  void EncodeFrame(Screen& frame, bool scroll, std::string& out);
+  void PrintStaticElements();
+  void UpdateLayoutPool();
   void ResetCursorPosition();
 
   void Signal(int signal);
+  void RecordRead(std::string_view input);
+  void RecordEntry(InputRecording::Entry entry);
+  void AnimationListener(Sender<Task> out);
+  void NotifyTaskFd();
+  void RunCompletions();
+  void InstallSession();
+  void StartProbe();
+  void HandleProbeReply(const Event& event);
+  void UseCapabilities(const Terminal::Capabilities& capabilities);
+  void UninstallSession();
+  void RunStateUpdates();
+  void DrainTaskFd();
+  void ScheduleAnimationFrame();
+  void WakeUpLater(int periods = 1);
+  void WakeUpAt(animation::TimePoint time);
+  void DebounceResize();
+  void UpdateAnimationQuality(animation::Clock::duration frame_time);
+  animation::TimePoint Now() const;
 
   ScreenInteractive* suspended_screen_ = nullptr;
   enum class Dimension {
@@ -78,31 +390,223 @@ class ScreenInteractive : public Screen {
     TerminalOutput,
   };
   Dimension dimension_ = Dimension::Fixed;
+  // The size of a FixedSize() screen.
+  int fixed_dimx_ = 0;
+  int fixed_dimy_ = 0;
   bool use_alternative_screen_ = false;
+
+  // See Headless(). No terminal, no thread. The input is parsed by
+  // |input_parser_|, the output is appended to |headless_output_|, and the
+  // time is |headless_now_|.
+  bool headless_ = false;
+  // Parses the input passed to FeedInput(): for Headless(), and
+  // HostEventLoop().
+  std::unique_ptr<TerminalInputParser> input_parser_;
+  std::string headless_output_;
+  animation::TimePoint headless_now_;
+  // See Session(). Like HostEventLoop(), with a real clock, and the output
+  // appended to |headless_output_|. Nothing global is used.
+  bool session_ = false;
   ScreenInteractive(int dimx,
                     int dimy,
                     Dimension dimension,
-                    bool use_alternative_screen);
+                    bool use_alternative_screen,
+                    bool headless = false,
+                    bool session = false);
 
   Sender<Task> task_sender_;
   Receiver<Task> task_receiver_;
+  // The tasks drained from |task_receiver_|, handled by RunOnce(). Reused
+  // across batches.
+  std::vector<Task> task_batch_;
+  bool coalesce_events_ = false;
+  // See PriorityLanes(). The tasks exceeding the budget are left in
+  // |task_batch_|, for the next RunOnce().
+  bool priority_lanes_ = false;
+  std::chrono::microseconds low_priority_budget_{0};
+  // See NonInteractiveOutput(). Whether Install() chose the plain text output,
+  // the component to draw on exit, and when the next snapshot is due.
+  bool non_interactive_output_ = false;
+  std::chrono::milliseconds snapshot_interval_{0};
+  bool plain_text_ = false;
+  Component plain_text_component_;
+  animation::TimePoint next_snapshot_;
 
   std::string set_cursor_position;
   std::string reset_cursor_position;
 
+  // Reused across frames to avoid allocating the output every frame.
+  std::string output_buffer_;
+
   std::atomic<bool> quit_ = false;
+  // Updated by the input listener. See InputStatistics().
+  struct InputCounters {
+    std::atomic<size_t> reads = 0;
+    std::atomic<size_t> bytes = 0;
+    std::atomic<size_t> largest = 0;
+    std::atomic<size_t> full = 0;
+  };
+  InputCounters input_counters_;
+  // See RecordInput().
+  std::mutex recording_mutex_;
+  InputRecording* recording_ = nullptr;   // Guarded by |recording_mutex_|.
+  animation::TimePoint recording_start_;  // Guarded too.
   std::thread event_listener_;
-  std::thread animation_listener_;
-  bool animation_requested_ = false;
+  // The pipe written by ExitNow() and the signals to wake up |event_listener_|,
+  // or the host. POSIX only.
+  std::array<int, 2> wakeup_ = {-1, -1};
+  // See HostEventLoop(). No |event_listener_|, nor |animation_listener_|. The
+  // input is fed at |input_time_|, and |wakeup_| is the TaskFd().
+  bool host_event_loop_ = false;
+  animation::TimePoint input_time_;
+  // Whether TaskFd() was made readable since the last DrainTaskFd().
+  std::atomic<bool> task_fd_notified_ = false;
+  // The event set by ExitNow() to wake up |event_listener_|. A HANDLE, Windows
+  // only.
+  void* exit_event_ = nullptr;
+  bool animation_requested_ = false;  // By the components.
+  bool animation_scheduled_ = false;  // By the components, or the animators.
+  // See FrameBudget(). |frame_time_| is the moving average of the time spent
+  // drawing the last frames.
+  animation::Clock::duration frame_budget_{0};
+  animation::Clock::duration frame_time_{0};
+  int animation_slowdown_ = 1;
+  bool animation_snap_ = false;
+  // See RequestAnimationFrameAt(). The earliest frame requested at a time.
+  animation::TimePoint animation_frame_at_ = animation::TimePoint::max();
   animation::TimePoint previous_animation_time_;
+  // Steps the animators created while this screen is active.
+  std::shared_ptr<animation::Scheduler> scheduler_ =
+      std::make_shared<animation::Scheduler>();
+
+  // Sends one AnimationTask at the next frame boundary after every
+  // WakeUpLater(), like RequestAnimationFrame(), and sleeps otherwise.
+  std::thread animation_listener_;
+  std::mutex animation_mutex_;
+  std::condition_variable animation_wake_;
+  bool animation_armed_ = false;  // Guarded by |animation_mutex_|.
+  animation::TimePoint animation_deadline_;  // Guarded too.
+  animation::Clock::duration animation_period_ =  // Guarded too.
+      std::chrono::microseconds(16667);
+
+  // See MaxFrameRate(). A zero |frame_interval_| disables the pacing.
+  animation::Clock::duration frame_interval_{0};
+  animation::Clock::duration input_latency_{0};
+  animation::TimePoint previous_draw_time_;
+  // When the keyboard input received since the last frame must be drawn.
+  animation::TimePoint input_deadline_ = animation::TimePoint::max();
+  // See ResizeDebounce(). The frame isn't drawn before |resize_deadline_|,
+  // while a resize is pending.
+  animation::Clock::duration resize_debounce_ = std::chrono::milliseconds(20);
+  animation::TimePoint resize_deadline_;
+  bool resize_pending_ = false;
 
   int cursor_x_ = 1;
   int cursor_y_ = 1;
 
   bool mouse_captured = false;
-  bool previous_frame_resized_ = false;
+  // Whether the frame might have moved since the last cursor position report.
+  bool cursor_report_stale_ = true;
+  // The cursor position reports requested, and not received yet.
+  int cursor_reports_pending_ = 0;
+  // Where the cursor was in the frame, when the last report was requested.
+  int cursor_report_x_ = 0;
+  int cursor_report_y_ = 0;
+  // The terminal size of the previous frame.
+  int terminal_dimx_ = 0;
+  int terminal_dimy_ = 0;
 
   bool frame_valid_ = false;
+  // See PrintStatic(). Printed with the next frame.
+  std::vector<Element> static_elements_;
+  // Whether a task invalidating the frame was posted by RequestRedraw(), and
+  // not handled yet.
+  std::atomic<bool> redraw_requested_ = false;
+
+  // The last frame written to the terminal. Used to draw only the difference
+  // with the next one when |track_damage_| is enabled. This is the front
+  // buffer, its pixels are swapped with this screen after every frame.
+  bool track_damage_ = false;
+  Screen previous_frame_{0, 0};
+  bool scroll_regions_ = false;
+
+  // The hashes of the rows of the last frame written to the terminal. Used
+  // when |track_row_damage_| is enabled.
+  bool track_row_damage_ = false;
+  std::vector<uint64_t> previous_row_hashes_;
+  std::vector<uint64_t> row_hashes_;
+
+  // Whether the synchronized update mode was requested, and whether the
+  // terminal reported supporting it.
+  bool synchronized_update_ = false;
+  bool synchronized_update_supported_ = false;
+
+  // See ProbeTerminal(). |probe_| collects the replies until the DA1 one,
+  // answered last.
+  bool probe_terminal_ = false;
+  std::unique_ptr<Terminal::Capabilities> probe_;
+  Terminal::Capabilities capabilities_;
+
+  bool threaded_output_ = false;
+  // See PipelinedRender(). The frame handed over to the writer thread, encoded
+  // there along with |previous_frame_|, the row hashes and |frame_encoder_|.
+  bool pipelined_render_ = false;
+  Screen pipeline_frame_{0, 0};
+  // See FrameProtocol().
+  std::unique_ptr<FrameEncoder> frame_encoder_;
+  bool run_length_output_ = false;
+
+  bool arena_allocation_ = false;
+  FrameArena frame_arena_;
+
+  bool parallel_layout_ = false;
+  bool parallel_render_ = false;
+  bool parallel_output_ = false;
+  std::unique_ptr<LayoutPool> layout_pool_;
+
+  // See MouseHitTest(). Whether the last mouse event hit a reflected box.
+  std::unique_ptr<HitIndex> hit_index_;
+  bool previous_mouse_hit_ = true;
+
+  // See MouseMotionOnDemand(). Whether the last frame requested the mouse
+  // movements, and whether the terminal reports them.
+  bool mouse_motion_on_demand_ = false;
+  bool mouse_motion_requested_ = false;
+  bool mouse_motion_reported_ = true;
+
+  std::unique_ptr<Profiler> profiler_;
+  ProfileReport frame_profile_;
+
+  // See KeepStats(). |next_stats_| accumulates the tasks handled until the
+  // next frame.
+  size_t stats_frames_ = 0;
+  std::deque<FrameStats> stats_;
+  FrameStats next_stats_;
+
+  // See WatchSlowFrames().
+  std::chrono::nanoseconds slow_frame_threshold_{0};
+  std::function<void(const SlowFrame&)> slow_frame_callback_;
+
+  // See Trace(). Read by the listener threads.
+  std::atomic<Tracer*> tracer_ = nullptr;
+
+  // See Broadcast().
+  FrameBroadcast* broadcast_ = nullptr;
+
+  // The elements decorated with key(), reused by the next frame.
+  KeyCache key_cache_;
+
+  // See RunAsync(). The |done| closures of the jobs returned since the last
+  // RunCompletions(). Destroyed first, so the jobs still running can post.
+  std::mutex completions_mutex_;
+  std::vector<Closure> completions_;  // Guarded by |completions_mutex_|.
+  std::unique_ptr<WorkerPool> worker_pool_;
+
+  // See UpdateState(). The updates posted since the last RunStateUpdates(), in
+  // order, and the index of every key in |state_updates_|.
+  std::mutex state_updates_mutex_;
+  std::vector<Closure> state_updates_;  // Guarded by |state_updates_mutex_|.
+  std::unordered_map<const void*, size_t> state_update_keys_;  // Guarded too.
 
   friend class Loop;
 
@@ -110,6 +614,19 @@ class ScreenInteractive : public Screen {
   class Private {
    public:
     static void Signal(ScreenInteractive& s, int signal) { s.Signal(signal); }
+    static void RecordRead(ScreenInteractive& s, std::string_view input) {
+      s.RecordRead(input);
+    }
+    static Tracer* GetTracer(ScreenInteractive& s) { return s.tracer_; }
+    static animation::TimePoint Now(ScreenInteractive& s) { return s.Now(); }
+    static void* ExitEvent(ScreenInteractive& s) { return s.exit_event_; }
+    static void ScheduleAnimationFrame(ScreenInteractive& s) {
+      s.ScheduleAnimationFrame();
+    }
+    static const std::shared_ptr<animation::Scheduler>& GetScheduler(
+        ScreenInteractive& s) {
+      return s.scheduler_;
+    }
   };
   friend Private;
 };
@@ -0,0 +1,93 @@
+#ifndef FTXUI_COMPONENT_SESSION_SERVER_HPP
+#define FTXUI_COMPONENT_SESSION_SERVER_HPP
+
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <map>         // for map
+#include <memory>      // for unique_ptr
+#include <mutex>       // for mutex
+
+#include "ftxui/component/component_base.hpp"  // for Component
+
+namespace ftxui {
+
+class WorkerPool;
+
+/// @brief Serve many remote terminals, like the SSH connections of a server,
+/// from a single process. Every session is a ScreenInteractive::Session(),
+/// bound to the file descriptors of its terminal, with its own component.
+///
+/// A single thread, running Run(), waits for the input and the tasks of every
+/// session. The sessions with some work are handled by a pool of threads
+/// shared by all of them. A session is handled by one thread at a time, and
+/// starts no thread on its own.
+///
+/// The components of different sessions may run concurrently: they must not
+/// share any state without synchronization. Every session steps only the
+/// animators of its own components. POSIX only.
+///
+/// ### Example
+///
+/// ```cpp
+/// SessionServer server;
+/// std::thread thread([&] { server.Run(); });
+/// // For every connection:
+/// server.Add(channel_fd, channel_fd, width, height, MakeComponent());
+/// ```
+///
+/// @ingroup component
+class SessionServer {
+ public:
+  using Id = int;
+
+  // |threads| handle the sessions. 0 uses the number of cores.
+  explicit SessionServer(int threads = 0);
+  // Ends the remaining sessions.
+  ~SessionServer();
+  SessionServer(const SessionServer&) = delete;
+  SessionServer(SessionServer&&) = delete;
+  SessionServer& operator=(const SessionServer&) = delete;
+  SessionServer& operator=(SessionServer&&) = delete;
+
+  // Serve |component| to the terminal of size |dimx|x|dimy|, whose input is
+  // read from |input_fd|, and output written to |output_fd|. The descriptors
+  // are not closed by the server. Can be called from any thread.
+  Id Add(int input_fd, int output_fd, int dimx, int dimy, Component component);
+  // The terminal of |session| was resized. Can be called from any thread.
+  void Resize(Id session, int dimx, int dimy);
+  // End |session|. Can be called from any thread.
+  void Remove(Id session);
+  // Called by Run() once a session ended: its component exited, its input was
+  // closed, or it was removed. The descriptors aren't used anymore.
+  void OnEnd(std::function<void(Id)> on_end);
+  // The number of sessions.
+  size_t size();
+
+  // Handle the sessions, until Stop().
+  void Run();
+  // Make Run() return. Can be called from any thread.
+  void Stop();
+
+ private:
+  struct Session;
+  void Wake();
+  void Serve(Session* session, bool readable);
+
+  std::mutex mutex_;
+  std::map<Id, std::unique_ptr<Session>> sessions_;  // Guarded by |mutex_|.
+  Id next_id_ = 0;                                   // Guarded too.
+  bool stop_ = false;                                // Guarded too.
+  std::function<void(Id)> on_end_;                   // Guarded too.
+  // Wakes up Run() when a session was added, removed, or handled.
+  std::array<int, 2> wakeup_ = {-1, -1};
+  std::unique_ptr<WorkerPool> pool_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_SESSION_SERVER_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
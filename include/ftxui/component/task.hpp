@@ -1,14 +1,105 @@
 #ifndef FTXUI_COMPONENT_ANIMATION_HPP
 #define FTXUI_COMPONENT_ANIMATION_HPP
 
-#include <functional>
-#include <variant>
+#include <cstddef>      // for size_t, max_align_t
+#include <functional>   // for function
+#include <new>          // for operator new
+#include <type_traits>  // for decay_t, enable_if_t, is_invocable_v
+#include <utility>      // for forward, move
+#include <variant>      // for variant
 #include "ftxui/component/event.hpp"
 
 namespace ftxui {
 class AnimationTask {};
 using Closure = std::function<void()>;
-using Task = std::variant<Event, Closure, AnimationTask>;
+
+// A move-only callable stored inline, without allocation, when it fits in
+// |kInlineSize| bytes. This is the case of the lambdas capturing a few values.
+// Bigger ones are moved to the heap, like std::function does.
+class InlineClosure {
+ public:
+  static constexpr size_t kInlineSize = 64;
+
+  InlineClosure() = default;
+
+  template <typename F,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<F>, InlineClosure> &&
+                std::is_invocable_v<std::decay_t<F>&>>>
+  InlineClosure(F&& f) {  // NOLINT
+    using Fn = std::decay_t<F>;
+    if constexpr (FitsInline<Fn>()) {
+      new (buffer_) Fn(std::forward<F>(f));
+      vtable_ = &kInline<Fn>;
+    } else {
+      new (buffer_) Fn*(new Fn(std::forward<F>(f)));
+      vtable_ = &kHeap<Fn>;
+    }
+  }
+
+  InlineClosure(InlineClosure&& other) noexcept { *this = std::move(other); }
+  InlineClosure& operator=(InlineClosure&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      if (other.vtable_) {
+        other.vtable_->move(other.buffer_, buffer_);
+        vtable_ = other.vtable_;
+        other.vtable_ = nullptr;
+      }
+    }
+    return *this;
+  }
+  InlineClosure(const InlineClosure&) = delete;
+  InlineClosure& operator=(const InlineClosure&) = delete;
+  ~InlineClosure() { Reset(); }
+
+  explicit operator bool() const { return vtable_ != nullptr; }
+  void operator()() { vtable_->call(buffer_); }
+
+ private:
+  struct VTable {
+    void (*call)(void*);
+    // Move construct into |to|, and destroy |from|.
+    void (*move)(void* from, void* to);
+    void (*destroy)(void*);
+  };
+
+  template <typename Fn>
+  static constexpr bool FitsInline() {
+    return sizeof(Fn) <= kInlineSize &&
+           alignof(Fn) <= alignof(std::max_align_t) &&
+           std::is_nothrow_move_constructible_v<Fn>;
+  }
+
+  template <typename Fn>
+  static constexpr VTable kInline = {
+      [](void* f) { (*static_cast<Fn*>(f))(); },
+      [](void* from, void* to) {
+        new (to) Fn(std::move(*static_cast<Fn*>(from)));
+        static_cast<Fn*>(from)->~Fn();
+      },
+      [](void* f) { static_cast<Fn*>(f)->~Fn(); },
+  };
+
+  template <typename Fn>
+  static constexpr VTable kHeap = {
+      [](void* f) { (**static_cast<Fn**>(f))(); },
+      [](void* from, void* to) { new (to) Fn*(*static_cast<Fn**>(from)); },
+      [](void* f) { delete *static_cast<Fn**>(f); },
+  };
+
+  void Reset() {
+    if (vtable_) {
+      vtable_->destroy(buffer_);
+      vtable_ = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char buffer_[kInlineSize];
+  const VTable* vtable_ = nullptr;
+};
+
+using Task = std::variant<Event, InlineClosure, AnimationTask>;
 }  // namespace ftxui
 
 #endif  // FTXUI_COMPONENT_ANIMATION_HPP
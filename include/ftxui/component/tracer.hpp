@@ -0,0 +1,77 @@
+#ifndef FTXUI_COMPONENT_TRACER_HPP
+#define FTXUI_COMPONENT_TRACER_HPP
+
+#include <chrono>   // for steady_clock
+#include <cstddef>  // for size_t
+#include <mutex>    // for mutex
+#include <string>   // for string
+#include <vector>   // for vector
+
+namespace ftxui {
+
+/// @brief Record what the threads of a ScreenInteractive do, and when. The
+/// recording is exported in the Chrome Trace Event format, opened by
+/// chrome://tracing or https://ui.perfetto.dev.
+///
+/// The main loop traces every task it handles, and every step of the frames.
+/// The input listener traces every read, and the animation listener every
+/// wake up.
+///
+/// ### Example
+///
+/// ```cpp
+/// Tracer tracer;
+/// screen.Trace(&tracer);
+/// screen.Loop(component);
+/// std::ofstream("trace.json") << tracer.ToJson();
+/// ```
+///
+/// @ingroup component
+class Tracer {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Thread {
+    Loop,
+    EventListener,
+    AnimationListener,
+  };
+
+  // Record a span of |thread|, from |begin| to |end|. |name| must outlive the
+  // tracer, like a string literal.
+  void Span(Thread thread,
+            const char* name,
+            Clock::time_point begin,
+            Clock::time_point end);
+  // Record an instant of |thread|.
+  void Instant(Thread thread, const char* name, Clock::time_point time);
+
+  // The number of recorded spans and instants.
+  size_t size() const;
+  void Clear();
+
+  // The Chrome Trace Event JSON of the recording. The times are relative to
+  // the creation of the tracer.
+  std::string ToJson() const;
+
+ private:
+  struct Entry {
+    Thread thread;
+    const char* name;
+    Clock::time_point begin;
+    Clock::time_point end;
+    bool instant;
+  };
+
+  const Clock::time_point origin_ = Clock::now();
+  mutable std::mutex mutex_;
+  std::vector<Entry> entries_;  // Guarded by |mutex_|.
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_TRACER_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
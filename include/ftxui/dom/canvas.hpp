@@ -1,10 +1,13 @@
 #ifndef FTXUI_DOM_CANVAS_HPP
 #define FTXUI_DOM_CANVAS_HPP
 
-#include <cstddef>        // for size_t
-#include <functional>     // for function
-#include <string>         // for string
-#include <unordered_map>  // for unordered_map
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint8_t
+#include <functional>  // for function
+#include <memory_resource>  // for memory_resource, vector
+#include <span>        // for span
+#include <string>      // for string
+#include <vector>      // for vector
 
 #include "ftxui/screen/color.hpp"   // for Color
 #include "ftxui/screen/screen.hpp"  // for Pixel
@@ -17,18 +20,37 @@
 
 namespace ftxui {
 
+// How an RGB image is drawn with characters.
+enum class ImageMode : uint8_t {
+  // Two pixels per character, '▀' with the top one as the foreground color
+  // and the bottom one as the background color.
+  HalfBlock,
+  // 2x4 pixels per character, one braille dot each. The dots of the bright
+  // pixels are drawn, with the average color of those pixels.
+  Braille,
+};
+
 struct Canvas {
  public:
   Canvas() = default;
   Canvas(int width, int height);
+  // The cells are allocated from |resource|, which must outlive the canvas.
+  Canvas(int width, int height, std::pmr::memory_resource* resource);
 
   // Getters:
   int width() const { return width_; }
   int height() const { return height_; }
   Pixel GetPixel(int x, int y) const;
+  // The bytes of memory holding the cells, besides the object itself.
+  size_t MemoryUsage() const;
 
   using Stylizer = std::function<void(Pixel&)>;
 
+  struct Point {
+    int x = 0;
+    int y = 0;
+  };
+
   // Draws using braille characters --------------------------------------------
   void DrawPointOn(int x, int y);
   void DrawPointOff(int x, int y);
@@ -52,6 +74,14 @@ struct Canvas {
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Color& color);
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Stylizer& s);
 
+  // Draw many braille dots at once. A polyline joins every point to the next.
+  void DrawPoints(std::span<const Point> points);
+  void DrawPoints(std::span<const Point> points, const Stylizer& s);
+  void DrawPoints(std::span<const Point> points, const Color& color);
+  void DrawPointPolyline(std::span<const Point> points);
+  void DrawPointPolyline(std::span<const Point> points, const Stylizer& s);
+  void DrawPointPolyline(std::span<const Point> points, const Color& color);
+
   // Draw using box characters -------------------------------------------------
   // Block are of size 1x2. y is considered to be a multiple of 2.
   void DrawBlockOn(int x, int y);
@@ -92,42 +122,64 @@ struct Canvas {
   void DrawText(int x, int y, const std::string& value, const Color& color);
   void DrawText(int x, int y, const std::string& value, const Stylizer& style);
 
+  // Draw an image ------------------------------------------------------------
+  // Draw the |width|x|height| pixels of |rgb|, 3 bytes per pixel, row by row,
+  // from (x,y).
+  // x is considered to be a multiple of 2.
+  // y is considered to be a multiple of 4.
+  void DrawImage(int x,
+                 int y,
+                 const uint8_t* rgb,
+                 int width,
+                 int height,
+                 ImageMode mode = ImageMode::HalfBlock);
+
   // Decorator:
   // x is considered to be a multiple of 2.
   // y is considered to be a multiple of 4.
   void Style(int x, int y, const Stylizer& style);
 
+  // Move the content |dx| dots to the left, or to the right when negative.
+  // The uncovered cells are cleared. This is useful for strip charts.
+  void Scroll(int dx);
+
  private:
   bool IsIn(int x, int y) const {
     return x >= 0 && x < width_ && y >= 0 && y < height_;
   }
-  enum CellType {
+  enum CellType : uint8_t {
     kBraille,
     kBlock,
     kText,
   };
+  // The dots and blocks are stored as bitmasks. Their character is encoded
+  // into |content| by GetPixel(), once after every change.
   struct Cell {
-    CellType type = kText;
     Pixel content;
+    CellType type = kText;
+    uint8_t bits = 0;
+    bool dirty = false;
   };
-  struct XY {
-    int x;
-    int y;
-    bool operator==(const XY& other) const {
-      return x == other.x && y == other.y;
-    }
-  };
-
-  struct XYHash {
-    size_t operator()(const XY& xy) const {
-      constexpr size_t shift = 1024;
-      return size_t(xy.x) * shift + size_t(xy.y);
+  template <class Plot>
+  void RasterizeLine(int x1, int y1, int x2, int y2, const Plot& plot);
+  template <class Plot>
+  void RasterizePolyline(std::span<const Point> points, const Plot& plot);
+
+  Cell& CellAt(int x, int y) { return storage_[y / 4 * stride_ + x / 2]; }
+  Cell& CellOf(int x, int y, CellType type) {
+    Cell& cell = CellAt(x, y);
+    if (cell.type != type) {
+      cell.type = type;
+      cell.bits = 0;
     }
-  };
+    cell.dirty = type != kText;
+    return cell;
+  }
 
   int width_ = 0;
   int height_ = 0;
-  std::unordered_map<XY, Cell, XYHash> storage_;
+  int stride_ = 0;
+  mutable std::pmr::vector<Cell> storage_;
 };
 
 }  // namespace ftxui
@@ -0,0 +1,61 @@
+#ifndef FTXUI_DOM_COLOR_MAP_HPP
+#define FTXUI_DOM_COLOR_MAP_HPP
+
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr
+#include <vector>   // for vector
+
+#include "ftxui/screen/color.hpp"  // for Color
+
+namespace ftxui {
+
+/// @brief Map the values in [min, max] to the colors of a gradient.
+///
+/// The gradient is quantized, once, into a table of |size| colors. Mapping a
+/// value only indexes the table. Copying a ColorMap shares its table.
+///
+/// ### Example
+///
+/// ```cpp
+/// const ColorMap temperature({Color::Blue, Color::Yellow, Color::Red},
+///                            -10.f, 40.f);
+/// Element document = heatmap(width, height, values.data(), temperature);
+/// ```
+///
+/// @ingroup dom
+class ColorMap {
+ public:
+  ColorMap() : ColorMap({Color::Black, Color::White}) {}
+  ColorMap(const std::vector<Color>& stops,
+           float min = 0.f,
+           float max = 1.f,
+           size_t size = 256);
+
+  // The color of |value|. The values out of the range, or NaN, take the color
+  // of the nearest bound, respectively of |min|.
+  const Color& operator()(float value) const {
+    const float index = (value - min_) * scale_;
+    if (!(index > 0.f)) {
+      return table_->front();
+    }
+    if (index >= float(table_->size() - 1)) {
+      return table_->back();
+    }
+    return (*table_)[size_t(index)];
+  }
+
+  size_t size() const { return table_->size(); }
+
+ private:
+  std::shared_ptr<const std::vector<Color>> table_;
+  float min_ = 0.f;
+  float scale_ = 0.f;  // The number of entries per unit.
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_COLOR_MAP_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
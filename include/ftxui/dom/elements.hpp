@@ -1,12 +1,24 @@
 #ifndef FTXUI_DOM_ELEMENTS_HPP
 #define FTXUI_DOM_ELEMENTS_HPP
 
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "ftxui/dom/canvas.hpp"
+#include "ftxui/dom/color_map.hpp"
 #include "ftxui/dom/flexbox_config.hpp"
+#include "ftxui/dom/log_buffer.hpp"
 #include "ftxui/dom/node.hpp"
+#include "ftxui/dom/style.hpp"
+#include "ftxui/dom/text_document.hpp"
+#include "ftxui/dom/text_part.hpp"
+#include "ftxui/dom/time_series.hpp"
 #include "ftxui/screen/box.hpp"
 #include "ftxui/screen/color.hpp"
 #include "ftxui/screen/screen.hpp"
@@ -14,11 +26,13 @@
 #include "ftxui/util/ref.hpp"
 
 namespace ftxui {
-class Node;
-using Element = std::shared_ptr<Node>;
-using Elements = std::vector<Element>;
+class MappedFile;
+struct ProfileReport;
 using Decorator = std::function<Element(Element)>;
 using GraphFunction = std::function<std::vector<int>(int, int)>;
+// Write the heights of a graph into |heights|, given the |height| of the graph.
+using GraphBufferFunction =
+    std::function<void(std::span<int> heights, int height)>;
 
 enum BorderStyle { LIGHT, HEAVY, DOUBLE, ROUNDED, EMPTY };
 enum class GaugeDirection { Left, Up, Right, Down };
@@ -32,8 +46,60 @@ Element& operator|=(Element&, Decorator);
 Elements operator|(Elements, Decorator);
 Decorator operator|(Decorator, Decorator);
 
+// Compose decorators at compile time, into a single one applying them from left
+// to right. compose(bold, color(Color::Red)) is equivalent to
+// bold | color(Color::Red), without intermediate std::function.
+template <class... Decorators>
+auto compose(Decorators... decorators) {
+  return [decorators = std::make_tuple(std::move(decorators)...)](
+             Element element) {
+    std::apply(
+        [&element](const auto&... decorator) {
+          ((element = decorator(std::move(element))), ...);
+        },
+        decorators);
+    return element;
+  };
+}
+
+// Pipe elements into any callable decorator: lambdas, functions and the result
+// of compose(). They are called directly, instead of being wrapped into a
+// Decorator.
+template <class F,
+          class = std::enable_if_t<std::is_invocable_r_v<Element, F&, Element>>>
+Element operator|(Element element, F&& decorator) {
+  return decorator(std::move(element));
+}
+template <class F,
+          class = std::enable_if_t<std::is_invocable_r_v<Element, F&, Element>>>
+Element& operator|=(Element& element, F&& decorator) {
+  element = decorator(std::move(element));
+  return element;
+}
+template <class F,
+          class = std::enable_if_t<std::is_invocable_r_v<Element, F&, Element>>>
+Elements operator|(Elements elements, F&& decorator) {
+  for (auto& element : elements) {
+    element = decorator(std::move(element));
+  }
+  return elements;
+}
+
 // --- Widget ---
 Element text(std::string text);
+Element text(int64_t value);
+Element text(uint64_t value);
+Element text(double value, int precision);
+Element text(double value) = delete;  // The precision is required.
+template <class T, class = std::enable_if_t<kIsNumber<T>>>
+Element text(T value) {
+  if constexpr (std::is_signed_v<T>) {
+    return text(static_cast<int64_t>(value));
+  } else {
+    return text(static_cast<uint64_t>(value));
+  }
+}
+Element textf(std::initializer_list<TextPart> parts);
 Element vtext(std::string text);
 Element separator();
 Element separatorLight();
@@ -73,10 +139,31 @@ Element paragraphAlignRight(const std::string& text);
 Element paragraphAlignCenter(const std::string& text);
 Element paragraphAlignJustify(const std::string& text);
 Element graph(GraphFunction);
+Element graph(GraphBufferFunction);
+Element timeSeries(ConstRef<TimeSeries>);
+Element sparkline(ConstRef<TimeSeries>, SparklineOption = {});
+Element heatmap(int width,
+                int height,
+                const float* values,
+                ColorMap map,
+                bool half_blocks = false);
+Element logView(ConstRef<LogBuffer>, int scroll = 0);
+Element textDocument(ConstRef<TextDocument>, bool wrap = false);
+Element fileView(std::shared_ptr<const MappedFile>, bool hex = false);
+Element fileView(const std::string& path, bool hex = false);
+Element debugOverlay(const ProfileReport&, int rows = 8);
 Element emptyElement();
 Element canvas(ConstRef<Canvas>);
 Element canvas(int width, int height, std::function<void(Canvas&)>);
 Element canvas(std::function<void(Canvas&)>);
+Element image(const uint8_t* rgb,
+              int width,
+              int height,
+              ImageMode mode = ImageMode::HalfBlock);
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> row,
+                    int selected = 0);
 
 // -- Decorator ---
 Element bold(Element);
@@ -88,8 +175,18 @@ Element blink(Element);
 Element strikethrough(Element);
 Decorator color(Color);
 Decorator bgcolor(Color);
+Element style(Element, const Style&);
+Decorator style(const Style&);
 Element color(Color, Element);
 Element bgcolor(Color, Element);
+Decorator linearGradient(float angle, Color from, Color to);
+Decorator bgLinearGradient(float angle, Color from, Color to);
+Element linearGradient(float angle, Color from, Color to, Element);
+Element bgLinearGradient(float angle, Color from, Color to, Element);
+Decorator radialGradient(Color center, Color edge);
+Decorator bgRadialGradient(Color center, Color edge);
+Element radialGradient(Color center, Color edge, Element);
+Element bgRadialGradient(Color center, Color edge, Element);
 Decorator focusPosition(int x, int y);
 Decorator focusPositionRelative(float x, float y);
 Element automerge(Element child);
@@ -101,6 +198,7 @@ Element vbox(Elements);
 Element dbox(Elements);
 Element flexbox(Elements, FlexboxConfig config = FlexboxConfig());
 Element gridbox(std::vector<Elements> lines);
+Element gridbox(std::vector<Elements> lines, std::vector<int> column_widths);
 
 Element hflow(Elements);  // Helper: default flexbox with row direction.
 Element vflow(Elements);  // Helper: default flexbox with column direction.
@@ -135,6 +233,8 @@ Decorator size(Direction, Constraint, int value);
 Element frame(Element);
 Element xframe(Element);
 Element yframe(Element);
+// Same as yframe, but scrolled to |offset| rows, controlled by the caller.
+Decorator scrollable(Ref<int> offset, int extent = -1);
 Element focus(Element);
 Element select(Element);
 
@@ -150,6 +250,11 @@ Element focusCursorUnderlineBlinking(Element);
 // --- Misc ---
 Element vscroll_indicator(Element);
 Decorator reflect(Box& box);
+Element retained(Element);
+Element shared(Element);
+Decorator retainedVersion(ConstRef<size_t> version);
+Decorator key(std::string);
+Decorator cached(std::string key);
 // Before drawing the |element| clear the pixel below. This is useful in
 // combinaison with dbox.
 Element clear_under(Element element);
@@ -163,6 +268,7 @@ Element nothing(Element element);
 
 namespace Dimension {
 Dimensions Fit(Element&);
+LayoutResult FitLayout(Element);
 }  // namespace Dimension
 
 }  // namespace ftxui
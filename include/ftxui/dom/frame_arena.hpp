@@ -0,0 +1,116 @@
+#ifndef FTXUI_DOM_FRAME_ARENA_HPP
+#define FTXUI_DOM_FRAME_ARENA_HPP
+
+#include <cstddef>  // for size_t, max_align_t
+#include <memory_resource>  // for memory_resource
+
+namespace ftxui {
+
+/// @brief A monotonic buffer the Elements are allocated from, instead of the
+/// heap, while it is active.
+///
+/// The arena hands out memory from large blocks. Elements destroyed before
+/// Reset() let the arena reuse its block for the next frame. Elements kept
+/// alive longer remain valid: their block is released when the last of them
+/// is destroyed.
+///
+/// The blocks come from the default memory resource, or from the one passed to
+/// the constructor. For instance, a std::pmr::monotonic_buffer_resource over a
+/// buffer reserved upfront keeps every Element of the frame out of the heap.
+/// The resource must outlive the Elements allocated from the arena.
+///
+/// ### Example
+///
+/// ```cpp
+/// FrameArena arena;
+/// while (running) {
+///   arena.Reset();
+///   FrameArena::Scope scope(&arena);
+///   Element document = BuildDocument();
+///   ...
+/// }
+/// ```
+///
+/// @ingroup dom
+class FrameArena {
+ public:
+  FrameArena();
+  explicit FrameArena(std::pmr::memory_resource* upstream);
+  ~FrameArena();
+  FrameArena(const FrameArena&) = delete;
+  FrameArena(FrameArena&&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+  FrameArena& operator=(FrameArena&&) = delete;
+
+  // Allocate from |arena| on the current thread, for the lifetime of the
+  // scope.
+  class Scope {
+   public:
+    explicit Scope(FrameArena* arena);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+
+   private:
+    FrameArena* previous_;
+  };
+
+  // Reuse the memory of the previous frame.
+  void Reset();
+
+  // The bytes of the block allocated from. The previous blocks are freed once
+  // their Elements are destroyed.
+  size_t MemoryUsage() const;
+
+  // The arena active on the current thread, or nullptr.
+  static FrameArena* Current();
+
+  void* Allocate(size_t size);
+  static void Deallocate(void* pointer);
+
+  // A standard allocator, for std::allocate_shared.
+  template <class T>
+  class Allocator {
+   public:
+    using value_type = T;
+    explicit Allocator(FrameArena* arena) : arena_(arena) {}
+    template <class U>
+    Allocator(const Allocator<U>& other)  // NOLINT
+        : arena_(other.arena()) {}
+
+    T* allocate(size_t n) {
+      static_assert(alignof(T) <= alignof(std::max_align_t),
+                    "Over-aligned types are not supported");
+      return static_cast<T*>(arena_->Allocate(n * sizeof(T)));
+    }
+    void deallocate(T* pointer, size_t /*n*/) { Deallocate(pointer); }
+
+    FrameArena* arena() const { return arena_; }
+    template <class U>
+    bool operator==(const Allocator<U>& other) const {
+      return arena_ == other.arena();
+    }
+    template <class U>
+    bool operator!=(const Allocator<U>& other) const {
+      return arena_ != other.arena();
+    }
+
+   private:
+    FrameArena* arena_;
+  };
+
+ private:
+  struct Block;
+  Block* block_ = nullptr;
+  std::pmr::memory_resource* upstream_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_FRAME_ARENA_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
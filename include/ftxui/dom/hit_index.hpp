@@ -0,0 +1,83 @@
+#ifndef FTXUI_DOM_HIT_INDEX_HPP
+#define FTXUI_DOM_HIT_INDEX_HPP
+
+#include <mutex>   // for mutex
+#include <vector>  // for vector
+
+#include "ftxui/screen/box.hpp"  // for Box
+
+namespace ftxui {
+
+/// @brief A grid of the boxes captured by reflect() while drawing a frame,
+/// telling in O(1) whether a cell is covered by any of them.
+///
+/// While a HitIndex::Scope is active, the reflect() elements drawn add their
+/// visible box to the index. The mouse events outside of every box can't hit
+/// any of the components relying on reflect().
+///
+/// ### Example
+///
+/// ```cpp
+/// HitIndex index;
+/// index.Reset(screen.dimx(), screen.dimy());
+/// {
+///   HitIndex::Scope scope(&index);
+///   Render(screen, document);
+/// }
+/// bool hit = index.Hit(mouse.x, mouse.y);
+/// ```
+///
+/// @ingroup dom
+class HitIndex {
+ public:
+  HitIndex() = default;
+  HitIndex(const HitIndex&) = delete;
+  HitIndex(HitIndex&&) = delete;
+  HitIndex& operator=(const HitIndex&) = delete;
+  HitIndex& operator=(HitIndex&&) = delete;
+
+  // Add the boxes drawn on the current thread to |index|, for the lifetime of
+  // the scope.
+  class Scope {
+   public:
+    explicit Scope(HitIndex* index);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+
+   private:
+    HitIndex* previous_;
+  };
+
+  // The index active on the current thread, or nullptr.
+  static HitIndex* Current();
+
+  // Remove every box, and cover a screen of |dimx| x |dimy| cells.
+  void Reset(int dimx, int dimy);
+
+  // Can be called from the threads drawing in parallel.
+  void Add(const Box& box);
+
+  // Whether the cell (x, y) is inside one of the boxes.
+  bool Hit(int x, int y) const;
+
+ private:
+  // The cells are grouped by buckets of kBucketX x kBucketY.
+  static constexpr int kBucketX = 16;
+  static constexpr int kBucketY = 4;
+
+  std::mutex mutex_;
+  int columns_ = 0;
+  int rows_ = 0;
+  std::vector<std::vector<Box>> buckets_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_HIT_INDEX_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,83 @@
+#ifndef FTXUI_DOM_KEY_CACHE_HPP
+#define FTXUI_DOM_KEY_CACHE_HPP
+
+#include <cstddef>        // for size_t
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+
+#include "ftxui/dom/node.hpp"  // for Element
+
+namespace ftxui {
+
+/// @brief Keep the elements decorated with key() from one frame to the next.
+///
+/// While a KeyCache::Scope is active, `element | key(k)` returns the element
+/// created with the same key during the previous frame, instead of |element|.
+/// The reused elements keep their layout: unchanged subtrees are neither
+/// computed again nor reallocated. The key must identify the content.
+///
+/// The elements whose key isn't used during a frame are released.
+///
+/// ### Example
+///
+/// ```cpp
+/// KeyCache cache;
+/// while (running) {
+///   Element document;
+///   {
+///     KeyCache::Scope scope(&cache);
+///     document = BuildDocument();
+///   }
+///   Render(screen, document);
+/// }
+/// ```
+///
+/// @ingroup dom
+class KeyCache {
+ public:
+  KeyCache() = default;
+  KeyCache(const KeyCache&) = delete;
+  KeyCache(KeyCache&&) = delete;
+  KeyCache& operator=(const KeyCache&) = delete;
+  KeyCache& operator=(KeyCache&&) = delete;
+
+  // Use |cache| on the current thread, for the lifetime of the scope. It
+  // delimits a frame.
+  class Scope {
+   public:
+    explicit Scope(KeyCache* cache);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+
+   private:
+    KeyCache* cache_;
+    KeyCache* previous_;
+  };
+
+  // The cache active on the current thread, or nullptr.
+  static KeyCache* Current();
+
+  // Return the element of the previous frame associated with |key|, or
+  // |element| if there was none.
+  Element Reconcile(const std::string& key, Element element);
+
+  // The number of elements kept.
+  size_t size() const { return previous_.size() + current_.size(); }
+
+ private:
+  void EndFrame();
+
+  std::unordered_map<std::string, Element> previous_;
+  std::unordered_map<std::string, Element> current_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_KEY_CACHE_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,109 @@
+#ifndef FTXUI_DOM_LAYOUT_POOL_HPP
+#define FTXUI_DOM_LAYOUT_POOL_HPP
+
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <cstdint>             // for uint64_t
+#include <functional>          // for function
+#include <mutex>               // for mutex
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+namespace ftxui {
+
+/// @brief A pool of threads laying out the independent children of the
+/// containers in parallel, while it is active.
+///
+/// hbox, vbox, dbox, gridbox and flexbox compute the requirement and the box
+/// of their children in parallel when at least two of them have
+/// `min_weight()` descendants or more. The children are still combined in
+/// order, by the calling thread, so the layout is identical to the serial one.
+/// Within a parallel child, the layout is serial.
+///
+/// With SetParallelRender(), the children whose boxes don't overlap are also
+/// drawn in parallel, into subscreens of their box, when at least two of them
+/// have `min_weight()` descendants or cover `64 * min_weight()` cells. When
+/// some boxes overlap, like in a dbox, the children are drawn serially.
+///
+/// The elements laid out in parallel must not be shared by several parents.
+///
+/// ### Example
+///
+/// ```cpp
+/// LayoutPool pool(3);
+/// ...
+/// LayoutPool::Scope scope(&pool);
+/// Render(screen, document);
+/// ```
+///
+/// @ingroup dom
+class LayoutPool {
+ public:
+  // |threads| is the number of threads added to the calling one.
+  explicit LayoutPool(int threads, size_t min_weight = 32);  // NOLINT
+  ~LayoutPool();
+  LayoutPool(const LayoutPool&) = delete;
+  LayoutPool(LayoutPool&&) = delete;
+  LayoutPool& operator=(const LayoutPool&) = delete;
+  LayoutPool& operator=(LayoutPool&&) = delete;
+
+  // Lay out in parallel with |pool| on the current thread, for the lifetime of
+  // the scope.
+  class Scope {
+   public:
+    explicit Scope(LayoutPool* pool);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+
+   private:
+    LayoutPool* previous_;
+  };
+
+  // The pool active on the current thread, or nullptr.
+  static LayoutPool* Current();
+
+  size_t min_weight() const { return min_weight_; }
+
+  // Whether the layout, and the drawing, use the pool. By default, only the
+  // layout does.
+  void SetParallelLayout(bool enable) { parallel_layout_ = enable; }
+  void SetParallelRender(bool enable) { parallel_render_ = enable; }
+  bool parallel_layout() const { return parallel_layout_; }
+  bool parallel_render() const { return parallel_render_; }
+
+  // Call |function| for every index in [0, count), from the threads of the
+  // pool and the calling one. Returns once every call returned. While the pool
+  // is busy, the other callers run serially.
+  void ParallelFor(size_t count, const std::function<void(size_t)>& function);
+
+ private:
+  void Work();
+  void Run();
+
+  const size_t min_weight_;
+  std::mutex busy_;
+  bool parallel_layout_ = true;
+  bool parallel_render_ = false;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  const std::function<void(size_t)>* function_ = nullptr;
+  size_t count_ = 0;
+  std::atomic<size_t> next_ = 0;
+  uint64_t job_ = 0;
+  int working_ = 0;
+  bool quit_ = false;
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_LAYOUT_POOL_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
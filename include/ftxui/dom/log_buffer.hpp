@@ -0,0 +1,63 @@
+#ifndef FTXUI_DOM_LOG_BUFFER_HPP
+#define FTXUI_DOM_LOG_BUFFER_HPP
+
+#include <cstddef>      // for size_t
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/screen/glyph.hpp"  // for Glyph
+
+namespace ftxui {
+
+/// @brief A bounded ring buffer of lines, drawn by logView().
+///
+/// The lines are segmented into the glyphs of their cells when they are
+/// appended, so drawing them only copies the visible ones. Once the buffer is
+/// full, every new line replaces the oldest one, reusing its memory.
+///
+/// The buffer must be modified from the thread drawing it. See LogAppender()
+/// to append lines from other threads.
+///
+/// ### Example
+///
+/// ```cpp
+/// LogBuffer logs(10000);
+/// logs.Append("Server started");
+/// ...
+/// Element document = logView(&logs) | border;
+/// ```
+///
+/// @ingroup dom
+class LogBuffer {
+ public:
+  LogBuffer() : LogBuffer(0) {}
+  explicit LogBuffer(size_t capacity);
+
+  // Append one line per '\n' separated part of |text|.
+  void Append(std::string_view text);
+  void Clear();
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return lines_.size(); }
+  // The number of lines appended since the construction. It never decreases.
+  size_t appended() const { return appended_; }
+
+  // The cells of the |index|-th oldest line. Fullwidth glyphs are followed by
+  // an empty cell.
+  const std::vector<Glyph>& operator[](size_t index) const;
+
+ private:
+  void AppendLine(std::string_view line);
+
+  std::vector<std::vector<Glyph>> lines_;
+  size_t size_ = 0;
+  size_t appended_ = 0;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_LOG_BUFFER_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
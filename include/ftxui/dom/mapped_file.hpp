@@ -0,0 +1,86 @@
+#ifndef FTXUI_DOM_MAPPED_FILE_HPP
+#define FTXUI_DOM_MAPPED_FILE_HPP
+
+#include <atomic>       // for atomic
+#include <cstddef>      // for size_t
+#include <functional>   // for function
+#include <mutex>        // for mutex
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <thread>       // for thread
+#include <vector>       // for vector
+
+namespace ftxui {
+
+/// @brief A read-only file mapped in memory, drawn by fileView().
+///
+/// The file is never copied: the lines are views into the mapping. Their
+/// offsets are indexed by a background thread, so the first lines can be shown
+/// before the whole file was read. Only the start of every 64th line is kept,
+/// so the index of a 2GB log takes a few MB.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// auto file = std::make_shared<MappedFile>("server.log", [&] {
+///   screen.PostEvent(Event::Custom);
+/// });
+/// auto renderer = Renderer([&] {
+///   return fileView(file) | focusPosition(0, scroll) | frame;
+/// });
+/// ```
+///
+/// @ingroup dom
+class MappedFile {
+ public:
+  // |on_progress| is called by the indexing thread, every time new lines are
+  // indexed.
+  explicit MappedFile(const std::string& path,
+                      std::function<void()> on_progress = nullptr);
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Whether the file could be opened and mapped.
+  bool is_open() const { return is_open_; }
+  std::string_view data() const { return {data_, size_}; }
+  size_t size() const { return size_; }
+
+  // The number of lines indexed so far. A final '\n' doesn't start a new line.
+  size_t line_count() const;
+  // Whether the whole file was indexed.
+  bool indexed() const { return indexed_; }
+  // Block until the whole file was indexed.
+  void WaitIndexed();
+  // The |index|-th line, without its '\n'. |index| must be lower than
+  // line_count().
+  std::string_view Line(size_t index) const;
+
+ private:
+  void Index();
+
+  bool is_open_ = false;
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+#if defined(_WIN32)
+  void* file_ = nullptr;
+  void* mapping_ = nullptr;
+#endif
+
+  std::function<void()> on_progress_;
+  mutable std::mutex mutex_;
+  std::vector<size_t> starts_;  // The start of every 64th line.
+  size_t lines_ = 0;
+  std::atomic<bool> indexed_ = false;
+  std::atomic<bool> quit_ = false;
+  std::thread thread_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_MAPPED_FILE_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,19 +1,40 @@
 #ifndef FTXUI_DOM_NODE_HPP
 #define FTXUI_DOM_NODE_HPP
 
-#include <memory>  // for shared_ptr
-#include <vector>  // for vector
+#include <chrono>   // for nanoseconds
+#include <cstddef>  // for max_align_t, size_t
+#include <cstdint>  // for uint32_t
+#include <memory>   // for shared_ptr, make_shared, allocate_shared
+#include <new>      // for operator new
+#include <span>     // for span
+#include <utility>  // for forward
+#include <vector>   // for vector
 
+#include "ftxui/dom/frame_arena.hpp"  // for FrameArena
+#include "ftxui/dom/node_ptr.hpp"     // for NodePtr
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"
 
+#if defined(FTXUI_PROFILE)
+#include <type_traits>  // for conditional_t, is_final_v
+#include <typeinfo>     // for typeid
+
+#include "ftxui/dom/profiler.hpp"  // for Profiler
+#endif
+
 namespace ftxui {
 
+class LayoutPool;
 class Node;
 class Screen;
+struct TreeReport;
 
+#if defined(FTXUI_INTRUSIVE_ELEMENT)
+using Element = NodePtr<Node>;
+#else
 using Element = std::shared_ptr<Node>;
+#endif
 using Elements = std::vector<Element>;
 
 class Node {
@@ -40,24 +61,239 @@ class Node {
   // Step 3: Draw this element.
   virtual void Render(Screen& screen);
 
+  // The part of the box fully overwritten by Render(), hiding what was drawn
+  // below it, like clear_under(). dbox doesn't draw the hidden parts of its
+  // lower layers. By default, the largest opaque box of the children, within
+  // this element's box. It is empty when x_min > x_max.
+  virtual Box OpaqueBox();
+
   // Layout may not resolve within a single iteration for some elements. This
   // allows them to request additionnal iterations. This signal must be
-  // forwarded to children at least once.
+  // forwarded to children at least once. Check() is called with iteration 0
+  // before the first iteration, and then after every iteration. Another
+  // iteration happens only when some node sets need_iteration.
   struct Status {
     int iteration = 0;
     bool need_iteration = false;
   };
   virtual void Check(Status* status);
 
+  // The bytes of memory held by this node, without its children: the object
+  // allocated by MakeNode(), and the memory it allocated, like its list of
+  // children. Override it to add the latter.
+  virtual size_t MemoryUsage() const;
+
  protected:
+  // Draw |child|, unless its box is entirely outside of the stencil, or hidden
+  // by an opaque layer drawn afterward.
+  static void RenderChild(Screen& screen, Node* child) {
+    const Box& box = child->box_;
+    const Box& stencil = screen.stencil;
+    if (box.x_min > stencil.x_max || box.x_max < stencil.x_min ||
+        box.y_min > stencil.y_max || box.y_max < stencil.y_min ||
+        Occluded(box)) {
+      return;
+    }
+    child->Render(screen);
+  }
+
+  // While a lower layer is drawn, the opaque boxes of the layers above it.
+  static void PushOccluder(const Box& box);
+  static void PopOccluder();
+  static bool Occluded(const Box& box);
+  // The occluders hiding some of |box|.
+  static std::vector<Box> Occluders(const Box& box);
+
+  // Whether the subtree contains a reflect(), whose box is only reported when
+  // drawn.
+  bool ContainsReflect();
+
+  // Draw the |index|-th child, like RenderChild(). A shared child is first
+  // moved to the box SetChildrenBox() stored for it.
+  void RenderChild(Screen& screen, size_t index);
+
+  // Call ComputeRequirement(), or SetBox(boxes[i]), on every child. Inside a
+  // LayoutPool::Scope, the large children are laid out in parallel. The
+  // requirement of a shared child is never computed again, and its box is
+  // stored by this node instead.
+  void ComputeChildrenRequirement();
+  void SetChildrenBox(std::span<const Box> boxes);
+  // Call SetBox(box) on the |index|-th child. The box of a shared child is
+  // stored for RenderChild() too.
+  void SetChildBox(size_t index, Box box);
+
   Elements children_;
   Requirement requirement_;
   Box box_;
+
+ private:
+  // The number of nodes of the subtree. Computed once.
+  size_t Weight();
+  LayoutPool* ParallelPool();
+  bool RenderInParallel(Screen& screen);
+  // Whether the subtree contains a shared element. Such subtrees are laid out
+  // and drawn from a single thread.
+  bool ContainsShared();
+
+  friend Element shared(Element element);
+  friend TreeReport DescribeTree(const Node& root, size_t largest);
+  friend class Reflect;
+
+  size_t weight_ = 0;
+  // The size of the object allocated by MakeNode().
+  uint32_t allocated_size_ = sizeof(Node);
+  bool shared_ = false;
+  bool contains_shared_ = false;
+  bool reflect_ = false;
+  bool contains_reflect_ = false;
+  // The boxes of the shared children, by index.
+  std::vector<Box> children_boxes_;
+
+#if defined(FTXUI_INTRUSIVE_ELEMENT)
+ private:
+  template <class T>
+  friend class NodePtr;
+  template <class T, class... Args>
+  friend NodePtr<T> MakeNode(Args&&... args);
+
+  void AddReference() { ++references_; }
+  void RemoveReference() {
+    if (--references_ == 0) {
+      Destroy();
+    }
+  }
+  void Destroy();
+
+  int references_ = 0;
+  bool from_arena_ = false;
+#else
+ private:
+  template <class T, class... Args>
+  friend std::shared_ptr<T> MakeNode(Args&&... args);
+#endif
 };
 
+#if defined(FTXUI_PROFILE)
+// A node of type T, measuring its calls for the active Profiler. Its
+// overrides of the Node methods must be public and not final.
+template <class T>
+class Profiled : public T {
+ public:
+  using T::T;
+
+  void ComputeRequirement() override {
+    const Profiler::Measure measure(Type(),
+                                    Profiler::Phase::ComputeRequirement);
+    T::ComputeRequirement();
+  }
+  void SetBox(Box box) override {
+    const Profiler::Measure measure(Type(), Profiler::Phase::SetBox);
+    T::SetBox(box);
+  }
+  void Render(Screen& screen) override {
+    const Profiler::Measure measure(Type(), Profiler::Phase::Render);
+    T::Render(screen);
+  }
+  void Check(Node::Status* status) override {
+    const Profiler::Measure measure(Type(), Profiler::Phase::Check);
+    T::Check(status);
+  }
+
+ private:
+  static size_t Type() {
+    static const size_t type = Profiler::RegisterType(typeid(T).name());
+    return type;
+  }
+};
+
+// The type allocated by MakeNode<T>.
+template <class T>
+using Allocated = std::conditional_t<std::is_final_v<T>, T, Profiled<T>>;
+#else
+template <class T>
+using Allocated = T;
+#endif
+
+// Allocate a Node. Inside a FrameArena::Scope, it is allocated from the arena
+// instead of the heap.
+#if defined(FTXUI_INTRUSIVE_ELEMENT)
+template <class T, class... Args>
+NodePtr<T> MakeNode(Args&&... args) {
+  using U = Allocated<T>;
+  if (FrameArena* arena = FrameArena::Current()) {
+    static_assert(alignof(U) <= alignof(std::max_align_t),
+                  "Over-aligned nodes are not supported");
+    U* node = new (arena->Allocate(sizeof(U))) U(std::forward<Args>(args)...);
+    static_cast<Node*>(node)->from_arena_ = true;
+    static_cast<Node*>(node)->allocated_size_ = sizeof(U);
+    return NodePtr<T>(node);
+  }
+  U* node = new U(std::forward<Args>(args)...);
+  static_cast<Node*>(node)->allocated_size_ = sizeof(U);
+  return NodePtr<T>(node);
+}
+#else
+template <class T, class... Args>
+std::shared_ptr<T> MakeNode(Args&&... args) {
+  using U = Allocated<T>;
+  std::shared_ptr<U> node;
+  if (FrameArena* arena = FrameArena::Current()) {
+    node = std::allocate_shared<U>(FrameArena::Allocator<U>(arena),
+                                   std::forward<Args>(args)...);
+  } else {
+    node = std::make_shared<U>(std::forward<Args>(args)...);
+  }
+  static_cast<Node*>(node.get())->allocated_size_ = sizeof(U);
+  return node;
+}
+#endif
+
 void Render(Screen& screen, const Element& element);
 void Render(Screen& screen, Node* node);
 
+// How long the steps of Render() took.
+struct RenderTimings {
+  std::chrono::nanoseconds layout{0};   // ComputeRequirement() and SetBox().
+  std::chrono::nanoseconds draw{0};     // Node::Render().
+  std::chrono::nanoseconds shaders{0};  // Screen::ApplyShader().
+};
+// Same as Render(), adding the time of every step to |timings|. With
+// |measured|, the requirement computed by Measure() is reused.
+void Render(Screen& screen,
+            Node* node,
+            RenderTimings* timings,
+            bool measured = false);
+
+// An element laid out into |box| by Layout(). Render(screen, layout) draws it
+// without laying it out again, when the screen matches |box|.
+struct LayoutResult {
+  Element element;
+  Box box;
+  int iterations = 0;  // The number of layout passes.
+
+  // The dimensions of the Screen matching |box|.
+  Dimensions dimensions() const {
+    return {box.x_max - box.x_min + 1, box.y_max - box.y_min + 1};
+  }
+};
+LayoutResult Layout(Element element, Box box);
+void Render(Screen& screen, const LayoutResult& layout);
+
+// Draw |element|, |width| columns wide and as tall as it requires, by tiles of
+// |tile_rows| rows drawn into the same Screen. Streams the same output as
+// ToString() of the whole document to |sink|. The memory used is bounded by the
+// tile, however tall the document is.
+void RenderTiled(Element element,
+                 int width,
+                 int tile_rows,
+                 const Screen::Sink& sink);
+
+// Compute the requirement of |node|, before Render(), e.g. to size the Screen.
+void Measure(Node* node);
+// Lay out |node| into |box|, iterating while some node requests it. Returns
+// the number of iterations.
+int ComputeLayout(Node* node, Box box, bool measured = false);
+
 }  // namespace ftxui
 
 #endif  // FTXUI_DOM_NODE_HPP
@@ -0,0 +1,92 @@
+#ifndef FTXUI_DOM_NODE_PTR_HPP
+#define FTXUI_DOM_NODE_PTR_HPP
+
+#include <cstddef>      // for nullptr_t
+#include <type_traits>  // for enable_if_t, is_convertible_v
+#include <utility>      // for exchange, swap
+
+namespace ftxui {
+
+/// @brief An owning pointer to a Node. The reference count is stored in the
+/// Node itself. This is the Element type, when FTXUI_INTRUSIVE_ELEMENT is
+/// defined.
+///
+/// Compared to std::shared_ptr, there is no separate control block, and the
+/// reference count isn't atomic. The Elements must not be shared across
+/// threads.
+///
+/// @ingroup dom
+template <class T>
+class NodePtr {
+ public:
+  using element_type = T;
+
+  NodePtr() = default;
+  NodePtr(std::nullptr_t) {}  // NOLINT
+  explicit NodePtr(T* pointer) : pointer_(pointer) { Acquire(); }
+
+  NodePtr(const NodePtr& other) : pointer_(other.pointer_) { Acquire(); }
+  NodePtr(NodePtr&& other) noexcept
+      : pointer_(std::exchange(other.pointer_, nullptr)) {}
+
+  template <class U, class = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+  NodePtr(const NodePtr<U>& other)  // NOLINT
+      : pointer_(other.get()) {
+    Acquire();
+  }
+  template <class U, class = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+  NodePtr(NodePtr<U>&& other) noexcept  // NOLINT
+      : pointer_(other.release()) {}
+
+  ~NodePtr() { Release(); }
+
+  NodePtr& operator=(NodePtr other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  void reset() { NodePtr().swap(*this); }
+  void swap(NodePtr& other) noexcept { std::swap(pointer_, other.pointer_); }
+
+  // Give up the ownership, without decrementing the reference count.
+  T* release() { return std::exchange(pointer_, nullptr); }
+
+  T* get() const { return pointer_; }
+  long use_count() const { return pointer_ ? pointer_->references_ : 0; }
+  T& operator*() const { return *pointer_; }
+  T* operator->() const { return pointer_; }
+  explicit operator bool() const { return pointer_ != nullptr; }
+
+  template <class U>
+  bool operator==(const NodePtr<U>& other) const {
+    return pointer_ == other.get();
+  }
+  template <class U>
+  bool operator!=(const NodePtr<U>& other) const {
+    return pointer_ != other.get();
+  }
+  bool operator==(std::nullptr_t) const { return pointer_ == nullptr; }
+  bool operator!=(std::nullptr_t) const { return pointer_ != nullptr; }
+
+ private:
+  void Acquire() {
+    if (pointer_) {
+      pointer_->AddReference();
+    }
+  }
+  void Release() {
+    if (pointer_) {
+      pointer_->RemoveReference();
+    }
+  }
+
+  T* pointer_ = nullptr;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_NODE_PTR_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
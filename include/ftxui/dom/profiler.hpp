@@ -0,0 +1,153 @@
+#ifndef FTXUI_DOM_PROFILER_HPP
+#define FTXUI_DOM_PROFILER_HPP
+
+#include <array>    // for array
+#include <chrono>   // for nanoseconds, steady_clock
+#include <cstddef>  // for size_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+namespace ftxui {
+
+class Node;
+
+/// @brief What a Profiler measured, for every type of node.
+/// @ingroup dom
+struct ProfileReport {
+  enum class Phase { ComputeRequirement, SetBox, Render, Check };
+  static constexpr size_t kPhases = 4;
+
+  struct Entry {
+    std::string name;
+    // Indexed by Phase. The time of a node excludes the time of its children.
+    std::array<int, kPhases> count = {};
+    std::array<std::chrono::nanoseconds, kPhases> time = {};
+
+    int calls() const;
+    std::chrono::nanoseconds total() const;
+  };
+
+  // Sorted by decreasing total time.
+  std::vector<Entry> entries;
+  // The number of iterations of the layout.
+  int iterations = 0;
+
+  std::chrono::nanoseconds total() const;
+};
+
+/// @brief Measure how many times, and for how long, every type of node is laid
+/// out and drawn, while it is active.
+///
+/// The nodes are only measured when FTXUI is built with the `FTXUI_PROFILE`
+/// CMake option. Otherwise, the reports are empty. Only the calling thread is
+/// measured: the work done by the threads of a LayoutPool is counted in the
+/// time of the node waiting for them.
+///
+/// ### Example
+///
+/// ```cpp
+/// Profiler profiler;
+/// {
+///   Profiler::Scope scope(&profiler);
+///   Render(screen, document);
+/// }
+/// ProfileReport report = profiler.TakeReport();
+/// ```
+///
+/// @ingroup dom
+class Profiler {
+ public:
+  using Phase = ProfileReport::Phase;
+
+  // Whether FTXUI was built with FTXUI_PROFILE.
+  static bool Enabled();
+
+  // Measure with |profiler| on the current thread, for the lifetime of the
+  // scope.
+  class Scope {
+   public:
+    explicit Scope(Profiler* profiler);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+
+   private:
+    Profiler* previous_;
+  };
+
+  // The profiler active on the current thread, or nullptr.
+  static Profiler* Current();
+
+  // What was measured since the previous call.
+  ProfileReport TakeReport();
+
+  // Used by the nodes. Measure one call of |phase| on a node of type |type|,
+  // for the lifetime of the object.
+  class Measure {
+   public:
+    Measure(size_t type, Phase phase);
+    ~Measure();
+    Measure(const Measure&) = delete;
+    Measure(Measure&&) = delete;
+    Measure& operator=(const Measure&) = delete;
+    Measure& operator=(Measure&&) = delete;
+
+   private:
+    Profiler* profiler_;
+    size_t type_ = 0;
+    Phase phase_ = Phase::Render;
+    Measure* parent_ = nullptr;
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::nanoseconds children_ = {};
+  };
+
+  // The identifier of a type of node, from its std::type_info::name().
+  static size_t RegisterType(const char* name);
+  void AddIteration() { iterations_++; }
+
+ private:
+  std::vector<ProfileReport::Entry> entries_;
+  int iterations_ = 0;
+  Measure* active_ = nullptr;
+};
+
+/// @brief The shape of a tree of nodes: how many nodes of every type it has,
+/// the memory they hold, how deep it is, and its largest subtrees. See
+/// DescribeTree().
+/// @ingroup dom
+struct TreeReport {
+  struct Type {
+    std::string name;
+    size_t count = 0;
+    size_t bytes = 0;  // Held by the nodes of this type. See MemoryUsage().
+  };
+  struct Subtree {
+    // The types of the nodes from the root, with the index of every child,
+    // like "VBox > HBox[2] > Border".
+    std::string path;
+    size_t nodes = 0;
+    int depth = 0;  // The longest path from the root of the subtree.
+  };
+
+  size_t nodes = 0;
+  int depth = 0;  // The number of nodes of the longest path from the root.
+  size_t bytes = 0;  // Held by every node.
+  // Sorted by decreasing count.
+  std::vector<Type> types;
+  // Sorted by decreasing number of nodes.
+  std::vector<Subtree> largest;
+};
+
+// Count the nodes of |root|, with the memory they hold, and find its |largest|
+// biggest subtrees.
+TreeReport DescribeTree(const Node& root, size_t largest = 5);  // NOLINT
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_PROFILER_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
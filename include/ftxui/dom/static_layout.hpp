@@ -0,0 +1,146 @@
+#ifndef FTXUI_DOM_STATIC_LAYOUT_HPP
+#define FTXUI_DOM_STATIC_LAYOUT_HPP
+
+#include <algorithm>  // for min
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <iterator>   // for make_move_iterator
+#include <span>       // for span
+
+#include "ftxui/dom/elements.hpp"  // for Element
+
+namespace ftxui {
+
+/// @brief The slots of staticHBox() and staticVBox().
+namespace slot {
+
+// A slot of |N| cells.
+template <int N>
+struct Fixed {
+  static_assert(N >= 0);
+  static constexpr int size = N;
+  static constexpr int flex = 0;
+};
+
+// A slot sharing the remaining cells with the other Flex slots, in proportion
+// to |N|.
+template <int N = 1>
+struct Flex {
+  static_assert(N > 0);
+  static constexpr int size = 0;
+  static constexpr int flex = N;
+};
+
+}  // namespace slot
+
+/// @brief The slots of a static layout, and their totals.
+/// @ingroup dom
+struct StaticLayout {
+  struct Slot {
+    int size = 0;
+    int flex = 0;
+  };
+  std::span<const Slot> slots;
+  int size = 0;  // The sum of the fixed sizes.
+  int flex = 0;  // The sum of the flex factors.
+
+  // The size of every slot, sharing |cells|. The Flex slots share what the
+  // Fixed ones leave. When too small, the last slots are truncated.
+  constexpr void Distribute(int cells, std::span<int> sizes) const {
+    const int remaining = cells - size;
+    int flex_before = 0;
+    for (size_t i = 0; i < slots.size(); ++i) {
+      int slot_size = slots[i].size;
+      if (slots[i].flex != 0 && remaining > 0) {
+        slot_size += remaining * (flex_before + slots[i].flex) / flex -
+                     remaining * flex_before / flex;
+        flex_before += slots[i].flex;
+      }
+      sizes[i] = std::min(slot_size, cells);
+      cells -= sizes[i];
+    }
+  }
+};
+
+namespace static_layout_internal {
+
+template <class... Slots>
+struct Table {
+  static constexpr std::array<StaticLayout::Slot, sizeof...(Slots)> slots = {
+      StaticLayout::Slot{Slots::size, Slots::flex}...};
+  static constexpr StaticLayout layout = {
+      slots,
+      (Slots::size + ... + 0),
+      (Slots::flex + ... + 0),
+  };
+};
+
+Element StaticHBox(const StaticLayout& layout, Elements children);
+Element StaticVBox(const StaticLayout& layout, Elements children);
+
+}  // namespace static_layout_internal
+
+/// @brief The sizes of the slots of a static layout, sharing |size| cells.
+/// Usable in constant expressions.
+template <class... Slots>
+constexpr std::array<int, sizeof...(Slots)> StaticSizes(int size) {
+  std::array<int, sizeof...(Slots)> sizes = {};
+  static_layout_internal::Table<Slots...>::layout.Distribute(size, sizes);
+  return sizes;
+}
+
+/// @brief A container displaying one element per slot, horizontally. The
+/// width of the slots is known at compile time: Fixed<N> slots are N cells
+/// wide, and Flex<N> slots share the remaining width. Unlike hbox(), the
+/// requirements of the children are not used to compute their width.
+/// @param children One element per slot.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// using namespace ftxui::slot;
+/// staticHBox<Fixed<20>, Flex<>, Fixed<30>>({
+///     text(name),
+///     text(description),
+///     text(status),
+/// });
+/// ```
+template <class... Slots>
+Element staticHBox(std::array<Element, sizeof...(Slots)> children) {
+  return static_layout_internal::StaticHBox(
+      static_layout_internal::Table<Slots...>::layout,
+      Elements(std::make_move_iterator(children.begin()),
+               std::make_move_iterator(children.end())));
+}
+
+/// @brief A container displaying one element per slot, vertically. The
+/// height of the slots is known at compile time. See staticHBox().
+/// @param children One element per slot.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// using namespace ftxui::slot;
+/// staticVBox<Fixed<1>, Flex<>, Fixed<1>>({
+///     header,
+///     body,
+///     footer,
+/// });
+/// ```
+template <class... Slots>
+Element staticVBox(std::array<Element, sizeof...(Slots)> children) {
+  return static_layout_internal::StaticVBox(
+      static_layout_internal::Table<Slots...>::layout,
+      Elements(std::make_move_iterator(children.begin()),
+               std::make_move_iterator(children.end())));
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_STATIC_LAYOUT_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,36 @@
+#ifndef FTXUI_DOM_STYLE_HPP
+#define FTXUI_DOM_STYLE_HPP
+
+#include <optional>  // for optional
+
+#include "ftxui/screen/color.hpp"  // for Color
+
+namespace ftxui {
+
+/// @brief A set of text attributes, applied at once by the style() decorator.
+/// style(s) is equivalent to stacking the corresponding decorators, like
+/// bold | dim | color(c), but the pixels are visited only once.
+/// @ingroup dom
+struct Style {
+  bool blink = false;
+  bool bold = false;
+  bool dim = false;
+  bool inverted = false;  ///< Toggles the inversion, like `inverted`.
+  bool underlined = false;
+  bool underlined_double = false;
+  bool strikethrough = false;
+  std::optional<Color> foreground_color;  ///< Unchanged when empty.
+  std::optional<Color> background_color;  ///< Unchanged when empty.
+
+  // Add the attributes of a style applied around this one. The attributes
+  // drawn before the child, like the colors, are overridden by this one.
+  void Wrap(const Style& outer);
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_STYLE_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,11 +1,19 @@
 #ifndef FTXUI_DOM_TABLE
 #define FTXUI_DOM_TABLE
 
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t
+#include <functional>   // for function
 #include <memory>
-#include <string>  // for string
-#include <vector>  // for vector
+#include <optional>     // for optional
+#include <span>         // for span
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for pair
+#include <vector>       // for vector
 
 #include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT, Decorator
+#include "ftxui/dom/style.hpp"     // for Style
 
 namespace ftxui {
 
@@ -27,9 +35,30 @@ namespace ftxui {
 // table.SelectRow(1).SeparatorInternal(Light);
 //
 // std::move(table).Element();
+//
+// Styling:
+// --------
+//
+// The Decorate*() functions taking a Style record the attributes of every
+// cell selected, instead of wrapping it into a new Element. The records are
+// merged, and applied once per cell by Render(), around the decorators.
+//
+// Style stripe;
+// stripe.background_color = Color::GrayDark;
+// table.SelectAll().DecorateCellsAlternateRow(stripe);
 
+class ColumnarTable;
 class Table;
 class TableSelection;
+class VirtualTable;
+class VirtualTableSelection;
+
+// Where the cells narrower than their column are drawn.
+enum class TableAlign {
+  Left,
+  Center,
+  Right,
+};
 
 class Table {
  public:
@@ -50,8 +79,13 @@ class Table {
 
  private:
   void Initialize(std::vector<std::vector<Element>>);
+  void AddStyle(int x, int y, const Style& style);
+  void ApplyStyles();
   friend TableSelection;
+  friend VirtualTable;
   std::vector<std::vector<Element>> elements_;
+  // The Style recorded for the elements, row by row. Empty until one is.
+  std::vector<std::optional<Style>> styles_;
   int input_dim_x_ = 0;
   int input_dim_y_ = 0;
   int dim_x_ = 0;
@@ -68,6 +102,15 @@ class TableSelection {
   void DecorateCellsAlternateColumn(Decorator, int modulo = 2, int shift = 0);
   void DecorateCellsAlternateRow(Decorator, int modulo = 2, int shift = 0);
 
+  // Same, recording the attributes of the elements instead of wrapping them.
+  void Decorate(const Style&);
+  void DecorateAlternateRow(const Style&, int modulo = 2, int shift = 0);
+  void DecorateAlternateColumn(const Style&, int modulo = 2, int shift = 0);
+
+  void DecorateCells(const Style&);
+  void DecorateCellsAlternateColumn(const Style&, int modulo = 2, int shift = 0);
+  void DecorateCellsAlternateRow(const Style&, int modulo = 2, int shift = 0);
+
   void Border(BorderStyle border = LIGHT);
   void BorderLeft(BorderStyle border = LIGHT);
   void BorderRight(BorderStyle border = LIGHT);
@@ -79,7 +122,29 @@ class TableSelection {
   void SeparatorHorizontal(BorderStyle border = LIGHT);
 
  private:
+  // The elements the Decorate*() functions apply to.
+  enum class Target {
+    All,
+    AlternateRow,
+    AlternateColumn,
+    Cells,
+    CellsAlternateColumn,
+    CellsAlternateRow,
+  };
+  void ForEach(int x_min,
+               int x_max,
+               int y_min,
+               int y_max,
+               const std::function<void(int, int, Element&)>& f);
+  void ForEachTarget(Target target,
+                     int modulo,
+                     int shift,
+                     const std::function<void(int, int, Element&)>& f);
+  void Decorate(Target target, int modulo, int shift, const Decorator&);
+  void Decorate(Target target, int modulo, int shift, const Style&);
+
   friend Table;
+  friend VirtualTable;
   Table* table_;
   int x_min_;
   int x_max_;
@@ -87,6 +152,173 @@ class TableSelection {
   int y_max_;
 };
 
+// A Table whose rows are provided on demand, for a large number of rows. Only
+// the rows visible are created and drawn. Every row is one line tall. The
+// columns have a fixed width: the one set with SetColumnWidth(), or else the
+// widest cell among the first rows.
+//
+// The styling is recorded, and applied to the visible rows on every frame. The
+// decorators must not change the size of the cells.
+//
+// Usage:
+//
+// auto table = VirtualTable(500'000, 3, [&](int row) {
+//   return std::vector<std::string>{
+//       results[row].id,
+//       results[row].name,
+//       results[row].value,
+//   };
+// });
+// table.SelectAll().Border(LIGHT);
+// table.SelectRow(0).BorderBottom(LIGHT);
+// table.SelectRow(selected).Decorate(inverted);
+//
+// auto document = table.Render(selected) | vscroll_indicator | yframe;
+class VirtualTable {
+ public:
+  using RowProvider = std::function<std::vector<std::string>(int row)>;
+
+  VirtualTable(int rows, int columns, RowProvider row);
+  void SetColumnWidth(int column, int width);
+  void SetColumnAlignment(int column, TableAlign align);
+
+  VirtualTableSelection SelectAll();
+  VirtualTableSelection SelectCell(int column, int row);
+  VirtualTableSelection SelectRow(int row_index);
+  VirtualTableSelection SelectRows(int row_min, int row_max);
+  VirtualTableSelection SelectColumn(int column_index);
+  VirtualTableSelection SelectColumns(int column_min, int column_max);
+  VirtualTableSelection SelectRectangle(int column_min,
+                                        int column_max,
+                                        int row_min,
+                                        int row_max);
+  Element Render(int selected = 0);
+
+ private:
+  class Rows;
+  friend VirtualTableSelection;
+
+  struct Operation {
+    int x_min;
+    int x_max;
+    int y_min;
+    int y_max;
+    std::function<void(TableSelection&, int first_row)> apply;
+  };
+
+  int LinesBefore(int y) const;
+  bool IsSeparatorLine(int y) const;
+  Element RenderRows(int first, int last) const;
+
+  int rows_;
+  int columns_;
+  RowProvider row_;
+  std::vector<int> widths_;
+  std::vector<TableAlign> alignments_;
+  std::vector<bool> separator_columns_;
+  std::vector<std::pair<int, int>> separator_lines_;
+  std::vector<Operation> operations_;
+};
+
+// A VirtualTable built from typed columns, instead of rows of strings. The
+// values aren't converted upfront: they are formatted when their row is drawn.
+// The first row holds the headers, so the value |i| of a column is in the row
+// |i + 1|. The columns shorter than the others end with empty cells.
+//
+// The values are viewed, not copied. They must outlive the table.
+//
+// Usage:
+//
+// auto table = ColumnarTable()
+//                  .Column("Symbol", std::span<const std::string_view>(names))
+//                  .Column("Volume", std::span<const int64_t>(volumes))
+//                  .Column("Price", std::span<const double>(prices),
+//                          [](double price) { return FormatPrice(price); })
+//                  .Build();
+// table.SelectAll().Border(LIGHT);
+// table.SelectRow(0).BorderBottom(LIGHT);
+//
+// auto document = table.Render(selected) | vscroll_indicator | yframe;
+class ColumnarTable {
+ public:
+  // Formats the value of a visible cell.
+  template <class T>
+  using Formatter = std::function<std::string(T value)>;
+
+  // Without a formatter, the numbers are written in their shortest form.
+  ColumnarTable& Column(std::string header,
+                        std::span<const double> values,
+                        Formatter<double> format = {},
+                        TableAlign align = TableAlign::Right);
+  ColumnarTable& Column(std::string header,
+                        std::span<const int64_t> values,
+                        Formatter<int64_t> format = {},
+                        TableAlign align = TableAlign::Right);
+  ColumnarTable& Column(std::string header,
+                        std::span<const std::string_view> values,
+                        Formatter<std::string_view> format = {},
+                        TableAlign align = TableAlign::Left);
+
+  VirtualTable Build() const;
+
+ private:
+  struct Entry {
+    std::string header;
+    int size;
+    TableAlign align;
+    // Formats the value |i| of the column.
+    std::function<std::string(int i)> cell;
+  };
+  ColumnarTable& Add(std::string header,
+                     size_t size,
+                     TableAlign align,
+                     std::function<std::string(int i)> cell);
+
+  std::vector<Entry> columns_;
+  int rows_ = 0;
+};
+
+class VirtualTableSelection {
+ public:
+  void Decorate(Decorator);
+  void DecorateAlternateRow(Decorator, int modulo = 2, int shift = 0);
+  void DecorateAlternateColumn(Decorator, int modulo = 2, int shift = 0);
+
+  void DecorateCells(Decorator);
+  void DecorateCellsAlternateColumn(Decorator, int modulo = 2, int shift = 0);
+  void DecorateCellsAlternateRow(Decorator, int modulo = 2, int shift = 0);
+
+  void Decorate(const Style&);
+  void DecorateAlternateRow(const Style&, int modulo = 2, int shift = 0);
+  void DecorateAlternateColumn(const Style&, int modulo = 2, int shift = 0);
+
+  void DecorateCells(const Style&);
+  void DecorateCellsAlternateColumn(const Style&, int modulo = 2, int shift = 0);
+  void DecorateCellsAlternateRow(const Style&, int modulo = 2, int shift = 0);
+
+  void Border(BorderStyle border = LIGHT);
+  void BorderLeft(BorderStyle border = LIGHT);
+  void BorderRight(BorderStyle border = LIGHT);
+  void BorderTop(BorderStyle border = LIGHT);
+  void BorderBottom(BorderStyle border = LIGHT);
+
+  void Separator(BorderStyle border = LIGHT);
+  void SeparatorVertical(BorderStyle border = LIGHT);
+  void SeparatorHorizontal(BorderStyle border = LIGHT);
+
+ private:
+  void Record(std::function<void(TableSelection&, int first_row)> apply);
+  void MarkColumns(int x_min, int x_max);
+  void MarkLines(int y_min, int y_max);
+
+  friend VirtualTable;
+  VirtualTable* table_;
+  int x_min_;
+  int x_max_;
+  int y_min_;
+  int y_max_;
+};
+
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_DOM_TABLE */
@@ -2,36 +2,57 @@
 #define FTXUI_DOM_TAKE_ANY_ARGS_HPP
 
 // IWYU pragma: private, include "ftxui/dom/elements.hpp"
-#include <type_traits>
+#include <cstddef>      // for size_t
+#include <iterator>     // for make_move_iterator
+#include <type_traits>  // for is_same_v, remove_cvref_t
+#include <utility>      // for forward
 
 namespace ftxui {
 
+// The number of children |arg| contributes to unpack().
 template <class T>
-void Merge(Elements& /*container*/, T /*element*/) {}
-
-template <>
-inline void Merge(Elements& container, Element element) {
-  container.push_back(std::move(element));
+size_t MergeSize(const T& arg) {
+  using U = std::remove_cvref_t<T>;
+  if constexpr (std::is_same_v<U, Element>) {
+    return 1;
+  } else if constexpr (std::is_same_v<U, Elements>) {
+    return arg.size();
+  } else {
+    return 0;
+  }
 }
 
-template <>
-inline void Merge(Elements& container, Elements elements) {
-  for (auto& element : elements)
-    container.push_back(std::move(element));
+// Append the children of |arg| to |container|. The rvalues are moved. The
+// arguments other than Element and Elements are ignored.
+template <class T>
+void Merge(Elements& container, T&& arg) {
+  using U = std::remove_cvref_t<T>;
+  if constexpr (std::is_same_v<U, Element>) {
+    container.push_back(std::forward<T>(arg));
+  } else if constexpr (std::is_same_v<U, Elements>) {
+    if constexpr (std::is_lvalue_reference_v<T> ||
+                  std::is_const_v<std::remove_reference_t<T>>) {
+      container.insert(container.end(), arg.begin(), arg.end());
+    } else {
+      container.insert(container.end(), std::make_move_iterator(arg.begin()),
+                       std::make_move_iterator(arg.end()));
+    }
+  }
 }
 
-// Turn a set of arguments into a vector.
+// Turn a set of arguments into a vector, allocated once.
 template <class... Args>
-Elements unpack(Args... args) {
-  std::vector<Element> vec;
-  (Merge(vec, std::move(args)), ...);
-  return vec;
+Elements unpack(Args&&... args) {
+  Elements elements;
+  elements.reserve((MergeSize(args) + ... + size_t(0)));
+  (Merge(elements, std::forward<Args>(args)), ...);
+  return elements;
 }
 
 // Make |container| able to take any number of argments.
 #define TAKE_ANY_ARGS(container)                               \
   template <class... Args>                                     \
-  Element container(Args... children) {                        \
+  Element container(Args&&... children) {                      \
     return container(unpack(std::forward<Args>(children)...)); \
   }
 
@@ -0,0 +1,87 @@
+#ifndef FTXUI_DOM_TEXT_DOCUMENT_HPP
+#define FTXUI_DOM_TEXT_DOCUMENT_HPP
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace ftxui {
+
+/// @brief A large text, drawn by textDocument().
+///
+/// The text is stored in blocks of about 64KB, each holding whole lines, and
+/// the start of every line is indexed. Appending never moves the previous
+/// blocks, and drawing only reads the visible lines.
+///
+/// When wrapped, the number of rows of every line is first estimated from its
+/// width. It is computed exactly once the line is drawn, and kept while the
+/// width doesn't change.
+///
+/// ### Example
+///
+/// ```cpp
+/// TextDocument document(ReadFile("query_plan.txt"));
+/// Element element = textDocument(&document) | frame | vscroll_indicator;
+/// ```
+///
+/// @ingroup dom
+class TextDocument {
+ public:
+  TextDocument();
+  explicit TextDocument(std::string_view text);
+
+  void Append(std::string_view text);
+  void Clear();
+
+  // The number of lines. A final '\n' doesn't start a new line.
+  size_t line_count() const;
+  std::string_view Line(size_t index) const;
+  // The number of cells taken by the longest line.
+  int max_width() const { return max_width_; }
+
+ private:
+  friend class TextDocumentNode;
+
+  struct LineRef {
+    uint32_t block = 0;
+    uint32_t begin = 0;
+    uint32_t end = 0;
+    int width = 0;
+  };
+  void AppendToLine(std::string_view text);
+  bool IsSameLine(const LineRef& a, const LineRef& b) const {
+    return a.block == b.block && a.begin == b.begin && a.end == b.end;
+  }
+
+  // The rows of the lines, when wrapped at |width|.
+  void Wrap(int width) const;
+  int Rows() const { return wrap_total_; }
+  // The line containing |row|, and the rows of the lines before it.
+  size_t LineAtRow(int row, int* line_row) const;
+  // Compute the rows of |line| exactly.
+  void Refine(size_t line) const;
+  void SetRows(size_t line, int rows) const;
+  int RowsBefore(size_t line) const;
+
+  std::vector<std::string> blocks_;
+  std::vector<LineRef> lines_;  // The last one is still open.
+  int max_width_ = 0;
+
+  // The rows of every line, and a Fenwick tree of them.
+  mutable int wrap_width_ = 0;
+  mutable int wrap_total_ = 0;
+  mutable std::vector<int> wrap_rows_;
+  mutable std::vector<bool> wrap_exact_;
+  mutable std::vector<int> wrap_tree_;
+  mutable LineRef wrap_last_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_TEXT_DOCUMENT_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
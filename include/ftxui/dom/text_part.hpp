@@ -0,0 +1,52 @@
+#ifndef FTXUI_DOM_TEXT_PART_HPP
+#define FTXUI_DOM_TEXT_PART_HPP
+
+#include <cstdint>      // for int64_t, uint64_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <type_traits>  // for enable_if_t, is_integral_v, is_same_v, is_signed_v
+
+namespace ftxui {
+
+// The integer types displayed as numbers. bool and char are excluded.
+template <class T>
+constexpr bool kIsNumber = std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                           !std::is_same_v<T, char>;
+
+/// @brief A string or a number, concatenated by textf(). The numbers are
+/// formatted with std::to_chars, without allocating. The doubles use the
+/// shortest representation, unless a precision is given, e.g. {value, 2}.
+/// @ingroup dom
+struct TextPart {
+  enum class Type { String, Signed, Unsigned, Double };
+
+  TextPart(std::string_view value) : text(value) {}   // NOLINT
+  TextPart(const char* value) : text(value) {}        // NOLINT
+  TextPart(const std::string& value) : text(value) {}  // NOLINT
+  template <class T, class = std::enable_if_t<kIsNumber<T>>>
+  TextPart(T value)  // NOLINT
+      : type(std::is_signed_v<T> ? Type::Signed : Type::Unsigned) {
+    if constexpr (std::is_signed_v<T>) {
+      signed_value = value;
+    } else {
+      unsigned_value = value;
+    }
+  }
+  TextPart(double value, int digits = -1)  // NOLINT
+      : type(Type::Double), double_value(value), precision(digits) {}
+
+  Type type = Type::String;
+  std::string_view text;
+  int64_t signed_value = 0;
+  uint64_t unsigned_value = 0;
+  double double_value = 0.0;
+  int precision = -1;  // The digits after the point. -1 for the shortest.
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_TEXT_PART_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
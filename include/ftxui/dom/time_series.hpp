@@ -0,0 +1,106 @@
+#ifndef FTXUI_DOM_TIME_SERIES_HPP
+#define FTXUI_DOM_TIME_SERIES_HPP
+
+#include <cstddef>  // for size_t
+#include <deque>    // for deque
+#include <vector>   // for vector
+
+#include "ftxui/dom/canvas.hpp"    // for Canvas
+#include "ftxui/screen/color.hpp"  // for Color
+
+namespace ftxui {
+
+/// @brief A ring buffer of samples, drawn as a line chart.
+///
+/// The samples are reduced to one bucket per column of braille dots. Every
+/// bucket keeps the minimum and the maximum of its samples, so spikes remain
+/// visible however many samples share a column. The buckets are aligned on
+/// the samples, so only the partial ones, at both ends, are computed again
+/// after a sample is pushed.
+///
+/// ### Example
+///
+/// ```cpp
+/// TimeSeries latency(10000);
+/// latency.Push(12.f);
+/// ...
+/// Element document = timeSeries(&latency) | color(Color::Red);
+/// ```
+///
+/// @ingroup dom
+class TimeSeries {
+ public:
+  TimeSeries() : TimeSeries(0) {}
+  explicit TimeSeries(size_t capacity);
+
+  // Append a sample. The oldest one is removed when the buffer is full.
+  void Push(float value);
+  void Clear();
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return samples_.size(); }
+  // The |index|-th oldest sample.
+  float operator[](size_t index) const;
+
+  // Display the values in [min, max], instead of the range of the samples.
+  void SetRange(float min, float max);
+  // The range given to SetRange(), or else the minimum and the maximum of the
+  // samples. The latter are maintained by Push(), without scanning the buffer.
+  float min() const;
+  float max() const;
+
+  struct Bucket {
+    float min = 0.f;
+    float max = 0.f;
+    float first = 0.f;
+    float last = 0.f;
+  };
+  // Reduce the samples to at most |count| buckets, from the oldest one.
+  const std::vector<Bucket>& Decimate(int count) const;
+
+  void Draw(Canvas& canvas) const;
+  void Draw(Canvas& canvas, const Color& color) const;
+
+ private:
+  Bucket Compute(size_t begin, size_t end) const;
+  template <class Plot>
+  void DrawWith(const Canvas& canvas, const Plot& plot) const;
+
+  std::vector<float> samples_;
+  size_t size_ = 0;
+  size_t pushed_ = 0;  // The number of samples pushed since Clear().
+
+  bool fixed_range_ = false;
+  float min_ = 0.f;
+  float max_ = 0.f;
+
+  // The samples, counted since Clear(), which are the minimum, respectively the
+  // maximum, of the ones pushed after them. The first one is the minimum,
+  // respectively the maximum, of the buffer.
+  std::deque<size_t> minima_;
+  std::deque<size_t> maxima_;
+
+  // The complete buckets, reused from one Decimate() to the next.
+  mutable size_t bucket_size_ = 0;
+  mutable size_t first_bucket_ = 0;
+  mutable std::deque<Bucket> complete_;
+  mutable std::vector<Bucket> buckets_;
+};
+
+/// @brief The options of sparkline().
+/// @ingroup dom
+struct SparklineOption {
+  enum Style {
+    Blocks,   ///< One sample per column, as a bar of block characters.
+    Braille,  ///< Two samples per column, as a line of braille dots.
+  };
+  Style style = Blocks;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_TIME_SERIES_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
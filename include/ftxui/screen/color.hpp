@@ -2,6 +2,7 @@
 #define FTXUI_SCREEN_COLOR_HPP
 
 #include <cstdint>  // for uint8_t
+#include <span>     // for span
 #include <string>   // for wstring
 
 #ifdef RGB
@@ -28,6 +29,7 @@ class Color {
   static Color RGB(uint8_t red, uint8_t green, uint8_t blue);
   static Color HSV(uint8_t hue, uint8_t saturation, uint8_t value);
   static Color Interpolate(float t, const Color& a, const Color& b);
+  static void Gradient(const Color& a, const Color& b, std::span<Color> stops);
 
   //---------------------------
   // List of colors:
@@ -301,12 +303,27 @@ class Color {
   // clang-format on
 
   // --- Operators ------
-  bool operator==(const Color& rhs) const;
-  bool operator!=(const Color& rhs) const;
+  bool operator==(const Color& rhs) const { return Pack() == rhs.Pack(); }
+  bool operator!=(const Color& rhs) const { return Pack() != rhs.Pack(); }
+
+  // --- Packed representation ------
+  // The color as a single 32 bits integer. Two colors are equal if and only if
+  // their packed values are. This allows comparing and hashing them using
+  // integer operations.
+  uint32_t Pack() const {
+    return uint32_t(type_) |         //
+           uint32_t(red_) << 8U |     // NOLINT
+           uint32_t(green_) << 16U |  // NOLINT
+           uint32_t(blue_) << 24U;    // NOLINT
+  }
+  static Color Unpack(uint32_t packed);
 
   std::string Print(bool is_background_color) const;
+  void Print(std::string& out, bool is_background_color) const;
 
  private:
+  void GetRGB(uint8_t* red, uint8_t* green, uint8_t* blue) const;
+
   enum class ColorType : uint8_t {
     Palette1,
     Palette16,
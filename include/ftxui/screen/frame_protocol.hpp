@@ -0,0 +1,168 @@
+#ifndef FTXUI_SCREEN_FRAME_PROTOCOL_HPP
+#define FTXUI_SCREEN_FRAME_PROTOCOL_HPP
+
+#include <chrono>         // for milliseconds
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t, uint64_t
+#include <iosfwd>         // for ostream
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+#include "ftxui/screen/glyph.hpp"   // for Glyph
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+
+namespace ftxui {
+
+/// @brief Encode the frames of a Screen into a compact binary protocol, for a
+/// thin client drawing the cells itself, instead of a terminal emulator. Only
+/// the runs of cells that changed since the previous frame are sent. The
+/// glyphs and the styles are sent once, and then referenced by their index.
+///
+/// Every frame is a message:
+///
+/// ```
+/// message := varint(size) kind [dimx dimy] glyphs styles runs cursor
+/// kind    := u8: 0 for a key frame, 1 for a delta.
+///            A key frame clears the screen and both tables, and is followed
+///            by varint(dimx) varint(dimy).
+/// glyphs  := varint(count) count * (varint(length) utf8)
+///            Appended to the glyph table.
+/// styles  := varint(count) count * (u8(attributes) color(fg) color(bg))
+///            Appended to the style table. attributes: bit 0 blink, 1 bold,
+///            2 dim, 3 inverted, 4 underlined, 5 underlined double,
+///            6 strikethrough.
+/// color   := u8(0)                  the default color
+///          | u8(1) u8(index)        a 16 colors palette index
+///          | u8(2) u8(index)        a 256 colors palette index
+///          | u8(3) u8(r) u8(g) u8(b)
+/// runs    := varint(count) count * (varint(y) varint(x) varint(length)
+///                                   length * (varint(glyph) varint(style)))
+/// cursor  := varint(x) varint(y) u8(shape)
+/// ```
+///
+/// The varints are unsigned LEB128. Both tables start empty after a key frame.
+/// examples/frame_decoder.js is a reference decoder for a web client.
+///
+/// @ingroup screen
+class FrameEncoder {
+ public:
+  // Append the message updating a client displaying the previous frame, to
+  // display |screen|.
+  void Encode(const Screen& screen, std::string& out);
+  // Start over with a key frame, like for a new client.
+  void Reset();
+
+  // The number of messages encoded, and how many were key frames.
+  size_t frames() const { return frames_; }
+  size_t key_frames() const { return key_frames_; }
+
+ private:
+  // The style of a pixel, as a key of |styles_|.
+  struct Style {
+    uint64_t colors = 0;
+    uint32_t attributes = 0;
+    bool operator==(const Style& other) const = default;
+  };
+  struct StyleHash {
+    size_t operator()(const Style& style) const;
+  };
+  struct GlyphHash {
+    size_t operator()(const Glyph& glyph) const;
+  };
+
+  uint32_t GlyphId(const Glyph& glyph, std::string& definitions);
+  uint32_t StyleId(const Pixel& pixel, std::string& definitions);
+
+  std::unordered_map<Glyph, uint32_t, GlyphHash> glyphs_;
+  std::unordered_map<Style, uint32_t, StyleHash> styles_;
+  size_t glyph_count_ = 0;
+  size_t style_count_ = 0;
+
+  // The frame displayed by the client.
+  int dimx_ = -1;
+  int dimy_ = -1;
+  std::vector<Pixel> previous_;
+
+  // Reused from one frame to the next.
+  std::string new_glyphs_;
+  std::string new_styles_;
+  std::string runs_;
+
+  size_t frames_ = 0;
+  size_t key_frames_ = 0;
+};
+
+/// @brief Decode the messages of a FrameEncoder, into a Screen. The reference
+/// decoder in C++, for the native clients and the tests.
+/// @ingroup screen
+class FrameDecoder {
+ public:
+  // Decode the next message of |input|, and remove it. Returns false when
+  // |input| doesn't contain a whole message yet, or a malformed one.
+  bool Decode(std::string_view& input);
+
+  const Screen& screen() const { return screen_; }
+
+ private:
+  Screen screen_{0, 0};
+  std::vector<Glyph> glyphs_;
+  std::vector<Pixel> styles_;
+};
+
+/// @brief Append the frames of a Screen to a recording, e.g. a file. Only the
+/// cells that changed since the previous frame are stored, using a
+/// FrameEncoder. FrameReader plays it back.
+///
+/// ```
+/// recording := "FTXR" u8(version = 1) record*
+/// record    := varint(time) message
+/// ```
+///
+/// |time| is the number of milliseconds since the previous record, and
+/// |message| a FrameEncoder message. The first one is a key frame.
+///
+/// @ingroup screen
+class FrameRecorder {
+ public:
+  explicit FrameRecorder(std::ostream& out);
+
+  // Append |screen|, displayed |elapsed| after the previous frame.
+  void Record(const Screen& screen, std::chrono::milliseconds elapsed);
+
+ private:
+  std::ostream& out_;
+  FrameEncoder encoder_;
+  std::string buffer_;
+};
+
+/// @brief Play back a recording written by a FrameRecorder.
+/// @ingroup screen
+class FrameReader {
+ public:
+  // Returns false when |recording| doesn't start with the expected header.
+  bool Open(std::string recording);
+
+  // Decode the next frame. Returns false at the end of the recording, or when
+  // it is truncated or malformed.
+  bool Next();
+
+  // The current frame, and the time it was displayed since the first one.
+  const Screen& screen() const { return decoder_.screen(); }
+  std::chrono::milliseconds time() const { return time_; }
+
+ private:
+  std::string recording_;
+  std::string_view remaining_;
+  FrameDecoder decoder_;
+  std::chrono::milliseconds time_{0};
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_FRAME_PROTOCOL_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,87 @@
+#ifndef FTXUI_SCREEN_GLYPH_HPP
+#define FTXUI_SCREEN_GLYPH_HPP
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t
+#include <cstring>      // for memcmp
+#include <iosfwd>       // for ostream
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+namespace ftxui {
+
+/// @brief The UTF8 encoded grapheme displayed by a single cell.
+///
+/// Most graphemes are only a few bytes long. They are stored inline, without
+/// any allocation. The longer ones are interned into a global table and only
+/// their index is stored. As a result, a Glyph is small, trivially copyable and
+/// comparing two of them is cheap.
+///
+/// It converts implicitly from and to std::string, and supports the common
+/// string operations, for compatibility with the code using
+/// `Pixel::character` and `Screen::at()` as a string. Binding them to a
+/// `std::string&` is no longer possible.
+/// @ingroup screen
+class Glyph {
+ public:
+  Glyph() = default;
+  Glyph(const char* value);         // NOLINT
+  Glyph(const std::string& value);  // NOLINT
+  Glyph(std::string_view value);    // NOLINT
+
+  // A glyph taking a single cell, built at compile time. For the tables of
+  // characters drawn by the elements, like the borders. It must fit inline.
+  static consteval Glyph Narrow(std::string_view value) {
+    Glyph glyph;
+    for (size_t i = 0; i < value.size(); ++i) {
+      glyph.data_[i] = value[i];  // NOLINT
+    }
+    glyph.size_ = static_cast<uint8_t>(value.size());
+    return glyph;
+  }
+
+  // Access the UTF8 encoded grapheme:
+  std::string_view view() const;
+  operator std::string() const;  // NOLINT
+  size_t size() const;
+  size_t length() const { return size(); }
+  // The number of cells the grapheme takes, as computed by string_width().
+  int width() const;
+  // Whether the grapheme takes two cells. This is computed once, when the glyph
+  // is assigned.
+  bool fullwidth() const { return fullwidth_; }
+  bool empty() const { return size_ == 0; }
+  // The bytes held by the graphemes too long to be stored inline. They are
+  // interned once, and shared by every Glyph, for the lifetime of the program.
+  static size_t InternedMemoryUsage();
+  char operator[](size_t index) const { return view()[index]; }
+  // Append to the grapheme, for instance a combining character.
+  Glyph& operator+=(std::string_view value);
+
+  bool operator==(const Glyph& other) const {
+    return std::memcmp(this, &other, sizeof(Glyph)) == 0;
+  }
+  bool operator!=(const Glyph& other) const { return !operator==(other); }
+
+ private:
+  void Assign(std::string_view value);
+
+  static constexpr size_t kInlineCapacity = 15;
+  static constexpr uint8_t kInterned = 0x7F;
+
+  // Either the grapheme, or the index of its interned copy when |size_| is
+  // kInterned. The unused bytes are always zero.
+  char data_[kInlineCapacity] = {};  // NOLINT
+  uint8_t size_ : 7 = 0;
+  bool fullwidth_ : 1 = false;
+};
+
+std::ostream& operator<<(std::ostream& out, const Glyph& glyph);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_GLYPH_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
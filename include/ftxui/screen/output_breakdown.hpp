@@ -0,0 +1,46 @@
+#ifndef FTXUI_SCREEN_OUTPUT_BREAKDOWN_HPP
+#define FTXUI_SCREEN_OUTPUT_BREAKDOWN_HPP
+
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <string_view>  // for string_view
+
+namespace ftxui {
+
+/// @brief The bytes sent toward a terminal, by kind. It tells which of the
+/// glyphs, the styles or the cursor movements dominate the output, and hence
+/// whether the damage tracking, or the run length output, are worth enabling.
+///
+/// ### Example
+///
+/// ```cpp
+/// OutputBreakdown breakdown;
+/// breakdown.Add(screen.ToString());
+/// ```
+///
+/// @ingroup screen
+struct OutputBreakdown {
+  size_t glyphs = 0;  // The characters drawn.
+  size_t style = 0;   // The SGR sequences, setting the colors and attributes.
+  size_t motion = 0;  // The cursor movements, including the new lines.
+  size_t other = 0;   // Erasing, repeating, scrolling, modes, reports...
+
+  // How many times every SGR parameter was sent, like 1 for bold, or 38 for a
+  // foreground color. The components of the colors aren't counted.
+  static constexpr size_t kSgrParameters = 108;
+  std::array<size_t, kSgrParameters> sgr_parameters = {};
+
+  size_t total() const { return glyphs + style + motion + other; }
+
+  // Classify the bytes of |output|. The escape sequences must not be split
+  // across two calls.
+  void Add(std::string_view output);
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_OUTPUT_BREAKDOWN_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,12 +1,20 @@
 #ifndef FTXUI_SCREEN_SCREEN_HPP
 #define FTXUI_SCREEN_SCREEN_HPP
 
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint32_t, uint64_t
+#include <cstdio>      // for FILE
+#include <functional>  // for function
 #include <memory>
+#include <memory_resource>  // for memory_resource, vector
+#include <span>    // for span
 #include <string>  // for string, allocator, basic_string
+#include <string_view>  // for string_view
 #include <vector>  // for vector
 
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/color.hpp"     // for Color, Color::Default
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/terminal.hpp"  // for Dimensions
 
 namespace ftxui {
@@ -18,7 +26,7 @@ struct Pixel {
 
   // The graphemes stored into the pixel. To support combining characters,
   // like: a⃦, this can potentially contains multiple codepoitns.
-  std::string character = " ";
+  Glyph character = " ";
 
   // Colors:
   Color background_color = Color::Default;
@@ -32,6 +40,8 @@ struct Pixel {
   bool underlined : 1;
   bool underlined_double : 1;
   bool strikethrough : 1;
+  // Merge the box drawing character with its neighbors, in ApplyShader(). The
+  // area of the pixels must be declared with Screen::AddAutoMergeRegion().
   bool automerge : 1;
 
   Pixel()
@@ -53,32 +63,143 @@ Dimensions Full();
 }  // namespace Dimension
 
 /// @brief A rectangular grid of Pixel.
+///
+/// Distinct screens can be rendered into and printed from several threads at
+/// once, each thread using its own Screen and Elements. The state shared by
+/// all of them, like the detected terminal capabilities, is synchronized.
 /// @ingroup screen
 class Screen {
  public:
   // Constructors:
   Screen(int dimx, int dimy);
+  // The pixels are allocated from |resource|, which must outlive the screen.
+  Screen(int dimx, int dimy, std::pmr::memory_resource* resource);
   static Screen Create(Dimensions dimension);
   static Screen Create(Dimensions width, Dimensions height);
 
-  // Node write into the screen using Screen::at.
-  std::string& at(int x, int y);
+  // Node write into the screen using Screen::at. The Glyph is used like a
+  // std::string, but can't be bound to a std::string&.
+  Glyph& at(int x, int y);
   Pixel& PixelAt(int x, int y);
 
+  // Access a whole line of pixels. They are stored contiguously.
+  std::span<Pixel> Row(int y);
+  std::span<const Pixel> Row(int y) const;
+
+  // Write a rectangle of pixels, clipped by the stencil. The clipping is done
+  // once, and the rows are written contiguously.
+  // Set every pixel of |box| to |pixel|.
+  void FillRect(Box box, const Pixel& pixel);
+  // Copy |pixels|, holding the pixels of |box| line after line, into |box|.
+  void BlitRect(Box box, std::span<const Pixel> pixels);
+
   // Convert the screen into a printable string in the terminal.
   std::string ToString();
+  void ToString(std::string& out);
+  // The text only, without any style nor escape sequence. For logs, the
+  // clipboard, or golden tests.
+  std::string ToPlainText() const;
+  void ToPlainText(std::string& out) const;
   void Print();
 
+  // Write ToString() to |fd|, or to |file|, without any trailing character.
+  // The output is buffered, and written at once when it fits in the buffer.
+  void Print(int fd);
+  void Print(std::FILE* file);
+  // Stream ToString() to |sink|, in chunks of about |buffer_size| bytes,
+  // encoded row after row. The whole output is never held in memory.
+  using Sink = std::function<void(std::string_view chunk)>;
+  void Print(const Sink& sink, size_t buffer_size = 1 << 16);  // NOLINT
+
+  // Let ToString() use "erase in line" for the trailing blanks, and REP for the
+  // runs of an identical character. Disabled by default.
+  void SetRunLengthOutput(bool erase_line, bool repeat);
+
+  // Call |task(i)| for every i in [0, count), possibly from several threads,
+  // and return once every call returned.
+  using ParallelFor = std::function<void(size_t count,
+                                         const std::function<void(size_t)>& task)>;
+  // Let ToString() encode bands of rows in parallel with |parallel_for|, when
+  // the screen has |min_cells| cells or more. Disabled by default.
+  void SetParallelOutput(ParallelFor parallel_for,
+                         size_t min_cells = 400 * 120);  // NOLINT
+
+  // Convert the screen into a string updating a terminal currently displaying
+  // |previous|. Only the cells that changed are emitted. The cursor must be at
+  // the top-left corner, and is left where ToString() would have left it.
+  std::string ToStringDiff(const Screen& previous);
+  void ToStringDiff(const Screen& previous, std::string& out);
+
+  // Same, but the bands of rows that moved vertically are scrolled by the
+  // terminal, using a scroll region. |top| is the terminal row displaying the
+  // first row of this screen.
+  void ToStringScrollDiff(const Screen& previous, int top, std::string& out);
+
+  // Same, but detect the changes line by line, using the hashes of the rows of
+  // the previous frame. The changed rows are entirely rewritten. |hashes|
+  // receives the hashes of the rows of this screen.
+  void ToStringRowDiff(const std::vector<uint64_t>& previous_hashes,
+                       std::vector<uint64_t>& hashes,
+                       std::string& out);
+
+  // A hash of the content of the row |y|.
+  uint64_t RowHash(int y) const;
+
+  // Encode the screen into a compact binary snapshot, independent of the
+  // terminal, e.g. for golden files: a FrameEncoder key frame. Deserialize()
+  // returns false when |data| isn't a snapshot.
+  std::string Serialize();
+  static bool Deserialize(std::string_view data, Screen& screen);
+
   // Get screen dimensions.
   int dimx() const { return dimx_; }
   int dimy() const { return dimy_; }
 
+  // The bytes of memory held by the screen, besides the object itself.
+  size_t MemoryUsage() const;
+
   // Move the terminal cursor n-lines up with n = dimy().
   std::string ResetPosition(bool clear = false) const;
 
   // Fill with space.
   void Clear();
 
+  // Exchange the pixels with |other|, after resizing it to the same dimensions.
+  // This is O(1). For double buffering: render into the back buffer, compare it
+  // with the front buffer, swap them, and clear the new back buffer.
+  void SwapPixels(Screen& other);
+
+  // The attributes applied by a style span. The flags are added to the pixels,
+  // |inverted| toggles their inversion, and the colors replace theirs when
+  // set.
+  struct SpanStyle {
+    bool blink = false;
+    bool bold = false;
+    bool dim = false;
+    bool inverted = false;
+    bool underlined = false;
+    bool underlined_double = false;
+    bool strikethrough = false;
+    bool set_foreground = false;
+    bool set_background = false;
+    Color foreground_color;
+    Color background_color;
+  };
+  // Register a style for AddStyleSpan(). Its id is valid until ApplyShader().
+  int AddSpanStyle(const SpanStyle& style);
+  // Apply the style |style_id| to the columns [x_min, x_max] of the row |y|,
+  // clipped by the stencil. The pixels are updated lazily, in order: when the
+  // row is accessed next, or by ApplyShader(). A span covering the same
+  // columns as the previous one of its row is merged into it.
+  void AddStyleSpan(int y, int x_min, int x_max, int style_id);
+  // Apply |style| to every pixel of |box|, using one span per row.
+  void ApplyStyleRect(Box box, const SpanStyle& style);
+
+  // Nodes setting `automerge` on some pixels must declare the area containing
+  // them. Once some area is declared, the shader only processes the declared
+  // areas: the undeclared pixels aren't merged anymore. Only a screen without
+  // any declared area is entirely processed.
+  void AddAutoMergeRegion(Box box);
   void ApplyShader();
 
   struct Cursor {
@@ -97,15 +218,80 @@ class Screen {
     Shape shape;
   };
   Cursor cursor() const { return cursor_; }
-  void SetCursor(Cursor cursor) { cursor_ = cursor; }
+  void SetCursor(Cursor cursor) {
+    cursor_ = cursor;
+    cursor_set_ = true;
+  }
+
+  // A Screen drawing into the pixels of this one, within |box|. The subscreens
+  // of disjoint boxes can be drawn into from several threads. They only
+  // support drawing. Merge them back in order with MergeSubscreen(), once
+  // drawn.
+  Screen Subscreen(Box box);
+  void MergeSubscreen(const Screen& subscreen);
 
   Box stencil;
 
  protected:
   int dimx_;
   int dimy_;
-  std::vector<std::vector<Pixel>> pixels_;
+  // The pixels, stored line after line. See Row(y).
+  std::pmr::vector<Pixel> pixels_;
   Cursor cursor_;
+
+  // Change the dimensions. Every pixels are cleared.
+  void Resize(int dimx, int dimy);
+
+ private:
+  // Clear() is O(1). It starts a new generation. The rows whose generation is
+  // older are considered blank, and are reset lazily the first time they are
+  // written again.
+  bool IsBlankRow(int y) const { return row_generation_[y] != generation_; }
+  Pixel* WritableRow(int y);
+  std::pmr::vector<uint32_t> row_generation_;
+  uint32_t generation_ = 0;
+  std::pmr::vector<Pixel> blank_row_;  // |dimx_| default pixels.
+
+  // Append the update from |previous|, of the same dimensions, into this.
+  void AppendDiff(const Screen& previous, int top, std::string& out) const;
+  void AppendRow(int y, Pixel& previous_pixel, std::string& out) const;
+  bool erase_line_ = false;
+  bool repeat_ = false;
+
+  // The size of the previous output of ToString(), used to reserve the memory
+  // of the next one upfront.
+  size_t output_size_hint_ = 0;
+
+  // See SetParallelOutput(). The buffers of the bands are reused.
+  void AppendBand(int y_min, int y_max, std::string& out) const;
+  ParallelFor parallel_for_;
+  size_t parallel_min_cells_ = 0;
+  std::vector<std::string> bands_;
+
+  // See AddStyleSpan(). The spans not applied yet, per row, in order.
+  struct StyleSpan {
+    int x_min = 0;
+    int x_max = 0;
+    int style = 0;
+  };
+  void ResolveStyleSpans();
+  void ResolveStyleSpans(int y);
+  int ComposeSpanStyles(int first, int second);
+  std::vector<SpanStyle> span_styles_;
+  std::vector<std::vector<StyleSpan>> row_spans_;
+  std::vector<int> rows_with_spans_;
+  // The last call to ComposeSpanStyles(), reused by the next rows.
+  int composed_first_ = -1;
+  int composed_second_ = -1;
+  int composed_result_ = -1;
+
+  // The areas containing pixels with `automerge` set. See AddAutoMergeRegion().
+  std::vector<Box> automerge_regions_;
+
+  // See Subscreen(). The pixels are the ones of |target_|, when set.
+  Screen(Screen* target, Box clip);
+  Screen* target_ = nullptr;
+  bool cursor_set_ = false;
 };
 
 }  // namespace ftxui
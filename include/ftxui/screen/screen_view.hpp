@@ -0,0 +1,69 @@
+#ifndef FTXUI_SCREEN_SCREEN_VIEW_HPP
+#define FTXUI_SCREEN_SCREEN_VIEW_HPP
+
+#include <span>  // for span
+
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Pixel, Screen
+
+namespace ftxui {
+
+/// @brief A rectangular region of a Screen, addressed with local coordinates.
+///
+/// A view doesn't own any pixel: it refers to the pixels of its Screen. The
+/// writes outside of its clip area are discarded. Views are cheap to copy, and
+/// can be narrowed further using View(), to render a child into a region
+/// without allocating another Screen.
+///
+/// @ingroup screen
+class ScreenView {
+ public:
+  // The whole |screen|, clipped by its stencil.
+  explicit ScreenView(Screen& screen);
+  // The region |box| of |screen|, clipped by its stencil.
+  ScreenView(Screen& screen, Box box);
+
+  // The region |box|, in the coordinates of this view, clipped by this view.
+  ScreenView View(Box box) const;
+
+  // Dimensions of the region, including its clipped part.
+  int dimx() const { return dimx_; }
+  int dimy() const { return dimy_; }
+
+  // The visible part of the region, in local coordinates. It is empty
+  // (x_min > x_max or y_min > y_max) when nothing is visible.
+  Box clip() const { return clip_; }
+  bool Visible(int x, int y) const { return clip_.Contain(x, y); }
+
+  // The position of the region in the Screen.
+  int origin_x() const { return origin_x_; }
+  int origin_y() const { return origin_y_; }
+
+  // Access a pixel. Outside of the clip area, a dummy pixel is returned.
+  Pixel& PixelAt(int x, int y);
+
+  // The visible pixels of the line |y|, from clip().x_min to clip().x_max.
+  // Empty when the line isn't visible.
+  std::span<Pixel> Row(int y);
+
+  Screen& screen() const { return *screen_; }
+
+ private:
+  ScreenView(Screen* screen, int origin_x, int origin_y, int dimx, int dimy,
+             Box clip);
+
+  Screen* screen_;
+  int origin_x_ = 0;
+  int origin_y_ = 0;
+  int dimx_ = 0;
+  int dimy_ = 0;
+  Box clip_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_SCREEN_VIEW_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,20 +1,85 @@
 #ifndef FTXUI_SCREEN_STRING_HPP
 #define FTXUI_SCREEN_STRING_HPP
 
-#include <stddef.h>  // for size_t
-#include <string>    // for string, wstring, to_string
-#include <vector>    // for vector
+#include <stddef.h>     // for size_t, ptrdiff_t
+#include <iterator>     // for forward_iterator_tag
+#include <span>         // for span
+#include <string>       // for string, wstring, to_string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 namespace ftxui {
 std::string to_string(const std::wstring& s);
 std::wstring to_wstring(const std::string& s);
 
+// Convert into a caller provided buffer, without allocating. Return the number
+// of elements written. |out| is always large enough with 4 * s.size() char, or
+// s.size() wchar_t.
+size_t to_string(std::wstring_view s, std::span<char> out);
+size_t to_wstring(std::string_view s, std::span<wchar_t> out);
+
 template <typename T>
 std::wstring to_wstring(T s) {
   return to_wstring(std::to_string(s));
 }
 
-int string_width(const std::string&);
+int string_width(std::string_view);
+
+// A glyph of a UTF8 string, viewed inside the original buffer, with the number
+// of cells it takes: 1, or 2 for fullwidth glyphs.
+struct GlyphView {
+  std::string_view text;
+  int width = 1;
+};
+
+// Iterate over the glyphs of a UTF8 string, without copying it. Invalid and
+// control characters are skipped. A glyph is an extended grapheme cluster, as
+// defined by UAX#29: the combining characters, the emoji ZWJ sequences, the
+// flags and the Hangul syllables are a single glyph.
+class GlyphIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = GlyphView;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const GlyphView*;
+  using reference = const GlyphView&;
+
+  GlyphIterator() = default;
+  GlyphIterator(std::string_view input, size_t start);
+
+  reference operator*() const { return glyph_; }
+  pointer operator->() const { return &glyph_; }
+  GlyphIterator& operator++();
+  GlyphIterator operator++(int);
+
+  bool operator==(const GlyphIterator& other) const {
+    return start_ == other.start_;
+  }
+  bool operator!=(const GlyphIterator& other) const {
+    return start_ != other.start_;
+  }
+
+ private:
+  std::string_view input_;
+  size_t start_ = 0;
+  GlyphView glyph_;
+};
+
+// The glyphs of a UTF8 string, for use in a range-based for loop. |input| must
+// outlive the range.
+class GlyphRange {
+ public:
+  explicit GlyphRange(std::string_view input) : input_(input) {}
+  GlyphIterator begin() const { return {input_, 0}; }
+  GlyphIterator end() const { return {input_, input_.size()}; }
+
+ private:
+  std::string_view input_;
+};
+inline GlyphRange Glyphs(std::string_view input) {
+  return GlyphRange(input);
+}
+
 // Split the string into a its glyphs. An empty one is inserted ater fullwidth
 // ones.
 std::vector<std::string> Utf8ToGlyphs(const std::string& input);
@@ -50,6 +115,8 @@ enum class WordBreakProperty {
 };
 std::vector<WordBreakProperty> Utf8ToWordBreakProperty(
     const std::string& input);
+// The word break property of a single glyph, as given by Glyphs().
+WordBreakProperty GlyphWordBreakProperty(std::string_view glyph);
 
 bool IsWordBreakingCharacter(const std::string& input, size_t glyph_index);
 
@@ -1,6 +1,8 @@
 #ifndef FTXUI_SCREEN_TERMINAL_HPP
 #define FTXUI_SCREEN_TERMINAL_HPP
 
+#include <string>  // for string
+
 namespace ftxui {
 struct Dimensions {
   int dimx;
@@ -11,6 +13,10 @@ namespace Terminal {
 Dimensions Size();
 void SetFallbackSize(const Dimensions& fallbackSize);
 
+// Same as Size(), cached until the terminal is resized.
+Dimensions CachedSize();
+void InvalidateSize();
+
 enum Color {
   Palette1,
   Palette16,
@@ -20,6 +26,34 @@ enum Color {
 Color ColorSupport();
 void SetColorSupport(Color color);
 
+bool RepeatSupport();
+void SetRepeatSupport(bool supported);
+
+// Whether NO_COLOR is set: the colors are omitted, but not the other
+// attributes. Palette1 omits every attribute.
+bool NoColor();
+void SetNoColor(bool no_color);
+
+// What the terminal supports. Guessed from the environment variables, until
+// a ScreenInteractive probes the terminal. See
+// ScreenInteractive::ProbeTerminal().
+struct Capabilities {
+  bool probed = false;               // Whether the terminal was probed.
+  bool repeat = false;               // REP, repeating the previous character.
+  bool synchronized_update = false;  // DEC private mode 2026.
+  bool scroll_region = true;         // DECSTBM.
+  bool true_color = false;           // 24 bits colors.
+  bool bracketed_paste = false;      // DEC private mode 2004.
+  int device_type = -1;              // The first parameter of the DA2 reply.
+  std::string version;               // The XTVERSION reply, like "XTerm(390)".
+};
+// The capabilities of the terminal named by $TERM.
+Capabilities GetCapabilities();
+// Record the capabilities probed for the terminal named by $TERM. They are
+// kept for the next screens, and override RepeatSupport() and ColorSupport(),
+// unless the colors are disabled.
+void SetCapabilities(const Capabilities& capabilities);
+
 }  // namespace Terminal
 
 }  // namespace ftxui
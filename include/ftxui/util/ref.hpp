@@ -1,11 +1,38 @@
 #ifndef FTXUI_UTIL_REF_HPP
 #define FTXUI_UTIL_REF_HPP
 
+#include <cstddef>  // for size_t
 #include <ftxui/screen/string.hpp>
 #include <string>
+#include <string_view>  // for string_view
+#include <type_traits>  // for enable_if_t, is_same_v, void_t
+#include <utility>      // for declval
+#include <vector>       // for vector
 
 namespace ftxui {
 
+namespace ref_internal {
+
+// An object notified of the accesses to the T it holds, like an Observable<T>.
+// Get() reads it, and Access() may modify it.
+template <typename O, typename T>
+using IfReadable =
+    std::enable_if_t<std::is_same_v<decltype(std::declval<const O&>().Get()),
+                                    const T&>>;
+template <typename O, typename T>
+using IfAccessible =
+    std::enable_if_t<std::is_same_v<decltype(std::declval<O&>().Access()), T&>>;
+
+// Whether the observed object has a version, incremented when it changes.
+template <typename O, typename = void>
+constexpr bool kHasVersion = false;
+template <typename O>
+constexpr bool kHasVersion<
+    O,
+    std::void_t<decltype(size_t(std::declval<const O&>().version()))>> = true;
+
+}  // namespace ref_internal
+
 /// @brief An adapter. Own or reference an immutable object.
 template <typename T>
 class ConstRef {
@@ -13,13 +40,24 @@ class ConstRef {
   ConstRef() {}
   ConstRef(T t) : owned_(t) {}
   ConstRef(const T* t) : address_(t) {}
-  const T& operator*() const { return address_ ? *address_ : owned_; }
-  const T& operator()() const { return address_ ? *address_ : owned_; }
-  const T* operator->() const { return address_ ? address_ : &owned_; }
+  template <typename O, typename = ref_internal::IfReadable<O, T>>
+  ConstRef(const O* observed)
+      : observed_(observed), get_([](const void* o) -> const T& {
+          return static_cast<const O*>(o)->Get();
+        }) {}
+  const T& operator*() const { return get(); }
+  const T& operator()() const { return get(); }
+  const T* operator->() const { return &get(); }
 
  private:
+  const T& get() const {
+    return get_ ? get_(observed_) : address_ ? *address_ : owned_;
+  }
+
   T owned_;
   const T* address_ = nullptr;
+  const void* observed_ = nullptr;
+  const T& (*get_)(const void*) = nullptr;
 };
 
 /// @brief An adapter. Own or reference an mutable object.
@@ -30,13 +68,22 @@ class Ref {
   Ref(const T& t) : owned_(t) {}
   Ref(T&& t) : owned_(std::forward<T>(t)) {}
   Ref(T* t) : address_(t) {}
-  T& operator*() { return address_ ? *address_ : owned_; }
-  T& operator()() { return address_ ? *address_ : owned_; }
-  T* operator->() { return address_ ? address_ : &owned_; }
+  template <typename O, typename = ref_internal::IfAccessible<O, T>>
+  Ref(O* observed)
+      : observed_(observed), access_([](void* o) -> T& {
+          return static_cast<O*>(o)->Access();
+        }) {}
+  T& operator*() { return get(); }
+  T& operator()() { return get(); }
+  T* operator->() { return &get(); }
 
  private:
+  T& get() { return access_ ? access_(observed_) : address_ ? *address_ : owned_; }
+
   T owned_;
   T* address_ = nullptr;
+  void* observed_ = nullptr;
+  T& (*access_)(void*) = nullptr;
 };
 
 /// @brief An adapter. Own or reference a constant string. For convenience, this
@@ -47,16 +94,35 @@ class StringRef {
   StringRef(std::string ref) : owned_(std::move(ref)) {}
   StringRef(const wchar_t* ref) : StringRef(to_string(std::wstring(ref))) {}
   StringRef(const char* ref) : StringRef(std::string(ref)) {}
-  std::string& operator*() { return address_ ? *address_ : owned_; }
-  std::string* operator->() { return address_ ? address_ : &owned_; }
+  template <typename O, typename = ref_internal::IfAccessible<O, std::string>>
+  StringRef(O* observed)
+      : observed_(observed), access_([](void* o) -> std::string& {
+          return static_cast<O*>(o)->Access();
+        }) {}
+  std::string& operator*() { return get(); }
+  std::string* operator->() { return &get(); }
 
  private:
+  std::string& get() {
+    return access_ ? access_(observed_) : address_ ? *address_ : owned_;
+  }
+
   std::string owned_;
   std::string* address_ = nullptr;
+  void* observed_ = nullptr;
+  std::string& (*access_)(void*) = nullptr;
 };
 
 /// @brief An adapter. Own or reference a constant string. For convenience, this
 /// class convert multiple immutable string toward a shared representation.
+///
+/// A std::string_view is referenced, not copied. It must outlive the
+/// ConstStringRef, like a literal:
+///
+/// ```cpp
+/// using namespace std::literals;
+/// auto button = Button("Quit"sv, screen.ExitLoopClosure());
+/// ```
 class ConstStringRef {
  public:
   ConstStringRef(const std::string* ref) : address_(ref) {}
@@ -64,35 +130,92 @@ class ConstStringRef {
   ConstStringRef(std::string ref) : owned_(std::move(ref)) {}
   ConstStringRef(std::wstring ref) : ConstStringRef(to_string(ref)) {}
   ConstStringRef(const wchar_t* ref) : ConstStringRef(std::wstring(ref)) {}
-  ConstStringRef(const char* ref)
-      : ConstStringRef(to_wstring(std::string(ref))) {}
-  const std::string& operator()() const {
-    return address_ ? *address_ : owned_;
+  ConstStringRef(const char* ref) : owned_(ref) {}
+  ConstStringRef(std::string_view ref) : view_(ref), viewed_(true) {}
+  template <typename O, typename = ref_internal::IfReadable<O, std::string>>
+  ConstStringRef(const O* observed)
+      : observed_(observed), get_([](const void* o) -> const std::string& {
+          return static_cast<const O*>(o)->Get();
+        }) {
+    if constexpr (ref_internal::kHasVersion<O>) {
+      version_ = [](const void* o) -> size_t {
+        return static_cast<const O*>(o)->version();
+      };
+    }
   }
-  const std::string& operator*() const { return address_ ? *address_ : owned_; }
-  const std::string* operator->() const {
-    return address_ ? address_ : &owned_;
+  const std::string& operator()() const { return get(); }
+  const std::string& operator*() const { return get(); }
+  const std::string* operator->() const { return &get(); }
+
+  // The string, without copying a referenced std::string_view.
+  std::string_view view() const { return viewed_ ? view_ : get(); }
+
+  // What the string is, and its version, tell whether it changed without
+  // comparing it. The version is incremented whenever the string changes. It
+  // never does for the owned and the viewed strings. It is 0, unknown, for a
+  // referenced std::string.
+  const void* identity() const {
+    return get_       ? observed_
+           : address_ ? address_
+           : viewed_  ? static_cast<const void*>(view_.data())
+                      : this;
+  }
+  size_t version() const {
+    return version_ ? version_(observed_) + 1 : address_ ? 0 : 1;
   }
 
  private:
-  const std::string owned_;
+  const std::string& get() const {
+    if (viewed_ && owned_.size() != view_.size()) {
+      owned_ = view_;  // Copied once, on the first access.
+    }
+    return get_ ? get_(observed_) : address_ ? *address_ : owned_;
+  }
+
+  mutable std::string owned_;
+  std::string_view view_;
+  bool viewed_ = false;
   const std::string* address_ = nullptr;
+  const void* observed_ = nullptr;
+  const std::string& (*get_)(const void*) = nullptr;
+  size_t (*version_)(const void*) = nullptr;
 };
 
 /// @brief An adapter. Reference a list of strings.
 class ConstStringListRef {
  public:
+  /// @brief A list of strings provided on demand, for instance by a model
+  /// owning them. Only the entries displayed are requested.
+  class Adapter {
+   public:
+    virtual ~Adapter() = default;
+    virtual size_t size() const = 0;
+    virtual std::string_view operator[](size_t i) const = 0;
+    // Incremented whenever the entries change. 0 if unknown.
+    virtual size_t version() const { return 0; }
+  };
+
   ConstStringListRef(const std::vector<std::string>* ref) : ref_(ref) {}
   ConstStringListRef(const std::vector<std::wstring>* ref) : ref_wide_(ref) {}
+  ConstStringListRef(const Adapter* ref) : adapter_(ref) {}
 
-  size_t size() const { return ref_ ? ref_->size() : ref_wide_->size(); }
+  size_t size() const {
+    return ref_        ? ref_->size()
+           : ref_wide_ ? ref_wide_->size()
+                       : adapter_->size();
+  }
   std::string operator[](size_t i) const {
-    return ref_ ? (*ref_)[i] : to_string((*ref_wide_)[i]);
+    return ref_        ? (*ref_)[i]
+           : ref_wide_ ? to_string((*ref_wide_)[i])
+                       : std::string((*adapter_)[i]);
   }
+  // The version of the Adapter. 0 for the vectors, whose changes are unknown.
+  size_t version() const { return adapter_ ? adapter_->version() : 0; }
 
  private:
   const std::vector<std::string>* ref_ = nullptr;
   const std::vector<std::wstring>* ref_wide_ = nullptr;
+  const Adapter* adapter_ = nullptr;
 };
 
 }  // namespace ftxui
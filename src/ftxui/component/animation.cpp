@@ -1,4 +1,8 @@
+#include <array>    // for array
 #include <cmath>    // IWYU pragma: keep
+#include <cstddef>  // for size_t
+#include <memory>   // for make_shared, shared_ptr
+#include <mutex>    // for lock_guard, mutex
 #include <ratio>    // for ratio
 #include <utility>  // for move
 
@@ -256,38 +260,346 @@ float BounceInOut(float p) {                    // NOLINT
   }
 }
 
+float Ease(Kind kind, float p) {
+  switch (kind) {
+    case Kind::Linear:
+      return Linear(p);
+    case Kind::QuadraticIn:
+      return QuadraticIn(p);
+    case Kind::QuadraticOut:
+      return QuadraticOut(p);
+    case Kind::QuadraticInOut:
+      return QuadraticInOut(p);
+    case Kind::CubicIn:
+      return CubicIn(p);
+    case Kind::CubicOut:
+      return CubicOut(p);
+    case Kind::CubicInOut:
+      return CubicInOut(p);
+    case Kind::QuarticIn:
+      return QuarticIn(p);
+    case Kind::QuarticOut:
+      return QuarticOut(p);
+    case Kind::QuarticInOut:
+      return QuarticInOut(p);
+    case Kind::QuinticIn:
+      return QuinticIn(p);
+    case Kind::QuinticOut:
+      return QuinticOut(p);
+    case Kind::QuinticInOut:
+      return QuinticInOut(p);
+    case Kind::SineIn:
+      return SineIn(p);
+    case Kind::SineOut:
+      return SineOut(p);
+    case Kind::SineInOut:
+      return SineInOut(p);
+    case Kind::CircularIn:
+      return CircularIn(p);
+    case Kind::CircularOut:
+      return CircularOut(p);
+    case Kind::CircularInOut:
+      return CircularInOut(p);
+    case Kind::ExponentialIn:
+      return ExponentialIn(p);
+    case Kind::ExponentialOut:
+      return ExponentialOut(p);
+    case Kind::ExponentialInOut:
+      return ExponentialInOut(p);
+    case Kind::ElasticIn:
+      return ElasticIn(p);
+    case Kind::ElasticOut:
+      return ElasticOut(p);
+    case Kind::ElasticInOut:
+      return ElasticInOut(p);
+    case Kind::BackIn:
+      return BackIn(p);
+    case Kind::BackOut:
+      return BackOut(p);
+    case Kind::BackInOut:
+      return BackInOut(p);
+    case Kind::BounceIn:
+      return BounceIn(p);
+    case Kind::BounceOut:
+      return BounceOut(p);
+    case Kind::BounceInOut:
+      return BounceInOut(p);
+    case Kind::Custom:
+      break;
+  }
+  return p;
+}
+
 }  // namespace easing
 
+namespace {
+
+// The built-in easing functions, indexed by easing::Kind.
+const std::array<float (*)(float), size_t(easing::Kind::Custom)> kEasings = {
+    easing::Linear,
+    easing::QuadraticIn,
+    easing::QuadraticOut,
+    easing::QuadraticInOut,
+    easing::CubicIn,
+    easing::CubicOut,
+    easing::CubicInOut,
+    easing::QuarticIn,
+    easing::QuarticOut,
+    easing::QuarticInOut,
+    easing::QuinticIn,
+    easing::QuinticOut,
+    easing::QuinticInOut,
+    easing::SineIn,
+    easing::SineOut,
+    easing::SineInOut,
+    easing::CircularIn,
+    easing::CircularOut,
+    easing::CircularInOut,
+    easing::ExponentialIn,
+    easing::ExponentialOut,
+    easing::ExponentialInOut,
+    easing::ElasticIn,
+    easing::ElasticOut,
+    easing::ElasticInOut,
+    easing::BackIn,
+    easing::BackOut,
+    easing::BackInOut,
+    easing::BounceIn,
+    easing::BounceOut,
+    easing::BounceInOut,
+};
+
+easing::Kind KindOf(const easing::Function& function) {
+  if (const auto* f = function.target<float (*)(float)>()) {
+    for (size_t i = 0; i < kEasings.size(); ++i) {
+      if (*f == kEasings[i]) {
+        return easing::Kind(i);
+      }
+    }
+  }
+  return easing::Kind::Custom;
+}
+
+}  // namespace
+
 Animator::Animator(float* from,
                    float to,
                    Duration duration,
                    easing::Function easing_function,
                    Duration delay)
-    : value_(from),
-      from_(*from),
-      to_(to),
-      duration_(duration),
-      easing_function_(std::move(easing_function)),
-      current_(-delay) {
-  RequestAnimationFrame();
+    : scheduler_(Scheduler::Current()),
+      slot_(scheduler_->Add(from,
+                            to,
+                            duration,
+                            std::move(easing_function),
+                            delay)) {}
+
+Animator::Animator(const Animator& other)
+    : scheduler_(other.scheduler_),
+      slot_(scheduler_ ? scheduler_->Copy(other.slot_) : -1) {}
+
+Animator::Animator(Animator&& other) noexcept
+    : scheduler_(std::move(other.scheduler_)), slot_(other.slot_) {
+  other.slot_ = -1;
+}
+
+Animator& Animator::operator=(const Animator& other) {
+  if (this != &other) {
+    if (scheduler_) {
+      scheduler_->Remove(slot_);
+    }
+    scheduler_ = other.scheduler_;
+    slot_ = scheduler_ ? scheduler_->Copy(other.slot_) : -1;
+  }
+  return *this;
+}
+
+Animator& Animator::operator=(Animator&& other) noexcept {
+  if (this != &other) {
+    if (scheduler_) {
+      scheduler_->Remove(slot_);
+    }
+    scheduler_ = std::move(other.scheduler_);
+    slot_ = other.slot_;
+    other.slot_ = -1;
+  }
+  return *this;
+}
+
+Animator::~Animator() {
+  if (scheduler_) {
+    scheduler_->Remove(slot_);
+  }
 }
 
 void Animator::OnAnimation(Params& params) {
-  current_ += params.duration();
+  if (slot_ == -1 || scheduler_->Driven()) {
+    return;
+  }
+  if (scheduler_->Step(slot_, params.duration())) {
+    RequestAnimationFrame();
+  }
+}
+
+float Animator::to() const {
+  return slot_ == -1 ? 0.F : scheduler_->To(slot_);
+}
 
-  if (current_ >= duration_) {
-    *value_ = to_;
+// static
+Scheduler& Scheduler::Get() {
+  return *Current();
+}
+
+// static
+Scheduler& Scheduler::Default() {
+  return *DefaultPointer();
+}
+
+// static
+const std::shared_ptr<Scheduler>& Scheduler::DefaultPointer() {
+  // Never destroyed: the animators of the static components outlive it.
+  static auto* scheduler = new std::shared_ptr<Scheduler>(  // NOLINT
+      std::make_shared<Scheduler>());
+  return *scheduler;
+}
+
+bool Scheduler::OnAnimation(Params& params) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  // Iterate backward: the finished animators are swapped with the last one.
+  for (size_t i = running_.size(); i-- > 0;) {
+    StepLocked(running_[i], params.duration());
+  }
+  return !running_.empty();
+}
+
+size_t Scheduler::running() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return running_.size();
+}
+
+int Scheduler::Add(float* value,
+                   float to,
+                   Duration duration,
+                   easing::Function easing_function,
+                   Duration delay) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return AddLocked(value, to, duration, std::move(easing_function), delay);
+}
+
+int Scheduler::AddLocked(float* value,
+                         float to,
+                         Duration duration,
+                         easing::Function easing_function,
+                         Duration delay) {
+  int slot = 0;
+  if (free_.empty()) {
+    slot = int(value_.size());
+    value_.push_back(nullptr);
+    from_.push_back(0.F);
+    to_.push_back(0.F);
+    duration_.push_back(0.0);
+    current_.push_back(0.0);
+    kind_.push_back(easing::Kind::Linear);
+    custom_.emplace_back();
+    running_index_.push_back(-1);
+  } else {
+    slot = free_.back();
+    free_.pop_back();
+  }
+
+  value_[slot] = value;
+  from_[slot] = *value;
+  to_[slot] = to;
+  duration_[slot] = duration.count();
+  current_[slot] = -delay.count();
+  kind_[slot] = KindOf(easing_function);
+  if (kind_[slot] == easing::Kind::Custom) {
+    custom_[slot] = std::move(easing_function);
+  }
+
+  // Nothing moves when the value is already there.
+  SetRunning(slot, *value != to);
+  return slot;
+}
+
+int Scheduler::Copy(int slot) {
+  if (slot == -1) {
+    return -1;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  const int copy = AddLocked(value_[slot], to_[slot], Duration(duration_[slot]),
+                             kind_[slot] == easing::Kind::Custom
+                                 ? custom_[slot]
+                                 : kEasings[size_t(kind_[slot])],
+                             Duration(0));
+  from_[copy] = from_[slot];
+  current_[copy] = current_[slot];
+  SetRunning(copy, running_index_[slot] != -1);
+  return copy;
+}
+
+void Scheduler::Remove(int slot) {
+  if (slot == -1) {
     return;
   }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  SetRunning(slot, false);
+  custom_[slot] = nullptr;
+  free_.push_back(slot);
+}
+
+bool Scheduler::Step(int slot, Duration duration) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return StepLocked(slot, duration);
+}
+
+float Scheduler::To(int slot) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return to_[slot];
+}
+
+bool Scheduler::StepLocked(int slot, Duration duration) {
+  current_[slot] += duration.count();
+
+  if (current_[slot] >= duration_[slot]) {
+    *value_[slot] = to_[slot];
+    SetRunning(slot, false);
+    return false;
+  }
 
-  if (current_ <= Duration()) {
-    *value_ = from_;
+  if (current_[slot] <= 0.0) {
+    *value_[slot] = from_[slot];
   } else {
-    *value_ = from_ +
-              (to_ - from_) * easing_function_(current_ / duration_);  // NOLINT
+    const auto p = float(current_[slot] / duration_[slot]);
+    const float eased = kind_[slot] == easing::Kind::Custom
+                            ? custom_[slot](p)
+                            : easing::Ease(kind_[slot], p);
+    *value_[slot] = from_[slot] + (to_[slot] - from_[slot]) * eased;
+  }
+  return true;
+}
+
+void Scheduler::SetRunning(int slot, bool running) {
+  const int index = running_index_[slot];
+  if (running == (index != -1)) {
+    return;
+  }
+
+  if (running) {
+    const bool was_idle = running_.empty();
+    running_index_[slot] = int(running_.size());
+    running_.push_back(slot);
+    if (was_idle) {
+      RequestFrame();
+    }
+    return;
   }
 
-  RequestAnimationFrame();
+  const int last = running_.back();
+  running_[index] = last;
+  running_index_[last] = index;
+  running_.pop_back();
+  running_index_[slot] = -1;
 }
 
 }  // namespace ftxui::animation
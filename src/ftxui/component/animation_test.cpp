@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
+#include <chrono>      // for operator""s, chrono_literals
+#include <cstddef>     // for size_t
 #include <functional>  // for function
+#include <utility>     // for move
 #include <vector>      // for allocator, vector
 
-#include "ftxui/component/animation.hpp"  // for Function, BackIn, BackInOut, BackOut, BounceIn, BounceInOut, BounceOut, CircularIn, CircularInOut, CircularOut, CubicIn, CubicInOut, CubicOut, ElasticIn, ElasticInOut, ElasticOut, ExponentialIn, ExponentialInOut, ExponentialOut, Linear, QuadraticIn, QuadraticInOut, QuadraticOut, QuarticIn, QuarticInOut, QuarticOut, QuinticIn, QuinticInOut, QuinticOut, SineIn, SineInOut, SineOut
+#include "ftxui/component/animation.hpp"  // for Animator, Scheduler, Params, Ease, Kind, Function, BackIn, BackInOut, BackOut, BounceIn, BounceInOut, BounceOut, CircularIn, CircularInOut, CircularOut, CubicIn, CubicInOut, CubicOut, ElasticIn, ElasticInOut, ElasticOut, ExponentialIn, ExponentialInOut, ExponentialOut, Linear, QuadraticIn, QuadraticInOut, QuadraticOut, QuarticIn, QuarticInOut, QuarticOut, QuinticIn, QuinticInOut, QuinticOut, SineIn, SineInOut, SineOut
 
 namespace ftxui {
 
@@ -29,6 +32,52 @@ TEST(AnimationTest, StartAndEnd) {
     EXPECT_NEAR(0.F, it(0.F), 1.0e-4);
     EXPECT_NEAR(1.F, it(1.F), 1.0e-4);
   }
+
+  // The switch dispatches to the same functions, in the same order.
+  for (size_t i = 0; i < functions.size(); ++i) {
+    const auto kind = animation::easing::Kind(i);
+    EXPECT_EQ(functions[i](0.3F), animation::easing::Ease(kind, 0.3F));
+  }
+}
+
+TEST(AnimationTest, Scheduler) {
+  using namespace std::chrono_literals;
+  animation::Scheduler& scheduler = animation::Scheduler::Get();
+  const size_t running = scheduler.running();
+
+  float value = 0.F;
+  float custom = 0.F;
+  {
+    animation::Animator animator(&value, 1.F, 1s);
+    animation::Animator custom_animator(&custom, 1.F, 1s,
+                                        [](float p) { return p * 0.5F; });
+    // Nothing moves.
+    animation::Animator idle(&value, 0.F);
+    EXPECT_EQ(scheduler.running(), running + 2);
+
+    animation::Params half(0.5s);
+    EXPECT_TRUE(scheduler.OnAnimation(half));
+    EXPECT_FLOAT_EQ(value, 0.5F);
+    EXPECT_FLOAT_EQ(custom, 0.25F);
+
+    // The copy continues from the same point.
+    animation::Animator copy = animator;
+    EXPECT_EQ(scheduler.running(), running + 3);
+    animation::Animator moved = std::move(custom_animator);
+    EXPECT_EQ(scheduler.running(), running + 3);
+
+    scheduler.OnAnimation(half);
+    EXPECT_FLOAT_EQ(value, 1.F);
+    EXPECT_FLOAT_EQ(custom, 1.F);
+    EXPECT_EQ(scheduler.running(), running);
+  }
+
+  // Destroyed while running.
+  {
+    animation::Animator animator(&value, 0.F, 1s);
+    EXPECT_EQ(scheduler.running(), running + 1);
+  }
+  EXPECT_EQ(scheduler.running(), running);
 }
 
 }  // namespace ftxui
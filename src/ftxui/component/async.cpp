@@ -0,0 +1,25 @@
+#include "ftxui/component/async.hpp"
+
+#include <functional>  // for function
+#include <utility>     // for move
+
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+void RunInBackground(std::function<void()> work, Closure done) {
+  ScreenInteractive* screen = ScreenInteractive::Active();
+  if (!screen) {
+    work();
+    done();
+    return;
+  }
+
+  screen->RunAsync(std::move(work), std::move(done));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
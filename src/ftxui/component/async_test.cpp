@@ -0,0 +1,103 @@
+#include "ftxui/component/async.hpp"
+#include <gtest/gtest.h>
+#include <atomic>     // for atomic
+#include <chrono>     // for milliseconds
+#include <stdexcept>  // for runtime_error
+#include <string>     // for string
+#include <thread>     // for this_thread::sleep_for
+
+#include "ftxui/component/component.hpp"  // for Renderer
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+
+namespace ftxui {
+
+namespace {
+
+Async<int> Twice(int value) {
+  const int result = co_await Background([value] { return 2 * value; });
+  co_return result;
+}
+
+Async<std::string> Nested() {
+  const int a = co_await Twice(1);
+  const int b = co_await Twice(a);
+  co_return std::to_string(a) + std::to_string(b);
+}
+
+Async<> Throw() {
+  co_await Background([] { throw std::runtime_error("error"); });
+}
+
+// Run |loop| until |async| is done.
+template <class T>
+void RunUntilDone(Loop& loop, Async<T>& async) {
+  for (int i = 0; i < 1000 && !async.Done(); ++i) {
+    loop.RunOnce();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+}  // namespace
+
+TEST(AsyncTest, WithoutScreen) {
+  auto async = Twice(21);
+  ASSERT_TRUE(async.Done());
+  EXPECT_EQ(async.Get(), 42);
+
+  auto nested = Nested();
+  ASSERT_TRUE(nested.Done());
+  EXPECT_EQ(nested.Get(), "24");
+}
+
+TEST(AsyncTest, ResumedByTheLoop) {
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, Renderer([] { return text("hello"); }));
+
+  auto async = Nested();
+  RunUntilDone(loop, async);
+  ASSERT_TRUE(async.Done());
+  EXPECT_EQ(async.Get(), "24");
+}
+
+TEST(AsyncTest, Exception) {
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, Renderer([] { return text("hello"); }));
+
+  auto async = Throw();
+  RunUntilDone(loop, async);
+  ASSERT_TRUE(async.Done());
+  EXPECT_THROW(async.Get(), std::runtime_error);
+}
+
+TEST(AsyncTest, Cancel) {
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, Renderer([] { return text("hello"); }));
+
+  std::atomic<bool> work_done = false;
+  bool resumed = false;
+  auto coroutine = [&]() -> Async<> {
+    co_await Background([&] { work_done = true; });
+    resumed = true;
+  };
+
+  auto async = coroutine();
+  EXPECT_FALSE(async.Done());
+  async.Reset();
+
+  for (int i = 0; i < 1000 && !work_done; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  for (int i = 0; i < 10; ++i) {
+    loop.RunOnce();
+  }
+  EXPECT_TRUE(work_done);
+  EXPECT_FALSE(resumed);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
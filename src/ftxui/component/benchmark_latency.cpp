@@ -0,0 +1,197 @@
+// Measure the end to end latency of an FTXUI application: from a keystroke
+// written into its terminal to the frame it outputs in response. The
+// application runs on a pseudo-terminal, like in a real terminal emulator.
+// This covers the input reading, the event dispatch, the rendering and the
+// output flush together.
+//
+// Usage: ftxui-benchmark-latency [application] [samples]
+//
+// The application defaults to the `input` example. It is sent alternatively
+// a character and a backspace, so that every keystroke produces a new frame.
+#include <fcntl.h>      // for O_RDWR, O_NOCTTY, open
+#include <poll.h>       // for poll, pollfd, POLLIN
+#include <signal.h>     // for kill, SIGTERM
+#include <sys/ioctl.h>  // for ioctl, TIOCSWINSZ, TIOCSCTTY, winsize
+#include <sys/wait.h>   // for waitpid
+#include <unistd.h>     // for fork, execl, read, write, setsid, dup2, close
+
+#include <algorithm>  // for sort
+#include <chrono>     // for steady_clock, duration
+#include <cstdio>     // for printf, fprintf, perror
+#include <cstdlib>    // for posix_openpt, grantpt, unlockpt, ptsname, atoi
+#include <string>     // for string
+#include <tuple>      // for ignore
+#include <vector>     // for vector
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kWidth = 80;
+constexpr int kHeight = 24;
+constexpr int kDefaultSamples = 500;
+
+// A frame is considered complete once the application stays silent for this
+// long.
+constexpr std::chrono::milliseconds kQuiet(20);
+
+// Spawn |application| on a new pseudo-terminal. Return its pid, and its master
+// side in |master|.
+pid_t Spawn(const char* application, int* master) {
+  *master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (*master < 0 || grantpt(*master) != 0 || unlockpt(*master) != 0) {
+    perror("posix_openpt");
+    return -1;
+  }
+  const std::string slave_name = ptsname(*master);  // NOLINT
+
+  winsize size{};
+  size.ws_col = kWidth;
+  size.ws_row = kHeight;
+  ioctl(*master, TIOCSWINSZ, &size);  // NOLINT
+
+  const pid_t pid = fork();
+  if (pid != 0) {
+    return pid;
+  }
+
+  // The child: make the pseudo-terminal its controlling terminal.
+  setsid();
+  const int slave = open(slave_name.c_str(), O_RDWR);  // NOLINT
+  ioctl(slave, TIOCSCTTY, 0);                          // NOLINT
+  dup2(slave, STDIN_FILENO);
+  dup2(slave, STDOUT_FILENO);
+  dup2(slave, STDERR_FILENO);
+  close(slave);
+  close(*master);
+  setenv("TERM", "xterm-256color", 1);
+  execl(application, application, nullptr);  // NOLINT
+  perror("execl");
+  _exit(1);
+}
+
+// The output of the application, in response to an input.
+struct Output {
+  size_t bytes = 0;
+  Clock::time_point first;  // When the first byte was received.
+  Clock::time_point last;   // When the last byte was received.
+};
+
+// Read what the application writes, until it stays silent for |kQuiet|, or
+// |timeout| without any output. Answer the cursor position requests, like a
+// terminal emulator.
+Output Drain(int master, std::chrono::milliseconds timeout) {
+  Output output;
+  std::chrono::milliseconds wait = timeout;
+  std::string pending;
+  char buffer[4096];  // NOLINT
+  while (true) {
+    pollfd fd = {master, POLLIN, 0};
+    if (poll(&fd, 1, int(wait.count())) <= 0) {
+      return output;
+    }
+    const ssize_t n = read(master, buffer, sizeof(buffer));  // NOLINT
+    if (n <= 0) {
+      return output;
+    }
+    output.last = Clock::now();
+    if (output.bytes == 0) {
+      output.first = output.last;
+    }
+    output.bytes += size_t(n);
+    wait = kQuiet;
+
+    // The request might be split over two reads.
+    pending.append(buffer, size_t(n));  // NOLINT
+    size_t position = 0;
+    while ((position = pending.find("\x1B[6n")) != std::string::npos) {
+      const std::string reply = "\x1B[1;1R";
+      std::ignore = write(master, reply.data(), reply.size());
+      pending.erase(0, position + 4);
+    }
+    if (pending.size() > 3) {
+      pending.erase(0, pending.size() - 3);
+    }
+  }
+}
+
+double Percentile(std::vector<double> values, double percentile) {
+  std::sort(values.begin(), values.end());
+  const auto index = size_t(percentile * double(values.size() - 1));
+  return values[index];
+}
+
+}  // namespace
+
+int main(int argc, const char* argv[]) {
+#if defined(FTXUI_LATENCY_APPLICATION)
+  const char* application = FTXUI_LATENCY_APPLICATION;
+#else
+  const char* application = nullptr;
+#endif
+  if (argc >= 2) {
+    application = argv[1];  // NOLINT
+  }
+  if (application == nullptr || *application == '\0') {
+    fprintf(stderr, "Usage: %s application [samples]\n", argv[0]);  // NOLINT
+    return 1;
+  }
+  const int samples =
+      argc >= 3 ? std::atoi(argv[2]) : kDefaultSamples;  // NOLINT
+
+  int master = -1;
+  const pid_t pid = Spawn(application, &master);
+  if (pid < 0) {
+    return 1;
+  }
+
+  // Wait for the first frame.
+  Drain(master, std::chrono::milliseconds(2000));
+
+  std::vector<double> first_byte;
+  std::vector<double> complete;
+  size_t total_bytes = 0;
+  int frames = 0;
+  for (int i = 0; i < samples; ++i) {
+    const char key = (i % 2 == 0) ? 'a' : char(127);
+    const Clock::time_point start = Clock::now();
+    if (write(master, &key, 1) != 1) {
+      break;
+    }
+    const Output output = Drain(master, std::chrono::milliseconds(1000));
+    if (output.bytes == 0) {
+      continue;
+    }
+    first_byte.push_back(
+        std::chrono::duration<double, std::micro>(output.first - start)
+            .count());
+    complete.push_back(
+        std::chrono::duration<double, std::micro>(output.last - start).count());
+    total_bytes += output.bytes;
+    frames++;
+  }
+
+  kill(pid, SIGTERM);
+  waitpid(pid, nullptr, 0);
+  close(master);
+
+  if (frames == 0) {
+    fprintf(stderr, "No frame received from %s\n", application);  // NOLINT
+    return 1;
+  }
+
+  // NOLINTBEGIN
+  printf("application:     %s\n", application);
+  printf("frames:          %d/%d\n", frames, samples);
+  printf("first byte p50:  %8.1f us\n", Percentile(first_byte, 0.50));
+  printf("first byte p99:  %8.1f us\n", Percentile(first_byte, 0.99));
+  printf("complete p50:    %8.1f us\n", Percentile(complete, 0.50));
+  printf("complete p99:    %8.1f us\n", Percentile(complete, 0.99));
+  printf("bytes per frame: %8.1f\n", double(total_bytes) / double(frames));
+  // NOLINTEND
+  return 0;
+}
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
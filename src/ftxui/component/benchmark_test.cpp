@@ -0,0 +1,179 @@
+#include <benchmark/benchmark.h>
+#include <array>       // for array
+#include <cstdint>     // for int64_t
+#include <functional>  // for ref
+#include <string>      // for string, to_string
+#include <thread>   // for thread
+#include <utility>  // for move
+#include <vector>   // for vector
+
+#include "ftxui/component/component.hpp"  // for Renderer, Checkbox, Input, Menu, Radiobox, Horizontal, Tab, Vertical
+#include "ftxui/component/component_options.hpp"  // for MenuOption
+#include "ftxui/component/receiver.hpp"  // for MakeReceiver, ReceiverImpl
+#include "ftxui/component/task.hpp"      // for Task
+#include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/dom/benchmark_allocations.hpp"  // for AllocationCounter
+#include "ftxui/dom/elements.hpp"  // for text, vbox, hbox, graph, window, ...
+#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+// state.range(0) bytes of typing, arrow keys, and mouse moves, parsed at once.
+static void BenchmarkTerminalInputParser(benchmark::State& state) {
+  const std::string chunk =
+      "hello world \x1B[A\x1B[B\x1B[<35;12;5M\x1B[<0;40;8m测试\x1B[1;5C";
+  std::string input;
+  while (int64_t(input.size()) < state.range(0)) {
+    input += chunk;
+  }
+  auto receiver = MakeReceiver<Task>();
+  TerminalInputParser parser(receiver->MakeSender());
+  std::vector<Task> tasks;
+  while (state.KeepRunning()) {
+    parser.Add(input);
+    tasks.clear();
+    receiver->ReceiveAll(&tasks);
+    benchmark::DoNotOptimize(tasks);
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(input.size()));
+}
+BENCHMARK(BenchmarkTerminalInputParser)->Range(64, 64 << 10);
+
+// state.range(0) threads sending 10000 tasks each, received by the calling
+// one.
+static void BenchmarkReceiver(benchmark::State& state) {
+  const int producers = static_cast<int>(state.range(0));
+  const int count = 10000;
+  while (state.KeepRunning()) {
+    auto receiver = MakeReceiver<int>();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i) {
+      threads.emplace_back([sender = receiver->MakeSender()] {
+        for (int j = 0; j < count; ++j) {
+          sender->Send(j);
+        }
+      });
+    }
+    int value = 0;
+    while (receiver->Receive(&value)) {
+      benchmark::DoNotOptimize(value);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * producers * count);
+}
+BENCHMARK(BenchmarkReceiver)->DenseRange(1, 4)->UseRealTime();
+
+// Two tabs of examples/component/homescreen.cpp, the graphs and the compiler
+// options, selected by state.range(0). Rendered and printed on every frame,
+// with the allocations it makes.
+static void BenchmarkHomescreen(benchmark::State& state) {
+  const AllocationCounter counter(state);
+  int shift = 0;
+  auto my_graph = [&shift](int width, int height) {
+    std::vector<int> output(width);
+    for (int i = 0; i < width; ++i) {
+      output[i] = (i * 7 + shift) % (height + 1);
+    }
+    return output;
+  };
+  auto plot = [&](const std::string& title, Color color) {
+    return vbox({
+        text(title) | hcenter,
+        hbox({
+            vbox({text("100 "), filler(), text("50 "), filler(), text("0 ")}),
+            graph(std::ref(my_graph)) | ftxui::color(color) | flex,
+        }) | flex,
+    });
+  };
+  auto htop = Renderer([&] {
+    return hbox({
+        vbox({
+            plot("Frequency [Mhz]", Color::Default) | flex,
+            separator(),
+            plot("Utilization [%]", Color::RedLight) | flex,
+        }) | flex,
+        separator(),
+        plot("Ram [Mo]", Color::BlueLight) | flex,
+    });
+  });
+
+  std::vector<std::string> compiler_entries;
+  for (int i = 0; i < 40; ++i) {
+    compiler_entries.push_back("compiler " + std::to_string(i));
+  }
+  int compiler_selected = 0;
+  Component compiler = Radiobox(&compiler_entries, &compiler_selected);
+  std::array<std::string, 8> options_label = {
+      "-Wall",     "-Werror",   "-lpthread",         "-O3",
+      "-Wabi-tag", "-Wno-cast", "-Wcomma-subscript", "-Wno-null",
+  };
+  std::array<bool, 8> options_state = {};
+  auto flags = Container::Vertical({});
+  for (size_t i = 0; i < options_label.size(); ++i) {
+    flags->Add(Checkbox(&options_label[i], &options_state[i]));
+  }
+  std::string executable_content = "main";
+  Component executable = Input(&executable_content, "executable");
+  auto compiler_component = Container::Horizontal({
+      compiler,
+      flags,
+      executable,
+  });
+  auto compiler_renderer = Renderer(compiler_component, [&] {
+    Elements command;
+    command.push_back(text(compiler_entries[compiler_selected]) | bold);
+    for (size_t i = 0; i < options_label.size(); ++i) {
+      if (options_state[i]) {
+        command.push_back(text(" " + options_label[i]) | dim);
+      }
+    }
+    command.push_back(text(" -o " + executable_content) | bold);
+    return vbox({
+        hbox({
+            window(text("Compiler"),
+                   compiler->Render() | vscroll_indicator | frame),
+            window(text("Flags"), flags->Render() | vscroll_indicator | frame),
+            window(text("Executable:"), executable->Render()) |
+                size(WIDTH, EQUAL, 20),
+            filler(),
+        }) | size(HEIGHT, LESS_THAN, 8),
+        hflow(std::move(command)) | flex_grow,
+    });
+  });
+
+  int tab_index = static_cast<int>(state.range(0));
+  std::vector<std::string> tab_entries = {"htop", "compiler"};
+  auto tab_selection = Menu(&tab_entries, &tab_index, MenuOption::Horizontal());
+  auto tab_content = Container::Tab({htop, compiler_renderer}, &tab_index);
+  auto main_renderer =
+      Renderer(Container::Vertical({tab_selection, tab_content}), [&] {
+        return vbox({
+            text("FTXUI Demo") | bold | hcenter,
+            tab_selection->Render(),
+            tab_content->Render() | flex,
+        });
+      });
+
+  Screen screen(120, 40);
+  std::string out;
+  while (state.KeepRunning()) {
+    shift++;
+    options_state[size_t(shift) % options_state.size()] ^= true;
+    Render(screen, main_renderer->Render());
+    out.clear();
+    screen.ToString(out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BenchmarkHomescreen)->Arg(0)->Arg(1);
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -7,6 +7,7 @@
 #include "ftxui/component/component.hpp"       // for Make, Button
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for ButtonOption, AnimatedColorOption, AnimatedColorsOption, EntryState
+#include "ftxui/component/entry_cache.hpp"  // for EntryCache
 #include "ftxui/component/event.hpp"  // for Event, Event::Return
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/component/screen_interactive.hpp"  // for Component
@@ -73,6 +74,10 @@ Component Button(ConstStringRef label,
       const bool active = Active();
       const bool focused = Focused();
       const bool focused_or_hover = focused || mouse_hover_;
+      if (option_->animated_colors.foreground.enabled ||
+          option_->animated_colors.background.enabled) {
+        RequestMouseMotion();
+      }
 
       float target = focused_or_hover ? 1.F : 0.F;  // NOLINT
       if (target != animator_background_.to()) {
@@ -87,9 +92,8 @@ Component Button(ConstStringRef label,
           focused_or_hover,
       };
 
-      auto element =
-          (option_->transform ? option_->transform : DefaultTransform)  //
-          (state);
+      auto element = cache_.Get(
+          state, option_->transform ? option_->transform : DefaultTransform);
       return element | AnimatedColorStyle() | focus_management | reflect(box_);
     }
 
@@ -137,7 +141,7 @@ Component Button(ConstStringRef label,
       SetAnimationTarget(1.F);       // NOLINT
     }
 
-    bool OnEvent(Event event) override {
+    bool HandleEvent(const Event& event) override {
       if (event.is_mouse()) {
         return OnMouseEvent(event);
       }
@@ -149,9 +153,13 @@ Component Button(ConstStringRef label,
       return false;
     }
 
-    bool OnMouseEvent(Event event) {
-      mouse_hover_ =
+    bool OnMouseEvent(const Event& event) {
+      const bool mouse_hover =
           box_.Contain(event.mouse().x, event.mouse().y) && CaptureMouse(event);
+      if (mouse_hover != mouse_hover_) {
+        mouse_hover_ = mouse_hover;
+        Invalidate();
+      }
 
       if (!mouse_hover_) {
         return false;
@@ -171,6 +179,7 @@ Component Button(ConstStringRef label,
 
    private:
     ConstStringRef label_;
+    EntryCache cache_;
     std::function<void()> on_click_;
     bool mouse_hover_ = false;
     Box box_;
@@ -2,11 +2,12 @@
 #include <chrono>         // for operator""s, chrono_literals
 #include <memory>         // for __shared_ptr_access, shared_ptr, allocator
 #include <string>         // for string
+#include <string_view>    // for string_view
 
 #include "ftxui/component/animation.hpp"          // for Duration, Params
 #include "ftxui/component/component.hpp"          // for Button, Horizontal
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
-#include "ftxui/component/component_options.hpp"  // for ButtonOption
+#include "ftxui/component/component_options.hpp"  // for ButtonOption, EntryState
 #include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowLeft, Event::ArrowRight
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/dom/node.hpp"         // for Render
@@ -92,6 +93,14 @@ TEST(ButtonTest, Basic) {
   (void)container->Render();
 }
 
+TEST(ButtonTest, StringViewLabel) {
+  // The label is referenced, not copied.
+  auto button = Button(std::string_view("Quit"), [] {});
+  Screen screen(10, 3);
+  Render(screen, button->Render());
+  EXPECT_NE(screen.ToString().find("Quit"), std::string::npos);
+}
+
 TEST(ButtonTest, Animation) {
   Terminal::SetColorSupport(Terminal::Color::TrueColor);
   int press_count = 0;
@@ -124,22 +133,20 @@ TEST(ButtonTest, Animation) {
     Screen screen(12, 3);
     Render(screen, container->Render());
     EXPECT_EQ(screen.ToString(),
-              "\x1B[1m\x1B[38;2;192;192;192m\x1B[48;2;0;0;0m      \x1B[22m     "
-              " \x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;192;192;192m\x1B[48;2;0;0;"
-              "0m btn1 \x1B[22m btn2 "
-              "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;192;192;192m\x1B[48;2;0;0;"
-              "0m      \x1B[22m      \x1B[39m\x1B[49m");
+              "\x1B[1;38;2;192;192;192;48;2;0;0;0m      \x1B[22m      \x1B[0m\r"
+              "\n"
+              "\x1B[1;38;2;192;192;192;48;2;0;0;0m btn1 \x1B[22m btn2 \x1B[0m\r"
+              "\n"
+              "\x1B[1;38;2;192;192;192;48;2;0;0;0m      \x1B[22m      \x1B[0m");
   }
   selected = 1;
   {
     Screen screen(12, 3);
     Render(screen, container->Render());
     EXPECT_EQ(screen.ToString(),
-              "\x1B[38;2;192;192;192m\x1B[48;2;0;0;0m      \x1B[1m      "
-              "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;192;192;192m\x1B[48;2;0;0;"
-              "0m btn1 \x1B[1m btn2 "
-              "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;192;192;192m\x1B[48;2;0;0;"
-              "0m      \x1B[1m      \x1B[22m\x1B[39m\x1B[49m");
+              "\x1B[38;2;192;192;192;48;2;0;0;0m      \x1B[1m      \x1B[0m\r\n"
+              "\x1B[38;2;192;192;192;48;2;0;0;0m btn1 \x1B[1m btn2 \x1B[0m\r\n"
+              "\x1B[38;2;192;192;192;48;2;0;0;0m      \x1B[1m      \x1B[0m");
   }
   animation::Params params(2s);
   container->OnAnimation(params);
@@ -148,13 +155,12 @@ TEST(ButtonTest, Animation) {
     Render(screen, container->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[38;2;192;192;192m\x1B[48;2;0;0;0m      "
-        "\x1B[1m\x1B[38;2;255;255;255m\x1B[48;2;128;128;128m      "
-        "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;192;192;192m\x1B[48;2;0;0;0m "
-        "btn1 \x1B[1m\x1B[38;2;255;255;255m\x1B[48;2;128;128;128m btn2 "
-        "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;192;192;192m\x1B[48;2;0;0;0m    "
-        "  \x1B[1m\x1B[38;2;255;255;255m\x1B[48;2;128;128;128m      "
-        "\x1B[22m\x1B[39m\x1B[49m");
+        "\x1B[38;2;192;192;192;48;2;0;0;0m      \x1B[1;38;2;255;255;255;48;2;12"
+        "8;128;128m      \x1B[0m\r\n"
+        "\x1B[38;2;192;192;192;48;2;0;0;0m btn1 \x1B[1;38;2;255;255;255;48;2;12"
+        "8;128;128m btn2 \x1B[0m\r\n"
+        "\x1B[38;2;192;192;192;48;2;0;0;0m      \x1B[1;38;2;255;255;255;48;2;12"
+        "8;128;128m      \x1B[0m");
   }
   EXPECT_EQ(selected, 1);
   container->OnEvent(MousePressed(3, 1));
@@ -164,13 +170,12 @@ TEST(ButtonTest, Animation) {
     Render(screen, container->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[38;2;223;223;223m\x1B[48;2;64;64;64m      "
-        "\x1B[22m\x1B[38;2;255;255;255m\x1B[48;2;128;128;128m      "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;223;223;223m\x1B[48;2;64;64;64m "
-        "btn1 \x1B[22m\x1B[38;2;255;255;255m\x1B[48;2;128;128;128m btn2 "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;223;223;223m\x1B[48;2;64;64;64m  "
-        "    \x1B[22m\x1B[38;2;255;255;255m\x1B[48;2;128;128;128m      "
-        "\x1B[39m\x1B[49m");
+        "\x1B[1;38;2;223;223;223;48;2;64;64;64m      \x1B[0;38;2;255;255;255;48"
+        ";2;128;128;128m      \x1B[0m\r\n"
+        "\x1B[1;38;2;223;223;223;48;2;64;64;64m btn1 \x1B[0;38;2;255;255;255;48"
+        ";2;128;128;128m btn2 \x1B[0m\r\n"
+        "\x1B[1;38;2;223;223;223;48;2;64;64;64m      \x1B[0;38;2;255;255;255;48"
+        ";2;128;128;128m      \x1B[0m");
   }
   container->OnAnimation(params);
   {
@@ -178,16 +183,46 @@ TEST(ButtonTest, Animation) {
     Render(screen, container->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[38;2;255;255;255m\x1B[48;2;128;128;128m      "
-        "\x1B[22m\x1B[38;2;192;192;192m\x1B[48;2;0;0;0m      "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;255;255;255m\x1B[48;2;128;128;"
-        "128m btn1 \x1B[22m\x1B[38;2;192;192;192m\x1B[48;2;0;0;0m btn2 "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;255;255;255m\x1B[48;2;128;128;"
-        "128m      \x1B[22m\x1B[38;2;192;192;192m\x1B[48;2;0;0;0m      "
-        "\x1B[39m\x1B[49m");
+        "\x1B[1;38;2;255;255;255;48;2;128;128;128m      \x1B[0;38;2;192;192;192"
+        ";48;2;0;0;0m      \x1B[0m\r\n"
+        "\x1B[1;38;2;255;255;255;48;2;128;128;128m btn1 \x1B[0;38;2;192;192;192"
+        ";48;2;0;0;0m btn2 \x1B[0m\r\n"
+        "\x1B[1;38;2;255;255;255;48;2;128;128;128m      \x1B[0;38;2;192;192;192"
+        ";48;2;0;0;0m      \x1B[0m");
   }
 }
 
+TEST(ButtonTest, TransformCached) {
+  std::string label = "label";
+  int transformed = 0;
+  ButtonOption option;
+  option.transform = [&](const EntryState& state) {
+    transformed++;
+    return text(state.label);
+  };
+  auto btn1 = Button(&label, [] {}, &option);
+  auto btn2 = Button("btn2", [] {}, &option);
+  auto layout = Container::Horizontal({btn1, btn2});
+
+  Screen screen(12, 1);
+  Render(screen, layout->Render());
+  Render(screen, layout->Render());
+  EXPECT_EQ(transformed, 2);
+  EXPECT_EQ(screen.ToString(), "labelbtn2   ");
+
+  // The label changed.
+  label = "new";
+  screen.Clear();
+  Render(screen, layout->Render());
+  EXPECT_EQ(transformed, 3);
+  EXPECT_EQ(screen.ToString(), "newbtn2     ");
+
+  // The focus moved from btn1 to btn2.
+  EXPECT_TRUE(layout->OnEvent(Event::ArrowRight));
+  Render(screen, layout->Render());
+  EXPECT_EQ(transformed, 5);
+}
+
 }  // namespace ftxui
 
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
@@ -5,33 +5,38 @@
 
 #include "ftxui/component/component.hpp"  // for Make, CatchEvent, ComponentDecorator
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
-#include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/component/event.hpp"  // for Event, EventFilter, EventFilter::None
 
 namespace ftxui {
 
 class CatchEventBase : public ComponentBase {
  public:
   // Constructor.
-  explicit CatchEventBase(std::function<bool(Event)> on_event)
-      : on_event_(std::move(on_event)) {}
+  CatchEventBase(std::function<bool(Event)> on_event, EventFilter filter)
+      : on_event_(std::move(on_event)), filter_(filter) {}
 
   // Component implementation.
-  bool OnEvent(Event event) override {
-    if (on_event_(event)) {
+  bool HandleEvent(const Event& event) override {
+    // The events not matching |filter_| skip |on_event_|.
+    if ((event.filter() & filter_) != EventFilter::None &&
+        on_event_(event)) {
       return true;
     } else {
-      return ComponentBase::OnEvent(event);
+      return DispatchToChildren(event);
     }
   }
 
  protected:
   std::function<bool(Event)> on_event_;
+  EventFilter filter_;
 };
 
 /// @brief Return a component, using |on_event| to catch events. This function
 /// must returns true when the event has been handled, false otherwise.
 /// @param child The wrapped component.
 /// @param on_event The function drawing the interface.
+/// @param filter The kinds of events given to |on_event|. The others are
+/// given to |child| directly.
 /// @ingroup component
 ///
 /// ### Example
@@ -51,8 +56,9 @@ class CatchEventBase : public ComponentBase {
 /// screen.Loop(component);
 /// ```
 Component CatchEvent(Component child,
-                     std::function<bool(Event event)> on_event) {
-  auto out = Make<CatchEventBase>(std::move(on_event));
+                     std::function<bool(Event event)> on_event,
+                     EventFilter filter) {
+  auto out = Make<CatchEventBase>(std::move(on_event), filter);
   out->Add(std::move(child));
   return out;
 }
@@ -60,6 +66,7 @@ Component CatchEvent(Component child,
 /// @brief Decorate a component, using |on_event| to catch events. This function
 /// must returns true when the event has been handled, false otherwise.
 /// @param on_event The function drawing the interface.
+/// @param filter The kinds of events given to |on_event|.
 /// @ingroup component
 ///
 /// ### Example
@@ -76,11 +83,15 @@ Component CatchEvent(Component child,
 /// });
 /// screen.Loop(renderer);
 /// ```
-ComponentDecorator CatchEvent(std::function<bool(Event)> on_event) {
-  return [on_event = std::move(on_event)](Component child) {
-    return CatchEvent(std::move(child), [on_event = on_event](Event event) {
-      return on_event(std::move(event));
-    });
+ComponentDecorator CatchEvent(std::function<bool(Event)> on_event,
+                              EventFilter filter) {
+  return [on_event = std::move(on_event), filter](Component child) {
+    return CatchEvent(
+        std::move(child),
+        [on_event = on_event](Event event) {
+          return on_event(std::move(event));
+        },
+        filter);
   };
 }
 
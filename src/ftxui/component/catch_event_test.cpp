@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <vector>  // for vector
+
+#include "ftxui/component/component.hpp"       // for CatchEvent, Renderer
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/event.hpp"  // for Event, EventFilter, Event::Custom, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::None, Mouse::Pressed
+#include "ftxui/dom/elements.hpp"     // for text, Element
+
+namespace ftxui {
+
+namespace {
+Event MouseEvent(Mouse::Button button) {
+  Mouse mouse = {};
+  mouse.button = button;
+  mouse.motion = Mouse::Pressed;
+  return Event::Mouse("", mouse);
+}
+}  // namespace
+
+TEST(CatchEventTest, Filter) {
+  EXPECT_EQ(Event::Character('a').filter(), EventFilter::Character);
+  EXPECT_EQ(Event::Return.filter(), EventFilter::Special);
+  EXPECT_EQ(Event::Custom.filter(), EventFilter::Custom);
+  EXPECT_EQ(Event::Paste("a").filter(), EventFilter::Paste);
+  EXPECT_EQ(MouseEvent(Mouse::None).filter(), EventFilter::MouseMove);
+  EXPECT_EQ(MouseEvent(Mouse::Left).filter(), EventFilter::MouseButton);
+
+  int caught = 0;
+  int child_events = 0;
+  auto child = CatchEvent(Renderer([] { return text(""); }), [&](Event) {
+    child_events++;
+    return false;
+  });
+  auto component = CatchEvent(
+      child,
+      [&](Event) {
+        caught++;
+        return false;
+      },
+      EventFilter::Keyboard | EventFilter::MouseButton);
+
+  const std::vector<Event> events = {
+      Event::Character('a'),
+      Event::Return,
+      Event::Custom,
+      Event::Paste("a"),
+      MouseEvent(Mouse::None),
+      MouseEvent(Mouse::Left),
+  };
+  for (const Event& event : events) {
+    component->OnEvent(event);
+  }
+  EXPECT_EQ(caught, 4);
+  // The child still receives all of them.
+  EXPECT_EQ(child_events, 6);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
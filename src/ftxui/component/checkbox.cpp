@@ -5,6 +5,7 @@
 #include "ftxui/component/component.hpp"       // for Make, Checkbox
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
 #include "ftxui/component/component_options.hpp"  // for CheckboxOption, EntryState
+#include "ftxui/component/entry_cache.hpp"        // for EntryCache
 #include "ftxui/component/event.hpp"              // for Event, Event::Return
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, focus, nothing, select
@@ -32,12 +33,12 @@ class CheckboxBase : public ComponentBase {
         is_focused || hovered_,
     };
     auto element =
-        (option_->transform ? option_->transform
-                            : CheckboxOption::Simple().transform)(state);
+        cache_.Get(state, option_->transform ? option_->transform
+                                             : CheckboxOption::Simple().transform);
     return element | focus_management | reflect(box_);
   }
 
-  bool OnEvent(Event event) override {
+  bool HandleEvent(const Event& event) override {
     if (!CaptureMouse(event)) {
       return false;
     }
@@ -46,7 +47,7 @@ class CheckboxBase : public ComponentBase {
       return OnMouseEvent(event);
     }
 
-    hovered_ = false;
+    SetHovered(false);
     if (event == Event::Character(' ') || event == Event::Return) {
       *state_ = !*state_;
       option_->on_change();
@@ -56,8 +57,8 @@ class CheckboxBase : public ComponentBase {
     return false;
   }
 
-  bool OnMouseEvent(Event event) {
-    hovered_ = box_.Contain(event.mouse().x, event.mouse().y);
+  bool OnMouseEvent(const Event& event) {
+    SetHovered(box_.Contain(event.mouse().x, event.mouse().y));
 
     if (!CaptureMouse(event)) {
       return false;
@@ -77,9 +78,17 @@ class CheckboxBase : public ComponentBase {
     return false;
   }
 
+  void SetHovered(bool hovered) {
+    if (hovered != hovered_) {
+      hovered_ = hovered;
+      Invalidate();
+    }
+  }
+
   bool Focusable() const final { return true; }
 
   ConstStringRef label_;
+  EntryCache cache_;
   bool* const state_;
   bool hovered_ = false;
   Ref<CheckboxOption> option_;
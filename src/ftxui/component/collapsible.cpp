@@ -2,7 +2,7 @@
 #include <memory>      // for shared_ptr, allocator
 #include <utility>     // for move
 
-#include "ftxui/component/component.hpp"  // for Checkbox, Maybe, Make, Vertical, Collapsible
+#include "ftxui/component/component.hpp"  // for Checkbox, Maybe, Make, Vertical, Collapsible, Lazy
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
 #include "ftxui/component/component_options.hpp"  // for CheckboxOption, EntryState
 #include "ftxui/dom/elements.hpp"  // for operator|=, text, hbox, Element, bold, inverted
@@ -54,6 +54,24 @@ Component Collapsible(ConstStringRef label, Component child, Ref<bool> show) {
   return Make<Impl>(std::move(label), std::move(child), show);
 }
 
+/// @brief Same as Collapsible(), but the children is built by |factory| the
+/// first time it is displayed. Folded sections cost nothing until then.
+/// @params label The label of the checkbox.
+/// @params factory The function building the children to display.
+/// @params show Hold the state about whether the children is displayed or not.
+/// @see Lazy
+///
+/// ### Example
+/// ```cpp
+/// auto component = Collapsible("Show details", [&] { return Details(); });
+/// ```
+Component Collapsible(ConstStringRef label,
+                      std::function<Component()> factory,
+                      Ref<bool> show) {
+  return Collapsible(std::move(label), Lazy(std::move(factory)),
+                     std::move(show));
+}
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
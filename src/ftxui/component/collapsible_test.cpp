@@ -25,7 +25,7 @@ TEST(CollapsibleTest, Basic) {
     Screen screen(8, 3);
     Render(screen, collapsible->Render());
     EXPECT_EQ(screen.ToString(),
-              "\xE2\x96\xB6 \x1B[1m\x1B[7mparent\x1B[22m\x1B[27m\r\n"
+              "\xE2\x96\xB6 \x1B[1;7mparent\x1B[0m\r\n"
               "        \r\n"
               "        ");
   }
@@ -37,7 +37,7 @@ TEST(CollapsibleTest, Basic) {
     Screen screen(8, 3);
     Render(screen, collapsible->Render());
     EXPECT_EQ(screen.ToString(),
-              "\xE2\x96\xBC \x1B[1m\x1B[7mparent\x1B[22m\x1B[27m\r\n"
+              "\xE2\x96\xBC \x1B[1;7mparent\x1B[0m\r\n"
               "child   \r\n"
               "        ");
   }
@@ -46,6 +46,33 @@ TEST(CollapsibleTest, Basic) {
   EXPECT_EQ(show, false);
 }
 
+TEST(CollapsibleTest, Factory) {
+  int built = 0;
+  bool show = false;
+  auto collapsible = Collapsible(
+      "parent",
+      [&] {
+        built++;
+        return Renderer([] { return text("child"); });
+      },
+      &show);
+
+  Screen screen(8, 3);
+  Render(screen, collapsible->Render());
+  EXPECT_EQ(built, 0);
+
+  // Built when expanded for the first time only.
+  for (int i = 0; i < 2; ++i) {
+    collapsible->OnEvent(Event::Return);
+    EXPECT_EQ(show, true);
+    Render(screen, collapsible->Render());
+    EXPECT_EQ(screen.PixelAt(0, 1).character, "c");
+    collapsible->OnEvent(Event::Return);
+    EXPECT_EQ(show, false);
+  }
+  EXPECT_EQ(built, 1);
+}
+
 }  // namespace ftxui
 
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
@@ -1,7 +1,9 @@
 #include <algorithm>  // for find_if
+#include <atomic>     // for atomic
 #include <cassert>    // for assert
 #include <cstddef>    // for size_t
 #include <iterator>   // for begin, end
+#include <typeinfo>   // for typeid
 #include <utility>    // for move
 #include <vector>     // for vector, __alloc_traits<>::value_type
 
@@ -11,6 +13,9 @@
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/component/screen_interactive.hpp"  // for Component, ScreenInteractive
 #include "ftxui/dom/elements.hpp"                  // for text, Element
+#include "ftxui/dom/profiler.hpp"                  // for TreeReport
+#include "ftxui/dom/tree_helper.hpp"               // for Describe
+#include "ftxui/screen/util.hpp"                   // for HeapSize
 
 namespace ftxui::animation {
 class Params;
@@ -20,6 +25,17 @@ namespace ftxui {
 
 namespace {
 class CaptureMouseImpl : public CapturedMouseInterface {};
+
+// The generation of the focus state cached by the components. Zero when no
+// FocusCacheScope is alive on the current thread.
+thread_local size_t g_focus_generation = 0;
+std::atomic<size_t> g_focus_next_generation = 0;
+
+void InvalidateFocusCache() {
+  if (g_focus_generation != 0) {
+    g_focus_generation = ++g_focus_next_generation;
+  }
+}
 }  // namespace
 
 ComponentBase::~ComponentBase() {
@@ -47,6 +63,14 @@ size_t ComponentBase::ChildCount() const {
   return children_.size();
 }
 
+/// @brief The bytes of memory held by this component, without its children.
+/// By default, the object allocated by Make(), and the list of children.
+/// @see DescribeTree
+/// @ingroup component
+size_t ComponentBase::MemoryUsage() const {
+  return allocated_size_ + util::HeapSize(children_);
+}
+
 /// @brief Add a child.
 /// @@param child The child to be attached.
 /// @ingroup component
@@ -54,6 +78,7 @@ void ComponentBase::Add(Component child) {
   child->Detach();
   child->parent_ = this;
   children_.push_back(std::move(child));
+  InvalidateFocusCache();
 }
 
 /// @brief Detach this child from its parent.
@@ -71,15 +96,20 @@ void ComponentBase::Detach() {
                          });
   ComponentBase* parent = parent_;
   parent_ = nullptr;
+  InvalidateFocusCache();
   parent->children_.erase(it);  // Might delete |this|.
 }
 
 /// @brief Remove all children.
 /// @ingroup component
 void ComponentBase::DetachAllChildren() {
-  while (!children_.empty()) {
-    children_[0]->Detach();
+  // Detaching them one by one would shift the remaining ones every time.
+  const Components children = std::move(children_);
+  children_.clear();
+  for (const Component& child : children) {
+    child->parent_ = nullptr;
   }
+  InvalidateFocusCache();
 }
 
 /// @brief Draw the component.
@@ -101,8 +131,38 @@ Element ComponentBase::Render() {
 /// true. If none returns true, return false.
 /// @ingroup component
 bool ComponentBase::OnEvent(Event event) {  // NOLINT
-  for (Component& child : children_) {      // NOLINT
-    if (child->OnEvent(event)) {
+  if (in_handle_event_) {
+    return DispatchToChildren(event);
+  }
+  in_on_event_ = true;
+  const bool handled = HandleEvent(event);
+  in_on_event_ = false;
+  return handled;
+}
+
+/// @brief Called in response to an event, without copying it.
+/// @param event The event.
+/// @return True when the event has been handled.
+/// The default implementation calls OnEvent(), with a copy of the event. When
+/// none of them is overridden, the event is given to the children.
+/// @ingroup component
+bool ComponentBase::HandleEvent(const Event& event) {
+  // A plain ComponentBase overrides nothing, it doesn't need the copy.
+  if (in_on_event_ || typeid(*this) == typeid(ComponentBase)) {
+    return DispatchToChildren(event);
+  }
+  in_handle_event_ = true;
+  const bool handled = OnEvent(event);
+  in_handle_event_ = false;
+  return handled;
+}
+
+/// @brief Give the |event| to every child, until one handles it.
+/// @return True when the event has been handled.
+/// @ingroup component
+bool ComponentBase::DispatchToChildren(const Event& event) {
+  for (Component& child : children_) {  // NOLINT
+    if (child->HandleEvent(event)) {
       return true;
     }
   }
@@ -124,7 +184,7 @@ void ComponentBase::OnAnimation(animation::Params& params) {
 /// @ingroup component
 Component ComponentBase::ActiveChild() {
   for (auto& child : children_) {
-    if (child->Focusable()) {
+    if (child->CachedFocusable()) {
       return child;
     }
   }
@@ -137,7 +197,7 @@ Component ComponentBase::ActiveChild() {
 /// @ingroup component
 bool ComponentBase::Focusable() const {
   for (const Component& child : children_) {  // NOLINT
-    if (child->Focusable()) {
+    if (child->CachedFocusable()) {
       return true;
     }
   }
@@ -156,11 +216,36 @@ bool ComponentBase::Active() const {
 /// Focusable().
 /// @ingroup component
 bool ComponentBase::Focused() const {
-  const auto* current = this;
-  while (current && current->Active()) {
-    current = current->parent_;
+  if (g_focus_generation == 0) {
+    const auto* current = this;
+    while (current && current->Active()) {
+      current = current->parent_;
+    }
+    return !current && Focusable();
+  }
+  return ActivePath() && CachedFocusable();
+}
+
+// Whether the component and all its ancestors are active. Only used within a
+// FocusCacheScope.
+bool ComponentBase::ActivePath() const {
+  if (active_path_generation_ != g_focus_generation) {
+    active_path_ = Active() && (parent_ == nullptr || parent_->ActivePath());
+    active_path_generation_ = g_focus_generation;
+  }
+  return active_path_;
+}
+
+// Same as Focusable(), reused within a FocusCacheScope.
+bool ComponentBase::CachedFocusable() const {
+  if (g_focus_generation == 0) {
+    return Focusable();
+  }
+  if (focusable_generation_ != g_focus_generation) {
+    focusable_ = Focusable();
+    focusable_generation_ = g_focus_generation;
   }
-  return !current && Focusable();
+  return focusable_;
 }
 
 /// @brief Make the |child| to be the "active" one.
@@ -173,16 +258,52 @@ void ComponentBase::SetActiveChild(ComponentBase* /*child*/) {}
 /// @ingroup component
 void ComponentBase::SetActiveChild(Component child) {  // NOLINT
   SetActiveChild(child.get());
+  InvalidateFocusCache();
 }
 
 /// @brief Configure all the ancestors to give focus to this component.
 /// @ingroup component
 void ComponentBase::TakeFocus() {
+  bool changed = false;
   ComponentBase* child = this;
   while (ComponentBase* parent = child->parent_) {
+    changed |= parent->ActiveChild().get() != child;
     parent->SetActiveChild(child);
     child = parent;
   }
+  if (changed) {
+    InvalidateFocusCache();
+    Invalidate();
+  }
+}
+
+ComponentBase::FocusCacheScope::FocusCacheScope()
+    : previous_(g_focus_generation) {
+  g_focus_generation = ++g_focus_next_generation;
+}
+
+ComponentBase::FocusCacheScope::~FocusCacheScope() {
+  g_focus_generation = previous_;
+}
+
+/// @brief Ask the active screen to draw a new frame. To be called when the
+/// component changes its appearance while handling an event without reporting
+/// it as handled, like when the mouse hovers it.
+/// @ingroup component
+void ComponentBase::Invalidate() {
+  if (ScreenInteractive* screen = ScreenInteractive::Active()) {
+    screen->RequestRedraw();
+  }
+}
+
+/// @brief Ask the terminal to report the mouse movements during the next
+/// frame, to show where the mouse hovers. Called while rendering.
+/// @see ScreenInteractive::MouseMotionOnDemand
+/// @ingroup component
+void ComponentBase::RequestMouseMotion() {
+  if (ScreenInteractive* screen = ScreenInteractive::Active()) {
+    screen->RequestMouseMotion();
+  }
 }
 
 /// @brief Take the CapturedMouse if available. There is only one component of
@@ -196,6 +317,34 @@ CapturedMouse ComponentBase::CaptureMouse(const Event& event) {  // NOLINT
   return std::make_unique<CaptureMouseImpl>();
 }
 
+/// @brief Count the components of a tree, by type, with the memory they hold,
+/// and find its largest subtrees. With DescribeTree() of the Element they
+/// render, it tells what holds the memory of a long running application.
+/// @param root The root of the tree, like the component of the loop.
+/// @param largest The number of subtrees reported.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// const TreeReport report = DescribeTree(*root);
+/// for (const TreeReport::Type& type : report.types) {
+///   log << type.name << ": " << type.count << " " << type.bytes << "B\n";
+/// }
+/// ```
+TreeReport DescribeTree(const ComponentBase& root, size_t largest) {
+  return tree_helper::Describe(
+      root, largest,
+      [](const ComponentBase& component, const auto& f) {
+        for (size_t i = 0; i < component.children_.size(); ++i) {
+          if (component.children_[i]) {
+            f(i, *component.children_[i]);
+          }
+        }
+      },
+      [](const ComponentBase& component) { return component.MemoryUsage(); });
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
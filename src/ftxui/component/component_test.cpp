@@ -3,6 +3,7 @@
 
 #include "ftxui/component/component.hpp"       // for Make
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/event.hpp"           // for Event, Event::Return
 
 namespace ftxui {
 
@@ -169,6 +170,102 @@ TEST(ComponentTest, NonFocusableAreNotFocused) {
   EXPECT_EQ(child->ActiveChild(), nullptr);
 }
 
+TEST(ComponentTest, FocusCache) {
+  class Leaf : public ComponentBase {
+   public:
+    bool Focusable() const override {
+      calls++;
+      return focusable;
+    }
+    bool focusable = true;
+    mutable int calls = 0;
+  };
+
+  // A deep chain of components, ending with two leaves.
+  auto root = Make();
+  auto parent = root;
+  for (int i = 0; i < 100; ++i) {
+    auto child = Make();
+    parent->Add(child);
+    parent = child;
+  }
+  auto leaf_1 = Make<Leaf>();
+  auto leaf_2 = Make<Leaf>();
+  parent->Add(leaf_1);
+  parent->Add(leaf_2);
+
+  // Without a scope, every ancestor asks the leaves again.
+  EXPECT_TRUE(leaf_1->Focused());
+  EXPECT_GT(leaf_1->calls, 100);
+
+  {
+    const ComponentBase::FocusCacheScope scope;
+    leaf_1->calls = 0;
+    for (int i = 0; i < 10; ++i) {
+      EXPECT_TRUE(leaf_1->Focused());
+      EXPECT_FALSE(leaf_2->Focused());
+    }
+    EXPECT_EQ(leaf_1->calls, 1);
+
+    // The cache is invalidated by the changes of the tree.
+    leaf_1->Detach();
+    EXPECT_TRUE(leaf_2->Focused());
+  }
+
+  // Not cached outside of the scope.
+  leaf_2->focusable = false;
+  EXPECT_FALSE(leaf_2->Focused());
+}
+
+TEST(ComponentTest, HandleEventWithoutCopy) {
+  class Legacy : public ComponentBase {
+   public:
+    bool OnEvent(Event event) override {
+      if (event == Event::Return) {
+        return true;
+      }
+      return ComponentBase::OnEvent(event);
+    }
+  };
+  class ByReference : public ComponentBase {
+   public:
+    bool HandleEvent(const Event& event) override {
+      received = &event;
+      return event == Event::Character('a');
+    }
+    const Event* received = nullptr;
+  };
+
+  auto root = Make();
+  auto parent = Make();
+  auto leaf = Make<ByReference>();
+  auto legacy = Make<Legacy>();
+  auto legacy_leaf = Make<ByReference>();
+  root->Add(parent);
+  parent->Add(leaf);
+  root->Add(legacy);
+  legacy->Add(legacy_leaf);
+
+  // The event reaches |leaf| without being copied.
+  const Event a = Event::Character('a');
+  EXPECT_TRUE(root->HandleEvent(a));
+  EXPECT_EQ(leaf->received, &a);
+  EXPECT_EQ(legacy_leaf->received, nullptr);
+
+  // The components overriding OnEvent() still receive the events, and give
+  // them to their children.
+  EXPECT_TRUE(root->HandleEvent(Event::Return));
+  const Event b = Event::Character('b');
+  EXPECT_FALSE(root->OnEvent(b));
+  EXPECT_NE(legacy_leaf->received, nullptr);
+  EXPECT_NE(legacy_leaf->received, &b);
+
+  // Calling OnEvent() reaches the HandleEvent() override.
+  leaf->received = nullptr;
+  EXPECT_TRUE(leaf->OnEvent(a));
+  EXPECT_NE(leaf->received, nullptr);
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
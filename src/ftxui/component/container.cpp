@@ -1,14 +1,18 @@
 #include <algorithm>  // for max, min
 #include <cstddef>    // for size_t
+#include <deque>      // for deque
+#include <functional>  // for function
 #include <memory>  // for make_shared, __shared_ptr_access, allocator, shared_ptr, allocator_traits<>::value_type
-#include <utility>  // for move
-#include <vector>   // for vector, __alloc_traits<>::value_type
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/component/component.hpp"  // for Horizontal, Vertical, Tab
+#include "ftxui/component/animation.hpp"  // for Params, RequestAnimationFrame
+#include "ftxui/component/component.hpp"  // for Horizontal, Vertical, Tab, LazyTab, Lazy
 #include "ftxui/component/component_base.hpp"  // for Components, Component, ComponentBase
 #include "ftxui/component/event.hpp"  // for Event, Event::Tab, Event::TabReverse, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp
-#include "ftxui/dom/elements.hpp"  // for text, Elements, operator|, reflect, Element, hbox, vbox
+#include "ftxui/dom/elements.hpp"  // for text, Elements, operator|, reflect, Element, hbox, vbox, virtualList
 #include "ftxui/screen/box.hpp"  // for Box
 
 namespace ftxui {
@@ -23,7 +27,7 @@ class ContainerBase : public ComponentBase {
   }
 
   // Component override.
-  bool OnEvent(Event event) override {
+  bool HandleEvent(const Event& event) override {
     if (event.is_mouse()) {
       return OnMouseEvent(event);
     }
@@ -32,7 +36,7 @@ class ContainerBase : public ComponentBase {
       return false;
     }
 
-    if (ActiveChild() && ActiveChild()->OnEvent(event)) {
+    if (ActiveChild() && ActiveChild()->HandleEvent(event)) {
       return true;
     }
 
@@ -48,24 +52,41 @@ class ContainerBase : public ComponentBase {
   }
 
   void SetActiveChild(ComponentBase* child) override {
-    for (size_t i = 0; i < children_.size(); ++i) {
-      if (children_[i].get() == child) {
-        *selector_ = (int)i;
-        return;
-      }
+    const int index = IndexOf(child);
+    if (index != -1) {
+      *selector_ = index;
     }
   }
 
  protected:
+  // The index of |child|, or -1 if it isn't a child. The indexes are kept in a
+  // map, rebuilt when it doesn't match the children anymore.
+  int IndexOf(ComponentBase* child) {
+    auto it = indexes_.find(child);
+    if (it == indexes_.end() || it->second >= children_.size() ||
+        children_[it->second].get() != child) {
+      indexes_.clear();
+      for (size_t i = 0; i < children_.size(); ++i) {
+        indexes_[children_[i].get()] = i;
+      }
+      it = indexes_.find(child);
+      if (it == indexes_.end()) {
+        return -1;
+      }
+    }
+    return int(it->second);
+  }
+
   // Handlers
-  virtual bool EventHandler(Event /*unused*/) { return false; }  // NOLINT
+  virtual bool EventHandler(const Event& /*unused*/) { return false; }  // NOLINT
 
-  virtual bool OnMouseEvent(Event event) {
-    return ComponentBase::OnEvent(std::move(event));
+  virtual bool OnMouseEvent(const Event& event) {
+    return DispatchToChildren(event);
   }
 
   int selected_ = 0;
   int* selector_ = nullptr;
+  std::unordered_map<ComponentBase*, size_t> indexes_;
 
   void MoveSelector(int dir) {
     for (int i = *selector_ + dir; i >= 0 && i < (int)children_.size();
@@ -107,7 +128,7 @@ class VerticalContainer : public ContainerBase {
     return vbox(std::move(elements)) | reflect(box_);
   }
 
-  bool EventHandler(Event event) override {
+  bool EventHandler(const Event& event) override {
     const int old_selected = *selector_;
     if (event == Event::ArrowUp || event == Event::Character('k')) {
       MoveSelector(-1);
@@ -146,8 +167,8 @@ class VerticalContainer : public ContainerBase {
     return old_selected != *selector_;
   }
 
-  bool OnMouseEvent(Event event) override {
-    if (ContainerBase::OnMouseEvent(event)) {
+  bool OnMouseEvent(const Event& event) override {
+    if (DispatchMouseEvent(event)) {
       return true;
     }
 
@@ -171,9 +192,76 @@ class VerticalContainer : public ContainerBase {
     return true;
   }
 
+  // Give the mouse |event| to the children, before scrolling.
+  virtual bool DispatchMouseEvent(const Event& event) {
+    return ContainerBase::OnMouseEvent(event);
+  }
+
   Box box_;
 };
 
+// A VerticalContainer whose children are all |row_height| rows high. Only the
+// children visible through the enclosing frame are rendered, and the mouse
+// events go to the child under the mouse and the active one.
+class VirtualVerticalContainer : public VerticalContainer {
+ public:
+  VirtualVerticalContainer(Components children, int* selector, int row_height)
+      : VerticalContainer(std::move(children), selector),
+        row_height_(row_height) {}
+
+  Element Render() override {
+    visible_.clear();
+    if (children_.empty()) {
+      return text("Empty container") | reflect(box_);
+    }
+    const int count = int(children_.size());
+    const int selected = std::max(0, std::min(count - 1, *selector_));
+    auto row = [this](int i) {
+      VisibleChild& visible = visible_.emplace_back();
+      visible.index = i;
+      return children_[i]->Render() | reflect(visible.box);
+    };
+    return virtualList(count, row_height_, std::move(row), selected) |
+           reflect(box_);
+  }
+
+  bool DispatchMouseEvent(const Event& event) override {
+    const int hovered = ChildAt(event.mouse().x, event.mouse().y);
+    if (hovered != -1 && children_[hovered]->HandleEvent(event)) {
+      return true;
+    }
+
+    // The active child may have captured the mouse, outside of its box.
+    if (children_.empty()) {
+      return false;
+    }
+    const int active =
+        std::max(0, std::min(int(children_.size()) - 1, *selector_));
+    return active != hovered && children_[active]->HandleEvent(event);
+  }
+
+ private:
+  // The child drawn onto the cell (x, y) during the last frame, or -1.
+  int ChildAt(int x, int y) const {
+    for (const VisibleChild& visible : visible_) {
+      if (visible.box.Contain(x, y)) {
+        return visible.index;
+      }
+    }
+    return -1;
+  }
+
+  // The children drawn during the last frame. The boxes are referenced by
+  // reflect(), a deque keeps them in place. The row created by virtualList()
+  // to estimate its width is never drawn: its box remains empty.
+  struct VisibleChild {
+    int index = 0;
+    Box box = {0, -1, 0, -1};
+  };
+  std::deque<VisibleChild> visible_;
+  const int row_height_;
+};
+
 class HorizontalContainer : public ContainerBase {
  public:
   using ContainerBase::ContainerBase;
@@ -189,7 +277,7 @@ class HorizontalContainer : public ContainerBase {
     return hbox(std::move(elements));
   }
 
-  bool EventHandler(Event event) override {
+  bool EventHandler(const Event& event) override {
     const int old_selected = *selector_;
     if (event == Event::ArrowLeft || event == Event::Character('h')) {
       MoveSelector(-1);
@@ -214,6 +302,11 @@ class TabContainer : public ContainerBase {
   using ContainerBase::ContainerBase;
 
   Element Render() override {
+    // A tab hidden during the last animation frames is shown: it missed them.
+    if (animated_selector_ != -1 && animated_selector_ != *selector_) {
+      animated_selector_ = -1;
+      animation::RequestAnimationFrame();
+    }
     const Component active_child = ActiveChild();
     if (active_child) {
       return active_child->Render();
@@ -221,6 +314,17 @@ class TabContainer : public ContainerBase {
     return text("Empty container");
   }
 
+  // Only the tab shown is animated. The hidden ones don't request frames.
+  void OnAnimation(animation::Params& params) override {
+    if (children_.empty()) {
+      return;
+    }
+    children_[*selector_ % children_.size()]->OnAnimation(params);
+    if (children_.size() > 1) {
+      animated_selector_ = *selector_;
+    }
+  }
+
   bool Focusable() const override {
     if (children_.empty()) {
       return false;
@@ -228,9 +332,12 @@ class TabContainer : public ContainerBase {
     return children_[*selector_ % children_.size()]->Focusable();
   }
 
-  bool OnMouseEvent(Event event) override {
-    return ActiveChild() && ActiveChild()->OnEvent(event);
+  bool OnMouseEvent(const Event& event) override {
+    return ActiveChild() && ActiveChild()->HandleEvent(event);
   }
+
+  // The tab shown during the last animation frame, when others were hidden.
+  int animated_selector_ = -1;
 };
 
 namespace Container {
@@ -277,6 +384,33 @@ Component Vertical(Components children, int* selector) {
   return std::make_shared<VerticalContainer>(std::move(children), selector);
 }
 
+/// @brief Same as Vertical(), for a large number of children, all
+/// |row_height| rows high. Only the children visible through the enclosing
+/// frame are rendered. The mouse events only go to the child under the mouse
+/// and to the selected one.
+/// @param children the list of components.
+/// @param selector A reference to the index of the selected children.
+/// @param row_height The height of every child.
+/// @ingroup component
+/// @see Vertical
+///
+/// ### Example
+///
+/// ```cpp
+/// Components rows;
+/// for (int i = 0; i < 50'000; ++i) {
+///   rows.push_back(Checkbox(labels[i], &checked[i]));
+/// }
+/// auto container = Container::VirtualVertical(std::move(rows));
+/// auto renderer = Renderer(container, [&] {
+///   return container->Render() | vscroll_indicator | yframe;
+/// });
+/// ```
+Component VirtualVertical(Components children, int* selector, int row_height) {
+  return std::make_shared<VirtualVerticalContainer>(std::move(children),
+                                                    selector, row_height);
+}
+
 /// @brief A list of components, drawn one by one horizontally and navigated
 /// horizontally using left/right arrow key or 'h'/'l' keys.
 /// @param children the list of components.
@@ -343,6 +477,33 @@ Component Tab(Components children, int* selector) {
   return std::make_shared<TabContainer>(std::move(children), selector);
 }
 
+/// @brief Same as Tab(), but the components are built by the |factories| the
+/// first time they are drawn. Once built, they are kept with their state.
+/// @param factories The functions building the components.
+/// @param selector The index of the drawn children.
+/// @ingroup component
+/// @see Tab
+/// @see Lazy
+///
+/// ### Example
+///
+/// ```cpp
+/// int tab_drawn = 0;
+/// auto container = Container::LazyTab({
+///   [&] { return BuildHomePage(); },
+///   [&] { return BuildSettingsPage(); },
+/// }, &tab_drawn);
+/// ```
+Component LazyTab(std::vector<std::function<Component()>> factories,
+                  int* selector) {
+  Components children;
+  children.reserve(factories.size());
+  for (auto& factory : factories) {
+    children.push_back(Lazy(std::move(factory)));
+  }
+  return Tab(std::move(children), selector);
+}
+
 }  // namespace Container
 
 }  // namespace ftxui
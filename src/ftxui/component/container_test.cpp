@@ -1,9 +1,17 @@
 #include <gtest/gtest.h>
-#include <memory>  // for __shared_ptr_access, shared_ptr, allocator
+#include <chrono>  // for milliseconds
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator, make_unique
+#include <string>  // for to_string
 
-#include "ftxui/component/component.hpp"  // for Horizontal, Vertical, Button, Tab
+#include "ftxui/component/animation.hpp"  // for Params, RequestAnimationFrame
+#include "ftxui/component/component.hpp"  // for Horizontal, Vertical, Button, Tab, LazyTab
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
 #include "ftxui/component/event.hpp"  // for Event, Event::Tab, Event::TabReverse, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp
+#include "ftxui/component/loop.hpp"   // for Loop
+#include "ftxui/component/mouse.hpp"  // for Mouse
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"  // for yframe, operator|
+#include "ftxui/screen/screen.hpp"  // for Screen
 
 namespace ftxui {
 
@@ -14,6 +22,21 @@ Component Focusable() {
 Component NonFocusable() {
   return Container::Horizontal({});
 }
+
+// Requests a new animation frame after every one.
+class Animated : public ComponentBase {
+ public:
+  explicit Animated(int* frames) : frames_(frames) {}
+
+ private:
+  Element Render() override { return text(""); }
+  void OnAnimation(animation::Params& /*params*/) override {
+    ++*frames_;
+    animation::RequestAnimationFrame();
+  }
+
+  int* frames_;
+};
 }  // namespace
 
 TEST(ContainerTest, HorizontalEvent) {
@@ -332,6 +355,148 @@ TEST(ContainerTest, TabFocusable) {
   EXPECT_FALSE(c->Focused());
 }
 
+TEST(ContainerTest, LazyTab) {
+  int selected = 0;
+  int built_1 = 0;
+  int built_2 = 0;
+  auto c = Container::LazyTab(
+      {
+          [&] {
+            built_1++;
+            return Container::Vertical({Focusable(), Focusable()});
+          },
+          [&] {
+            built_2++;
+            return NonFocusable();
+          },
+      },
+      &selected);
+  EXPECT_EQ(built_1, 0);
+  EXPECT_EQ(built_2, 0);
+
+  (void)c->Render();
+  EXPECT_EQ(built_1, 1);
+  EXPECT_EQ(built_2, 0);
+  EXPECT_TRUE(c->OnEvent(Event::ArrowDown));
+
+  // Not focusable once built.
+  selected = 1;
+  EXPECT_TRUE(c->Focusable());
+  (void)c->Render();
+  EXPECT_EQ(built_2, 1);
+  EXPECT_FALSE(c->Focusable());
+
+  // The first tab is kept, with its state.
+  selected = 0;
+  (void)c->Render();
+  EXPECT_EQ(built_1, 1);
+  EXPECT_FALSE(c->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(c->OnEvent(Event::ArrowUp));
+}
+
+TEST(ContainerTest, TabAnimatesTheTabShown) {
+  int frames_0 = 0;
+  int frames_1 = 0;
+  int selected = 0;
+  auto tab = Container::Tab(
+      {Make<Animated>(&frames_0), Make<Animated>(&frames_1)}, &selected);
+
+  auto screen = ScreenInteractive::Headless(1, 1);
+  Loop loop(&screen, tab);
+  screen.Post([&] { screen.RequestAnimationFrame(); });
+  loop.RunOnce();
+  for (int i = 0; i < 3; ++i) {
+    screen.AdvanceTime(std::chrono::milliseconds(20));
+    loop.RunOnce();
+  }
+  EXPECT_EQ(frames_0, 3);
+  EXPECT_EQ(frames_1, 0);
+
+  // The hidden tab stops requesting frames. The tab shown gets them back.
+  screen.Post([&] { selected = 1; });
+  loop.RunOnce();
+  for (int i = 0; i < 3; ++i) {
+    screen.AdvanceTime(std::chrono::milliseconds(20));
+    loop.RunOnce();
+  }
+  EXPECT_EQ(frames_0, 3);
+  EXPECT_EQ(frames_1, 3);
+}
+
+TEST(ContainerTest, MaybeAnimatesWhenShown) {
+  int frames = 0;
+  bool show = false;
+  auto maybe = Maybe(Make<Animated>(&frames), &show);
+
+  auto screen = ScreenInteractive::Headless(1, 1);
+  Loop loop(&screen, maybe);
+  screen.Post([&] { screen.RequestAnimationFrame(); });
+  loop.RunOnce();
+  screen.AdvanceTime(std::chrono::milliseconds(20));
+  loop.RunOnce();
+  screen.AdvanceTime(std::chrono::milliseconds(20));
+  loop.RunOnce();
+  EXPECT_EQ(frames, 0);
+
+  show = true;
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  screen.AdvanceTime(std::chrono::milliseconds(20));
+  loop.RunOnce();
+  screen.AdvanceTime(std::chrono::milliseconds(20));
+  loop.RunOnce();
+  EXPECT_EQ(frames, 2);
+}
+
+TEST(ContainerTest, VirtualVertical) {
+  constexpr int kCount = 50'000;
+  auto checked = std::make_unique<bool[]>(kCount);
+  int rendered = 0;
+  Components rows;
+  for (int i = 0; i < kCount; ++i) {
+    auto checkbox = Checkbox("row " + std::to_string(i), &checked[i]);
+    rows.push_back(Renderer(checkbox, [&rendered, checkbox] {
+      rendered++;
+      return checkbox->Render();
+    }));
+  }
+  const Components all = rows;
+  int selected = 0;
+  auto container = Container::VirtualVertical(std::move(rows), &selected);
+
+  // Only the visible rows are rendered.
+  Screen screen(12, 5);
+  Render(screen, container->Render() | yframe);
+  EXPECT_LE(rendered, 6);
+
+  // The mouse events go to the row under the mouse.
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = Mouse::Pressed;
+  mouse.x = 1;
+  mouse.y = 2;
+  EXPECT_TRUE(container->OnEvent(Event::Mouse("", mouse)));
+  EXPECT_TRUE(checked[2]);
+  EXPECT_FALSE(checked[1]);
+
+  // Another row than the selected one, at the origin.
+  selected = 2;
+  Render(screen, container->Render() | yframe);
+  mouse.y = 0;
+  mouse.x = 0;
+  EXPECT_TRUE(container->OnEvent(Event::Mouse("", mouse)));
+  EXPECT_TRUE(checked[0]);
+
+  // The frame follows the selected row, far away.
+  all[40'000]->TakeFocus();
+  EXPECT_EQ(selected, 40'000);
+  rendered = 0;
+  screen = Screen(12, 5);
+  Render(screen, container->Render() | yframe);
+  EXPECT_LE(rendered, 6);
+  EXPECT_NE(screen.ToString().find("row 40000"), std::string::npos);
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
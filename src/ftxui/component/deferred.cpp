@@ -0,0 +1,99 @@
+#include <functional>  // for function
+#include <future>      // for future
+#include <memory>      // for make_shared, shared_ptr
+#include <utility>     // for move
+
+#include "ftxui/component/async.hpp"           // for RunInBackground
+#include "ftxui/component/component.hpp"       // for Deferred, Make
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for Element, retained
+
+namespace ftxui {
+
+/// @brief A component displaying |placeholder| while |content| is computed on
+/// the worker threads of the active screen, then the Element it returned. The
+/// content is computed once, the first time the component is rendered, so
+/// that the rendering never waits for it.
+/// @param content The function building the Element. It runs on a worker
+/// thread: it must not access the components, nor what the loop modifies.
+/// @param placeholder The Element displayed meanwhile.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto weather = Deferred(
+///     [] { return text(FetchForecast()); },  // Blocking.
+///     text("Loading…") | dim);
+/// ```
+Component Deferred(std::function<Element()> content, Element placeholder) {
+  class Impl : public ComponentBase {
+   public:
+    Impl(std::function<Element()> content, Element placeholder)
+        : content_(std::move(content)), element_(std::move(placeholder)) {}
+
+    ~Impl() override { *alive_ = false; }
+    Impl(const Impl&) = delete;
+    Impl(Impl&&) = delete;
+    Impl& operator=(const Impl&) = delete;
+    Impl& operator=(Impl&&) = delete;
+
+   private:
+    Element Render() override {
+      if (content_) {
+        Start();
+      }
+      return element_;
+    }
+
+    void Start() {
+      auto result = std::make_shared<Element>();
+      RunInBackground(
+          [result, content = std::move(content_)] { *result = content(); },
+          [this, alive = alive_, result] {
+            if (!*alive) {
+              return;
+            }
+            // Its layout is reused by the next frames.
+            element_ = retained(std::move(*result));
+            if (auto* screen = ScreenInteractive::Active()) {
+              screen->RequestRedraw();
+            }
+          });
+      content_ = nullptr;
+    }
+
+    std::function<Element()> content_;
+    Element element_;
+    // Whether the component still exists, when the content is computed.
+    std::shared_ptr<bool> alive_ = std::make_shared<bool>(true);
+  };
+
+  return Make<Impl>(std::move(content), std::move(placeholder));
+}
+
+/// @brief A component displaying |placeholder| until |content| is ready, then
+/// the Element it holds. A worker thread of the active screen waits for it.
+/// @param content The Element computed elsewhere.
+/// @param placeholder The Element displayed meanwhile.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// std::future<Element> forecast = std::async(std::launch::async, [] {
+///   return text(FetchForecast());
+/// });
+/// auto weather = Deferred(std::move(forecast), text("Loading…") | dim);
+/// ```
+Component Deferred(std::future<Element> content, Element placeholder) {
+  auto future = std::make_shared<std::future<Element>>(std::move(content));
+  return Deferred([future] { return future->get(); }, std::move(placeholder));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
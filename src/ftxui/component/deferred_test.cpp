@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <chrono>   // for milliseconds
+#include <future>   // for promise
+#include <string>   // for string
+#include <thread>   // for this_thread::sleep_for
+#include <utility>  // for move
+
+#include "ftxui/component/component.hpp"           // for Deferred
+#include "ftxui/component/loop.hpp"                // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+#include "ftxui/dom/node.hpp"                      // for Render
+#include "ftxui/screen/screen.hpp"                 // for Screen
+
+namespace ftxui {
+
+TEST(DeferredTest, Placeholder) {
+  std::promise<Element> content;
+  auto component = Deferred(content.get_future(), text("loading"));
+  auto screen = ScreenInteractive::Headless(7, 1);
+  Loop loop(&screen, component);
+
+  // The rendering doesn't wait for the content.
+  loop.RunOnce();
+  EXPECT_NE(screen.TakeOutput().find("loading"), std::string::npos);
+
+  content.set_value(text("ready"));
+  std::string output;
+  for (int i = 0; i < 1000 && output.find("ready") == std::string::npos;
+       ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    loop.RunOnce();
+    output += screen.TakeOutput();
+  }
+  EXPECT_NE(output.find("ready"), std::string::npos);
+}
+
+TEST(DeferredTest, WithoutScreen) {
+  // Without active screen, the content is computed immediately.
+  int computed = 0;
+  auto component = Deferred(
+      [&] {
+        computed++;
+        return text("ready");
+      },
+      text("loading"));
+  Screen screen(7, 1);
+  Render(screen, component->Render());
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "ready  ");
+  EXPECT_EQ(computed, 1);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,11 +1,12 @@
 #include <algorithm>   // for max, min
+#include <cstddef>     // for size_t
 #include <functional>  // for function
 #include <memory>      // for __shared_ptr_access, shared_ptr, allocator
 #include <string>      // for string
 
 #include "ftxui/component/component.hpp"  // for Maybe, Checkbox, Make, Radiobox, Vertical, Dropdown
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
-#include "ftxui/component/component_options.hpp"  // for CheckboxOption, EntryState
+#include "ftxui/component/component_options.hpp"  // for CheckboxOption, EntryState, RadioboxOption
 #include "ftxui/dom/elements.hpp"  // for operator|, Element, border, filler, operator|=, separator, size, text, vbox, frame, vscroll_indicator, hbox, HEIGHT, LESS_THAN, bold, inverted
 #include "ftxui/util/ref.hpp"      // for ConstStringListRef
 
@@ -28,24 +29,40 @@ Component Dropdown(ConstStringListRef entries, int* selected) {
         }
         return hbox({prefix, t});
       };
-      checkbox_ = Checkbox(&title_, &show_, option),
-      radiobox_ = Radiobox(entries_, selected_);
+      checkbox_ = Checkbox(&title_, &show_, option);
+      // The list is only built the first time the dropdown is opened. While
+      // closed, only the title is drawn.
+      list_ = Maybe(
+          [this] {
+            RadioboxOption radiobox_option;
+            radiobox_option.virtualized = true;
+            return Radiobox(entries_, selected_, radiobox_option);
+          },
+          &show_);
 
       Add(Container::Vertical({
           checkbox_,
-          Maybe(radiobox_, &show_),
+          list_,
       }));
     }
 
     Element Render() override {
       *selected_ = std::min((int)entries_.size() - 1, std::max(0, *selected_));
-      title_ = entries_[*selected_];
+      // Unless the list tells when its entries change, the title is copied
+      // again every frame.
+      const size_t version = entries_.version();
+      if (version == 0 || version != title_version_ ||
+          *selected_ != title_selected_) {
+        title_ = entries_[*selected_];
+        title_version_ = version;
+        title_selected_ = *selected_;
+      }
       if (show_) {
         const int max_height = 12;
         return vbox({
                    checkbox_->Render(),
                    separator(),
-                   radiobox_->Render() | vscroll_indicator | frame |
+                   list_->Render() | vscroll_indicator | frame |
                        size(HEIGHT, LESS_THAN, max_height),
                }) |
                border;
@@ -62,8 +79,10 @@ Component Dropdown(ConstStringListRef entries, int* selected) {
     bool show_ = false;
     int* selected_;
     std::string title_;
+    size_t title_version_ = 0;
+    int title_selected_ = -1;
     Component checkbox_;
-    Component radiobox_;
+    Component list_;
   };
 
   return Make<Impl>(entries, selected);
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+#include <vector>  // for vector
+
+#include "ftxui/component/component.hpp"       // for Dropdown
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowDown
+#include "ftxui/dom/elements.hpp"     // for Element
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+// The component holding the list: Dropdown > Vertical > Maybe > Lazy.
+ComponentBase* List(const Component& dropdown) {
+  return dropdown->ChildAt(0)->ChildAt(1)->ChildAt(0).get();
+}
+}  // namespace
+
+TEST(DropdownTest, ListBuiltWhenOpened) {
+  std::vector<std::string> entries;
+  for (int i = 0; i < 1000; ++i) {
+    entries.push_back("entry " + std::to_string(i));
+  }
+  int selected = 2;
+  auto dropdown = Dropdown(&entries, &selected);
+
+  // Closed: only the selected entry is drawn, and the list isn't built.
+  {
+    Screen screen(12, 4);
+    Render(screen, dropdown->Render());
+    EXPECT_NE(screen.ToString().find("entry 2"), std::string::npos);
+    EXPECT_EQ(screen.ToString().find("entry 3"), std::string::npos);
+  }
+  EXPECT_EQ(List(dropdown)->ChildCount(), 0u);
+
+  // Opened: the list is built, and the entries can be selected.
+  EXPECT_TRUE(dropdown->OnEvent(Event::Return));
+  {
+    Screen screen(12, 8);
+    Render(screen, dropdown->Render());
+    EXPECT_NE(screen.ToString().find("entry 3"), std::string::npos);
+  }
+  EXPECT_EQ(List(dropdown)->ChildCount(), 1u);
+  EXPECT_TRUE(dropdown->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(dropdown->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(dropdown->OnEvent(Event::Return));
+  EXPECT_EQ(selected, 3);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,55 @@
+#ifndef FTXUI_COMPONENT_ENTRY_CACHE_HPP
+#define FTXUI_COMPONENT_ENTRY_CACHE_HPP
+
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <utility>     // for move
+
+#include "ftxui/component/component_options.hpp"  // for EntryState
+#include "ftxui/dom/elements.hpp"                 // for Element
+#include "ftxui/dom/frame_arena.hpp"              // for FrameArena
+#include "ftxui/dom/node.hpp"                     // for Node
+#include "ftxui/dom/profiler.hpp"                 // for DescribeTree
+#include "ftxui/screen/util.hpp"                  // for HeapSize
+
+namespace ftxui {
+
+// The Element a transform produced for an EntryState, kept across frames. The
+// transform is called again only when the state, including the label, changes.
+//
+// The cached Element is allocated from the heap, not from the FrameArena of the
+// current frame: it outlives the frame, and would otherwise keep the memory of
+// the arena from being reused.
+class EntryCache {
+ public:
+  using Transform = std::function<Element(const EntryState&)>;
+
+  Element Get(const EntryState& state, const Transform& transform) {
+    if (!element_ || state.label != state_.label ||
+        state.state != state_.state || state.active != state_.active ||
+        state.focused != state_.focused) {
+      const FrameArena::Scope heap(nullptr);
+      state_ = state;
+      element_ = transform(state_);
+    }
+    return element_;
+  }
+
+  // The bytes held by the label, and by the cached Element.
+  size_t MemoryUsage() const {
+    return util::HeapSize(state_.label) +
+           (element_ ? DescribeTree(*element_, 0).bytes : 0);
+  }
+
+ private:
+  EntryState state_{};
+  Element element_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_ENTRY_CACHE_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,3 +1,7 @@
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t, uint8_t
+#include <string>       // for string
+#include <string_view>  // for string_view
 #include <utility>  // for move
 
 #include "ftxui/component/event.hpp"
@@ -9,7 +13,7 @@ namespace ftxui {
 // static
 Event Event::Character(std::string input) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(std::move(input));
   event.type_ = Type::Character;
   return event;
 }
@@ -27,7 +31,7 @@ Event Event::Character(wchar_t c) {
 // static
 Event Event::Mouse(std::string input, struct Mouse mouse) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(std::move(input));
   event.type_ = Type::Mouse;
   event.mouse_ = mouse;  // NOLINT
   return event;
@@ -36,20 +40,127 @@ Event Event::Mouse(std::string input, struct Mouse mouse) {
 // static
 Event Event::Special(std::string input) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(std::move(input));
   return event;
 }
 
 // static
 Event Event::CursorReporting(std::string input, int x, int y) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(std::move(input));
   event.type_ = Type::CursorReporting;
   event.cursor_.x = x;  // NOLINT
   event.cursor_.y = y;  // NOLINT
   return event;
 }
 
+// static
+Event Event::ModeReporting(std::string input, int mode, int value) {
+  Event event;
+  event.SetInput(std::move(input));
+  event.type_ = Type::ModeReporting;
+  event.mode_reporting_.mode = mode;    // NOLINT
+  event.mode_reporting_.value = value;  // NOLINT
+  return event;
+}
+
+// static
+Event Event::DeviceAttributes(std::string input, bool secondary, int type) {
+  Event event;
+  event.SetInput(std::move(input));
+  event.type_ = Type::DeviceAttributes;
+  event.device_attributes_.secondary = secondary;  // NOLINT
+  event.device_attributes_.type = type;            // NOLINT
+  return event;
+}
+
+/// @brief The reply to XTVERSION: DCS > | <version> ST.
+// static
+Event Event::TerminalVersion(std::string input) {
+  Event event;
+  event.SetInput(std::move(input));
+  event.type_ = Type::TerminalVersion;
+  return event;
+}
+
+namespace {
+constexpr std::string_view kTerminalVersionStart = "\x1BP>|";
+constexpr std::string_view kTerminalVersionEnd = "\x1B\\";
+constexpr std::string_view kPasteStart = "\x1B[200~";
+constexpr std::string_view kPasteEnd = "\x1B[201~";
+}  // namespace
+
+/// @brief A text pasted at once. The input is the text between the bracketed
+/// paste markers, so it doesn't compare equal to any Event::Character.
+// static
+Event Event::Paste(std::string text) {
+  Event event;
+  std::string input;
+  input.reserve(kPasteStart.size() + text.size() + kPasteEnd.size());
+  input += kPasteStart;
+  input += text;
+  input += kPasteEnd;
+  event.SetInput(std::move(input));
+  event.type_ = Type::Paste;
+  return event;
+}
+
+/// @brief The text of an Event::Paste.
+std::string Event::paste() const {
+  if (!is_paste()) {
+    return "";
+  }
+  return input_.substr(kPasteStart.size(),
+                       input_.size() - kPasteStart.size() - kPasteEnd.size());
+}
+
+/// @brief The name and the version of the terminal, like "XTerm(390)", from
+/// an Event::TerminalVersion.
+std::string Event::terminal_version() const {
+  if (!is_terminal_version() || input_.size() < kTerminalVersionStart.size() +
+                                                    kTerminalVersionEnd.size()) {
+    return "";
+  }
+  return input_.substr(kTerminalVersionStart.size(),
+                       input_.size() - kTerminalVersionStart.size() -
+                           kTerminalVersionEnd.size());
+}
+
+void Event::SetInput(std::string input) {
+  input_ = std::move(input);
+  // Pack the inputs of up to 7 bytes with their size. This covers the
+  // characters and the special keys. The longer ones get 0.
+  key_ = 0;
+  if (input_.size() <= 7) {  // NOLINT
+    key_ = uint64_t(input_.size()) << 56U;  // NOLINT
+    for (size_t i = 0; i < input_.size(); ++i) {
+      key_ |= uint64_t(uint8_t(input_[i])) << (8U * i);  // NOLINT
+    }
+  }
+}
+
+/// @brief The kind of the event, one of the EventFilter bits.
+/// @ingroup component
+EventFilter Event::filter() const {
+  switch (type_) {
+    case Type::Character:
+      return EventFilter::Character;
+    case Type::Mouse:
+      return mouse_.button == ftxui::Mouse::None ? EventFilter::MouseMove
+                                                 : EventFilter::MouseButton;
+    case Type::CursorReporting:
+    case Type::ModeReporting:
+    case Type::DeviceAttributes:
+    case Type::TerminalVersion:
+      return EventFilter::Reporting;
+    case Type::Paste:
+      return EventFilter::Paste;
+    case Type::Unknown:
+      break;
+  }
+  return *this == Event::Custom ? EventFilter::Custom : EventFilter::Special;
+}
+
 // --- Arrow ---
 const Event Event::ArrowLeft = Event::Special("\x1B[D");          // NOLINT
 const Event Event::ArrowRight = Event::Special("\x1B[C");         // NOLINT
@@ -0,0 +1,241 @@
+#include <algorithm>   // for min, search
+#include <atomic>      // for atomic
+#include <cstddef>     // for size_t
+#include <memory>      // for make_shared, shared_ptr
+#include <numeric>     // for iota
+#include <string>      // for string, to_string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include "ftxui/component/async.hpp"      // for RunInBackground
+#include "ftxui/component/component.hpp"  // for Input, Menu, Make, Vertical, FilterMenu
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/component_options.hpp"  // for InputOption, MenuOption
+#include "ftxui/component/filter_index.hpp"       // for FilterIndex, SearchIndex
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"  // for operator|, Element, text, hbox, vbox, separator, frame, flex, vscroll_indicator, dim
+#include "ftxui/util/ref.hpp"      // for Ref
+
+namespace ftxui {
+
+namespace {
+
+// The number of entries scanned by a task of the worker threads.
+constexpr size_t kChunkSize = 16384;
+
+char Lower(char c) {
+  return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+
+std::string Lowercase(std::string_view text) {
+  std::string out(text);
+  for (char& c : out) {
+    c = Lower(c);
+  }
+  return out;
+}
+
+// Whether |text| contains |query|, already lowercase.
+bool Contains(std::string_view text, std::string_view query) {
+  return std::search(text.begin(), text.end(), query.begin(), query.end(),
+                     [](char a, char b) { return Lower(a) == b; }) !=
+         text.end();
+}
+
+}  // namespace
+
+struct FilterIndex::Search {
+  std::string query;  // Lowercase.
+  // The entries scanned, nullptr for all of them.
+  std::shared_ptr<const std::vector<size_t>> candidates;
+  // The matches of every chunk, written by a worker thread, then read by the
+  // loop, once the chunk is done.
+  std::vector<std::vector<size_t>> results;
+  std::vector<bool> done;  // Accessed by the loop only.
+  size_t appended = 0;     // The chunks appended to the matches.
+  std::atomic<bool> cancelled = false;
+};
+
+FilterIndex::FilterIndex(const std::vector<std::string>* entries)
+    : entries_(entries) {
+  Start(nullptr);
+}
+
+FilterIndex::~FilterIndex() {
+  if (search_) {
+    search_->cancelled = true;
+  }
+}
+
+/// @brief Search the entries containing |query|. The matches are appended as
+/// the chunks of entries are scanned. When |query| contains the previous query,
+/// only the entries the previous search scanned are scanned again, and only its
+/// matches when it completed.
+void FilterIndex::SetQuery(std::string_view query) {
+  const std::string lowercase = Lowercase(query);
+  query_ = query;
+  if (lowercase == search_->query) {
+    return;
+  }
+
+  std::shared_ptr<const std::vector<size_t>> candidates;
+  if (!search_->query.empty() &&
+      lowercase.find(search_->query) != std::string::npos) {
+    candidates = searching() ? search_->candidates
+                             : std::make_shared<const std::vector<size_t>>(
+                                   std::move(matches_));
+  }
+  Start(std::move(candidates));
+}
+
+/// @brief Search every entry again, after they changed.
+void FilterIndex::Refresh() {
+  Start(nullptr);
+}
+
+bool FilterIndex::searching() const {
+  return search_->appended != search_->done.size();
+}
+
+std::string_view FilterIndex::operator[](size_t i) const {
+  return (*entries_)[matches_[i]];
+}
+
+// Cancel the current search, and scan |candidates|, nullptr for every entry.
+void FilterIndex::Start(std::shared_ptr<const std::vector<size_t>> candidates) {
+  if (search_) {
+    search_->cancelled = true;
+  }
+  matches_.clear();
+  ++version_;
+
+  auto search = std::make_shared<Search>();
+  search->query = Lowercase(query_);
+  search->candidates = std::move(candidates);
+  search_ = search;
+
+  // Every entry matches the empty query.
+  if (search->query.empty()) {
+    matches_.resize(entries_->size());
+    std::iota(matches_.begin(), matches_.end(), 0);
+    return;
+  }
+
+  const size_t count =
+      search->candidates ? search->candidates->size() : entries_->size();
+  const size_t chunks = (count + kChunkSize - 1) / kChunkSize;
+  search->results.resize(chunks);
+  search->done.resize(chunks, false);
+  for (size_t chunk = 0; chunk < chunks; ++chunk) {
+    RunInBackground(
+        [search, entries = entries_, chunk, count] {
+          if (search->cancelled) {
+            return;
+          }
+          const size_t end = std::min(count, (chunk + 1) * kChunkSize);
+          std::vector<size_t>& results = search->results[chunk];
+          for (size_t i = chunk * kChunkSize; i < end; ++i) {
+            const size_t entry =
+                search->candidates ? (*search->candidates)[i] : i;
+            if (Contains((*entries)[entry], search->query)) {
+              results.push_back(entry);
+            }
+          }
+        },
+        [this, search, chunk] {
+          if (!search->cancelled) {
+            OnChunkDone(*search, chunk);
+          }
+        });
+  }
+}
+
+// Append the matches of the chunks done, up to the first one still scanned.
+void FilterIndex::OnChunkDone(Search& search, size_t chunk) {
+  search.done[chunk] = true;
+  const size_t appended = search.appended;
+  while (search.appended < search.done.size() &&
+         search.done[search.appended]) {
+    std::vector<size_t>& results = search.results[search.appended];
+    matches_.insert(matches_.end(), results.begin(), results.end());
+    results = {};
+    ++search.appended;
+  }
+  if (search.appended == appended) {
+    return;
+  }
+  ++version_;
+  if (auto* screen = ScreenInteractive::Active()) {
+    screen->RequestRedraw();
+  }
+}
+
+namespace {
+
+class FilterMenuBase : public ComponentBase {
+ public:
+  FilterMenuBase(SearchIndex* index, int* selected, Ref<MenuOption> option)
+      : index_(index), selected_(selected), query_(index->query()) {
+    InputOption input_option;
+    input_option.on_change = [this] {
+      index_->SetQuery(query_);
+      *selected_ = 0;
+    };
+    MenuOption menu_option = *option;
+    menu_option.virtualized = true;
+    input_ = Input(&query_, "Filter", input_option);
+    menu_ = Menu(index_, selected_, menu_option);
+    Add(Container::Vertical({input_, menu_}));
+  }
+
+ private:
+  Element Render() override {
+    std::string count = std::to_string(index_->size());
+    if (index_->searching()) {
+      count += "+";
+    }
+    return vbox({
+        hbox({input_->Render() | flex, text(" " + count) | dim}),
+        separator(),
+        menu_->Render() | vscroll_indicator | frame | flex,
+    });
+  }
+
+  SearchIndex* index_;
+  int* selected_;
+  std::string query_;
+  Component input_;
+  Component menu_;
+};
+
+}  // namespace
+
+/// @brief A Menu of the entries of |index| matching the query typed in an
+/// Input above it, for a type-ahead search in long lists. The menu is
+/// virtualized, and the matches are displayed while they are found, without
+/// blocking the loop. See FilterIndex and FuzzyIndex.
+/// @param index The entries, and their matches. It must outlive the component.
+/// @param selected The selected match. Use FilterIndex::EntryIndex() to get the
+/// selected entry. It is reset when the query changes.
+/// @param option Additional optional parameters of the menu.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<std::string> files = ListFiles();
+/// FilterIndex index(&files);
+/// int selected = 0;
+/// auto menu = FilterMenu(&index, &selected);
+/// screen.Loop(menu);
+/// ```
+Component FilterMenu(SearchIndex* index, int* selected, Ref<MenuOption> option) {
+  return Make<FilterMenuBase>(index, selected, std::move(option));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
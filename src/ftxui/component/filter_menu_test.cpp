@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <chrono>   // for milliseconds
+#include <cstddef>  // for size_t
+#include <string>   // for string, to_string
+#include <thread>   // for this_thread::sleep_for
+#include <vector>   // for vector
+
+#include "ftxui/component/component.hpp"         // for FilterMenu
+#include "ftxui/component/filter_index.hpp"      // for FilterIndex
+#include "ftxui/component/loop.hpp"              // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+namespace {
+
+std::vector<std::string> Entries() {
+  std::vector<std::string> entries;
+  for (int i = 0; i < 100000; ++i) {  // NOLINT
+    entries.push_back("Entry " + std::to_string(i));
+  }
+  return entries;
+}
+
+// The entries of |index|, compared with a scan of every entry.
+void ExpectMatches(const FilterIndex& index,
+                   const std::vector<std::string>& entries,
+                   const std::string& query) {
+  std::vector<size_t> expected;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    if (entries[i].find(query) != std::string::npos) {
+      expected.push_back(i);
+    }
+  }
+  ASSERT_EQ(index.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(index.EntryIndex(i), expected[i]);
+    EXPECT_EQ(index[i], entries[expected[i]]);
+  }
+}
+
+}  // namespace
+
+TEST(FilterIndexTest, Refine) {
+  const auto entries = Entries();
+  FilterIndex index(&entries);
+  EXPECT_EQ(index.size(), entries.size());
+
+  index.SetQuery("y 12");
+  EXPECT_FALSE(index.searching());
+  ExpectMatches(index, entries, "y 12");
+
+  // Refined: only the previous matches are scanned.
+  const size_t version = index.version();
+  index.SetQuery("y 123");
+  EXPECT_NE(index.version(), version);
+  ExpectMatches(index, entries, "y 123");
+
+  // Not a refinement: every entry is scanned again. Case is ignored.
+  index.SetQuery("ENTRY 99");
+  ExpectMatches(index, entries, "Entry 99");
+
+  index.SetQuery("");
+  EXPECT_EQ(index.size(), entries.size());
+  index.SetQuery("none");
+  EXPECT_EQ(index.size(), 0u);
+}
+
+TEST(FilterIndexTest, Refresh) {
+  std::vector<std::string> entries = {"apple", "banana"};
+  FilterIndex index(&entries);
+  index.SetQuery("an");
+  ASSERT_EQ(index.size(), 1u);
+  entries.push_back("mango");
+  index.Refresh();
+  ASSERT_EQ(index.size(), 2u);
+  EXPECT_EQ(index[1], "mango");
+}
+
+TEST(FilterMenuTest, TypeAhead) {
+  const auto entries = Entries();
+  FilterIndex index(&entries);
+  int selected = 3;
+  auto component = FilterMenu(&index, &selected);
+
+  auto screen = ScreenInteractive::Headless(20, 6);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  screen.FeedInput("y 4242");
+  // The chunks are scanned by the worker threads, and appended by the loop.
+  for (int i = 0; i < 1000 && (index.query() != "y 4242" || index.searching());
+       ++i) {
+    loop.RunOnce();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ExpectMatches(index, entries, "y 4242");
+  EXPECT_EQ(selected, 0);
+  loop.RunOnce();
+  EXPECT_NE(screen.TakeOutput().find("Entry 4242"), std::string::npos);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
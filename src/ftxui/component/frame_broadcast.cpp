@@ -0,0 +1,207 @@
+#include "ftxui/component/frame_broadcast.hpp"
+
+#include <algorithm>  // for any_of, copy, find_if
+#include <memory>     // for make_shared, make_unique
+#include <string>     // for string
+#include <utility>    // for move
+
+#if !defined(_WIN32)
+#include <poll.h>    // for poll, pollfd, POLLOUT
+#include <unistd.h>  // for write
+
+#include <cerrno>  // for errno, EAGAIN, EINTR, EWOULDBLOCK
+#endif
+
+namespace ftxui {
+
+namespace {
+
+// Move the cursor to the top-left corner, where the frames are drawn.
+constexpr std::string_view kHome = "\x1B[H";
+// Also clear the terminal and hide the cursor, for a keyframe.
+constexpr std::string_view kKeyframeHeader = "\x1B[H\x1B[2J\x1B[?25l";
+
+}  // namespace
+
+#if !defined(_WIN32)
+/// @brief A Sink writing to the file descriptor |fd|. The viewer is considered
+/// gone once a write fails.
+// static
+FrameBroadcast::Sink FrameBroadcast::FileDescriptorSink(int fd) {
+  return [fd](std::string_view data) {
+    while (!data.empty()) {
+      const ssize_t written = write(fd, data.data(), data.size());
+      if (written >= 0) {
+        data.remove_prefix(static_cast<size_t>(written));
+        continue;
+      }
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {  // NOLINT
+        pollfd poll_fd = {fd, POLLOUT, 0};
+        poll(&poll_fd, 1, -1);
+        continue;
+      }
+      return false;
+    }
+    return true;
+  };
+}
+#endif
+
+FrameBroadcast::~FrameBroadcast() {
+  std::vector<int> ids;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& viewer : viewers_) {
+      ids.push_back(viewer->id);
+    }
+  }
+  for (const int id : ids) {
+    RemoveViewer(id);
+  }
+}
+
+/// @brief Add a viewer, written to from a new thread. It is sent a keyframe of
+/// the last frame published, if any.
+/// @param sink Where the frames of the viewer are written.
+/// @return The identifier of the viewer.
+int FrameBroadcast::AddViewer(Sink sink) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto viewer = std::make_unique<Viewer>();
+  viewer->id = next_id_++;
+  viewer->sink = std::move(sink);
+  viewer->stats.connected = true;
+  if (previous_.dimx() != 0 && previous_.dimy() != 0) {
+    viewer->pending = Keyframe();
+    viewer->stats.keyframes++;
+  }
+  viewer->thread = std::thread(&FrameBroadcast::ViewerLoop, this, viewer.get());
+  viewers_.push_back(std::move(viewer));
+  return viewers_.back()->id;
+}
+
+/// @brief Remove the viewer |id|. Its pending frame is dropped, and the one it
+/// is writing, if any, is completed first.
+void FrameBroadcast::RemoveViewer(int id) {
+  std::unique_ptr<Viewer> viewer;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find_if(viewers_.begin(), viewers_.end(),
+                           [id](const auto& v) { return v->id == id; });
+    if (it == viewers_.end()) {
+      return;
+    }
+    viewer = std::move(*it);
+    viewers_.erase(it);
+    viewer->stop = true;
+    viewer->pending = nullptr;
+  }
+  viewer->cv.notify_all();
+  viewer->thread.join();
+}
+
+/// @brief The frames sent to the viewer |id| so far. Unknown and removed
+/// viewers are reported as not connected.
+FrameBroadcast::ViewerStats FrameBroadcast::Stats(int id) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& viewer : viewers_) {
+    if (viewer->id == id) {
+      return viewer->stats;
+    }
+  }
+  return {};
+}
+
+/// @brief Send |frame| to every viewer. It is serialized once, as the update
+/// from the previous frame, shared by the viewers keeping up. A viewer still
+/// holding a frame it hasn't started writing gets a keyframe of |frame| in its
+/// place.
+void FrameBroadcast::Publish(const Screen& frame) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (current_.dimx() != frame.dimx() || current_.dimy() != frame.dimy()) {
+    current_ = Screen(frame.dimx(), frame.dimy());
+  }
+  for (int y = 0; y < frame.dimy(); ++y) {
+    const auto row = frame.Row(y);
+    std::copy(row.begin(), row.end(), current_.Row(y).begin());
+  }
+
+  // The diff is only useful to the viewers displaying the previous frame.
+  const bool resized = current_.dimx() != previous_.dimx() ||
+                       current_.dimy() != previous_.dimy();
+  const bool diff_needed =
+      !resized && std::any_of(viewers_.begin(), viewers_.end(),
+                              [](const auto& viewer) {
+                                return viewer->stats.connected &&
+                                       !viewer->pending;
+                              });
+  Buffer diff;
+  if (diff_needed) {
+    std::string out(kHome);
+    std::string body;
+    current_.ToStringDiff(previous_, body);
+    out += body;
+    diff = std::make_shared<const std::string>(std::move(out));
+  }
+  // |previous_| holds this frame from now on.
+  current_.SwapPixels(previous_);
+  keyframe_ = nullptr;
+
+  for (const auto& viewer : viewers_) {
+    if (!viewer->stats.connected) {
+      continue;
+    }
+    if (diff && !viewer->pending) {
+      viewer->pending = diff;
+      viewer->stats.diffs++;
+    } else {
+      if (viewer->pending) {
+        viewer->stats.skipped++;
+      }
+      viewer->pending = Keyframe();
+      viewer->stats.keyframes++;
+    }
+    viewer->cv.notify_all();
+  }
+}
+
+// The keyframe of |previous_|, built the first time a viewer needs it.
+FrameBroadcast::Buffer FrameBroadcast::Keyframe() {
+  if (!keyframe_) {
+    std::string out(kKeyframeHeader);
+    out += previous_.ToString();
+    keyframe_ = std::make_shared<const std::string>(std::move(out));
+  }
+  return keyframe_;
+}
+
+void FrameBroadcast::ViewerLoop(Viewer* viewer) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    viewer->cv.wait(lock, [viewer] { return viewer->pending || viewer->stop; });
+    if (viewer->stop) {
+      return;
+    }
+    const Buffer buffer = std::move(viewer->pending);
+    viewer->pending = nullptr;
+
+    lock.unlock();
+    const bool connected = viewer->sink(*buffer);
+    lock.lock();
+
+    if (!connected) {
+      viewer->stats.connected = false;
+      viewer->pending = nullptr;
+      viewer->cv.wait(lock, [viewer] { return viewer->stop; });
+      return;
+    }
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
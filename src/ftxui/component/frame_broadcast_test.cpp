@@ -0,0 +1,162 @@
+#include "ftxui/component/frame_broadcast.hpp"
+
+#include <gtest/gtest.h>
+#include <atomic>      // for atomic
+#include <chrono>      // for milliseconds
+#include <functional>  // for function
+#include <future>      // for promise, shared_future
+#include <mutex>       // for mutex, lock_guard
+#include <string>      // for string
+#include <thread>      // for sleep_for
+
+#include "ftxui/component/component.hpp"  // for Renderer
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+#include "ftxui/screen/screen.hpp"                 // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// The bytes received by a viewer.
+struct Output {
+  std::mutex mutex;
+  std::string data;
+  std::atomic<int> frames = 0;
+
+  FrameBroadcast::Sink Sink() {
+    return [this](std::string_view frame) {
+      {
+        const std::lock_guard<std::mutex> lock(mutex);
+        data = frame;
+      }
+      frames++;
+      return true;
+    };
+  }
+
+  // The last frame received, once |count| frames were received.
+  std::string Wait(int count) {
+    for (int i = 0; i < 1000 && frames < count; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(frames, count);
+    const std::lock_guard<std::mutex> lock(mutex);
+    return data;
+  }
+};
+
+Screen Frame(const char* content) {
+  Screen screen(4, 1);
+  for (int x = 0; content[x] != '\0'; ++x) {
+    screen.at(x, 0) = std::string(1, content[x]);
+  }
+  return screen;
+}
+
+}  // namespace
+
+TEST(FrameBroadcastTest, SameBytesForEveryViewer) {
+  FrameBroadcast broadcast;
+  Output a;
+  Output b;
+  const int id_a = broadcast.AddViewer(a.Sink());
+  const int id_b = broadcast.AddViewer(b.Sink());
+
+  broadcast.Publish(Frame("abcd"));
+  const std::string keyframe = a.Wait(1);
+  EXPECT_EQ(keyframe, "\x1B[H\x1B[2J\x1B[?25labcd");
+  EXPECT_EQ(b.Wait(1), keyframe);
+
+  // Only the changed cell is sent.
+  broadcast.Publish(Frame("abXd"));
+  const std::string diff = a.Wait(2);
+  EXPECT_EQ(diff.rfind("\x1B[H", 0), 0u);
+  EXPECT_EQ(diff.find("\x1B[2J"), std::string::npos);
+  EXPECT_NE(diff.find('X'), std::string::npos);
+  EXPECT_EQ(diff.find('a'), std::string::npos);
+  EXPECT_EQ(b.Wait(2), diff);
+
+  EXPECT_EQ(broadcast.Stats(id_a).keyframes, 1u);
+  EXPECT_EQ(broadcast.Stats(id_a).diffs, 1u);
+  EXPECT_EQ(broadcast.Stats(id_b).diffs, 1u);
+
+  // A new viewer starts from a keyframe of the last frame.
+  Output c;
+  broadcast.AddViewer(c.Sink());
+  EXPECT_EQ(c.Wait(1), "\x1B[H\x1B[2J\x1B[?25labXd");
+}
+
+TEST(FrameBroadcastTest, SlowViewerGetsKeyframes) {
+  FrameBroadcast broadcast;
+  Output fast;
+  const int id_fast = broadcast.AddViewer(fast.Sink());
+
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  Output slow;
+  std::atomic<int> slow_calls = 0;
+  const int id_slow = broadcast.AddViewer([&](std::string_view frame) {
+    slow_calls++;
+    released.wait();
+    return slow.Sink()(frame);
+  });
+
+  broadcast.Publish(Frame("aaaa"));
+  fast.Wait(1);
+  while (slow_calls < 1) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  // The slow viewer is still writing the first frame. The second one waits,
+  // and is replaced by a keyframe of the third one.
+  broadcast.Publish(Frame("bbbb"));
+  fast.Wait(2);
+  broadcast.Publish(Frame("cccc"));
+  const std::string last = fast.Wait(3);
+  EXPECT_NE(last.find("cccc"), std::string::npos);
+  EXPECT_EQ(broadcast.Stats(id_fast).diffs, 2u);
+  EXPECT_EQ(broadcast.Stats(id_fast).skipped, 0u);
+
+  release.set_value();
+  EXPECT_EQ(slow.Wait(2), "\x1B[H\x1B[2J\x1B[?25lcccc");
+  EXPECT_EQ(broadcast.Stats(id_slow).keyframes, 2u);
+  EXPECT_EQ(broadcast.Stats(id_slow).skipped, 1u);
+}
+
+TEST(FrameBroadcastTest, DisconnectedViewer) {
+  FrameBroadcast broadcast;
+  std::atomic<int> calls = 0;
+  const int id = broadcast.AddViewer([&](std::string_view) {
+    calls++;
+    return false;
+  });
+  broadcast.Publish(Frame("a"));
+  for (int i = 0; i < 1000 && broadcast.Stats(id).connected; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_FALSE(broadcast.Stats(id).connected);
+  broadcast.Publish(Frame("b"));
+  EXPECT_EQ(calls, 1);
+  broadcast.RemoveViewer(id);
+}
+
+TEST(FrameBroadcastTest, ScreenInteractive) {
+  FrameBroadcast broadcast;
+  Output viewer;
+  broadcast.AddViewer(viewer.Sink());
+
+  auto component = Renderer([] { return text("hello"); });
+  auto screen = ScreenInteractive::Headless(5, 1);
+  screen.Broadcast(&broadcast);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(viewer.Wait(1), "\x1B[H\x1B[2J\x1B[?25lhello");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,335 @@
+#include <algorithm>   // for min, merge, partial_sort, sort
+#include <atomic>      // for atomic
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint32_t, uint64_t
+#include <iterator>    // for back_inserter
+#include <memory>      // for make_shared, make_unique, shared_ptr, unique_ptr
+#include <mutex>       // for call_once, once_flag
+#include <string>      // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move, swap
+#include <vector>       // for vector
+
+#include "ftxui/component/async.hpp"      // for RunInBackground
+#include "ftxui/component/component.hpp"  // for FilterMenu, FuzzyFinder
+#include "ftxui/component/component_options.hpp"  // for MenuOption
+#include "ftxui/component/fuzzy_index.hpp"        // for FuzzyIndex
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/util/ref.hpp"                      // for Ref
+
+namespace ftxui {
+
+namespace {
+
+// The number of entries scanned by a task of the worker threads.
+constexpr size_t kChunkSize = 16384;
+// How often a chunk checks whether the search was cancelled.
+constexpr size_t kCancelInterval = 1024;
+
+// The score of the characters of the query, of the consecutive ones, of the
+// ones starting a word, and of every character skipped between them.
+constexpr int kMatch = 16;
+constexpr int kConsecutive = 8;
+constexpr int kBoundary = 8;
+constexpr int kGap = 1;
+
+char Lower(char c) {
+  return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+
+std::string Lowercase(std::string_view text) {
+  std::string out(text);
+  for (char& c : out) {
+    c = Lower(c);
+  }
+  return out;
+}
+
+// The bit of |c| in the bag of characters of a text: one per letter and digit,
+// the other characters share the remaining ones.
+uint64_t Bit(char c) {
+  c = Lower(c);
+  if (c >= 'a' && c <= 'z') {
+    return uint64_t(1) << (c - 'a');
+  }
+  if (c >= '0' && c <= '9') {
+    return uint64_t(1) << (26 + c - '0');  // NOLINT
+  }
+  return uint64_t(1) << (36 + uint8_t(c) % 28);  // NOLINT
+}
+
+uint64_t Bag(std::string_view text) {
+  uint64_t bag = 0;
+  for (const char c : text) {
+    bag |= Bit(c);
+  }
+  return bag;
+}
+
+bool IsBoundary(std::string_view text, size_t i) {
+  if (i == 0) {
+    return true;
+  }
+  const char previous = text[i - 1];
+  switch (previous) {
+    case '/':
+    case '\\':
+    case '_':
+    case '-':
+    case '.':
+    case ' ':
+      return true;
+    default:
+      break;
+  }
+  // camelCase.
+  return previous >= 'a' && previous <= 'z' && text[i] >= 'A' && text[i] <= 'Z';
+}
+
+// The best matches first. The ties are broken by the length, then the order of
+// the entries, so that the ranking doesn't depend on the order the chunks are
+// scanned.
+bool Better(const FuzzyIndex::Match& a, const FuzzyIndex::Match& b) {
+  if (a.score != b.score) {
+    return a.score > b.score;
+  }
+  if (a.length != b.length) {
+    return a.length < b.length;
+  }
+  return a.index < b.index;
+}
+
+}  // namespace
+
+// The bag of characters of every entry, computed by the first search scanning
+// its chunk.
+struct FuzzyIndex::Bags {
+  explicit Bags(size_t size)
+      : bags(size),
+        computed(std::make_unique<std::once_flag[]>(  // NOLINT
+            (size + kChunkSize - 1) / kChunkSize)) {}
+
+  // The bags of the entries of |chunk|.
+  const uint64_t* Get(const std::vector<std::string>& entries, size_t chunk) {
+    const size_t begin = chunk * kChunkSize;
+    const size_t end = std::min(bags.size(), begin + kChunkSize);
+    std::call_once(computed[chunk], [&] {
+      for (size_t i = begin; i < end; ++i) {
+        bags[i] = Bag(entries[i]);
+      }
+    });
+    return bags.data() + begin;
+  }
+
+  std::vector<uint64_t> bags;
+  std::unique_ptr<std::once_flag[]> computed;  // NOLINT
+};
+
+struct FuzzyIndex::Search {
+  std::string query;  // Lowercase.
+  uint64_t bag = 0;
+  size_t chunks = 0;
+  size_t done = 0;  // Accessed by the loop only.
+  std::atomic<bool> cancelled = false;
+};
+
+/// @param entries The entries searched. It must outlive the index.
+/// @param max_matches The number of best matches kept.
+FuzzyIndex::FuzzyIndex(const std::vector<std::string>* entries,
+                       size_t max_matches)
+    : entries_(entries),
+      max_matches_(max_matches),
+      bags_(std::make_shared<Bags>(entries->size())) {
+  Start();
+}
+
+FuzzyIndex::~FuzzyIndex() {
+  if (search_) {
+    search_->cancelled = true;
+  }
+}
+
+/// @brief Search the best matches of |query|. The chunks of the previous
+/// search not scanned yet are skipped.
+void FuzzyIndex::SetQuery(std::string_view query) {
+  const bool changed = Lowercase(query) != search_->query;
+  query_ = query;
+  if (changed) {
+    Start();
+  }
+}
+
+/// @brief Search every entry again, after they changed.
+void FuzzyIndex::Refresh() {
+  bags_ = std::make_shared<Bags>(entries_->size());
+  Start();
+}
+
+bool FuzzyIndex::searching() const {
+  return search_->done != search_->chunks;
+}
+
+size_t FuzzyIndex::EntryIndex(size_t i) const {
+  return search_->query.empty() ? i : matches_[i].index;
+}
+
+size_t FuzzyIndex::size() const {
+  return search_->query.empty() ? entries_->size() : matches_.size();
+}
+
+std::string_view FuzzyIndex::operator[](size_t i) const {
+  return (*entries_)[EntryIndex(i)];
+}
+
+/// @brief The score of |text| for |query|. The shortest part of |text|
+/// containing the characters of |query|, in order, is scored.
+/// @param text The text searched.
+/// @param query The characters searched, lowercase.
+/// @return The score, higher is better. -1 when |text| doesn't match.
+// static
+int FuzzyIndex::Score(std::string_view text, std::string_view query) {
+  // The end of the first match.
+  size_t q = 0;
+  size_t end = 0;
+  for (size_t i = 0; i < text.size() && q < query.size(); ++i) {
+    if (Lower(text[i]) == query[q]) {
+      ++q;
+      end = i + 1;
+    }
+  }
+  if (q != query.size()) {
+    return -1;
+  }
+
+  // The last start of a match ending there.
+  size_t start = end;
+  while (q > 0) {
+    --start;
+    if (Lower(text[start]) == query[q - 1]) {
+      --q;
+    }
+  }
+
+  int score = 0;
+  bool consecutive = false;
+  for (size_t i = start; i < end; ++i) {
+    if (q < query.size() && Lower(text[i]) == query[q]) {
+      score += kMatch;
+      score += consecutive ? kConsecutive : 0;
+      score += IsBoundary(text, i) ? kBoundary : 0;
+      consecutive = true;
+      ++q;
+    } else {
+      score -= kGap;
+      consecutive = false;
+    }
+  }
+  return score;
+}
+
+// Cancel the current search, and scan every entry for |query_|.
+void FuzzyIndex::Start() {
+  if (search_) {
+    search_->cancelled = true;
+  }
+  matches_.clear();
+  ++version_;
+
+  auto search = std::make_shared<Search>();
+  search->query = Lowercase(query_);
+  search->bag = Bag(search->query);
+  search_ = search;
+
+  // Every entry matches the empty query, in order.
+  if (search->query.empty()) {
+    return;
+  }
+
+  const size_t count = entries_->size();
+  search->chunks = (count + kChunkSize - 1) / kChunkSize;
+  for (size_t chunk = 0; chunk < search->chunks; ++chunk) {
+    auto matches = std::make_shared<std::vector<Match>>();
+    RunInBackground(
+        [search, matches, bags = bags_, entries = entries_, chunk, count,
+         max_matches = max_matches_] {
+          const size_t begin = chunk * kChunkSize;
+          const size_t end = std::min(count, begin + kChunkSize);
+          if (search->cancelled) {
+            return;
+          }
+          const uint64_t* bag = bags->Get(*entries, chunk);
+          for (size_t i = begin; i < end; ++i) {
+            if ((i - begin) % kCancelInterval == 0 && search->cancelled) {
+              return;
+            }
+            // Some characters of the query are missing.
+            if ((bag[i - begin] & search->bag) != search->bag) {
+              continue;
+            }
+            const std::string& entry = (*entries)[i];
+            const int score = Score(entry, search->query);
+            if (score >= 0) {
+              matches->push_back({score, uint32_t(entry.size()), i});
+            }
+          }
+          const size_t kept = std::min(max_matches, matches->size());
+          std::partial_sort(matches->begin(), matches->begin() + long(kept),
+                            matches->end(), Better);
+          matches->resize(kept);
+        },
+        [this, search, matches] {
+          if (!search->cancelled) {
+            OnChunkDone(*search, *matches);
+          }
+        });
+  }
+}
+
+// Merge the best matches of a chunk.
+void FuzzyIndex::OnChunkDone(Search& search, std::vector<Match>& matches) {
+  ++search.done;
+  if (!matches.empty()) {
+    std::vector<Match> merged;
+    merged.reserve(std::min(max_matches_, matches_.size() + matches.size()));
+    std::merge(matches_.begin(), matches_.end(), matches.begin(),
+               matches.end(), std::back_inserter(merged), Better);
+    merged.resize(std::min(max_matches_, merged.size()));
+    std::swap(matches_, merged);
+    ++version_;
+  }
+  if (auto* screen = ScreenInteractive::Active()) {
+    screen->RequestRedraw();
+  }
+}
+
+/// @brief Pick an entry among a long list, like fzf: the best matches of the
+/// fuzzy query typed in an Input are displayed, by decreasing score, in a
+/// virtualized Menu below it. The entries are scored on the worker threads,
+/// and the results are displayed while they arrive. See FuzzyIndex.
+/// @param index The entries, and their best matches. It must outlive the
+/// component.
+/// @param selected The selected match. Use FuzzyIndex::EntryIndex() to get the
+/// selected entry. It is reset when the query changes.
+/// @param option Additional optional parameters of the menu.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<std::string> paths = ListFiles();
+/// FuzzyIndex index(&paths);
+/// int selected = 0;
+/// auto finder = FuzzyFinder(&index, &selected);
+/// screen.Loop(finder);
+/// ```
+Component FuzzyFinder(FuzzyIndex* index,
+                      int* selected,
+                      Ref<MenuOption> option) {
+  return FilterMenu(index, selected, std::move(option));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <algorithm>  // for sort
+#include <chrono>     // for milliseconds
+#include <cstddef>    // for size_t
+#include <string>     // for string, to_string
+#include <thread>     // for this_thread::sleep_for
+#include <tuple>      // for tuple
+#include <vector>     // for vector
+
+#include "ftxui/component/component.hpp"          // for FuzzyFinder
+#include "ftxui/component/fuzzy_index.hpp"        // for FuzzyIndex
+#include "ftxui/component/loop.hpp"               // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+namespace {
+
+std::vector<std::string> Paths() {
+  const std::vector<std::string> directories = {"src/", "include/ftxui/",
+                                                "test/data/", "doc/"};
+  const std::vector<std::string> names = {"main", "menu", "Screen", "node",
+                                          "button_test"};
+  std::vector<std::string> paths;
+  for (int i = 0; i < 20000; ++i) {  // NOLINT
+    paths.push_back(directories[i % directories.size()] +
+                    names[(i / 4) % names.size()] + std::to_string(i) + ".cpp");
+  }
+  return paths;
+}
+
+// The best |count| entries for |query|, scoring every entry.
+std::vector<size_t> Best(const std::vector<std::string>& entries,
+                         const std::string& query,
+                         size_t count) {
+  std::vector<std::tuple<int, size_t, size_t>> scored;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const int score = FuzzyIndex::Score(entries[i], query);
+    if (score >= 0) {
+      scored.emplace_back(-score, entries[i].size(), i);
+    }
+  }
+  std::sort(scored.begin(), scored.end());
+  std::vector<size_t> best;
+  for (size_t i = 0; i < std::min(count, scored.size()); ++i) {
+    best.push_back(std::get<2>(scored[i]));
+  }
+  return best;
+}
+
+void ExpectBest(const FuzzyIndex& index,
+                const std::vector<std::string>& entries,
+                const std::string& query,
+                size_t count) {
+  const std::vector<size_t> best = Best(entries, query, count);
+  ASSERT_EQ(index.size(), best.size());
+  for (size_t i = 0; i < best.size(); ++i) {
+    EXPECT_EQ(index.EntryIndex(i), best[i]);
+  }
+}
+
+}  // namespace
+
+TEST(FuzzyIndexTest, Score) {
+  EXPECT_EQ(FuzzyIndex::Score("menu.cpp", "mnu"), 16 * 3 + 8 + 8 - 1);
+  EXPECT_EQ(FuzzyIndex::Score("menu.cpp", "xyz"), -1);
+  EXPECT_EQ(FuzzyIndex::Score("menu.cpp", "um"), -1);
+
+  // Consecutive characters.
+  EXPECT_GT(FuzzyIndex::Score("src/main.cpp", "main"),
+            FuzzyIndex::Score("src/my_application.cpp", "main"));
+  // Characters starting a word.
+  EXPECT_GT(FuzzyIndex::Score("src/button", "b"),
+            FuzzyIndex::Score("src_abutton", "b"));
+  EXPECT_GT(FuzzyIndex::Score("ScreenInteractive", "i"),
+            FuzzyIndex::Score("Screeninteractive", "i"));
+  // The case is ignored.
+  EXPECT_EQ(FuzzyIndex::Score("SCREEN", "screen"),
+            FuzzyIndex::Score("screen", "screen"));
+}
+
+TEST(FuzzyIndexTest, BestMatches) {
+  const auto paths = Paths();
+  FuzzyIndex index(&paths, 100);
+  EXPECT_EQ(index.size(), paths.size());
+  EXPECT_EQ(index.EntryIndex(7), 7u);
+
+  index.SetQuery("scr12");
+  EXPECT_FALSE(index.searching());
+  ExpectBest(index, paths, "scr12", 100);
+  for (size_t i = 1; i < index.size(); ++i) {
+    EXPECT_GE(index.score(i - 1), index.score(i));
+  }
+
+  index.SetQuery("BuTtOn_T9");
+  ExpectBest(index, paths, "button_t9", 100);
+
+  index.SetQuery("zzz");
+  EXPECT_EQ(index.size(), 0u);
+}
+
+TEST(FuzzyFinderTest, TypeAhead) {
+  const auto paths = Paths();
+  FuzzyIndex index(&paths);
+  int selected = 5;
+  auto component = FuzzyFinder(&index, &selected);
+
+  auto screen = ScreenInteractive::Headless(40, 6);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  screen.FeedInput("mn123");
+  for (int i = 0; i < 1000 && (index.query() != "mn123" || index.searching());
+       ++i) {
+    loop.RunOnce();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ExpectBest(index, paths, "mn123", 1000);
+  EXPECT_EQ(selected, 0);
+  loop.RunOnce();
+  EXPECT_NE(screen.TakeOutput().find(paths[index.EntryIndex(0)]),
+            std::string::npos);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
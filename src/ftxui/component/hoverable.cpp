@@ -48,16 +48,21 @@ Component Hoverable(Component component, bool* hover) {
 
    private:
     Element Render() override {
+      RequestMouseMotion();
       return ComponentBase::Render() | reflect(box_);
     }
 
-    bool OnEvent(Event event) override {
+    bool HandleEvent(const Event& event) override {
       if (event.is_mouse()) {
-        *hover_ = box_.Contain(event.mouse().x, event.mouse().y) &&
-                  CaptureMouse(event);
+        const bool hover = box_.Contain(event.mouse().x, event.mouse().y) &&
+                           CaptureMouse(event);
+        if (hover != *hover_) {
+          *hover_ = hover;
+          Invalidate();
+        }
       }
 
-      return ComponentBase::OnEvent(event);
+      return DispatchToChildren(event);
     }
 
     Component component_;
@@ -97,20 +102,22 @@ Component Hoverable(Component component,
 
    private:
     Element Render() override {
+      RequestMouseMotion();
       return ComponentBase::Render() | reflect(box_);
     }
 
-    bool OnEvent(Event event) override {
+    bool HandleEvent(const Event& event) override {
       if (event.is_mouse()) {
         const bool hover = box_.Contain(event.mouse().x, event.mouse().y) &&
                            CaptureMouse(event);
         if (hover != hover_) {
           Post(hover ? on_enter_ : on_leave_);
+          Invalidate();
         }
         hover_ = hover;
       }
 
-      return ComponentBase::OnEvent(event);
+      return DispatchToChildren(event);
     }
 
     Component component_;
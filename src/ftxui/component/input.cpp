@@ -1,10 +1,13 @@
-#include <algorithm>   // for max, min
-#include <cstddef>     // for size_t
-#include <functional>  // for function
-#include <memory>      // for shared_ptr
-#include <string>      // for string, allocator
-#include <utility>     // for move
-#include <vector>      // for vector
+#include <algorithm>  // for max, min, lower_bound, upper_bound, remove_if, copy, copy_backward
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <functional>   // for function
+#include <memory>       // for shared_ptr
+#include <string>       // for string, allocator
+#include <string_view>  // for string_view
+#include <typeinfo>     // for type_info
+#include <utility>      // for move
+#include <vector>       // for vector
 
 #include "ftxui/component/captured_mouse.hpp"     // for CapturedMouse
 #include "ftxui/component/component.hpp"          // for Make, Input
@@ -15,7 +18,7 @@
 #include "ftxui/component/screen_interactive.hpp"  // for Component
 #include "ftxui/dom/elements.hpp"  // for operator|, text, Element, reflect, operator|=, flex, inverted, hbox, size, bold, dim, focus, focusCursorBarBlinking, frame, select, Decorator, EQUAL, HEIGHT
 #include "ftxui/screen/box.hpp"    // for Box
-#include "ftxui/screen/string.hpp"  // for GlyphPosition, WordBreakProperty, GlyphCount, Utf8ToWordBreakProperty, CellToGlyphIndex, WordBreakProperty::ALetter, WordBreakProperty::CR, WordBreakProperty::Double_Quote, WordBreakProperty::Extend, WordBreakProperty::ExtendNumLet, WordBreakProperty::Format, WordBreakProperty::Hebrew_Letter, WordBreakProperty::Katakana, WordBreakProperty::LF, WordBreakProperty::MidLetter, WordBreakProperty::MidNum, WordBreakProperty::MidNumLet, WordBreakProperty::Newline, WordBreakProperty::Numeric, WordBreakProperty::Regional_Indicator, WordBreakProperty::Single_Quote, WordBreakProperty::WSegSpace, WordBreakProperty::ZWJ
+#include "ftxui/screen/string.hpp"  // for GlyphView, Glyphs, GlyphWordBreakProperty, WordBreakProperty, WordBreakProperty::ALetter, WordBreakProperty::CR, WordBreakProperty::Double_Quote, WordBreakProperty::Extend, WordBreakProperty::ExtendNumLet, WordBreakProperty::Format, WordBreakProperty::Hebrew_Letter, WordBreakProperty::Katakana, WordBreakProperty::LF, WordBreakProperty::MidLetter, WordBreakProperty::MidNum, WordBreakProperty::MidNumLet, WordBreakProperty::Newline, WordBreakProperty::Numeric, WordBreakProperty::Regional_Indicator, WordBreakProperty::Single_Quote, WordBreakProperty::WSegSpace, WordBreakProperty::ZWJ
 #include "ftxui/screen/util.hpp"    // for clamp
 #include "ftxui/util/ref.hpp"       // for StringRef, Ref, ConstStringRef
 
@@ -62,6 +65,382 @@ std::string PasswordField(size_t size) {
   return out;
 }
 
+// The glyphs of the content, indexed by their byte offset and by their first
+// cell, with their word break property. It lets the cursor move and jump over
+// words without scanning the content. It is updated incrementally when the
+// input edits the content, and rebuilt when the content is modified from the
+// outside.
+class GlyphIndex {
+ public:
+  // Rebuild the index, unless it already describes |content|.
+  void Update(const std::string& content) {
+    if (content == content_) {
+      return;
+    }
+    content_ = content;
+    offsets_.clear();
+    cells_.assign(1, 0);
+    properties_.clear();
+    for (const GlyphView& glyph : Glyphs(content_)) {
+      offsets_.push_back(size_t(glyph.text.data() - content_.data()));
+      cells_.push_back(cells_.back() + glyph.width);
+      properties_.push_back(GlyphWordBreakProperty(glyph.text));
+    }
+  }
+
+  // The number of glyphs.
+  int Count() const { return int(offsets_.size()); }
+
+  // Same as GlyphPosition(content, glyph).
+  size_t Position(int glyph) const {
+    if (glyph <= 0) {
+      return 0;
+    }
+    if (glyph >= Count()) {
+      return content_.size();
+    }
+    return offsets_[glyph];
+  }
+
+  // The first cell drawn by |glyph|, or the number of cells past the end.
+  int Cell(int glyph) const { return cells_[util::clamp(glyph, 0, Count())]; }
+
+  // The glyph drawn onto |cell|, or Count() past the end.
+  int GlyphAtCell(int cell) const {
+    const auto it = std::upper_bound(cells_.begin(), cells_.end(), cell);
+    return std::max(0, int(it - cells_.begin()) - 1);
+  }
+
+  WordBreakProperty Property(int glyph) const { return properties_[glyph]; }
+
+  // Replace |size| bytes at |position| by |text|, in both |content| and the
+  // index. The index must be up to date. Only the glyphs around the edit are
+  // segmented again, the following ones are shifted.
+  void Edit(std::string& content,
+            size_t position,
+            size_t size,
+            std::string_view text) {
+    content.replace(position, size, text);
+    content_.replace(position, size, text);
+    const size_t old_size = content_.size() + size - text.size();
+
+    // Segment again from the glyph before |position|, which may absorb
+    // combining characters, to the first glyph after the replaced bytes.
+    size_t first =
+        std::lower_bound(offsets_.begin(), offsets_.end(), position) -
+        offsets_.begin();
+    first = first == 0 ? 0 : first - 1;
+    const size_t last = std::lower_bound(offsets_.begin() + first,
+                                         offsets_.end(), position + size) -
+                        offsets_.begin();
+    const size_t begin = first == 0 ? 0 : offsets_[first];
+    const size_t end =
+        (last < offsets_.size() ? offsets_[last] : old_size) + text.size() -
+        size;
+
+    std::vector<size_t> offsets(offsets_.begin(), offsets_.begin() + first);
+    std::vector<int> cells(cells_.begin(), cells_.begin() + first + 1);
+    std::vector<WordBreakProperty> properties(properties_.begin(),
+                                              properties_.begin() + first);
+    const std::string_view window =
+        std::string_view(content_).substr(begin, end - begin);
+    for (const GlyphView& glyph : Glyphs(window)) {
+      offsets.push_back(begin + size_t(glyph.text.data() - window.data()));
+      cells.push_back(cells.back() + glyph.width);
+      properties.push_back(GlyphWordBreakProperty(glyph.text));
+    }
+    for (size_t i = last; i < offsets_.size(); ++i) {
+      offsets.push_back(offsets_[i] + text.size() - size);
+      cells.push_back(cells.back() + cells_[i + 1] - cells_[i]);
+      properties.push_back(properties_[i]);
+    }
+    offsets_ = std::move(offsets);
+    cells_ = std::move(cells);
+    properties_ = std::move(properties);
+  }
+
+ private:
+  std::string content_;
+  std::vector<size_t> offsets_;
+  std::vector<int> cells_ = {0};
+  std::vector<WordBreakProperty> properties_;
+};
+
+// The content of an Input using InputOption::gap_buffer. The bytes are stored
+// in a gap buffer, whose gap follows the edits. The glyphs are stored in
+// chunks, knowing their total number of bytes and cells. An edit moves the gap
+// and modifies a single chunk, instead of shifting the whole content and its
+// index. Finding a glyph walks the chunks.
+class GapBuffer {
+ public:
+  // Rebuild the buffer from |content|.
+  void Assign(std::string_view content) {
+    data_.assign(content.begin(), content.end());
+    gap_begin_ = gap_end_ = data_.size();
+    chunks_.clear();
+    count_ = 0;
+    for (const GlyphView& glyph : Glyphs(content)) {
+      Append({uint32_t(glyph.text.size()), glyph.width,
+              GlyphWordBreakProperty(glyph.text)});
+    }
+  }
+
+  bool Equals(const std::string& content) const {
+    const size_t before = gap_begin_;
+    const size_t after = data_.size() - gap_end_;
+    return content.size() == before + after &&
+           content.compare(0, before, data_.data(), before) == 0 &&
+           content.compare(before, after, data_.data() + gap_end_, after) == 0;
+  }
+
+  void CopyTo(std::string& out) const {
+    out.assign(data_.data(), gap_begin_);
+    out.append(data_.data() + gap_end_, data_.size() - gap_end_);
+  }
+
+  // The number of glyphs.
+  int Count() const { return count_; }
+
+  // The byte offset of |glyph|, clamped to the content.
+  size_t Position(int glyph) const {
+    size_t position = 0;
+    glyph = util::clamp(glyph, 0, count_);
+    for (const Chunk& chunk : chunks_) {
+      if (glyph < int(chunk.glyphs.size())) {
+        for (int i = 0; i < glyph; ++i) {
+          position += chunk.glyphs[i].size;
+        }
+        return position;
+      }
+      glyph -= int(chunk.glyphs.size());
+      position += chunk.bytes;
+    }
+    return position;
+  }
+
+  // The first cell drawn by |glyph|, or the number of cells past the end.
+  int Cell(int glyph) const {
+    int cell = 0;
+    glyph = util::clamp(glyph, 0, count_);
+    for (const Chunk& chunk : chunks_) {
+      if (glyph < int(chunk.glyphs.size())) {
+        for (int i = 0; i < glyph; ++i) {
+          cell += chunk.glyphs[i].width;
+        }
+        return cell;
+      }
+      glyph -= int(chunk.glyphs.size());
+      cell += chunk.cells;
+    }
+    return cell;
+  }
+
+  // The glyph drawn onto |cell|, or Count() past the end.
+  int GlyphAtCell(int cell) const {
+    int glyph = 0;
+    for (const Chunk& chunk : chunks_) {
+      if (cell >= chunk.cells) {
+        cell -= chunk.cells;
+        glyph += int(chunk.glyphs.size());
+        continue;
+      }
+      for (const Glyph& g : chunk.glyphs) {
+        if (cell < g.width) {
+          return glyph;
+        }
+        cell -= g.width;
+        glyph++;
+      }
+    }
+    return count_;
+  }
+
+  // The bytes of the glyphs in [first, last).
+  std::string Substr(int first, int last) const {
+    return Bytes(Position(first), Position(last));
+  }
+
+  WordBreakProperty Property(int glyph) const {
+    for (const Chunk& chunk : chunks_) {
+      if (glyph < int(chunk.glyphs.size())) {
+        return chunk.glyphs[glyph].property;
+      }
+      glyph -= int(chunk.glyphs.size());
+    }
+    return WordBreakProperty::Extend;
+  }
+
+  // Replace the glyphs in [first, last) by |text|. The glyphs around are
+  // segmented again, as |text| may combine with them.
+  void Replace(int first, int last, std::string_view text) {
+    first = util::clamp(first, 0, count_);
+    last = util::clamp(last, first, count_);
+    const int around_first = std::max(0, first - 1);
+    const int around_last = std::min(count_, last + 1);
+    const size_t begin = Position(around_first);
+    const size_t position = Position(first);
+    const size_t end = Position(last);
+    const std::string window =
+        Bytes(begin, position) + std::string(text) +
+        Bytes(end, Position(around_last));
+
+    MoveGap(end);
+    gap_begin_ = position;
+    Reserve(text.size());
+    std::copy(text.begin(), text.end(), data_.begin() + gap_begin_);
+    gap_begin_ += text.size();
+
+    std::vector<Glyph> glyphs;
+    for (const GlyphView& glyph : Glyphs(window)) {
+      glyphs.push_back({uint32_t(glyph.text.size()), glyph.width,
+                        GlyphWordBreakProperty(glyph.text)});
+    }
+    ReplaceGlyphs(around_first, around_last, glyphs);
+  }
+
+ private:
+  struct Glyph {
+    uint32_t size;
+    int width;
+    WordBreakProperty property;
+  };
+  struct Chunk {
+    std::vector<Glyph> glyphs;
+    size_t bytes = 0;
+    int cells = 0;
+  };
+  static constexpr size_t kChunkSize = 512;
+
+  std::string Bytes(size_t begin, size_t end) const {
+    std::string out;
+    out.reserve(end - begin);
+    if (begin < gap_begin_) {
+      const size_t before = std::min(end, gap_begin_);
+      out.append(data_.data() + begin, before - begin);
+      begin = before;
+    }
+    if (begin < end) {
+      const size_t gap = gap_end_ - gap_begin_;
+      out.append(data_.data() + begin + gap, end - begin);
+    }
+    return out;
+  }
+
+  // Move the gap, so that it starts at the byte |position| of the content.
+  void MoveGap(size_t position) {
+    if (position < gap_begin_) {
+      const size_t moved = gap_begin_ - position;
+      std::copy_backward(data_.begin() + position,
+                         data_.begin() + gap_begin_, data_.begin() + gap_end_);
+      gap_begin_ -= moved;
+      gap_end_ -= moved;
+    } else if (position > gap_begin_) {
+      const size_t moved = position - gap_begin_;
+      std::copy(data_.begin() + gap_end_, data_.begin() + gap_end_ + moved,
+                data_.begin() + gap_begin_);
+      gap_begin_ += moved;
+      gap_end_ += moved;
+    }
+  }
+
+  // Grow the gap to at least |size| bytes.
+  void Reserve(size_t size) {
+    if (gap_end_ - gap_begin_ >= size) {
+      return;
+    }
+    const size_t after = data_.size() - gap_end_;
+    const size_t grow = std::max(size, data_.size() / 2 + 64);  // NOLINT
+    data_.resize(data_.size() + grow);
+    std::copy_backward(data_.begin() + gap_end_,
+                       data_.begin() + gap_end_ + after, data_.end());
+    gap_end_ += grow;
+  }
+
+  void Append(Glyph glyph) {
+    if (chunks_.empty() || chunks_.back().glyphs.size() >= kChunkSize) {
+      chunks_.emplace_back();
+    }
+    Chunk& chunk = chunks_.back();
+    chunk.glyphs.push_back(glyph);
+    chunk.bytes += glyph.size;
+    chunk.cells += glyph.width;
+    count_++;
+  }
+
+  // Replace the glyphs in [first, last) by |glyphs|.
+  void ReplaceGlyphs(int first, int last, const std::vector<Glyph>& glyphs) {
+    if (chunks_.empty()) {
+      chunks_.emplace_back();
+    }
+
+    // Find the chunk of |first|.
+    size_t c = 0;
+    int offset = first;
+    while (c + 1 < chunks_.size() &&
+           offset >= int(chunks_[c].glyphs.size())) {
+      offset -= int(chunks_[c].glyphs.size());
+      c++;
+    }
+
+    // Erase the replaced glyphs, possibly spanning over several chunks.
+    int erase = last - first;
+    for (size_t k = c; erase > 0 && k < chunks_.size(); ++k) {
+      Chunk& chunk = chunks_[k];
+      const int begin = k == c ? offset : 0;
+      const int end = std::min(int(chunk.glyphs.size()), begin + erase);
+      for (int i = begin; i < end; ++i) {
+        chunk.bytes -= chunk.glyphs[i].size;
+        chunk.cells -= chunk.glyphs[i].width;
+      }
+      chunk.glyphs.erase(chunk.glyphs.begin() + begin,
+                         chunk.glyphs.begin() + end);
+      erase -= end - begin;
+    }
+
+    Chunk& chunk = chunks_[c];
+    chunk.glyphs.insert(chunk.glyphs.begin() + offset, glyphs.begin(),
+                        glyphs.end());
+    for (const Glyph& glyph : glyphs) {
+      chunk.bytes += glyph.size;
+      chunk.cells += glyph.width;
+    }
+    count_ += int(glyphs.size()) - (last - first);
+
+    // Split the chunk grown too large, and drop the empty ones.
+    if (chunk.glyphs.size() > 2 * kChunkSize) {
+      Chunk second;
+      second.glyphs.assign(chunk.glyphs.begin() + kChunkSize,
+                           chunk.glyphs.end());
+      chunk.glyphs.resize(kChunkSize);
+      for (const Glyph& glyph : second.glyphs) {
+        second.bytes += glyph.size;
+        second.cells += glyph.width;
+      }
+      chunk.bytes -= second.bytes;
+      chunk.cells -= second.cells;
+      chunks_.insert(chunks_.begin() + long(c) + 1, std::move(second));
+    }
+    chunks_.erase(std::remove_if(chunks_.begin(), chunks_.end(),
+                                 [](const Chunk& other) {
+                                   return other.glyphs.empty();
+                                 }),
+                  chunks_.end());
+  }
+
+  std::vector<char> data_;
+  size_t gap_begin_ = 0;
+  size_t gap_end_ = 0;
+  std::vector<Chunk> chunks_;
+  int count_ = 0;
+};
+
+// Whether |option| has a |on_change| of its own, rather than the default one
+// doing nothing.
+bool HasOnChange(const InputOption& option) {
+  static const std::type_info& kDefault = InputOption().on_change.target_type();
+  return option.on_change.target_type() != kDefault;
+}
+
 // An input box. The user can type text into it.
 class InputBase : public ComponentBase {
  public:
@@ -83,6 +462,10 @@ class InputBase : public ComponentBase {
 
   // Component implementation:
   Element Render() override {
+    if (option_->gap_buffer()) {
+      return RenderBuffer();
+    }
+    index_.Update(*content_);
     std::string password_content;
     if (option_->password()) {
       password_content = PasswordField(content_->size());
@@ -90,7 +473,13 @@ class InputBase : public ComponentBase {
     const std::string& content =
         option_->password() ? password_content : *content_;
 
-    const int size = GlyphCount(content);
+    // The password field is made of one 3 bytes "•" per byte of the content.
+    const int size =
+        option_->password() ? int(content_->size()) : index_.Count();
+    const auto position = [&](int glyph) {
+      return option_->password() ? 3 * size_t(util::clamp(glyph, 0, size))
+                                 : index_.Position(glyph);
+    };
 
     cursor_position() = std::max(0, std::min<int>(size, cursor_position()));
     auto main_decorator = flex | ftxui::size(HEIGHT, EQUAL, 1);
@@ -98,14 +487,7 @@ class InputBase : public ComponentBase {
 
     // placeholder.
     if (size == 0) {
-      auto element = text(*placeholder_) | dim | main_decorator | reflect(box_);
-      if (is_focused) {
-        element |= focus;
-      }
-      if (hovered_ || is_focused) {
-        element |= inverted;
-      }
-      return element;
+      return RenderPlaceholder(is_focused);
     }
 
     // Not focused.
@@ -117,9 +499,8 @@ class InputBase : public ComponentBase {
       return element;
     }
 
-    const int index_before_cursor = GlyphPosition(content, cursor_position());
-    const int index_after_cursor =
-        GlyphPosition(content, 1, index_before_cursor);
+    const size_t index_before_cursor = position(cursor_position());
+    const size_t index_after_cursor = position(cursor_position() + 1);
     const std::string part_before_cursor =
         content.substr(0, index_before_cursor);
     std::string part_at_cursor = " ";
@@ -137,9 +518,122 @@ class InputBase : public ComponentBase {
            flex | frame | bold | main_decorator | reflect(box_);
   }
 
-  bool OnEvent(Event event) override {
-    cursor_position() =
-        std::max(0, std::min<int>((int)content_->size(), cursor_position()));
+  Element RenderPlaceholder(bool is_focused) {
+    auto element = text(*placeholder_) | dim | flex |
+                   ftxui::size(HEIGHT, EQUAL, 1) | reflect(box_);
+    if (is_focused) {
+      element |= focus;
+    }
+    if (hovered_ || is_focused) {
+      element |= inverted;
+    }
+    return element;
+  }
+
+  // Draw the content of |buffer_|. Only the glyphs within the width of the
+  // input around the cursor are copied and drawn.
+  Element RenderBuffer() {
+    SyncBuffer();
+    // The edits are copied into the content once per frame.
+    FlushBuffer();
+
+    const int size = buffer_.Count();
+    cursor_position() = util::clamp(cursor_position(), 0, size);
+    const bool is_focused = Focused();
+    if (size == 0) {
+      return RenderPlaceholder(is_focused);
+    }
+
+    const auto part = [&](int first, int last) {
+      return option_->password() ? PasswordField(size_t(last - first))
+                                 : buffer_.Substr(first, last);
+    };
+    const int min_width = 256;
+    const int width = std::max(min_width, box_.x_max - box_.x_min + 1);
+    auto main_decorator = flex | ftxui::size(HEIGHT, EQUAL, 1);
+
+    if (!is_focused) {
+      auto element = text(part(0, buffer_.GlyphAtCell(width))) |
+                     main_decorator | reflect(box_);
+      if (hovered_) {
+        element |= inverted;
+      }
+      return element;
+    }
+
+    const int cursor = cursor_position();
+    const int cursor_cell = buffer_.Cell(cursor);
+    const int first = buffer_.GlyphAtCell(std::max(0, cursor_cell - width));
+    const int last = buffer_.GlyphAtCell(cursor_cell + width);
+    const std::string part_at_cursor =
+        cursor < size ? part(cursor, cursor + 1) : " ";
+    return hbox({
+               text(part(first, cursor)),
+               text(part_at_cursor) | focusCursorBarBlinking |
+                   reflect(cursor_box_),
+               text(part(cursor + 1, std::max(cursor + 1, last))),
+           }) |
+           flex | frame | bold | main_decorator | reflect(box_);
+  }
+
+  // Rebuild |buffer_| when |content_| was modified from the outside. Once
+  // edited, |buffer_| is the reference until the next frame.
+  void SyncBuffer() {
+    if (!buffer_dirty_ && !buffer_.Equals(*content_)) {
+      buffer_.Assign(*content_);
+    }
+  }
+
+  // Copy the edits of |buffer_| into |content_|.
+  void FlushBuffer() {
+    if (buffer_dirty_) {
+      buffer_.CopyTo(*content_);
+      buffer_dirty_ = false;
+    }
+  }
+
+  // Call |on_change|, once the content is up to date. With the default one,
+  // the edits of |buffer_| are copied once per frame only.
+  void OnChange() {
+    if (HasOnChange(*option_)) {
+      FlushBuffer();
+    }
+    option_->on_change();
+  }
+
+  int Count() {
+    return option_->gap_buffer() ? buffer_.Count() : index_.Count();
+  }
+
+  // Replace the glyphs in [first, last) by |text|.
+  void Replace(int first, int last, std::string_view text) {
+    if (option_->gap_buffer()) {
+      buffer_.Replace(first, last, text);
+      buffer_dirty_ = true;
+      return;
+    }
+    const size_t start = index_.Position(first);
+    const size_t end = index_.Position(last);
+    index_.Edit(*content_, start, end - start, text);
+  }
+
+  int Cell(int glyph) {
+    return option_->gap_buffer() ? buffer_.Cell(glyph) : index_.Cell(glyph);
+  }
+
+  int GlyphAtCell(int cell) {
+    return option_->gap_buffer() ? buffer_.GlyphAtCell(cell)
+                                 : index_.GlyphAtCell(cell);
+  }
+
+  bool HandleEvent(const Event& event) override {
+    if (option_->gap_buffer()) {
+      SyncBuffer();
+      cursor_position() = util::clamp(cursor_position(), 0, buffer_.Count());
+    } else {
+      index_.Update(*content_);
+      cursor_position() = util::clamp(cursor_position(), 0, index_.Count());
+    }
 
     if (event.is_mouse()) {
       return OnMouseEvent(event);
@@ -150,28 +644,25 @@ class InputBase : public ComponentBase {
       if (cursor_position() == 0) {
         return false;
       }
-      const size_t start = GlyphPosition(*content_, cursor_position() - 1);
-      const size_t end = GlyphPosition(*content_, cursor_position());
-      content_->erase(start, end - start);
+      Replace(cursor_position() - 1, cursor_position(), "");
       cursor_position()--;
-      option_->on_change();
+      OnChange();
       return true;
     }
 
     // Delete
     if (event == Event::Delete) {
-      if (cursor_position() == int(content_->size())) {
+      if (cursor_position() == Count()) {
         return false;
       }
-      const size_t start = GlyphPosition(*content_, cursor_position());
-      const size_t end = GlyphPosition(*content_, cursor_position() + 1);
-      content_->erase(start, end - start);
-      option_->on_change();
+      Replace(cursor_position(), cursor_position() + 1, "");
+      OnChange();
       return true;
     }
 
     // Enter.
     if (event == Event::Return) {
+      FlushBuffer();
       option_->on_enter();
       return true;
     }
@@ -186,8 +677,7 @@ class InputBase : public ComponentBase {
       return true;
     }
 
-    if (event == Event::ArrowRight &&
-        cursor_position() < (int)content_->size()) {
+    if (event == Event::ArrowRight && cursor_position() < Count()) {
       cursor_position()++;
       return true;
     }
@@ -208,58 +698,81 @@ class InputBase : public ComponentBase {
     }
 
     if (event == Event::End) {
-      cursor_position() = GlyphCount(*content_);
+      cursor_position() = Count();
+      return true;
+    }
+
+    // Insert the whole paste at once. Like when typed, the control characters,
+    // including the new lines, are not inserted.
+    if (event.is_paste()) {
+      std::string text = event.paste();
+      text.erase(std::remove_if(text.begin(), text.end(),
+                                [](char c) { return (unsigned char)c < ' '; }),
+                 text.end());
+      if (text.empty()) {
+        return true;
+      }
+      const int count = Count();
+      Replace(cursor_position(), cursor_position(), text);
+      cursor_position() += Count() - count;
+      OnChange();
       return true;
     }
 
     // Content
     if (event.is_character()) {
-      const size_t start = GlyphPosition(*content_, cursor_position());
-      content_->insert(start, event.character());
+      Replace(cursor_position(), cursor_position(), event.character());
       cursor_position()++;
-      option_->on_change();
+      OnChange();
       return true;
     }
     return false;
   }
 
  private:
-  void HandleLeftCtrl() {
-    auto properties = Utf8ToWordBreakProperty(*content_);
+  // The word break property of |glyph|, kept by the index along the glyphs.
+  WordBreakProperty Property(int glyph) {
+    return option_->gap_buffer() ? buffer_.Property(glyph)
+                                 : index_.Property(glyph);
+  }
 
+  void HandleLeftCtrl() {
     // Move left, as long as left is not a word character.
     while (cursor_position() > 0 &&
-           !IsWordCharacter(properties[cursor_position() - 1])) {
+           !IsWordCharacter(Property(cursor_position() - 1))) {
       cursor_position()--;
     }
 
     // Move left, as long as left is a word character:
     while (cursor_position() > 0 &&
-           IsWordCharacter(properties[cursor_position() - 1])) {
+           IsWordCharacter(Property(cursor_position() - 1))) {
       cursor_position()--;
     }
   }
 
   void HandleRightCtrl() {
-    auto properties = Utf8ToWordBreakProperty(*content_);
-    const int max = (int)properties.size();
+    const int max = Count();
 
     // Move right, as long as right is not a word character.
     while (cursor_position() < max &&
-           !IsWordCharacter(properties[cursor_position()])) {
+           !IsWordCharacter(Property(cursor_position()))) {
       cursor_position()++;
     }
 
     // Move right, as long as right is a word character:
     while (cursor_position() < max &&
-           IsWordCharacter(properties[cursor_position()])) {
+           IsWordCharacter(Property(cursor_position()))) {
       cursor_position()++;
     }
   }
 
-  bool OnMouseEvent(Event event) {
-    hovered_ =
+  bool OnMouseEvent(const Event& event) {
+    const bool hovered =
         box_.Contain(event.mouse().x, event.mouse().y) && CaptureMouse(event);
+    if (hovered != hovered_) {
+      hovered_ = hovered;
+      Invalidate();
+    }
     if (!hovered_) {
       return false;
     }
@@ -270,31 +783,17 @@ class InputBase : public ComponentBase {
     }
 
     TakeFocus();
-    if (content_->empty()) {
+    if (Count() == 0) {
       return true;
     }
 
-    auto mapping = CellToGlyphIndex(*content_);
-    int original_glyph = cursor_position();
-    original_glyph = util::clamp(original_glyph, 0, int(mapping.size()));
-    size_t original_cell = 0;
-    for (size_t i = 0; i < mapping.size(); i++) {
-      if (mapping[i] == original_glyph) {
-        original_cell = (int)i;
-        break;
-      }
-    }
-    if (mapping[original_cell] != original_glyph) {
-      original_cell = mapping.size();
-    }
+    const int original_glyph = util::clamp(cursor_position(), 0, Count());
     const int target_cell =
-        int(original_cell) + event.mouse().x - cursor_box_.x_min;
-    int target_glyph = target_cell < (int)mapping.size() ? mapping[target_cell]
-                                                         : (int)mapping.size();
-    target_glyph = util::clamp(target_glyph, 0, GlyphCount(*content_));
+        Cell(original_glyph) + event.mouse().x - cursor_box_.x_min;
+    const int target_glyph = GlyphAtCell(target_cell);
     if (cursor_position() != target_glyph) {
       cursor_position() = target_glyph;
-      option_->on_change();
+      OnChange();
     }
     return true;
   }
@@ -303,6 +802,10 @@ class InputBase : public ComponentBase {
 
   bool hovered_ = false;
   StringRef content_;
+  GlyphIndex index_;
+  GapBuffer buffer_;
+  // Whether |buffer_| has edits not copied into |content_| yet.
+  bool buffer_dirty_ = false;
   ConstStringRef placeholder_;
 
   Box box_;
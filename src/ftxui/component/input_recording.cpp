@@ -0,0 +1,110 @@
+#include <chrono>       // for microseconds
+#include <cstdint>      // for int64_t
+#include <sstream>      // for istringstream
+#include <string>       // for string, getline, to_string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/component/input_recording.hpp"
+
+namespace ftxui {
+
+namespace {
+
+constexpr std::string_view hex_digits = "0123456789abcdef";
+
+int HexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+bool DecodeHex(std::string_view hex, std::string* out) {
+  if (hex.empty() || hex.size() % 2 != 0) {
+    return false;
+  }
+  out->clear();
+  out->reserve(hex.size() / 2);
+  for (size_t i = 0; i < hex.size(); i += 2) {
+    const int high = HexValue(hex[i]);
+    const int low = HexValue(hex[i + 1]);
+    if (high < 0 || low < 0) {
+      return false;
+    }
+    out->push_back(char(high * 16 + low));  // NOLINT
+  }
+  return true;
+}
+
+}  // namespace
+
+/// @brief Write the recording in a text format, one entry per line.
+/// @see Parse
+std::string InputRecording::Serialize() const {
+  std::string out;
+  for (const Entry& entry : entries) {
+    out += std::to_string(entry.time.count());
+    if (entry.is_resize()) {
+      out += " resize ";
+      out += std::to_string(entry.dimx);
+      out += ' ';
+      out += std::to_string(entry.dimy);
+    } else {
+      out += " input ";
+      for (const char c : entry.input) {
+        const auto byte = static_cast<unsigned char>(c);
+        out += hex_digits[byte / 16];
+        out += hex_digits[byte % 16];
+      }
+    }
+    out += '\n';
+  }
+  return out;
+}
+
+/// @brief Read a recording written by Serialize(). The malformed lines are
+/// skipped.
+// static
+InputRecording InputRecording::Parse(std::string_view data) {
+  InputRecording recording;
+  std::istringstream stream{std::string(data)};
+  std::string line;
+  while (std::getline(stream, line)) {
+    std::istringstream fields(line);
+    int64_t time = 0;
+    std::string type;
+    if (!(fields >> time >> type)) {
+      continue;
+    }
+
+    Entry entry;
+    entry.time = std::chrono::microseconds(time);
+    if (type == "resize") {
+      if (!(fields >> entry.dimx >> entry.dimy)) {
+        continue;
+      }
+    } else if (type == "input") {
+      std::string hex;
+      if (!(fields >> hex) || !DecodeHex(hex, &entry.input)) {
+        continue;
+      }
+    } else {
+      continue;
+    }
+    recording.entries.push_back(std::move(entry));
+  }
+  return recording;
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <memory>  // for __shared_ptr_access, shared_ptr, allocator
 #include <string>  // for string
+#include <vector>  // for vector
 
 #include "ftxui/component/component.hpp"       // for Input
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
@@ -46,6 +47,18 @@ TEST(InputTest, Type) {
   EXPECT_EQ(screen.PixelAt(1, 0).character, "b");
 }
 
+TEST(InputTest, Paste) {
+  std::string content = "ad";
+  std::string placeholder;
+  auto option = InputOption();
+  option.cursor_position = 1;
+  Component input = Input(&content, &placeholder, &option);
+
+  EXPECT_TRUE(input->OnEvent(Event::Paste("b\n\xC3\xA9" "c")));
+  EXPECT_EQ(content, "ab\xC3\xA9" "cd");
+  EXPECT_EQ(option.cursor_position(), 4u);
+}
+
 TEST(InputTest, TypePassword) {
   std::string content;
   std::string placeholder;
@@ -224,6 +237,51 @@ TEST(InputTest, Backspace) {
   EXPECT_EQ(option.cursor_position(), 0u);
 }
 
+TEST(InputTest, EditUnicode) {
+  std::string content = "a测b";
+  std::string placeholder;
+  auto option = InputOption();
+  option.cursor_position = 1;
+  auto input = Input(&content, &placeholder, &option);
+
+  input->OnEvent(Event::Delete);
+  EXPECT_EQ(content, "ab");
+  EXPECT_EQ(option.cursor_position(), 1u);
+
+  input->OnEvent(Event::Character("试"));
+  input->OnEvent(Event::Character("\u0300"));  // Combine with "试".
+  EXPECT_EQ(content, "a试\u0300b");
+
+  input->OnEvent(Event::Home);
+  input->OnEvent(Event::ArrowRight);
+  input->OnEvent(Event::ArrowRight);
+  input->OnEvent(Event::Backspace);
+  EXPECT_EQ(content, "ab");
+  EXPECT_EQ(option.cursor_position(), 1u);
+
+  input->OnEvent(Event::End);
+  EXPECT_EQ(option.cursor_position(), 2u);
+}
+
+TEST(InputTest, ContentModifiedOutside) {
+  std::string content = "abc";
+  std::string placeholder;
+  auto option = InputOption();
+  option.cursor_position = 3;
+  auto input = Input(&content, &placeholder, &option);
+
+  input->OnEvent(Event::Backspace);
+  EXPECT_EQ(content, "ab");
+
+  content = "测试测试";
+  input->OnEvent(Event::Backspace);
+  EXPECT_EQ(content, "测测试");
+  EXPECT_EQ(option.cursor_position(), 1u);
+
+  input->OnEvent(Event::End);
+  EXPECT_EQ(option.cursor_position(), 3u);
+}
+
 TEST(InputTest, MouseClick) {
   std::string content;
   std::string placeholder;
@@ -487,6 +545,106 @@ TEST(InputTest, CtrlArrowRight2) {
   EXPECT_EQ(option.cursor_position(), 34u);
 }
 
+// The word break properties follow the edits of the content.
+TEST(InputTest, CtrlArrowAfterEdit) {
+  std::string content = "ab cd";
+  std::string placeholder;
+  auto option = InputOption();
+  option.cursor_position = 1;
+  auto input = Input(&content, &placeholder, &option);
+
+  EXPECT_TRUE(input->OnEvent(Event::Character(' ')));
+  EXPECT_EQ(content, "a b cd");
+  EXPECT_EQ(option.cursor_position(), 2);
+
+  EXPECT_TRUE(input->OnEvent(Event::ArrowRightCtrl));
+  EXPECT_EQ(option.cursor_position(), 3);
+
+  EXPECT_TRUE(input->OnEvent(Event::ArrowLeftCtrl));
+  EXPECT_EQ(option.cursor_position(), 2);
+
+  EXPECT_TRUE(input->OnEvent(Event::Backspace));
+  EXPECT_EQ(content, "ab cd");
+  EXPECT_TRUE(input->OnEvent(Event::ArrowLeftCtrl));
+  EXPECT_EQ(option.cursor_position(), 0);
+
+  EXPECT_TRUE(input->OnEvent(Event::ArrowRightCtrl));
+  EXPECT_EQ(option.cursor_position(), 2);
+  EXPECT_TRUE(input->OnEvent(Event::ArrowRightCtrl));
+  EXPECT_EQ(option.cursor_position(), 5);
+}
+
+// The gap buffer behaves like the plain content, over a sequence of edits.
+TEST(InputTest, GapBuffer) {
+  std::string content;
+  std::string content_gap;
+  for (int i = 0; i < 1000; ++i) {
+    content += "word\xC3\xA9 ";
+  }
+  content_gap = content;
+  std::string placeholder;
+  auto option = InputOption();
+  option.cursor_position = 3000;
+  auto option_gap = InputOption();
+  option_gap.cursor_position = 3000;
+  option_gap.gap_buffer = true;
+  Component input = Input(&content, &placeholder, &option);
+  Component input_gap = Input(&content_gap, &placeholder, &option_gap);
+  (void)input->Render();
+  (void)input_gap->Render();
+
+  const std::vector<Event> events = {
+      Event::Character("a"), Event::Character("\xE4\xB8\xAD"),
+      Event::Backspace,      Event::Delete,
+      Event::ArrowLeft,      Event::ArrowRight,
+      Event::ArrowLeftCtrl,  Event::ArrowRightCtrl,
+      Event::Paste("xyz"),
+  };
+  unsigned seed = 1;
+  for (int i = 0; i < 1000; ++i) {
+    seed = seed * 1103515245 + 12345;  // NOLINT
+    const Event& event = events[(seed >> 16) % events.size()];
+    EXPECT_EQ(input->OnEvent(event), input_gap->OnEvent(event));
+    EXPECT_EQ(option.cursor_position(), option_gap.cursor_position());
+    if (i % 100 == 0) {
+      (void)input_gap->Render();
+      EXPECT_EQ(content, content_gap);
+    }
+  }
+  (void)input_gap->Render();
+  EXPECT_EQ(content, content_gap);
+
+  // Modified from the outside.
+  content_gap = "abc";
+  EXPECT_TRUE(input_gap->OnEvent(Event::End));
+  EXPECT_TRUE(input_gap->OnEvent(Event::Character('d')));
+  (void)input_gap->Render();
+  EXPECT_EQ(content_gap, "abcd");
+}
+
+// With a gap buffer, the content is updated before |on_change| is called.
+TEST(InputTest, GapBufferOnChange) {
+  std::string content = "abc";
+  std::string placeholder;
+  std::string changed;
+  auto option = InputOption();
+  option.gap_buffer = true;
+  option.on_change = [&] { changed = content; };
+  Component input = Input(&content, &placeholder, &option);
+  (void)input->Render();
+
+  EXPECT_TRUE(input->OnEvent(Event::End));
+  EXPECT_TRUE(input->OnEvent(Event::Character('d')));
+  EXPECT_EQ(changed, "abcd");
+  EXPECT_TRUE(input->OnEvent(Event::Backspace));
+  EXPECT_EQ(changed, "abc");
+  EXPECT_TRUE(input->OnEvent(Event::Paste("xy")));
+  EXPECT_EQ(changed, "abcxy");
+
+  // The default one can still be called.
+  EXPECT_NO_THROW(InputOption().on_change());
+}
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
@@ -0,0 +1,58 @@
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <utility>     // for move
+
+#include "ftxui/component/component.hpp"  // for Lazy, Make
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/dom/elements.hpp"              // for Element
+
+namespace ftxui {
+
+/// @brief A component built by |factory| the first time it is rendered or
+/// receives an event. Until then, it is considered focusable.
+/// @param factory The function building the component.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto settings = Lazy([&] { return BuildSettingsPage(); });
+/// ```
+Component Lazy(std::function<Component()> factory) {
+  class Impl : public ComponentBase {
+   public:
+    explicit Impl(std::function<Component()> factory)
+        : factory_(std::move(factory)) {}
+
+   private:
+    Element Render() override {
+      Build();
+      return ComponentBase::Render();
+    }
+    bool HandleEvent(const Event& event) override {
+      Build();
+      return DispatchToChildren(event);
+    }
+    bool Focusable() const override {
+      return factory_ ? true : ComponentBase::Focusable();
+    }
+
+    void Build() {
+      if (factory_) {
+        Add(factory_());
+        factory_ = nullptr;  // Release what it captured.
+      }
+    }
+
+    std::function<Component()> factory_;
+  };
+
+  return Make<Impl>(std::move(factory));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,172 @@
+#include <algorithm>   // for clamp
+#include <functional>  // for function
+#include <memory>      // for make_shared, shared_ptr
+#include <mutex>       // for mutex, lock_guard
+#include <string>      // for string
+#include <utility>     // for move, swap
+#include <vector>      // for vector
+
+#include "ftxui/component/component.hpp"  // for LogView, LogAppender, Make
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"    // for logView, reflect, Element
+#include "ftxui/dom/log_buffer.hpp"  // for LogBuffer
+#include "ftxui/screen/box.hpp"      // for Box
+
+namespace ftxui {
+
+namespace {
+
+class LogViewBase : public ComponentBase {
+ public:
+  explicit LogViewBase(LogBuffer* buffer)
+      : buffer_(buffer), appended_(buffer->appended()) {}
+
+ private:
+  Element Render() override {
+    // While scrolled up, the same lines remain visible as new ones arrive.
+    if (scroll_ != 0) {
+      scroll_ += static_cast<int>(buffer_->appended() - appended_);
+    }
+    appended_ = buffer_->appended();
+    Clamp();
+    return logView(buffer_, scroll_) | reflect(box_);
+  }
+
+  bool HandleEvent(const Event& event) override {
+    if (event.is_mouse()) {
+      return OnMouseEvent(event);
+    }
+    if (!Focused()) {
+      return false;
+    }
+
+    const int old_scroll = scroll_;
+    const int page = box_.y_max - box_.y_min;
+    if (event == Event::ArrowUp || event == Event::Character('k')) {
+      scroll_++;
+    }
+    if (event == Event::ArrowDown || event == Event::Character('j')) {
+      scroll_--;
+    }
+    if (event == Event::PageUp) {
+      scroll_ += page;
+    }
+    if (event == Event::PageDown) {
+      scroll_ -= page;
+    }
+    if (event == Event::Home) {
+      scroll_ = static_cast<int>(buffer_->size());
+    }
+    if (event == Event::End) {
+      scroll_ = 0;
+    }
+    Clamp();
+    return scroll_ != old_scroll;
+  }
+
+  bool OnMouseEvent(const Event& event) {
+    if (!box_.Contain(event.mouse().x, event.mouse().y)) {
+      return false;
+    }
+    if (event.mouse().button == Mouse::WheelUp) {
+      scroll_ += 3;  // NOLINT
+    } else if (event.mouse().button == Mouse::WheelDown) {
+      scroll_ -= 3;  // NOLINT
+    } else {
+      return false;
+    }
+    Clamp();
+    TakeFocus();
+    return true;
+  }
+
+  // Stop scrolling once the oldest line is at the top.
+  void Clamp() {
+    const int height = box_.y_max - box_.y_min + 1;
+    const int size = static_cast<int>(buffer_->size());
+    scroll_ = std::clamp(scroll_, 0, std::max(0, size - height));
+  }
+
+  bool Focusable() const final { return true; }
+
+  LogBuffer* buffer_;
+  size_t appended_;
+  int scroll_ = 0;  // The number of lines hidden below.
+  Box box_;
+};
+
+struct PendingLogs {
+  std::mutex mutex;
+  std::vector<std::string> lines;
+  bool posted = false;
+};
+
+}  // namespace
+
+/// @brief A scrollable view of the last lines of a LogBuffer. It follows the
+/// new lines, unless the user scrolled up. Use the arrow keys, the page keys,
+/// Home, End or the mouse wheel to scroll.
+/// @param buffer The lines. It must outlive the component.
+/// @ingroup component
+/// @see LogAppender
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// LogBuffer logs(10000);
+/// auto component = LogView(&logs);
+/// screen.Loop(component);
+/// ```
+Component LogView(LogBuffer* buffer) {
+  return Make<LogViewBase>(buffer);
+}
+
+/// @brief Return a function appending lines to |buffer|, callable from any
+/// thread. The lines are queued, and appended by the loop of |screen| in
+/// batches, with a single task and a single redraw per batch.
+/// @param buffer The lines. It must outlive the screen loop.
+/// @param screen The screen drawing |buffer|.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto append = LogAppender(&logs, &screen);
+/// std::thread worker([append] {
+///   append("Worker started");
+/// });
+/// ```
+std::function<void(std::string)> LogAppender(LogBuffer* buffer,
+                                             ScreenInteractive* screen) {
+  auto pending = std::make_shared<PendingLogs>();
+  return [buffer, screen, pending](std::string line) {
+    const std::lock_guard<std::mutex> lock(pending->mutex);
+    pending->lines.push_back(std::move(line));
+    if (pending->posted) {
+      return;
+    }
+    pending->posted = true;
+    screen->Post([buffer, pending] {
+      std::vector<std::string> lines;
+      {
+        const std::lock_guard<std::mutex> guard(pending->mutex);
+        std::swap(lines, pending->lines);
+        pending->posted = false;
+      }
+      for (const std::string& l : lines) {
+        buffer->Append(l);
+      }
+    });
+    screen->PostEvent(Event::Custom);
+  };
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
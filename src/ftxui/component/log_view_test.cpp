@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <string>  // for to_string
+
+#include "ftxui/component/component.hpp"       // for LogView
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowUp, Event::End
+#include "ftxui/dom/log_buffer.hpp"   // for LogBuffer
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+TEST(LogViewTest, FollowAndScroll) {
+  LogBuffer logs(100);
+  for (int i = 0; i < 10; ++i) {
+    logs.Append(std::to_string(i));
+  }
+  auto component = LogView(&logs);
+  Screen screen(1, 2);
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "8\r\n9");
+
+  // New lines are followed.
+  logs.Append("a");
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "9\r\na");
+
+  EXPECT_TRUE(component->OnEvent(Event::ArrowUp));
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "8\r\n9");
+
+  // While scrolled up, the view stays on the same lines.
+  logs.Append("b");
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "8\r\n9");
+
+  EXPECT_TRUE(component->OnEvent(Event::Home));
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "0\r\n1");
+  EXPECT_FALSE(component->OnEvent(Event::ArrowUp));
+
+  EXPECT_TRUE(component->OnEvent(Event::End));
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "a\r\nb");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
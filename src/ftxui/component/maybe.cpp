@@ -3,7 +3,8 @@
 #include <type_traits>  // for remove_reference, remove_reference<>::type
 #include <utility>      // for move
 
-#include "ftxui/component/component.hpp"  // for ComponentDecorator, Maybe, Make
+#include "ftxui/component/animation.hpp"  // for Params, RequestAnimationFrame
+#include "ftxui/component/component.hpp"  // for ComponentDecorator, Maybe, Make, Lazy
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/dom/elements.hpp"              // for Element
@@ -18,16 +19,33 @@ Component Maybe(Component child, std::function<bool()> show) {
 
    private:
     Element Render() override {
-      return show_() ? ComponentBase::Render() : std::make_unique<Node>();
+      if (!show_()) {
+        return MakeNode<Node>();
+      }
+      // Shown again: the child missed the animation frames while hidden.
+      if (suspended_) {
+        suspended_ = false;
+        animation::RequestAnimationFrame();
+      }
+      return ComponentBase::Render();
+    }
+    // The hidden child isn't animated, and doesn't request frames.
+    void OnAnimation(animation::Params& params) override {
+      if (show_()) {
+        ComponentBase::OnAnimation(params);
+      } else {
+        suspended_ = true;
+      }
     }
     bool Focusable() const override {
       return show_() && ComponentBase::Focusable();
     }
-    bool OnEvent(Event event) override {
-      return show_() && ComponentBase::OnEvent(event);
+    bool HandleEvent(const Event& event) override {
+      return show_() && DispatchToChildren(event);
     }
 
     std::function<bool()> show_;
+    bool suspended_ = false;
   };
 
   auto maybe = Make<Impl>(std::move(show));
@@ -68,6 +86,33 @@ Component Maybe(Component child, const bool* show) {
   return Maybe(std::move(child), [show] { return *show; });
 }
 
+/// @brief A component built by |factory| the first time |show| is true. It is
+/// shown only when |show| is true.
+/// @params factory The function building the component.
+/// @params show a boolean. The component is shown when |show| is true.
+/// @ingroup component
+/// @see Lazy
+///
+/// ### Example
+///
+/// ```cpp
+/// auto maybe_component = Maybe([&] { return BuildDetails(); }, &show);
+/// ```
+Component Maybe(std::function<Component()> factory, const bool* show) {
+  return Maybe(Lazy(std::move(factory)), show);
+}
+
+/// @brief A component built by |factory| the first time the |show| function
+/// returns true. It is shown only when |show| returns true.
+/// @params factory The function building the component.
+/// @params show a function returning whether the component should be shown.
+/// @ingroup component
+/// @see Lazy
+Component Maybe(std::function<Component()> factory,
+                std::function<bool()> show) {
+  return Maybe(Lazy(std::move(factory)), std::move(show));
+}
+
 /// @brief Decorate a component. It is shown only when |show| is true.
 /// @params show a boolean. |child| is shown when |show| is true.
 /// @ingroup component
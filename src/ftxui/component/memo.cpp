@@ -0,0 +1,119 @@
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <utility>     // for move
+
+#include "ftxui/component/component.hpp"  // for ComponentDecorator, Memo, Make
+#include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/observable.hpp"  // for ObservableBase
+#include "ftxui/dom/elements.hpp"              // for Element, retained
+
+namespace ftxui {
+
+/// @brief Decorate a component. The Element it renders is reused by the next
+/// frames, as long as |deps| returns the same key, and the Observable read by
+/// its rendering don't change. The key must change
+/// whenever the rendering of |child| would: for instance a version counter
+/// incremented when the displayed data changes, or a hash of it. The layout of
+/// the reused Element is reused as well.
+/// @param child The component to memoize.
+/// @param deps The function returning the key the rendering depends on.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// size_t version = 0;  // Incremented when |entries| changes.
+/// auto table = Renderer([&] { return BuildTable(entries); });
+/// auto memoized_table = Memo(table, [&] { return version; });
+/// ```
+Component Memo(Component child, std::function<size_t()> deps) {
+  class Impl : public ComponentBase {
+   public:
+    explicit Impl(std::function<size_t()> deps) : deps_(std::move(deps)) {}
+
+   private:
+    Element Render() override {
+      // The focus changes the rendering too.
+      const size_t key = deps_ ? deps_() : 0;
+      const bool focused = Focused();
+      if (!element_ || key != key_ || focused != focused_ ||
+          ObservableBase::Changed(reads_)) {
+        const ObservableBase::ReadScope scope;
+        element_ = retained(ComponentBase::Render());
+        key_ = key;
+        focused_ = focused;
+        reads_ = scope.reads();
+      } else {
+        // The enclosing Memo depends on them too.
+        ObservableBase::ReadScope::Report(reads_);
+      }
+      return element_;
+    }
+
+    std::function<size_t()> deps_;
+    Element element_;
+    size_t key_ = 0;
+    bool focused_ = false;
+    ObservableBase::Reads reads_;
+  };
+
+  auto memo = Make<Impl>(std::move(deps));
+  memo->Add(std::move(child));
+  return memo;
+}
+
+/// @brief Decorate a component. The Element it renders is reused by the next
+/// frames, until one of the Observable read by its rendering changes.
+/// @param child The component to memoize.
+/// @ingroup component
+/// @see Observable
+///
+/// ### Example
+///
+/// ```cpp
+/// Observable<std::vector<Entry>> entries;
+/// auto table = Renderer([&] { return BuildTable(entries.Get()); });
+/// auto memoized_table = Memo(table);
+/// ```
+Component Memo(Component child) {
+  return Memo(std::move(child), nullptr);
+}
+
+/// @brief Decorate a component. The Element it renders is reused by the next
+/// frames, as long as |deps| returns the same key.
+/// @param deps The function returning the key the rendering depends on.
+/// @ingroup component
+/// @see Memo
+///
+/// ### Example
+///
+/// ```cpp
+/// auto table = Renderer([&] { return BuildTable(entries); })
+///            | Memo([&] { return version; });
+/// ```
+ComponentDecorator Memo(std::function<size_t()> deps) {
+  return [deps = std::move(deps)](Component child) mutable {
+    return Memo(std::move(child), std::move(deps));
+  };
+}
+
+/// @brief Decorate a component. The Element it renders is reused by the next
+/// frames, until one of the Observable read by its rendering changes.
+/// @ingroup component
+/// @see Memo
+///
+/// ### Example
+///
+/// ```cpp
+/// auto table = Renderer([&] { return BuildTable(entries.Get()); }) | Memo();
+/// ```
+ComponentDecorator Memo() {
+  return [](Component child) { return Memo(std::move(child)); };
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
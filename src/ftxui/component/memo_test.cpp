@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include <cstddef>  // for size_t
+#include <memory>   // for __shared_ptr_access, shared_ptr, allocator
+#include <string>   // for string, to_string
+
+#include "ftxui/component/component.hpp"       // for Memo, Renderer
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/dom/elements.hpp"              // for text, Element
+#include "ftxui/dom/node.hpp"                  // for Render
+#include "ftxui/screen/screen.hpp"             // for Screen
+
+namespace ftxui {
+
+TEST(MemoTest, Basic) {
+  int renders = 0;
+  int value = 0;
+  size_t version = 0;
+  auto component = Renderer([&] {
+                     renders++;
+                     return text(std::to_string(value));
+                   }) |
+                   Memo([&] { return version; });
+
+  Screen screen(1, 1);
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "0");
+  EXPECT_EQ(renders, 1);
+
+  // The version didn't change. The stale element is reused.
+  value = 1;
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "0");
+  EXPECT_EQ(renders, 1);
+
+  version++;
+  Render(screen, component->Render());
+  EXPECT_EQ(screen.ToString(), "1");
+  EXPECT_EQ(renders, 2);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
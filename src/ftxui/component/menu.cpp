@@ -1,23 +1,26 @@
-#include <algorithm>   // for max, fill_n, reverse
-#include <chrono>      // for milliseconds
-#include <functional>  // for function
-#include <memory>      // for allocator_traits<>::value_type, swap
-#include <string>      // for operator+, string
-#include <utility>     // for move
-#include <vector>      // for vector, __alloc_traits<>::value_type
-
-#include "ftxui/component/animation.hpp"       // for Animator, Linear
+#include <algorithm>      // for max, min, fill_n, reverse
+#include <chrono>         // for milliseconds
+#include <cstddef>        // for size_t
+#include <functional>     // for function
+#include <memory>         // for allocator_traits<>::value_type, swap
+#include <string>         // for operator+, string
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector, __alloc_traits<>::value_type
+
+#include "ftxui/component/animation.hpp"       // for Animator
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
 #include "ftxui/component/component.hpp"  // for Make, Menu, MenuEntry, Toggle
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for MenuOption, MenuEntryOption, MenuOption::Direction, UnderlineOption, AnimatedColorOption, AnimatedColorsOption, EntryState, MenuOption::Down, MenuOption::Left, MenuOption::Right, MenuOption::Up
+#include "ftxui/component/entry_cache.hpp"  // for EntryCache
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return, Event::Tab, Event::TabReverse
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Released, Mouse::WheelDown, Mouse::WheelUp, Mouse::None
 #include "ftxui/component/screen_interactive.hpp"  // for Component
-#include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, Decorator, nothing, Elements, bgcolor, color, hbox, separatorHSelector, separatorVSelector, vbox, xflex, yflex, text, bold, focus, inverted, select
+#include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, Decorator, nothing, Elements, bgcolor, color, hbox, separatorHSelector, separatorVSelector, vbox, xflex, yflex, text, bold, focus, inverted, select, virtualList
 #include "ftxui/screen/box.hpp"    // for Box
 #include "ftxui/screen/color.hpp"  // for Color
-#include "ftxui/screen/util.hpp"   // for clamp
+#include "ftxui/screen/util.hpp"   // for clamp, HeapSize
 #include "ftxui/util/ref.hpp"  // for Ref, ConstStringListRef, ConstStringRef
 
 namespace ftxui {
@@ -96,46 +99,54 @@ class MenuBase : public ComponentBase {
   void OnAnimation(animation::Params& params) override {
     animator_first_.OnAnimation(params);
     animator_second_.OnAnimation(params);
-    for (auto& animator : animator_background_) {
-      animator.OnAnimation(params);
-    }
-    for (auto& animator : animator_foreground_) {
-      animator.OnAnimation(params);
+    for (auto& [i, animation] : animations_) {
+      animation.animator_background.OnAnimation(params);
+      animation.animator_foreground.OnAnimation(params);
     }
   }
 
   Element Render() override {
     Clamp();
     UpdateAnimationTarget();
+    if (option_->underline.enabled ||
+        option_->entries.animated_colors.foreground.enabled ||
+        option_->entries.animated_colors.background.enabled) {
+      RequestMouseMotion();
+    }
+
+    // The boxes of the entries drawn by the previous frame. They are reflected
+    // again only if still drawn.
+    for (int i = drawn_first_; i <= std::min(drawn_last_, size() - 1); ++i) {
+      boxes_[i] = Box{0, -1, 0, -1};
+    }
+    drawn_first_ = size();
+    drawn_last_ = -1;
+
+    // The elements of the entries are kept across frames, unless the list is
+    // virtualized: it might be too long to keep one per entry.
+    caches_.resize(option_->virtualized ? 0 : size_t(size()));
 
     Elements elements;
     const bool is_menu_focused = Focused();
     if (option_->elements_prefix) {
       elements.push_back(option_->elements_prefix());
     }
-    for (int i = 0; i < size(); ++i) {
-      if (i != 0 && option_->elements_infix) {
-        elements.push_back(option_->elements_infix());
+    if (option_->virtualized && !IsHorizontal()) {
+      const bool inverted = IsInverted(option_->direction);
+      const int last = size() - 1;
+      elements.push_back(virtualList(
+          size(), 1,
+          [this, inverted, last, is_menu_focused](int i) {
+            return RenderEntry(inverted ? last - i : i, is_menu_focused);
+          },
+          inverted ? last - selected_focus_ : selected_focus_));
+    } else {
+      for (int i = 0; i < size(); ++i) {
+        if (i != 0 && option_->elements_infix) {
+          elements.push_back(option_->elements_infix());
+        }
+        elements.push_back(RenderEntry(i, is_menu_focused));
       }
-      const bool is_focused = (focused_entry() == i) && is_menu_focused;
-      const bool is_selected = (*selected_ == i);
-
-      const EntryState state = {
-          entries_[i],
-          false,
-          is_selected,
-          is_focused,
-      };
-
-      auto focus_management =
-          is_menu_focused && (selected_focus_ == i) ? focus : nothing;
-
-      const Element element =
-          (option_->entries.transform ? option_->entries.transform
-                                      : DefaultOptionTransform)  //
-          (state);
-      elements.push_back(element | AnimatedColorStyle(i) | reflect(boxes_[i]) |
-                         focus_management);
     }
     if (option_->elements_postfix) {
       elements.push_back(option_->elements_postfix());
@@ -171,6 +182,33 @@ class MenuBase : public ComponentBase {
     }
   }
 
+  Element RenderEntry(int i, bool is_menu_focused) {
+    drawn_first_ = std::min(drawn_first_, i);
+    drawn_last_ = std::max(drawn_last_, i);
+
+    const bool is_focused = (focused_entry() == i) && is_menu_focused;
+    const bool is_selected = (*selected_ == i);
+
+    const EntryState state = {
+        entries_[i],
+        false,
+        is_selected,
+        is_focused,
+    };
+
+    auto focus_management =
+        is_menu_focused && (selected_focus_ == i) ? focus : nothing;
+
+    const EntryCache::Transform& transform =
+        option_->entries.transform ? option_->entries.transform
+                                   : DefaultOptionTransform;
+    const Element element = size_t(i) < caches_.size()
+                                ? caches_[size_t(i)].Get(state, transform)
+                                : transform(state);
+    return element | AnimatedColorStyle(i) | reflect(boxes_[i]) |
+           focus_management;
+  }
+
   void SelectedTakeFocus() {
     selected_previous_ = *selected_;
     selected_focus_ = *selected_;
@@ -233,7 +271,7 @@ class MenuBase : public ComponentBase {
   }
 
   // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-  bool OnEvent(Event event) override {
+  bool HandleEvent(const Event& event) override {
     Clamp();
     if (!CaptureMouse(event)) {
       return false;
@@ -294,7 +332,7 @@ class MenuBase : public ComponentBase {
     return false;
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (event.mouse().button == Mouse::WheelDown ||
         event.mouse().button == Mouse::WheelUp) {
       return OnMouseWheel(event);
@@ -307,13 +345,16 @@ class MenuBase : public ComponentBase {
     if (!CaptureMouse(event)) {
       return false;
     }
-    for (int i = 0; i < size(); ++i) {
+    for (int i = drawn_first_; i <= std::min(drawn_last_, size() - 1); ++i) {
       if (!boxes_[i].Contain(event.mouse().x, event.mouse().y)) {
         continue;
       }
 
       TakeFocus();
-      focused_entry() = i;
+      if (focused_entry() != i) {
+        focused_entry() = i;
+        Invalidate();
+      }
       if (event.mouse().button == Mouse::Left &&
           event.mouse().motion == Mouse::Released) {
         if (*selected_ != i) {
@@ -354,55 +395,61 @@ class MenuBase : public ComponentBase {
     UpdateUnderlineTarget();
   }
 
+  // Only the selected entry, the focused one, and the ones still fading out
+  // have a color to animate. The others have none.
   void UpdateColorTarget() {
-    if (size() != (int)animation_background_.size()) {
-      animation_background_.resize(size());
-      animation_foreground_.resize(size());
-      animator_background_.clear();
-      animator_foreground_.clear();
-
-      for (int i = 0; i < size(); ++i) {
-        animation_background_[i] = 0.F;
-        animation_foreground_[i] = 0.F;
-        animator_background_.emplace_back(&animation_background_[i], 0.F,
-                                          std::chrono::milliseconds(0),
-                                          animation::easing::Linear);
-        animator_foreground_.emplace_back(&animation_foreground_[i], 0.F,
-                                          std::chrono::milliseconds(0),
-                                          animation::easing::Linear);
-      }
+    if (size() != animated_size_) {
+      animated_size_ = size();
+      animations_.clear();
+    }
+    if (size() == 0) {
+      return;
     }
 
     const bool is_menu_focused = Focused();
-    for (int i = 0; i < size(); ++i) {
+    animations_.try_emplace(*selected_);
+    animations_.try_emplace(focused_entry());
+    for (auto it = animations_.begin(); it != animations_.end();) {
+      const int i = it->first;
+      EntryAnimation& animation = it->second;
       const bool is_focused = (focused_entry() == i) && is_menu_focused;
       const bool is_selected = (*selected_ == i);
       float target = is_selected ? 1.F : is_focused ? 0.5F : 0.F;  // NOLINT
-      if (animator_background_[i].to() != target) {
-        animator_background_[i] = animation::Animator(
-            &animation_background_[i], target,
+      if (animation.animator_background.to() != target) {
+        animation.animator_background = animation::Animator(
+            &animation.background, target,
             option_->entries.animated_colors.background.duration,
             option_->entries.animated_colors.background.function);
-        animator_foreground_[i] = animation::Animator(
-            &animation_foreground_[i], target,
+        animation.animator_foreground = animation::Animator(
+            &animation.foreground, target,
             option_->entries.animated_colors.foreground.duration,
             option_->entries.animated_colors.foreground.function);
       }
+      if (target == 0.F && animation.background == 0.F &&
+          animation.foreground == 0.F) {
+        it = animations_.erase(it);
+      } else {
+        ++it;
+      }
     }
   }
 
   Decorator AnimatedColorStyle(int i) {
+    const auto it = animations_.find(i);
+    const bool found = it != animations_.end();
+    const float background = found ? it->second.background : 0.F;
+    const float foreground = found ? it->second.foreground : 0.F;
     Decorator style = nothing;
     if (option_->entries.animated_colors.foreground.enabled) {
       style = style | color(Color::Interpolate(
-                          animation_foreground_[i],
+                          foreground,
                           option_->entries.animated_colors.foreground.inactive,
                           option_->entries.animated_colors.foreground.active));
     }
 
     if (option_->entries.animated_colors.background.enabled) {
       style = style | bgcolor(Color::Interpolate(
-                          animation_background_[i],
+                          background,
                           option_->entries.animated_colors.background.inactive,
                           option_->entries.animated_colors.background.active));
     }
@@ -460,6 +507,19 @@ class MenuBase : public ComponentBase {
     return float(value);
   }
 
+  size_t MemoryUsage() const override {
+    size_t bytes = ComponentBase::MemoryUsage() + util::HeapSize(boxes_) +
+                   util::HeapSize(caches_);
+    for (const EntryCache& cache : caches_) {
+      bytes += cache.MemoryUsage();
+    }
+    // The nodes of the map, and its buckets.
+    bytes += animations_.size() *
+                 (sizeof(decltype(animations_)::value_type) + sizeof(void*)) +
+             animations_.bucket_count() * sizeof(void*);
+    return bytes;
+  }
+
  protected:
   ConstStringListRef entries_;
   int* selected_;
@@ -468,17 +528,29 @@ class MenuBase : public ComponentBase {
   Ref<MenuOption> option_;
 
   std::vector<Box> boxes_;
+  std::vector<EntryCache> caches_;
   Box box_;
+  // The range of entries drawn by the last frame.
+  int drawn_first_ = 0;
+  int drawn_last_ = -1;
 
   float first_ = 0.F;
   float second_ = 0.F;
   animation::Animator animator_first_ = animation::Animator(&first_, 0.F);
   animation::Animator animator_second_ = animation::Animator(&second_, 0.F);
 
-  std::vector<animation::Animator> animator_background_;
-  std::vector<animation::Animator> animator_foreground_;
-  std::vector<float> animation_background_;
-  std::vector<float> animation_foreground_;
+  // The colors of the entries, animated between 0 (inactive) and 1 (active).
+  // Only the entries not at rest are stored.
+  struct EntryAnimation {
+    float background = 0.F;
+    float foreground = 0.F;
+    animation::Animator animator_background =
+        animation::Animator(&background, 0.F);
+    animation::Animator animator_foreground =
+        animation::Animator(&foreground, 0.F);
+  };
+  std::unordered_map<int, EntryAnimation> animations_;
+  int animated_size_ = 0;
 };
 
 /// @brief A list of text. The focused element is selected.
@@ -559,6 +631,10 @@ Component MenuEntry(ConstStringRef label, Ref<MenuEntryOption> option) {
     Element Render() override {
       const bool focused = Focused();
       UpdateAnimationTarget();
+      if (option_->animated_colors.foreground.enabled ||
+          option_->animated_colors.background.enabled) {
+        RequestMouseMotion();
+      }
 
       const EntryState state = {
           *label_,
@@ -567,9 +643,9 @@ Component MenuEntry(ConstStringRef label, Ref<MenuEntryOption> option) {
           focused,
       };
 
-      const Element element =
-          (option_->transform ? option_->transform : DefaultOptionTransform)  //
-          (state);
+      const Element element = cache_.Get(
+          state,
+          option_->transform ? option_->transform : DefaultOptionTransform);
 
       auto focus_management = focused ? select : nothing;
       return element | AnimatedColorStyle() | focus_management | reflect(box_);
@@ -610,12 +686,16 @@ Component MenuEntry(ConstStringRef label, Ref<MenuEntryOption> option) {
     }
 
     bool Focusable() const override { return true; }
-    bool OnEvent(Event event) override {
+    bool HandleEvent(const Event& event) override {
       if (!event.is_mouse()) {
         return false;
       }
 
-      hovered_ = box_.Contain(event.mouse().x, event.mouse().y);
+      const bool hovered = box_.Contain(event.mouse().x, event.mouse().y);
+      if (hovered != hovered_) {
+        hovered_ = hovered;
+        Invalidate();
+      }
 
       if (!hovered_) {
         return false;
@@ -636,6 +716,7 @@ Component MenuEntry(ConstStringRef label, Ref<MenuEntryOption> option) {
     }
 
     ConstStringRef label_;
+    EntryCache cache_;
     Ref<MenuEntryOption> option_;
     Box box_;
     bool hovered_ = false;
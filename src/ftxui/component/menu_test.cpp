@@ -5,11 +5,15 @@
 #include <vector>  // for vector
 
 #include "ftxui/component/animation.hpp"          // for Duration, Params
-#include "ftxui/component/component.hpp"          // for Menu
+#include "ftxui/component/component.hpp"          // for Menu, Button, Container
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for MenuOption, MenuOption::Down, MenuOption::Left, MenuOption::Right, MenuOption::Up
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::Return
-#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Released
+#include "ftxui/dom/elements.hpp"     // for text, frame
+#include "ftxui/dom/node.hpp"         // for Render, Node
+#include "ftxui/dom/profiler.hpp"     // for DescribeTree, TreeReport
+#include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Screen
 #include "ftxui/util/ref.hpp"         // for Ref
 
@@ -57,7 +61,7 @@ TEST(MenuTest, DirectionDown) {
   Screen screen(4, 3);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "\x1B[1m\x1B[7m> 1 \x1B[22m\x1B[27m\r\n"
+            "\x1B[1;7m> 1 \x1B[0m\r\n"
             "  2 \r\n"
             "  3 ");
 
@@ -86,7 +90,7 @@ TEST(MenuTest, DirectionsUp) {
   EXPECT_EQ(screen.ToString(),
             "  3 \r\n"
             "  2 \r\n"
-            "\x1B[1m\x1B[7m> 1 \x1B[22m\x1B[27m");
+            "\x1B[1;7m> 1 \x1B[0m");
   menu->OnEvent(Event::ArrowDown);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowUp);
@@ -110,9 +114,7 @@ TEST(MenuTest, DirectionsRight) {
   Screen screen(10, 1);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "\x1B[1m\x1B[7m> 1\x1B[22m\x1B[27m"
-            "  2"
-            "  3 ");
+            "\x1B[1;7m> 1\x1B[0m  2  3 ");
   menu->OnEvent(Event::ArrowLeft);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowRight);
@@ -136,9 +138,7 @@ TEST(MenuTest, DirectionsLeft) {
   Screen screen(10, 1);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "  3"
-            "  2"
-            "\x1B[1m\x1B[7m> 1\x1B[22m\x1B[27m ");
+            "  3  2\x1B[1;7m> 1\x1B[0m ");
   menu->OnEvent(Event::ArrowRight);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowLeft);
@@ -163,9 +163,10 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[7m1\x1B[22m\x1B[27m \x1B[2m2\x1B[22m "
-        "\r\n\x1B[97m\x1B[49m\xE2\x94\x80\x1B[90m\x1B["
-        "49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[1;7m1\x1B[0m \x1B[2m2\x1B[0m \r\n"
+        "\x1B[97m\xE2\x94\x80\x1B[90m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[0"
+        "m\r\n"
+        "    ");
   }
   selected = 1;
   {
@@ -173,9 +174,10 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m "
-        "\r\n\x1B[97m\x1B[49m\xE2\x94\x80\x1B[90m\x1B["
-        "49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[7m1\x1B[0m \x1B[1m2\x1B[0m \r\n"
+        "\x1B[97m\xE2\x94\x80\x1B[90m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[0"
+        "m\r\n"
+        "    ");
   }
   animation::Params params(2s);
   menu->OnAnimation(params);
@@ -184,9 +186,10 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m "
-        "\r\n\x1B[90m\x1B[49m\xE2\x94\x80\xE2\x95\xB4\x1B[97m\x1B["
-        "49m\xE2\x94\x80\x1B[90m\x1B[49m\xE2\x95\xB6\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[7m1\x1B[0m \x1B[1m2\x1B[0m \r\n"
+        "\x1B[90m\xE2\x94\x80\xE2\x95\xB4\x1B[97m\xE2\x94\x80\x1B[90m\xE2\x95"
+        "\xB6\x1B[0m\r\n"
+        "    ");
   }
 }
 
@@ -200,11 +203,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[90m\x1B[49m\xE2\x94\x82\x1B[1m\x1B[7m\x1B[39m\x1B[49m1\x1B["
-        "22m\x1B[27m        "
-        "\r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[2m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x94\x82\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[90m\xE2\x94\x82\x1B[0;1;7m1\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x95\xB7\x1B[0;2m2\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x94\x82\x1B[0;2m3\x1B[0m        ");
   }
   selected = 1;
   {
@@ -212,10 +213,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[90m\x1B[49m\xE2\x94\x82\x1B[7m\x1B[39m\x1B[49m1\x1B[27m        "
-        "\r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[1m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x94\x82\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[90m\xE2\x94\x82\x1B[0;7m1\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x95\xB7\x1B[0;1m2\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x94\x82\x1B[0;2m3\x1B[0m        ");
   }
   animation::Params params(2s);
   menu->OnAnimation(params);
@@ -224,13 +224,87 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[97m\x1B[49m\xE2\x95\xB5\x1B[7m\x1B[39m\x1B[49m1\x1B[27m        "
-        "\r\n\x1B[90m\x1B[49m\xE2\x94\x82\x1B[1m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[97m\xE2\x95\xB5\x1B[0;7m1\x1B[0m        \r\n"
+        "\x1B[90m\xE2\x94\x82\x1B[0;1m2\x1B[0m        \r\n"
+        "\x1B[97m\xE2\x95\xB7\x1B[0;2m3\x1B[0m        ");
   }
 }
 
+TEST(MenuTest, Virtualized) {
+  int selected = 50000;
+  std::vector<std::string> entries;
+  for (int i = 0; i < 100000; ++i) {
+    entries.push_back(std::to_string(i));
+  }
+  int transformed = 0;
+  MenuOption option;
+  option.virtualized = true;
+  option.entries.transform = [&](const EntryState& state) {
+    transformed++;
+    return text((state.active ? ">" : " ") + state.label);
+  };
+  auto menu = Menu(&entries, &selected, &option);
+
+  Screen screen(6, 3);
+  Render(screen, menu->Render() | frame);
+  EXPECT_EQ(screen.ToString(), " 49999\r\n>50000\r\n 50001");
+  // The selected entry, to estimate the width, and the 3 visible ones.
+  EXPECT_EQ(transformed, 4);
+
+  // Only the visible entries react to the mouse.
+  EXPECT_TRUE(menu->OnEvent(Event::Mouse(
+      "", Mouse{Mouse::Left, Mouse::Released, false, false, false, 1, 2})));
+  EXPECT_EQ(selected, 50001);
+}
+
+TEST(MenuTest, MemoryUsage) {
+  std::vector<std::string> entries(100, "entry");
+  int selected = 0;
+  auto menu = Menu(&entries, &selected);
+  auto root = Container::Vertical({menu, Button("OK", [] {})});
+
+  const TreeReport empty = DescribeTree(*root);
+  EXPECT_EQ(empty.nodes, 3u);
+  ASSERT_EQ(empty.types.size(), 3u);
+
+  // The boxes, and the cached Elements of every entry.
+  Screen screen(10, 100);
+  Render(screen, root->Render());
+  const TreeReport rendered = DescribeTree(*root);
+  EXPECT_EQ(rendered.nodes, 3u);
+  EXPECT_GT(rendered.bytes, empty.bytes + 100 * (sizeof(Box) + sizeof(Node)));
+  EXPECT_EQ(rendered.types.size(), 3u);
+  EXPECT_GE(menu->MemoryUsage(), rendered.bytes - empty.bytes);
+}
+
+TEST(MenuTest, Adapter) {
+  class Entries : public ConstStringListRef::Adapter {
+   public:
+    size_t size() const override { return 1000000; }
+    std::string_view operator[](size_t i) const override {
+      requested++;
+      return (i % 2) ? "odd" : "even";
+    }
+    mutable int requested = 0;
+  };
+
+  Entries entries;
+  int selected = 1;
+  MenuOption option;
+  option.virtualized = true;
+  auto menu = Menu(&entries, &selected, &option);
+
+  Screen screen(6, 2);
+  Render(screen, menu->Render() | frame);
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[1m> odd \x1B[0m\r\n"
+            "  even");
+  EXPECT_LE(entries.requested, 3);
+
+  EXPECT_TRUE(menu->OnEvent(Event::End));
+  EXPECT_EQ(selected, 999999);
+}
+
 }  // namespace ftxui
 
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
@@ -1,10 +1,15 @@
 #include <ftxui/component/event.hpp>  // for Event
-#include <ftxui/dom/elements.hpp>  // for operator|, Element, center, clear_under, dbox
+#include <ftxui/dom/elements.hpp>  // for operator|, Element, center, clear_under, dbox, cached, dim
+#include <cstdint>                 // for uintptr_t
 #include <memory>                  // for __shared_ptr_access, shared_ptr
+#include <string>                  // for string, to_string
 #include <utility>                 // for move
 
 #include "ftxui/component/component.hpp"  // for Make, Tab, ComponentDecorator, Modal
 #include "ftxui/component/component_base.hpp"  // for Component, ComponentBase
+#include "ftxui/component/component_options.hpp"  // for ModalOption
+#include "ftxui/screen/terminal.hpp"  // for Dimensions, CachedSize
+#include "ftxui/util/ref.hpp"         // for Ref
 
 namespace ftxui {
 
@@ -12,49 +17,87 @@ namespace ftxui {
 // top of the other when |show_modal| is true.
 /// @ingroup component
 // NOLINTNEXTLINE
-Component Modal(Component main, Component modal, const bool* show_modal) {
+Component Modal(Component main,
+                Component modal,
+                const bool* show_modal,
+                Ref<ModalOption> option) {
   class Impl : public ComponentBase {
    public:
-    explicit Impl(Component main, Component modal, const bool* show_modal)
+    explicit Impl(Component main,
+                  Component modal,
+                  const bool* show_modal,
+                  Ref<ModalOption> option)
         : main_(std::move(main)),
           modal_(std::move(modal)),
-          show_modal_(show_modal) {
+          show_modal_(show_modal),
+          option_(std::move(option)) {
       Add(Container::Tab({main_, modal_}, &selector_));
     }
 
    private:
     Element Render() override {
       selector_ = *show_modal_;
-      auto document = main_->Render();
-      if (*show_modal_) {
-        document = dbox({
-            document,
-            modal_->Render() | clear_under | center,
-        });
+      if (!*show_modal_) {
+        frozen_ = nullptr;
+        return main_->Render();
       }
-      return document;
+
+      auto document = RenderMain();
+      if (option_->dim_main) {
+        document |= dim;
+      }
+      return dbox({
+          document,
+          modal_->Render() | clear_under | center,
+      });
     }
 
-    bool OnEvent(Event event) override {
+    // With ModalOption::freeze_main, the main component is rendered once when
+    // the modal opens, and its pixels are copied by the next frames.
+    Element RenderMain() {
+      if (!option_->freeze_main) {
+        return main_->Render();
+      }
+      const Dimensions size = Terminal::CachedSize();
+      if (!frozen_ || size.dimx != frozen_size_.dimx ||
+          size.dimy != frozen_size_.dimy) {
+        frozen_size_ = size;
+        frozen_ = main_->Render() |
+                  cached("modal:" +
+                         std::to_string(reinterpret_cast<uintptr_t>(this)) +
+                         ":" + std::to_string(++frozen_count_));
+      }
+      return frozen_;
+    }
+
+    bool HandleEvent(const Event& event) override {
       selector_ = *show_modal_;
-      return ComponentBase::OnEvent(event);
+      return DispatchToChildren(event);
     }
 
     Component main_;
     Component modal_;
     const bool* show_modal_;
+    Ref<ModalOption> option_;
     int selector_ = *show_modal_;
+
+    Element frozen_;
+    Dimensions frozen_size_ = {0, 0};
+    int frozen_count_ = 0;
   };
-  return Make<Impl>(main, modal, show_modal);
+  return Make<Impl>(std::move(main), std::move(modal), show_modal,
+                    std::move(option));
 }
 
 // Decorate a component. Add a |modal| window on top of it. It is shown one on
 // the top of the other when |show_modal| is true.
 /// @ingroup component
 // NOLINTNEXTLINE
-ComponentDecorator Modal(Component modal, const bool* show_modal) {
-  return [modal, show_modal](Component main) {
-    return Modal(std::move(main), modal, show_modal);
+ComponentDecorator Modal(Component modal,
+                         const bool* show_modal,
+                         Ref<ModalOption> option) {
+  return [modal, show_modal, option](Component main) {
+    return Modal(std::move(main), modal, show_modal, option);
   };
 }
 
@@ -4,6 +4,7 @@
 
 #include "ftxui/component/component.hpp"       // for Renderer, Modal
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for ModalOption
 #include "ftxui/dom/node.hpp"                  // for Render
 #include "ftxui/screen/screen.hpp"             // for Screen
 
@@ -38,6 +39,44 @@ TEST(ModalTest, Basic) {
             "╰────────╯");
 }
 
+TEST(ModalTest, FreezeMain) {
+  int renders = 0;
+  auto main = Renderer([&] {
+    renders++;
+    return text("main") | border;
+  });
+  auto modal = Renderer([] { return text("modal") | border; });
+  bool show_modal = true;
+  ModalOption option;
+  option.freeze_main = true;
+  auto component = Modal(main, modal, &show_modal, &option);
+
+  for (int i = 0; i < 3; ++i) {
+    Screen screen(10, 7);
+    Render(screen, component->Render());
+    EXPECT_EQ(screen.ToString(),
+              "╭────────╮\r\n"
+              "│main    │\r\n"
+              "│╭─────╮ │\r\n"
+              "││modal│ │\r\n"
+              "│╰─────╯ │\r\n"
+              "│        │\r\n"
+              "╰────────╯");
+  }
+  EXPECT_EQ(renders, 1);
+
+  option.dim_main = true;
+  Screen screen(10, 7);
+  Render(screen, component->Render());
+  EXPECT_TRUE(screen.PixelAt(1, 1).dim);
+  EXPECT_FALSE(screen.PixelAt(2, 3).dim);
+  EXPECT_EQ(renders, 1);
+
+  show_modal = false;
+  (void)component->Render();
+  EXPECT_EQ(renders, 2);
+}
+
 }  // namespace ftxui
 
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
@@ -0,0 +1,80 @@
+#include "ftxui/component/observable.hpp"
+
+#include <memory>  // for make_shared
+
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+namespace {
+thread_local ObservableBase::ReadScope* g_read_scope = nullptr;  // NOLINT
+}  // namespace
+
+ObservableBase::ObservableBase() : version_(std::make_shared<size_t>(0)) {}
+
+// The readers still holding the version see a change.
+ObservableBase::~ObservableBase() {
+  (*version_)++;
+}
+
+ObservableBase::ReadScope::ReadScope() : previous_(g_read_scope) {
+  g_read_scope = this;
+}
+
+ObservableBase::ReadScope::~ReadScope() {
+  g_read_scope = previous_;
+  if (previous_) {
+    previous_->reads_.insert(previous_->reads_.end(), reads_.begin(),
+                             reads_.end());
+  }
+}
+
+// static
+void ObservableBase::ReadScope::Report(const Reads& reads) {
+  if (g_read_scope) {
+    g_read_scope->reads_.insert(g_read_scope->reads_.end(), reads.begin(),
+                                reads.end());
+  }
+}
+
+// static
+bool ObservableBase::Changed(const Reads& reads) {
+  for (const auto& [version, value] : reads) {
+    if (*version != value) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ObservableBase::Read() const {
+  if (!g_read_scope) {
+    return;
+  }
+  // Consecutive reads of the same observable are recorded once.
+  Reads& reads = g_read_scope->reads_;
+  if (reads.empty() || reads.back().first != version_) {
+    reads.emplace_back(version_, *version_);
+  }
+}
+
+void ObservableBase::Changed() {
+  (*version_)++;
+  if (ScreenInteractive* screen = ScreenInteractive::Active()) {
+    screen->RequestRedraw();
+  }
+}
+
+void ObservableBase::Accessed() {
+  if (g_read_scope) {
+    Read();
+  } else {
+    Changed();
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,156 @@
+#include "ftxui/component/observable.hpp"
+#include <gtest/gtest.h>
+#include <string>       // for string, to_string
+#include <string_view>  // for string_view
+
+#include "ftxui/component/component.hpp"  // for Memo, Renderer, Input, Container
+#include "ftxui/component/event.hpp"      // for Event
+#include "ftxui/dom/elements.hpp"         // for text, hbox
+#include "ftxui/dom/node.hpp"             // for Render
+#include "ftxui/screen/screen.hpp"        // for Screen
+#include "ftxui/util/ref.hpp"  // for ConstRef, Ref, StringRef, ConstStringRef
+
+namespace ftxui {
+
+TEST(ObservableTest, MemoRendersOnChange) {
+  Observable<int> left(0);
+  Observable<int> right(0);
+  int left_renders = 0;
+  int right_renders = 0;
+  auto component = Container::Horizontal({
+      Renderer([&] {
+        left_renders++;
+        return text(std::to_string(left.Get()));
+      }) | Memo(),
+      Renderer([&] {
+        right_renders++;
+        return text(std::to_string(right.Get()));
+      }) | Memo(),
+  });
+
+  Screen screen(2, 1);
+  auto draw = [&] {
+    const ObservableBase::ReadScope scope;
+    Render(screen, component->Render());
+  };
+  draw();
+  EXPECT_EQ(screen.ToString(), "00");
+  EXPECT_EQ(left_renders, 1);
+  EXPECT_EQ(right_renders, 1);
+
+  // Only the component reading |right| is rendered again.
+  right.Set(1);
+  draw();
+  EXPECT_EQ(screen.ToString(), "01");
+  EXPECT_EQ(left_renders, 1);
+  EXPECT_EQ(right_renders, 2);
+
+  draw();
+  EXPECT_EQ(left_renders, 1);
+  EXPECT_EQ(right_renders, 2);
+}
+
+TEST(ObservableTest, NestedMemo) {
+  Observable<std::string> value("a");
+  int outer_renders = 0;
+  auto inner = Renderer([&] { return text(value.Get()); }) | Memo();
+  auto outer = Renderer(inner, [&] {
+                 outer_renders++;
+                 return hbox({text(">"), inner->Render()});
+               }) |
+               Memo();
+
+  Screen screen(2, 1);
+  auto draw = [&] {
+    const ObservableBase::ReadScope scope;
+    Render(screen, outer->Render());
+  };
+  draw();
+  draw();
+  EXPECT_EQ(outer_renders, 1);
+
+  // The outer Memo depends on what the inner one read.
+  value.Set("b");
+  draw();
+  EXPECT_EQ(screen.ToString(), ">b");
+  EXPECT_EQ(outer_renders, 2);
+}
+
+TEST(ObservableTest, Ref) {
+  Observable<std::string> content("ab");
+  Observable<int> number(3);
+  StringRef string_ref(&content);
+  Ref<int> int_ref(&number);
+  ConstRef<int> const_ref(&number);
+  ConstStringRef const_string_ref(&content);
+
+  // Outside of the rendering, the accesses may write.
+  const size_t version = number.version();
+  *int_ref = 4;
+  EXPECT_EQ(number.Get(), 4);
+  EXPECT_NE(number.version(), version);
+
+  // While rendering, they are reads.
+  const ObservableBase::ReadScope scope;
+  const size_t content_version = content.version();
+  EXPECT_EQ(*string_ref, "ab");
+  EXPECT_EQ(*const_string_ref, "ab");
+  EXPECT_EQ(*const_ref, 4);
+  EXPECT_EQ(content.version(), content_version);
+  // The consecutive reads of |content| are recorded once.
+  EXPECT_EQ(scope.reads().size(), 2u);
+}
+
+TEST(ObservableTest, ConstStringRefVersion) {
+  Observable<std::string> content("ab");
+  const ConstStringRef observed(&content);
+  const size_t version = observed.version();
+  EXPECT_NE(version, 0u);
+  EXPECT_EQ(observed.identity(), &content);
+  content.Set("cd");
+  EXPECT_NE(observed.version(), version);
+
+  // A viewed string never changes, and its copies are identical.
+  const ConstStringRef viewed(std::string_view("label"));
+  const ConstStringRef copy = viewed;  // NOLINT
+  EXPECT_EQ(copy.identity(), viewed.identity());
+  EXPECT_EQ(copy.version(), viewed.version());
+  EXPECT_EQ(copy.view(), "label");
+  EXPECT_EQ(*copy, "label");
+
+  // The changes of a referenced std::string are unknown.
+  const std::string referenced = "ab";
+  EXPECT_EQ(ConstStringRef(&referenced).version(), 0u);
+}
+
+TEST(ObservableTest, Input) {
+  Observable<std::string> content;
+  int renders = 0;
+  auto input = Input(&content, "placeholder");
+  auto label = Renderer([&] {
+                 renders++;
+                 return text(content.Get());
+               }) |
+               Memo();
+  auto component = Container::Vertical({input, label});
+
+  Screen screen(11, 2);
+  auto draw = [&] {
+    const ObservableBase::ReadScope scope;
+    Render(screen, component->Render());
+  };
+  draw();
+  draw();
+  EXPECT_EQ(renders, 1);
+
+  component->OnEvent(Event::Character('x'));
+  draw();
+  EXPECT_EQ(content.Get(), "x");
+  EXPECT_EQ(renders, 2);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,210 @@
+#include "ftxui/component/output_sink.hpp"
+
+#include <cerrno>    // for errno, EAGAIN, EINTR, EWOULDBLOCK
+#include <iostream>  // for cout, flush
+#include <utility>   // for move, swap
+
+#if defined(__EMSCRIPTEN__)
+#include <emscripten.h>  // for MAIN_THREAD_EM_ASM_INT
+#endif
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <poll.h>    // for poll, pollfd, POLLOUT
+#include <unistd.h>  // for write, STDOUT_FILENO
+#endif
+
+namespace ftxui {
+
+namespace {
+
+#if defined(_WIN32)
+void WriteAll(std::string_view data) {
+  auto handle = GetStdHandle(STD_OUTPUT_HANDLE);
+  while (!data.empty()) {
+    DWORD written = 0;
+    if (!WriteFile(handle, data.data(), static_cast<DWORD>(data.size()),
+                   &written, nullptr)) {
+      return;
+    }
+    data.remove_prefix(written);
+  }
+}
+#elif !defined(__EMSCRIPTEN__)
+void WriteAll(int fd, std::string_view data) {
+  while (!data.empty()) {
+    const ssize_t written = write(fd, data.data(), data.size());
+    if (written >= 0) {
+      data.remove_prefix(static_cast<size_t>(written));
+      continue;
+    }
+
+    if (errno == EINTR) {
+      continue;
+    }
+
+    // The terminal is non-blocking and its buffer is full. Wait for it to be
+    // drained.
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {  // NOLINT
+      pollfd poll_fd = {fd, POLLOUT, 0};
+      poll(&poll_fd, 1, -1);
+      continue;
+    }
+
+    // Unrecoverable error, for instance the terminal has been closed.
+    return;
+  }
+}
+#endif
+
+}  // namespace
+
+// static
+OutputSink& OutputSink::Stdout() {
+  static OutputSink sink;
+  return sink;
+}
+
+#if !defined(_WIN32)
+OutputSink::OutputSink(int fd) : fd_(fd) {}
+#endif
+
+OutputSink::~OutputSink() {
+  StopWriterThread();
+}
+
+void OutputSink::Write(std::string_view data) {
+  buffer_ += data;
+}
+
+void OutputSink::WriteDeferred(Job job) {
+  jobs_.push_back({buffer_.size(), std::move(job)});
+}
+
+void OutputSink::Flush() {
+  // Something might have been written using std::cout. It must reach the
+  // terminal first.
+  std::cout << std::flush;
+
+  if (!writer_.joinable()) {
+    WriteNow(buffer_, jobs_);
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] { return !busy_; });
+  // Swapping the buffers reuses their capacity.
+  std::swap(buffer_, writing_);
+  std::swap(jobs_, writing_jobs_);
+  buffer_.clear();
+  jobs_.clear();
+  busy_ = true;
+  cv_.notify_all();
+}
+
+void OutputSink::StartWriterThread() {
+#if !defined(__EMSCRIPTEN__)
+  if (writer_.joinable()) {
+    return;
+  }
+  stop_ = false;
+  writer_ = std::thread(&OutputSink::WriterLoop, this);
+#endif
+}
+
+void OutputSink::StopWriterThread() {
+  if (!writer_.joinable()) {
+    return;
+  }
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  writer_.join();
+}
+
+bool OutputSink::Busy() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return busy_;
+}
+
+void OutputSink::WaitIdle() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] { return !busy_; });
+}
+
+// Write |data|, with the output of the |jobs| inserted, and clear both.
+void OutputSink::WriteNow(std::string& data, std::vector<DeferredJob>& jobs) {
+  if (jobs.empty()) {
+    WriteNow(data);
+    data.clear();
+    return;
+  }
+  assembled_.clear();
+  size_t offset = 0;
+  for (auto& job : jobs) {
+    assembled_.append(data, offset, job.offset - offset);
+    offset = job.offset;
+    job.job(job_output_);
+    assembled_ += job_output_;
+  }
+  assembled_.append(data, offset);
+  WriteNow(assembled_);
+  data.clear();
+  jobs.clear();
+}
+
+void OutputSink::WriteNow(std::string_view data) {
+#if defined(__EMSCRIPTEN__)
+  // The page receives the whole frame at once, as a Uint8Array, when it
+  // defines Module.ftxui_on_output.
+  const int handled = MAIN_THREAD_EM_ASM_INT(
+      {
+        if (!Module.ftxui_on_output) {
+          return 0;
+        }
+        Module.ftxui_on_output(HEAPU8.slice($0, $0 + $1));
+        return 1;
+      },
+      data.data(), data.size());
+  if (!handled) {
+    // Emscripten doesn't implement flush. We interpret zero as flush.
+    std::cout << data << '\0' << std::flush;
+  }
+#elif defined(_WIN32)
+  WriteAll(data);
+#else
+  WriteAll(fd_, data);
+#endif
+}
+
+void OutputSink::WriterLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this] { return busy_ || stop_; });
+
+    // The pending output is written before stopping.
+    if (busy_) {
+      lock.unlock();
+      WriteNow(writing_, writing_jobs_);
+      lock.lock();
+      busy_ = false;
+      cv_.notify_all();
+      continue;
+    }
+
+    return;
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
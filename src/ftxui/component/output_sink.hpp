@@ -0,0 +1,95 @@
+#ifndef FTXUI_COMPONENT_OUTPUT_SINK_HPP
+#define FTXUI_COMPONENT_OUTPUT_SINK_HPP
+
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <functional>          // for function
+#include <mutex>               // for mutex
+#include <string>              // for string
+#include <string_view>         // for string_view
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+namespace ftxui {
+
+// Accumulate the output sent toward the terminal, and write it with as few
+// system calls as possible. Write() only appends to a buffer. Flush() sends the
+// whole buffer using a single write(2) on POSIX, WriteFile on Windows. Partial
+// writes and non-blocking terminals are handled.
+//
+// Optionally, the writes can happen on a dedicated thread. Flush() then hands
+// the buffer over to the writer thread and returns immediately, unless the
+// previous buffer is still being written.
+//
+// The output can also be produced by a job, deferred until the buffer is
+// written: on the writer thread when there is one. This moves the encoding of a
+// frame off the thread calling Flush().
+class OutputSink {
+ public:
+  // The sink writing to the standard output.
+  static OutputSink& Stdout();
+
+#if !defined(_WIN32)
+  explicit OutputSink(int fd);
+#endif
+
+  ~OutputSink();
+  OutputSink(const OutputSink&) = delete;
+  OutputSink(OutputSink&&) = delete;
+  OutputSink& operator=(const OutputSink&) = delete;
+  OutputSink& operator=(OutputSink&&) = delete;
+
+  void Write(std::string_view data);
+  void Flush();
+
+  // Insert the output of |job| at this point of the buffer. The job replaces
+  // the content of the string it receives, whose capacity is reused. It runs
+  // when the buffer is written, possibly from the writer thread. Until Busy()
+  // returns false, the data it uses must not be modified.
+  using Job = std::function<void(std::string& out)>;
+  void WriteDeferred(Job job);
+
+  // Start/Stop writing from a dedicated thread. Stopping waits for the pending
+  // output to be written.
+  void StartWriterThread();
+  void StopWriterThread();
+
+  // Whether the writer thread is still writing a previously flushed buffer.
+  bool Busy();
+  // Wait until the writer thread has written the previously flushed buffer.
+  void WaitIdle();
+
+ private:
+  OutputSink() = default;
+  struct DeferredJob {
+    size_t offset = 0;  // Where its output is inserted in the buffer.
+    Job job;
+  };
+  void WriteNow(std::string& data, std::vector<DeferredJob>& jobs);
+  void WriteNow(std::string_view data);
+  void WriterLoop();
+
+#if !defined(_WIN32)
+  int fd_ = 1;  // STDOUT_FILENO
+#endif
+  std::string buffer_;
+  std::vector<DeferredJob> jobs_;
+
+  std::thread writer_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::string writing_;  // Guarded by |mutex_|.
+  std::vector<DeferredJob> writing_jobs_;  // Guarded by |mutex_|.
+  std::string assembled_;  // The buffer, with the output of its jobs.
+  std::string job_output_;
+  bool busy_ = false;    // Guarded by |mutex_|.
+  bool stop_ = false;    // Guarded by |mutex_|.
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_OUTPUT_SINK_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>   // for fcntl, F_GETFL, F_SETFL, O_NONBLOCK
+#include <unistd.h>  // for pipe, read, close
+#endif
+
+#include <array>   // for array
+#include <atomic>  // for atomic
+#include <chrono>  // for milliseconds
+#include <string>  // for string
+#include <thread>  // for thread, sleep_for
+
+#include "ftxui/component/output_sink.hpp"
+
+namespace ftxui {
+
+#if !defined(_WIN32)
+
+TEST(OutputSinkTest, WriteOnFlush) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+
+  OutputSink sink(fds[1]);
+  sink.Write("Hello ");
+  sink.Write("World");
+  close(fds[1]);  // Nothing has been written yet.
+  std::array<char, 16> buffer;
+  EXPECT_EQ(read(fds[0], buffer.data(), buffer.size()), 0);
+  close(fds[0]);
+
+  ASSERT_EQ(pipe(fds.data()), 0);
+  OutputSink other(fds[1]);
+  other.Write("Hello ");
+  other.Write("World");
+  other.Flush();
+  close(fds[1]);
+  const auto size = read(fds[0], buffer.data(), buffer.size());
+  EXPECT_EQ(std::string(buffer.data(), size), "Hello World");
+  close(fds[0]);
+}
+
+// The pipe is smaller than the data. The write must be completed across
+// several partial writes, waiting for the reader on EAGAIN.
+TEST(OutputSinkTest, NonBlockingPartialWrites) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+  fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL) | O_NONBLOCK);  // NOLINT
+
+  std::string data;
+  for (int i = 0; i < 1 << 20; ++i) {  // NOLINT
+    data += char('a' + i % 26);       // NOLINT
+  }
+
+  std::string received;
+  std::thread reader([&] {
+    std::array<char, 4096> buffer;  // NOLINT
+    while (true) {
+      const auto size = read(fds[0], buffer.data(), buffer.size());
+      if (size <= 0) {
+        break;
+      }
+      received.append(buffer.data(), size);
+    }
+  });
+
+  OutputSink sink(fds[1]);
+  sink.Write(data);
+  sink.Flush();
+  close(fds[1]);
+  reader.join();
+  close(fds[0]);
+
+  EXPECT_EQ(received, data);
+}
+
+TEST(OutputSinkTest, WriterThread) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+
+  std::string received;
+  std::thread reader([&] {
+    std::array<char, 4096> buffer;  // NOLINT
+    while (true) {
+      const auto size = read(fds[0], buffer.data(), buffer.size());
+      if (size <= 0) {
+        break;
+      }
+      received.append(buffer.data(), size);
+    }
+  });
+
+  OutputSink sink(fds[1]);
+  sink.StartWriterThread();
+  sink.Write("frame 1;");
+  sink.Flush();
+  sink.Write("frame 2;");
+  sink.Flush();
+  sink.StopWriterThread();
+  EXPECT_FALSE(sink.Busy());
+  close(fds[1]);
+  reader.join();
+  close(fds[0]);
+
+  EXPECT_EQ(received, "frame 1;frame 2;");
+}
+
+TEST(OutputSinkTest, WriteDeferred) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+
+  std::string received;
+  std::thread reader([&] {
+    std::array<char, 4096> buffer;  // NOLINT
+    while (true) {
+      const auto size = read(fds[0], buffer.data(), buffer.size());
+      if (size <= 0) {
+        break;
+      }
+      received.append(buffer.data(), size);
+    }
+  });
+
+  OutputSink sink(fds[1]);
+  std::thread::id job_thread;
+  sink.StartWriterThread();
+  sink.Write("[");
+  sink.WriteDeferred([&](std::string& out) {
+    job_thread = std::this_thread::get_id();
+    out = "frame 1";
+  });
+  sink.Write("]");
+  sink.Flush();
+  sink.StopWriterThread();
+  EXPECT_NE(job_thread, std::this_thread::get_id());
+
+  // Without a writer thread, the jobs run on Flush().
+  sink.WriteDeferred([](std::string& out) { out = "frame 2"; });
+  sink.Write(";");
+  sink.Flush();
+  close(fds[1]);
+  reader.join();
+  close(fds[0]);
+
+  EXPECT_EQ(received, "[frame 1]frame 2;");
+}
+
+// The data used by the jobs can be read once the writer thread is idle.
+TEST(OutputSinkTest, WaitIdle) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+
+  OutputSink sink(fds[1]);
+  std::atomic<bool> done = false;
+  sink.StartWriterThread();
+  sink.WriteDeferred([&](std::string& out) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));  // NOLINT
+    out = "frame";
+    done = true;
+  });
+  sink.Flush();
+  sink.WaitIdle();
+  EXPECT_TRUE(done);
+  EXPECT_FALSE(sink.Busy());
+  sink.StopWriterThread();
+  close(fds[1]);
+
+  std::array<char, 16> buffer;
+  const auto size = read(fds[0], buffer.data(), buffer.size());
+  EXPECT_EQ(std::string(buffer.data(), size), "frame");
+  close(fds[0]);
+}
+
+#endif
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,3 +1,4 @@
+#include <algorithm>   // for min, max
 #include <functional>  // for function
 #include <memory>      // for allocator_traits<>::value_type
 #include <utility>     // for move
@@ -10,7 +11,7 @@
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return, Event::Tab, Event::TabReverse
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp, Mouse::Left, Mouse::Released
 #include "ftxui/component/screen_interactive.hpp"  // for Component
-#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, vbox, Elements, focus, nothing, select
+#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, vbox, Elements, focus, nothing, select, virtualList
 #include "ftxui/screen/box.hpp"   // for Box
 #include "ftxui/screen/util.hpp"  // for clamp
 #include "ftxui/util/ref.hpp"     // for Ref, ConstStringListRef
@@ -31,31 +32,57 @@ class RadioboxBase : public ComponentBase {
  private:
   Element Render() override {
     Clamp();
-    Elements elements;
+
+    // The boxes of the entries drawn by the previous frame. They are reflected
+    // again only if still drawn.
+    for (int i = drawn_first_; i <= std::min(drawn_last_, size() - 1); ++i) {
+      boxes_[i] = Box{0, -1, 0, -1};
+    }
+    drawn_first_ = size();
+    drawn_last_ = -1;
+
     const bool is_menu_focused = Focused();
+    if (option_->virtualized) {
+      return virtualList(
+                 size(), 1,
+                 [this, is_menu_focused](int i) {
+                   return RenderEntry(i, is_menu_focused);
+                 },
+                 hovered_) |
+             reflect(box_);
+    }
+
+    Elements elements;
     for (int i = 0; i < size(); ++i) {
-      const bool is_focused = (focused_entry() == i) && is_menu_focused;
-      const bool is_selected = (hovered_ == i);
-      auto focus_management = !is_selected      ? nothing
-                              : is_menu_focused ? focus
-                                                : select;
-      auto state = EntryState{
-          entries_[i],
-          *selected_ == i,
-          is_selected,
-          is_focused,
-      };
-      auto element =
-          (option_->transform ? option_->transform
-                              : RadioboxOption::Simple().transform)(state);
-
-      elements.push_back(element | focus_management | reflect(boxes_[i]));
+      elements.push_back(RenderEntry(i, is_menu_focused));
     }
     return vbox(std::move(elements)) | reflect(box_);
   }
 
+  Element RenderEntry(int i, bool is_menu_focused) {
+    drawn_first_ = std::min(drawn_first_, i);
+    drawn_last_ = std::max(drawn_last_, i);
+
+    const bool is_focused = (focused_entry() == i) && is_menu_focused;
+    const bool is_selected = (hovered_ == i);
+    auto focus_management = !is_selected      ? nothing
+                            : is_menu_focused ? focus
+                                              : select;
+    auto state = EntryState{
+        entries_[i],
+        *selected_ == i,
+        is_selected,
+        is_focused,
+    };
+    auto element =
+        (option_->transform ? option_->transform
+                            : RadioboxOption::Simple().transform)(state);
+
+    return element | focus_management | reflect(boxes_[i]);
+  }
+
   // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-  bool OnEvent(Event event) override {
+  bool HandleEvent(const Event& event) override {
     Clamp();
     if (!CaptureMouse(event)) {
       return false;
@@ -110,19 +137,22 @@ class RadioboxBase : public ComponentBase {
     return false;
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (event.mouse().button == Mouse::WheelDown ||
         event.mouse().button == Mouse::WheelUp) {
       return OnMouseWheel(event);
     }
 
-    for (int i = 0; i < size(); ++i) {
+    for (int i = drawn_first_; i <= std::min(drawn_last_, size() - 1); ++i) {
       if (!boxes_[i].Contain(event.mouse().x, event.mouse().y)) {
         continue;
       }
 
       TakeFocus();
-      focused_entry() = i;
+      if (focused_entry() != i) {
+        focused_entry() = i;
+        Invalidate();
+      }
       if (event.mouse().button == Mouse::Left &&
           event.mouse().motion == Mouse::Released) {
         if (*selected_ != i) {
@@ -175,6 +205,9 @@ class RadioboxBase : public ComponentBase {
   int hovered_ = *selected_;
   std::vector<Box> boxes_;
   Box box_;
+  // The range of entries drawn by the last frame.
+  int drawn_first_ = 0;
+  int drawn_last_ = -1;
   Ref<RadioboxOption> option_;
 };
 
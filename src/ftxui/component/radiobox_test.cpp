@@ -1,5 +1,5 @@
 #include <gtest/gtest.h>  // for AssertionResult, Message, TestPartResult, EXPECT_EQ, EXPECT_TRUE, Test, TestInfo (ptr only), EXPECT_FALSE, TEST
-#include <ftxui/dom/elements.hpp>   // for yframe
+#include <ftxui/dom/elements.hpp>   // for yframe, frame, text
 #include <ftxui/dom/node.hpp>       // for Render
 #include <ftxui/screen/screen.hpp>  // for Screen
 #include <memory>  // for __shared_ptr_access, shared_ptr, allocator
@@ -10,6 +10,7 @@
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
 #include "ftxui/component/component_options.hpp"  // for RadioboxOption
 #include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowDown, Event::End, Event::Home, Event::Tab, Event::TabReverse, Event::PageDown, Event::PageUp, Event::ArrowUp
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Released
 #include "ftxui/util/ref.hpp"         // for Ref
 
 namespace ftxui {
@@ -302,6 +303,31 @@ TEST(RadioboxTest, RemoveEntries) {
   EXPECT_EQ(focused_entry, 1);
 }
 
+TEST(RadioboxTest, Virtualized) {
+  int selected = 50000;
+  std::vector<std::string> entries;
+  for (int i = 0; i < 100000; ++i) {
+    entries.push_back(std::to_string(i));
+  }
+  int transformed = 0;
+  RadioboxOption option;
+  option.virtualized = true;
+  option.transform = [&](const EntryState& state) {
+    transformed++;
+    return text((state.state ? "*" : " ") + state.label);
+  };
+  auto radiobox = Radiobox(&entries, &selected, option);
+
+  Screen screen(6, 3);
+  Render(screen, radiobox->Render() | frame);
+  EXPECT_EQ(screen.ToString(), " 49999\r\n*50000\r\n 50001");
+  EXPECT_EQ(transformed, 4);
+
+  EXPECT_TRUE(radiobox->OnEvent(Event::Mouse(
+      "", Mouse{Mouse::Left, Mouse::Released, false, false, false, 1, 0})));
+  EXPECT_EQ(selected, 49999);
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
+#include <memory>   // for unique_ptr, make_unique
 #include <thread>   // for thread
 #include <utility>  // for move
+#include <vector>   // for vector
 
 #include "ftxui/component/receiver.hpp"
 
@@ -73,6 +75,70 @@ TEST(Receiver, BasicWithThread) {
   t23.join();
 }
 
+TEST(Receiver, ManyProducers) {
+  auto receiver = MakeReceiver<int>();
+  const int producers = 4;
+  const int count = 10000;
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back(
+        [p](Sender<int> sender) {
+          for (int i = 0; i < count; ++i) {
+            sender->Send(p * count + i);
+          }
+        },
+        receiver->MakeSender());
+  }
+
+  // Every value is received once, in the order of its producer.
+  std::vector<int> last(producers, -1);
+  int received = 0;
+  int value = 0;
+  while (receiver->Receive(&value)) {
+    EXPECT_GT(value % count, last[value / count]);
+    last[value / count] = value % count;
+    received++;
+  }
+  EXPECT_EQ(received, producers * count);
+  EXPECT_TRUE(receiver->HasQuitted());
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST(Receiver, SendAll) {
+  auto receiver = MakeReceiver<int>();
+  auto sender = receiver->MakeSender();
+  std::vector<int> values = {1, 2, 3};
+  sender->SendAll(values);
+  EXPECT_TRUE(values.empty());
+  sender->SendAll(values);
+  sender->Send(4);
+
+  std::vector<int> received;
+  EXPECT_TRUE(receiver->ReceiveAll(&received));
+  EXPECT_EQ(received, std::vector<int>({1, 2, 3, 4}));
+  EXPECT_FALSE(receiver->ReceiveAll(&received));
+}
+
+TEST(Receiver, MoveOnly) {
+  auto receiver = MakeReceiver<std::unique_ptr<int>>();
+  auto sender = receiver->MakeSender();
+  sender->Send(std::make_unique<int>(1));
+  sender->Send(std::make_unique<int>(2));
+  EXPECT_TRUE(receiver->HasPending());
+
+  std::unique_ptr<int> value;
+  EXPECT_TRUE(receiver->ReceiveNonBlocking(&value));
+  EXPECT_EQ(*value, 1);
+  EXPECT_FALSE(receiver->HasQuitted());
+
+  // The pending one is released with the receiver.
+  sender.reset();
+  EXPECT_FALSE(receiver->HasQuitted());
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -6,32 +6,58 @@
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed, Mouse::Released
-#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, separator, size, EQUAL, xflex, yflex, hbox, vbox, HEIGHT, WIDTH
+#include "ftxui/dom/elements.hpp"  // for operator|, reflect, Element, separator, size, EQUAL, xflex, yflex, hbox, vbox, HEIGHT, WIDTH, retained
 #include "ftxui/screen/box.hpp"    // for Box
 
 namespace ftxui {
 namespace {
 
+// While the separator is dragged, a pane is drawn using the Element rendered
+// when the drag started: only its size changes, so its component isn't
+// rendered again, and its layout is cached by retained() until its size
+// changes. The pane is rendered normally again once the separator is released.
+class Pane {
+ public:
+  explicit Pane(Component component) : component_(std::move(component)) {}
+
+  Element Render(bool dragging) {
+    if (!dragging) {
+      element_ = nullptr;
+      return component_->Render();
+    }
+    if (!element_) {
+      element_ = retained(component_->Render());
+    }
+    return element_;
+  }
+
+ private:
+  Component component_;
+  Element element_;
+};
+
 class ResizableSplitLeftBase : public ComponentBase {
  public:
   ResizableSplitLeftBase(Component main, Component child, int* main_size)
       : main_(std::move(main)),
         child_(std::move(child)),
-        main_size_(main_size) {
+        main_size_(main_size),
+        main_pane_(main_),
+        child_pane_(child_) {
     Add(Container::Horizontal({
         main_,
         child_,
     }));
   }
 
-  bool OnEvent(Event event) final {
+  bool HandleEvent(const Event& event) final {
     if (event.is_mouse()) {
-      return OnMouseEvent(std::move(event));
+      return OnMouseEvent(event);
     }
-    return ComponentBase::OnEvent(std::move(event));
+    return DispatchToChildren(event);
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (captured_mouse_ && event.mouse().motion == Mouse::Released) {
       captured_mouse_.reset();
       return true;
@@ -50,14 +76,15 @@ class ResizableSplitLeftBase : public ComponentBase {
       return true;
     }
 
-    return ComponentBase::OnEvent(event);
+    return DispatchToChildren(event);
   }
 
   Element Render() final {
+    const bool dragging = captured_mouse_ != nullptr;
     return hbox({
-               main_->Render() | size(WIDTH, EQUAL, *main_size_),
+               main_pane_.Render(dragging) | size(WIDTH, EQUAL, *main_size_),
                separator() | reflect(separator_box_),
-               child_->Render() | xflex,
+               child_pane_.Render(dragging) | xflex,
            }) |
            reflect(box_);
   };
@@ -66,6 +93,8 @@ class ResizableSplitLeftBase : public ComponentBase {
   Component main_;
   Component child_;
   int* const main_size_;
+  Pane main_pane_;
+  Pane child_pane_;
   CapturedMouse captured_mouse_;
   Box separator_box_;
   Box box_;
@@ -76,21 +105,23 @@ class ResizableSplitRightBase : public ComponentBase {
   ResizableSplitRightBase(Component main, Component child, int* main_size)
       : main_(std::move(main)),
         child_(std::move(child)),
-        main_size_(main_size) {
+        main_size_(main_size),
+        main_pane_(main_),
+        child_pane_(child_) {
     Add(Container::Horizontal({
         child_,
         main_,
     }));
   }
 
-  bool OnEvent(Event event) final {
+  bool HandleEvent(const Event& event) final {
     if (event.is_mouse()) {
-      return OnMouseEvent(std::move(event));
+      return OnMouseEvent(event);
     }
-    return ComponentBase::OnEvent(std::move(event));
+    return DispatchToChildren(event);
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (captured_mouse_ && event.mouse().motion == Mouse::Released) {
       captured_mouse_.reset();
       return true;
@@ -109,14 +140,15 @@ class ResizableSplitRightBase : public ComponentBase {
       return true;
     }
 
-    return ComponentBase::OnEvent(event);
+    return DispatchToChildren(event);
   }
 
   Element Render() final {
+    const bool dragging = captured_mouse_ != nullptr;
     return hbox({
-               child_->Render() | xflex,
+               child_pane_.Render(dragging) | xflex,
                separator() | reflect(separator_box_),
-               main_->Render() | size(WIDTH, EQUAL, *main_size_),
+               main_pane_.Render(dragging) | size(WIDTH, EQUAL, *main_size_),
            }) |
            reflect(box_);
   };
@@ -125,6 +157,8 @@ class ResizableSplitRightBase : public ComponentBase {
   Component main_;
   Component child_;
   int* const main_size_;
+  Pane main_pane_;
+  Pane child_pane_;
   CapturedMouse captured_mouse_;
   Box separator_box_;
   Box box_;
@@ -135,21 +169,23 @@ class ResizableSplitTopBase : public ComponentBase {
   ResizableSplitTopBase(Component main, Component child, int* main_size)
       : main_(std::move(main)),
         child_(std::move(child)),
-        main_size_(main_size) {
+        main_size_(main_size),
+        main_pane_(main_),
+        child_pane_(child_) {
     Add(Container::Vertical({
         main_,
         child_,
     }));
   }
 
-  bool OnEvent(Event event) final {
+  bool HandleEvent(const Event& event) final {
     if (event.is_mouse()) {
-      return OnMouseEvent(std::move(event));
+      return OnMouseEvent(event);
     }
-    return ComponentBase::OnEvent(std::move(event));
+    return DispatchToChildren(event);
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (captured_mouse_ && event.mouse().motion == Mouse::Released) {
       captured_mouse_.reset();
       return true;
@@ -168,14 +204,15 @@ class ResizableSplitTopBase : public ComponentBase {
       return true;
     }
 
-    return ComponentBase::OnEvent(event);
+    return DispatchToChildren(event);
   }
 
   Element Render() final {
+    const bool dragging = captured_mouse_ != nullptr;
     return vbox({
-               main_->Render() | size(HEIGHT, EQUAL, *main_size_),
+               main_pane_.Render(dragging) | size(HEIGHT, EQUAL, *main_size_),
                separator() | reflect(separator_box_),
-               child_->Render() | yflex,
+               child_pane_.Render(dragging) | yflex,
            }) |
            reflect(box_);
   };
@@ -184,6 +221,8 @@ class ResizableSplitTopBase : public ComponentBase {
   Component main_;
   Component child_;
   int* const main_size_;
+  Pane main_pane_;
+  Pane child_pane_;
   CapturedMouse captured_mouse_;
   Box separator_box_;
   Box box_;
@@ -194,21 +233,23 @@ class ResizableSplitBottomBase : public ComponentBase {
   ResizableSplitBottomBase(Component main, Component child, int* main_size)
       : main_(std::move(main)),
         child_(std::move(child)),
-        main_size_(main_size) {
+        main_size_(main_size),
+        main_pane_(main_),
+        child_pane_(child_) {
     Add(Container::Vertical({
         child_,
         main_,
     }));
   }
 
-  bool OnEvent(Event event) final {
+  bool HandleEvent(const Event& event) final {
     if (event.is_mouse()) {
-      return OnMouseEvent(std::move(event));
+      return OnMouseEvent(event);
     }
-    return ComponentBase::OnEvent(std::move(event));
+    return DispatchToChildren(event);
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (captured_mouse_ && event.mouse().motion == Mouse::Released) {
       captured_mouse_.reset();
       return true;
@@ -227,14 +268,15 @@ class ResizableSplitBottomBase : public ComponentBase {
       return true;
     }
 
-    return ComponentBase::OnEvent(event);
+    return DispatchToChildren(event);
   }
 
   Element Render() final {
+    const bool dragging = captured_mouse_ != nullptr;
     return vbox({
-               child_->Render() | yflex,
+               child_pane_.Render(dragging) | yflex,
                separator() | reflect(separator_box_),
-               main_->Render() | size(HEIGHT, EQUAL, *main_size_),
+               main_pane_.Render(dragging) | size(HEIGHT, EQUAL, *main_size_),
            }) |
            reflect(box_);
   };
@@ -243,6 +285,8 @@ class ResizableSplitBottomBase : public ComponentBase {
   Component main_;
   Component child_;
   int* const main_size_;
+  Pane main_pane_;
+  Pane child_pane_;
   CapturedMouse captured_mouse_;
   Box separator_box_;
   Box box_;
@@ -101,6 +101,43 @@ TEST(ResizableSplit, BasicBottom) {
   EXPECT_EQ(position, 9);
 }
 
+TEST(ResizableSplit, DragReusesThePanes) {
+  int position = 3;
+  int main_renders = 0;
+  int child_renders = 0;
+  auto main = Renderer([&] {
+    main_renders++;
+    return text("main");
+  });
+  auto child = Renderer([&] {
+    child_renders++;
+    return text("child");
+  });
+  auto component = ResizableSplitLeft(main, child, &position);
+  auto screen = Screen(20, 1);
+  Render(screen, component->Render());
+  EXPECT_EQ(main_renders, 1);
+
+  EXPECT_TRUE(component->OnEvent(MousePressed(3, 0)));
+  Render(screen, component->Render());
+  EXPECT_TRUE(component->OnEvent(MousePressed(5, 0)));
+  Render(screen, component->Render());
+  EXPECT_TRUE(component->OnEvent(MousePressed(6, 0)));
+  screen = Screen(20, 1);
+  Render(screen, component->Render());
+  EXPECT_EQ(main_renders, 2);
+  EXPECT_EQ(child_renders, 2);
+  EXPECT_EQ(screen.ToString(), "main  │child        ");
+
+  // Rendered again once released.
+  EXPECT_TRUE(component->OnEvent(MouseReleased(6, 0)));
+  screen = Screen(20, 1);
+  Render(screen, component->Render());
+  EXPECT_EQ(main_renders, 3);
+  EXPECT_EQ(child_renders, 3);
+  EXPECT_EQ(screen.ToString(), "main  │child        ");
+}
+
 }  // namespace ftxui
 
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
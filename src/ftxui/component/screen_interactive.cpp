@@ -1,14 +1,20 @@
-#include <algorithm>  // for copy, max, min
+#include <algorithm>  // for copy, max, min, stable_sort
 #include <array>      // for array
+#include <cctype>     // for tolower
 #include <chrono>  // for operator-, milliseconds, operator>=, duration, common_type<>::type, time_point
 #include <csignal>  // for signal, SIGTSTP, SIGABRT, SIGWINCH, raise, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM, __sighandler_t, size_t
 #include <cstdio>   // for fileno, stdin
-#include <ftxui/component/task.hpp>  // for Task, Closure, AnimationTask
+#include <fstream>  // for ofstream
+#include <ftxui/component/task.hpp>  // for Task, Closure, InlineClosure, AnimationTask
 #include <ftxui/screen/screen.hpp>  // for Pixel, Screen::Cursor, Screen, Screen::Cursor::Hidden
 #include <functional>        // for function
 #include <initializer_list>  // for initializer_list
-#include <iostream>  // for cout, ostream, operator<<, basic_ostream, endl, flush
+#include <iterator>          // for make_move_iterator
+#include <memory>            // for make_unique, unique_ptr
+#include <mutex>             // for lock_guard, unique_lock
+#include <optional>          // for optional
 #include <stack>     // for stack
+#include <string_view>  // for string_view
 #include <thread>    // for thread, sleep_for
 #include <tuple>     // for _Swallow_assign, ignore
 #include <type_traits>  // for decay_t
@@ -16,18 +22,29 @@
 #include <variant>      // for visit, variant
 #include <vector>       // for vector
 
-#include "ftxui/component/animation.hpp"  // for TimePoint, Clock, Duration, Params, RequestAnimationFrame
+#include "ftxui/component/animation.hpp"  // for TimePoint, Clock, Duration, Params, RequestAnimationFrame, Scheduler
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse, CapturedMouseInterface
 #include "ftxui/component/component_base.hpp"  // for ComponentBase
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/component/loop.hpp"            // for Loop
+#include "ftxui/component/mouse.hpp"           // for Mouse
+#include "ftxui/component/observable.hpp"  // for ObservableBase
+#include "ftxui/component/frame_broadcast.hpp"  // for FrameBroadcast
+#include "ftxui/component/output_sink.hpp"     // for OutputSink
 #include "ftxui/component/receiver.hpp"  // for ReceiverImpl, Sender, MakeReceiver, SenderImpl, Receiver
 #include "ftxui/component/screen_interactive.hpp"
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/component/worker_pool.hpp"  // for WorkerPool
+#include "ftxui/dom/elements.hpp"     // for Element, vbox
+#include "ftxui/dom/hit_index.hpp"    // for HitIndex, HitIndex::Scope
+#include "ftxui/dom/layout_pool.hpp"  // for LayoutPool, LayoutPool::Scope
 #include "ftxui/dom/node.hpp"                         // for Node, Render
+#include "ftxui/dom/profiler.hpp"  // for Profiler, Profiler::Scope
 #include "ftxui/dom/requirement.hpp"                  // for Requirement
-#include "ftxui/screen/string.hpp"
-#include "ftxui/screen/terminal.hpp"                  // for Size, Dimensions
+#include "ftxui/screen/cursor_motion.hpp"  // for CursorMotion, CursorPosition
+#include "ftxui/screen/string.hpp"         // for Glyphs, GlyphView
+#include "ftxui/screen/terminal.hpp"       // for CachedSize, RepeatSupport
+#include "ftxui/screen/util.hpp"           // for HeapSize
 
 #if defined(_WIN32)
 #define DEFINE_CONSOLEV2_PROPERTIES
@@ -40,9 +57,10 @@
 #error Must be compiled in UNICODE mode
 #endif
 #else
-#include <sys/select.h>  // for select, FD_ISSET, FD_SET, FD_ZERO, fd_set, timeval
+#include <fcntl.h>    // for fcntl, F_SETFL, O_NONBLOCK
+#include <poll.h>     // for poll, pollfd, POLLIN
 #include <termios.h>  // for tcsetattr, termios, tcgetattr, TCSANOW, cc_t, ECHO, ICANON, VMIN, VTIME
-#include <unistd.h>  // for STDIN_FILENO, read
+#include <unistd.h>   // for STDIN_FILENO, read, write, pipe, close
 #endif
 
 // Quick exit is missing in standard CLang headers
@@ -59,87 +77,397 @@ void RequestAnimationFrame() {
     screen->RequestAnimationFrame();
   }
 }
+
+void RequestAnimationFrameAt(TimePoint time) {
+  auto* screen = ScreenInteractive::Active();
+  if (screen) {
+    screen->RequestAnimationFrameAt(time);
+  }
+}
+
+TimePoint Now() {
+  auto* screen = ScreenInteractive::Active();
+  return screen ? ScreenInteractive::Private::Now(*screen) : Clock::now();
+}
+
+// static
+std::shared_ptr<Scheduler> Scheduler::Current() {
+  auto* screen = ScreenInteractive::Active();
+  return screen ? ScreenInteractive::Private::GetScheduler(*screen)
+                : DefaultPointer();
+}
+
+bool Scheduler::Driven() const {
+  auto* screen = ScreenInteractive::Active();
+  return screen &&
+         ScreenInteractive::Private::GetScheduler(*screen).get() == this;
+}
+
+void Scheduler::RequestFrame() {
+  auto* screen = ScreenInteractive::Active();
+  if (!screen) {
+    return;
+  }
+  // The animators of another scheduler are stepped by their components.
+  if (Driven()) {
+    ScreenInteractive::Private::ScheduleAnimationFrame(*screen);
+  } else {
+    screen->RequestAnimationFrame();
+  }
+}
 }  // namespace animation
 
 namespace {
 
 ScreenInteractive* g_active_screen = nullptr;  // NOLINT
 
+// The Session() screen used by the current thread, and its output. It replaces
+// the active screen, and the terminal.
+thread_local ScreenInteractive* g_session_screen = nullptr;  // NOLINT
+thread_local std::string* g_session_output = nullptr;        // NOLINT
+
+// The number of bytes written toward the terminal. Measured by Replay().
+thread_local size_t g_output_bytes = 0;  // NOLINT
+
+// The output of the active Headless() screen, replacing the terminal.
+std::string* g_headless_output = nullptr;  // NOLINT
+
+// Classifies the output of the frame being drawn, when the statistics are kept.
+thread_local OutputBreakdown* g_output_breakdown = nullptr;  // NOLINT
+
+// Every output toward the terminal is accumulated, and written with a single
+// system call on Flush().
+void Write(std::string_view data) {
+  g_output_bytes += data.size();
+  if (g_output_breakdown) {
+    g_output_breakdown->Add(data);
+  }
+  if (g_session_output) {
+    g_session_output->append(data);
+    return;
+  }
+  if (g_headless_output) {
+    g_headless_output->append(data);
+    return;
+  }
+  OutputSink::Stdout().Write(data);
+}
+
+// Write the output of |job|, produced when the output is flushed. On the
+// terminal, this happens on the writer thread, when there is one.
+void WriteDeferred(OutputSink::Job job) {
+  if (g_session_output || g_headless_output) {
+    std::string out;
+    job(out);
+    Write(out);
+    return;
+  }
+  OutputSink::Stdout().WriteDeferred(std::move(job));
+}
+
 void Flush() {
-  // Emscripten doesn't implement flush. We interpret zero as flush.
-  std::cout << '\0' << std::flush;
+  if (g_session_output || g_headless_output) {
+    return;
+  }
+  OutputSink::Stdout().Flush();
+}
+
+// Use the Session() |screen| on the current thread, for the lifetime of the
+// scope. Does nothing for the other screens.
+class SessionScope {
+ public:
+  SessionScope(ScreenInteractive* screen, bool session, std::string* output)
+      : screen_(g_session_screen), output_(g_session_output) {
+    if (session) {
+      g_session_screen = screen;
+      g_session_output = output;
+    }
+  }
+  ~SessionScope() {
+    g_session_screen = screen_;
+    g_session_output = output_;
+  }
+  SessionScope(const SessionScope&) = delete;
+  SessionScope(SessionScope&&) = delete;
+  SessionScope& operator=(const SessionScope&) = delete;
+  SessionScope& operator=(SessionScope&&) = delete;
+
+ private:
+  ScreenInteractive* screen_;
+  std::string* output_;
+};
+
+// Measure the steps of a frame, when the statistics are kept, or traced.
+class StepTimer {
+ public:
+  using Clock = std::chrono::steady_clock;
+  StepTimer(bool stats, Tracer* tracer)
+      : enabled_(stats || tracer), tracer_(tracer) {
+    if (enabled_) {
+      start_ = Clock::now();
+    }
+  }
+
+  bool enabled() const { return enabled_; }
+
+  // Add the time elapsed since the previous step to |total|, and trace it as
+  // |name|.
+  void Lap(std::chrono::nanoseconds& total, const char* name) {
+    if (enabled_) {
+      const Clock::time_point now = Clock::now();
+      total += now - start_;
+      if (tracer_) {
+        tracer_->Span(Tracer::Thread::Loop, name, start_, now);
+      }
+      start_ = now;
+    }
+  }
+
+  // Split the time elapsed since the previous step into the steps of
+  // Render(), measured by |timings|.
+  void Lap(const RenderTimings& timings,
+           ScreenInteractive::FrameStats& stats) {
+    if (!enabled_) {
+      return;
+    }
+    Clock::time_point begin = start_;
+    for (const auto& [time, total, name] : {
+             std::tuple(timings.layout, &stats.layout, "Layout"),
+             std::tuple(timings.draw, &stats.draw, "Draw"),
+             std::tuple(timings.shaders, &stats.shaders, "Shaders"),
+         }) {
+      *total += time;
+      if (tracer_) {
+        tracer_->Span(Tracer::Thread::Loop, name, begin, begin + time);
+      }
+      begin += time;
+    }
+    start_ = Clock::now();
+  }
+
+  // Start the next step now, without counting the time elapsed.
+  void Skip() {
+    if (enabled_) {
+      start_ = Clock::now();
+    }
+  }
+
+ private:
+  bool enabled_;
+  Tracer* tracer_;
+  Clock::time_point start_;
+};
+
+const char* TaskName(const Task& task) {
+  if (std::holds_alternative<Event>(task)) {
+    return "Event";
+  }
+  if (std::holds_alternative<AnimationTask>(task)) {
+    return "AnimationTask";
+  }
+  return "Closure";
 }
 
 constexpr int timeout_milliseconds = 20;
-constexpr int timeout_microseconds = timeout_milliseconds * 1000;
+// The size of the buffer the terminal input is read into. Large enough for a
+// paste, or for a burst of mouse reports, to be read with a single syscall.
+constexpr size_t input_buffer_size = 64 * 1024;
 #if defined(_WIN32)
 
-void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
+// Translate a console mouse record into the mouse events the terminal would
+// have reported. |buttons| is the state of the buttons of the previous record.
+void SendMouseRecord(const MOUSE_EVENT_RECORD& record,
+                     const SMALL_RECT& window,
+                     DWORD* buttons,
+                     SenderImpl<Task>* out) {
+  Mouse mouse;
+  const DWORD keys = record.dwControlKeyState;
+  mouse.shift = bool(keys & SHIFT_PRESSED);
+  mouse.meta = bool(keys & (LEFT_ALT_PRESSED | RIGHT_ALT_PRESSED));
+  mouse.control = bool(keys & (LEFT_CTRL_PRESSED | RIGHT_CTRL_PRESSED));
+  // The terminal reports 1-based coordinates, relative to its window.
+  mouse.x = record.dwMousePosition.X - window.Left + 1;
+  mouse.y = record.dwMousePosition.Y - window.Top + 1;
+  mouse.motion = Mouse::Pressed;
+
+  if (record.dwEventFlags & MOUSE_WHEELED) {
+    const auto delta = static_cast<SHORT>(HIWORD(record.dwButtonState));
+    mouse.button = delta > 0 ? Mouse::WheelUp : Mouse::WheelDown;
+    out->Send(Event::Mouse("", mouse));
+    return;
+  }
+
+  const std::array<std::pair<DWORD, Mouse::Button>, 3> mapping = {{
+      {FROM_LEFT_1ST_BUTTON_PRESSED, Mouse::Left},
+      {FROM_LEFT_2ND_BUTTON_PRESSED, Mouse::Middle},
+      {RIGHTMOST_BUTTON_PRESSED, Mouse::Right},
+  }};
+  const DWORD changed = record.dwButtonState ^ *buttons;
+  *buttons = record.dwButtonState;
+  bool sent = false;
+  for (const auto& [mask, button] : mapping) {
+    if (changed & mask) {
+      mouse.button = button;
+      mouse.motion =
+          (record.dwButtonState & mask) ? Mouse::Pressed : Mouse::Released;
+      out->Send(Event::Mouse("", mouse));
+      sent = true;
+    }
+  }
+  if (sent) {
+    return;
+  }
+
+  // A movement, dragging the first button held, if any.
+  mouse.button = Mouse::None;
+  for (const auto& [mask, button] : mapping) {
+    if (record.dwButtonState & mask) {
+      mouse.button = button;
+      break;
+    }
+  }
+  out->Send(Event::Mouse("", mouse));
+}
+
+// Read the console input. The thread sleeps until there is some input, or
+// until ExitNow() sets the |exit_event|. It only wakes up periodically while an
+// uncompleted sequence, like a lone escape, waits for its timeout.
+void EventListener(std::atomic<bool>* quit,
+                   Sender<Task> out,
+                   int /*wakeup*/,
+                   ScreenInteractive* screen) {
   auto console = GetStdHandle(STD_INPUT_HANDLE);
+  const std::array<HANDLE, 2> handles = {
+      console,
+      static_cast<HANDLE>(ScreenInteractive::Private::ExitEvent(*screen)),
+  };
   auto parser = TerminalInputParser(out->Clone());
+
+  // Reused from one read to the next. The characters of consecutive key
+  // records are converted, and parsed, at once.
+  std::vector<INPUT_RECORD> records(input_buffer_size / sizeof(INPUT_RECORD));
+  std::wstring characters;
+  std::vector<char> buffer;
+  auto flush_characters = [&] {
+    if (characters.empty()) {
+      return;
+    }
+    // A UTF-16 unit takes at most 3 bytes in UTF-8.
+    buffer.resize(characters.size() * 3);
+    const size_t size = to_string(characters, buffer);
+    parser.Add(std::string_view(buffer.data(), size));
+    characters.clear();
+  };
+  DWORD buttons = 0;
+
   while (!*quit) {
-    // Throttle ReadConsoleInput by waiting 250ms, this wait function will
-    // return if there is input in the console.
-    auto wait_result = WaitForSingleObject(console, timeout_milliseconds);
+    // Without an exit event, ExitNow() is noticed by polling.
+    const DWORD timeout = parser.HasPending() || !handles[1]
+                              ? DWORD(timeout_milliseconds)
+                              : INFINITE;
+    const DWORD wait_result = WaitForMultipleObjects(
+        DWORD(handles[1] ? 2 : 1), handles.data(), FALSE, timeout);
     if (wait_result == WAIT_TIMEOUT) {
-      parser.Timeout(timeout_milliseconds);
+      if (parser.HasPending()) {
+        parser.Timeout(timeout_milliseconds);
+      }
       continue;
     }
-
-    DWORD number_of_events = 0;
-    if (!GetNumberOfConsoleInputEvents(console, &number_of_events))
-      continue;
-    if (number_of_events <= 0)
+    if (wait_result != WAIT_OBJECT_0) {
+      // Woken up by ExitNow(), or failed.
       continue;
+    }
 
-    std::vector<INPUT_RECORD> records{number_of_events};
+    const auto start = Tracer::Clock::now();
     DWORD number_of_events_read = 0;
-    ReadConsoleInput(console, records.data(), (DWORD)records.size(),
-                     &number_of_events_read);
-    records.resize(number_of_events_read);
+    if (!ReadConsoleInputW(console, records.data(), DWORD(records.size()),
+                           &number_of_events_read)) {
+      continue;
+    }
+
+    SMALL_RECT window = {0, 0, 0, 0};
+    for (DWORD i = 0; i < number_of_events_read; ++i) {
+      const INPUT_RECORD& r = records[i];
+      if (r.EventType == KEY_EVENT) {
+        const auto& key_event = r.Event.KeyEvent;
+        // Ignore the key releases, and the keys without characters, like
+        // shift. The other keys are received as VT sequences.
+        if (key_event.bKeyDown == FALSE || key_event.uChar.UnicodeChar == 0) {
+          continue;
+        }
+        characters.append(std::max<WORD>(key_event.wRepeatCount, 1),
+                          key_event.uChar.UnicodeChar);
+        continue;
+      }
 
-    for (const auto& r : records) {
+      flush_characters();
       switch (r.EventType) {
-        case KEY_EVENT: {
-          auto key_event = r.Event.KeyEvent;
-          // ignore UP key events
-          if (key_event.bKeyDown == FALSE)
-            continue;
-          std::wstring wstring;
-          wstring += key_event.uChar.UnicodeChar;
-          for(auto it : to_string(wstring)) {
-            parser.Add(it);
-          }
-        } break;
         case WINDOW_BUFFER_SIZE_EVENT:
+          Terminal::InvalidateSize();
           out->Send(Event::Special({0}));
           break;
+        case MOUSE_EVENT: {
+          if (window.Right == 0) {
+            CONSOLE_SCREEN_BUFFER_INFO info;
+            if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE),
+                                           &info)) {
+              window = info.srWindow;
+            }
+          }
+          SendMouseRecord(r.Event.MouseEvent, window, &buttons, out.get());
+        } break;
         case MENU_EVENT:
         case FOCUS_EVENT:
-        case MOUSE_EVENT:
-          // TODO(mauve): Implement later.
           break;
       }
     }
+    flush_characters();
+
+    if (Tracer* tracer = ScreenInteractive::Private::GetTracer(*screen)) {
+      tracer->Span(Tracer::Thread::EventListener, "Read", start,
+                   Tracer::Clock::now());
+    }
   }
 }
 
 #elif defined(__EMSCRIPTEN__)
 #include <emscripten.h>
 
-// Read char from the terminal.
-void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
-  (void)timeout_microseconds;
-  auto parser = TerminalInputParser(std::move(out));
+// The page pushes the input with ftxui_on_input(), from the browser thread. It
+// is parsed there, and the events are sent to the active screen.
+std::mutex g_input_mutex;                             // NOLINT
+std::unique_ptr<TerminalInputParser> g_input_parser;  // NOLINT
 
-  char c;
-  while (!*quit) {
-    while (read(STDIN_FILENO, &c, 1), c)
-      parser.Add(c);
+// Whether TimeoutInput() is scheduled. Guarded by |g_input_mutex|.
+bool g_input_timeout_scheduled = false;  // NOLINT
+
+// An uncompleted sequence, like a lone escape, times out.
+void TimeoutInput(void* /*unused*/) {
+  const std::lock_guard<std::mutex> lock(g_input_mutex);
+  g_input_timeout_scheduled = false;
+  if (!g_input_parser || !g_input_parser->HasPending()) {
+    return;
+  }
+  g_input_parser->Timeout(timeout_milliseconds);
+  if (g_input_parser->HasPending()) {
+    g_input_timeout_scheduled = true;
+    emscripten_async_call(&TimeoutInput, nullptr, timeout_milliseconds);
+  }
+}
 
-    emscripten_sleep(1);
-    parser.Timeout(1);
+// Nothing reads the terminal: the parser is installed for ftxui_on_input(),
+// and the thread sleeps until ExitNow().
+void EventListener(std::atomic<bool>* quit,
+                   Sender<Task> out,
+                   int /*wakeup*/,
+                   ScreenInteractive* /*screen*/) {
+  {
+    const std::lock_guard<std::mutex> lock(g_input_mutex);
+    g_input_parser = std::make_unique<TerminalInputParser>(std::move(out));
   }
+  quit->wait(false);
+  const std::lock_guard<std::mutex> lock(g_input_mutex);
+  g_input_parser.reset();
 }
 
 extern "C" {
@@ -151,34 +479,76 @@ void ftxui_on_resize(int columns, int rows) {
   });
   std::raise(SIGWINCH);
 }
+
+// Called by the page, with the bytes typed into the terminal. |data| is only
+// read during the call.
+EMSCRIPTEN_KEEPALIVE
+void ftxui_on_input(const char* data, int size) {
+  const std::lock_guard<std::mutex> lock(g_input_mutex);
+  if (!g_input_parser || size <= 0) {
+    return;
+  }
+  g_input_parser->Add(std::string_view(data, size_t(size)));
+  if (g_input_parser->HasPending() && !g_input_timeout_scheduled) {
+    g_input_timeout_scheduled = true;
+    emscripten_async_call(&TimeoutInput, nullptr, timeout_milliseconds);
+  }
+}
 }
 
 #else  // POSIX (Linux & Mac)
 
-int CheckStdinReady(int usec_timeout) {
-  timeval tv = {0, usec_timeout};
-  fd_set fds;
-  FD_ZERO(&fds);                                          // NOLINT
-  FD_SET(STDIN_FILENO, &fds);                             // NOLINT
-  select(STDIN_FILENO + 1, &fds, nullptr, nullptr, &tv);  // NOLINT
-  return FD_ISSET(STDIN_FILENO, &fds);                    // NOLINT
-}
-
-// Read char from the terminal.
-void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
+// Read char from the terminal. The thread sleeps until there is some input, or
+// until ExitNow() or a signal writes into the |wakeup| pipe. It only wakes up
+// periodically while an uncompleted sequence, like a lone escape, waits for its
+// timeout.
+void EventListener(std::atomic<bool>* quit,
+                   Sender<Task> out,
+                   int wakeup,
+                   ScreenInteractive* screen) {
+  Sender<Task> signal_sender = out->Clone();
   auto parser = TerminalInputParser(std::move(out));
+  // The parser doesn't keep references to the buffer, it is reused.
+  std::vector<char> buffer(input_buffer_size);
 
   while (!*quit) {
-    if (!CheckStdinReady(timeout_microseconds)) {
+    std::array<pollfd, 2> fds = {{
+        {STDIN_FILENO, POLLIN, 0},
+        {wakeup, POLLIN, 0},
+    }};
+    const int timeout = parser.HasPending() ? timeout_milliseconds : -1;
+    const int ready = poll(fds.data(), fds.size(), timeout);
+    if (ready < 0) {
+      // Interrupted by a signal, like SIGWINCH.
+      continue;
+    }
+    if (ready == 0) {
       parser.Timeout(timeout_milliseconds);
       continue;
     }
+    if (fds[1].revents != 0) {
+      char c = 0;
+      std::ignore = read(wakeup, &c, 1);
+      // Woken up by a signal: let the loop handle it.
+      if (!*quit) {
+        signal_sender->Send(Closure([] {}));
+      }
+      continue;
+    }
+    if (fds[0].revents == 0) {
+      continue;
+    }
 
-    const size_t buffer_size = 100;
-    std::array<char, buffer_size> buffer;                     // NOLINT;
-    int l = read(fileno(stdin), buffer.data(), buffer_size);  // NOLINT
-    for (int i = 0; i < l; ++i) {
-      parser.Add(buffer[i]);  // NOLINT
+    const auto start = Tracer::Clock::now();
+    const ssize_t l = read(fileno(stdin), buffer.data(), buffer.size());
+    if (l > 0) {
+      ScreenInteractive::Private::RecordRead(
+          *screen, std::string_view(buffer.data(), size_t(l)));
+      parser.Add(std::string_view(buffer.data(), size_t(l)));
+      if (Tracer* tracer = ScreenInteractive::Private::GetTracer(*screen)) {
+        tracer->Span(Tracer::Thread::EventListener, "Read", start,
+                     Tracer::Clock::now());
+      }
     }
   }
 }
@@ -196,7 +566,23 @@ std::atomic<int> g_signal_exit_count = 0;  // NOLINT
 #if !defined(_WIN32)
 std::atomic<int> g_signal_stop_count = 0;    // NOLINT
 std::atomic<int> g_signal_resize_count = 0;  // NOLINT
+// The pipe waking up the input listener of the active screen, so that the loop
+// handles the signals without waiting for an event.
+std::atomic<int> g_wakeup_fd = -1;  // NOLINT
+#endif
+
+// Whether the frames are written to a terminal, rather than to a pipe or a
+// file. See NonInteractiveOutput().
+bool StdoutIsTerminal() {
+#if defined(_WIN32)
+  DWORD mode = 0;
+  return GetConsoleMode(GetStdHandle(STD_OUTPUT_HANDLE), &mode) != 0;
+#elif defined(__EMSCRIPTEN__)
+  return true;
+#else
+  return isatty(STDOUT_FILENO) != 0;
 #endif
+}
 
 // Async signal safe function
 void RecordSignal(int signal) {
@@ -216,6 +602,7 @@ void RecordSignal(int signal) {
       break;
 
     case SIGWINCH:
+      Terminal::InvalidateSize();
       g_signal_resize_count++;
       break;
 #endif
@@ -223,6 +610,14 @@ void RecordSignal(int signal) {
     default:
       break;
   }
+
+#if !defined(_WIN32)
+  const int wakeup = g_wakeup_fd;
+  if (wakeup >= 0) {
+    const char c = 0;
+    std::ignore = write(wakeup, &c, 1);
+  }
+#endif
 }
 
 void ExecuteSignalHandlers() {
@@ -269,6 +664,14 @@ enum class DECMode {
   kMouseUrxvtMode = 1015,
   kMouseSgrPixelsMode = 1016,
   kAlternateScreen = 1049,
+  kBracketedPaste = 2004,
+  kSynchronizedUpdate = 2026,
+};
+
+// The prefixes of the XTVERSION replies of the terminals supporting REP and the
+// 24 bits colors.
+const std::array<std::string_view, 6> kModernTerminals = {
+    "xterm", "kitty", "wezterm", "foot", "contour", "ghostty",
 };
 
 // Device Status Report (DSR) {
@@ -299,11 +702,89 @@ std::string Reset(const std::vector<DECMode>& parameters) {
   return CSI + "?" + Serialize(parameters) + "l";
 }
 
+// DEC Private Mode Request (DECRQM). The terminal answers with DECRPM.
+std::string RequestMode(DECMode ps) {
+  return CSI + "?" + std::to_string(int(ps)) + "$p";
+}
+
 // Device Status Report (DSR)
 std::string DeviceStatusReport(DSRMode ps) {
   return CSI + std::to_string(int(ps)) + "n";
 }
 
+// The prefix "\x1b[<code" of a mouse movement reported in the SGR mode, or an
+// empty string for any other event. The code holds the button, the modifiers,
+// and the motion flag (32).
+std::string_view MouseMovePrefix(const Event& event) {
+  if (!event.is_mouse()) {
+    return {};
+  }
+  std::string_view input = event.input();
+  const std::string_view sgr = "\x1b[<";
+  if (input.substr(0, sgr.size()) != sgr) {
+    return {};
+  }
+  input = input.substr(0, input.find(';'));
+  int code = 0;
+  for (const char c : input.substr(sgr.size())) {
+    code = code * 10 + (c - '0');  // NOLINT
+  }
+  if ((code & 32) == 0) {  // NOLINT
+    return {};
+  }
+  return input;
+}
+
+// The events |text| would produce if typed instead of pasted: a character per
+// glyph, and a Return per line break. The other control characters are
+// dropped.
+std::vector<Event> TypedEvents(std::string_view text) {
+  std::vector<Event> events;
+  while (!text.empty()) {
+    const size_t end = text.find('\n');
+    for (const GlyphView& glyph : Glyphs(text.substr(0, end))) {
+      events.push_back(Event::Character(std::string(glyph.text)));
+    }
+    if (end == std::string_view::npos) {
+      break;
+    }
+    events.push_back(Event::Return);
+    text.remove_prefix(end + 1);
+  }
+  return events;
+}
+
+// Whether |a| is superseded by |b|, the event following it.
+bool IsSuperseded(const Event& a, const Event& b) {
+  if (a == Event::Special({0})) {
+    return b == Event::Special({0});
+  }
+  const std::string_view prefix = MouseMovePrefix(a);
+  return !prefix.empty() && prefix == MouseMovePrefix(b) &&
+         a.input().back() == b.input().back();
+}
+
+// Remove the resizes and the mouse movements immediately followed by the same
+// kind of event. Dragging with the same button is a movement.
+void CoalesceTasks(std::vector<Task>* tasks) {
+  auto out = tasks->begin();
+  for (auto it = tasks->begin(); it != tasks->end(); ++it) {
+    const auto next = it + 1;
+    if (next != tasks->end()) {
+      const auto* event = std::get_if<Event>(&*it);
+      const auto* next_event = std::get_if<Event>(&*next);
+      if (event && next_event && IsSuperseded(*event, *next_event)) {
+        continue;
+      }
+    }
+    if (out != it) {
+      *out = std::move(*it);
+    }
+    ++out;
+  }
+  tasks->erase(out, tasks->end());
+}
+
 class CapturedMouseImpl : public CapturedMouseInterface {
  public:
   explicit CapturedMouseImpl(std::function<void(void)> callback)
@@ -318,24 +799,22 @@ class CapturedMouseImpl : public CapturedMouseInterface {
   std::function<void(void)> callback_;
 };
 
-void AnimationListener(std::atomic<bool>* quit, Sender<Task> out) {
-  // Animation at around 60fps.
-  const auto time_delta = std::chrono::milliseconds(15);
-  while (!*quit) {
-    out->Send(AnimationTask());
-    std::this_thread::sleep_for(time_delta);
-  }
-}
-
 }  // namespace
 
 ScreenInteractive::ScreenInteractive(int dimx,
                                      int dimy,
                                      Dimension dimension,
-                                     bool use_alternative_screen)
+                                     bool use_alternative_screen,
+                                     bool headless,
+                                     bool session)
     : Screen(dimx, dimy),
       dimension_(dimension),
-      use_alternative_screen_(use_alternative_screen) {
+      fixed_dimx_(dimx),
+      fixed_dimy_(dimy),
+      use_alternative_screen_(use_alternative_screen),
+      headless_(headless),
+      session_(session),
+      host_event_loop_(session) {
   task_receiver_ = MakeReceiver<Task>();
 }
 
@@ -359,6 +838,57 @@ ScreenInteractive ScreenInteractive::Fullscreen() {
   };
 }
 
+/// @brief A screen of a fixed size, not connected to the terminal. The
+/// terminal isn't configured, no signal handler is installed, and no thread is
+/// started. The input is given using FeedInput(), the time advances using
+/// AdvanceTime(), and the output is read using TakeOutput().
+///
+/// This lets the whole loop run, for instance to benchmark or to fuzz a
+/// component, without a terminal.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Headless(80, 24);
+/// Loop loop(&screen, component);
+/// screen.FeedInput("\x1b[B");
+/// screen.AdvanceTime(std::chrono::milliseconds(16));
+/// loop.RunOnce();
+/// std::string frame = screen.TakeOutput();
+/// ```
+// static
+ScreenInteractive ScreenInteractive::Headless(int dimx, int dimy) {
+  return {
+      dimx,
+      dimy,
+      Dimension::Fixed,
+      false,
+      true,
+  };
+}
+
+/// @brief A screen of a fixed size, for a remote terminal, like one connected
+/// through SSH. It is not connected to the terminal of the process: it
+/// installs no signal handler, and starts no thread. Its input is given using
+/// FeedInput(), and its output is read using TakeOutput(). Otherwise, it is
+/// driven like with HostEventLoop(), using TaskFd(), Tick() and NextTick().
+///
+/// Nothing global is used: several sessions can run on different threads.
+/// While a session handles its tasks, it is the Active() screen of the thread.
+///
+/// Usually, the sessions are served by a SessionServer.
+/// @param dimx The width of the remote terminal.
+/// @param dimy The height of the remote terminal.
+/// @see SessionServer
+// static
+ScreenInteractive ScreenInteractive::Session(int dimx, int dimy) {
+  return {
+      dimx, dimy, Dimension::Fixed, true, /*headless=*/false, /*session=*/true,
+  };
+}
+
+ScreenInteractive::~ScreenInteractive() = default;
+
 // static
 ScreenInteractive ScreenInteractive::TerminalOutput() {
   return {
@@ -387,83 +917,1068 @@ void ScreenInteractive::Post(Task task) {
   }
 
   task_sender_->Send(std::move(task));
+  NotifyTaskFd();
 }
 
-void ScreenInteractive::PostEvent(Event event) {
-  Post(event);
+/// @brief Post several tasks at once. They are moved out of |tasks|, and
+/// received by the loop together, after a single wake up.
+/// Can be called from any thread.
+void ScreenInteractive::PostBatch(std::span<Task> tasks) {
+  if (!task_sender_) {
+    return;
+  }
+
+  task_sender_->SendAll(tasks);
+  NotifyTaskFd();
 }
 
-void ScreenInteractive::RequestAnimationFrame() {
-  if (animation_requested_) {
-    return;
+/// @brief Run |work| on the pool of worker threads of the screen, then |done|
+/// by the loop. The pool is started by the first call, with up to 4 threads.
+/// The |done| closures of the jobs returning together are posted as a single
+/// task, and run in the order the jobs returned.
+/// @param work the job. Must not refer to the components.
+/// @param done run by the loop, after |work|. Optional.
+void ScreenInteractive::RunAsync(Closure work, Closure done) {
+#if defined(__EMSCRIPTEN__)
+  // No threads.
+  work();
+  if (done) {
+    Post(std::move(done));
   }
-  animation_requested_ = true;
-  auto now = animation::Clock::now();
-  const auto time_histeresis = std::chrono::milliseconds(33);
-  if (now - previous_animation_time_ >= time_histeresis) {
-    previous_animation_time_ = now;
+#else
+  if (!worker_pool_) {
+    const int threads = static_cast<int>(std::thread::hardware_concurrency());
+    worker_pool_ = std::make_unique<WorkerPool>(std::clamp(threads - 1, 1, 4));
   }
+  worker_pool_->Submit(
+      [this, work = std::move(work), done = std::move(done)]() mutable {
+        work();
+        if (!done) {
+          return;
+        }
+        bool first = false;
+        {
+          const std::lock_guard<std::mutex> lock(completions_mutex_);
+          first = completions_.empty();
+          completions_.push_back(std::move(done));
+        }
+        // The next completions join this one, until the loop runs it.
+        if (first) {
+          Post([this] { RunCompletions(); });
+        }
+      });
+#endif
 }
 
-CapturedMouse ScreenInteractive::CaptureMouse() {
-  if (mouse_captured) {
-    return nullptr;
+void ScreenInteractive::RunCompletions() {
+  std::vector<Closure> completions;
+  {
+    const std::lock_guard<std::mutex> lock(completions_mutex_);
+    completions.swap(completions_);
+  }
+  for (auto& done : completions) {
+    done();
   }
-  mouse_captured = true;
-  return std::make_unique<CapturedMouseImpl>(
-      [this] { mouse_captured = false; });
 }
 
-void ScreenInteractive::Loop(Component component) {  // NOLINT
-  class Loop loop(this, std::move(component));
-  loop.Run();
+/// @brief Change the size of a FixedSize(), Headless() or Session() screen,
+/// like after the remote terminal was resized. The next frame is drawn at the
+/// new size. Call it from the loop, or using Post().
+/// @param dimx The new width.
+/// @param dimy The new height.
+void ScreenInteractive::SetDimensions(int dimx, int dimy) {
+  if (dimension_ != Dimension::Fixed) {
+    return;
+  }
+  fixed_dimx_ = dimx;
+  fixed_dimy_ = dimy;
+  frame_valid_ = false;
+  DebounceResize();
 }
 
-bool ScreenInteractive::HasQuitted() {
-  return task_receiver_->HasQuitted();
+/// @brief Print |element| once, above the frame, into the terminal history.
+/// It is printed with the next frame, which is drawn entirely below it. The
+/// element isn't rendered again: the caller removes it from the components,
+/// and only the frame, the live part, is redrawn.
+///
+/// With TerminalOutput(), this keeps the frame small, instead of growing with
+/// the history, walked over by every frame. Like the `<Static>` of Ink.
+///
+/// The fullscreen dimension, using the alternative screen, has no history. The
+/// element is dropped, as it is with FrameProtocol().
+///
+/// Call it from the loop, like from an event handler.
+/// @param element The content to print. It is as wide as the frame.
+void ScreenInteractive::PrintStatic(Element element) {
+  static_elements_.push_back(std::move(element));
+  frame_valid_ = false;
 }
 
-void ScreenInteractive::PreMain() {
-  // Suspend previously active screen:
-  if (g_active_screen) {
-    std::swap(suspended_screen_, g_active_screen);
-    // Reset cursor position to the top of the screen and clear the screen.
-    suspended_screen_->ResetCursorPosition();
-    std::cout << suspended_screen_->ResetPosition(/*clear=*/true);
-    suspended_screen_->dimx_ = 0;
-    suspended_screen_->dimy_ = 0;
+/// @brief Run |update| by the loop, and draw a new frame. The updates posted
+/// with the same |key| until then are coalesced: only the last one runs, at
+/// the position of the first one. The updates are run together, as a single
+/// task, so that a burst of them costs a single frame.
+/// @param key identifies the state updated, like its address.
+/// @param update modifies the state. Run by the loop.
+///
+/// Can be called from any thread.
+///
+/// ### Example
+///
+/// ```cpp
+/// // From the thread receiving the quotes.
+/// screen->UpdateState(&prices[symbol], [&prices, symbol, price] {
+///   prices[symbol] = price;
+/// });
+/// ```
+void ScreenInteractive::UpdateState(const void* key, Closure update) {
+  bool first = false;
+  {
+    const std::lock_guard<std::mutex> lock(state_updates_mutex_);
+    first = state_updates_.empty();
+    auto [it, inserted] =
+        state_update_keys_.try_emplace(key, state_updates_.size());
+    if (inserted) {
+      state_updates_.push_back(std::move(update));
+    } else {
+      state_updates_[it->second] = std::move(update);
+    }
+  }
+  if (first) {
+    Post([this] { RunStateUpdates(); });
+  }
+}
 
-    // Reset dimensions to force drawing the screen again next time:
-    suspended_screen_->Uninstall();
+void ScreenInteractive::RunStateUpdates() {
+  std::vector<Closure> updates;
+  {
+    const std::lock_guard<std::mutex> lock(state_updates_mutex_);
+    updates.swap(state_updates_);
+    state_update_keys_.clear();
   }
+  for (auto& update : updates) {
+    update();
+  }
+  frame_valid_ = false;
+}
 
-  // This screen is now active:
-  g_active_screen = this;
-  g_active_screen->Install();
+// Make TaskFd() readable, unless it already is.
+void ScreenInteractive::NotifyTaskFd() {
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  if (!host_event_loop_ || task_fd_notified_.exchange(true)) {
+    return;
+  }
+  const int fd = wakeup_[1];
+  if (fd >= 0) {
+    const char c = 0;
+    std::ignore = write(fd, &c, 1);
+  }
+#endif
+}
 
-  previous_animation_time_ = animation::Clock::now();
+// Consume what made TaskFd() readable. The tasks posted from now on notify it
+// again.
+void ScreenInteractive::DrainTaskFd() {
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  if (!host_event_loop_ || wakeup_[0] < 0) {
+    return;
+  }
+  task_fd_notified_ = false;
+  std::array<char, 64> buffer;  // NOLINT
+  while (read(wakeup_[0], buffer.data(), buffer.size()) > 0) {
+  }
+#endif
 }
 
-void ScreenInteractive::PostMain() {
-  // Put cursor position at the end of the drawing.
-  ResetCursorPosition();
+void ScreenInteractive::PostEvent(Event event) {
+  Post(event);
+}
 
-  g_active_screen = nullptr;
+void ScreenInteractive::RequestAnimationFrame() {
+  if (animation_requested_) {
+    return;
+  }
+  animation_requested_ = true;
+  ScheduleAnimationFrame();
+}
+
+/// @brief Draw a new frame at |time|, without the animation frames in between.
+/// This is for the content depending on the time only, like a spinner: the
+/// loop sleeps until its next change. The earliest request wins.
+/// @param time When to draw the frame.
+void ScreenInteractive::RequestAnimationFrameAt(animation::TimePoint time) {
+  if (time >= animation_frame_at_) {
+    return;
+  }
+  animation_frame_at_ = time;
+  WakeUpAt(time);
+}
+
+// Send an AnimationTask at the next frame boundary, for the components having
+// requested it, or for the running animators.
+void ScreenInteractive::ScheduleAnimationFrame() {
+  if (animation_scheduled_) {
+    return;
+  }
+  animation_scheduled_ = true;
+  auto now = Now();
+  const auto time_histeresis = std::chrono::milliseconds(33);
+  if (now - previous_animation_time_ >= time_histeresis) {
+    previous_animation_time_ = now;
+  }
+
+  WakeUpLater(animation_slowdown_);
+}
+
+/// @brief Draw a new frame. The events handled by the components and the
+/// Event::Custom invalidate the frame already. This is for the changes made
+/// elsewhere, like by a closure passed to Post(), or by another thread.
+void ScreenInteractive::RequestRedraw() {
+  if (redraw_requested_.exchange(true)) {
+    return;
+  }
+  Post([this] {
+    redraw_requested_ = false;
+    frame_valid_ = false;
+  });
+}
+
+// The clock of the screen. Virtual for the Headless() screens.
+animation::TimePoint ScreenInteractive::Now() const {
+  return headless_ ? headless_now_ : animation::Clock::now();
+}
+
+// Ask the animation listener for a task at the next frame boundary, so that
+// the loop wakes up and draws the frame if it is still invalid. The boundaries
+// are every |periods| animation periods.
+void ScreenInteractive::WakeUpLater(int periods) {
+  animation::TimePoint next;
+  {
+    const std::lock_guard<std::mutex> lock(animation_mutex_);
+    const auto now = Now().time_since_epoch();
+    const auto period = animation_period_ * periods;
+    next = animation::TimePoint((now / period + 1) * period);
+  }
+  WakeUpAt(next);
+}
+
+// Ask the animation listener for a task at |time|, or earlier when it was
+// already armed for an earlier time.
+void ScreenInteractive::WakeUpAt(animation::TimePoint time) {
+  {
+    const std::lock_guard<std::mutex> lock(animation_mutex_);
+    if (!animation_armed_ || time < animation_deadline_) {
+      animation_deadline_ = time;
+    }
+    animation_armed_ = true;
+  }
+  animation_wake_.notify_one();
+}
+
+/// @brief Set the rate of the animation frames, while a component requests
+/// them.
+/// @param fps the number of frames per second.
+void ScreenInteractive::AnimationFrameRate(int fps) {
+  const std::lock_guard<std::mutex> lock(animation_mutex_);
+  using Duration = animation::Clock::duration;
+  animation_period_ = Duration(std::chrono::seconds(1)) / std::max(1, fps);
+}
+
+/// @brief Keep the loop responsive when the frames are too slow, rather than
+/// the animations smooth. While the recent frames take longer than |budget| to
+/// draw, the animation frames are spaced by 2 or 4 animation periods. Above 4
+/// times the budget, the animations jump to their end. The animations get
+/// their full rate back once the frames are fast enough.
+/// @param budget The time a frame may take. 0 disables the governor.
+void ScreenInteractive::FrameBudget(std::chrono::microseconds budget) {
+  frame_budget_ = budget;
+  UpdateAnimationQuality(frame_time_);
+}
+
+// Called after every frame, with the time it took to draw.
+void ScreenInteractive::UpdateAnimationQuality(
+    animation::Clock::duration frame_time) {
+  // Exponential moving average, over about 4 frames.
+  frame_time_ += (frame_time - frame_time_) / 4;
+  if (frame_budget_.count() == 0 || frame_time_ <= frame_budget_) {
+    animation_slowdown_ = 1;
+    animation_snap_ = false;
+  } else if (frame_time_ <= 2 * frame_budget_) {
+    animation_slowdown_ = 2;
+    animation_snap_ = false;
+  } else {
+    animation_slowdown_ = 4;
+    animation_snap_ = frame_time_ > 4 * frame_budget_;
+  }
+}
+
+// Send an AnimationTask at |animation_deadline_|, once WakeUpAt() armed the
+// timer. Nothing is sent while no component animates and no frame is delayed.
+void ScreenInteractive::AnimationListener(Sender<Task> out) {
+  std::unique_lock<std::mutex> lock(animation_mutex_);
+  while (true) {
+    animation_wake_.wait(lock, [&] { return quit_ || animation_armed_; });
+
+    // The deadline can be moved earlier while waiting.
+    while (!quit_ && animation::Clock::now() < animation_deadline_) {
+      animation_wake_.wait_until(lock, animation_deadline_);
+    }
+    if (quit_) {
+      return;
+    }
+
+    animation_armed_ = false;
+    lock.unlock();
+    if (Tracer* tracer = tracer_) {
+      tracer->Instant(Tracer::Thread::AnimationListener, "WakeUp",
+                      Tracer::Clock::now());
+    }
+    out->Send(AnimationTask());
+    lock.lock();
+  }
+}
+
+CapturedMouse ScreenInteractive::CaptureMouse() {
+  if (mouse_captured) {
+    return nullptr;
+  }
+  mouse_captured = true;
+  return std::make_unique<CapturedMouseImpl>(
+      [this] { mouse_captured = false; });
+}
+
+/// @brief Draw at most |fps| frames per second. The components invalidated in
+/// between, for instance by a stream of Post()ed tasks, are drawn together at
+/// the end of the frame interval. The keyboard input is drawn at most
+/// |input_latency| after it arrived, without waiting for the end of the
+/// interval, to keep the typing responsive.
+/// @param fps The maximum number of frames per second. 0 disables the limit.
+/// @param input_latency The maximum delay of the keyboard input.
+void ScreenInteractive::MaxFrameRate(int fps,
+                                    std::chrono::milliseconds input_latency) {
+  using Duration = animation::Clock::duration;
+  frame_interval_ =
+      fps > 0 ? Duration(std::chrono::seconds(1)) / fps : Duration(0);
+  input_latency_ = input_latency;
+}
+
+/// @brief Wait |delay| after the terminal was resized before drawing the next
+/// frame. The resizes arriving in between are drawn together, at the latest
+/// size, so dragging the border of the window doesn't redraw, clear the
+/// terminal and query the cursor position for every intermediate size.
+/// @param delay How long to wait. 0 draws after every resize.
+void ScreenInteractive::ResizeDebounce(std::chrono::milliseconds delay) {
+  resize_debounce_ = delay;
+}
+
+// Delay the next frame by |resize_debounce_|, unless a resize is already
+// pending. The delay starts at the first resize of a burst, so that a long
+// burst is still drawn regularly.
+void ScreenInteractive::DebounceResize() {
+  if (resize_pending_ || resize_debounce_.count() == 0) {
+    return;
+  }
+  resize_pending_ = true;
+  resize_deadline_ = Now() + resize_debounce_;
+}
+
+/// @brief Only draw the cells that changed since the previous frame. This
+/// reduces drastically the amount of data sent to the terminal when only a
+/// small part of the screen is updated, for instance over a slow connection.
+/// @param enable Whether to enable damage tracking.
+void ScreenInteractive::TrackDamage(bool enable) {
+  track_damage_ = enable;
+  previous_frame_ = Screen(0, 0);
+}
+
+/// @brief Only draw the lines that changed since the previous frame. The lines
+/// are compared using a hash of their content, so no copy of the previous frame
+/// is kept. This is a cheaper alternative to TrackDamage(), well suited when
+/// most of the lines are static, like log tails and headers.
+/// @param enable Whether to enable row damage tracking.
+void ScreenInteractive::TrackRowDamage(bool enable) {
+  track_row_damage_ = enable;
+  previous_row_hashes_.clear();
+}
+
+/// @brief Shorten the frames: the trailing blanks of the lines are erased
+/// instead of written, and when the terminal supports it, the runs of an
+/// identical character are written once, followed by REP. This helps with wide
+/// separators and mostly empty panes.
+/// @param enable Whether to enable the run length output.
+/// @see Terminal::RepeatSupport
+void ScreenInteractive::RunLengthOutput(bool enable) {
+  run_length_output_ = enable;
+}
+
+/// @brief When damage tracking is enabled, let the terminal scroll the bands of
+/// lines that moved vertically since the previous frame, like a scrolling log.
+/// Only the lines it exposes are then drawn. This uses scroll regions
+/// (DECSTBM), defined in absolute terminal rows, so this only applies to the
+/// fullscreen dimension, whose frame starts at the top of the terminal.
+/// @param enable Whether to enable scroll regions.
+/// @see TrackDamage
+void ScreenInteractive::ScrollRegions(bool enable) {
+  scroll_regions_ = enable;
+}
+
+/// @brief Ask the terminal to hold the rendering until a frame is complete,
+/// using the synchronized update mode (DEC private mode 2026). This avoids
+/// tearing during large redraws. The support is queried from the terminal, and
+/// frames are only wrapped once the terminal confirmed it supports the mode.
+/// @param enable Whether to enable synchronized updates.
+void ScreenInteractive::SynchronizedUpdate(bool enable) {
+  synchronized_update_ = enable;
+  synchronized_update_supported_ = false;
+}
+
+/// @brief Query what the terminal supports when the screen is installed: its
+/// name and version (XTVERSION), its type (DA1, DA2), and whether it supports
+/// the synchronized update and the bracketed paste modes (DECRQM). The replies
+/// are handled asynchronously, without reaching the components. Once complete,
+/// the result is recorded with Terminal::SetCapabilities(), and the next
+/// screens running in the same terminal don't probe it again.
+/// @param enable Whether to probe the terminal.
+/// @see Terminal::GetCapabilities
+void ScreenInteractive::ProbeTerminal(bool enable) {
+  probe_terminal_ = enable;
+}
+
+/// @brief Write the frames to the terminal from a dedicated thread. When the
+/// terminal, or the connection to it, is slow, the event handling doesn't wait
+/// for the frames to be written. While the previous frame is still being
+/// written, the new ones are dropped. Only the latest state is drawn once the
+/// terminal caught up.
+/// @param enable Whether to write from a dedicated thread.
+void ScreenInteractive::ThreadedOutput(bool enable) {
+  threaded_output_ = enable;
+}
+
+/// @brief Encode the frames from the writer thread of ThreadedOutput(), which
+/// this implies. The loop hands the pixels of a frame over, and handles the
+/// next events while the frame is converted into escape sequences and written.
+/// Like with ThreadedOutput(), the new frames are dropped while the previous
+/// one is still being encoded or written.
+///
+/// Rendering the components, and the layout and drawing of their Elements,
+/// remain on the loop thread: they read and write the state of the components,
+/// like the boxes of reflect() and the focus. The encoding time and the bytes
+/// written are then missing from the statistics of the frames.
+/// @param enable Whether to encode the frames from the writer thread.
+/// @see ThreadedOutput
+void ScreenInteractive::PipelinedRender(bool enable) {
+  pipelined_render_ = enable;
+}
+
+/// @brief Write the frames using the binary protocol of FrameEncoder, instead
+/// of escape sequences. Only the cells changed since the previous frame are
+/// sent, referencing the glyphs and the styles by their index. A thin client,
+/// like a web page using examples/frame_decoder.js, draws the cells itself.
+/// The input remains encoded like a terminal input.
+/// @param enable Whether to use the frame protocol.
+void ScreenInteractive::FrameProtocol(bool enable) {
+  if (enable != bool(frame_encoder_)) {
+    frame_encoder_ = enable ? std::make_unique<FrameEncoder>() : nullptr;
+  }
+}
+
+/// @brief Mirror the frames to the read-only viewers of |broadcast|. Each
+/// frame is serialized once for all of them, and a slow viewer doesn't delay
+/// the others, nor the loop.
+/// @param broadcast The viewers. nullptr stops. It must outlive the loop.
+/// @see FrameBroadcast
+void ScreenInteractive::Broadcast(FrameBroadcast* broadcast) {
+  broadcast_ = broadcast;
+}
+
+/// @brief Allocate the Elements rendered by the components from a FrameArena,
+/// instead of the heap. The memory of a frame is reused by the next one. The
+/// Elements kept alive by the components, across frames, remain valid.
+/// @param enable Whether to allocate the Elements from an arena.
+void ScreenInteractive::ArenaAllocation(bool enable) {
+  arena_allocation_ = enable;
+}
+
+/// @brief Compute the requirement and the box of the large children of hbox,
+/// vbox, dbox, gridbox and flexbox in parallel, on a pool of threads owned by
+/// the screen. The children are combined in order, so the layout is identical
+/// to the serial one. The Elements must not be shared by several parents.
+/// @param enable Whether to lay out in parallel.
+/// @see LayoutPool
+void ScreenInteractive::ParallelLayout(bool enable) {
+  parallel_layout_ = enable;
+  UpdateLayoutPool();
+}
+
+/// @brief Draw the large children of the containers in parallel, on the pool
+/// of threads owned by the screen, each into the region of its box. The
+/// children whose boxes overlap, like the ones of a dbox, are drawn serially.
+/// A child drawing outside of its box is clipped.
+/// @param enable Whether to draw in parallel.
+/// @see LayoutPool
+void ScreenInteractive::ParallelRender(bool enable) {
+  parallel_render_ = enable;
+  UpdateLayoutPool();
+}
+
+/// @brief Encode the frames into the terminal output by bands of rows, on the
+/// pool of threads owned by the screen, when they have 400x120 cells or more.
+/// The output is identical. Only used without TrackDamage().
+/// @param enable Whether to encode the output in parallel.
+/// @see Screen::SetParallelOutput
+void ScreenInteractive::ParallelOutput(bool enable) {
+  parallel_output_ = enable;
+  UpdateLayoutPool();
+}
+
+/// @brief Before handling a batch of pending events, drop the mouse movements
+/// and the terminal resizes immediately followed by another one, with the same
+/// buttons and modifiers. Only the latest is handled. This keeps the UI in sync
+/// with the pointer when the frames are slower than the mouse reports, for
+/// instance while dragging a ResizableSplit.
+/// @param enable Whether to coalesce the events.
+void ScreenInteractive::CoalesceEvents(bool enable) {
+  coalesce_events_ = enable;
+}
+
+/// @brief Handle the pending tasks by priority: the events, like the
+/// keystrokes, first, then the closures posted with Post(), like the results
+/// of the workers, and then the animation frames. The tasks of a lane keep
+/// their order, but a closure posted before an event might now run after it.
+///
+/// Once the closures and the animation frames took |budget| before a frame,
+/// the remaining ones are handled after it is drawn, along with the events
+/// received meanwhile. A burst of thousands of closures then delays the next
+/// keystroke by |budget| at most, instead of the whole burst.
+/// @param enable Whether to handle the tasks by priority.
+/// @param budget The time given to the closures and the animation frames
+/// before every frame. Zero doesn't limit them.
+void ScreenInteractive::PriorityLanes(bool enable,
+                                      std::chrono::microseconds budget) {
+  priority_lanes_ = enable;
+  low_priority_budget_ = budget;
+}
+
+/// @brief When the standard output isn't a terminal, like a pipe, a file or
+/// the log of a CI, write the frames as plain text, without escape sequences.
+/// The last frame is written on exit, and a snapshot every |interval| when it
+/// isn't zero. The terminal isn't configured, its input isn't read, and the
+/// signals keep their default handlers: only the closures posted, and the
+/// animations, update the components. Disabled by default.
+/// @param enable Whether to detect a standard output that isn't a terminal.
+/// @param interval The time between the snapshots. Zero writes none.
+void ScreenInteractive::NonInteractiveOutput(
+    bool enable,
+    std::chrono::milliseconds interval) {
+  non_interactive_output_ = enable;
+  snapshot_interval_ = interval;
+}
+
+/// @brief Don't dispatch the mouse movements to the components when they
+/// are outside of every box captured by reflect() during the last frame, and
+/// so was the previous mouse event. The boxes are indexed in a grid while
+/// drawing, so this is O(1) instead of asking every component. The components
+/// handling the mouse without reflect(), like a CatchEvent() following the
+/// pointer everywhere, miss these movements.
+/// @param enable Whether to skip the movements hitting no box.
+/// @see HitIndex
+void ScreenInteractive::MouseHitTest(bool enable) {
+  if (!enable) {
+    hit_index_.reset();
+  } else if (!hit_index_) {
+    hit_index_ = std::make_unique<HitIndex>();
+    // Until the next frame, nothing is indexed.
+    previous_mouse_hit_ = true;
+    frame_valid_ = false;
+  }
+}
+
+/// @brief Only report the mouse movements without a button pressed to the
+/// components while one of them needs them, to show where the mouse hovers.
+/// The components call RequestMouseMotion() while rendering. During the other
+/// frames, the terminal is switched to report only the clicks and the drags,
+/// sparing the stream of events sent for every cell the mouse crosses.
+/// @param enable Whether the mouse movements are reported on demand.
+/// @see RequestMouseMotion
+void ScreenInteractive::MouseMotionOnDemand(bool enable) {
+  mouse_motion_on_demand_ = enable;
+  frame_valid_ = false;
+}
+
+/// @brief Request the terminal to report the mouse movements, until the next
+/// frame not requesting them. Called by the components while rendering. Only
+/// useful with MouseMotionOnDemand().
+void ScreenInteractive::RequestMouseMotion() {
+  mouse_motion_requested_ = true;
+}
+
+/// @brief How the terminal input was read, since the screen was created. A
+/// large share of |full| reads means the input arrives faster than a buffer
+/// per wakeup. Only measured on POSIX.
+ScreenInteractive::InputReadStatistics ScreenInteractive::InputStatistics()
+    const {
+  InputReadStatistics statistics;
+  statistics.buffer_size = input_buffer_size;
+  statistics.reads = input_counters_.reads.load(std::memory_order_relaxed);
+  statistics.bytes = input_counters_.bytes.load(std::memory_order_relaxed);
+  statistics.largest = input_counters_.largest.load(std::memory_order_relaxed);
+  statistics.full = input_counters_.full.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+// Called by the input listener, after every read.
+void ScreenInteractive::RecordRead(std::string_view input) {
+  const size_t bytes = input.size();
+  input_counters_.reads.fetch_add(1, std::memory_order_relaxed);
+  input_counters_.bytes.fetch_add(bytes, std::memory_order_relaxed);
+  if (bytes > input_counters_.largest.load(std::memory_order_relaxed)) {
+    input_counters_.largest.store(bytes, std::memory_order_relaxed);
+  }
+  if (bytes == input_buffer_size) {
+    input_counters_.full.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  InputRecording::Entry entry;
+  entry.input = input;
+  RecordEntry(std::move(entry));
+}
+
+/// @brief Append the input read from the terminal, and the terminal resizes,
+/// to |recording|. The recording can be saved using InputRecording::Serialize,
+/// and played again using Replay.
+/// @param recording Where to record. nullptr stops the recording.
+/// @see Replay
+void ScreenInteractive::RecordInput(InputRecording* recording) {
+  const std::lock_guard<std::mutex> lock(recording_mutex_);
+  recording_ = recording;
+  recording_start_ = animation::Clock::now();
+}
+
+void ScreenInteractive::RecordEntry(InputRecording::Entry entry) {
+  const std::lock_guard<std::mutex> lock(recording_mutex_);
+  if (!recording_) {
+    return;
+  }
+  entry.time = std::chrono::duration_cast<std::chrono::microseconds>(
+      animation::Clock::now() - recording_start_);
+  recording_->entries.push_back(std::move(entry));
+}
+
+/// @brief Run the loop on |component|, feeding it the |recording| made by
+/// RecordInput, as if it was read from the terminal. A frame is drawn after
+/// every entry, and measured.
+///
+/// The entries are fed without waiting, so the replay is deterministic. Their
+/// times are only used to time out the incomplete escape sequences, like the
+/// input listener does. The resizes change the size of a FixedSize() screen.
+/// @param component The component to feed.
+/// @param recording What to feed.
+/// @return The latency and the output of every frame.
+ReplayReport ScreenInteractive::Replay(Component component,
+                                       const InputRecording& recording) {
+  ReplayReport report;
+  ftxui::Loop loop(this, std::move(component));
+  loop.RunOnce();
+
+  auto parser = TerminalInputParser(task_sender_->Clone());
+  auto TimeOut = [&](std::chrono::microseconds elapsed) {
+    while (parser.HasPending() &&
+           elapsed >= std::chrono::milliseconds(timeout_milliseconds)) {
+      parser.Timeout(timeout_milliseconds);
+      elapsed -= std::chrono::milliseconds(timeout_milliseconds);
+    }
+  };
+
+  std::chrono::microseconds previous{0};
+  for (size_t i = 0; i < recording.entries.size() && !loop.HasQuitted(); ++i) {
+    const InputRecording::Entry& entry = recording.entries[i];
+    TimeOut(entry.time - previous);
+    previous = entry.time;
+
+    const size_t output_bytes = g_output_bytes;
+    const auto start = animation::Clock::now();
+    if (entry.is_resize()) {
+      if (dimension_ == Dimension::Fixed) {
+        fixed_dimx_ = entry.dimx;
+        fixed_dimy_ = entry.dimy;
+      }
+      Post(Event::Special({0}));
+    } else {
+      parser.Add(entry.input);
+    }
+    loop.RunOnce();
+
+    // Nothing is written when no frame was drawn.
+    if (g_output_bytes != output_bytes) {
+      ReplayReport::Frame frame;
+      frame.entry = i;
+      frame.latency = std::chrono::duration_cast<std::chrono::microseconds>(
+          animation::Clock::now() - start);
+      frame.output_bytes = g_output_bytes - output_bytes;
+      report.frames.push_back(frame);
+    }
+  }
+
+  // The trailing incomplete sequence, like a lone escape, times out.
+  TimeOut(std::chrono::microseconds::max());
+  loop.RunOnce();
+  return report;
+}
+
+/// @brief Parse |input| as if it was read from the terminal. The events are
+/// handled by the next Loop::RunOnce(). Only for the Headless() screens, and
+/// the screens driven by a HostEventLoop().
+/// @param input The bytes, like "a" or "\x1b[A".
+void ScreenInteractive::FeedInput(std::string_view input) {
+  if (!input_parser_) {
+    return;
+  }
+  if (host_event_loop_) {
+    RecordRead(input);
+    input_time_ = Now();
+  }
+  input_parser_->Add(input);
+}
+
+/// @brief Move the clock of a Headless() screen forward. An incomplete escape
+/// sequence times out like it does when read from the terminal. An animation
+/// frame due by then is posted, and handled by the next Loop::RunOnce().
+/// @param duration How much to move the clock forward.
+void ScreenInteractive::AdvanceTime(animation::Clock::duration duration) {
+  if (!headless_) {
+    return;
+  }
+  const auto step = std::chrono::milliseconds(timeout_milliseconds);
+  for (auto elapsed = duration; input_parser_ &&
+                                input_parser_->HasPending() &&
+                                elapsed >= step;
+       elapsed -= step) {
+    input_parser_->Timeout(timeout_milliseconds);
+  }
+
+  headless_now_ += duration;
+  if (animation_armed_ && animation_deadline_ <= headless_now_) {
+    animation_armed_ = false;
+    Post(AnimationTask());
+  }
+}
+
+/// @brief Let a host event loop, like epoll or asio, drive the screen, instead
+/// of threads. The host reads the terminal input, and passes it to
+/// FeedInput(). It calls Tick() at NextTick(), and Loop::RunOnce() after
+/// feeding the input, after Tick(), and whenever TaskFd() is readable.
+/// @param enable Whether the host drives the screen. Set before the loop
+/// starts.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.HostEventLoop();
+/// Loop loop(&screen, component);
+/// // Register STDIN_FILENO and screen.TaskFd() in the reactor, and a timer
+/// // expiring at screen.NextTick().
+/// ```
+void ScreenInteractive::HostEventLoop(bool enable) {
+  host_event_loop_ = enable;
+}
+
+/// @brief A file descriptor readable while some tasks, posted from any thread,
+/// or some signals, are waiting for Loop::RunOnce(). It is drained by
+/// Loop::RunOnce(). Only with HostEventLoop(), while the loop runs. POSIX only.
+/// @return The file descriptor, or -1.
+int ScreenInteractive::TaskFd() const {
+  return host_event_loop_ ? wakeup_[0] : -1;
+}
+
+/// @brief Time out the incomplete escape sequences fed so far, and post the
+/// animation frame due by now. Only with HostEventLoop().
+void ScreenInteractive::Tick() {
+  if (!host_event_loop_ || !input_parser_) {
+    return;
+  }
+  const auto now = Now();
+  if (input_parser_->HasPending()) {
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(now -
+                                                              input_time_);
+    input_parser_->Timeout(int(elapsed.count()));
+  }
+  input_time_ = now;
+
+  bool animation = false;
+  {
+    const std::lock_guard<std::mutex> lock(animation_mutex_);
+    if (animation_armed_ && animation_deadline_ <= now) {
+      animation_armed_ = false;
+      animation = true;
+    }
+  }
+  if (animation) {
+    Post(AnimationTask());
+  }
+}
+
+/// @brief When Tick() must be called next. Only with HostEventLoop().
+/// @return The time, or TimePoint::max() when nothing is due.
+animation::TimePoint ScreenInteractive::NextTick() {
+  animation::TimePoint next = animation::TimePoint::max();
+  if (!host_event_loop_ || !input_parser_) {
+    return next;
+  }
+  if (input_parser_->HasPending()) {
+    next = input_time_ + std::chrono::milliseconds(timeout_milliseconds);
+  }
+  const std::lock_guard<std::mutex> lock(animation_mutex_);
+  if (animation_armed_) {
+    next = std::min(next, animation_deadline_);
+  }
+  return next;
+}
+
+/// @brief The bytes written toward the terminal by a Headless() screen, since
+/// the last call.
+std::string ScreenInteractive::TakeOutput() {
+  std::string output;
+  std::swap(output, headless_output_);
+  return output;
+}
+
+/// @brief Keep the statistics of the last |frames| frames: the time spent in
+/// every step of the loop, the bytes written, and the number of tasks handled.
+/// @param frames The number of frames kept. 0 disables the statistics.
+/// @see Stats
+void ScreenInteractive::KeepStats(size_t frames) {
+  stats_frames_ = frames;
+  while (stats_.size() > stats_frames_) {
+    stats_.pop_front();
+  }
+  next_stats_ = {};
+}
+
+/// @brief The statistics of the last frames, oldest first.
+/// @see KeepStats
+std::vector<ScreenInteractive::FrameStats> ScreenInteractive::Stats() const {
+  return {stats_.begin(), stats_.end()};
+}
+
+/// @brief The bytes of memory held by the screen: the pixels of the frames,
+/// and the buffers reused from one frame to the next. To find what grows in a
+/// long running application, with DescribeTree() of the components.
+/// @see Screen::MemoryUsage
+size_t ScreenInteractive::MemoryUsage() const {
+  // The writer thread encodes |pipeline_frame_| against |previous_frame_|.
+  if (pipelined_render_) {
+    OutputSink::Stdout().WaitIdle();
+  }
+  return Screen::MemoryUsage() + previous_frame_.MemoryUsage() +
+         pipeline_frame_.MemoryUsage() + util::HeapSize(output_buffer_) +
+         util::HeapSize(headless_output_) + util::HeapSize(task_batch_) +
+         util::HeapSize(static_elements_) +
+         util::HeapSize(previous_row_hashes_) + util::HeapSize(row_hashes_) +
+         stats_.size() * sizeof(FrameStats) + frame_arena_.MemoryUsage();
+}
+
+/// @brief Report the frames slower than |threshold|, to find the intermittent
+/// slow frames without a profiler attached. The time of every step of the
+/// frame is reported, with the number of Elements drawn by type, the depth of
+/// their tree, and its largest subtrees. With Profile() enabled, the time
+/// spent in every type of node is reported too.
+/// @param threshold The time spent handling the tasks and drawing the frame,
+/// from which it is reported.
+/// @param callback Called from the loop, after the slow frame is drawn. An
+/// empty callback stops watching.
+/// @see SlowFrame
+void ScreenInteractive::WatchSlowFrames(
+    std::chrono::microseconds threshold,
+    std::function<void(const SlowFrame&)> callback) {
+  slow_frame_threshold_ = threshold;
+  slow_frame_callback_ = std::move(callback);
+}
+
+/// @brief Append the summary of the frames slower than |threshold| to the file
+/// at |path|.
+/// @see WatchSlowFrames
+void ScreenInteractive::WatchSlowFrames(std::chrono::microseconds threshold,
+                                        const std::string& path) {
+  WatchSlowFrames(threshold, [path](const SlowFrame& frame) {
+    std::ofstream file(path, std::ios::app);
+    file << frame.ToString() << "\n";
+  });
+}
+
+/// @brief The duration of the frame and of its steps, the number of Elements
+/// by type, the largest subtrees, and the types of node taking the most time.
+std::string ScreenInteractive::SlowFrame::ToString() const {
+  const auto us = [](std::chrono::nanoseconds time) {
+    return std::to_string(time.count() / 1000) + "µs";  // NOLINT
+  };
+  std::string out = "Slow frame: " + us(duration) + "\n";
+  out += "  Steps: events " + us(stats.events) + ", render " +
+         us(stats.render) + ", layout " + us(stats.layout) + ", draw " +
+         us(stats.draw) + ", shaders " + us(stats.shaders) + ", encode " +
+         us(stats.encode) + ", write " + us(stats.write) + "\n";
+  out += "  Output: " + std::to_string(stats.output_bytes) + " bytes, " +
+         std::to_string(stats.cells_changed) + " cells changed, " +
+         std::to_string(stats.tasks) + " tasks\n";
+  out += "  Tree: " + std::to_string(tree.nodes) + " nodes, depth " +
+         std::to_string(tree.depth) + "\n";
+  out += "  Types:";
+  for (const auto& type : tree.types) {
+    out += " " + type.name + " " + std::to_string(type.count);
+  }
+  out += "\n";
+  for (const auto& subtree : tree.largest) {
+    out += "  Subtree: " + subtree.path + ", " +
+           std::to_string(subtree.nodes) + " nodes, depth " +
+           std::to_string(subtree.depth) + "\n";
+  }
+  for (const auto& entry : profile.entries) {
+    out += "  Profile: " + entry.name + " " + std::to_string(entry.calls()) +
+           " calls, " + us(entry.total()) + "\n";
+  }
+  return out;
+}
+
+/// @brief Record what the threads of the screen do into |tracer|: the tasks
+/// handled and the steps of the frames by the loop, the reads by the input
+/// listener, and the wake ups by the animation listener.
+/// @param tracer Where to record. nullptr stops the recording. It must outlive
+/// the loop.
+/// @see Tracer
+void ScreenInteractive::Trace(Tracer* tracer) {
+  tracer_ = tracer;
+}
+
+/// @brief Measure the layout and the drawing of every type of node, during
+/// every frame. The nodes are only measured when FTXUI is built with the
+/// FTXUI_PROFILE CMake option.
+/// @param enable Whether to measure the frames.
+/// @see FrameProfile
+/// @see debugOverlay
+void ScreenInteractive::Profile(bool enable) {
+  if (!enable) {
+    profiler_.reset();
+    frame_profile_ = {};
+  } else if (!profiler_) {
+    profiler_ = std::make_unique<Profiler>();
+  }
+}
+
+void ScreenInteractive::UpdateLayoutPool() {
+#if !defined(__EMSCRIPTEN__)
+  SetParallelOutput(nullptr);
+  if (!parallel_layout_ && !parallel_render_ && !parallel_output_) {
+    layout_pool_.reset();
+    return;
+  }
+  if (!layout_pool_) {
+    // A small pool: the layout of most frames doesn't scale much further.
+    const int threads = static_cast<int>(std::thread::hardware_concurrency());
+    layout_pool_ = std::make_unique<LayoutPool>(std::clamp(threads - 1, 1, 7));
+  }
+  layout_pool_->SetParallelLayout(parallel_layout_);
+  layout_pool_->SetParallelRender(parallel_render_);
+  if (parallel_output_) {
+    LayoutPool* pool = layout_pool_.get();
+    SetParallelOutput(
+        [pool](size_t count, const std::function<void(size_t)>& task) {
+          pool->ParallelFor(count, task);
+        });
+  }
+#endif
+}
+
+void ScreenInteractive::Loop(Component component) {  // NOLINT
+  class Loop loop(this, std::move(component));
+  loop.Run();
+}
+
+bool ScreenInteractive::HasQuitted() {
+  return task_receiver_->HasQuitted() && task_batch_.empty();
+}
+
+void ScreenInteractive::PreMain() {
+  if (session_) {
+    const SessionScope scope(this, session_, &headless_output_);
+    Install();
+    previous_animation_time_ = Now();
+    StartAnimations();
+    return;
+  }
+
+  // Suspend previously active screen:
+  if (g_active_screen) {
+    std::swap(suspended_screen_, g_active_screen);
+    // Reset cursor position to the top of the screen and clear the screen.
+    if (!suspended_screen_->plain_text_) {
+      suspended_screen_->ResetCursorPosition();
+      Write(suspended_screen_->ResetPosition(/*clear=*/true));
+    }
+    suspended_screen_->dimx_ = 0;
+    suspended_screen_->dimy_ = 0;
+
+    // Reset dimensions to force drawing the screen again next time:
+    suspended_screen_->Uninstall();
+  }
+
+  // This screen is now active:
+  g_active_screen = this;
+  g_active_screen->Install();
+
+  previous_animation_time_ = Now();
+  StartAnimations();
+}
+
+// Request a frame for the animators started before the loop. The ones created
+// while no screen was active are stepped by their components.
+void ScreenInteractive::StartAnimations() {
+  if (scheduler_->running() != 0) {
+    ScheduleAnimationFrame();
+  }
+  if (animation::Scheduler::Default().running() != 0) {
+    RequestAnimationFrame();
+  }
+}
+
+void ScreenInteractive::PostMain() {
+  if (session_) {
+    const SessionScope scope(this, session_, &headless_output_);
+    Uninstall();
+    return;
+  }
+
+  // Put cursor position at the end of the drawing.
+  ResetCursorPosition();
+
+  g_active_screen = nullptr;
 
   // Restore suspended screen.
   if (suspended_screen_) {
     // Clear screen, and put the cursor at the beginning of the drawing.
-    std::cout << ResetPosition(/*clear=*/true);
+    if (!plain_text_) {
+      Write(ResetPosition(/*clear=*/true));
+    }
     dimx_ = 0;
     dimy_ = 0;
     Uninstall();
     std::swap(g_active_screen, suspended_screen_);
     g_active_screen->Install();
+  } else if (plain_text_) {
+    // On final exit, write the last frame.
+    if (plain_text_component_) {
+      WritePlainText(std::move(plain_text_component_));
+      plain_text_component_ = nullptr;
+    }
+    Uninstall();
   } else {
     Uninstall();
     // On final exit, keep the current drawing and reset cursor position one
     // line after it.
-    std::cout << std::endl;
+    if (!headless_) {
+      Write("\n");
+      Flush();
+    }
   }
 }
 
@@ -480,11 +1995,59 @@ Closure ScreenInteractive::WithRestoredIO(Closure fn) {  // NOLINT
 
 // static
 ScreenInteractive* ScreenInteractive::Active() {
-  return g_active_screen;
+  return g_session_screen ? g_session_screen : g_active_screen;
 }
 
 void ScreenInteractive::Install() {
   frame_valid_ = false;
+  redraw_requested_ = false;
+
+  // The terminal content might have been modified while uninstalled. The next
+  // frame must be fully drawn.
+  previous_frame_ = Screen(0, 0);
+  previous_row_hashes_.clear();
+  // The answers to the previous requests might have been lost.
+  cursor_report_stale_ = true;
+  cursor_reports_pending_ = 0;
+
+  // The terminal might have been resized while uninstalled, without anyone
+  // listening to the resize signal.
+  Terminal::InvalidateSize();
+
+  if (session_) {
+    InstallSession();
+    return;
+  }
+
+  if (headless_) {
+    g_headless_output = &headless_output_;
+    on_exit_functions.push([] { g_headless_output = nullptr; });
+    quit_ = false;
+    task_sender_ = task_receiver_->MakeSender();
+    input_parser_ =
+        std::make_unique<TerminalInputParser>(task_receiver_->MakeSender());
+    StartProbe();
+    return;
+  }
+
+  plain_text_ =
+      non_interactive_output_ && !host_event_loop_ && !StdoutIsTerminal();
+  if (plain_text_) {
+    // Only the frames are written. Without any terminal state to restore, the
+    // default signal handlers are kept.
+    on_exit_functions.push([] { Flush(); });
+    quit_ = false;
+    task_sender_ = task_receiver_->MakeSender();
+    next_snapshot_ = Now() + snapshot_interval_;
+    animation_listener_ = std::thread(&ScreenInteractive::AnimationListener,
+                                      this, task_receiver_->MakeSender());
+    WakeUpLater();
+    return;
+  }
+
+  if (threaded_output_ || pipelined_render_) {
+    OutputSink::Stdout().StartWriterThread();
+  }
 
   // After uninstalling the new configuration, flush it to the terminal to
   // ensure it is fully applied:
@@ -522,10 +2085,18 @@ void ScreenInteractive::Install() {
   const int enable_echo_input = 0x0004;
   const int enable_virtual_terminal_input = 0x0200;
   const int enable_window_input = 0x0008;
+  const int enable_mouse_input = 0x0010;
+  const int enable_quick_edit_mode = 0x0040;
+  const int enable_extended_flags = 0x0080;
   in_mode &= ~enable_echo_input;
   in_mode &= ~enable_line_input;
   in_mode |= enable_virtual_terminal_input;
   in_mode |= enable_window_input;
+  // Receive the mouse records the console doesn't translate into VT
+  // sequences, instead of selecting text with the mouse.
+  in_mode |= enable_mouse_input;
+  in_mode &= ~enable_quick_edit_mode;
+  in_mode |= enable_extended_flags;
 
   SetConsoleMode(stdin_handle, in_mode);
   SetConsoleMode(stdout_handle, out_mode);
@@ -551,13 +2122,13 @@ void ScreenInteractive::Install() {
 #endif
 
   auto enable = [&](const std::vector<DECMode>& parameters) {
-    std::cout << Set(parameters);
-    on_exit_functions.push([=] { std::cout << Reset(parameters); });
+    Write(Set(parameters));
+    on_exit_functions.push([=] { Write(Reset(parameters)); });
   };
 
   auto disable = [&](const std::vector<DECMode>& parameters) {
-    std::cout << Reset(parameters);
-    on_exit_functions.push([=] { std::cout << Set(parameters); });
+    Write(Reset(parameters));
+    on_exit_functions.push([=] { Write(Set(parameters)); });
   };
 
   if (use_alternative_screen_) {
@@ -567,8 +2138,8 @@ void ScreenInteractive::Install() {
   }
 
   on_exit_functions.push([=] {
-    std::cout << "\033[?25h";  // Enable cursor.
-    std::cout << "\033[?1 q";  // Cursor block blinking.
+    Write("\033[?25h");  // Enable cursor.
+    Write("\033[?1 q");  // Cursor block blinking.
   });
 
   disable({
@@ -577,44 +2148,335 @@ void ScreenInteractive::Install() {
   });
 
   enable({DECMode::kMouseVt200});
+  enable({DECMode::kMouseBtnEventMouse});
   enable({DECMode::kMouseAnyEvent});
+  mouse_motion_reported_ = true;
   enable({DECMode::kMouseUrxvtMode});
   enable({DECMode::kMouseSgrExtMode});
 
+  // Receive the pasted text as a single Event::Paste.
+  enable({DECMode::kBracketedPaste});
+
+  // The terminal answers asynchronously. The synchronized update mode is used
+  // once it confirmed supporting it.
+  synchronized_update_supported_ = false;
+  if (synchronized_update_) {
+    Write(RequestMode(DECMode::kSynchronizedUpdate));
+  }
+  StartProbe();
+
   // After installing the new configuration, flush it to the terminal to
   // ensure it is fully applied:
   Flush();
 
   quit_ = false;
   task_sender_ = task_receiver_->MakeSender();
-  event_listener_ =
-      std::thread(&EventListener, &quit_, task_receiver_->MakeSender());
-  animation_listener_ =
-      std::thread(&AnimationListener, &quit_, task_receiver_->MakeSender());
+#if defined(_WIN32)
+  exit_event_ = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+#elif !defined(__EMSCRIPTEN__)
+  if (pipe(wakeup_.data()) == 0) {
+    // Never block the signal handlers when the pipe is full.
+    fcntl(wakeup_[1], F_SETFL, O_NONBLOCK);  // NOLINT
+  } else {
+    wakeup_ = {-1, -1};
+  }
+  g_wakeup_fd = wakeup_[1];
+#endif
+  if (host_event_loop_) {
+    // The host reads the input, and watches the time.
+    input_parser_ =
+        std::make_unique<TerminalInputParser>(task_receiver_->MakeSender());
+    input_time_ = Now();
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    task_fd_notified_ = false;
+    if (wakeup_[0] >= 0) {
+      fcntl(wakeup_[0], F_SETFL, O_NONBLOCK);  // NOLINT
+    }
+#endif
+  } else {
+    event_listener_ = std::thread(&EventListener, &quit_,
+                                  task_receiver_->MakeSender(), wakeup_[0],
+                                  this);
+    animation_listener_ = std::thread(&ScreenInteractive::AnimationListener,
+                                      this, task_receiver_->MakeSender());
+  }
+
+  // Draw the first frame.
+  WakeUpLater();
 }
 
 void ScreenInteractive::Uninstall() {
   ExitNow();
-  event_listener_.join();
-  animation_listener_.join();
+  if (session_) {
+    UninstallSession();
+    return;
+  }
+  if (headless_) {
+    OnExit();
+    return;
+  }
+  if (event_listener_.joinable()) {
+    event_listener_.join();
+  }
+  if (animation_listener_.joinable()) {
+    animation_listener_.join();
+  }
+#if defined(_WIN32)
+  if (exit_event_) {
+    CloseHandle(static_cast<HANDLE>(exit_event_));
+    exit_event_ = nullptr;
+  }
+#elif !defined(__EMSCRIPTEN__)
+  g_wakeup_fd = -1;
+  for (int& fd : wakeup_) {
+    if (fd >= 0) {
+      close(fd);
+    }
+    fd = -1;
+  }
+#endif
   OnExit();
+  // Wait for everything to be written.
+  OutputSink::Stdout().StopWriterThread();
+}
+
+namespace {
+
+// The modes of the remote terminal of a Session(), set by InstallSession().
+std::vector<DECMode> SessionModes(bool use_alternative_screen) {
+  std::vector<DECMode> modes = {
+      DECMode::kMouseVt200,      DECMode::kMouseBtnEventMouse,
+      DECMode::kMouseAnyEvent,   DECMode::kMouseUrxvtMode,
+      DECMode::kMouseSgrExtMode, DECMode::kBracketedPaste,
+  };
+  if (use_alternative_screen) {
+    modes.insert(modes.begin(), DECMode::kAlternateScreen);
+  }
+  return modes;
+}
+
+}  // namespace
+
+// Send the requests of ProbeTerminal(), unless the terminal was already probed.
+// The DA1 request goes last: every terminal answers it, and the replies come
+// in order, so it marks the end of the probe.
+void ScreenInteractive::StartProbe() {
+  probe_.reset();
+  UseCapabilities(Terminal::GetCapabilities());
+  if (!probe_terminal_ || capabilities_.probed) {
+    return;
+  }
+
+  probe_ = std::make_unique<Terminal::Capabilities>(capabilities_);
+  probe_->synchronized_update = false;
+  probe_->bracketed_paste = false;
+  Write(CSI + ">0q");  // XTVERSION
+  Write(RequestMode(DECMode::kSynchronizedUpdate));
+  Write(RequestMode(DECMode::kBracketedPaste));
+  Write(CSI + ">c");  // DA2
+  Write(CSI + "c");   // DA1
+}
+
+void ScreenInteractive::HandleProbeReply(const Event& event) {
+  if (!probe_) {
+    return;
+  }
+
+  if (event.is_mode_reporting()) {
+    const bool supported = event.mode_value() >= 1 && event.mode_value() <= 4;
+    if (event.mode() == int(DECMode::kSynchronizedUpdate)) {
+      probe_->synchronized_update = supported;
+    }
+    if (event.mode() == int(DECMode::kBracketedPaste)) {
+      probe_->bracketed_paste = supported;
+    }
+    return;
+  }
+
+  if (event.is_terminal_version()) {
+    probe_->version = event.terminal_version();
+    return;
+  }
+
+  if (!event.is_device_attributes()) {
+    return;
+  }
+
+  if (event.is_secondary()) {
+    probe_->device_type = event.device_type();
+    return;
+  }
+
+  // The DA1 reply ends the probe. There are no queries for REP and truecolor:
+  // they are derived from the name of the terminals known to support them.
+  // Every terminal answering DA1 supports the scroll regions of the VT100.
+  if (!probe_->version.empty()) {
+    std::string name = probe_->version;
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    const bool modern = std::any_of(
+        std::begin(kModernTerminals), std::end(kModernTerminals),
+        [&](std::string_view known) { return name.starts_with(known); });
+    probe_->repeat = modern;
+    probe_->true_color = modern || probe_->true_color;
+  }
+  probe_->scroll_region = true;
+  probe_->probed = true;
+  Terminal::SetCapabilities(*probe_);
+  UseCapabilities(*probe_);
+  probe_.reset();
+  frame_valid_ = false;
+}
+
+void ScreenInteractive::UseCapabilities(
+    const Terminal::Capabilities& capabilities) {
+  capabilities_ = capabilities;
+  if (capabilities_.probed) {
+    synchronized_update_supported_ = capabilities_.synchronized_update;
+  }
+}
+
+// Configure the remote terminal of a Session(), using its output only. Unlike
+// Install(), nothing global is touched.
+void ScreenInteractive::InstallSession() {
+  synchronized_update_supported_ = false;
+  mouse_motion_reported_ = true;
+  if (frame_encoder_) {
+    // The client starts from a key frame.
+    frame_encoder_->Reset();
+  } else {
+    Write(Set(SessionModes(use_alternative_screen_)));
+    Write(Reset({DECMode::kLineWrap}));
+  }
+  if (synchronized_update_ && !frame_encoder_) {
+    Write(RequestMode(DECMode::kSynchronizedUpdate));
+  }
+
+  quit_ = false;
+  task_sender_ = task_receiver_->MakeSender();
+  input_parser_ =
+      std::make_unique<TerminalInputParser>(task_receiver_->MakeSender());
+  input_time_ = Now();
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  task_fd_notified_ = false;
+  if (pipe(wakeup_.data()) == 0) {
+    fcntl(wakeup_[0], F_SETFL, O_NONBLOCK);  // NOLINT
+    fcntl(wakeup_[1], F_SETFL, O_NONBLOCK);  // NOLINT
+  } else {
+    wakeup_ = {-1, -1};
+  }
+#endif
+
+  // Draw the first frame.
+  WakeUpLater();
+}
+
+// Restore the remote terminal of a Session().
+void ScreenInteractive::UninstallSession() {
+  if (!frame_encoder_) {
+    Write(Set({DECMode::kLineWrap}));
+    Write(Reset(SessionModes(use_alternative_screen_)));
+    Write("\033[?25h");  // Enable cursor.
+  }
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  for (int& fd : wakeup_) {
+    if (fd >= 0) {
+      close(fd);
+    }
+    fd = -1;
+  }
+#endif
 }
 
 // NOLINTNEXTLINE
 void ScreenInteractive::RunOnceBlocking(Component component) {
   ExecuteSignalHandlers();
   Task task;
-  if (task_receiver_->Receive(&task)) {
-    HandleTask(component, task);
+  // The tasks deferred by PriorityLanes() are pending already.
+  if (task_batch_.empty() && task_receiver_->Receive(&task)) {
+    task_batch_.push_back(std::move(task));
   }
   RunOnce(component);
 }
 
 void ScreenInteractive::RunOnce(Component component) {
-  Task task;
-  while (task_receiver_->ReceiveNonBlocking(&task)) {
-    HandleTask(component, task);
-    ExecuteSignalHandlers();
+  const SessionScope session_scope(this, session_, &headless_output_);
+  // The tasks posted while handling a batch are handled by the next one. The
+  // batch is swapped out, in case a task runs a nested loop on this screen.
+  DrainTaskFd();
+  std::vector<Task> batch;
+  // When the first closure or animation frame was handled, for
+  // PriorityLanes().
+  std::optional<std::chrono::steady_clock::time_point> low_priority_start;
+  while (true) {
+    // The signals are meant for the terminal of the process, not the sessions.
+    if (!session_) {
+      ExecuteSignalHandlers();
+    }
+    batch.swap(task_batch_);
+    task_receiver_->ReceiveAll(&batch);
+    if (batch.empty()) {
+      batch.swap(task_batch_);
+      break;
+    }
+    if (coalesce_events_) {
+      CoalesceTasks(&batch);
+    }
+    if (priority_lanes_) {
+      // The alternatives of Task are ordered by priority.
+      std::stable_sort(batch.begin(), batch.end(),
+                       [](const Task& a, const Task& b) {
+                         return a.index() < b.index();
+                       });
+    }
+    StepTimer timer(stats_frames_ != 0 || slow_frame_callback_, tracer_);
+    next_stats_.queue_depth = std::max(next_stats_.queue_depth, batch.size());
+    size_t handled = 0;
+    bool deferred = false;
+    for (; handled < batch.size(); ++handled) {
+      Task& task = batch[handled];
+      if (priority_lanes_ && !std::holds_alternative<Event>(task) &&
+          low_priority_budget_.count() != 0) {
+        const auto now = std::chrono::steady_clock::now();
+        if (!low_priority_start) {
+          low_priority_start = now;
+        } else if (now - *low_priority_start >= low_priority_budget_) {
+          deferred = true;
+          break;
+        }
+      }
+      const char* name = TaskName(task);
+      HandleTask(component, task);
+      timer.Lap(next_stats_.events, name);
+    }
+    next_stats_.tasks += handled;
+    if (deferred) {
+      // Handled after the frame, before the tasks posted meanwhile.
+      task_batch_.insert(task_batch_.begin(),
+                         std::make_move_iterator(batch.begin() + long(handled)),
+                         std::make_move_iterator(batch.end()));
+      NotifyTaskFd();
+      break;
+    }
+    batch.clear();
+    batch.swap(task_batch_);
+  }
+
+  // Wait for the end of a burst of resizes.
+  if (!frame_valid_ && resize_pending_ && Now() < resize_deadline_) {
+    WakeUpAt(resize_deadline_);
+    return;
+  }
+
+  // Delay the frame until the end of the frame interval, or until the
+  // keyboard input must be drawn. The AnimationTask wakes up the loop.
+  if (!frame_valid_ && frame_interval_.count() != 0) {
+    const auto deadline =
+        std::min(previous_draw_time_ + frame_interval_, input_deadline_);
+    if (Now() < deadline) {
+      WakeUpAt(deadline);
+      return;
+    }
   }
   Draw(std::move(component));
 }
@@ -627,41 +2489,116 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
     // Handle Event.
     if constexpr (std::is_same_v<T, Event>) {
       if (arg.is_cursor_reporting()) {
-        cursor_x_ = arg.cursor_x();
-        cursor_y_ = arg.cursor_y();
+        // The position of the frame, from the position of its end.
+        cursor_x_ = arg.cursor_x() - cursor_report_x_;
+        cursor_y_ = arg.cursor_y() - cursor_report_y_;
+        cursor_reports_pending_ = std::max(0, cursor_reports_pending_ - 1);
+        // The frame moved again meanwhile: request its position again.
+        if (cursor_report_stale_) {
+          frame_valid_ = false;
+        }
+        return;
+      }
+
+      if (arg.is_mode_reporting()) {
+        // 1: set, 2: reset. 0 means the mode is not recognized, 3 and 4 that
+        // it is permanently set or reset.
+        if (arg.mode() == int(DECMode::kSynchronizedUpdate)) {
+          synchronized_update_supported_ =
+              arg.mode_value() == 1 || arg.mode_value() == 2;
+        }
+        HandleProbeReply(arg);
+        return;
+      }
+
+      if (arg.is_device_attributes() || arg.is_terminal_version()) {
+        HandleProbeReply(arg);
         return;
       }
 
       if (arg.is_mouse()) {
         arg.mouse().x -= cursor_x_;
         arg.mouse().y -= cursor_y_;
+
+        // A movement from outside to outside of every reflected box can't
+        // change the hover state of any component.
+        if (hit_index_) {
+          const bool hit = hit_index_->Hit(arg.mouse().x, arg.mouse().y);
+          const bool skip = !hit && !previous_mouse_hit_ && !mouse_captured &&
+                            !MouseMovePrefix(arg).empty();
+          previous_mouse_hit_ = hit;
+          if (skip) {
+            return;
+          }
+        }
+      }
+
+      // Event::Custom is posted to draw a new frame. A resize changes the
+      // frame, even if no component handles it.
+      const bool redraw = arg == Event::Custom || arg == Event::Special({0});
+
+      if (frame_interval_.count() != 0 && !arg.is_mouse() && !redraw) {
+        input_deadline_ = std::min(
+            input_deadline_, Now() + input_latency_);
       }
 
       arg.screen_ = this;
-      component->OnEvent(arg);
-      frame_valid_ = false;
+      if (component->HandleEvent(arg) || redraw) {
+        frame_valid_ = false;
+        return;
+      }
+
+      // The bracketed paste is always enabled. The components ignoring
+      // Event::Paste receive the text as if it was typed.
+      if (arg.is_paste()) {
+        for (Event& event : TypedEvents(arg.paste())) {
+          event.screen_ = this;
+          if (component->HandleEvent(event)) {
+            frame_valid_ = false;
+          }
+        }
+      }
       return;
     }
 
     // Handle callback
-    if constexpr (std::is_same_v<T, Closure>) {
+    if constexpr (std::is_same_v<T, InlineClosure>) {
       arg();
       return;
     }
 
     // Handle Animation
     if constexpr (std::is_same_v<T, AnimationTask>) {
-      if (!animation_requested_) {
+      if (animation_frame_at_ != animation::TimePoint::max()) {
+        if (Now() >= animation_frame_at_) {
+          animation_frame_at_ = animation::TimePoint::max();
+          frame_valid_ = false;
+        } else {
+          // Woken up earlier, for something else.
+          WakeUpAt(animation_frame_at_);
+        }
+      }
+      if (!animation_scheduled_) {
         return;
       }
 
-      animation_requested_ = false;
-      const animation::TimePoint now = animation::Clock::now();
+      animation_scheduled_ = false;
+      const animation::TimePoint now = Now();
       const animation::Duration delta = now - previous_animation_time_;
       previous_animation_time_ = now;
 
-      animation::Params params(delta);
-      component->OnAnimation(params);
+      // Far over budget, the animations jump to their end.
+      animation::Params params(animation_snap_ ? animation::Duration(3600.0)
+                                               : delta);
+      // Only the components having requested a frame need to be visited. The
+      // animators are stepped by the scheduler.
+      if (animation_requested_) {
+        animation_requested_ = false;
+        component->OnAnimation(params);
+      }
+      if (scheduler_->OnAnimation(params)) {
+        ScheduleAnimationFrame();
+      }
       frame_valid_ = false;
       return;
     }
@@ -670,84 +2607,218 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
   // clang-format on
 }
 
+// The size of the frame drawing a document of |requirement|, in a terminal of
+// size |terminal|.
+Dimensions ScreenInteractive::FrameDimensions(const Requirement& requirement,
+                                              Dimensions terminal) const {
+  switch (dimension_) {
+    case Dimension::Fixed:
+      return {fixed_dimx_, fixed_dimy_};
+    case Dimension::TerminalOutput:
+      return {terminal.dimx, requirement.min_y};
+    case Dimension::Fullscreen:
+      return terminal;
+    case Dimension::FitComponent:
+      return {std::min(requirement.min_x, terminal.dimx),
+              std::min(requirement.min_y, terminal.dimy)};
+  }
+  return terminal;
+}
+
+// See NonInteractiveOutput(). Nothing is written between the snapshots: the
+// frame remains invalid, and the loop wakes up when the next one is due.
+void ScreenInteractive::DrawPlainText(Component component) {
+  plain_text_component_ = component;
+  // The static elements are printed right away, like a log.
+  if (!static_elements_.empty()) {
+    Element document = vbox(std::move(static_elements_));
+    static_elements_.clear();
+    auto screen =
+        Screen::Create(ftxui::Dimension::Fixed(Terminal::CachedSize().dimx),
+                       ftxui::Dimension::Fit(document));
+    Render(screen, document);
+    std::string out = screen.ToPlainText();
+    out += '\n';
+    Write(out);
+    Flush();
+  }
+  if (snapshot_interval_.count() == 0) {
+    frame_valid_ = true;
+    return;
+  }
+  const animation::TimePoint now = Now();
+  if (now < next_snapshot_) {
+    WakeUpAt(next_snapshot_);
+    return;
+  }
+  next_snapshot_ = now + snapshot_interval_;
+  WritePlainText(std::move(component));
+  frame_valid_ = true;
+}
+
+// Write the frame of |component| as plain text. The frames follow each other,
+// instead of replacing the previous one.
+void ScreenInteractive::WritePlainText(Component component) {
+  Element document;
+  {
+    const ComponentBase::FocusCacheScope focus_scope;
+    const ObservableBase::ReadScope read_scope;
+    document = component->Render();
+  }
+  Measure(document.get());
+  const Dimensions dimensions =
+      FrameDimensions(document->requirement(), Terminal::CachedSize());
+  Resize(dimensions.dimx, dimensions.dimy);
+  Clear();
+  Render(*this, document.get(), nullptr, /*measured=*/true);
+
+  std::string& out = output_buffer_;
+  ToPlainText(out);
+  if (dimy_ != 0) {
+    out += '\n';
+  }
+  Write(out);
+  Flush();
+}
+
 // NOLINTNEXTLINE
 void ScreenInteractive::Draw(Component component) {
   if (frame_valid_) {
     return;
   }
-  auto document = component->Render();
+  if (plain_text_) {
+    DrawPlainText(std::move(component));
+    return;
+  }
+
+  // The terminal hasn't caught up with the previous frame yet. Drop this one.
+  // The frame remains invalid, so the latest state is drawn later, when the
+  // loop wakes up at the next frame boundary.
+  if ((threaded_output_ || pipelined_render_) &&
+      OutputSink::Stdout().Busy()) {
+    WakeUpLater();
+    return;
+  }
+
+  const animation::TimePoint draw_start = frame_budget_.count() != 0
+                                              ? animation::Clock::now()
+                                              : animation::TimePoint();
+  FrameStats stats = next_stats_;
+  next_stats_ = {};
+  Tracer* const tracer = tracer_;
+  // Whether the steps are measured, for KeepStats() or WatchSlowFrames().
+  const bool measure = stats_frames_ != 0 || slow_frame_callback_;
+  StepTimer timer(measure, tracer);
+  const Tracer::Clock::time_point frame_start =
+      tracer ? Tracer::Clock::now() : Tracer::Clock::time_point();
+  const size_t output_bytes = g_output_bytes;
+  g_output_breakdown = measure ? &stats.output : nullptr;
+
+  Element document;
+  mouse_motion_requested_ = false;
+  {
+    const KeyCache::Scope key_scope(&key_cache_);
+    const ComponentBase::FocusCacheScope focus_scope;
+    // The Observable accessed while rendering are read, not changed.
+    const ObservableBase::ReadScope read_scope;
+    if (arena_allocation_) {
+      // The Elements of the previous frame are destroyed by now.
+      frame_arena_.Reset();
+      const FrameArena::Scope scope(&frame_arena_);
+      document = component->Render();
+    } else {
+      document = component->Render();
+    }
+  }
   int dimx = 0;
   int dimy = 0;
-  auto terminal = Terminal::Size();
-  document->ComputeRequirement();
-  switch (dimension_) {
-    case Dimension::Fixed:
-      dimx = dimx_;
-      dimy = dimy_;
-      break;
-    case Dimension::TerminalOutput:
-      dimx = terminal.dimx;
-      dimy = document->requirement().min_y;
-      break;
-    case Dimension::Fullscreen:
-      dimx = terminal.dimx;
-      dimy = terminal.dimy;
-      break;
-    case Dimension::FitComponent:
-      dimx = std::min(document->requirement().min_x, terminal.dimx);
-      dimy = std::min(document->requirement().min_y, terminal.dimy);
-      break;
+  auto terminal = Terminal::CachedSize();
+  const LayoutPool::Scope layout_scope(layout_pool_.get());
+  const Profiler::Scope profiler_scope(profiler_.get());
+  timer.Lap(stats.render, "Render");
+  // Render() reuses this requirement, instead of computing it again.
+  Measure(document.get());
+  timer.Lap(stats.layout, "ComputeRequirement");
+  const Dimensions dimensions =
+      FrameDimensions(document->requirement(), terminal);
+  dimx = dimensions.dimx;
+  dimy = dimensions.dimy;
+
+  // The frame protocol encodes the frames without escape sequences.
+  const bool escape_sequences = !frame_encoder_;
+
+  // Switch between reporting all the mouse movements, and only the drags.
+  if (mouse_motion_on_demand_ && escape_sequences &&
+      mouse_motion_requested_ != mouse_motion_reported_) {
+    mouse_motion_reported_ = mouse_motion_requested_;
+    Write(mouse_motion_reported_
+              ? Set({DECMode::kMouseAnyEvent})
+              : Reset({DECMode::kMouseAnyEvent}) +
+                    Set({DECMode::kMouseBtnEventMouse}));
+  }
+  const bool synchronized_update = escape_sequences && synchronized_update_ &&
+                                   synchronized_update_supported_;
+  if (synchronized_update) {
+    Write(Set({DECMode::kSynchronizedUpdate}));
   }
 
   const bool resized = (dimx != dimx_) || (dimy != dimy_);
-  ResetCursorPosition();
-  std::cout << ResetPosition(/*clear=*/resized);
+  if (escape_sequences) {
+    ResetCursorPosition();
+    Write(ResetPosition(/*clear=*/resized));
+  }
 
   // Resize the screen if needed.
   if (resized) {
-    dimx_ = dimx;
-    dimy_ = dimy;
-    pixels_ = std::vector<std::vector<Pixel>>(dimy, std::vector<Pixel>(dimx));
-    cursor_.x = dimx_ - 1;
-    cursor_.y = dimy_ - 1;
-  }
-
-  // Periodically request the terminal emulator the frame position relative to
-  // the screen. This is useful for converting mouse position reported in
-  // screen's coordinates to frame's coordinates.
-#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
-  // Microsoft's terminal suffers from a [bug]. When reporting the cursor
-  // position, several output sequences are mixed together into garbage.
-  // This causes FTXUI user to see some "1;1;R" sequences into the Input
-  // component. See [issue]. Solution is to request cursor position less
-  // often. [bug]: https://github.com/microsoft/terminal/pull/7583 [issue]:
-  // https://github.com/ArthurSonzogni/FTXUI/issues/136
-  static int i = -3;
-  ++i;
-  if (!use_alternative_screen_ && (i % 150 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    Resize(dimx, dimy);
+    // The terminal has been cleared.
+    previous_row_hashes_.clear();
   }
-#else
-  static int i = -3;
-  ++i;
+  if (!static_elements_.empty()) {
+    PrintStaticElements();
+  }
+
+  // The frame only moves when the terminal scrolls, after the frame or the
+  // terminal were resized. Its position is requested after drawing it.
   if (!use_alternative_screen_ &&
-      (previous_frame_resized_ || i % 40 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+      (resized || terminal.dimx != terminal_dimx_ ||
+       terminal.dimy != terminal_dimy_)) {
+    cursor_report_stale_ = true;
+  }
+  terminal_dimx_ = terminal.dimx;
+  terminal_dimy_ = terminal.dimy;
+
+  if (hit_index_) {
+    hit_index_->Reset(dimx_, dimy_);
+  }
+  {
+    const HitIndex::Scope hit_index_scope(hit_index_.get());
+    RenderTimings timings;
+    timer.Skip();
+    Render(*this, document.get(), timer.enabled() ? &timings : nullptr,
+           /*measured=*/true);
+    timer.Lap(timings, stats);
+  }
+  if (profiler_) {
+    frame_profile_ = profiler_->TakeReport();
   }
-#endif
-  previous_frame_resized_ = resized;
 
-  Render(*this, document);
+  // Where ToString() leaves the cursor. When the frame is as wide as the
+  // terminal, the cursor stays on its last column.
+  const CursorPosition frame_end = {
+      dimx_ - 1 + int(dimx_ != terminal.dimx),
+      dimy_ - 1,
+  };
 
   // Set cursor position for user using tools to insert CJK characters.
   {
-    const int dx = dimx_ - 1 - cursor_.x + int(dimx_ != terminal.dimx);
-    const int dy = dimy_ - 1 - cursor_.y;
+    const CursorPosition cursor = {cursor_.x, cursor_.y};
+    const CursorMotion motion;
 
-    set_cursor_position = "\x1B[" + std::to_string(dy) + "A" +  //
-                          "\x1B[" + std::to_string(dx) + "D";
-    reset_cursor_position = "\x1B[" + std::to_string(dy) + "B" +  //
-                            "\x1B[" + std::to_string(dx) + "C";
+    set_cursor_position.clear();
+    motion.Move(set_cursor_position, frame_end, cursor);
+    reset_cursor_position.clear();
+    motion.Move(reset_cursor_position, cursor, frame_end);
 
     if (cursor_.shape == Cursor::Hidden) {
       set_cursor_position += "\033[?25l";
@@ -758,14 +2829,170 @@ void ScreenInteractive::Draw(Component component) {
     }
   }
 
-  std::cout << ToString() << set_cursor_position;
+  SetRunLengthOutput(run_length_output_,
+                     run_length_output_ && Terminal::RepeatSupport());
+  timer.Lap(stats.draw, "Cursor");
+  if (measure) {
+    stats.cells_changed = CellsChanged();
+    timer.Skip();
+  }
+  if (broadcast_) {
+    broadcast_->Publish(*this);
+    timer.Lap(stats.encode, "Broadcast");
+  }
+  const bool scroll = scroll_regions_ && capabilities_.scroll_region &&
+                      dimension_ == Dimension::Fullscreen;
+  if (pipelined_render_) {
+    // The writer thread encodes the frame from |pipeline_frame_|. It is idle
+    // until Flush(), see the check above.
+    pipeline_frame_.SetRunLengthOutput(
+        run_length_output_, run_length_output_ && Terminal::RepeatSupport());
+    SwapPixels(pipeline_frame_);
+    WriteDeferred([this, scroll](std::string& out) {
+      EncodeFrame(pipeline_frame_, scroll, out);
+    });
+  } else {
+    EncodeFrame(*this, scroll, output_buffer_);
+    timer.Lap(stats.encode, "Encode");
+    Write(output_buffer_);
+  }
+  // The terminal reports the mouse position relative to the screen, converted
+  // relative to the frame using the frame position. The position of the frame
+  // end is requested when the frame might have moved, unless a report is
+  // already awaited.
+  if (escape_sequences && !use_alternative_screen_ && cursor_report_stale_ &&
+      cursor_reports_pending_ == 0) {
+    Write(DeviceStatusReport(DSRMode::kCursor));
+    cursor_reports_pending_++;
+    cursor_report_x_ = frame_end.x;
+    cursor_report_y_ = frame_end.y;
+    cursor_report_stale_ = false;
+  }
+  if (escape_sequences) {
+    Write(set_cursor_position);
+  }
+  if (synchronized_update) {
+    Write(Reset({DECMode::kSynchronizedUpdate}));
+  }
   Flush();
+  timer.Lap(stats.write, "Write");
   Clear();
   frame_valid_ = true;
+  previous_draw_time_ = Now();
+  input_deadline_ = animation::TimePoint::max();
+  resize_pending_ = false;
+  if (frame_budget_.count() != 0) {
+    UpdateAnimationQuality(animation::Clock::now() - draw_start);
+  }
+
+  if (tracer) {
+    tracer->Span(Tracer::Thread::Loop, "Frame", frame_start,
+                 Tracer::Clock::now());
+  }
+  g_output_breakdown = nullptr;
+  stats.output_bytes = g_output_bytes - output_bytes;
+  if (slow_frame_callback_) {
+    const auto duration = stats.events + stats.render + stats.layout +
+                          stats.draw + stats.shaders + stats.encode +
+                          stats.write;
+    if (duration >= slow_frame_threshold_) {
+      SlowFrame frame;
+      frame.duration = duration;
+      frame.stats = stats;
+      frame.tree = DescribeTree(*document);
+      frame.profile = frame_profile_;
+      // The callback might stop watching.
+      const auto callback = slow_frame_callback_;
+      callback(frame);
+    }
+  }
+  if (stats_frames_ != 0) {
+    if (stats_.size() == stats_frames_) {
+      stats_.pop_front();
+    }
+    stats_.push_back(stats);
+  }
+}
+
+// The number of cells differing from the frame displayed by the terminal. The
+// damage tracking knows it exactly, the row damage tracking by whole rows.
+size_t ScreenInteractive::CellsChanged() const {
+  const size_t cells = size_t(dimx_) * size_t(dimy_);
+  if (track_damage_) {
+    if (previous_frame_.dimx() != dimx_ || previous_frame_.dimy() != dimy_) {
+      return cells;
+    }
+    size_t changed = 0;
+    for (int y = 0; y < dimy_; ++y) {
+      const auto row = Row(y);
+      const auto previous_row = previous_frame_.Row(y);
+      for (int x = 0; x < dimx_; ++x) {
+        changed += size_t(!(row[x] == previous_row[x]));
+      }
+    }
+    return changed;
+  }
+  if (track_row_damage_) {
+    if (previous_row_hashes_.size() != size_t(dimy_)) {
+      return cells;
+    }
+    size_t changed = 0;
+    for (int y = 0; y < dimy_; ++y) {
+      if (RowHash(y) != previous_row_hashes_[y]) {
+        changed += size_t(dimx_);
+      }
+    }
+    return changed;
+  }
+  return cells;
+}
+
+// Convert |frame| into |out|, updating the frame the terminal displays. With
+// the damage tracking, |frame| is then swapped with |previous_frame_|.
+void ScreenInteractive::EncodeFrame(Screen& frame,
+                                    bool scroll,
+                                    std::string& out) {
+  if (frame_encoder_) {
+    out.clear();
+    frame_encoder_->Encode(frame, out);
+  } else if (track_damage_) {
+    if (scroll) {
+      frame.ToStringScrollDiff(previous_frame_, /*top=*/0, out);
+    } else {
+      frame.ToStringDiff(previous_frame_, out);
+    }
+    // |previous_frame_| becomes the front buffer, holding this frame. |frame|
+    // becomes the back buffer.
+    frame.SwapPixels(previous_frame_);
+  } else if (track_row_damage_) {
+    frame.ToStringRowDiff(previous_row_hashes_, row_hashes_, out);
+    std::swap(previous_row_hashes_, row_hashes_);
+  } else {
+    frame.ToString(out);
+  }
+}
+
+// Print the elements of PrintStatic() where the frame starts. The frame is then
+// drawn entirely, below them.
+void ScreenInteractive::PrintStaticElements() {
+  Element document = vbox(std::move(static_elements_));
+  static_elements_.clear();
+  if (frame_encoder_ || use_alternative_screen_) {
+    return;
+  }
+  auto screen = Screen::Create(ftxui::Dimension::Fixed(dimx_),
+                               ftxui::Dimension::Fit(document));
+  Render(screen, document);
+  Write("\x1B[J");  // Clear the previous frame.
+  Write(screen.ToString());
+  Write("\r\n");
+  previous_frame_ = Screen(0, 0);
+  previous_row_hashes_.clear();
+  cursor_report_stale_ = true;
 }
 
 void ScreenInteractive::ResetCursorPosition() {
-  std::cout << reset_cursor_position;
+  Write(reset_cursor_position);
   reset_cursor_position = "";
 }
 
@@ -780,6 +3007,27 @@ void ScreenInteractive::Exit() {
 void ScreenInteractive::ExitNow() {
   quit_ = true;
   task_sender_.reset();
+  input_parser_.reset();
+  {
+    // Don't notify the animation listener between its check of |quit_| and
+    // its wait.
+    const std::lock_guard<std::mutex> lock(animation_mutex_);
+  }
+  animation_wake_.notify_all();
+#if defined(_WIN32)
+  // Interrupt the input listener, waiting for the console.
+  if (exit_event_) {
+    SetEvent(static_cast<HANDLE>(exit_event_));
+  }
+#elif !defined(__EMSCRIPTEN__)
+  // Interrupt the input listener, waiting for the terminal.
+  if (wakeup_[1] >= 0) {
+    const char c = 0;
+    std::ignore = write(wakeup_[1], &c, 1);
+  }
+#elif defined(__EMSCRIPTEN__)
+  quit_.notify_all();
+#endif
 }
 
 void ScreenInteractive::Signal(int signal) {
@@ -793,7 +3041,7 @@ void ScreenInteractive::Signal(int signal) {
   if (signal == SIGTSTP) {
     Post([&] {
       ResetCursorPosition();
-      std::cout << ResetPosition(/*clear*/ true);  // Cursor to the beginning
+      Write(ResetPosition(/*clear*/ true));  // Cursor to the beginning
       Uninstall();
       dimx_ = 0;
       dimy_ = 0;
@@ -805,6 +3053,12 @@ void ScreenInteractive::Signal(int signal) {
   }
 
   if (signal == SIGWINCH) {
+    const Dimensions size = Terminal::Size();
+    InputRecording::Entry entry;
+    entry.dimx = size.dimx;
+    entry.dimy = size.dimy;
+    RecordEntry(std::move(entry));
+    DebounceResize();
     Post(Event::Special({0}));
     return;
   }
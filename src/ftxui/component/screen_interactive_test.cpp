@@ -1,10 +1,29 @@
 #include <gtest/gtest.h>
 #include <csignal>  // for raise, SIGABRT, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM
 #include <ftxui/component/event.hpp>  // for Event, Event::Custom
+#include <array>                      // for array
+#include <atomic>                     // for atomic
+#include <chrono>                      // for milliseconds
+#include <cstdlib>                    // for getenv, setenv
+#include <memory>                     // for make_unique
+#include <string>                     // for string
+#include <thread>                     // for thread, sleep_for
+#include <vector>                     // for vector
 
-#include "ftxui/component/component.hpp"  // for Renderer
+#include "ftxui/component/animation.hpp"  // for RequestAnimationFrame, Params
+#include "ftxui/component/component.hpp"  // for Renderer, CatchEvent, Hoverable, Maybe
+#include "ftxui/component/input_recording.hpp"  // for InputRecording, ReplayReport
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/mouse.hpp"      // for Mouse
 #include "ftxui/component/screen_interactive.hpp"
 #include "ftxui/dom/elements.hpp"  // for text, Element
+#include "ftxui/screen/frame_protocol.hpp"  // for FrameDecoder
+#include "ftxui/screen/terminal.hpp"        // for Capabilities, GetCapabilities
+
+#if !defined(_WIN32)
+#include <poll.h>    // for poll, pollfd, POLLIN
+#include <unistd.h>  // for dup, dup2, pipe, read, close, STDOUT_FILENO
+#endif
 
 namespace ftxui {
 
@@ -60,6 +79,918 @@ TEST(ScreenInteractive, PostTaskToNonActive) {
   screen.Post([] {});
 }
 
+TEST(ScreenInteractive, AnimationFrame) {
+  class Animated : public ComponentBase {
+   public:
+    explicit Animated(ScreenInteractive* screen) : screen_(screen) {}
+    Element Render() override {
+      animation::RequestAnimationFrame();
+      return text("");
+    }
+    void OnAnimation(animation::Params& /*params*/) override {
+      if (++frames == 3) {
+        screen_->Exit();
+      }
+    }
+    int frames = 0;
+
+   private:
+    ScreenInteractive* screen_;
+  };
+
+  auto screen = ScreenInteractive::FitComponent();
+  screen.AnimationFrameRate(200);
+  auto component = std::make_shared<Animated>(&screen);
+  screen.Loop(component);
+  EXPECT_EQ(component->frames, 3);
+}
+
+TEST(ScreenInteractive, CoalesceEvents) {
+  std::vector<Mouse> mouses;
+  auto component = CatchEvent(Renderer([] { return text(""); }),
+                              [&](Event event) {
+                                if (event.is_mouse()) {
+                                  mouses.push_back(event.mouse());
+                                }
+                                return false;
+                              });
+
+  auto screen = ScreenInteractive::FixedSize(10, 10);
+  screen.CoalesceEvents();
+  Loop loop(&screen, component);
+
+  // Moves, a press, drags with the left button, and a release.
+  for (const char* input : {
+           "\x1b[<35;1;1M",
+           "\x1b[<35;2;1M",
+           "\x1b[<35;3;1M",
+           "\x1b[<0;3;1M",
+           "\x1b[<32;4;1M",
+           "\x1b[<32;5;1M",
+           "\x1b[<0;5;1m",
+       }) {
+    screen.PostEvent(Event::Mouse(input, Mouse{}));
+  }
+  // Posted from a task, after the mouse events have been drained.
+  screen.Post([&] { screen.PostEvent(Event::Mouse("\x1b[<35;6;1M", Mouse{})); });
+  loop.RunOnce();
+
+  ASSERT_EQ(mouses.size(), 5u);
+}
+
+TEST(ScreenInteractive, PriorityLanes) {
+  std::vector<std::string> handled;
+  int renders = 0;
+  auto component = CatchEvent(Renderer([&] {
+                                renders++;
+                                return text("");
+                              }),
+                              [&](const Event& event) {
+                                if (!event.is_character()) {
+                                  return false;
+                                }
+                                handled.push_back(event.character());
+                                return true;
+                              });
+
+  auto screen = ScreenInteractive::Headless(10, 2);
+  screen.PriorityLanes(true, std::chrono::milliseconds(1));
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  renders = 0;
+
+  // A burst of slow closures, then a keystroke.
+  for (int i = 0; i < 3; ++i) {
+    screen.Post([&, i] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      handled.push_back(std::to_string(i));
+    });
+  }
+  screen.PostEvent(Event::Character('a'));
+
+  // The keystroke first. The closures exceeding the budget wait for the next
+  // frames, in order.
+  loop.RunOnce();
+  EXPECT_EQ(handled, (std::vector<std::string>{"a", "0"}));
+  EXPECT_EQ(renders, 1);
+  EXPECT_FALSE(loop.HasQuitted());
+  screen.PostEvent(Event::Character('b'));
+  loop.RunOnce();
+  EXPECT_EQ(handled, (std::vector<std::string>{"a", "0", "b", "1"}));
+  loop.RunOnce();
+  EXPECT_EQ(handled, (std::vector<std::string>{"a", "0", "b", "1", "2"}));
+  EXPECT_EQ(renders, 2);
+}
+
+TEST(ScreenInteractive, MaxFrameRate) {
+  int renders = 0;
+  auto component = Renderer([&] {
+    renders++;
+    return text("");
+  });
+
+  auto screen = ScreenInteractive::FixedSize(10, 10);
+  screen.MaxFrameRate(1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+
+  // Delayed until the end of the second.
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+
+  // The keyboard input is drawn immediately.
+  screen.PostEvent(Event::Character('a'));
+  loop.RunOnce();
+  EXPECT_EQ(renders, 2);
+}
+
+TEST(ScreenInteractive, ResizeDebounce) {
+  int renders = 0;
+  auto component = Renderer([&] {
+    renders++;
+    return text("");
+  });
+
+  auto screen = ScreenInteractive::Headless(10, 2);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+
+  // A burst of resizes is drawn once, at the latest size.
+  screen.Post([&] { screen.SetDimensions(12, 3); });
+  loop.RunOnce();
+  screen.AdvanceTime(std::chrono::milliseconds(5));
+  screen.Post([&] { screen.SetDimensions(14, 4); });
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+  screen.AdvanceTime(std::chrono::milliseconds(20));
+  loop.RunOnce();
+  EXPECT_EQ(renders, 2);
+  EXPECT_EQ(screen.dimx(), 14);
+  EXPECT_EQ(screen.dimy(), 4);
+
+  screen.ResizeDebounce(std::chrono::milliseconds(0));
+  screen.Post([&] { screen.SetDimensions(10, 2); });
+  loop.RunOnce();
+  EXPECT_EQ(renders, 3);
+  EXPECT_EQ(screen.dimx(), 10);
+}
+
+TEST(ScreenInteractive, FrameBudget) {
+  float value = 0.F;
+  animation::Animator animator(&value, 0.F);
+  // Every frame takes at least 100us, so that it exceeds the smallest budgets
+  // regardless of the machine speed.
+  auto component = Renderer([&] {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    return text(std::to_string(value));
+  });
+
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(screen.AnimationSlowdown(), 1);
+
+  // Within budget, the animation progresses smoothly.
+  screen.FrameBudget(std::chrono::seconds(10));
+  screen.Post([&] {
+    animator = animation::Animator(&value, 1.F, std::chrono::seconds(1));
+    screen.RequestAnimationFrame();
+  });
+  loop.RunOnce();
+  screen.AdvanceTime(std::chrono::milliseconds(20));
+  loop.RunOnce();
+  EXPECT_GT(value, 0.F);
+  EXPECT_LT(value, 1.F);
+  EXPECT_EQ(screen.AnimationSlowdown(), 1);
+
+  // No frame can be drawn within a microsecond: the animation jumps to its
+  // end.
+  screen.FrameBudget(std::chrono::microseconds(1));
+  screen.Post([&] { screen.RequestAnimationFrame(); });
+  loop.RunOnce();
+  EXPECT_EQ(screen.AnimationSlowdown(), 4);
+  screen.AdvanceTime(std::chrono::milliseconds(100));
+  loop.RunOnce();
+  EXPECT_EQ(value, 1.F);
+
+  screen.FrameBudget(std::chrono::microseconds(0));
+  EXPECT_EQ(screen.AnimationSlowdown(), 1);
+}
+
+TEST(ScreenInteractive, MouseMotionOnDemand) {
+  bool show = false;
+  bool hover = false;
+  auto component = Maybe(Hoverable(Renderer([] { return text("x"); }), &hover),
+                         &show);
+
+  auto screen = ScreenInteractive::Headless(10, 1);
+  screen.MouseMotionOnDemand();
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  const std::string drags_only = "\x1B[?1003l\x1B[?1002h";
+  EXPECT_NE(screen.TakeOutput().find(drags_only), std::string::npos);
+
+  // A Hoverable is shown: every movement is reported.
+  show = true;
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_NE(screen.TakeOutput().find("\x1B[?1003h"), std::string::npos);
+
+  // The mode is only written when it changes.
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(screen.TakeOutput().find("\x1B[?1003"), std::string::npos);
+
+  show = false;
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_NE(screen.TakeOutput().find(drags_only), std::string::npos);
+}
+
+TEST(ScreenInteractive, RedrawOnlyHandledEvents) {
+  int renders = 0;
+  auto component = CatchEvent(Renderer([&] {
+                                renders++;
+                                return text("");
+                              }),
+                              [](Event event) { return event.is_character(); });
+
+  auto screen = ScreenInteractive::FixedSize(10, 10);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+
+  // Not handled.
+  screen.PostEvent(Event::Mouse("\x1b[<35;1;1M", Mouse{}));
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+
+  screen.PostEvent(Event::Character('a'));
+  loop.RunOnce();
+  EXPECT_EQ(renders, 2);
+
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(renders, 3);
+
+  screen.RequestRedraw();
+  screen.RequestRedraw();
+  loop.RunOnce();
+  EXPECT_EQ(renders, 4);
+}
+
+TEST(ScreenInteractive, PostBatch) {
+  std::vector<int> order;
+  auto component = CatchEvent(Renderer([] { return text(""); }),
+                              [&](Event event) {
+                                if (event.is_character()) {
+                                  order.push_back(-1);
+                                }
+                                return false;
+                              });
+
+  auto screen = ScreenInteractive::FixedSize(10, 10);
+  Loop loop(&screen, component);
+
+  std::vector<Task> tasks;
+  // Move-only captures are allowed.
+  auto value = std::make_unique<int>(1);
+  tasks.emplace_back([&, value = std::move(value)] { order.push_back(*value); });
+  tasks.emplace_back(Event::Character('a'));
+  // Bigger than the inline buffer.
+  std::array<int, 32> big = {2};
+  tasks.emplace_back([&, big] { order.push_back(big[0]); });
+  screen.PostBatch(tasks);
+  loop.RunOnce();
+
+  EXPECT_EQ(order, (std::vector<int>{1, -1, 2}));
+}
+
+TEST(ScreenInteractive, InputStatistics) {
+  auto screen = ScreenInteractive::FixedSize(10, 10);
+  const auto statistics = screen.InputStatistics();
+  EXPECT_EQ(statistics.buffer_size, 64u * 1024u);
+  EXPECT_EQ(statistics.reads, 0u);
+  EXPECT_EQ(statistics.bytes, 0u);
+}
+
+TEST(ScreenInteractive, InputRecordingSerialize) {
+  InputRecording recording;
+  recording.entries.resize(2);
+  recording.entries[0].time = std::chrono::microseconds(12);
+  recording.entries[0].input = "a\x1b[A\n";
+  recording.entries[1].time = std::chrono::microseconds(345);
+  recording.entries[1].dimx = 80;
+  recording.entries[1].dimy = 24;
+
+  const std::string serialized = recording.Serialize();
+  EXPECT_EQ(serialized, "12 input 611b5b410a\n345 resize 80 24\n");
+
+  // The malformed lines are skipped.
+  const InputRecording parsed =
+      InputRecording::Parse(serialized + "7 input 6\ngarbage\n");
+  ASSERT_EQ(parsed.entries.size(), 2u);
+  EXPECT_EQ(parsed.entries[0].time, std::chrono::microseconds(12));
+  EXPECT_EQ(parsed.entries[0].input, "a\x1b[A\n");
+  EXPECT_TRUE(parsed.entries[1].is_resize());
+  EXPECT_EQ(parsed.entries[1].dimx, 80);
+  EXPECT_EQ(parsed.entries[1].dimy, 24);
+}
+
+TEST(ScreenInteractive, Replay) {
+  std::string typed;
+  int escapes = 0;
+  auto component = CatchEvent(Renderer([&] { return text(typed); }),
+                              [&](Event event) {
+                                if (event.is_character()) {
+                                  typed += event.character();
+                                  return true;
+                                }
+                                if (event == Event::Escape) {
+                                  escapes++;
+                                  return true;
+                                }
+                                return false;
+                              });
+
+  InputRecording recording;
+  recording.entries.resize(5);
+  recording.entries[0].input = "ab";
+  // Not handled, no frame is drawn.
+  recording.entries[1].time = std::chrono::milliseconds(1);
+  recording.entries[1].input = "\x1b[<35;1;1M";
+  // A lone escape, timed out by the time of the next entry.
+  recording.entries[2].time = std::chrono::milliseconds(2);
+  recording.entries[2].input = "\x1b";
+  recording.entries[3].time = std::chrono::milliseconds(200);
+  recording.entries[3].dimx = 20;
+  recording.entries[3].dimy = 3;
+  recording.entries[4].time = std::chrono::milliseconds(201);
+  recording.entries[4].input = "c";
+
+  auto screen = ScreenInteractive::FixedSize(10, 2);
+  const ReplayReport report = screen.Replay(component, recording);
+
+  EXPECT_EQ(typed, "abc");
+  EXPECT_EQ(escapes, 1);
+  EXPECT_EQ(screen.dimx(), 20);
+  EXPECT_EQ(screen.dimy(), 3);
+
+  ASSERT_EQ(report.frames.size(), 3u);
+  EXPECT_EQ(report.frames[0].entry, 0u);
+  EXPECT_EQ(report.frames[1].entry, 3u);
+  EXPECT_EQ(report.frames[2].entry, 4u);
+  for (const auto& frame : report.frames) {
+    EXPECT_GT(frame.output_bytes, 0u);
+  }
+}
+
+TEST(ScreenInteractive, Headless) {
+  std::string typed;
+  int escapes = 0;
+  int animations = 0;
+  class Animated : public ComponentBase {
+   public:
+    Animated(std::string* typed, int* escapes, int* animations)
+        : typed_(typed), escapes_(escapes), animations_(animations) {}
+    Element Render() override {
+      if (*animations_ < 2) {
+        animation::RequestAnimationFrame();
+      }
+      return text(*typed_);
+    }
+    bool OnEvent(Event event) override {
+      if (event.is_character()) {
+        *typed_ += event.character();
+        return true;
+      }
+      if (event == Event::Escape) {
+        (*escapes_)++;
+        return true;
+      }
+      return false;
+    }
+    void OnAnimation(animation::Params& /*params*/) override {
+      (*animations_)++;
+    }
+
+   private:
+    std::string* typed_;
+    int* escapes_;
+    int* animations_;
+  };
+  auto component = Make<Animated>(&typed, &escapes, &animations);
+
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_NE(screen.TakeOutput(), "");
+  EXPECT_EQ(screen.TakeOutput(), "");
+
+  screen.FeedInput("ab");
+  loop.RunOnce();
+  EXPECT_EQ(typed, "ab");
+  EXPECT_NE(screen.TakeOutput().find("ab"), std::string::npos);
+
+  // The animation frames follow the virtual clock.
+  EXPECT_EQ(animations, 0);
+  loop.RunOnce();
+  EXPECT_EQ(animations, 0);
+  screen.AdvanceTime(std::chrono::milliseconds(20));
+  loop.RunOnce();
+  EXPECT_EQ(animations, 1);
+  screen.AdvanceTime(std::chrono::milliseconds(20));
+  loop.RunOnce();
+  EXPECT_EQ(animations, 2);
+  screen.AdvanceTime(std::chrono::milliseconds(20));
+  loop.RunOnce();
+  EXPECT_EQ(animations, 2);
+
+  // A lone escape times out.
+  screen.FeedInput("\x1b");
+  loop.RunOnce();
+  EXPECT_EQ(escapes, 0);
+  screen.AdvanceTime(std::chrono::milliseconds(100));
+  loop.RunOnce();
+  EXPECT_EQ(escapes, 1);
+
+  screen.Exit();
+  loop.RunOnce();
+  EXPECT_TRUE(loop.HasQuitted());
+}
+
+TEST(ScreenInteractive, Stats) {
+  std::string typed;
+  auto component = CatchEvent(Renderer([&] { return text(typed); }),
+                              [&](Event event) {
+                                if (event.is_character()) {
+                                  typed += event.character();
+                                  return true;
+                                }
+                                return false;
+                              });
+
+  auto screen = ScreenInteractive::Headless(10, 2);
+  screen.TrackDamage();
+  screen.KeepStats(2);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  ASSERT_EQ(screen.Stats().size(), 1u);
+  EXPECT_EQ(screen.Stats()[0].cells_changed, 20u);
+  EXPECT_EQ(screen.TakeOutput().size(), screen.Stats()[0].output_bytes);
+
+  screen.FeedInput("abc");
+  loop.RunOnce();
+  auto stats = screen.Stats();
+  ASSERT_EQ(stats.size(), 2u);
+  EXPECT_EQ(stats[1].tasks, 3u);
+  EXPECT_EQ(stats[1].queue_depth, 3u);
+  EXPECT_EQ(stats[1].cells_changed, 3u);
+  EXPECT_GT(stats[1].events.count(), 0);
+  EXPECT_GT(stats[1].render.count(), 0);
+  EXPECT_GT(stats[1].encode.count(), 0);
+  EXPECT_EQ(screen.TakeOutput().size(), stats[1].output_bytes);
+  EXPECT_EQ(stats[1].output.total(), stats[1].output_bytes);
+  EXPECT_GE(stats[1].output.glyphs, 3u);
+
+  // Only the last frames are kept.
+  screen.FeedInput("d");
+  loop.RunOnce();
+  stats = screen.Stats();
+  ASSERT_EQ(stats.size(), 2u);
+  EXPECT_EQ(stats[1].tasks, 1u);
+  EXPECT_EQ(stats[1].cells_changed, 1u);
+}
+
+TEST(ScreenInteractive, PasteAsTyped) {
+  std::string typed;
+  int returns = 0;
+  auto component = CatchEvent(Renderer([&] { return text(typed); }),
+                              [&](Event event) {
+                                if (event.is_character()) {
+                                  typed += event.character();
+                                  return true;
+                                }
+                                if (event == Event::Return) {
+                                  returns++;
+                                  return true;
+                                }
+                                return false;
+                              });
+
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+
+  // The component ignores Event::Paste: the text is received as if typed.
+  screen.FeedInput("\x1B[200~ab\r\ncé\x1B[201~");
+  loop.RunOnce();
+  EXPECT_EQ(typed, "abcé");
+  EXPECT_EQ(returns, 1);
+  EXPECT_NE(screen.TakeOutput().find("abcé"), std::string::npos);
+}
+
+TEST(ScreenInteractive, PipelinedRender) {
+  auto run = [](bool pipelined) {
+    std::string typed;
+    auto component = CatchEvent(Renderer([&] { return text(typed); }),
+                                [&](Event event) {
+                                  if (event.is_character()) {
+                                    typed += event.character();
+                                    return true;
+                                  }
+                                  return false;
+                                });
+    auto screen = ScreenInteractive::Headless(10, 2);
+    screen.TrackDamage();
+    screen.PipelinedRender(pipelined);
+    Loop loop(&screen, component);
+    std::vector<std::string> frames;
+    loop.RunOnce();
+    frames.push_back(screen.TakeOutput());
+    for (const char* input : {"abc", "d", "e"}) {
+      screen.FeedInput(input);
+      loop.RunOnce();
+      frames.push_back(screen.TakeOutput());
+    }
+    return frames;
+  };
+
+  // The frames are encoded from the pixels handed over, identically.
+  const auto frames = run(/*pipelined=*/true);
+  EXPECT_EQ(frames, run(/*pipelined=*/false));
+  EXPECT_NE(frames[1].find("abc"), std::string::npos);
+  EXPECT_EQ(frames[2].find("abc"), std::string::npos);
+}
+
+TEST(ScreenInteractive, PrintStatic) {
+  std::string live = "live";
+  auto component = Renderer([&] { return text(live); });
+  auto screen = ScreenInteractive::Headless(6, 1);
+  screen.TrackDamage();
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  screen.TakeOutput();
+
+  // The static lines are printed once, above the frame, drawn again entirely.
+  screen.PrintStatic(vbox({text("done 1"), text("done 2")}));
+  loop.RunOnce();
+  const std::string output = screen.TakeOutput();
+  const size_t done_1 = output.find("done 1");
+  const size_t done_2 = output.find("done 2");
+  const size_t frame = output.find("live");
+  ASSERT_NE(done_1, std::string::npos);
+  ASSERT_NE(done_2, std::string::npos);
+  ASSERT_NE(frame, std::string::npos);
+  EXPECT_LT(done_1, done_2);
+  EXPECT_LT(done_2, frame);
+
+  live = "live 2";
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  const std::string next = screen.TakeOutput();
+  EXPECT_EQ(next.find("done"), std::string::npos);
+  EXPECT_NE(next.find('2'), std::string::npos);
+}
+
+TEST(ScreenInteractive, WatchSlowFrames) {
+  auto component = Renderer([] {
+    return vbox({text("a"), text("b"), text("c")}) | border;
+  });
+  auto screen = ScreenInteractive::Headless(5, 5);
+  Loop loop(&screen, component);
+
+  std::vector<ScreenInteractive::SlowFrame> frames;
+  screen.WatchSlowFrames(std::chrono::microseconds(0),
+                         [&](const auto& frame) { frames.push_back(frame); });
+  loop.RunOnce();
+  ASSERT_EQ(frames.size(), 1u);
+  EXPECT_EQ(frames[0].tree.nodes, 5u);
+  EXPECT_EQ(frames[0].tree.depth, 3);
+  EXPECT_GT(frames[0].stats.output_bytes, 0u);
+  EXPECT_NE(frames[0].ToString().find("Text 3"), std::string::npos);
+
+  // The frames faster than the threshold are not reported.
+  screen.WatchSlowFrames(std::chrono::hours(1),
+                         [&](const auto& frame) { frames.push_back(frame); });
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(frames.size(), 1u);
+}
+
+TEST(ScreenInteractive, CursorPositionReport) {
+  Mouse mouse;
+  auto component = CatchEvent(Renderer([] { return text("hello"); }),
+                              [&](Event event) {
+                                if (event.is_mouse()) {
+                                  mouse = event.mouse();
+                                  return true;
+                                }
+                                return false;
+                              });
+
+  const std::string request = "\x1B[6n";
+  auto screen = ScreenInteractive::Headless(5, 2);
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_NE(screen.TakeOutput().find(request), std::string::npos);
+
+  // The frame didn't move: its position isn't requested again.
+  screen.Post(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(screen.TakeOutput().find(request), std::string::npos);
+
+  // The frame ends on the row 7, column 15: it starts on the row 6, column 10.
+  screen.FeedInput("\x1B[7;15R");
+  screen.FeedInput("\x1B[<0;12;7M");
+  loop.RunOnce();
+  EXPECT_EQ(mouse.x, 2);
+  EXPECT_EQ(mouse.y, 1);
+  EXPECT_EQ(screen.TakeOutput().find(request), std::string::npos);
+}
+
+TEST(ScreenInteractive, ProbeTerminal) {
+  // The capabilities are recorded per $TERM. Use a name of our own.
+  const char* term = std::getenv("TERM");
+  const std::string previous_term = term ? term : "";
+  const bool previous_repeat = Terminal::RepeatSupport();
+  const Terminal::Color previous_color = Terminal::ColorSupport();
+  setenv("TERM", "ftxui-probe-test", 1);
+
+  int events = 0;
+  auto component = CatchEvent(Renderer([] { return text("hello"); }),
+                              [&](const Event&) {
+                                events++;
+                                return false;
+                              });
+
+  auto screen = ScreenInteractive::Headless(5, 2);
+  screen.ProbeTerminal();
+  {
+    Loop loop(&screen, component);
+    loop.RunOnce();
+    const std::string output = screen.TakeOutput();
+    EXPECT_NE(output.find("\x1B[>0q"), std::string::npos);
+    EXPECT_NE(output.find("\x1B[?2026$p"), std::string::npos);
+    EXPECT_NE(output.find("\x1B[>c"), std::string::npos);
+    EXPECT_FALSE(screen.Capabilities().probed);
+
+    screen.FeedInput("\x1BP>|XTerm(390)\x1B\\");
+    screen.FeedInput("\x1B[?2026;2$y\x1B[?2004;1$y");
+    screen.FeedInput("\x1B[>41;390;0c\x1B[?64;1;22c");
+    loop.RunOnce();
+  }
+
+  // The replies don't reach the components.
+  EXPECT_EQ(events, 0);
+  const Terminal::Capabilities capabilities = Terminal::GetCapabilities();
+  EXPECT_TRUE(capabilities.probed);
+  EXPECT_TRUE(capabilities.synchronized_update);
+  EXPECT_TRUE(capabilities.bracketed_paste);
+  EXPECT_TRUE(capabilities.repeat);
+  EXPECT_TRUE(capabilities.true_color);
+  EXPECT_EQ(capabilities.device_type, 41);
+  EXPECT_EQ(capabilities.version, "XTerm(390)");
+  EXPECT_TRUE(screen.Capabilities().probed);
+
+  // The next screens don't probe the same terminal again.
+  {
+    auto next = ScreenInteractive::Headless(5, 2);
+    next.ProbeTerminal();
+    Loop loop(&next, component);
+    loop.RunOnce();
+    EXPECT_EQ(next.TakeOutput().find("\x1B[>0q"), std::string::npos);
+    EXPECT_TRUE(next.Capabilities().probed);
+  }
+
+  setenv("TERM", previous_term.c_str(), 1);
+  Terminal::SetRepeatSupport(previous_repeat);
+  Terminal::SetColorSupport(previous_color);
+}
+
+TEST(ScreenInteractive, UpdateState) {
+  std::array<int, 2> prices = {0, 0};
+  int updates = 0;
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, Renderer([&] {
+              return text(std::to_string(prices[0]) + " " +
+                          std::to_string(prices[1]));
+            }));
+  loop.RunOnce();
+
+  std::thread([&] {
+    for (int i = 1; i <= 100; ++i) {
+      screen.UpdateState(&prices[i % 2], [&prices, &updates, i] {
+        prices[i % 2] = i;
+        updates++;
+      });
+    }
+  }).join();
+  loop.RunOnce();
+
+  // The last update of every key, only.
+  EXPECT_EQ(prices[0], 100);
+  EXPECT_EQ(prices[1], 99);
+  EXPECT_EQ(updates, 2);
+  EXPECT_NE(screen.TakeOutput().find("100 99"), std::string::npos);
+}
+
+TEST(ScreenInteractive, RunAsync) {
+  auto screen = ScreenInteractive::Headless(10, 1);
+  Loop loop(&screen, Renderer([] { return text("hello"); }));
+
+  std::atomic<int> worked = 0;
+  std::vector<int> done;
+  for (int i = 0; i < 16; ++i) {
+    screen.RunAsync([&] { worked++; }, [&done, i] { done.push_back(i); });
+  }
+  screen.RunAsync([&] { worked++; });
+
+  // The completions are delivered by the loop, in batches.
+  for (int i = 0; i < 1000 && done.size() < 16; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    loop.RunOnce();
+  }
+  EXPECT_EQ(worked, 17);
+  EXPECT_EQ(done.size(), 16u);
+}
+
+#if !defined(_WIN32)
+TEST(ScreenInteractive, FrameProtocol) {
+  std::string typed = "a";
+  auto component = CatchEvent(Renderer([&] { return text(typed); }),
+                              [&](Event event) {
+                                typed += event.character();
+                                return true;
+                              });
+
+  auto screen = ScreenInteractive::Session(4, 2);
+  screen.FrameProtocol();
+  Loop loop(&screen, component);
+  loop.RunOnce();
+
+  // No escape sequence: only the messages of the protocol.
+  FrameDecoder decoder;
+  std::string output = screen.TakeOutput();
+  EXPECT_EQ(output.find('\x1B'), std::string::npos);
+  std::string_view input = output;
+  EXPECT_TRUE(decoder.Decode(input));
+  EXPECT_TRUE(input.empty());
+  EXPECT_EQ(decoder.screen().Row(0)[0].character, "a");
+
+  screen.FeedInput("b");
+  loop.RunOnce();
+  output = screen.TakeOutput();
+  input = output;
+  EXPECT_TRUE(decoder.Decode(input));
+  EXPECT_EQ(decoder.screen().Row(0)[1].character, "b");
+}
+
+// Every screen steps only the animators created while it is active.
+TEST(ScreenInteractive, SessionAnimators) {
+  class Animated : public ComponentBase {
+   public:
+    explicit Animated(float* value) : value_(value) {}
+    Element Render() override { return text("x"); }
+    bool OnEvent(Event event) override {
+      if (!event.is_character()) {
+        return false;
+      }
+      animator_ = animation::Animator(value_, 1.F,
+                                      std::chrono::milliseconds(50));
+      return true;
+    }
+
+   private:
+    float* value_;
+    animation::Animator animator_{value_};
+  };
+
+  float value_a = 0.F;
+  float value_b = 0.F;
+  auto screen_a = ScreenInteractive::Session(4, 1);
+  auto screen_b = ScreenInteractive::Session(4, 1);
+  Loop loop_a(&screen_a, Make<Animated>(&value_a));
+  Loop loop_b(&screen_b, Make<Animated>(&value_b));
+  screen_a.FeedInput("a");
+  loop_a.RunOnce();
+  screen_b.FeedInput("b");
+  loop_b.RunOnce();
+
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (value_b != 1.F && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    screen_b.Tick();
+    loop_b.RunOnce();
+  }
+  EXPECT_EQ(value_b, 1.F);
+  EXPECT_EQ(value_a, 0.F);
+  EXPECT_EQ(animation::Scheduler::Default().running(), 0u);
+}
+
+TEST(ScreenInteractive, HostEventLoop) {
+  std::string typed;
+  int escapes = 0;
+  auto component = CatchEvent(Renderer([&] { return text(typed); }),
+                              [&](Event event) {
+                                if (event.is_character()) {
+                                  typed += event.character();
+                                  return true;
+                                }
+                                if (event == Event::Escape) {
+                                  escapes++;
+                                  return true;
+                                }
+                                return false;
+                              });
+
+  auto screen = ScreenInteractive::FixedSize(10, 1);
+  screen.HostEventLoop();
+  Loop loop(&screen, component);
+  const int fd = screen.TaskFd();
+  ASSERT_GE(fd, 0);
+  auto readable = [&] {
+    pollfd poll_fd = {fd, POLLIN, 0};
+    return poll(&poll_fd, 1, 0) == 1;
+  };
+  loop.RunOnce();
+  EXPECT_FALSE(readable());
+
+  // A task posted from another thread.
+  bool posted = false;
+  std::thread([&] { screen.Post([&] { posted = true; }); }).join();
+  EXPECT_TRUE(readable());
+  loop.RunOnce();
+  EXPECT_TRUE(posted);
+  EXPECT_FALSE(readable());
+
+  // The input, and the timeout of a lone escape.
+  screen.FeedInput("ab\x1B");
+  loop.RunOnce();
+  EXPECT_EQ(typed, "ab");
+  EXPECT_EQ(escapes, 0);
+  EXPECT_NE(screen.NextTick(), animation::TimePoint::max());
+  std::this_thread::sleep_for(std::chrono::milliseconds(60));
+  screen.Tick();
+  loop.RunOnce();
+  EXPECT_EQ(escapes, 1);
+
+  screen.Exit();
+  loop.RunOnce();
+  EXPECT_TRUE(loop.HasQuitted());
+}
+#endif
+
+#if !defined(_WIN32)
+TEST(ScreenInteractive, NonInteractiveOutput) {
+  // The standard output is a pipe, instead of a terminal.
+  std::array<int, 2> fds = {-1, -1};
+  ASSERT_EQ(pipe(fds.data()), 0);
+  const int saved_stdout = dup(STDOUT_FILENO);
+  dup2(fds[1], STDOUT_FILENO);
+  close(fds[1]);
+
+  int count = 0;
+  auto component = Renderer([&] {
+    return vbox({
+        text("count " + std::to_string(count)),
+        text("done"),
+    });
+  });
+  auto screen = ScreenInteractive::FixedSize(10, 2);
+  screen.NonInteractiveOutput();
+  {
+    Loop loop(&screen, component);
+    for (int i = 0; i < 3; ++i) {
+      screen.Post([&] { count++; });
+      loop.RunOnce();
+    }
+    screen.Exit();
+    while (!loop.HasQuitted()) {
+      loop.RunOnce();
+    }
+  }
+
+  // Only the last frame was written, as plain text.
+  dup2(saved_stdout, STDOUT_FILENO);
+  close(saved_stdout);
+  std::string output;
+  std::array<char, 256> buffer;  // NOLINT
+  ssize_t size = 0;
+  while ((size = read(fds[0], buffer.data(), buffer.size())) > 0) {
+    output.append(buffer.data(), size_t(size));
+  }
+  close(fds[0]);
+  EXPECT_EQ(output, "count 3\ndone\n");
+}
+#endif
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
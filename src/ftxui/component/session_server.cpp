@@ -0,0 +1,301 @@
+#include "ftxui/component/session_server.hpp"
+
+#if !defined(_WIN32)
+
+#include <fcntl.h>   // for fcntl, F_SETFL, O_NONBLOCK
+#include <poll.h>    // for poll, pollfd, POLLIN, POLLOUT, POLLHUP, POLLERR
+#include <unistd.h>  // for read, write, pipe, close
+#include <algorithm>    // for max, min
+#include <cerrno>       // for errno, EAGAIN, EINTR, EWOULDBLOCK
+#include <chrono>       // for ceil, milliseconds
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <thread>       // for thread
+#include <tuple>        // for ignore
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include "ftxui/component/animation.hpp"  // for Clock, TimePoint
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/component/worker_pool.hpp"         // for WorkerPool
+
+namespace ftxui {
+
+namespace {
+
+// Write the whole |data| to |fd|, waiting when it is full. Gives up on error.
+void WriteAll(int fd, std::string_view data) {
+  while (!data.empty()) {
+    const ssize_t written = write(fd, data.data(), data.size());
+    if (written > 0) {
+      data.remove_prefix(size_t(written));
+      continue;
+    }
+    if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      pollfd poll_fd = {fd, POLLOUT, 0};
+      std::ignore = poll(&poll_fd, 1, -1);
+      continue;
+    }
+    if (written < 0 && errno == EINTR) {
+      continue;
+    }
+    return;
+  }
+}
+
+}  // namespace
+
+struct SessionServer::Session {
+  Session(int input, int output, int dimx, int dimy, Component component)
+      : input_fd(input),
+        output_fd(output),
+        screen(ScreenInteractive::Session(dimx, dimy)),
+        loop(std::make_unique<Loop>(&screen, std::move(component))) {}
+
+  const int input_fd;
+  const int output_fd;
+  ScreenInteractive screen;
+  std::unique_ptr<Loop> loop;
+
+  // Guarded by the mutex of the server.
+  bool busy = false;          // Handled by a thread of the pool.
+  bool ended = false;         // Its component exited.
+  bool input_closed = false;  // Its terminal is gone.
+  bool removed = false;       // By Remove().
+};
+
+/// @brief Start |threads| threads, to handle the sessions.
+/// @param threads The number of threads. 0 uses the number of cores.
+SessionServer::SessionServer(int threads) {
+  if (threads <= 0) {
+    threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+  pool_ = std::make_unique<WorkerPool>(threads);
+  if (pipe(wakeup_.data()) == 0) {
+    fcntl(wakeup_[0], F_SETFL, O_NONBLOCK);  // NOLINT
+    fcntl(wakeup_[1], F_SETFL, O_NONBLOCK);  // NOLINT
+  } else {
+    wakeup_ = {-1, -1};
+  }
+}
+
+/// @brief End the remaining sessions. Run() must have returned.
+SessionServer::~SessionServer() {
+  // Wait for the sessions being handled.
+  pool_.reset();
+  for (auto& [id, session] : sessions_) {
+    session->loop.reset();
+    if (!session->input_closed) {
+      WriteAll(session->output_fd, session->screen.TakeOutput());
+    }
+  }
+  sessions_.clear();
+  for (int& fd : wakeup_) {
+    if (fd >= 0) {
+      close(fd);
+    }
+    fd = -1;
+  }
+}
+
+/// @brief Serve |component| to a remote terminal.
+/// @param input_fd Where the input of the terminal is read.
+/// @param output_fd Where the output toward the terminal is written.
+/// @param dimx The width of the terminal.
+/// @param dimy The height of the terminal.
+/// @param component The component displayed.
+/// @return The identifier of the session.
+SessionServer::Id SessionServer::Add(int input_fd,
+                                     int output_fd,
+                                     int dimx,
+                                     int dimy,
+                                     Component component) {
+  auto session = std::make_unique<Session>(input_fd, output_fd, dimx, dimy,
+                                           std::move(component));
+  Id id = 0;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    id = next_id_++;
+    sessions_[id] = std::move(session);
+  }
+  Wake();
+  return id;
+}
+
+/// @brief The terminal of |session| was resized.
+void SessionServer::Resize(Id session, int dimx, int dimy) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto it = sessions_.find(session);
+  if (it == sessions_.end()) {
+    return;
+  }
+  ScreenInteractive* screen = &it->second->screen;
+  screen->Post([screen, dimx, dimy] { screen->SetDimensions(dimx, dimy); });
+}
+
+/// @brief End |session|. Its terminal is restored, unless it is gone.
+void SessionServer::Remove(Id session) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sessions_.find(session);
+    if (it == sessions_.end()) {
+      return;
+    }
+    it->second->removed = true;
+  }
+  Wake();
+}
+
+/// @brief Set the function called by Run() once a session ended. Its
+/// descriptors aren't used anymore by then.
+void SessionServer::OnEnd(std::function<void(Id)> on_end) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  on_end_ = std::move(on_end);
+}
+
+size_t SessionServer::size() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return sessions_.size();
+}
+
+/// @brief Wait for the input and the tasks of the sessions, and hand the
+/// sessions with some work over to the pool. Returns after Stop().
+void SessionServer::Run() {
+  std::vector<pollfd> fds;
+  std::vector<Session*> polled;
+  std::vector<std::pair<Id, std::unique_ptr<Session>>> ended;
+  while (true) {
+    fds.clear();
+    polled.clear();
+    fds.push_back({wakeup_[0], POLLIN, 0});
+    auto next_tick = animation::TimePoint::max();
+    std::function<void(Id)> on_end;
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (stop_) {
+        stop_ = false;
+        return;
+      }
+      on_end = on_end_;
+      for (auto it = sessions_.begin(); it != sessions_.end();) {
+        Session* session = it->second.get();
+        if (session->busy) {
+          ++it;
+          continue;
+        }
+        if (session->ended || session->input_closed || session->removed) {
+          ended.emplace_back(it->first, std::move(it->second));
+          it = sessions_.erase(it);
+          continue;
+        }
+        polled.push_back(session);
+        fds.push_back({session->input_fd, POLLIN, 0});
+        fds.push_back({session->screen.TaskFd(), POLLIN, 0});
+        next_tick = std::min(next_tick, session->screen.NextTick());
+        ++it;
+      }
+    }
+
+    // Restore the terminals still there.
+    for (auto& [id, session] : ended) {
+      session->loop.reset();
+      if (!session->input_closed) {
+        WriteAll(session->output_fd, session->screen.TakeOutput());
+      }
+      session.reset();
+      if (on_end) {
+        on_end(id);
+      }
+    }
+    ended.clear();
+
+    int timeout = -1;
+    if (next_tick != animation::TimePoint::max()) {
+      const auto delay = std::chrono::ceil<std::chrono::milliseconds>(
+          next_tick - animation::Clock::now());
+      timeout = static_cast<int>(std::max(delay.count(), decltype(delay.count())(0)));
+    }
+    if (poll(fds.data(), fds.size(), timeout) < 0 && errno != EINTR) {
+      return;
+    }
+
+    if (fds[0].revents & POLLIN) {  // NOLINT
+      char buffer[64];
+      while (read(wakeup_[0], buffer, sizeof(buffer)) > 0) {
+      }
+    }
+
+    const auto now = animation::Clock::now();
+    for (size_t i = 0; i < polled.size(); ++i) {
+      Session* session = polled[i];
+      const short input = fds[1 + 2 * i].revents;  // NOLINT
+      const bool readable = input & (POLLIN | POLLHUP | POLLERR);  // NOLINT
+      const bool tasks = fds[2 + 2 * i].revents & POLLIN;          // NOLINT
+      if (!readable && !tasks && session->screen.NextTick() > now) {
+        continue;
+      }
+      {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        session->busy = true;
+      }
+      pool_->Submit([this, session, readable] { Serve(session, readable); });
+    }
+  }
+}
+
+/// @brief Make Run() return.
+void SessionServer::Stop() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  Wake();
+}
+
+void SessionServer::Wake() {
+  if (wakeup_[1] >= 0) {
+    const char c = 0;
+    std::ignore = write(wakeup_[1], &c, 1);
+  }
+}
+
+// Read the input of |session|, and run its loop once. From a thread of the
+// pool.
+void SessionServer::Serve(Session* session, bool readable) {
+  bool input_closed = false;
+  if (readable) {
+    char buffer[4096];  // NOLINT
+    const ssize_t size = read(session->input_fd, buffer, sizeof(buffer));
+    if (size > 0) {
+      session->screen.FeedInput(std::string_view(buffer, size_t(size)));
+    } else if (size == 0 || (errno != EAGAIN && errno != EWOULDBLOCK &&
+                             errno != EINTR)) {
+      input_closed = true;
+    }
+  }
+
+  bool ended = false;
+  if (!input_closed) {
+    session->screen.Tick();
+    session->loop->RunOnce();
+    WriteAll(session->output_fd, session->screen.TakeOutput());
+    ended = session->loop->HasQuitted();
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    session->busy = false;
+    session->ended = ended;
+    session->input_closed = input_closed;
+  }
+  Wake();
+}
+
+}  // namespace ftxui
+
+#endif  // !defined(_WIN32)
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
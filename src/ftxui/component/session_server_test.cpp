@@ -0,0 +1,198 @@
+#include "ftxui/component/session_server.hpp"
+#include <gtest/gtest.h>
+
+#if !defined(_WIN32)
+#include <poll.h>    // for poll, pollfd, POLLIN
+#include <unistd.h>  // for pipe, read, write, close
+#include <array>     // for array
+#include <chrono>    // for milliseconds
+#include <atomic>    // for atomic
+#include <memory>    // for make_shared
+#include <string>    // for string
+#include <thread>    // for thread
+#include <vector>    // for vector
+
+#include "ftxui/component/animation.hpp"           // for Animator
+#include "ftxui/component/component.hpp"           // for Renderer, CatchEvent, Make
+#include "ftxui/component/component_base.hpp"      // for ComponentBase
+#include "ftxui/component/event.hpp"               // for Event
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for text
+
+namespace ftxui {
+
+namespace {
+
+// The two pipes of a remote terminal.
+class RemoteTerminal {
+ public:
+  RemoteTerminal() {
+    EXPECT_EQ(pipe(input_.data()), 0);
+    EXPECT_EQ(pipe(output_.data()), 0);
+  }
+  ~RemoteTerminal() {
+    for (const int fd : {input_[0], input_[1], output_[0], output_[1]}) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+  }
+  RemoteTerminal(const RemoteTerminal&) = delete;
+  RemoteTerminal& operator=(const RemoteTerminal&) = delete;
+
+  int input_fd() const { return input_[0]; }
+  int output_fd() const { return output_[1]; }
+
+  void Type(const std::string& keys) {
+    EXPECT_EQ(write(input_[1], keys.data(), keys.size()),
+              ssize_t(keys.size()));
+  }
+  void Hangup() {
+    close(input_[1]);
+    input_[1] = -1;
+  }
+
+  // Read the output until it contains |expected|.
+  bool WaitFor(const std::string& expected) {
+    for (int i = 0; i < 200; ++i) {
+      if (received_.find(expected) != std::string::npos) {
+        return true;
+      }
+      pollfd poll_fd = {output_[0], POLLIN, 0};
+      if (poll(&poll_fd, 1, 10) == 1) {
+        char buffer[4096];
+        const ssize_t size = read(output_[0], buffer, sizeof(buffer));
+        if (size > 0) {
+          received_.append(buffer, size_t(size));
+        }
+      }
+    }
+    return false;
+  }
+
+ private:
+  std::array<int, 2> input_ = {-1, -1};
+  std::array<int, 2> output_ = {-1, -1};
+  std::string received_;
+};
+
+// Displays the keys typed. Exits on 'q'.
+Component Echo() {
+  auto typed = std::make_shared<std::string>("[");
+  return CatchEvent(Renderer([typed] { return text(*typed + "]"); }),
+                    [typed](Event event) {
+                      if (event == Event::Character('q')) {
+                        ScreenInteractive::Active()->Exit();
+                        return true;
+                      }
+                      if (event.is_character()) {
+                        *typed += event.character();
+                        return true;
+                      }
+                      return false;
+                    });
+}
+
+// Animates a value toward 1 once a key is typed, and displays it when done.
+Component Animated() {
+  class Impl : public ComponentBase {
+   public:
+    Element Render() override { return text(value_ == 1.F ? "done" : "-"); }
+    bool OnEvent(Event event) override {
+      if (!event.is_character()) {
+        return false;
+      }
+      animator_ = animation::Animator(&value_, 1.F,
+                                      std::chrono::milliseconds(50));
+      return true;
+    }
+
+   private:
+    float value_ = 0.F;
+    animation::Animator animator_{&value_};
+  };
+  return Make<Impl>();
+}
+
+}  // namespace
+
+TEST(SessionServerTest, Sessions) {
+  SessionServer server(2);
+  std::vector<SessionServer::Id> ended;
+  std::atomic<int> ended_count = 0;
+  server.OnEnd([&](SessionServer::Id id) {
+    ended.push_back(id);
+    ended_count++;
+  });
+  std::thread thread([&] { server.Run(); });
+
+  RemoteTerminal a;
+  RemoteTerminal b;
+  const auto id_a = server.Add(a.input_fd(), a.output_fd(), 10, 2, Echo());
+  const auto id_b = server.Add(b.input_fd(), b.output_fd(), 10, 2, Echo());
+  EXPECT_EQ(server.size(), 2u);
+
+  // Every session has its own state, and terminal.
+  a.Type("xy");
+  b.Type("z");
+  EXPECT_TRUE(a.WaitFor("[xy]"));
+  EXPECT_TRUE(b.WaitFor("[z]"));
+
+  // The component exits, and the terminal is restored.
+  a.Type("q");
+  EXPECT_TRUE(a.WaitFor(";2004l"));
+
+  // The terminal is gone.
+  b.Hangup();
+  for (int i = 0; i < 200 && ended_count != 2; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  server.Stop();
+  thread.join();
+  EXPECT_EQ(server.size(), 0u);
+  ASSERT_EQ(ended.size(), 2u);
+  EXPECT_EQ(ended[0], id_a);
+  EXPECT_EQ(ended[1], id_b);
+}
+
+// The sessions running concurrently step their own animations.
+TEST(SessionServerTest, Animations) {
+  SessionServer server(2);
+  std::thread thread([&] { server.Run(); });
+
+  RemoteTerminal a;
+  RemoteTerminal b;
+  server.Add(a.input_fd(), a.output_fd(), 10, 1, Animated());
+  server.Add(b.input_fd(), b.output_fd(), 10, 1, Animated());
+  a.Type("x");
+  b.Type("y");
+  EXPECT_TRUE(a.WaitFor("done"));
+  EXPECT_TRUE(b.WaitFor("done"));
+
+  server.Stop();
+  thread.join();
+}
+
+TEST(SessionServerTest, Resize) {
+  SessionServer server(1);
+  std::thread thread([&] { server.Run(); });
+
+  RemoteTerminal terminal;
+  const auto id = server.Add(terminal.input_fd(), terminal.output_fd(), 4, 1,
+                             Renderer([] { return text("abcdefgh"); }));
+  EXPECT_TRUE(terminal.WaitFor("abcd"));
+  server.Resize(id, 8, 1);
+  EXPECT_TRUE(terminal.WaitFor("abcdefgh"));
+
+  server.Stop();
+  thread.join();
+}
+
+}  // namespace ftxui
+
+#endif  // !defined(_WIN32)
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -106,7 +106,7 @@ class SliderBase : public ComponentBase {
     }
   }
 
-  bool OnEvent(Event event) final {
+  bool HandleEvent(const Event& event) final {
     if (event.is_mouse()) {
       return OnMouseEvent(event);
     }
@@ -130,10 +130,10 @@ class SliderBase : public ComponentBase {
       return true;
     }
 
-    return ComponentBase::OnEvent(event);
+    return DispatchToChildren(event);
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (captured_mouse_ && event.mouse().motion == Mouse::Released) {
       captured_mouse_ = nullptr;
       return true;
@@ -205,8 +205,8 @@ class SliderWithLabel : public ComponentBase {
   }
 
  private:
-  bool OnEvent(Event event) final {
-    if (ComponentBase::OnEvent(event)) {
+  bool HandleEvent(const Event& event) final {
+    if (DispatchToChildren(event)) {
       return true;
     }
 
@@ -0,0 +1,59 @@
+#include <chrono>   // for milliseconds
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr
+
+#include "ftxui/component/animation.hpp"  // for Now, RequestAnimationFrameAt, TimePoint
+#include "ftxui/component/component.hpp"       // for Spinner, Make
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/dom/elements.hpp"              // for spinner, Element
+
+namespace ftxui {
+
+namespace {
+
+class SpinnerBase : public ComponentBase {
+ public:
+  SpinnerBase(int charset_index, std::chrono::milliseconds period)
+      : charset_index_(charset_index),
+        period_(period.count() > 0 ? period : std::chrono::milliseconds(1)) {}
+
+ private:
+  Element Render() override {
+    // The images are aligned on multiples of the period, so that the spinners
+    // sharing it change together, and wake up the loop once.
+    const auto index = animation::Now().time_since_epoch() / period_;
+    animation::RequestAnimationFrameAt(
+        animation::TimePoint((index + 1) * period_));
+    return spinner(charset_index_, static_cast<size_t>(index));
+  }
+
+  int charset_index_;
+  animation::Clock::duration period_;
+};
+
+}  // namespace
+
+/// @brief A spinner animating itself: its image follows the time, changing
+/// every |period|. The loop wakes up only when the image changes, instead of
+/// requiring a redraw for every animation frame, or a thread advancing the
+/// index of spinner().
+/// @param charset_index The type of spinner. See spinner().
+/// @param period The duration of every image.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::FitComponent();
+/// auto loading = Spinner(15);
+/// screen.Loop(loading);
+/// ```
+Component Spinner(int charset_index, std::chrono::milliseconds period) {
+  return Make<SpinnerBase>(charset_index, period);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include <chrono>  // for milliseconds
+#include <string>  // for string
+
+#include "ftxui/component/component.hpp"  // for Spinner, Renderer
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+TEST(SpinnerTest, FollowsTheClock) {
+  auto screen = ScreenInteractive::Headless(1, 1);
+  int renders = 0;
+  auto spinner = Spinner(2, std::chrono::milliseconds(100));
+  auto component = Renderer(spinner, [&] {
+    renders++;
+    return spinner->Render();
+  });
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+  EXPECT_NE(screen.TakeOutput().find('|'), std::string::npos);
+
+  // Nothing is drawn before the image changes.
+  screen.AdvanceTime(std::chrono::milliseconds(60));
+  loop.RunOnce();
+  EXPECT_EQ(renders, 1);
+
+  screen.AdvanceTime(std::chrono::milliseconds(40));
+  loop.RunOnce();
+  EXPECT_EQ(renders, 2);
+  EXPECT_NE(screen.TakeOutput().find('/'), std::string::npos);
+
+  // Several periods later, the image matches the time.
+  screen.AdvanceTime(std::chrono::milliseconds(250));
+  loop.RunOnce();
+  EXPECT_EQ(renders, 3);
+  EXPECT_NE(screen.TakeOutput().find('\\'), std::string::npos);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
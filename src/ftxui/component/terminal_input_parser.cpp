@@ -3,24 +3,23 @@
 #include <cstdint>                    // for uint32_t
 #include <ftxui/component/mouse.hpp>  // for Mouse, Mouse::Button, Mouse::Motion
 #include <ftxui/component/receiver.hpp>  // for SenderImpl, Sender
-#include <map>
-#include <memory>   // for unique_ptr, allocator
-#include <utility>  // for move
+#include <memory>       // for unique_ptr, allocator
+#include <string_view>  // for string_view
+#include <utility>      // for move
 
 #include "ftxui/component/event.hpp"  // for Event
 #include "ftxui/component/task.hpp"   // for Task
 
 namespace ftxui {
 
-// NOLINTNEXTLINE
-const std::map<std::string, std::string> g_uniformize = {
+constexpr std::pair<std::string_view, std::string_view> g_uniformize[] = {
     // Microsoft's terminal uses a different new line character for the return
     // key. This also happens with linux with the `bind` command:
     // See https://github.com/ArthurSonzogni/FTXUI/issues/337
     // Here, we uniformize the new line character to `\n`.
     {"\r", "\n"},
     // See: https://github.com/ArthurSonzogni/FTXUI/issues/508
-    {std::string({8}), std::string({127})},
+    {"\x08", "\x7F"},
 };
 
 TerminalInputParser::TerminalInputParser(Sender<Task> out)
@@ -35,16 +34,67 @@ void TerminalInputParser::Timeout(int time) {
   timeout_ = 0;
   if (!pending_.empty()) {
     Send(SPECIAL);
+    Flush();
   }
 }
 
 void TerminalInputParser::Add(char c) {
-  pending_ += c;
+  AddChar(c);
+  Flush();
+}
+
+void TerminalInputParser::Add(std::string_view input) {
+  for (const char c : input) {
+    AddChar(c);
+  }
+  Flush();
+}
+
+void TerminalInputParser::AddChar(char c) {
   timeout_ = 0;
+  if (in_paste_) {
+    AddPaste(c);
+    return;
+  }
+  // Fast path for the printable ASCII characters, like most of a paste.
+  if (pending_.empty() && c >= ' ' && c < 127) {  // NOLINT
+    events_.emplace_back(Event::Character(c));
+    return;
+  }
+  pending_ += c;
   position_ = -1;
   Send(Parse());
 }
 
+// Accumulate |c| into the paste, until its end marker.
+void TerminalInputParser::AddPaste(char c) {
+  paste_ += c;
+  const std::string_view end = "\x1B[201~";
+  if (c != '~' || paste_.size() < end.size() ||
+      std::string_view(paste_).substr(paste_.size() - end.size()) != end) {
+    return;
+  }
+  paste_.resize(paste_.size() - end.size());
+
+  // Uniformize the new lines to "\n", like for the Return key.
+  std::string text;
+  text.reserve(paste_.size());
+  for (size_t i = 0; i < paste_.size(); ++i) {
+    if (paste_[i] != '\r') {
+      text += paste_[i];
+    } else if (i + 1 == paste_.size() || paste_[i + 1] != '\n') {
+      text += '\n';
+    }
+  }
+  events_.emplace_back(Event::Paste(std::move(text)));
+  paste_.clear();
+  in_paste_ = false;
+}
+
+void TerminalInputParser::Flush() {
+  out_->SendAll(events_);
+}
+
 unsigned char TerminalInputParser::Current() {
   return pending_[position_];
 }
@@ -64,29 +114,59 @@ void TerminalInputParser::Send(TerminalInputParser::Output output) {
       return;
 
     case CHARACTER:
-      out_->Send(Event::Character(std::move(pending_)));
+      events_.emplace_back(Event::Character(std::move(pending_)));
       pending_.clear();
       return;
 
     case SPECIAL: {
-      auto it = g_uniformize.find(pending_);
-      if (it != g_uniformize.end()) {
-        pending_ = it->second;
+      if (pending_ == "\x1B[200~") {
+        in_paste_ = true;
+        pending_.clear();
+        return;
+      }
+      for (const auto& [from, to] : g_uniformize) {
+        if (pending_ == from) {
+          pending_ = to;
+          break;
+        }
       }
-      out_->Send(Event::Special(std::move(pending_)));
+      events_.emplace_back(Event::Special(std::move(pending_)));
       pending_.clear();
     }
       return;
 
     case MOUSE:
-      out_->Send(Event::Mouse(std::move(pending_), output.mouse));  // NOLINT
+      events_.emplace_back(
+          Event::Mouse(std::move(pending_), output.mouse));  // NOLINT
       pending_.clear();
       return;
 
     case CURSOR_REPORTING:
-      out_->Send(Event::CursorReporting(std::move(pending_),  // NOLINT
-                                        output.cursor.x,      // NOLINT
-                                        output.cursor.y));    // NOLINT
+      events_.emplace_back(
+          Event::CursorReporting(std::move(pending_),  // NOLINT
+                                 output.cursor.x,      // NOLINT
+                                 output.cursor.y));    // NOLINT
+      pending_.clear();
+      return;
+
+    case MODE_REPORTING:
+      events_.emplace_back(
+          Event::ModeReporting(std::move(pending_),  // NOLINT
+                               output.mode.mode,     // NOLINT
+                               output.mode.value));  // NOLINT
+      pending_.clear();
+      return;
+
+    case DEVICE_ATTRIBUTES:
+      events_.emplace_back(
+          Event::DeviceAttributes(std::move(pending_),       // NOLINT
+                                  output.device.secondary,   // NOLINT
+                                  output.device.type));      // NOLINT
+      pending_.clear();
+      return;
+
+    case TERMINAL_VERSION:
+      events_.emplace_back(Event::TerminalVersion(std::move(pending_)));
       pending_.clear();
       return;
   }
@@ -238,12 +318,19 @@ TerminalInputParser::Output TerminalInputParser::ParseDCS() {
       continue;
     }
 
+    // Reply to XTVERSION: DCS > | <version> ST
+    if (pending_.compare(0, 4, "\x1BP>|") == 0) {
+      return TERMINAL_VERSION;
+    }
     return SPECIAL;
   }
 }
 
 TerminalInputParser::Output TerminalInputParser::ParseCSI() {
   bool altered = false;
+  bool private_mode = false;
+  bool secondary = false;
+  bool dollar = false;
   int argument = 0;
   std::vector<int> arguments;
   while (true) {
@@ -256,6 +343,23 @@ TerminalInputParser::Output TerminalInputParser::ParseCSI() {
       continue;
     }
 
+    if (Current() == '?') {
+      private_mode = true;
+      continue;
+    }
+
+    // Prefix of the DA2 reply.
+    if (Current() == '>') {
+      secondary = true;
+      continue;
+    }
+
+    // Intermediate byte, used by DECRPM.
+    if (Current() == '$') {
+      dollar = true;
+      continue;
+    }
+
     if (Current() >= '0' && Current() <= '9') {
       argument *= 10;  // NOLINT
       argument += int(Current() - '0');
@@ -278,6 +382,16 @@ TerminalInputParser::Output TerminalInputParser::ParseCSI() {
           return ParseMouse(altered, false, std::move(arguments));
         case 'R':
           return ParseCursorReporting(std::move(arguments));
+        case 'y':
+          if (private_mode && dollar) {
+            return ParseModeReporting(std::move(arguments));
+          }
+          return SPECIAL;
+        case 'c':
+          if (private_mode || secondary) {
+            return ParseDeviceAttributes(secondary, std::move(arguments));
+          }
+          return SPECIAL;
         default:
           return SPECIAL;
       }
@@ -342,6 +456,31 @@ TerminalInputParser::Output TerminalInputParser::ParseCursorReporting(
   return output;
 }
 
+// Reply to DA1: CSI ? <level> ; <attributes...> c
+// Reply to DA2: CSI > <type> ; <version> ; <rom> c
+// NOLINTNEXTLINE
+TerminalInputParser::Output TerminalInputParser::ParseDeviceAttributes(
+    bool secondary,
+    std::vector<int> arguments) {
+  Output output(DEVICE_ATTRIBUTES);
+  output.device.secondary = secondary;   // NOLINT
+  output.device.type = arguments[0];     // NOLINT
+  return output;
+}
+
+// Reply to DECRQM: CSI ? <mode> ; <value> $ y
+// NOLINTNEXTLINE
+TerminalInputParser::Output TerminalInputParser::ParseModeReporting(
+    std::vector<int> arguments) {
+  if (arguments.size() != 2) {
+    return SPECIAL;
+  }
+  Output output(MODE_REPORTING);
+  output.mode.mode = arguments[0];   // NOLINT
+  output.mode.value = arguments[1];  // NOLINT
+  return output;
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
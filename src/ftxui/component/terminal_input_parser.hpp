@@ -1,9 +1,10 @@
 #ifndef FTXUI_COMPONENT_TERMINAL_INPUT_PARSER
 #define FTXUI_COMPONENT_TERMINAL_INPUT_PARSER
 
-#include <memory>  // for unique_ptr
-#include <string>  // for string
-#include <vector>  // for vector
+#include <memory>       // for unique_ptr
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 #include "ftxui/component/event.hpp"     // for Event (ptr only)
 #include "ftxui/component/mouse.hpp"     // for Mouse
@@ -19,6 +20,10 @@ class TerminalInputParser {
   TerminalInputParser(Sender<Task> out);
   void Timeout(int time);
   void Add(char c);
+  // Parse a whole buffer, and send its events at once.
+  void Add(std::string_view input);
+  // Whether an uncompleted sequence waits for more characters, or a timeout.
+  bool HasPending() const { return !pending_.empty(); }
 
  private:
   unsigned char Current();
@@ -31,6 +36,9 @@ class TerminalInputParser {
     SPECIAL,
     MOUSE,
     CURSOR_REPORTING,
+    MODE_REPORTING,
+    DEVICE_ATTRIBUTES,
+    TERMINAL_VERSION,
   };
 
   struct CursorReporting {
@@ -38,17 +46,32 @@ class TerminalInputParser {
     int y;
   };
 
+  struct ModeReporting {
+    int mode;
+    int value;
+  };
+
+  struct DeviceAttributes {
+    bool secondary;
+    int type;
+  };
+
   struct Output {
     Type type;
     union {
       Mouse mouse;
       CursorReporting cursor;
+      ModeReporting mode;
+      DeviceAttributes device;
     };
 
     Output(Type t) : type(t) {}
   };
 
+  void AddChar(char c);
+  void AddPaste(char c);
   void Send(Output output);
+  void Flush();
   Output Parse();
   Output ParseUTF8();
   Output ParseESC();
@@ -57,11 +80,20 @@ class TerminalInputParser {
   Output ParseOSC();
   Output ParseMouse(bool altered, bool pressed, std::vector<int> arguments);
   Output ParseCursorReporting(std::vector<int> arguments);
+  Output ParseModeReporting(std::vector<int> arguments);
+  Output ParseDeviceAttributes(bool secondary, std::vector<int> arguments);
 
   Sender<Task> out_;
+  // The events parsed, sent together by Flush().
+  std::vector<Task> events_;
   int position_ = -1;
   int timeout_ = 0;
   std::string pending_;
+
+  // Between the bracketed paste markers, the characters are accumulated into
+  // |paste_| instead of being parsed.
+  bool in_paste_ = false;
+  std::string paste_;
 };
 
 }  // namespace ftxui
@@ -35,6 +35,54 @@ TEST(Event, Character) {
   EXPECT_FALSE(event_receiver->Receive(&received));
 }
 
+TEST(Event, Buffer) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    parser.Add("a\x1B[Ab\xC3\xA9\x1B[<0;2;3M");
+    // The sequences can be split across buffers.
+    parser.Add("\x1B[");
+    parser.Add("B");
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('a'));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::ArrowUp);
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('b'));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character("\xC3\xA9"));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_mouse());
+  EXPECT_EQ(std::get<Event>(received).mouse().x, 2);
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::ArrowDown);
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+TEST(Event, Paste) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    parser.Add("a\x1B[200~b\x1B[A\r\nc\rd");
+    parser.Add("\x1B[201");
+    parser.Add("~e");
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('a'));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_paste());
+  EXPECT_EQ(std::get<Event>(received).paste(), "b\x1B[A\nc\nd");
+  EXPECT_EQ(std::get<Event>(received), Event::Paste("b\x1B[A\nc\nd"));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('e'));
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
 TEST(Event, EscapeKeyWithoutWaiting) {
   auto event_receiver = MakeReceiver<Task>();
   {
@@ -72,6 +120,22 @@ TEST(Event, EscapeKeyEnoughWait) {
   EXPECT_FALSE(event_receiver->Receive(&received));
 }
 
+TEST(Event, HasPending) {
+  auto event_receiver = MakeReceiver<Task>();
+  auto parser = TerminalInputParser(event_receiver->MakeSender());
+  EXPECT_FALSE(parser.HasPending());
+  parser.Add('a');
+  EXPECT_FALSE(parser.HasPending());
+  parser.Add('\x1B');
+  EXPECT_TRUE(parser.HasPending());
+  parser.Timeout(50);
+  EXPECT_FALSE(parser.HasPending());
+  parser.Add('\x1B');
+  parser.Add('[');
+  parser.Add('A');
+  EXPECT_FALSE(parser.HasPending());
+}
+
 TEST(Event, MouseLeftClickPressed) {
   auto event_receiver = MakeReceiver<Task>();
   {
@@ -200,6 +264,60 @@ TEST(Event, MouseRightClick) {
   EXPECT_FALSE(event_receiver->Receive(&received));
 }
 
+TEST(Event, ModeReporting) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    for (char c : std::string("\x1B[?2026;2$y")) {
+      parser.Add(c);
+    }
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_mode_reporting());
+  EXPECT_EQ(2026, std::get<Event>(received).mode());
+  EXPECT_EQ(2, std::get<Event>(received).mode_value());
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+TEST(Event, DeviceAttributes) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    for (char c : std::string("\x1B[?64;1;22c\x1B[>41;390;0c")) {
+      parser.Add(c);
+    }
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_device_attributes());
+  EXPECT_FALSE(std::get<Event>(received).is_secondary());
+  EXPECT_EQ(64, std::get<Event>(received).device_type());
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_device_attributes());
+  EXPECT_TRUE(std::get<Event>(received).is_secondary());
+  EXPECT_EQ(41, std::get<Event>(received).device_type());
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+TEST(Event, TerminalVersion) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    for (char c : std::string("\x1BP>|XTerm(390)\x1B\\")) {
+      parser.Add(c);
+    }
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_terminal_version());
+  EXPECT_EQ("XTerm(390)", std::get<Event>(received).terminal_version());
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
 TEST(Event, UTF8) {
   struct {
     std::vector<unsigned char> input;
@@ -0,0 +1,543 @@
+#include <algorithm>      // for max, min, lower_bound, upper_bound, remove_if
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uintptr_t
+#include <functional>     // for function
+#include <iterator>       // for make_move_iterator
+#include <string>         // for string, to_string
+#include <string_view>    // for string_view
+#include <typeinfo>       // for type_info
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
+#include "ftxui/component/captured_mouse.hpp"     // for CapturedMouse
+#include "ftxui/component/component.hpp"          // for Make, TextArea
+#include "ftxui/component/component_base.hpp"     // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for TextAreaOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::Backspace, Event::Custom, Event::Delete, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed, Mouse::WheelDown, Mouse::WheelUp
+#include "ftxui/dom/elements.hpp"  // for operator|, text, Element, reflect, hbox, cached, flex, focusCursorBarBlinking, virtualList, yframe
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/string.hpp"  // for GlyphView, Glyphs
+#include "ftxui/screen/util.hpp"    // for clamp
+#include "ftxui/util/ref.hpp"       // for StringRef, Ref
+
+namespace ftxui {
+
+namespace {
+
+// A line of a TextArea, without its '\n', and its glyphs. Every line gets a
+// new |version| when edited. It identifies the drawn row.
+struct Line {
+  std::string text;
+  // The first byte and the first cell of every glyph, and past the end.
+  std::vector<size_t> offsets = {0};
+  std::vector<int> cells = {0};
+  size_t version = 0;
+
+  int Count() const { return int(offsets.size()) - 1; }
+
+  size_t Position(int glyph) const {
+    return offsets[util::clamp(glyph, 0, Count())];
+  }
+
+  int Cell(int glyph) const { return cells[util::clamp(glyph, 0, Count())]; }
+
+  // The glyph drawn onto |cell|, or Count() past the end.
+  int GlyphAtCell(int cell) const {
+    const auto it = std::upper_bound(cells.begin(), cells.end(), cell);
+    return util::clamp(int(it - cells.begin()) - 1, 0, Count());
+  }
+
+  std::string Substr(int first, int last) const {
+    const size_t begin = Position(first);
+    return text.substr(begin, Position(last) - begin);
+  }
+
+  void Segment() {
+    offsets.clear();
+    cells.assign(1, 0);
+    for (const GlyphView& glyph : Glyphs(text)) {
+      offsets.push_back(size_t(glyph.text.data() - text.data()));
+      cells.push_back(cells.back() + glyph.width);
+    }
+    offsets.push_back(text.size());
+  }
+};
+
+// Whether |option| has a |on_change| of its own, rather than the default one
+// doing nothing.
+bool HasOnChange(const TextAreaOption& option) {
+  static const std::type_info& kDefault =
+      TextAreaOption().on_change.target_type();
+  return option.on_change.target_type() != kDefault;
+}
+
+// A multi-line editor. The content is split into lines, each of them indexing
+// its glyphs. Moving the cursor to another line doesn't scan the content, and
+// an edit only segments the modified line again.
+//
+// Only the rows visible in the frame are created, using virtualList(). The
+// rows not holding the cursor are cached(), keyed by the version of their
+// line: typing on a line draws this line only, the others are copied from the
+// previous frame.
+class TextAreaBase : public ComponentBase {
+ public:
+  TextAreaBase(StringRef content, Ref<TextAreaOption> option)
+      : content_(std::move(content)),
+        option_(std::move(option)),
+        key_("text_area:" +
+             std::to_string(reinterpret_cast<uintptr_t>(this)) + ":") {}
+
+  int cursor_line_internal_ = 0;
+  int& cursor_line() {
+    int& opt = option_->cursor_line();
+    if (opt != -1) {
+      return opt;
+    }
+    return cursor_line_internal_;
+  }
+
+  int cursor_column_internal_ = 0;
+  int& cursor_column() {
+    int& opt = option_->cursor_column();
+    if (opt != -1) {
+      return opt;
+    }
+    return cursor_column_internal_;
+  }
+
+  // Component implementation:
+  Element Render() override {
+    Sync();
+    // The edits are copied into the content once per frame.
+    if (dirty_) {
+      Write();
+    }
+    ClampCursor();
+    const bool is_focused = Focused();
+
+    // Scroll horizontally to keep the cursor visible. The rows are drawn
+    // again when the scroll or the width changes. A few more cells than the
+    // width are drawn, in case the frame grows before the next frame.
+    const int width = box_.x_max - box_.x_min + 1;
+    const int min_width = 256;
+    if (width > 0) {
+      const int cell = CurrentLine().Cell(cursor_column());
+      if (cell < scroll_x_) {
+        scroll_x_ = cell;
+      }
+      if (cell >= scroll_x_ + width) {
+        scroll_x_ = cell - width + 1;
+      }
+    }
+    const int drawn_width = width > 0 ? std::max(min_width, width) : 0;
+    if (scroll_x_ != rows_scroll_x_ || drawn_width != rows_width_) {
+      rows_.clear();
+      previous_rows_.clear();
+      rows_scroll_x_ = scroll_x_;
+      rows_width_ = drawn_width;
+    }
+    // The rows not drawn by the previous frame are released.
+    previous_rows_.swap(rows_);
+    rows_.clear();
+
+    return virtualList(
+               int(lines_.size()), 1,
+               [this, is_focused](int i) { return Row(i, is_focused); },
+               cursor_line()) |
+           yframe | flex | reflect(box_);
+  }
+
+  bool HandleEvent(const Event& event) override {
+    Sync();
+    ClampCursor();
+
+    if (event.is_mouse()) {
+      return OnMouseEvent(event);
+    }
+
+    if (event == Event::Custom) {
+      return false;
+    }
+
+    if (event == Event::Backspace) {
+      if (cursor_column() > 0) {
+        Replace(cursor_column() - 1, cursor_column(), "");
+        cursor_column()--;
+      } else if (cursor_line() > 0) {
+        // Join with the previous line.
+        Line& previous = lines_[size_t(cursor_line()) - 1];
+        const int column = previous.Count();
+        previous.text += CurrentLine().text;
+        Edited(previous);
+        lines_.erase(lines_.begin() + cursor_line());
+        cursor_line()--;
+        cursor_column() = column;
+      } else {
+        return false;
+      }
+      Changed();
+      return true;
+    }
+
+    if (event == Event::Delete) {
+      if (cursor_column() < CurrentLine().Count()) {
+        Replace(cursor_column(), cursor_column() + 1, "");
+      } else if (cursor_line() + 1 < int(lines_.size())) {
+        // Join with the next line.
+        Line& line = CurrentLine();
+        line.text += lines_[size_t(cursor_line()) + 1].text;
+        Edited(line);
+        lines_.erase(lines_.begin() + cursor_line() + 1);
+      } else {
+        return false;
+      }
+      Changed();
+      return true;
+    }
+
+    if (event == Event::Return) {
+      Insert("\n");
+      Changed();
+      return true;
+    }
+
+    // Arrows.
+    if (event == Event::ArrowLeft) {
+      if (cursor_column() > 0) {
+        cursor_column()--;
+      } else if (cursor_line() > 0) {
+        cursor_line()--;
+        cursor_column() = CurrentLine().Count();
+      } else {
+        return false;
+      }
+      ResetDesiredCell();
+      return true;
+    }
+
+    if (event == Event::ArrowRight) {
+      if (cursor_column() < CurrentLine().Count()) {
+        cursor_column()++;
+      } else if (cursor_line() + 1 < int(lines_.size())) {
+        cursor_line()++;
+        cursor_column() = 0;
+      } else {
+        return false;
+      }
+      ResetDesiredCell();
+      return true;
+    }
+
+    if (event == Event::ArrowUp) {
+      return MoveLines(-1);
+    }
+    if (event == Event::ArrowDown) {
+      return MoveLines(1);
+    }
+    if (event == Event::PageUp) {
+      return MoveLines(-std::max(1, box_.y_max - box_.y_min));
+    }
+    if (event == Event::PageDown) {
+      return MoveLines(std::max(1, box_.y_max - box_.y_min));
+    }
+
+    if (event == Event::Home) {
+      cursor_column() = 0;
+      ResetDesiredCell();
+      return true;
+    }
+
+    if (event == Event::End) {
+      cursor_column() = CurrentLine().Count();
+      ResetDesiredCell();
+      return true;
+    }
+
+    // Insert the whole paste at once. The new lines are kept, the other
+    // control characters are not inserted.
+    if (event.is_paste()) {
+      std::string text = event.paste();
+      text.erase(std::remove_if(text.begin(), text.end(),
+                                [](char c) {
+                                  return (unsigned char)c < ' ' && c != '\n';
+                                }),
+                 text.end());
+      if (text.empty()) {
+        return true;
+      }
+      Insert(text);
+      Changed();
+      return true;
+    }
+
+    // Content
+    if (event.is_character()) {
+      Insert(event.character());
+      Changed();
+      return true;
+    }
+    return false;
+  }
+
+ private:
+  Line& CurrentLine() { return lines_[size_t(cursor_line())]; }
+
+  // Draw the glyphs of the line |i| within |rows_width_| cells from the
+  // horizontal scroll, or all of them while the width is unknown.
+  Element Row(int i, bool is_focused) {
+    const Line& line = lines_[size_t(i)];
+    int first = line.GlyphAtCell(scroll_x_);
+    if (line.Cell(first) < scroll_x_) {
+      first++;
+    }
+    const int last = rows_width_ > 0
+                         ? line.GlyphAtCell(scroll_x_ + rows_width_) + 1
+                         : line.Count();
+
+    if (i == cursor_line()) {
+      if (!is_focused) {
+        return text(line.Substr(first, last)) | reflect(cursor_row_box_);
+      }
+      const int cursor = cursor_column();
+      const std::string part_at_cursor =
+          cursor < line.Count() ? line.Substr(cursor, cursor + 1) : " ";
+      return hbox({
+                 text(line.Substr(first, cursor)),
+                 text(part_at_cursor) | focusCursorBarBlinking,
+                 text(line.Substr(cursor + 1, std::max(cursor + 1, last))),
+             }) |
+             reflect(cursor_row_box_);
+    }
+
+    auto it = rows_.find(line.version);
+    if (it != rows_.end()) {
+      return it->second;
+    }
+    Element row;
+    auto previous = previous_rows_.find(line.version);
+    if (previous != previous_rows_.end()) {
+      row = std::move(previous->second);
+      previous_rows_.erase(previous);
+    } else {
+      row = text(line.Substr(first, last)) |
+            cached(key_ + std::to_string(line.version));
+    }
+    rows_.emplace(line.version, row);
+    return row;
+  }
+
+  // Split |*content_| into |lines_|, unless they already describe it. Once
+  // edited, |lines_| are the reference until the next frame.
+  void Sync() {
+    if (dirty_ || *content_ == synced_) {
+      return;
+    }
+    synced_ = *content_;
+    lines_.clear();
+    size_t begin = 0;
+    while (true) {
+      const size_t end = synced_.find('\n', begin);
+      Line& line = lines_.emplace_back();
+      line.text = synced_.substr(begin, end - begin);
+      Edited(line);
+      if (end == std::string::npos) {
+        break;
+      }
+      begin = end + 1;
+    }
+    ResetDesiredCell();
+  }
+
+  // Join |lines_| into |*content_|.
+  void Write() {
+    size_t size = lines_.size() - 1;
+    for (const Line& line : lines_) {
+      size += line.text.size();
+    }
+    std::string& content = *content_;
+    content.clear();
+    content.reserve(size);
+    for (const Line& line : lines_) {
+      if (&line != &lines_.front()) {
+        content += '\n';
+      }
+      content += line.text;
+    }
+    synced_ = content;
+    dirty_ = false;
+  }
+
+  void ClampCursor() {
+    cursor_line() = util::clamp(cursor_line(), 0, int(lines_.size()) - 1);
+    cursor_column() = util::clamp(cursor_column(), 0, CurrentLine().Count());
+  }
+
+  // Segment |line| again, and give it a new version.
+  void Edited(Line& line) {
+    line.Segment();
+    line.version = next_version_++;
+  }
+
+  // The lines are joined into the content before calling the |on_change| set
+  // by the user. Otherwise, once per frame.
+  void Changed() {
+    dirty_ = true;
+    ResetDesiredCell();
+    if (HasOnChange(*option_)) {
+      Write();
+    }
+    option_->on_change();
+  }
+
+  // Replace the glyphs in [first, last) of the current line by |text|, without
+  // new lines.
+  void Replace(int first, int last, std::string_view text) {
+    Line& line = CurrentLine();
+    const size_t start = line.Position(first);
+    line.text.replace(start, line.Position(last) - start, text);
+    Edited(line);
+  }
+
+  // Insert |text| at the cursor, and move the cursor after it. Every '\n'
+  // splits the current line.
+  void Insert(std::string_view text) {
+    Line& line = CurrentLine();
+    const size_t position = line.Position(cursor_column());
+    std::string tail = line.text.substr(position);
+    line.text.resize(position);
+
+    std::vector<Line> inserted;
+    size_t begin = 0;
+    size_t end = text.find('\n');
+    line.text += text.substr(0, end);
+    while (end != std::string_view::npos) {
+      begin = end + 1;
+      end = text.find('\n', begin);
+      inserted.emplace_back().text = text.substr(begin, end - begin);
+    }
+    Line& last = inserted.empty() ? line : inserted.back();
+    const size_t tail_position = last.text.size();
+    last.text += tail;
+
+    Edited(line);
+    for (Line& other : inserted) {
+      Edited(other);
+    }
+    const int index = cursor_line();
+    lines_.insert(lines_.begin() + index + 1,
+                  std::make_move_iterator(inserted.begin()),
+                  std::make_move_iterator(inserted.end()));
+
+    // The cursor is before the first glyph of the tail.
+    cursor_line() = index + int(inserted.size());
+    const std::vector<size_t>& offsets = CurrentLine().offsets;
+    cursor_column() = int(std::lower_bound(offsets.begin(), offsets.end(),
+                                           tail_position) -
+                          offsets.begin());
+  }
+
+  // Move the cursor |delta| lines up or down, to the glyph drawn onto the
+  // cell it was on before the vertical moves.
+  bool MoveLines(int delta) {
+    const int line =
+        util::clamp(cursor_line() + delta, 0, int(lines_.size()) - 1);
+    if (line == cursor_line()) {
+      return false;
+    }
+    if (desired_cell_ == -1) {
+      desired_cell_ = CurrentLine().Cell(cursor_column());
+    }
+    cursor_line() = line;
+    cursor_column() = CurrentLine().GlyphAtCell(desired_cell_);
+    return true;
+  }
+
+  void ResetDesiredCell() { desired_cell_ = -1; }
+
+  bool OnMouseEvent(const Event& event) {
+    const bool hovered =
+        box_.Contain(event.mouse().x, event.mouse().y) && CaptureMouse(event);
+    if (!hovered) {
+      return false;
+    }
+
+    if (event.mouse().button == Mouse::WheelUp) {
+      return MoveLines(-1);
+    }
+    if (event.mouse().button == Mouse::WheelDown) {
+      return MoveLines(1);
+    }
+
+    if (event.mouse().button != Mouse::Left ||
+        event.mouse().motion != Mouse::Pressed) {
+      return false;
+    }
+
+    TakeFocus();
+    // The rows are one line tall: the row under the mouse is found from the
+    // row of the cursor.
+    cursor_line() =
+        util::clamp(cursor_line() + event.mouse().y - cursor_row_box_.y_min, 0,
+                    int(lines_.size()) - 1);
+    cursor_column() = CurrentLine().GlyphAtCell(scroll_x_ + event.mouse().x -
+                                                box_.x_min);
+    ResetDesiredCell();
+    return true;
+  }
+
+  bool Focusable() const final { return true; }
+
+  StringRef content_;
+  Ref<TextAreaOption> option_;
+  // The content split into |lines_|. Always at least one line.
+  std::vector<Line> lines_ = {Line()};
+  std::string synced_;
+  // Whether |lines_| has edits not copied into |content_| yet.
+  bool dirty_ = false;
+  size_t next_version_ = 1;
+
+  // The cell kept by the vertical moves, or -1.
+  int desired_cell_ = -1;
+  int scroll_x_ = 0;
+
+  // The rows drawn by this frame and by the previous one, by version of their
+  // line. They are only valid for |rows_scroll_x_| and |rows_width_|.
+  std::string key_;
+  std::unordered_map<size_t, Element> rows_;
+  std::unordered_map<size_t, Element> previous_rows_;
+  int rows_scroll_x_ = 0;
+  int rows_width_ = 0;
+
+  Box box_ = {0, -1, 0, -1};
+  Box cursor_row_box_;
+};
+
+}  // namespace
+
+/// @brief A multi-line text editor, for large contents.
+/// @param content The editable content. The lines are separated by '\n'.
+/// @param option Additional optional parameters.
+/// @ingroup component
+///
+/// The rows are created only when visible, and only the edited ones are drawn
+/// again. The content is updated once per frame, instead of after every edit.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// std::string content = "first line\nsecond line";
+/// Component text_area = TextArea(&content);
+/// screen.Loop(text_area | border);
+/// ```
+Component TextArea(StringRef content, Ref<TextAreaOption> option) {
+  return Make<TextAreaBase>(std::move(content), std::move(option));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+
+#include "ftxui/component/component.hpp"       // for TextArea
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/component_options.hpp"  // for TextAreaOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowUp, Event::Backspace, Event::Delete, Event::End, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
+#include "ftxui/dom/elements.hpp"     // for Element
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+std::string Draw(Component component, int width, int height) {
+  auto screen = Screen(width, height);
+  Render(screen, component->Render());
+  return screen.ToString();
+}
+}  // namespace
+
+TEST(TextAreaTest, Type) {
+  std::string content;
+  auto option = TextAreaOption();
+  option.cursor_line = 0;
+  option.cursor_column = 0;
+  Component text_area = TextArea(&content, &option);
+
+  text_area->OnEvent(Event::Character('a'));
+  text_area->OnEvent(Event::Return);
+  text_area->OnEvent(Event::Character('b'));
+  text_area->OnEvent(Event::Character('c'));
+  EXPECT_EQ(option.cursor_line(), 1);
+  EXPECT_EQ(option.cursor_column(), 2);
+
+  // The content is updated by the next frame.
+  EXPECT_EQ(content, "");
+  (void)text_area->Render();
+  EXPECT_EQ(content, "a\nbc");
+
+  // Join the lines.
+  text_area->OnEvent(Event::Home);
+  text_area->OnEvent(Event::Backspace);
+  EXPECT_EQ(option.cursor_line(), 0);
+  EXPECT_EQ(option.cursor_column(), 1);
+  (void)text_area->Render();
+  EXPECT_EQ(content, "abc");
+
+  // Split, and join again using Delete.
+  text_area->OnEvent(Event::Return);
+  text_area->OnEvent(Event::ArrowLeft);
+  text_area->OnEvent(Event::Delete);
+  (void)text_area->Render();
+  EXPECT_EQ(content, "abc");
+  text_area->OnEvent(Event::End);
+  EXPECT_FALSE(text_area->OnEvent(Event::Delete));
+}
+
+TEST(TextAreaTest, Paste) {
+  std::string content = "ad";
+  auto option = TextAreaOption();
+  option.cursor_line = 0;
+  option.cursor_column = 1;
+  Component text_area = TextArea(&content, &option);
+
+  EXPECT_TRUE(text_area->OnEvent(Event::Paste("b\r\n\xC3\xA9\nc")));
+  EXPECT_EQ(option.cursor_line(), 2);
+  EXPECT_EQ(option.cursor_column(), 1);
+  (void)text_area->Render();
+  EXPECT_EQ(content, "ab\n\xC3\xA9\ncd");
+}
+
+// The content is updated before |on_change| is called.
+TEST(TextAreaTest, OnChange) {
+  std::string content = "ab";
+  std::string changed;
+  auto option = TextAreaOption();
+  option.cursor_line = 0;
+  option.cursor_column = 2;
+  option.on_change = [&] { changed = content; };
+  Component text_area = TextArea(&content, &option);
+
+  EXPECT_TRUE(text_area->OnEvent(Event::Character('c')));
+  EXPECT_EQ(changed, "abc");
+  EXPECT_TRUE(text_area->OnEvent(Event::Return));
+  EXPECT_EQ(changed, "abc\n");
+  EXPECT_TRUE(text_area->OnEvent(Event::Paste("d\ne")));
+  EXPECT_EQ(changed, "abc\nd\ne");
+  EXPECT_TRUE(text_area->OnEvent(Event::Backspace));
+  EXPECT_EQ(changed, "abc\nd\n");
+}
+
+TEST(TextAreaTest, VerticalMoves) {
+  std::string content = "abcdef\nx\n\xE4\xB8\xAD\xE4\xB8\xAD\xE4\xB8\xAD";
+  auto option = TextAreaOption();
+  option.cursor_line = 0;
+  option.cursor_column = 4;
+  Component text_area = TextArea(&content, &option);
+
+  // The cell of the cursor is kept across the shorter lines.
+  EXPECT_TRUE(text_area->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(option.cursor_column(), 1);
+  EXPECT_TRUE(text_area->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(option.cursor_line(), 2);
+  EXPECT_EQ(option.cursor_column(), 2);  // Full width glyphs.
+  EXPECT_FALSE(text_area->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(text_area->OnEvent(Event::ArrowUp));
+  EXPECT_TRUE(text_area->OnEvent(Event::ArrowUp));
+  EXPECT_EQ(option.cursor_column(), 4);
+
+  EXPECT_TRUE(text_area->OnEvent(Event::End));
+  EXPECT_TRUE(text_area->OnEvent(Event::ArrowRight));
+  EXPECT_EQ(option.cursor_line(), 1);
+  EXPECT_EQ(option.cursor_column(), 0);
+}
+
+TEST(TextAreaTest, Render) {
+  std::string content = "ab\ncd\nef";
+  Component text_area = TextArea(&content);
+  EXPECT_EQ(Draw(text_area, 4, 3), "ab  \r\ncd  \r\nef  ");
+
+  // Only the edited row changes, the others are copied from the previous
+  // frame.
+  text_area->OnEvent(Event::ArrowDown);
+  text_area->OnEvent(Event::End);
+  text_area->OnEvent(Event::Character('x'));
+  EXPECT_EQ(Draw(text_area, 4, 3), "ab  \r\ncdx \r\nef  ");
+  text_area->OnEvent(Event::ArrowUp);
+  EXPECT_EQ(Draw(text_area, 4, 3), "ab  \r\ncdx \r\nef  ");
+
+  // Modified from the outside.
+  content = "gh";
+  EXPECT_EQ(Draw(text_area, 4, 3), "gh  \r\n    \r\n    ");
+}
+
+TEST(TextAreaTest, LargeContent) {
+  std::string content;
+  const int lines = 20000;
+  for (int i = 0; i < lines; ++i) {
+    content += "line " + std::to_string(i) + "\n";
+  }
+  auto option = TextAreaOption();
+  option.cursor_line = 0;
+  option.cursor_column = 0;
+  Component text_area = TextArea(&content, &option);
+  (void)Draw(text_area, 20, 5);
+
+  option.cursor_line = 9999;
+  text_area->OnEvent(Event::ArrowDown);
+  text_area->OnEvent(Event::Character('>'));
+  const std::string screen = Draw(text_area, 20, 5);
+  EXPECT_NE(screen.find(">line 10000"), std::string::npos);
+  EXPECT_NE(content.find("\n>line 10000\n"), std::string::npos);
+}
+
+TEST(TextAreaTest, MouseClick) {
+  std::string content = "abc\ndef\nghi";
+  auto option = TextAreaOption();
+  option.cursor_line = 0;
+  option.cursor_column = 0;
+  Component text_area = TextArea(&content, &option);
+  (void)Draw(text_area, 5, 3);
+
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = Mouse::Pressed;
+  mouse.x = 2;
+  mouse.y = 2;
+  EXPECT_TRUE(text_area->OnEvent(Event::Mouse("", mouse)));
+  EXPECT_EQ(option.cursor_line(), 2);
+  EXPECT_EQ(option.cursor_column(), 2);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
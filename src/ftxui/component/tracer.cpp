@@ -0,0 +1,133 @@
+#include "ftxui/component/tracer.hpp"
+
+#include <array>    // for array
+#include <chrono>   // for duration, nanoseconds
+#include <cstdio>   // for snprintf
+#include <mutex>    // for lock_guard
+#include <string>   // for string, to_string
+#include <tuple>    // for ignore
+
+namespace ftxui {
+
+namespace {
+
+const char* ThreadName(Tracer::Thread thread) {
+  switch (thread) {
+    case Tracer::Thread::Loop:
+      return "Loop";
+    case Tracer::Thread::EventListener:
+      return "EventListener";
+    case Tracer::Thread::AnimationListener:
+      return "AnimationListener";
+  }
+  return "";
+}
+
+int ThreadId(Tracer::Thread thread) {
+  return int(thread) + 1;
+}
+
+// A time in microseconds, with a nanosecond precision.
+std::string Microseconds(std::chrono::nanoseconds time) {
+  std::array<char, 32> buffer = {};
+  std::ignore = std::snprintf(buffer.data(), buffer.size(), "%.3f",  // NOLINT
+                              double(time.count()) / 1000.0);        // NOLINT
+  return buffer.data();
+}
+
+// The names are expected to be identifiers. Escape them anyway.
+void AppendString(std::string& out, const char* value) {
+  out += '"';
+  for (const char* c = value; *c; ++c) {
+    if (*c == '"' || *c == '\\') {
+      out += '\\';
+    }
+    if ((unsigned char)(*c) >= ' ') {
+      out += *c;
+    }
+  }
+  out += '"';
+}
+
+}  // namespace
+
+/// @brief Record a span of |thread|, from |begin| to |end|.
+/// @param name The name of the span. It isn't copied: it must outlive the
+/// tracer, like a string literal.
+void Tracer::Span(Thread thread,
+                  const char* name,
+                  Clock::time_point begin,
+                  Clock::time_point end) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  entries_.push_back({thread, name, begin, end, false});
+}
+
+/// @brief Record an instant of |thread|.
+/// @param name The name of the instant. It must outlive the tracer.
+void Tracer::Instant(Thread thread, const char* name, Clock::time_point time) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  entries_.push_back({thread, name, time, time, true});
+}
+
+/// @brief The number of spans and instants recorded.
+size_t Tracer::size() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+/// @brief Forget everything recorded so far.
+void Tracer::Clear() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+/// @brief The recording, in the Chrome Trace Event JSON format.
+std::string Tracer::ToJson() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  std::string out = "{\"traceEvents\":[";
+  bool first = true;
+  auto separate = [&] {
+    if (!first) {
+      out += ",\n";
+    }
+    first = false;
+  };
+
+  for (const Thread thread : {
+           Thread::Loop,
+           Thread::EventListener,
+           Thread::AnimationListener,
+       }) {
+    separate();
+    out += R"({"name":"thread_name","ph":"M","pid":1,"tid":)";
+    out += std::to_string(ThreadId(thread));
+    out += R"(,"args":{"name":)";
+    AppendString(out, ThreadName(thread));
+    out += "}}";
+  }
+
+  for (const Entry& entry : entries_) {
+    separate();
+    out += R"({"name":)";
+    AppendString(out, entry.name);
+    out += R"(,"cat":"ftxui","pid":1,"tid":)";
+    out += std::to_string(ThreadId(entry.thread));
+    out += R"(,"ts":)";
+    out += Microseconds(entry.begin - origin_);
+    if (entry.instant) {
+      out += R"(,"ph":"i","s":"t"})";
+    } else {
+      out += R"(,"ph":"X","dur":)";
+      out += Microseconds(entry.end - entry.begin);
+      out += "}";
+    }
+  }
+  out += "]}\n";
+  return out;
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <chrono>  // for microseconds
+#include <string>  // for string
+
+#include "ftxui/component/component.hpp"  // for Renderer
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/component/tracer.hpp"              // for Tracer
+#include "ftxui/dom/elements.hpp"                  // for text
+
+namespace ftxui {
+
+TEST(TracerTest, Json) {
+  Tracer tracer;
+  const auto start = Tracer::Clock::now();
+  tracer.Span(Tracer::Thread::Loop, "Frame", start,
+              start + std::chrono::microseconds(1500));
+  tracer.Instant(Tracer::Thread::AnimationListener, "Wake\"Up", start);
+  EXPECT_EQ(tracer.size(), 2u);
+
+  const std::string json = tracer.ToJson();
+  EXPECT_EQ(json.find("{\"traceEvents\":["), 0u);
+  EXPECT_NE(json.find(R"("args":{"name":"EventListener"})"), std::string::npos);
+  EXPECT_NE(json.find(R"({"name":"Frame","cat":"ftxui","pid":1,"tid":1,)"),
+            std::string::npos);
+  EXPECT_NE(json.find(R"("ph":"X","dur":1500.000})"), std::string::npos);
+  EXPECT_NE(json.find(R"("name":"Wake\"Up")"), std::string::npos);
+  EXPECT_NE(json.find(R"("ph":"i","s":"t"})"), std::string::npos);
+
+  tracer.Clear();
+  EXPECT_EQ(tracer.size(), 0u);
+}
+
+TEST(TracerTest, ScreenInteractive) {
+  auto component = Renderer([] { return text("hello"); });
+  Tracer tracer;
+  auto screen = ScreenInteractive::Headless(10, 1);
+  screen.Trace(&tracer);
+  Loop loop(&screen, component);
+  screen.FeedInput("a");
+  screen.Post([] {});
+  loop.RunOnce();
+
+  const std::string json = tracer.ToJson();
+  for (const char* name : {
+           "Event",
+           "Closure",
+           "Frame",
+           "Render",
+           "ComputeRequirement",
+           "Layout",
+           "Draw",
+           "Shaders",
+           "Encode",
+           "Write",
+       }) {
+    EXPECT_NE(json.find(std::string("\"name\":\"") + name + "\""),
+              std::string::npos)
+        << name;
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,308 @@
+#include <algorithm>      // for clamp, max, min
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint64_t
+#include <memory>         // for make_shared, shared_ptr
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
+#include "ftxui/component/async.hpp"      // for RunInBackground
+#include "ftxui/component/component.hpp"  // for TreeView, Make
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for TreeEntry, TreeViewOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"  // for text, hbox, virtualList, reflect, vscroll_indicator, yframe, inverted, bold, dim, Element
+#include "ftxui/screen/box.hpp"    // for Box
+#include "ftxui/util/ref.hpp"      // for Ref
+
+namespace ftxui {
+
+namespace {
+
+class TreeViewBase : public ComponentBase {
+ public:
+  TreeViewBase(std::vector<TreeEntry> roots, Ref<TreeViewOption> option)
+      : option_(std::move(option)) {
+    for (auto& entry : roots) {
+      rows_.push_back({std::move(entry), 0, false, false});
+    }
+  }
+
+  ~TreeViewBase() override { *alive_ = false; }
+  TreeViewBase(const TreeViewBase&) = delete;
+  TreeViewBase(TreeViewBase&&) = delete;
+  TreeViewBase& operator=(const TreeViewBase&) = delete;
+  TreeViewBase& operator=(TreeViewBase&&) = delete;
+
+ private:
+  // A visible entry: the roots, and the descendants of the expanded entries.
+  struct Row {
+    TreeEntry entry;
+    int depth = 0;
+    bool expanded = false;
+    bool loading = false;
+  };
+
+  Element Render() override {
+    Clamp();
+    const bool focused = Focused();
+    return virtualList(
+               int(rows_.size()), 1,
+               [this, focused](int i) { return RenderRow(i, focused); },
+               selected_) |
+           vscroll_indicator | yframe | reflect(box_);
+  }
+
+  Element RenderRow(int i, bool focused) const {
+    const Row& row = rows_[size_t(i)];
+    const char* prefix = "  ";
+    if (row.loading) {
+      prefix = "… ";
+    } else if (row.entry.expandable) {
+      prefix = row.expanded ? "▾ " : "▸ ";
+    }
+    Element element = hbox({
+        text(std::string(size_t(row.depth) * 2, ' ')),
+        text(prefix),
+        text(row.entry.label),
+    });
+    if (i != selected_) {
+      return element;
+    }
+    return focused ? element | inverted : element | bold;
+  }
+
+  bool HandleEvent(const Event& event) override {
+    if (event.is_mouse()) {
+      return OnMouseEvent(event);
+    }
+    if (!Focused() || rows_.empty()) {
+      return false;
+    }
+
+    const int old_selected = selected_;
+    const int page = box_.y_max - box_.y_min;
+    const Row& row = rows_[size_t(selected_)];
+    if (event == Event::ArrowUp || event == Event::Character('k')) {
+      selected_--;
+    } else if (event == Event::ArrowDown || event == Event::Character('j')) {
+      selected_++;
+    } else if (event == Event::PageUp) {
+      selected_ -= page;
+    } else if (event == Event::PageDown) {
+      selected_ += page;
+    } else if (event == Event::Home) {
+      selected_ = 0;
+    } else if (event == Event::End) {
+      selected_ = int(rows_.size()) - 1;
+    } else if (event == Event::ArrowRight || event == Event::Character('l')) {
+      if (row.entry.expandable && !row.expanded) {
+        Expand(size_t(selected_));
+        return true;
+      }
+      // The first child.
+      if (row.expanded && size_t(selected_) + 1 < rows_.size() &&
+          rows_[size_t(selected_) + 1].depth > row.depth) {
+        selected_++;
+      }
+    } else if (event == Event::ArrowLeft || event == Event::Character('h')) {
+      if (row.expanded) {
+        Collapse(size_t(selected_));
+        return true;
+      }
+      // The parent.
+      int parent = selected_ - 1;
+      while (parent >= 0 && rows_[size_t(parent)].depth >= row.depth) {
+        parent--;
+      }
+      if (parent >= 0) {
+        selected_ = parent;
+      }
+    } else if (event == Event::Character(' ')) {
+      if (row.expanded) {
+        Collapse(size_t(selected_));
+      } else {
+        Expand(size_t(selected_));
+      }
+      return true;
+    } else if (event == Event::Return) {
+      if (option_->on_enter) {
+        option_->on_enter(row.entry);
+      }
+      return true;
+    } else {
+      return false;
+    }
+
+    Clamp();
+    if (selected_ == old_selected) {
+      return false;
+    }
+    OnChange();
+    return true;
+  }
+
+  bool OnMouseEvent(const Event& event) {
+    if (!box_.Contain(event.mouse().x, event.mouse().y)) {
+      return false;
+    }
+    const int old_selected = selected_;
+    if (event.mouse().button == Mouse::WheelUp) {
+      selected_--;
+    } else if (event.mouse().button == Mouse::WheelDown) {
+      selected_++;
+    } else {
+      return false;
+    }
+    Clamp();
+    TakeFocus();
+    if (selected_ != old_selected) {
+      OnChange();
+    }
+    return true;
+  }
+
+  // Show the children of the |i|-th row, loading them the first time.
+  void Expand(size_t i) {
+    Row& row = rows_[i];
+    if (!row.entry.expandable || row.expanded) {
+      return;
+    }
+    row.expanded = true;
+    const uint64_t id = row.entry.id;
+    auto it = children_.find(id);
+    if (it != children_.end()) {
+      Insert(i, it->second);
+      return;
+    }
+    if (!option_->children) {
+      return;
+    }
+    if (!option_->async) {
+      Insert(i, children_[id] = option_->children(row.entry));
+      return;
+    }
+
+    row.loading = true;
+    auto children = std::make_shared<std::vector<TreeEntry>>();
+    RunInBackground(
+        [children, load = option_->children, entry = row.entry] {
+          *children = load(entry);
+        },
+        [this, alive = alive_, children, id] {
+          if (*alive) {
+            OnLoaded(id, std::move(*children));
+          }
+        });
+  }
+
+  void OnLoaded(uint64_t id, std::vector<TreeEntry> children) {
+    const auto& loaded = children_[id] = std::move(children);
+    // The row might have moved, or been collapsed and hidden, meanwhile.
+    for (size_t i = 0; i < rows_.size(); ++i) {
+      Row& row = rows_[i];
+      if (row.entry.id == id && row.loading) {
+        row.loading = false;
+        if (row.expanded) {
+          Insert(i, loaded);
+        }
+        break;
+      }
+    }
+    if (auto* screen = ScreenInteractive::Active()) {
+      screen->RequestRedraw();
+    }
+  }
+
+  // Insert |children| below the |i|-th row.
+  void Insert(size_t i, const std::vector<TreeEntry>& children) {
+    const int depth = rows_[i].depth + 1;
+    std::vector<Row> rows;
+    rows.reserve(children.size());
+    for (const auto& entry : children) {
+      rows.push_back({entry, depth, false, false});
+    }
+    rows_.insert(rows_.begin() + long(i) + 1, rows.begin(), rows.end());
+    if (size_t(selected_) > i) {
+      selected_ += int(children.size());
+    }
+  }
+
+  // Hide the descendants of the |i|-th row. Their children stay loaded.
+  void Collapse(size_t i) {
+    Row& row = rows_[i];
+    row.expanded = false;
+    row.loading = false;
+    size_t end = i + 1;
+    while (end < rows_.size() && rows_[end].depth > row.depth) {
+      ++end;
+    }
+    rows_.erase(rows_.begin() + long(i) + 1, rows_.begin() + long(end));
+    if (size_t(selected_) >= end) {
+      selected_ -= int(end - i - 1);
+    } else if (size_t(selected_) > i) {
+      selected_ = int(i);
+      OnChange();
+    }
+  }
+
+  void OnChange() {
+    if (option_->on_change) {
+      option_->on_change(rows_[size_t(selected_)].entry);
+    }
+  }
+
+  void Clamp() {
+    selected_ = std::clamp(selected_, 0, std::max(0, int(rows_.size()) - 1));
+  }
+
+  bool Focusable() const final { return !rows_.empty(); }
+
+  Ref<TreeViewOption> option_;
+  std::vector<Row> rows_;
+  // The children of the entries expanded once, by id.
+  std::unordered_map<uint64_t, std::vector<TreeEntry>> children_;
+  int selected_ = 0;
+  Box box_;
+  // Whether the component still exists, when the children are loaded.
+  std::shared_ptr<bool> alive_ = std::make_shared<bool>(true);
+};
+
+}  // namespace
+
+/// @brief A tree of entries, whose children are loaded when their parent is
+/// expanded. Only the rows of the expanded entries exist, and only the visible
+/// ones are rendered, so the tree can have millions of entries.
+///
+/// Use the arrow keys to move, expand (right) and collapse (left) the entries,
+/// or space to toggle them. Moving up and down is constant time.
+/// @param roots The entries at the top of the tree.
+/// @param option How to load the children, and the observers.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// TreeViewOption option;
+/// option.children = [](const TreeEntry& parent) {
+///   std::vector<TreeEntry> children;
+///   for (const auto& file : ListDirectory(paths[parent.id])) {
+///     children.push_back({file.name, AddPath(file.path), file.is_directory});
+///   }
+///   return children;
+/// };
+/// option.async = true;
+/// auto tree = TreeView({{"/", AddPath("/"), true}}, option);
+/// ```
+Component TreeView(std::vector<TreeEntry> roots, Ref<TreeViewOption> option) {
+  return Make<TreeViewBase>(std::move(roots), std::move(option));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <chrono>   // for milliseconds
+#include <cstdint>  // for uint64_t
+#include <string>   // for string, to_string
+#include <thread>   // for this_thread::sleep_for
+#include <vector>   // for vector
+
+#include "ftxui/component/component.hpp"          // for TreeView
+#include "ftxui/component/component_options.hpp"  // for TreeEntry, TreeViewOption
+#include "ftxui/component/event.hpp"              // for Event
+#include "ftxui/component/loop.hpp"               // for Loop
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/elements.hpp"                  // for Element
+#include "ftxui/dom/node.hpp"                      // for Render
+#include "ftxui/screen/screen.hpp"                 // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// A complete tree: every entry has 1000 children, named after their path.
+TreeViewOption Option(int* loads) {
+  TreeViewOption option;
+  option.children = [loads](const TreeEntry& parent) {
+    ++*loads;
+    std::vector<TreeEntry> children;
+    for (uint64_t i = 0; i < 1000; ++i) {  // NOLINT
+      TreeEntry child;
+      child.label = parent.label + "." + std::to_string(i);
+      child.id = parent.id * 1000 + i + 1;  // NOLINT
+      child.expandable = true;
+      children.push_back(child);
+    }
+    return children;
+  };
+  return option;
+}
+
+std::string Draw(Component component) {
+  Screen screen(12, 3);
+  Render(screen, component->Render());
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(TreeViewTest, ExpandAndCollapse) {
+  int loads = 0;
+  TreeEntry root;
+  root.label = "r";
+  root.expandable = true;
+  std::string changed;
+  TreeViewOption option = Option(&loads);
+  option.on_change = [&](const TreeEntry& entry) { changed = entry.label; };
+  auto tree = TreeView({root}, option);
+
+  EXPECT_EQ(Draw(tree), "\x1B[7m▸ r         \x1B[0m\r\n            \r\n            ");
+  EXPECT_EQ(loads, 0);
+
+  EXPECT_TRUE(tree->OnEvent(Event::ArrowRight));
+  EXPECT_EQ(loads, 1);
+  EXPECT_TRUE(tree->OnEvent(Event::ArrowRight));
+  EXPECT_EQ(changed, "r.0");
+  EXPECT_TRUE(tree->OnEvent(Event::ArrowRight));
+  EXPECT_EQ(loads, 2);
+  EXPECT_TRUE(tree->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(changed, "r.0.0");
+  // The rows, and the scroll indicator.
+  EXPECT_EQ(Draw(tree), "  ▾ r.0    ┃\r\n"
+                        "\x1B[7m    ▸ r.0.0\x1B[0m \r\n"
+                        "    ▸ r.0.1 ");
+
+  // To the last of the 2000 rows, and back to the parent.
+  EXPECT_TRUE(tree->OnEvent(Event::End));
+  EXPECT_EQ(changed, "r.999");
+  EXPECT_TRUE(tree->OnEvent(Event::ArrowLeft));
+  EXPECT_EQ(changed, "r");
+
+  // Collapsed: the children stay loaded.
+  EXPECT_TRUE(tree->OnEvent(Event::ArrowLeft));
+  EXPECT_FALSE(tree->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(tree->OnEvent(Event::Character(' ')));
+  EXPECT_EQ(loads, 2);
+  EXPECT_TRUE(tree->OnEvent(Event::End));
+  EXPECT_EQ(changed, "r.999");
+}
+
+TEST(TreeViewTest, Async) {
+  int loads = 0;
+  TreeEntry root;
+  root.label = "r";
+  root.expandable = true;
+  TreeViewOption option = Option(&loads);
+  option.async = true;
+  auto tree = TreeView({root}, option);
+
+  auto screen = ScreenInteractive::Headless(12, 3);
+  Loop loop(&screen, tree);
+  loop.RunOnce();
+  screen.PostEvent(Event::ArrowRight);
+  loop.RunOnce();
+  EXPECT_NE(screen.TakeOutput().find("… r"), std::string::npos);
+  for (int i = 0; i < 1000 && loads == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  for (int i = 0; i < 100; ++i) {
+    loop.RunOnce();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  const std::string output = screen.TakeOutput();
+  EXPECT_NE(output.find("▾ r"), std::string::npos);
+  EXPECT_NE(output.find("r.1"), std::string::npos);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
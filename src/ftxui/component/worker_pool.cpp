@@ -0,0 +1,103 @@
+#include "ftxui/component/worker_pool.hpp"
+
+#include <utility>  // for move
+
+namespace ftxui {
+
+namespace {
+// The index of the queue of the current thread, if it belongs to a pool.
+thread_local const WorkerPool* g_pool = nullptr;  // NOLINT
+thread_local size_t g_queue = 0;                  // NOLINT
+}  // namespace
+
+WorkerPool::WorkerPool(int threads) {
+  for (int i = 0; i < threads; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  for (size_t i = 0; i < queues_.size(); ++i) {
+    threads_.emplace_back([this, i] { Work(i); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkerPool::Submit(std::function<void()> job) {
+  size_t index = 0;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (g_pool == this) {
+      index = g_queue;
+    } else {
+      index = next_queue_;
+      next_queue_ = (next_queue_ + 1) % queues_.size();
+    }
+    pending_++;
+  }
+  {
+    Queue& queue = *queues_[index];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.jobs.push_back(std::move(job));
+  }
+  wake_.notify_one();
+}
+
+// Take the newest job of the queue |index|, or else the oldest job of another
+// one.
+bool WorkerPool::Pop(size_t index, std::function<void()>& job) {
+  {
+    Queue& queue = *queues_[index];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+      return true;
+    }
+  }
+  for (size_t i = 1; i < queues_.size(); ++i) {
+    Queue& queue = *queues_[(index + i) % queues_.size()];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkerPool::Work(size_t index) {
+  g_pool = this;
+  g_queue = index;
+  std::function<void()> job;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [this] { return quit_ || pending_ != 0; });
+      if (quit_) {
+        return;
+      }
+      // Claim a job. It is in one of the queues, or about to be.
+      pending_--;
+    }
+    while (!Pop(index, job)) {
+      std::this_thread::yield();
+    }
+    job();
+    job = nullptr;
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,63 @@
+#ifndef FTXUI_COMPONENT_WORKER_POOL_HPP
+#define FTXUI_COMPONENT_WORKER_POOL_HPP
+
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <deque>               // for deque
+#include <functional>          // for function
+#include <memory>              // for unique_ptr
+#include <mutex>               // for mutex
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+namespace ftxui {
+
+// A pool of threads running the jobs of ScreenInteractive::RunAsync().
+//
+// Every thread has its own queue. The jobs submitted by a thread of the pool
+// go to its own queue, the others are spread over the queues in turn. A thread
+// runs the newest job of its queue first, and once it is empty, steals the
+// oldest job of the other queues.
+//
+// The pool is separated from the LayoutPool: a long job would otherwise hold a
+// frame back until it returns.
+class WorkerPool {
+ public:
+  explicit WorkerPool(int threads);
+  // Wait for the running jobs. The queued ones are dropped.
+  ~WorkerPool();
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool(WorkerPool&&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+  WorkerPool& operator=(WorkerPool&&) = delete;
+
+  void Submit(std::function<void()> job);
+
+  size_t size() const { return queues_.size(); }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> jobs;  // Guarded by |mutex|.
+  };
+
+  void Work(size_t index);
+  bool Pop(size_t index, std::function<void()>& job);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  size_t next_queue_ = 0;  // Guarded by |mutex_|.
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  size_t pending_ = 0;  // Guarded by |mutex_|.
+  bool quit_ = false;   // Guarded by |mutex_|.
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_WORKER_POOL_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
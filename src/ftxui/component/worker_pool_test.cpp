@@ -0,0 +1,64 @@
+#include "ftxui/component/worker_pool.hpp"
+#include <gtest/gtest.h>
+#include <atomic>   // for atomic
+#include <chrono>   // for milliseconds
+#include <mutex>    // for mutex, lock_guard
+#include <set>      // for set
+#include <thread>   // for this_thread, thread::id
+
+namespace ftxui {
+
+namespace {
+
+void WaitFor(const std::atomic<int>& count, int expected) {
+  for (int i = 0; i < 5000 && count != expected; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+}  // namespace
+
+TEST(WorkerPoolTest, RunsEveryJob) {
+  std::atomic<int> count = 0;
+  {
+    WorkerPool pool(3);
+    EXPECT_EQ(pool.size(), 3u);
+    for (int i = 0; i < 100; ++i) {
+      pool.Submit([&] { count++; });
+    }
+    WaitFor(count, 100);
+  }
+  EXPECT_EQ(count, 100);
+}
+
+TEST(WorkerPoolTest, NestedJobsAreStolen) {
+  WorkerPool pool(4);
+  std::atomic<int> count = 0;
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+
+  // The jobs submitted by a job go to the queue of its thread. The idle
+  // threads steal them.
+  pool.Submit([&] {
+    for (int i = 0; i < 64; ++i) {
+      pool.Submit([&] {
+        {
+          const std::lock_guard<std::mutex> lock(mutex);
+          threads.insert(std::this_thread::get_id());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        count++;
+      });
+    }
+  });
+  WaitFor(count, 64);
+  EXPECT_EQ(count, 64);
+  const std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_GT(threads.size(), 1u);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -10,6 +10,8 @@
 namespace ftxui {
 
 /// @brief Enable character to be automatically merged with others nearby.
+/// The custom elements drawing box characters can use it, instead of setting
+/// `automerge` and declaring their area with Screen::AddAutoMergeRegion().
 /// @ingroup dom
 Element automerge(Element child) {
   class Impl : public NodeDecorator {
@@ -22,11 +24,12 @@ Element automerge(Element child) {
           screen.PixelAt(x, y).automerge = true;
         }
       }
+      screen.AddAutoMergeRegion(box_);
       Node::Render(screen);
     }
   };
 
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,47 @@
+#include "ftxui/dom/benchmark_allocations.hpp"
+
+#include <atomic>   // for atomic, memory_order_relaxed
+#include <cstddef>  // for size_t
+#include <cstdlib>  // for malloc, free
+#include <new>      // for bad_alloc
+
+namespace {
+std::atomic<size_t> g_allocation_count = 0;  // NOLINT
+std::atomic<size_t> g_allocated_bytes = 0;   // NOLINT
+}  // namespace
+
+// The array, nothrow, and sized variants forward to these ones. The aligned
+// variants aren't counted.
+void* operator new(size_t size) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  void* pointer = std::malloc(size == 0 ? 1 : size);  // NOLINT
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);  // NOLINT
+}
+
+void operator delete(void* pointer, size_t /*size*/) noexcept {
+  std::free(pointer);  // NOLINT
+}
+
+namespace ftxui {
+
+size_t AllocationCount() {
+  return g_allocation_count.load(std::memory_order_relaxed);
+}
+
+size_t AllocatedBytes() {
+  return g_allocated_bytes.load(std::memory_order_relaxed);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
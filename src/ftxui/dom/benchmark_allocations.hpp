@@ -0,0 +1,52 @@
+#ifndef FTXUI_DOM_BENCHMARK_ALLOCATIONS_HPP
+#define FTXUI_DOM_BENCHMARK_ALLOCATIONS_HPP
+
+#include <benchmark/benchmark.h>
+#include <cstddef>  // for size_t
+
+namespace ftxui {
+
+// The benchmark binary replaces the global operator new, to count the
+// allocations of every thread.
+size_t AllocationCount();
+size_t AllocatedBytes();
+
+// Report the allocations made from its construction to its destruction, as
+// the "allocs" and "bytes" counters of |state|, per iteration.
+//
+// static void BenchmarkFoo(benchmark::State& state) {
+//   const AllocationCounter counter(state);
+//   while (state.KeepRunning()) {
+//     ...
+//   }
+// }
+class AllocationCounter {
+ public:
+  explicit AllocationCounter(benchmark::State& state)
+      : state_(state), count_(AllocationCount()), bytes_(AllocatedBytes()) {}
+  ~AllocationCounter() {
+    state_.counters["allocs"] =
+        benchmark::Counter(double(AllocationCount() - count_),
+                           benchmark::Counter::kAvgIterations);
+    state_.counters["bytes"] =
+        benchmark::Counter(double(AllocatedBytes() - bytes_),
+                           benchmark::Counter::kAvgIterations);
+  }
+  AllocationCounter(const AllocationCounter&) = delete;
+  AllocationCounter(AllocationCounter&&) = delete;
+  AllocationCounter& operator=(const AllocationCounter&) = delete;
+  AllocationCounter& operator=(AllocationCounter&&) = delete;
+
+ private:
+  benchmark::State& state_;
+  size_t count_;
+  size_t bytes_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_BENCHMARK_ALLOCATIONS_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
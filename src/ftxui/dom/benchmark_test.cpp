@@ -1,12 +1,34 @@
 #include <benchmark/benchmark.h>
+#include <algorithm>   // for min
+#include <cstdio>      // for remove
+#include <filesystem>  // for temp_directory_path
+#include <fstream>     // for ofstream
+#include <functional>  // for function
+#include <memory>      // for make_shared
+#include <optional>  // for optional
+#include <string>    // for to_string, operator+
+#include <utility>   // for move
+#include <vector>    // for vector
 
+#include "ftxui/dom/benchmark_allocations.hpp"  // for AllocationCounter
+#include "ftxui/dom/canvas.hpp"    // for Canvas
 #include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
+#include "ftxui/dom/frame_arena.hpp"  // for FrameArena
+#include "ftxui/dom/layout_pool.hpp"  // for LayoutPool
+#include "ftxui/dom/log_buffer.hpp"   // for LogBuffer
+#include "ftxui/dom/mapped_file.hpp"  // for MappedFile
 #include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/table.hpp"     // for Table, VirtualTable
+#include "ftxui/dom/text_document.hpp"  // for TextDocument
+#include "ftxui/dom/time_series.hpp"  // for TimeSeries
+#include "ftxui/screen/color.hpp"   // for Color
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 namespace ftxui {
 
-static void BencharkBasic(benchmark::State& state) {
+// A small dashboard, built and rendered on a screen of state.range(0) rows.
+static void BenchmarkBasic(benchmark::State& state) {
+  Screen screen(80, static_cast<int>(state.range(0)));
   while (state.KeepRunning()) {
     auto document = vbox({
                         text("Test"),
@@ -22,12 +44,549 @@ static void BencharkBasic(benchmark::State& state) {
                         text("Test"),
                     }) |
                     border;
-    auto root = gauge(1.0);
-    Screen screen(80, state.range(0));
-    Render(screen, root);
+    Render(screen, document);
   }
 }
-BENCHMARK(BencharkBasic)->DenseRange(0, 256, 16);
+BENCHMARK(BenchmarkBasic)->DenseRange(0, 256, 16);
+
+// Build, then destroy, a tree of elements. Allocates from a FrameArena when
+// state.range(0) is 1.
+static void BenchmarkBuild(benchmark::State& state) {
+  FrameArena arena;
+  while (state.KeepRunning()) {
+    arena.Reset();
+    std::optional<FrameArena::Scope> scope;
+    if (state.range(0)) {
+      scope.emplace(&arena);
+    }
+    Elements content;
+    for (int i = 0; i < 100; ++i) {
+      content.push_back(hbox({
+          text("Test"),
+          separator(),
+          gauge(0.5) | flex,
+      }) | bold);
+    }
+    auto document = vbox(std::move(content)) | border;
+    benchmark::DoNotOptimize(document);
+  }
+}
+BENCHMARK(BenchmarkBuild)->Arg(0)->Arg(1);
+
+// A log view: many lines of text, laid out and rendered.
+static void BenchmarkText(benchmark::State& state) {
+  Screen screen(120, 100);
+  while (state.KeepRunning()) {
+    Elements lines;
+    for (int i = 0; i < 100; ++i) {
+      lines.push_back(
+          text("[INFO] 2022-06-01 12:34:56 request served in 12ms 测试"));
+    }
+    auto document = vbox(std::move(lines));
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkText);
+
+// Stacked text attributes, over a full screen.
+static void BenchmarkStyle(benchmark::State& state) {
+  Screen screen(120, 100);
+  while (state.KeepRunning()) {
+    Elements lines;
+    for (int i = 0; i < 100; ++i) {
+      lines.push_back(text("Test") | bold | dim | underlined |
+                      color(Color::Red) | bgcolor(Color::Blue) | inverted);
+    }
+    auto document = vbox(std::move(lines));
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkStyle);
+
+// A large element kept across frames, inserted into a new document every
+// frame. Its layout is cached when state.range(0) is 1, and its pixels too
+// when it is 2.
+static void BenchmarkRetained(benchmark::State& state) {
+  Elements rows;
+  for (int i = 0; i < 100; ++i) {
+    rows.push_back(hbox({
+        text("Name") | flex,
+        separator(),
+        text("Value"),
+    }));
+  }
+  Element panel = vbox(std::move(rows)) | border;
+  if (state.range(0) == 1) {
+    panel = panel | retained;
+  }
+  if (state.range(0) == 2) {
+    panel = panel | retained | cached("panel");
+  }
+  Screen screen(80, 102);
+  while (state.KeepRunning()) {
+    auto document = vbox({text("Header"), panel, text("Footer")});
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkRetained)->Arg(0)->Arg(1)->Arg(2);
+
+// A long log, scrolled inside a frame. Only the visible lines are drawn.
+static void BenchmarkFrame(benchmark::State& state) {
+  Elements lines;
+  for (int i = 0; i < 20000; ++i) {
+    lines.push_back(text("[INFO] request served in 12ms"));
+  }
+  lines[10000] = lines[10000] | focus;
+  auto document = vbox(std::move(lines)) | yframe | retained;
+  Screen screen(80, 50);
+  while (state.KeepRunning()) {
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkFrame);
+
+// A million rows result set, rebuilt every frame. Only the visible rows are
+// created.
+static void BenchmarkVirtualList(benchmark::State& state) {
+  Screen screen(80, 50);
+  int selected = 0;
+  while (state.KeepRunning()) {
+    selected = (selected + 7919) % 1'000'000;  // NOLINT
+    auto row = [&](int i) {
+      auto line = text("row " + std::to_string(i));
+      return i == selected ? line | inverted : line;
+    };
+    auto document =
+        virtualList(1'000'000, 1, row, selected) | vscroll_indicator | yframe;
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkVirtualList);
+
+// A 500k rows query result, styled as a Table. Only the visible rows are
+// created.
+static void BenchmarkVirtualTable(benchmark::State& state) {
+  auto table = VirtualTable(500'000, 3, [](int i) {
+    return std::vector<std::string>{std::to_string(i), "name", "value"};
+  });
+  table.SetColumnWidth(0, 6);
+  table.SelectAll().Border(LIGHT);
+  table.SelectAll().SeparatorVertical(LIGHT);
+  table.SelectRow(0).BorderBottom(LIGHT);
+  table.SelectAll().DecorateCellsAlternateRow(dim);
+  Screen screen(80, 50);
+  int selected = 0;
+  while (state.KeepRunning()) {
+    selected = (selected + 7919) % 500'000;  // NOLINT
+    Render(screen, table.Render(selected) | vscroll_indicator | yframe);
+  }
+}
+BENCHMARK(BenchmarkVirtualTable);
+
+// A tag cloud of state.range(0) items, laid out again on every frame.
+static void BenchmarkFlexbox(benchmark::State& state) {
+  Elements tags;
+  for (int i = 0; i < state.range(0); ++i) {
+    tags.push_back(text("tag" + std::to_string(i)) | border);
+  }
+  auto document = hflow(std::move(tags));
+  Screen screen(120, 50);
+  while (state.KeepRunning()) {
+    Render(screen, document);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkFlexbox)->Range(8, 2048);
+
+// A 10KB help text, built again on every frame.
+static void BenchmarkParagraph(benchmark::State& state) {
+  std::string help;
+  while (help.size() < 10000) {
+    help += "Press the arrow keys to move the selection, and enter to open. ";
+  }
+  Screen screen(80, 150);
+  while (state.KeepRunning()) {
+    Render(screen, paragraph(help));
+  }
+}
+BENCHMARK(BenchmarkParagraph);
+
+// A 200x40 grid of metrics, refreshed on every frame.
+static void BenchmarkGridbox(benchmark::State& state) {
+  Screen screen(200, 50);
+  int frame = 0;
+  while (state.KeepRunning()) {
+    frame++;
+    std::vector<Elements> lines;
+    for (int y = 0; y < 40; ++y) {
+      Elements line;
+      for (int x = 0; x < 200; ++x) {
+        line.push_back(text(std::to_string((x * y + frame) % 10)));
+      }
+      lines.push_back(std::move(line));
+    }
+    Render(screen, gridbox(std::move(lines)));
+  }
+}
+BENCHMARK(BenchmarkGridbox);
+
+// A Table of state.range(0) rows, styled like a spreadsheet, built and
+// rendered on every frame.
+static void BenchmarkTable(benchmark::State& state) {
+  std::vector<std::vector<std::string>> cells;
+  for (int i = 0; i < state.range(0); ++i) {
+    cells.push_back({std::to_string(i), "name " + std::to_string(i * 7),
+                     std::to_string(i * 13 % 1000) + "ms"});
+  }
+  Screen screen(80, static_cast<int>(state.range(0)) * 2 + 1);
+  while (state.KeepRunning()) {
+    auto table = Table(cells);
+    table.SelectAll().Border(LIGHT);
+    table.SelectAll().SeparatorVertical(LIGHT);
+    table.SelectRow(0).Decorate(bold);
+    table.SelectRow(0).BorderBottom(DOUBLE);
+    table.SelectColumn(2).DecorateCells(align_right);
+    table.SelectRows(1, -1).DecorateCellsAlternateRow(dim);
+    Render(screen, table.Render());
+  }
+}
+BENCHMARK(BenchmarkTable)->Range(8, 512);
+
+// Plot 10000 points on a 300x100 canvas, and draw it.
+static void BenchmarkCanvas(benchmark::State& state) {
+  Screen screen(150, 25);
+  int frame = 0;
+  while (state.KeepRunning()) {
+    frame++;
+    Canvas c(300, 100);
+    for (int i = 0; i < 10000; ++i) {
+      c.DrawPointOn((i * 7 + frame) % 300, (i * 13) % 100);
+    }
+    Render(screen, canvas(std::move(c)));
+  }
+}
+BENCHMARK(BenchmarkCanvas);
+
+// Draw state.range(0) lines across a 300x100 canvas, with braille points and
+// with blocks.
+static void BenchmarkCanvasLine(benchmark::State& state) {
+  const int lines = static_cast<int>(state.range(0));
+  while (state.KeepRunning()) {
+    Canvas c(300, 100);
+    for (int i = 0; i < lines; ++i) {
+      c.DrawPointLine(i % 300, 0, 299 - i % 300, 99, Color::Red);
+      c.DrawBlockLine(0, i % 100, 299, 99 - i % 100, Color::Blue);
+    }
+    benchmark::DoNotOptimize(c);
+  }
+  state.SetItemsProcessed(state.iterations() * lines * 2);
+}
+BENCHMARK(BenchmarkCanvasLine)->Range(1, 256);
+
+// A latency plot of 50000 samples.
+static void BenchmarkCanvasPolyline(benchmark::State& state) {
+  std::vector<Canvas::Point> points;
+  for (int i = 0; i < 50000; ++i) {
+    points.push_back({i * 300 / 50000, (i * i) % 97});
+  }
+  while (state.KeepRunning()) {
+    Canvas c(300, 100);
+    c.DrawPointPolyline(points, Color::Red);
+    benchmark::DoNotOptimize(c);
+  }
+}
+BENCHMARK(BenchmarkCanvasPolyline);
+
+// A strip chart, kept across frames, and moving by one column on every frame.
+static void BenchmarkCanvasScroll(benchmark::State& state) {
+  Canvas c(300, 100);
+  Screen screen(150, 25);
+  int frame = 0;
+  while (state.KeepRunning()) {
+    frame++;
+    c.Scroll(2);
+    c.DrawPointLine(298, 50, 299, (frame * 37) % 100);
+    Render(screen, canvas(&c));
+  }
+}
+BENCHMARK(BenchmarkCanvasScroll);
+
+// A million samples, with 1000 new ones on every frame.
+static void BenchmarkTimeSeries(benchmark::State& state) {
+  TimeSeries series(1'000'000);
+  int sample = 0;
+  for (int i = 0; i < 1'000'000; ++i) {
+    series.Push(float((sample++ * 37) % 101));
+  }
+  Screen screen(150, 25);
+  while (state.KeepRunning()) {
+    for (int i = 0; i < 1000; ++i) {
+      series.Push(float((sample++ * 37) % 101));
+    }
+    Render(screen, timeSeries(&series));
+  }
+}
+BENCHMARK(BenchmarkTimeSeries);
+
+// Tail 100000 lines of logs, with 100 new ones on every frame.
+static void BenchmarkLogView(benchmark::State& state) {
+  LogBuffer logs(100'000);
+  int line = 0;
+  for (int i = 0; i < 100'000; ++i) {
+    logs.Append("[info] request " + std::to_string(line++) + " served");
+  }
+  Screen screen(80, 50);
+  while (state.KeepRunning()) {
+    for (int i = 0; i < 100; ++i) {
+      logs.Append("[info] request " + std::to_string(line++) + " served");
+    }
+    Render(screen, logView(&logs));
+  }
+}
+BENCHMARK(BenchmarkLogView);
+
+// Scroll through a wrapped 6MB document.
+static void BenchmarkTextDocument(benchmark::State& state) {
+  TextDocument document;
+  for (int i = 0; i < 100'000; ++i) {
+    document.Append("node " + std::to_string(i) +
+                    ": seq scan on orders, filter (amount > 100), cost " +
+                    std::to_string(i * 7) + "\n");
+  }
+  Screen screen(80, 50);
+  int scroll = 0;
+  while (state.KeepRunning()) {
+    scroll = (scroll + 1000) % 100'000;
+    Render(screen, textDocument(&document, /*wrap=*/true) |
+                       focusPosition(0, scroll) | frame | vscroll_indicator);
+  }
+}
+BENCHMARK(BenchmarkTextDocument);
+
+// Scroll through a 60MB log file.
+static void BenchmarkFileView(benchmark::State& state) {
+  const std::string path =
+      (std::filesystem::temp_directory_path() / "ftxui_benchmark.log").string();
+  {
+    std::ofstream out(path, std::ios::binary);
+    for (int i = 0; i < 1'000'000; ++i) {
+      out << "2022-06-01 12:00:00 [info] request " << i << " served in 3ms\n";
+    }
+  }
+  auto file = std::make_shared<MappedFile>(path);
+  file->WaitIndexed();
+  Screen screen(80, 50);
+  int scroll = 0;
+  while (state.KeepRunning()) {
+    scroll = (scroll + 10'007) % 1'000'000;
+    Render(screen, fileView(file) | focusPosition(0, scroll) | frame);
+  }
+  file.reset();
+  std::remove(path.c_str());
+}
+BENCHMARK(BenchmarkFileView);
+
+// Lay out a wallboard of 64 panels, on state.range(0) threads added to the
+// calling one.
+static void BenchmarkParallelLayout(benchmark::State& state) {
+  auto panel = [](int i) {
+    Elements lines;
+    for (int j = 0; j < 20; ++j) {
+      lines.push_back(hbox({
+          text("metric " + std::to_string(j)),
+          filler(),
+          gauge(float((i + j) % 10) / 10.F) | flex,
+          text(std::to_string(i * j)),
+      }));
+    }
+    return window(text("panel " + std::to_string(i)), vbox(std::move(lines)));
+  };
+  std::vector<Elements> rows;
+  for (int y = 0; y < 8; ++y) {
+    Elements row;
+    for (int x = 0; x < 8; ++x) {
+      row.push_back(panel(y * 8 + x));
+    }
+    rows.push_back(std::move(row));
+  }
+  const Element document = gridbox(std::move(rows));
+  LayoutPool pool(static_cast<int>(state.range(0)));
+  const LayoutPool::Scope scope(&pool);
+  while (state.KeepRunning()) {
+    document->ComputeRequirement();
+    document->SetBox({0, 399, 0, 199});
+  }
+}
+BENCHMARK(BenchmarkParallelLayout)->Arg(0)->Arg(1)->Arg(3);
+
+// Draw 8 canvases side by side, on state.range(0) threads added to the calling
+// one.
+static void BenchmarkParallelRender(benchmark::State& state) {
+  Elements canvases;
+  for (int i = 0; i < 8; ++i) {
+    canvases.push_back(canvas(96, 200, [i](Canvas& c) {
+      for (int x = 0; x < 96; x += 2) {
+        c.DrawPointLine(x, 0, 95 - x, 199, Color::Palette256(i * 16 + x));
+      }
+    }));
+  }
+  const Element document = hbox(std::move(canvases));
+  LayoutPool pool(static_cast<int>(state.range(0)));
+  pool.SetParallelRender(true);
+  const LayoutPool::Scope scope(&pool);
+  Screen screen(400, 50);
+  while (state.KeepRunning()) {
+    screen.Clear();
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkParallelRender)->Arg(0)->Arg(3);
+
+// A large screen full of colors, encoded by bands of rows.
+static void BenchmarkParallelOutput(benchmark::State& state) {
+  Screen screen(400, 120);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      screen.PixelAt(x, y).character = "x";
+      screen.PixelAt(x, y).foreground_color = Color::Palette256(x + y);
+      screen.PixelAt(x, y).bold = (x / 3 + y) % 2 == 0;
+    }
+  }
+  LayoutPool pool(static_cast<int>(state.range(0)));
+  screen.SetParallelOutput(
+      [&pool](size_t count, const std::function<void(size_t)>& task) {
+        pool.ParallelFor(count, task);
+      });
+  std::string out;
+  while (state.KeepRunning()) {
+    out.clear();
+    screen.ToString(out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BenchmarkParallelOutput)->Arg(0)->Arg(3);
+
+// A modal hiding most of a complex view.
+static void BenchmarkModal(benchmark::State& state) {
+  Elements columns;
+  for (int x = 0; x < 20; ++x) {
+    Elements rows;
+    for (int y = 0; y < 50; ++y) {
+      rows.push_back(text(std::to_string(x * y)) | border);
+    }
+    columns.push_back(vbox(std::move(rows)) | flex);
+  }
+  const Element modal = text("modal") | center | border | clear_under |
+                        size(WIDTH, EQUAL, 160) | size(HEIGHT, EQUAL, 60) |
+                        center;
+  const Element document = dbox({hbox(std::move(columns)), modal});
+  Screen screen(200, 80);
+  while (state.KeepRunning()) {
+    screen.Clear();
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkModal);
+
+// Borders, separators and gauges, drawing their characters on every cell.
+static void BenchmarkBorderGauge(benchmark::State& state) {
+  Elements rows;
+  for (int y = 0; y < 12; ++y) {
+    Elements cells;
+    for (int x = 0; x < 8; ++x) {
+      cells.push_back(gauge(float(x + y) / 20.F) | border);
+      cells.push_back(separatorHeavy());
+    }
+    rows.push_back(hbox(std::move(cells)));
+    rows.push_back(separatorDouble());
+  }
+  const Element document = vbox(std::move(rows));
+  Screen screen(200, 48);
+  while (state.KeepRunning()) {
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkBorderGauge);
+
+// The document of examples/dom/html_like.cpp, built, rendered, and printed
+// on every frame, with the allocations it makes.
+static void BenchmarkHtmlLike(benchmark::State& state) {
+  const AllocationCounter counter(state);
+  auto img1 = []() { return text("img") | border; };
+  auto img2 = []() { return vbox({text("big"), text("image")}) | border; };
+  Screen screen(80, 30);
+  std::string out;
+  int frame = 0;
+  while (state.KeepRunning()) {
+    frame++;
+    auto document =  //
+        hflow(paragraph("Hello world! Here is an image:"), img1(),
+              paragraph(" Here is a text "), text("underlined ") | underlined,
+              paragraph(" Here is a text "), text("bold ") | bold,
+              paragraph("Hello world! Here is an image:"), img2(),
+              paragraph("Le Lorem Ipsum est simplement du faux texte employé "
+                        "dans la composition et la mise en page avant "
+                        "impression. Le Lorem Ipsum est le faux texte standard "
+                        "de l'imprimerie depuis les années 1500."),
+              paragraph(" Here is a text "), text("dim ") | dim,
+              paragraph("Hello world! Here is an image:"), img1(),
+              paragraph(" Here is a text "), text("red ") | color(Color::Red),
+              paragraph(" A spinner "), spinner(6, frame / 10)) |
+        border;
+    Render(screen, document);
+    out.clear();
+    screen.ToString(out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BenchmarkHtmlLike);
+
+// The document of examples/dom/package_manager.cpp, with state.range(0)
+// downloads, built, rendered, and printed on every frame, with the
+// allocations it makes.
+static void BenchmarkPackageManager(benchmark::State& state) {
+  const AllocationCounter counter(state);
+  const int tasks = static_cast<int>(state.range(0));
+  auto to_text = [](int number) {
+    return text(std::to_string(number)) | size(WIDTH, EQUAL, 3);
+  };
+  Screen screen(80, tasks + 7);
+  std::string out;
+  int frame = 0;
+  while (state.KeepRunning()) {
+    frame++;
+    Elements entries;
+    for (int i = 0; i < tasks; ++i) {
+      const int downloaded = std::min(frame + i, 100);
+      entries.push_back(hbox({
+          text("download file_" + std::to_string(i) + ".png") |
+              (downloaded == 100 ? dim : bold),
+          separator(),
+          to_text(downloaded),
+          text("/"),
+          to_text(100),
+          separator(),
+          gauge(float(downloaded) / 100.F),
+      }));
+    }
+    auto summary = vbox({
+        hbox({text("- done:   "), to_text(frame % 10) | bold}) |
+            color(Color::Green),
+        hbox({text("- active: "), to_text(tasks) | bold}) |
+            color(Color::RedLight),
+        hbox({text("- queue:  "), to_text(0) | bold}) | color(Color::Red),
+    });
+    auto document = vbox({
+        window(text(" Task "), vbox(std::move(entries))),
+        hbox({window(text(" Summary "), summary), filler()}),
+    });
+    Render(screen, document);
+    out.clear();
+    screen.ToString(out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BenchmarkPackageManager)->Arg(12)->Arg(100);
 
 }  // namespace ftxui
 
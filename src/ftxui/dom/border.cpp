@@ -1,7 +1,8 @@
 #include <algorithm>  // for max
 #include <array>      // for array
+#include <cstddef>    // for size_t
 #include <memory>     // for allocator, make_shared, __shared_ptr_access
-#include <string>     // for basic_string, string
+#include <string_view>  // for string_view
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type
 
@@ -9,21 +10,35 @@
 #include "ftxui/dom/node.hpp"      // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
 
 namespace ftxui {
 
-using Charset = std::array<std::string, 6>;  // NOLINT
+namespace {
+
+using Charset = std::array<Glyph, 6>;  // NOLINT
 using Charsets = std::array<Charset, 5>;     // NOLINT
-// NOLINTNEXTLINE
-static Charsets simple_border_charset = {
-    Charset{"┌", "┐", "└", "┘", "─", "│"},
-    Charset{"┏", "┓", "┗", "┛", "━", "┃"},
-    Charset{"╔", "╗", "╚", "╝", "═", "║"},
-    Charset{"╭", "╮", "╰", "╯", "─", "│"},
-    Charset{" ", " ", " ", " ", " ", " "},
+
+consteval Charset MakeCharset(std::array<std::string_view, 6> characters) {
+  Charset charset;
+  for (size_t i = 0; i < charset.size(); ++i) {
+    charset[i] = Glyph::Narrow(characters[i]);  // NOLINT
+  }
+  return charset;
+}
+
+// Built at compile time. Drawing a border only copies them.
+constexpr Charsets simple_border_charset = {
+    MakeCharset({"┌", "┐", "└", "┘", "─", "│"}),
+    MakeCharset({"┏", "┓", "┗", "┛", "━", "┃"}),
+    MakeCharset({"╔", "╗", "╚", "╝", "═", "║"}),
+    MakeCharset({"╭", "╮", "╰", "╯", "─", "│"}),
+    MakeCharset({" ", " ", " ", " ", " ", " "}),
 };
 
+}  // namespace
+
 // For reference, here is the charset for normal border:
 class Border : public Node {
  public:
@@ -56,18 +71,18 @@ class Border : public Node {
       title_box.x_max = box.x_max - 1;
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      SetChildBox(1, title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    SetChildBox(0, box);
   }
 
   void Render(Screen& screen) override {
     // Draw content.
-    children_[0]->Render(screen);
+    RenderChild(screen, size_t(0));
 
     // Draw the border.
     if (box_.x_min >= box_.x_max || box_.y_min >= box_.y_max) {
@@ -95,10 +110,11 @@ class Border : public Node {
       p3.automerge = true;
       p4.automerge = true;
     }
+    screen.AddAutoMergeRegion(box_);
 
     // Draw title.
     if (children_.size() == 2) {
-      children_[1]->Render(screen);
+      RenderChild(screen, size_t(1));
     }
   }
 };
@@ -109,9 +125,6 @@ class BorderPixel : public Node {
   BorderPixel(Elements children, Pixel pixel)
       : Node(std::move(children)), pixel_(std::move(pixel)) {}
 
- private:
-  Pixel pixel_;
-
   void ComputeRequirement() override {
     Node::ComputeRequirement();
     requirement_ = children_[0]->requirement();
@@ -135,38 +148,32 @@ class BorderPixel : public Node {
       title_box.x_max = box.x_max - 1;
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      SetChildBox(1, title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    SetChildBox(0, box);
   }
 
   void Render(Screen& screen) override {
     // Draw content.
-    children_[0]->Render(screen);
+    RenderChild(screen, size_t(0));
 
     // Draw the border.
     if (box_.x_min >= box_.x_max || box_.y_min >= box_.y_max) {
       return;
     }
 
-    screen.PixelAt(box_.x_min, box_.y_min) = pixel_;
-    screen.PixelAt(box_.x_max, box_.y_min) = pixel_;
-    screen.PixelAt(box_.x_min, box_.y_max) = pixel_;
-    screen.PixelAt(box_.x_max, box_.y_max) = pixel_;
-
-    for (int x = box_.x_min + 1; x < box_.x_max; ++x) {
-      screen.PixelAt(x, box_.y_min) = pixel_;
-      screen.PixelAt(x, box_.y_max) = pixel_;
-    }
-    for (int y = box_.y_min + 1; y < box_.y_max; ++y) {
-      screen.PixelAt(box_.x_min, y) = pixel_;
-      screen.PixelAt(box_.x_max, y) = pixel_;
-    }
+    screen.FillRect({box_.x_min, box_.x_max, box_.y_min, box_.y_min}, pixel_);
+    screen.FillRect({box_.x_min, box_.x_max, box_.y_max, box_.y_max}, pixel_);
+    screen.FillRect({box_.x_min, box_.x_min, box_.y_min, box_.y_max}, pixel_);
+    screen.FillRect({box_.x_max, box_.x_max, box_.y_min, box_.y_max}, pixel_);
   }
+
+ private:
+  Pixel pixel_;
 };
 
 /// @brief Draw a border around the element.
@@ -198,7 +205,7 @@ class BorderPixel : public Node {
 /// └───────────┘
 /// ```
 Element border(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeNode<Border>(unpack(std::move(child)), ROUNDED);
 }
 
 /// @brief Same as border but with a constant Pixel around the element.
@@ -206,7 +213,7 @@ Element border(Element child) {
 /// @see border
 Decorator borderWith(const Pixel& pixel) {
   return [pixel](Element child) {
-    return std::make_shared<BorderPixel>(unpack(std::move(child)), pixel);
+    return MakeNode<BorderPixel>(unpack(std::move(child)), pixel);
   };
 }
 
@@ -215,7 +222,7 @@ Decorator borderWith(const Pixel& pixel) {
 /// @see border
 Decorator borderStyled(BorderStyle style) {
   return [style](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), style);
+    return MakeNode<Border>(unpack(std::move(child)), style);
   };
 }
 
@@ -250,7 +257,7 @@ Decorator borderStyled(BorderStyle style) {
 /// └──────────────┘
 /// ```
 Element borderLight(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), LIGHT);
+  return MakeNode<Border>(unpack(std::move(child)), LIGHT);
 }
 
 /// @brief Draw a heavy border around the element.
@@ -284,7 +291,7 @@ Element borderLight(Element child) {
 /// ┗━━━━━━━━━━━━━━┛
 /// ```
 Element borderHeavy(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), HEAVY);
+  return MakeNode<Border>(unpack(std::move(child)), HEAVY);
 }
 
 /// @brief Draw a double border around the element.
@@ -318,7 +325,7 @@ Element borderHeavy(Element child) {
 /// ╚══════════════╝
 /// ```
 Element borderDouble(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), DOUBLE);
+  return MakeNode<Border>(unpack(std::move(child)), DOUBLE);
 }
 
 /// @brief Draw a rounded border around the element.
@@ -352,7 +359,7 @@ Element borderDouble(Element child) {
 /// ╰──────────────╯
 /// ```
 Element borderRounded(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeNode<Border>(unpack(std::move(child)), ROUNDED);
 }
 
 /// @brief Draw an empty border around the element.
@@ -386,7 +393,7 @@ Element borderRounded(Element child) {
 ///
 /// ```
 Element borderEmpty(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), EMPTY);
+  return MakeNode<Border>(unpack(std::move(child)), EMPTY);
 }
 
 /// @brief Draw window with a title and a border around the element.
@@ -411,7 +418,7 @@ Element borderEmpty(Element child) {
 /// └───────┘
 /// ```
 Element window(Element title, Element content) {
-  return std::make_shared<Border>(unpack(std::move(content), std::move(title)),
+  return MakeNode<Border>(unpack(std::move(content), std::move(title)),
                                   ROUNDED);
 }
 }  // namespace ftxui
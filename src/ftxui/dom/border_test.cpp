@@ -1,8 +1,8 @@
 #include <gtest/gtest.h>
 #include <string>  // for allocator, string
 
-#include "ftxui/dom/elements.hpp"  // for text, operator|, Element, borderStyled, borderWith, window, border, borderDouble, borderEmpty, borderHeavy, borderLight, borderRounded, DOUBLE
-#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/elements.hpp"  // for text, operator|, Element, borderStyled, borderWith, window, border, borderDouble, borderEmpty, borderHeavy, borderLight, borderRounded, DOUBLE, hbox, automerge
+#include "ftxui/dom/node.hpp"      // for Node, Render, MakeNode
 #include "ftxui/screen/screen.hpp"  // for Screen, Pixel
 
 namespace ftxui {
@@ -99,6 +99,36 @@ TEST(BorderTest, Window) {
             "╰────────╯");
 }
 
+// The box characters drawn next to a border are merged, when their area is
+// declared.
+TEST(BorderTest, AutoMergeNextToBorder) {
+  class Cross : public Node {
+   public:
+    void ComputeRequirement() override {
+      requirement_.min_x = 2;
+      requirement_.min_y = 1;
+    }
+    void Render(Screen& screen) override {
+      screen.at(box_.x_min, box_.y_min) = "│";
+      screen.at(box_.x_min + 1, box_.y_min) = "─";
+      screen.PixelAt(box_.x_min, box_.y_min).automerge = true;
+      screen.PixelAt(box_.x_min + 1, box_.y_min).automerge = true;
+      screen.AddAutoMergeRegion(box_);
+    }
+  };
+  auto element = hbox({
+      MakeNode<Cross>(),
+      text("│─") | automerge,
+      text("x") | border,
+  });
+  Screen screen(7, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "├─┼─╭─╮\r\n"
+            "    │x│\r\n"
+            "    ╰─╯");
+}
+
 }  // namespace ftxui
 
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
@@ -1,6 +1,9 @@
 #include "ftxui/dom/box_helper.hpp"
 
 #include <algorithm>  // for max
+#include <cstddef>    // for size_t
+#include <deque>      // for deque
+#include <vector>     // for vector
 
 namespace ftxui::box_helper {
 
@@ -8,10 +11,10 @@ namespace {
 // Called when the size allowed is greater than the requested size. This
 // distributes the extra spaces toward the flexible elements, in relative
 // proportions.
-void ComputeGrow(std::vector<Element>* elements,
+void ComputeGrow(std::span<Element> elements,
                  int extra_space,
                  int flex_grow_sum) {
-  for (Element& element : *elements) {
+  for (Element& element : elements) {
     const int added_space =
         extra_space * element.flex_grow / std::max(flex_grow_sum, 1);
     extra_space -= added_space;
@@ -23,10 +26,10 @@ void ComputeGrow(std::vector<Element>* elements,
 // Called when the size allowed is lower than the requested size, and the
 // shrinkable element can absorbe the (negative) extra_space. This distribute
 // the extra_space toward those.
-void ComputeShrinkEasy(std::vector<Element>* elements,
+void ComputeShrinkEasy(std::span<Element> elements,
                        int extra_space,
                        int flex_shrink_sum) {
-  for (Element& element : *elements) {
+  for (Element& element : elements) {
     const int added_space = extra_space * element.min_size *
                             element.flex_shrink / std::max(flex_shrink_sum, 1);
     extra_space -= added_space;
@@ -39,10 +42,10 @@ void ComputeShrinkEasy(std::vector<Element>* elements,
 // shrinkable element can not absorbe the (negative) extra_space. This assign
 // zero to shrinkable elements and distribute the remaining (negative)
 // extra_space toward the other non shrinkable elements.
-void ComputeShrinkHard(std::vector<Element>* elements,
+void ComputeShrinkHard(std::span<Element> elements,
                        int extra_space,
                        int size) {
-  for (Element& element : *elements) {
+  for (Element& element : elements) {
     if (element.flex_shrink != 0) {
       element.size = 0;
       continue;
@@ -56,15 +59,65 @@ void ComputeShrinkHard(std::vector<Element>* elements,
   }
 }
 
+// ComputeGrow(), when the flexible elements share the same |flex_grow|: they
+// get the same space, and the remainder goes to the last ones, one each.
+void ComputeGrowEqual(std::span<Element> elements,
+                      int extra_space,
+                      int flex_count) {
+  const int share = extra_space / flex_count;
+  int remainder = extra_space % flex_count;
+  int remaining = flex_count;
+  for (Element& element : elements) {
+    element.size = element.min_size;
+    if (element.flex_grow == 0) {
+      continue;
+    }
+    element.size += share + (remaining <= remainder ? 1 : 0);
+    remaining--;
+  }
+}
+
+// The scratch storage of every depth of nested containers.
+struct Level {
+  std::vector<Element> elements;
+  std::vector<Box> boxes;
+};
+thread_local std::deque<Level> g_levels;  // NOLINT
+thread_local size_t g_depth = 0;          // NOLINT
+
 }  // namespace
 
-void Compute(std::vector<Element>* elements, int target_size) {
+Scratch::Scratch(size_t size) {
+  if (g_depth == g_levels.size()) {
+    g_levels.emplace_back();  // The other levels stay in place.
+  }
+  Level& level = g_levels[g_depth++];
+  level.elements.assign(size, Element());
+  level.boxes.assign(size, Box());
+  elements = level.elements;
+  boxes = level.boxes;
+}
+
+Scratch::~Scratch() {
+  g_depth--;
+}
+
+void Compute(std::span<Element> elements, int target_size) {
   int size = 0;
   int flex_grow_sum = 0;
   int flex_shrink_sum = 0;
   int flex_shrink_size = 0;
+  // The number of flexible elements, and whether they share one flex_grow.
+  int flex_count = 0;
+  int flex_grow = 0;
+  bool equal_flex = true;
 
-  for (auto& element : *elements) {
+  for (auto& element : elements) {
+    if (element.flex_grow != 0) {
+      equal_flex &= flex_count == 0 || element.flex_grow == flex_grow;
+      flex_grow = element.flex_grow;
+      flex_count++;
+    }
     flex_grow_sum += element.flex_grow;
     flex_shrink_sum += element.min_size * element.flex_shrink;
     if (element.flex_shrink != 0) {
@@ -75,7 +128,15 @@ void Compute(std::vector<Element>* elements, int target_size) {
 
   const int extra_space = target_size - size;
   if (extra_space >= 0) {
-    ComputeGrow(elements, extra_space, flex_grow_sum);
+    if (flex_count == 0) {
+      for (auto& element : elements) {
+        element.size = element.min_size;
+      }
+    } else if (equal_flex) {
+      ComputeGrowEqual(elements, extra_space, flex_count);
+    } else {
+      ComputeGrow(elements, extra_space, flex_grow_sum);
+    }
   } else if (flex_shrink_size + extra_space >= 0) {
     ComputeShrinkEasy(elements, extra_space, flex_shrink_sum);
 
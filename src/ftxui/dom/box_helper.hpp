@@ -1,7 +1,11 @@
 #ifndef FTXUI_DOM_BOX_HELPER_HPP
 #define FTXUI_DOM_BOX_HELPER_HPP
 
-#include <vector>
+#include <cstddef>  // for size_t
+#include <span>     // for span
+#include <vector>   // for vector
+
+#include "ftxui/screen/box.hpp"  // for Box
 
 namespace ftxui {
 namespace box_helper {
@@ -16,7 +20,23 @@ struct Element {
   int size = 0;
 };
 
-void Compute(std::vector<Element>* elements, int target_size);
+void Compute(std::span<Element> elements, int target_size);
+
+// The scratch storage of a container laying out |size| children. It is reused
+// by the containers nested at the same depth on the same thread, so that once
+// warm, the layout of a tree allocates nothing. The content is reset.
+class Scratch {
+ public:
+  explicit Scratch(size_t size);
+  ~Scratch();
+  Scratch(const Scratch&) = delete;
+  Scratch(Scratch&&) = delete;
+  Scratch& operator=(const Scratch&) = delete;
+  Scratch& operator=(Scratch&&) = delete;
+
+  std::span<Element> elements;
+  std::span<Box> boxes;
+};
 
 }  // namespace box_helper
 }  // namespace ftxui
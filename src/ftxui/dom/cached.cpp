@@ -0,0 +1,154 @@
+#include <algorithm>  // for copy, any_of
+#include <cstddef>    // for size_t
+#include <memory>     // for make_shared
+#include <string>     // for string
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"        // for Element, Decorator, cached, retained
+#include "ftxui/dom/key_cache.hpp"       // for KeyCache
+#include "ftxui/dom/node.hpp"            // for Node
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/screen/screen_view.hpp"  // for ScreenView
+#include "ftxui/screen/util.hpp"         // for HeapSize
+
+namespace ftxui {
+
+namespace {
+
+// Keep a copy of the pixels drawn by the child. They are copied again into the
+// screen by the next renders, as long as the dimensions of the box don't
+// change. The cursor and the automerge area set by the child are restored as
+// well. The child is retained(): it isn't laid out again either.
+//
+// The pixels hidden by the opaque layers above, like a clear_under() modal,
+// aren't drawn by the child. They are overwritten by these layers anyway, so
+// the copy remains valid as long as the same layers hide the box.
+class Cached : public NodeDecorator {
+ public:
+  using NodeDecorator::NodeDecorator;
+
+  void SetBox(Box box) override {
+    // The pixels are blitted at the new position when the element is moved.
+    // The children are laid out again, and the reflect() ones must then be
+    // drawn again, to report their new box.
+    if (box.x_max - box.x_min != box_.x_max - box_.x_min ||
+        box.y_max - box.y_min != box_.y_max - box_.y_min ||
+        (box != box_ && ContainsReflect())) {
+      valid_ = false;
+    }
+    NodeDecorator::SetBox(box);
+  }
+
+  void Render(Screen& screen) override {
+    ScreenView view(screen, box_);
+    const Box whole{0, view.dimx() - 1, 0, view.dimy() - 1};
+    // Some of the pixels aren't drawn when the box is clipped.
+    if (view.dimx() <= 0 || view.dimy() <= 0 || view.clip() != whole) {
+      valid_ = false;
+      Node::Render(screen);
+      return;
+    }
+
+    std::vector<Box> occluders = Occluders(box_);
+    if (valid_ && occluders == occluders_) {
+      Restore(view);
+      return;
+    }
+
+    const Screen::Cursor cursor = screen.cursor();
+    Node::Render(screen);
+    Save(view, cursor);
+    occluders_ = std::move(occluders);
+  }
+
+  size_t MemoryUsage() const override {
+    return Node::MemoryUsage() + util::HeapSize(tile_) +
+           util::HeapSize(occluders_);
+  }
+
+ private:
+  void Save(ScreenView& view, const Screen::Cursor& previous_cursor) {
+    tile_.resize(size_t(view.dimx()) * size_t(view.dimy()));
+    auto out = tile_.begin();
+    for (int y = 0; y < view.dimy(); ++y) {
+      auto row = view.Row(y);
+      out = std::copy(row.begin(), row.end(), out);
+    }
+    automerge_ = std::any_of(tile_.begin(), tile_.end(),
+                             [](const Pixel& pixel) { return pixel.automerge; });
+
+    const Screen::Cursor cursor = view.screen().cursor();
+    has_cursor_ = cursor.x != previous_cursor.x ||
+                  cursor.y != previous_cursor.y ||
+                  cursor.shape != previous_cursor.shape;
+    cursor_ = cursor;
+    cursor_.x -= view.origin_x();
+    cursor_.y -= view.origin_y();
+    valid_ = true;
+  }
+
+  void Restore(ScreenView& view) const {
+    view.screen().BlitRect(box_, tile_);
+    if (automerge_) {
+      view.screen().AddAutoMergeRegion(box_);
+    }
+    if (has_cursor_) {
+      Screen::Cursor cursor = cursor_;
+      cursor.x += view.origin_x();
+      cursor.y += view.origin_y();
+      view.screen().SetCursor(cursor);
+    }
+  }
+
+  std::vector<Pixel> tile_;
+  std::vector<Box> occluders_;
+  bool valid_ = false;
+  bool automerge_ = false;
+  bool has_cursor_ = false;
+  Screen::Cursor cursor_;
+};
+
+}  // namespace
+
+/// @brief Render the element once, and reuse its pixels during the next
+/// frames, as long as the dimensions of its box don't change.
+///
+/// When a KeyCache is active, like in ScreenInteractive, the element created
+/// with the same key during the previous frame is reused, with its pixels. See
+/// key(). The key must identify the content of the element. It shares its
+/// namespace with the keys of key().
+///
+/// The element is opaque: its pixels replace the ones below, as drawn the
+/// first time.
+/// @param k The identifier of the element.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// auto renderer = Renderer([&] {
+///   return vbox({
+///     text(status),
+///     HelpTable() | border | cached("help"),
+///   });
+/// });
+/// ```
+Decorator cached(std::string k) {
+  return [k = std::move(k)](Element child) {
+    Element element = MakeNode<Cached>(retained(std::move(child)));
+    KeyCache* cache = KeyCache::Current();
+    if (cache == nullptr) {
+      return element;
+    }
+    return cache->Reconcile(k, std::move(element));
+  };
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator, string
+
+#include "ftxui/dom/elements.hpp"   // for cached, text, vbox, hbox, xframe, dbox, clear_under, filler, reflect, Element
+#include "ftxui/dom/key_cache.hpp"  // for KeyCache
+#include "ftxui/dom/node.hpp"       // for Node, Render
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// A text element counting how many times it is drawn.
+class Counter : public Node {
+ public:
+  explicit Counter(int* count) : Node({text("abc")}), count_(count) {}
+
+  void ComputeRequirement() override {
+    children_[0]->ComputeRequirement();
+    requirement_ = children_[0]->requirement();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    children_[0]->SetBox(box);
+  }
+
+  void Render(Screen& screen) override {
+    (*count_)++;
+    Node::Render(screen);
+  }
+
+ private:
+  int* count_;
+};
+
+}  // namespace
+
+TEST(CachedTest, Basic) {
+  int count = 0;
+  Element element = MakeNode<Counter>(&count) | cached("counter");
+  for (int i = 0; i < 3; ++i) {
+    Screen screen(3, 1);
+    Render(screen, element);
+    EXPECT_EQ(screen.ToString(), "abc");
+  }
+  EXPECT_EQ(count, 1);
+}
+
+TEST(CachedTest, Moved) {
+  int count = 0;
+  Element element = MakeNode<Counter>(&count) | cached("counter");
+  Screen screen(5, 1);
+  Render(screen, hbox({element, text("-")}));
+  EXPECT_EQ(screen.ToString(), "abc- ");
+  Render(screen, hbox({text("-"), element, text("-")}));
+  EXPECT_EQ(screen.ToString(), "-abc-");
+  Render(screen, hbox({text("-"), element, text("-")}));
+  EXPECT_EQ(screen.ToString(), "-abc-");
+  EXPECT_EQ(count, 1);
+}
+
+TEST(CachedTest, MovedReflect) {
+  int count = 0;
+  Box box;
+  Element element =
+      MakeNode<Counter>(&count) | reflect(box) | cached("counter");
+  Screen screen(5, 1);
+  Render(screen, hbox({element, text("-")}));
+  EXPECT_EQ(box.x_min, 0);
+  Render(screen, hbox({text("-"), element, text("-")}));
+  EXPECT_EQ(screen.ToString(), "-abc-");
+  EXPECT_EQ(box.x_min, 1);
+  EXPECT_EQ(box.x_max, 3);
+  EXPECT_EQ(count, 2);
+}
+
+TEST(CachedTest, Resized) {
+  int count = 0;
+  Element element = MakeNode<Counter>(&count) | cached("counter");
+  Screen small(3, 1);
+  Render(small, element);
+  Screen large(4, 1);
+  Render(large, element);
+  EXPECT_EQ(large.ToString(), "abc ");
+  EXPECT_EQ(count, 2);
+}
+
+TEST(CachedTest, PartiallyVisible) {
+  int count = 0;
+  Element element = MakeNode<Counter>(&count) | cached("counter");
+  Screen screen(2, 1);
+  Render(screen, element | xframe);
+  Render(screen, element | xframe);
+  EXPECT_EQ(screen.ToString(), "ab");
+  EXPECT_EQ(count, 2);
+}
+
+TEST(CachedTest, PartiallyHidden) {
+  int count = 0;
+  Element element = MakeNode<Counter>(&count) | cached("counter");
+  Element modal = hbox({
+      filler(),
+      vbox({text("Z") | clear_under, filler()}),
+  });
+  Screen screen(3, 3);
+  Render(screen, dbox({vbox({element, filler()}), modal}));
+  EXPECT_EQ(screen.ToString(),
+            "abZ\r\n"
+            "   \r\n"
+            "   ");
+
+  // The hidden pixels weren't kept.
+  for (int i = 0; i < 2; ++i) {
+    screen.Clear();
+    Render(screen, vbox({element, filler()}));
+    EXPECT_EQ(screen.ToString(),
+              "abc\r\n"
+              "   \r\n"
+              "   ");
+  }
+  EXPECT_EQ(count, 2);
+}
+
+TEST(CachedTest, HiddenBySameLayer) {
+  int count = 0;
+  Element element = MakeNode<Counter>(&count) | cached("counter");
+  Element modal = hbox({
+      filler(),
+      vbox({text("Z") | clear_under, filler()}),
+  });
+  // The pixels are kept while the same layer hides them.
+  for (int i = 0; i < 3; ++i) {
+    Screen screen(3, 3);
+    Render(screen, dbox({vbox({element, filler()}), modal}));
+    EXPECT_EQ(screen.ToString(),
+              "abZ\r\n"
+              "   \r\n"
+              "   ");
+  }
+  EXPECT_EQ(count, 1);
+}
+
+TEST(CachedTest, KeyCache) {
+  int count = 0;
+  KeyCache cache;
+  for (int i = 0; i < 3; ++i) {
+    Element document;
+    {
+      const KeyCache::Scope scope(&cache);
+      document = vbox({
+          text(std::to_string(i)),
+          MakeNode<Counter>(&count) | cached("counter"),
+      });
+    }
+    Screen screen(3, 2);
+    Render(screen, document);
+    EXPECT_EQ(screen.ToString(), std::to_string(i) + "  \r\nabc");
+  }
+  EXPECT_EQ(count, 1);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,12 +1,15 @@
 #include "ftxui/dom/canvas.hpp"
 
 #include <algorithm>               // for max, min
+#include <array>                   // for array
 #include <cmath>                   // for abs
+#include <cstddef>                 // for ptrdiff_t
 #include <cstdint>                 // for uint8_t
 #include <cstdlib>                 // for abs
 #include <ftxui/screen/color.hpp>  // for Color
-#include <map>                     // for map
 #include <memory>                  // for make_shared
+#include <memory_resource>         // for memory_resource, get_default_resource
+#include <string_view>             // for string_view
 #include <utility>                 // for move, pair
 #include <vector>                  // for vector
 
@@ -14,84 +17,193 @@
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
-#include "ftxui/screen/string.hpp"    // for Utf8ToGlyphs
+#include "ftxui/screen/string.hpp"    // for Glyphs
+#include "ftxui/screen/util.hpp"      // for HeapSize
 #include "ftxui/util/ref.hpp"         // for ConstRef
 
 namespace ftxui {
 
 namespace {
 
-// Base UTF8 pattern:
-// 11100010 10100000 10000000 // empty
-
-// Pattern for the individuel dots:
-// ┌──────┬───────┐
-// │dot1  │ dot4  │
-// ├──────┼───────┤
-// │dot2  │ dot5  │
-// ├──────┼───────┤
-// │dot3  │ dot6  │
-// ├──────┼───────┤
-// │dot0-1│ dot0-2│
-// └──────┴───────┘
-// 11100010 10100000 10000001 // dot1
-// 11100010 10100000 10000010 // dot2
-// 11100010 10100000 10000100 // dot3
-// 11100010 10100001 10000000 // dot0-1
-// 11100010 10100000 10001000 // dot4
-// 11100010 10100000 10010000 // dot5
-// 11100010 10100000 10100000 // dot6
-// 11100010 10100010 10000000 // dot0-2
-
+// The braille characters are U+2800 + the bitmask of their dots:
+// ┌──────┬──────┐
+// │dot1  │ dot4 │
+// ├──────┼──────┤
+// │dot2  │ dot5 │
+// ├──────┼──────┤
+// │dot3  │ dot6 │
+// ├──────┼──────┤
+// │dot7  │ dot8 │
+// └──────┴──────┘
 // NOLINTNEXTLINE
-uint8_t g_map_braille[2][4][2] = {
-    {
-        {0b00000000, 0b00000001},  // NOLINT | dot1
-        {0b00000000, 0b00000010},  // NOLINT | dot2
-        {0b00000000, 0b00000100},  // NOLINT | dot3
-        {0b00000001, 0b00000000},  // NOLINT | dot0-1
-    },
-    {
-        {0b00000000, 0b00001000},  // NOLINT | dot4
-        {0b00000000, 0b00010000},  // NOLINT | dot5
-        {0b00000000, 0b00100000},  // NOLINT | dot6
-        {0b00000010, 0b00000000},  // NOLINT | dot0-2
-    },
+const uint8_t g_map_braille[2][4] = {
+    {0b00000001, 0b00000010, 0b00000100, 0b01000000},  // NOLINT
+    {0b00001000, 0b00010000, 0b00100000, 0b10000000},  // NOLINT
 };
 
 // NOLINTNEXTLINE
-std::vector<std::string> g_map_block = {
+const char* const g_map_block[16] = {
     " ", "▘", "▖", "▌", "▝", "▀", "▞", "▛",
     "▗", "▚", "▄", "▙", "▐", "▜", "▟", "█",
 };
 
-// NOLINTNEXTLINE
-const std::map<std::string, uint8_t> g_map_block_inversed = {
-    {" ", 0b0000}, {"▘", 0b0001}, {"▖", 0b0010}, {"▌", 0b0011},
-    {"▝", 0b0100}, {"▀", 0b0101}, {"▞", 0b0110}, {"▛", 0b0111},
-    {"▗", 0b1000}, {"▚", 0b1001}, {"▄", 0b1010}, {"▙", 0b1011},
-    {"▐", 0b1100}, {"▜", 0b1101}, {"▟", 0b1110}, {"█", 0b1111},
-};
+const Glyph& BrailleGlyph(uint8_t bits) {
+  static const std::array<Glyph, 256> glyphs = [] {
+    std::array<Glyph, 256> out;
+    for (size_t i = 0; i < out.size(); ++i) {
+      const char utf8[] = {
+          char(0b11100010),                     // NOLINT
+          char(0b10100000 | (i >> 6)),          // NOLINT
+          char(0b10000000 | (i & 0b00111111)),  // NOLINT
+      };
+      out[i] = Glyph(std::string_view(utf8, sizeof(utf8)));
+    }
+    return out;
+  }();
+  return glyphs[bits];
+}
+
+const Glyph& BlockGlyph(uint8_t bits) {
+  static const std::array<Glyph, 16> glyphs = [] {
+    std::array<Glyph, 16> out;
+    for (size_t i = 0; i < out.size(); ++i) {
+      out[i] = Glyph(g_map_block[i]);
+    }
+    return out;
+  }();
+  return glyphs[bits];
+}
+
+// Move the left column of dots of a cell to the right, or the opposite.
+uint8_t MoveBrailleColumn(uint8_t bits, bool to_right) {
+  return to_right ? uint8_t(((bits & 0b00000111) << 3) |  // NOLINT
+                            ((bits & 0b01000000) << 1))   // NOLINT
+                  : uint8_t(((bits & 0b00111000) >> 3) |  // NOLINT
+                            ((bits & 0b10000000) >> 1));  // NOLINT
+}
+
+uint8_t MoveBlockColumn(uint8_t bits, bool to_right) {
+  return to_right ? uint8_t((bits & 0b0011) << 2)   // NOLINT
+                  : uint8_t((bits & 0b1100) >> 2);  // NOLINT
+}
 
 constexpr auto nostyle = [](Pixel& /*pixel*/) {};
 
+// An RGB image, 3 bytes per pixel, row by row.
+struct Image {
+  const uint8_t* rgb = nullptr;
+  int width = 0;
+  int height = 0;
+
+  const uint8_t* At(int x, int y) const {
+    return rgb + 3 * (size_t(y) * size_t(width) + size_t(x));
+  }
+};
+
+// The luminance of every pixel, in [0, 255]. The loop has no branch, so that
+// it is vectorized.
+std::vector<uint8_t> Luminance(const Image& image) {
+  const size_t count = size_t(image.width) * size_t(image.height);
+  std::vector<uint8_t> out(count);
+  const uint8_t* rgb = image.rgb;
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = uint8_t((77 * rgb[3 * i] + 150 * rgb[3 * i + 1] +  // NOLINT
+                      29 * rgb[3 * i + 2]) >>                   // NOLINT
+                     8);                                        // NOLINT
+  }
+  return out;
+}
+
+// The |x|-th character of the |y|-th row of an image drawn with half blocks.
+void HalfBlockPixel(const Image& image, int x, int y, Pixel& pixel) {
+  static const Glyph upper_half("▀");
+  const uint8_t* top = image.At(x, 2 * y);
+  pixel.character = upper_half;
+  pixel.foreground_color = Color::RGB(top[0], top[1], top[2]);
+  pixel.background_color = Color::Default;
+  if (2 * y + 1 < image.height) {
+    const uint8_t* bottom = image.At(x, 2 * y + 1);
+    pixel.background_color = Color::RGB(bottom[0], bottom[1], bottom[2]);
+  }
+}
+
+// The dots of the |x|-th character of the |y|-th row of an image drawn with
+// braille dots, and their average color.
+uint8_t BraillePixel(const Image& image,
+                     const std::vector<uint8_t>& luminance,
+                     int x,
+                     int y,
+                     Color* color) {
+  constexpr uint8_t kThreshold = 128;
+  uint8_t bits = 0;
+  int lit = 0;
+  int red = 0;
+  int green = 0;
+  int blue = 0;
+  for (int dy = 0; dy < 4; ++dy) {
+    for (int dx = 0; dx < 2; ++dx) {
+      const int px = 2 * x + dx;
+      const int py = 4 * y + dy;
+      if (px >= image.width || py >= image.height ||
+          luminance[size_t(py) * size_t(image.width) + size_t(px)] <
+              kThreshold) {
+        continue;
+      }
+      const uint8_t* rgb = image.At(px, py);
+      bits |= g_map_braille[dx][dy];
+      red += rgb[0];
+      green += rgb[1];
+      blue += rgb[2];
+      ++lit;
+    }
+  }
+  *color = lit == 0 ? Color(Color::Default)
+                    : Color::RGB(uint8_t(red / lit), uint8_t(green / lit),
+                                 uint8_t(blue / lit));
+  return bits;
+}
+
 }  // namespace
 
 /// @brief Constructor.
 /// @param width the width of the canvas. A cell is a 2x8 braille dot.
 /// @param height the height of the canvas. A cell is a 2x8 braille dot.
 Canvas::Canvas(int width, int height)
+    : Canvas(width, height, std::pmr::get_default_resource()) {}
+
+/// @brief Constructor, allocating the cells from |resource| instead of the
+/// heap. The copies of the canvas use the default resource.
+/// @param width the width of the canvas. A cell is a 2x8 braille dot.
+/// @param height the height of the canvas. A cell is a 2x8 braille dot.
+/// @param resource the memory resource. It must outlive the canvas.
+Canvas::Canvas(int width, int height, std::pmr::memory_resource* resource)
     : width_(width),
       height_(height),
-      storage_(width_ * height_ / 8 /* NOLINT */) {}
+      stride_(std::max(0, (width + 1) / 2)),
+      storage_(size_t(stride_) * size_t(std::max(0, (height + 3) / 4)),
+               resource) {}
+
+/// @brief The bytes of memory holding the cells: one per 2x4 dots.
+size_t Canvas::MemoryUsage() const {
+  return util::HeapSize(storage_);
+}
 
 /// @brief Get the content of a cell.
 /// @param x the x coordinate of the cell.
 /// @param y the y coordinate of the cell.
 Pixel Canvas::GetPixel(int x, int y) const {
-  auto it = storage_.find(XY{x, y});
-  return (it == storage_.end()) ? Pixel{} : it->second.content;
+  if (x < 0 || x >= stride_ || y < 0 || y >= (height_ + 3) / 4) {
+    return Pixel{};
+  }
+  Cell& cell = storage_[size_t(y) * size_t(stride_) + size_t(x)];
+  if (cell.dirty) {
+    cell.content.character = cell.type == kBraille ? BrailleGlyph(cell.bits)
+                                                   : BlockGlyph(cell.bits);
+    cell.dirty = false;
+  }
+  return cell.content;
 }
 
 /// @brief Draw a braille dot.
@@ -108,7 +220,16 @@ void Canvas::DrawPoint(int x, int y, bool value) {
 /// @param value whether the dot is filled or not.
 /// @param color the color of the dot.
 void Canvas::DrawPoint(int x, int y, bool value, const Color& color) {
-  DrawPoint(x, y, value, [color](Pixel& p) { p.foreground_color = color; });
+  if (!IsIn(x, y)) {
+    return;
+  }
+  Cell& cell = CellOf(x, y, kBraille);
+  cell.content.foreground_color = color;
+  if (value) {
+    cell.bits |= g_map_braille[x % 2][y % 4];
+  } else {
+    cell.bits &= uint8_t(~g_map_braille[x % 2][y % 4]);
+  }
 }
 
 /// @brief Draw a braille dot.
@@ -132,14 +253,7 @@ void Canvas::DrawPointOn(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 bytes.
-    cell.type = CellType::kBraille;
-  }
-
-  cell.content.character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  CellOf(x, y, kBraille).bits |= g_map_braille[x % 2][y % 4];
 }
 
 /// @brief Erase a braille dot.
@@ -149,14 +263,7 @@ void Canvas::DrawPointOff(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
-    cell.type = CellType::kBraille;
-  }
-
-  cell.content.character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
-  cell.content.character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  CellOf(x, y, kBraille).bits &= uint8_t(~g_map_braille[x % 2][y % 4]);
 }
 
 /// @brief Toggle a braille dot. A filled one will be erased, and the other will
@@ -167,14 +274,51 @@ void Canvas::DrawPointToggle(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
-    cell.type = CellType::kBraille;
+  CellOf(x, y, kBraille).bits ^= g_map_braille[x % 2][y % 4];
+}
+
+// Call |plot| for every point of the line from (x1, y1) to (x2, y2).
+template <class Plot>
+void Canvas::RasterizeLine(int x1, int y1, int x2, int y2, const Plot& plot) {
+  const int dx = std::abs(x2 - x1);
+  const int dy = std::abs(y2 - y1);
+  const int sx = x1 < x2 ? 1 : -1;
+  const int sy = y1 < y2 ? 1 : -1;
+  const int length = std::max(dx, dy);
+
+  if (!IsIn(x1, y1) && !IsIn(x2, y2)) {
+    return;
+  }
+  if (dx + dx > width_ * height_) {
+    return;
+  }
+
+  int error = dx - dy;
+  for (int i = 0; i < length; ++i) {
+    plot(x1, y1);
+    if (2 * error >= -dy) {
+      error -= dy;
+      x1 += sx;
+    }
+    if (2 * error <= dx) {
+      error += dx;
+      y1 += sy;
+    }
   }
+  plot(x2, y2);
+}
 
-  cell.content.character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+// Call |plot| for every point of the lines joining |points|.
+template <class Plot>
+void Canvas::RasterizePolyline(std::span<const Point> points,
+                               const Plot& plot) {
+  if (points.size() == 1) {
+    plot(points[0].x, points[0].y);
+  }
+  for (size_t i = 1; i < points.size(); ++i) {
+    RasterizeLine(points[i - 1].x, points[i - 1].y, points[i].x, points[i].y,
+                  plot);
+  }
 }
 
 /// @brief Draw a line made of braille dots.
@@ -183,7 +327,7 @@ void Canvas::DrawPointToggle(int x, int y) {
 /// @param x2 the x coordinate of the second dot.
 /// @param y2 the y coordinate of the second dot.
 void Canvas::DrawPointLine(int x1, int y1, int x2, int y2) {
-  DrawPointLine(x1, y1, x2, y2, [](Pixel& /*pixel*/) {});
+  RasterizeLine(x1, y1, x2, y2, [&](int x, int y) { DrawPointOn(x, y); });
 }
 
 /// @brief Draw a line made of braille dots.
@@ -193,8 +337,8 @@ void Canvas::DrawPointLine(int x1, int y1, int x2, int y2) {
 /// @param y2 the y coordinate of the second dot.
 /// @param color the color of the line.
 void Canvas::DrawPointLine(int x1, int y1, int x2, int y2, const Color& color) {
-  DrawPointLine(x1, y1, x2, y2,
-                [color](Pixel& p) { p.foreground_color = color; });
+  RasterizeLine(x1, y1, x2, y2,
+                [&](int x, int y) { DrawPoint(x, y, true, color); });
 }
 
 /// @brief Draw a line made of braille dots.
@@ -208,32 +352,58 @@ void Canvas::DrawPointLine(int x1,
                            int x2,
                            int y2,
                            const Stylizer& style) {
-  const int dx = std::abs(x2 - x1);
-  const int dy = std::abs(y2 - y1);
-  const int sx = x1 < x2 ? 1 : -1;
-  const int sy = y1 < y2 ? 1 : -1;
-  const int length = std::max(dx, dy);
+  RasterizeLine(x1, y1, x2, y2,
+                [&](int x, int y) { DrawPoint(x, y, true, style); });
+}
 
-  if (!IsIn(x1, y1) && !IsIn(x2, y2)) {
-    return;
+/// @brief Draw a set of braille dots.
+/// @param points the coordinates of the dots.
+void Canvas::DrawPoints(std::span<const Point> points) {
+  for (const Point& point : points) {
+    DrawPointOn(point.x, point.y);
   }
-  if (dx + dx > width_ * height_) {
-    return;
+}
+
+/// @brief Draw a set of braille dots.
+/// @param points the coordinates of the dots.
+/// @param style the style of the dots.
+void Canvas::DrawPoints(std::span<const Point> points, const Stylizer& style) {
+  for (const Point& point : points) {
+    DrawPoint(point.x, point.y, true, style);
   }
+}
 
-  int error = dx - dy;
-  for (int i = 0; i < length; ++i) {
-    DrawPoint(x1, y1, true, style);
-    if (2 * error >= -dy) {
-      error -= dy;
-      x1 += sx;
-    }
-    if (2 * error <= dx) {
-      error += dx;
-      y1 += sy;
-    }
+/// @brief Draw a set of braille dots.
+/// @param points the coordinates of the dots.
+/// @param color the color of the dots.
+void Canvas::DrawPoints(std::span<const Point> points, const Color& color) {
+  for (const Point& point : points) {
+    DrawPoint(point.x, point.y, true, color);
   }
-  DrawPoint(x2, y2, true, style);
+}
+
+/// @brief Draw the lines made of braille dots joining every point to the next.
+/// @param points the vertices of the polyline.
+void Canvas::DrawPointPolyline(std::span<const Point> points) {
+  RasterizePolyline(points, [&](int x, int y) { DrawPointOn(x, y); });
+}
+
+/// @brief Draw the lines made of braille dots joining every point to the next.
+/// @param points the vertices of the polyline.
+/// @param style the style of the polyline.
+void Canvas::DrawPointPolyline(std::span<const Point> points,
+                               const Stylizer& style) {
+  RasterizePolyline(points,
+                    [&](int x, int y) { DrawPoint(x, y, true, style); });
+}
+
+/// @brief Draw the lines made of braille dots joining every point to the next.
+/// @param points the vertices of the polyline.
+/// @param color the color of the polyline.
+void Canvas::DrawPointPolyline(std::span<const Point> points,
+                               const Color& color) {
+  RasterizePolyline(points,
+                    [&](int x, int y) { DrawPoint(x, y, true, color); });
 }
 
 /// @brief Draw a circle made of braille dots.
@@ -463,17 +633,10 @@ void Canvas::DrawBlockOn(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
+  Cell& cell = CellOf(x, y, kBlock);
   y /= 2;
-  Cell& cell = storage_[XY{x / 2, y / 2}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
-  }
-
   const uint8_t bit = (x % 2) * 2 + y % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value |= 1U << bit;
-  cell.content.character = g_map_block[value];
+  cell.bits |= 1U << bit;
 }
 
 /// @brief Erase a block.
@@ -483,17 +646,10 @@ void Canvas::DrawBlockOff(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
-  }
+  Cell& cell = CellOf(x, y, kBlock);
   y /= 2;
-
   const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value &= ~(1U << bit);
-  cell.content.character = g_map_block[value];
+  cell.bits &= ~(1U << bit);
 }
 
 /// @brief Toggle a block. If it is filled, it will be erased. If it is empty,
@@ -504,17 +660,10 @@ void Canvas::DrawBlockToggle(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
-  }
+  Cell& cell = CellOf(x, y, kBlock);
   y /= 2;
-
   const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value ^= 1U << bit;
-  cell.content.character = g_map_block[value];
+  cell.bits ^= 1U << bit;
 }
 
 /// @brief Draw a line made of block characters.
@@ -801,16 +950,56 @@ void Canvas::DrawText(int x,
                       int y,
                       const std::string& value,
                       const Stylizer& style) {
-  for (const auto& it : Utf8ToGlyphs(value)) {
-    if (!IsIn(x, y)) {
+  for (const GlyphView& glyph : Glyphs(value)) {
+    for (int i = 0; i < glyph.width; ++i) {
+      if (!IsIn(x, y)) {
+        x += 2;
+        continue;
+      }
+      Cell& cell = CellOf(x, y, kText);
+      cell.content.character = i == 0 ? Glyph(glyph.text) : Glyph();
+      style(cell.content);
       x += 2;
-      continue;
     }
-    Cell& cell = storage_[XY{x / 2, y / 4}];
-    cell.type = CellType::kText;
-    cell.content.character = it;
-    style(cell.content);
-    x += 2;
+  }
+}
+
+/// @brief Draw an RGB image. Its pixels replace the content of the cells.
+/// @param x the x coordinate of the top-left pixel.
+/// @param y the y coordinate of the top-left pixel.
+/// @param rgb the pixels, 3 bytes each, row by row.
+/// @param width the number of pixels of a row.
+/// @param height the number of rows.
+/// @param mode with half blocks, every cell draws 1x2 pixels. With braille
+/// dots, every dot draws a pixel.
+void Canvas::DrawImage(int x,
+                       int y,
+                       const uint8_t* rgb,
+                       int width,
+                       int height,
+                       ImageMode mode) {
+  const Image image = {rgb, width, height};
+  if (mode == ImageMode::HalfBlock) {
+    for (int j = 0; 2 * j < height; ++j) {
+      for (int i = 0; i < width; ++i) {
+        if (IsIn(x + 2 * i, y + 4 * j)) {
+          HalfBlockPixel(image, i, j,
+                         CellOf(x + 2 * i, y + 4 * j, kText).content);
+        }
+      }
+    }
+    return;
+  }
+
+  const std::vector<uint8_t> luminance = Luminance(image);
+  for (int j = 0; 4 * j < height; ++j) {
+    for (int i = 0; 2 * i < width; ++i) {
+      if (IsIn(x + 2 * i, y + 4 * j)) {
+        Cell& cell = CellOf(x + 2 * i, y + 4 * j, kBraille);
+        cell.bits = BraillePixel(image, luminance, i, j,
+                                 &cell.content.foreground_color);
+      }
+    }
   }
 }
 
@@ -818,7 +1007,64 @@ void Canvas::DrawText(int x,
 /// @param style a function that modifies the pixel.
 void Canvas::Style(int x, int y, const Stylizer& style) {
   if (IsIn(x, y)) {
-    style(storage_[XY{x / 2, y / 4}].content);
+    Cell& cell = CellAt(x, y);
+    style(cell.content);
+    // The character of the dots and blocks is encoded from their bits.
+    cell.dirty = cell.type != kText;
+  }
+}
+
+/// @brief Move the content of the canvas |dx| dots to the left, or to the
+/// right when negative. The uncovered cells are cleared. The text moves by
+/// whole cells, rounding down.
+/// @param dx the number of dots to move the content by.
+void Canvas::Scroll(int dx) {
+  const int shift = dx >= 0 ? dx / 2 : -((1 - dx) / 2);  // Rounded down.
+  const bool odd = (dx % 2) != 0;
+  const int rows = std::max(0, (height_ + 3) / 4);
+  std::vector<Cell> row(static_cast<size_t>(stride_));
+  for (int y = 0; y < rows; ++y) {
+    Cell* line = storage_.data() + ptrdiff_t(y) * stride_;
+    auto at = [&](int x) -> const Cell* {
+      return (x >= 0 && x < stride_) ? line + x : nullptr;
+    };
+    auto is_dots = [](const Cell* cell) {
+      return cell != nullptr && cell->type != kText;
+    };
+    auto is_blank = [](const Cell* cell) {
+      return cell == nullptr ||
+             (cell->type == kText && cell->content.character == Glyph(" "));
+    };
+    auto move = [](const Cell& cell, bool to_right) {
+      return cell.type == kBraille ? MoveBrailleColumn(cell.bits, to_right)
+                                   : MoveBlockColumn(cell.bits, to_right);
+    };
+
+    for (int x = 0; x < stride_; ++x) {
+      const Cell* left = at(x + shift);
+      const Cell* right = at(x + shift + 1);
+      Cell& cell = row[size_t(x)];
+      if (!odd) {
+        cell = left ? *left : Cell();
+        continue;
+      }
+      // The cell is made of the right column of |left|, and the left column
+      // of |right|.
+      if (is_dots(left)) {
+        cell = *left;
+        cell.bits = move(*left, false);
+        if (is_dots(right) && right->type == left->type) {
+          cell.bits |= move(*right, true);
+        }
+      } else if (is_blank(left) && is_dots(right)) {
+        cell = *right;
+        cell.bits = move(*right, true);
+      } else {
+        cell = left ? *left : Cell();
+      }
+      cell.dirty = cell.type != kText;
+    }
+    std::copy(row.begin(), row.end(), line);
   }
 }
 
@@ -844,6 +1090,63 @@ class CanvasNodeBase : public Node {
 
 }  // namespace
 
+/// @brief An element drawing an RGB image, without going through a Canvas.
+/// @param rgb the pixels, 3 bytes each, row by row. They must stay valid until
+/// the element is rendered.
+/// @param width the number of pixels of a row.
+/// @param height the number of rows.
+/// @param mode with half blocks, every character draws 1x2 pixels. With
+/// braille dots, 2x4 pixels.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<uint8_t> frame = camera.Capture();  // 160x120 pixels.
+/// Element preview = image(frame.data(), 160, 120);
+/// ```
+Element image(const uint8_t* rgb, int width, int height, ImageMode mode) {
+  class Impl : public Node {
+   public:
+    Impl(Image image, ImageMode mode) : image_(image), mode_(mode) {
+      const bool half_block = mode_ == ImageMode::HalfBlock;
+      requirement_.min_x = half_block ? image_.width : (image_.width + 1) / 2;
+      requirement_.min_y =
+          half_block ? (image_.height + 1) / 2 : (image_.height + 3) / 4;
+    }
+
+    void Render(Screen& screen) override {
+      const int x_max =
+          std::min(requirement_.min_x, box_.x_max - box_.x_min + 1);
+      const int y_max =
+          std::min(requirement_.min_y, box_.y_max - box_.y_min + 1);
+      if (mode_ == ImageMode::HalfBlock) {
+        for (int y = 0; y < y_max; ++y) {
+          for (int x = 0; x < x_max; ++x) {
+            HalfBlockPixel(image_, x, y,
+                           screen.PixelAt(box_.x_min + x, box_.y_min + y));
+          }
+        }
+        return;
+      }
+      const std::vector<uint8_t> luminance = Luminance(image_);
+      for (int y = 0; y < y_max; ++y) {
+        for (int x = 0; x < x_max; ++x) {
+          Pixel& pixel = screen.PixelAt(box_.x_min + x, box_.y_min + y);
+          pixel.character = BrailleGlyph(
+              BraillePixel(image_, luminance, x, y, &pixel.foreground_color));
+        }
+      }
+    }
+
+   private:
+    Image image_;
+    ImageMode mode_;
+  };
+  return MakeNode<Impl>(Image{rgb, std::max(0, width), std::max(0, height)},
+                        mode);
+}
+
 /// @brief Produce an element from a Canvas, or a reference to a Canvas.
 Element canvas(ConstRef<Canvas> canvas) {
   class Impl : public CanvasNodeBase {
@@ -855,7 +1158,7 @@ Element canvas(ConstRef<Canvas> canvas) {
     const Canvas& canvas() final { return *canvas_; }
     ConstRef<Canvas> canvas_;
   };
-  return std::make_shared<Impl>(std::move(canvas));
+  return MakeNode<Impl>(std::move(canvas));
 }
 
 /// @brief Produce an element drawing a canvas of requested size.
@@ -868,12 +1171,12 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
     Impl(int width, int height, std::function<void(Canvas&)> fn)
         : width_(width), height_(height), fn_(std::move(fn)) {}
 
-    void ComputeRequirement() final {
+    void ComputeRequirement() override {
       requirement_.min_x = (width_ + 1) / 2;
       requirement_.min_y = (height_ + 3) / 4;
     }
 
-    void Render(Screen& screen) final {
+    void Render(Screen& screen) override {
       const int width = (box_.x_max - box_.x_min + 1) * 2;
       const int height = (box_.y_max - box_.y_min + 1) * 4;
       canvas_ = Canvas(width, height);
@@ -882,12 +1185,15 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
     }
 
     const Canvas& canvas() final { return canvas_; }
+    size_t MemoryUsage() const override {
+      return Node::MemoryUsage() + canvas_.MemoryUsage();
+    }
     Canvas canvas_;
     int width_;
     int height_;
     std::function<void(Canvas&)> fn_;
   };
-  return std::make_shared<Impl>(width, height, std::move(fn));
+  return MakeNode<Impl>(width, height, std::move(fn));
 }
 
 /// @brief Produce an element drawing a canvas.
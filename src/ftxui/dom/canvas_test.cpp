@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
-#include <stdint.h>  // for uint32_t
+#include <stdint.h>  // for uint32_t, uint8_t
 #include <string>    // for allocator, string
+#include <vector>    // for vector
 
 #include "ftxui/dom/canvas.hpp"    // for Canvas
 #include "ftxui/dom/elements.hpp"  // for canvas
@@ -52,7 +53,7 @@ TEST(CanvasTest, GoldPointColor) {
   });
   Screen screen(30, 10);
   Render(screen, element);
-  EXPECT_EQ(Hash(screen.ToString()), 1264423298);
+  EXPECT_EQ(Hash(screen.ToString()), 4112518716);
 }
 
 TEST(CanvasTest, GoldBlock) {
@@ -85,7 +86,7 @@ TEST(CanvasTest, GoldBlockColor) {
   });
   Screen screen(30, 10);
   Render(screen, element);
-  EXPECT_EQ(Hash(screen.ToString()), 3048712696);
+  EXPECT_EQ(Hash(screen.ToString()), 841645876);
 }
 
 TEST(CanvasTest, GoldText) {
@@ -100,6 +101,135 @@ TEST(CanvasTest, GoldText) {
   EXPECT_EQ(Hash(screen.ToString()), 1074960375);
 }
 
+TEST(CanvasTest, DrawPoints) {
+  const std::vector<Canvas::Point> points = {{1, 2}, {3, 9}, {-1, 0}, {4, 4}};
+  Canvas expected(10, 10);
+  for (const Canvas::Point& point : points) {
+    expected.DrawPoint(point.x, point.y, true, Color::Red);
+  }
+  Canvas c(10, 10);
+  c.DrawPoints(points, Color::Red);
+  for (int y = 0; y < 3; ++y) {
+    for (int x = 0; x < 5; ++x) {
+      EXPECT_EQ(c.GetPixel(x, y), expected.GetPixel(x, y));
+    }
+  }
+}
+
+TEST(CanvasTest, DrawPointPolyline) {
+  const std::vector<Canvas::Point> points = {{0, 0}, {9, 3}, {2, 9}, {20, 20}};
+  Canvas expected(10, 10);
+  for (size_t i = 1; i < points.size(); ++i) {
+    expected.DrawPointLine(points[i - 1].x, points[i - 1].y, points[i].x,
+                           points[i].y, Color::Blue);
+  }
+  Canvas c(10, 10);
+  c.DrawPointPolyline(points, Color::Blue);
+  for (int y = 0; y < 3; ++y) {
+    for (int x = 0; x < 5; ++x) {
+      EXPECT_EQ(c.GetPixel(x, y), expected.GetPixel(x, y));
+    }
+  }
+
+  Canvas single(10, 10);
+  single.DrawPointPolyline(std::vector<Canvas::Point>{{3, 3}});
+  EXPECT_EQ(single.GetPixel(1, 0).character, "⢀");
+}
+
+TEST(CanvasTest, Scroll) {
+  Canvas c(6, 4);
+  c.DrawPointOn(2, 0);
+  EXPECT_EQ(c.GetPixel(1, 0).character, "⠁");
+
+  c.Scroll(1);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "⠈");
+  EXPECT_EQ(c.GetPixel(1, 0).character, "⠀");
+  EXPECT_EQ(c.GetPixel(2, 0).character, " ");
+
+  c.Scroll(1);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "⠁");
+
+  c.Scroll(-4);
+  EXPECT_EQ(c.GetPixel(0, 0).character, " ");
+  EXPECT_EQ(c.GetPixel(1, 0).character, " ");
+  EXPECT_EQ(c.GetPixel(2, 0).character, "⠁");
+}
+
+TEST(CanvasTest, ScrollBlockAndText) {
+  Canvas c(4, 8);
+  c.DrawBlockOn(2, 0);
+  c.DrawText(2, 4, "a");
+  EXPECT_EQ(c.GetPixel(1, 0).character, "▘");
+
+  c.Scroll(1);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "▝");
+  EXPECT_EQ(c.GetPixel(1, 1).character, "a");
+
+  c.Scroll(2);
+  EXPECT_EQ(c.GetPixel(0, 0).character, " ");
+  EXPECT_EQ(c.GetPixel(0, 1).character, "a");
+}
+
+TEST(CanvasTest, Wide) {
+  Canvas c(5000, 8);
+  c.DrawPointOn(4000, 0);
+  c.DrawPointOn(4000, 3);
+  c.DrawBlockOn(4002, 4);
+  c.DrawText(0, 0, "a");
+  EXPECT_EQ(c.GetPixel(2000, 0).character, "⡁");
+  EXPECT_EQ(c.GetPixel(2001, 1).character, "▘");
+  EXPECT_EQ(c.GetPixel(2000, 1).character, " ");
+  EXPECT_EQ(c.GetPixel(0, 0).character, "a");
+  EXPECT_EQ(c.GetPixel(2500, 0).character, " ");
+
+  c.DrawPointOff(4000, 0);
+  c.DrawPointToggle(4000, 3);
+  EXPECT_EQ(c.GetPixel(2000, 0).character, "⠀");
+}
+
+TEST(CanvasTest, DrawImage) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  // Red, white, blue, black, green, black.
+  const std::vector<uint8_t> rgb = {
+      255, 0,   0,   255, 255, 255,  //
+      0,   0,   255, 0,   0,   0,    //
+      0,   255, 0,   0,   0,   0,    //
+  };
+
+  Canvas c(4, 8);
+  c.DrawImage(0, 0, rgb.data(), 2, 3);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "▀");
+  EXPECT_EQ(c.GetPixel(0, 0).foreground_color, Color::RGB(255, 0, 0));
+  EXPECT_EQ(c.GetPixel(0, 0).background_color, Color::RGB(0, 0, 255));
+  EXPECT_EQ(c.GetPixel(1, 0).foreground_color, Color::RGB(255, 255, 255));
+  EXPECT_EQ(c.GetPixel(0, 1).foreground_color, Color::RGB(0, 255, 0));
+  EXPECT_EQ(c.GetPixel(0, 1).background_color, Color(Color::Default));
+
+  // The white and the green pixels are bright enough.
+  c.DrawImage(0, 0, rgb.data(), 2, 3, ImageMode::Braille);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "⠌");
+  EXPECT_EQ(c.GetPixel(0, 0).foreground_color, Color::RGB(127, 255, 127));
+}
+
+TEST(CanvasTest, ImageElement) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const std::vector<uint8_t> rgb = {
+      255, 0,   0,   255, 255, 255,  //
+      0,   0,   255, 0,   0,   0,    //
+      0,   255, 0,   0,   0,   0,    //
+  };
+  Screen screen(3, 2);
+  Render(screen, image(rgb.data(), 2, 3));
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "▀");
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Color::RGB(0, 0, 255));
+  EXPECT_EQ(screen.PixelAt(0, 1).foreground_color, Color::RGB(0, 255, 0));
+  EXPECT_EQ(screen.PixelAt(2, 0).character, " ");
+
+  Screen small(1, 1);
+  Render(small, image(rgb.data(), 2, 3, ImageMode::Braille));
+  EXPECT_NE(small.ToString().find("⠌"), std::string::npos);
+}
+
 }  // namespace ftxui
 
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
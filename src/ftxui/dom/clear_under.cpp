@@ -16,13 +16,12 @@ class ClearUnder : public NodeDecorator {
   using NodeDecorator::NodeDecorator;
 
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = Pixel();
-      }
-    }
+    screen.FillRect(box_, Pixel());
     Node::Render(screen);
   }
+
+  // Every pixel of the box is overwritten.
+  Box OpaqueBox() override { return box_; }
 };
 
 /// @brief Before drawing |child|, clear the pixels below. This is useful in
@@ -30,7 +29,7 @@ class ClearUnder : public NodeDecorator {
 /// @see ftxui::dbox
 /// @ingroup dom
 Element clear_under(Element element) {
-  return std::make_shared<ClearUnder>(std::move(element));
+  return MakeNode<ClearUnder>(std::move(element));
 }
 
 }  // namespace ftxui
@@ -1,48 +1,11 @@
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/color.hpp"        // for Color
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color, style
+#include "ftxui/dom/style.hpp"     // for Style
+#include "ftxui/screen/color.hpp"  // for Color
 
 namespace ftxui {
 
-class BgColor : public NodeDecorator {
- public:
-  BgColor(Element child, Color color)
-      : NodeDecorator(std::move(child)), color_(color) {}
-
-  void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).background_color = color_;
-      }
-    }
-    NodeDecorator::Render(screen);
-  }
-
-  Color color_;
-};
-
-class FgColor : public NodeDecorator {
- public:
-  FgColor(Element child, Color color)
-      : NodeDecorator(std::move(child)), color_(color) {}
-
-  void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).foreground_color = color_;
-      }
-    }
-    NodeDecorator::Render(screen);
-  }
-
-  Color color_;
-};
-
 /// @brief Set the foreground color of an element.
 /// @param color The color of the output element.
 /// @param child The input element.
@@ -55,7 +18,9 @@ class FgColor : public NodeDecorator {
 /// Element document = color(Color::Green, text("Success")),
 /// ```
 Element color(Color color, Element child) {
-  return std::make_shared<FgColor>(std::move(child), color);
+  Style s;
+  s.foreground_color = color;
+  return style(std::move(child), s);
 }
 
 /// @brief Set the background color of an element.
@@ -70,7 +35,9 @@ Element color(Color color, Element child) {
 /// Element document = bgcolor(Color::Green, text("Success")),
 /// ```
 Element bgcolor(Color color, Element child) {
-  return std::make_shared<BgColor>(std::move(child), color);
+  Style s;
+  s.background_color = color;
+  return style(std::move(child), s);
 }
 
 /// @brief Decorate using a foreground color.
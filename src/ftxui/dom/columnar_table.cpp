@@ -0,0 +1,131 @@
+#include <algorithm>     // for max, min
+#include <array>         // for array
+#include <charconv>      // for to_chars
+#include <climits>       // for INT_MAX
+#include <cstddef>       // for size_t
+#include <cstdint>       // for int64_t
+#include <functional>    // for function
+#include <memory>        // for make_shared
+#include <span>          // for span
+#include <string>        // for string
+#include <string_view>   // for string_view
+#include <system_error>  // for errc
+#include <utility>       // for move
+#include <vector>        // for vector
+
+#include "ftxui/dom/table.hpp"  // for ColumnarTable, VirtualTable, TableAlign
+
+namespace ftxui {
+namespace {
+
+// The shortest representation of |value|, parsed back into the same value.
+template <class T>
+std::string Shortest(T value) {
+  std::array<char, 32> buffer;  // NOLINT
+  const auto result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  if (result.ec != std::errc()) {
+    return {};
+  }
+  return {buffer.data(), result.ptr};
+}
+
+}  // namespace
+
+/// @brief Add a column of numbers.
+/// @param header The text of the first row.
+/// @param values The values, viewed until the table is destroyed.
+/// @param format Formats a visible value. Its shortest form by default.
+/// @param align Where the values are drawn in the column.
+ColumnarTable& ColumnarTable::Column(std::string header,
+                                     std::span<const double> values,
+                                     Formatter<double> format,
+                                     TableAlign align) {
+  if (!format) {
+    format = Shortest<double>;
+  }
+  return Add(std::move(header), values.size(), align,
+             [values, format = std::move(format)](int i) {
+               return format(values[i]);
+             });
+}
+
+/// @brief Add a column of integers.
+/// @param header The text of the first row.
+/// @param values The values, viewed until the table is destroyed.
+/// @param format Formats a visible value. In decimal by default.
+/// @param align Where the values are drawn in the column.
+ColumnarTable& ColumnarTable::Column(std::string header,
+                                     std::span<const int64_t> values,
+                                     Formatter<int64_t> format,
+                                     TableAlign align) {
+  if (!format) {
+    format = Shortest<int64_t>;
+  }
+  return Add(std::move(header), values.size(), align,
+             [values, format = std::move(format)](int i) {
+               return format(values[i]);
+             });
+}
+
+/// @brief Add a column of strings.
+/// @param header The text of the first row.
+/// @param values The values, viewed until the table is destroyed, as well as
+///        the characters they point to.
+/// @param format Formats a visible value. As is by default.
+/// @param align Where the values are drawn in the column.
+ColumnarTable& ColumnarTable::Column(std::string header,
+                                     std::span<const std::string_view> values,
+                                     Formatter<std::string_view> format,
+                                     TableAlign align) {
+  if (!format) {
+    return Add(std::move(header), values.size(), align,
+               [values](int i) { return std::string(values[i]); });
+  }
+  return Add(std::move(header), values.size(), align,
+             [values, format = std::move(format)](int i) {
+               return format(values[i]);
+             });
+}
+
+ColumnarTable& ColumnarTable::Add(std::string header,
+                                  size_t size,
+                                  TableAlign align,
+                                  std::function<std::string(int i)> cell) {
+  // The header takes a row too.
+  const int rows = int(std::min(size, size_t(INT_MAX - 1)));
+  rows_ = std::max(rows_, rows);
+  columns_.push_back({std::move(header), rows, align, std::move(cell)});
+  return *this;
+}
+
+/// @brief The table of the columns added. Its first row holds the headers.
+/// Nothing is formatted until its rows are drawn, except the ones sampled for
+/// the width of the columns. See VirtualTable.
+VirtualTable ColumnarTable::Build() const {
+  auto columns = std::make_shared<const std::vector<Entry>>(columns_);
+  VirtualTable table(rows_ + 1, int(columns->size()), [columns](int row) {
+    std::vector<std::string> cells;
+    cells.reserve(columns->size());
+    for (const Entry& column : *columns) {
+      if (row == 0) {
+        cells.push_back(column.header);
+      } else if (row - 1 < column.size) {
+        cells.push_back(column.cell(row - 1));
+      } else {
+        cells.emplace_back();
+      }
+    }
+    return cells;
+  });
+  for (size_t i = 0; i < columns->size(); ++i) {
+    table.SetColumnAlignment(int(i), (*columns)[i].align);
+  }
+  return table;
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <cstdint>      // for int64_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/dom/elements.hpp"   // for LIGHT, yframe, operator|
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/table.hpp"      // for ColumnarTable, VirtualTable
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+std::string Draw(const Element& element, int width, int height) {
+  Screen screen(width, height);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(ColumnarTableTest, Basic) {
+  const std::vector<std::string_view> names = {"a", "bcd", "ef"};
+  const std::vector<int64_t> counts = {1, 200, -3};
+  const std::vector<double> prices = {1.5, 0.25, 10};
+  auto table = ColumnarTable()
+                   .Column("Name", names)
+                   .Column("Count", counts)
+                   .Column("Price", prices)
+                   .Build();
+  table.SelectAll().Border(LIGHT);
+  EXPECT_EQ(Draw(table.Render(), 16, 6),
+            "┌──────────────┐\r\n"
+            "│NameCountPrice│\r\n"
+            "│a       1  1.5│\r\n"
+            "│bcd   200 0.25│\r\n"
+            "│ef     -3   10│\r\n"
+            "└──────────────┘");
+}
+
+TEST(ColumnarTableTest, FormatOnlyVisibleRows) {
+  std::vector<double> values(1'000'000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = double(i);
+  }
+  int formatted = 0;
+  auto table = ColumnarTable()
+                   .Column("Value", values,
+                           [&](double value) {
+                             formatted++;
+                             return std::to_string(int(value));
+                           })
+                   .Build();
+  table.SetColumnWidth(0, 7);
+  const std::string output = Draw(table.Render(500'000) | yframe, 7, 3);
+  EXPECT_NE(output.find("499999"), std::string::npos);
+  EXPECT_LT(formatted, 10);
+}
+
+TEST(ColumnarTableTest, ShorterColumn) {
+  const std::vector<int64_t> a = {1, 2, 3};
+  const std::vector<int64_t> b = {4};
+  auto table = ColumnarTable()
+                   .Column("a", a, {}, TableAlign::Left)
+                   .Column("b", b, {}, TableAlign::Center)
+                   .Build();
+  EXPECT_EQ(Draw(table.Render(), 2, 4),
+            "ab\r\n"
+            "14\r\n"
+            "2 \r\n"
+            "3 ");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,15 +1,48 @@
-#include <algorithm>  // for max
+#include <algorithm>  // for fill, max
 #include <memory>     // for __shared_ptr_access, shared_ptr, make_shared
 #include <utility>    // for move
 #include <vector>     // for vector
 
+#include "ftxui/dom/box_helper.hpp"   // for Scratch
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, dbox
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
 
 namespace ftxui {
 
+namespace {
+
+bool IsEmpty(const Box& box) {
+  return box.x_min > box.x_max || box.y_min > box.y_max;
+}
+
+// Remove from |visible| the part hidden by |opaque|, as long as what remains
+// is still a box.
+void Occlude(Box& visible, const Box& opaque) {
+  if (IsEmpty(opaque) || IsEmpty(Box::Intersection(visible, opaque))) {
+    return;
+  }
+  const bool cover_x =
+      opaque.x_min <= visible.x_min && opaque.x_max >= visible.x_max;
+  const bool cover_y =
+      opaque.y_min <= visible.y_min && opaque.y_max >= visible.y_max;
+  if (cover_x && cover_y) {
+    visible.x_max = visible.x_min - 1;
+  } else if (cover_x && opaque.y_min <= visible.y_min) {
+    visible.y_min = opaque.y_max + 1;
+  } else if (cover_x && opaque.y_max >= visible.y_max) {
+    visible.y_max = opaque.y_min - 1;
+  } else if (cover_y && opaque.x_min <= visible.x_min) {
+    visible.x_min = opaque.x_max + 1;
+  } else if (cover_y && opaque.x_max >= visible.x_max) {
+    visible.x_max = opaque.x_min - 1;
+  }
+}
+
+}  // namespace
+
 class DBox : public Node {
  public:
   explicit DBox(Elements children) : Node(std::move(children)) {}
@@ -22,8 +55,8 @@ class DBox : public Node {
     requirement_.flex_shrink_x = 0;
     requirement_.flex_shrink_y = 0;
     requirement_.selection = Requirement::NORMAL;
+    ComputeChildrenRequirement();
     for (auto& child : children_) {
-      child->ComputeRequirement();
       requirement_.min_x =
           std::max(requirement_.min_x, child->requirement().min_x);
       requirement_.min_y =
@@ -38,10 +71,44 @@ class DBox : public Node {
 
   void SetBox(Box box) override {
     Node::SetBox(box);
+    const box_helper::Scratch scratch(children_.size());
+    std::fill(scratch.boxes.begin(), scratch.boxes.end(), box);
+    SetChildrenBox(scratch.boxes);
+  }
 
-    for (auto& child : children_) {
-      child->SetBox(box);
+  // The layers hidden by the opaque ones above them, like a clear_under()
+  // modal, are skipped, or drawn within a smaller stencil.
+  void Render(Screen& screen) override {
+    std::vector<Box> opaque(children_.size(), Box{0, -1, 0, -1});
+    for (size_t i = 1; i < children_.size(); ++i) {
+      opaque[i] = children_[i]->OpaqueBox();
+    }
+
+    const Box stencil = screen.stencil;
+    for (size_t i = 0; i < children_.size(); ++i) {
+      Box visible = stencil;
+      for (size_t j = i + 1; j < children_.size() && !IsEmpty(visible); ++j) {
+        Occlude(visible, opaque[j]);
+      }
+      if (IsEmpty(visible)) {
+        continue;
+      }
+      // The children of the layer entirely hidden by the ones above are
+      // skipped as well.
+      size_t occluders = 0;
+      for (size_t j = i + 1; j < children_.size(); ++j) {
+        if (!IsEmpty(Box::Intersection(visible, opaque[j]))) {
+          PushOccluder(opaque[j]);
+          occluders++;
+        }
+      }
+      screen.stencil = visible;
+      RenderChild(screen, i);
+      for (; occluders > 0; --occluders) {
+        PopOccluder();
+      }
     }
+    screen.stencil = stencil;
   }
 };
 
@@ -50,7 +117,7 @@ class DBox : public Node {
 /// @return The right aligned element.
 /// @ingroup dom
 Element dbox(Elements children_) {
-  return std::make_shared<DBox>(std::move(children_));
+  return MakeNode<DBox>(std::move(children_));
 }
 
 }  // namespace ftxui
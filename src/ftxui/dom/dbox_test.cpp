@@ -2,7 +2,7 @@
 #include <string>  // for allocator
 
 #include "ftxui/dom/elements.hpp"  // for filler, operator|, text, border, dbox, hbox, vbox, Element
-#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/node.hpp"       // for Render, MakeNode
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 namespace ftxui {
@@ -28,6 +28,101 @@ TEST(DBoxTest, Basic) {
             "╰────╯  ");
 }
 
+namespace {
+
+// Count how many times the stencil let it draw a pixel.
+class Counter : public Node {
+ public:
+  explicit Counter(int* count) : count_(count) {}
+  void Render(Screen& screen) override {
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      for (int x = box_.x_min; x <= box_.x_max; ++x) {
+        if (screen.stencil.Contain(x, y)) {
+          (*count_)++;
+        }
+        screen.PixelAt(x, y).character = "x";
+      }
+    }
+  }
+
+ private:
+  int* count_;
+};
+
+}  // namespace
+
+TEST(DBoxTest, OpaqueLayerHidesTheLowerOnes) {
+  int count = 0;
+  auto root = dbox({
+      MakeNode<Counter>(&count),
+      text("modal") | clear_under,
+  });
+
+  Screen screen(5, 2);
+  Render(screen, root);
+  EXPECT_EQ(count, 0);
+  EXPECT_EQ(screen.ToString(),
+            "modal\r\n"
+            "     ");
+}
+
+TEST(DBoxTest, OpaqueLayerClipsTheLowerOnes) {
+  int count = 0;
+  auto root = dbox({
+      MakeNode<Counter>(&count),
+      vbox({
+          filler(),
+          text("modal") | clear_under,
+      }),
+  });
+
+  Screen screen(5, 3);
+  Render(screen, root);
+  EXPECT_EQ(count, 10);
+  EXPECT_EQ(screen.ToString(),
+            "xxxxx\r\n"
+            "xxxxx\r\n"
+            "modal");
+}
+
+TEST(DBoxTest, OpaqueModal) {
+  int count = 0;
+  auto root = dbox({
+      MakeNode<Counter>(&count),
+      text("ab") | border | clear_under | center,
+  });
+
+  Screen screen(6, 5);
+  Render(screen, root);
+  // The modal doesn't span the whole width or height: the layer below is drawn
+  // normally.
+  EXPECT_EQ(count, 30);
+  EXPECT_EQ(screen.ToString(),
+            "xxxxxx\r\n"
+            "x╭──╮x\r\n"
+            "x│ab│x\r\n"
+            "x╰──╯x\r\n"
+            "xxxxxx");
+}
+
+TEST(DBoxTest, OpaqueLayerHidesTheLowerChildren) {
+  int count = 0;
+  auto root = dbox({
+      hbox({
+          MakeNode<Counter>(&count) | flex,
+          MakeNode<Counter>(&count) | flex,
+          MakeNode<Counter>(&count) | flex,
+      }),
+      hbox({filler(), text("mmm") | clear_under, filler()}),
+  });
+
+  Screen screen(9, 1);
+  Render(screen, root);
+  // The child in the middle is entirely hidden.
+  EXPECT_EQ(count, 6);
+  EXPECT_EQ(screen.ToString(), "xxxmmmxxx");
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
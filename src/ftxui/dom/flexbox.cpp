@@ -1,4 +1,5 @@
 #include <algorithm>  // for min, max
+#include <array>      // for array
 #include <cstddef>    // for size_t
 #include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type, make_shared
 #include <utility>  // for move, swap
@@ -66,38 +67,81 @@ class Flexbox : public Node {
            config_.direction == FlexboxConfig::Direction::ColumnInversed;
   }
 
-  void Layout(flexbox_helper::Global& global,
-              bool compute_requirement = false) {
-    for (auto& child : children_) {
-      flexbox_helper::Block block;
-      block.min_size_x = child->requirement().min_x;
-      block.min_size_y = child->requirement().min_y;
-      if (!compute_requirement) {
-        block.flex_grow_x = child->requirement().flex_grow_x;
-        block.flex_grow_y = child->requirement().flex_grow_y;
-        block.flex_shrink_x = child->requirement().flex_shrink_x;
-        block.flex_shrink_y = child->requirement().flex_shrink_y;
+  // Lay out the children into a |size_x| x |size_y| area. The last layouts
+  // are kept: they are reused when the children requirements and the size are
+  // the same. This is the case for the successive iterations of a frame, and
+  // for the elements kept across frames.
+  const flexbox_helper::Global& Layout(const FlexboxConfig& config,
+                                       int size_x,
+                                       int size_y,
+                                       bool compute_requirement = false) {
+    for (const CachedLayout& cached : cache_) {
+      if (cached.valid && cached.compute_requirement == compute_requirement &&
+          cached.global.size_x == size_x && cached.global.size_y == size_y &&
+          SameInputs(cached.global.blocks, compute_requirement)) {
+        return cached.global;
       }
-      global.blocks.push_back(block);
     }
 
-    flexbox_helper::Compute(global);
+    CachedLayout& cached = cache_[cache_next_];
+    cache_next_ = (cache_next_ + 1) % cache_.size();
+    cached.valid = true;
+    cached.compute_requirement = compute_requirement;
+    flexbox_helper::Global& global = cached.global;
+    global.config = config;
+    global.size_x = size_x;
+    global.size_y = size_y;
+    global.blocks.resize(children_.size());
+    for (size_t i = 0; i < children_.size(); ++i) {
+      global.blocks[i] = MakeBlock(*children_[i], compute_requirement);
+    }
+
+    flexbox_helper::Compute(global, workspace_);
+    return global;
   }
 
-  void ComputeRequirement() override {
-    for (auto& child : children_) {
-      child->ComputeRequirement();
+  bool SameInputs(const std::vector<flexbox_helper::Block>& blocks,
+                  bool compute_requirement) {
+    if (blocks.size() != children_.size()) {
+      return false;
     }
-    flexbox_helper::Global global;
-    global.config = config_normalized_;
-    if (IsColumnOriented()) {
-      global.size_x = 100000;  // NOLINT
-      global.size_y = asked_;
-    } else {
-      global.size_x = asked_;
-      global.size_y = 100000;  // NOLINT
+    for (size_t i = 0; i < children_.size(); ++i) {
+      const flexbox_helper::Block block =
+          MakeBlock(*children_[i], compute_requirement);
+      const flexbox_helper::Block& cached = blocks[i];
+      if (block.min_size_x != cached.min_size_x ||
+          block.min_size_y != cached.min_size_y ||
+          block.flex_grow_x != cached.flex_grow_x ||
+          block.flex_grow_y != cached.flex_grow_y ||
+          block.flex_shrink_x != cached.flex_shrink_x ||
+          block.flex_shrink_y != cached.flex_shrink_y) {
+        return false;
+      }
     }
-    Layout(global, true);
+    return true;
+  }
+
+  static flexbox_helper::Block MakeBlock(Node& child,
+                                         bool compute_requirement) {
+    const Requirement& requirement = child.requirement();
+    flexbox_helper::Block block;
+    block.min_size_x = requirement.min_x;
+    block.min_size_y = requirement.min_y;
+    if (!compute_requirement) {
+      block.flex_grow_x = requirement.flex_grow_x;
+      block.flex_grow_y = requirement.flex_grow_y;
+      block.flex_shrink_x = requirement.flex_shrink_x;
+      block.flex_shrink_y = requirement.flex_shrink_y;
+    }
+    return block;
+  }
+
+  void ComputeRequirement() override {
+    ComputeChildrenRequirement();
+    const flexbox_helper::Global& global =
+        IsColumnOriented()
+            ? Layout(config_normalized_, 100000, asked_, true)   // NOLINT
+            : Layout(config_normalized_, asked_, 100000, true);  // NOLINT
 
     // Reset:
     requirement_.selection = Requirement::Selection::NORMAL;
@@ -150,15 +194,12 @@ class Flexbox : public Node {
                                                  : box.x_max - box.x_min + 1);
     need_iteration_ = (asked_ != asked_previous);
 
-    flexbox_helper::Global global;
-    global.config = config_;
-    global.size_x = box.x_max - box.x_min + 1;
-    global.size_y = box.y_max - box.y_min + 1;
-    Layout(global);
+    const flexbox_helper::Global& global =
+        Layout(config_, box.x_max - box.x_min + 1, box.y_max - box.y_min + 1);
 
+    std::vector<Box> boxes(children_.size());
     for (size_t i = 0; i < children_.size(); ++i) {
-      auto& child = children_[i];
-      auto& b = global.blocks[i];
+      const auto& b = global.blocks[i];
 
       Box children_box;
       children_box.x_min = box.x_min + b.x;
@@ -166,11 +207,10 @@ class Flexbox : public Node {
       children_box.x_max = box.x_min + b.x + b.dim_x - 1;
       children_box.y_max = box.y_min + b.y + b.dim_y - 1;
 
-      const Box intersection = Box::Intersection(children_box, box);
-      child->SetBox(intersection);
-
-      need_iteration_ |= (intersection != children_box);
+      boxes[i] = Box::Intersection(children_box, box);
+      need_iteration_ |= (boxes[i] != children_box);
     }
+    SetChildrenBox(boxes);
   }
 
   void Check(Status* status) override {
@@ -190,6 +230,17 @@ class Flexbox : public Node {
   bool need_iteration_ = true;
   const FlexboxConfig config_;
   const FlexboxConfig config_normalized_;
+
+  struct CachedLayout {
+    bool valid = false;
+    bool compute_requirement = false;
+    flexbox_helper::Global global;
+  };
+  // A frame uses three layouts: the requirement with the size asked at first,
+  // the box, and the requirement with the size of the box.
+  std::array<CachedLayout, 3> cache_;
+  size_t cache_next_ = 0;
+  flexbox_helper::Workspace workspace_;
 };
 
 }  // namespace
@@ -215,7 +266,7 @@ class Flexbox : public Node {
 //  )
 /// ```
 Element flexbox(Elements children, FlexboxConfig config) {
-  return std::make_shared<Flexbox>(std::move(children), config);
+  return MakeNode<Flexbox>(std::move(children), config);
 }
 
 /// @brief A container displaying elements in rows from left to right. When
@@ -2,177 +2,156 @@
 
 #include <algorithm>                     // for max, min
 #include <cstddef>                       // for size_t
-#include <ftxui/dom/flexbox_config.hpp>  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::AlignContent, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::Direction::RowInversed, FlexboxConfig::AlignItems, FlexboxConfig::Direction::Row, FlexboxConfig::Direction::Column, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Wrap::WrapInversed, FlexboxConfig::AlignContent::Stretch, FlexboxConfig::JustifyContent::Stretch, FlexboxConfig::Wrap::Wrap, FlexboxConfig::AlignContent::Center, FlexboxConfig::AlignContent::FlexEnd, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::AlignContent::SpaceAround, FlexboxConfig::AlignContent::SpaceBetween, FlexboxConfig::AlignContent::SpaceEvenly, FlexboxConfig::AlignItems::Center, FlexboxConfig::AlignItems::FlexEnd, FlexboxConfig::AlignItems::FlexStart, FlexboxConfig::AlignItems::Stretch, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::FlexEnd, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::JustifyContent::SpaceAround, FlexboxConfig::JustifyContent::SpaceBetween, FlexboxConfig::JustifyContent::SpaceEvenly, FlexboxConfig::Wrap::NoWrap
-#include <memory>                        // for allocator_traits<>::value_type
-#include <utility>                       // for swap, move
+#include <ftxui/dom/flexbox_config.hpp>  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::AlignContent, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::Direction::RowInversed, FlexboxConfig::AlignItems, FlexboxConfig::Direction::Column, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Wrap::WrapInversed, FlexboxConfig::AlignContent::Stretch, FlexboxConfig::JustifyContent::Stretch, FlexboxConfig::AlignContent::Center, FlexboxConfig::AlignContent::FlexEnd, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::AlignContent::SpaceAround, FlexboxConfig::AlignContent::SpaceBetween, FlexboxConfig::AlignContent::SpaceEvenly, FlexboxConfig::AlignItems::Center, FlexboxConfig::AlignItems::FlexEnd, FlexboxConfig::AlignItems::FlexStart, FlexboxConfig::AlignItems::Stretch, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::FlexEnd, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::JustifyContent::SpaceAround, FlexboxConfig::JustifyContent::SpaceBetween, FlexboxConfig::JustifyContent::SpaceEvenly
 
 #include "ftxui/dom/box_helper.hpp"  // for Element, Compute
 
 namespace ftxui::flexbox_helper {
 
 namespace {
-void SymmetryXY(FlexboxConfig& c) {
-  std::swap(c.gap_x, c.gap_y);
-  switch (c.direction) {
-    case FlexboxConfig::Direction::Row:
-      c.direction = FlexboxConfig::Direction::Column;
-      break;
-    case FlexboxConfig::Direction::RowInversed:
-      c.direction = FlexboxConfig::Direction::ColumnInversed;
-      break;
-    case FlexboxConfig::Direction::Column:
-      c.direction = FlexboxConfig::Direction::Row;
-      break;
-    case FlexboxConfig::Direction::ColumnInversed:
-      c.direction = FlexboxConfig::Direction::RowInversed;
-      break;
-  }
-}
 
-void SymmetryX(FlexboxConfig& c) {
-  switch (c.direction) {
-    case FlexboxConfig::Direction::Row:
-      c.direction = FlexboxConfig::Direction::RowInversed;
-      break;
-    case FlexboxConfig::Direction::RowInversed:
-      c.direction = FlexboxConfig::Direction::Row;
-      break;
-    default:
-      break;
-  }
-}
+// The fields of the blocks along one axis. The blocks are laid out into lines
+// along the main axis. The lines are stacked along the cross axis. For the
+// column directions, the main axis is Y.
+struct Axis {
+  int Block::*min_size;
+  int Block::*flex_grow;
+  int Block::*flex_shrink;
+  int Block::*position;
+  int Block::*dim;
+  int size;
+  int gap;
+};
 
-void SymmetryY(FlexboxConfig& c) {
-  switch (c.wrap) {
-    case FlexboxConfig::Wrap::NoWrap:
-      break;
-    case FlexboxConfig::Wrap::Wrap:
-      c.wrap = FlexboxConfig::Wrap::WrapInversed;
-      break;
-    case FlexboxConfig::Wrap::WrapInversed:
-      c.wrap = FlexboxConfig::Wrap::Wrap;
-      break;
-  }
+Axis AxisX(const Global& g) {
+  return {&Block::min_size_x, &Block::flex_grow_x, &Block::flex_shrink_x,
+          &Block::x,          &Block::dim_x,       g.size_x,
+          g.config.gap_x};
 }
 
-void SymmetryXY(Global& g) {
-  SymmetryXY(g.config);
-  std::swap(g.size_x, g.size_y);
-  for (auto& b : g.blocks) {
-    std::swap(b.min_size_x, b.min_size_y);
-    std::swap(b.flex_grow_x, b.flex_grow_y);
-    std::swap(b.flex_shrink_x, b.flex_shrink_y);
-    std::swap(b.x, b.y);
-    std::swap(b.dim_x, b.dim_y);
-  }
+Axis AxisY(const Global& g) {
+  return {&Block::min_size_y, &Block::flex_grow_y, &Block::flex_shrink_y,
+          &Block::y,          &Block::dim_y,       g.size_y,
+          g.config.gap_y};
 }
 
-void SymmetryX(Global& g) {
-  SymmetryX(g.config);
-  for (auto& b : g.blocks) {
-    b.x = g.size_x - b.x - b.dim_x;
-  }
-}
+// Lay out every blocks into lines.
+void SetLines(Global& g, Workspace& w, const Axis& main) {
+  w.lines.clear();
+  w.lines.push_back(0);
+  int x = 0;
+  for (int i = 0; i < (int)g.blocks.size(); ++i) {
+    Block& block = g.blocks[i];
+    // Does it fit the end of the line?
+    // No? Then we need to start a new one:
+    if (x + block.*main.min_size > main.size) {
+      x = 0;
+      if (w.lines.back() != i) {
+        w.lines.push_back(i);
+      }
+    }
 
-void SymmetryY(Global& g) {
-  SymmetryY(g.config);
-  for (auto& b : g.blocks) {
-    b.y = g.size_y - b.y - b.dim_y;
+    block.line = (int)w.lines.size() - 1;
+    block.line_position = i - w.lines.back();
+    x += block.*main.min_size + main.gap;
   }
+  w.lines.push_back((int)g.blocks.size());
 }
 
-struct Line {
-  std::vector<Block*> blocks;
-};
+void SetX(Global& g, Workspace& w, const Axis& main) {
+  const bool stretch =
+      g.config.justify_content == FlexboxConfig::JustifyContent::Stretch;
+  for (size_t line = 0; line + 1 < w.lines.size(); ++line) {
+    const int begin = w.lines[line];
+    const int end = w.lines[line + 1];
 
-void SetX(Global& global, std::vector<Line> lines) {
-  for (auto& line : lines) {
-    std::vector<box_helper::Element> elements;
-    for (auto* block : line.blocks) {
+    w.elements.clear();
+    for (int i = begin; i < end; ++i) {
+      const Block& block = g.blocks[i];
       box_helper::Element element;
-      element.min_size = block->min_size_x;
-      element.flex_grow =
-          block->flex_grow_x != 0 || global.config.justify_content ==
-                                         FlexboxConfig::JustifyContent::Stretch
-              ? 1
-              : 0;
-      element.flex_shrink = block->flex_shrink_x;
-      elements.push_back(element);
+      element.min_size = block.*main.min_size;
+      element.flex_grow = block.*main.flex_grow != 0 || stretch ? 1 : 0;
+      element.flex_shrink = block.*main.flex_shrink;
+      w.elements.push_back(element);
     }
 
-    box_helper::Compute(
-        &elements,
-        global.size_x - global.config.gap_x * (int(line.blocks.size()) - 1));
+    box_helper::Compute(w.elements, main.size - main.gap * (end - begin - 1));
 
     int x = 0;
-    for (size_t i = 0; i < line.blocks.size(); ++i) {
-      line.blocks[i]->dim_x = elements[i].size;
-      line.blocks[i]->x = x;
-      x += elements[i].size;
-      x += global.config.gap_x;
+    for (int i = begin; i < end; ++i) {
+      Block& block = g.blocks[i];
+      block.*main.dim = w.elements[i - begin].size;
+      block.*main.position = x;
+      x += w.elements[i - begin].size;
+      x += main.gap;
     }
   }
 }
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-void SetY(Global& g, std::vector<Line> lines) {
-  std::vector<box_helper::Element> elements;
-  for (auto& line : lines) {
+void SetY(Global& g, Workspace& w, const Axis& cross) {
+  const int lines = (int)w.lines.size() - 1;
+  w.elements.clear();
+  for (int line = 0; line < lines; ++line) {
+    const Block& front = g.blocks[w.lines[line]];
     box_helper::Element element;
-    element.flex_shrink = line.blocks.front()->flex_shrink_y;
-    element.flex_grow = line.blocks.front()->flex_grow_y;
-    for (auto* block : line.blocks) {
-      element.min_size = std::max(element.min_size, block->min_size_y);
-      element.flex_shrink = std::min(element.flex_shrink, block->flex_shrink_y);
-      element.flex_grow = std::min(element.flex_grow, block->flex_grow_y);
+    element.flex_shrink = front.*cross.flex_shrink;
+    element.flex_grow = front.*cross.flex_grow;
+    for (int i = w.lines[line]; i < w.lines[line + 1]; ++i) {
+      const Block& block = g.blocks[i];
+      element.min_size = std::max(element.min_size, block.*cross.min_size);
+      element.flex_shrink =
+          std::min(element.flex_shrink, block.*cross.flex_shrink);
+      element.flex_grow = std::min(element.flex_grow, block.*cross.flex_grow);
     }
-    elements.push_back(element);
+    w.elements.push_back(element);
   }
 
   // box_helper::Compute(&elements, g.size_y);
-  box_helper::Compute(&elements, 10000);  // NOLINT
+  box_helper::Compute(w.elements, 10000);  // NOLINT
 
   // [Align-content]
-  std::vector<int> ys(elements.size());
+  std::vector<int>& ys = w.positions;
+  ys.resize(lines);
   int y = 0;
-  for (size_t i = 0; i < elements.size(); ++i) {
+  for (int i = 0; i < lines; ++i) {
     ys[i] = y;
-    y += elements[i].size;
-    y += g.config.gap_y;
+    y += w.elements[i].size;
+    y += cross.gap;
   }
-  int remaining_space = std::max(0, g.size_y - y);
+  int remaining_space = std::max(0, cross.size - y);
   switch (g.config.align_content) {
     case FlexboxConfig::AlignContent::FlexStart: {
       break;
     }
 
     case FlexboxConfig::AlignContent::FlexEnd: {
-      for (size_t i = 0; i < ys.size(); ++i) {  // NOLINT
+      for (int i = 0; i < lines; ++i) {  // NOLINT
         ys[i] += remaining_space;
       }
       break;
     }
 
     case FlexboxConfig::AlignContent::Center: {
-      for (size_t i = 0; i < ys.size(); ++i) {  // NOLINT
+      for (int i = 0; i < lines; ++i) {  // NOLINT
         ys[i] += remaining_space / 2;
       }
       break;
     }
 
     case FlexboxConfig::AlignContent::Stretch: {
-      for (int i = ys.size() - 1; i >= 0; --i) {  // NOLINT
+      for (int i = lines - 1; i >= 0; --i) {  // NOLINT
         const int shifted = remaining_space * (i + 0) / (i + 1);
         ys[i] += shifted;
         const int consumed = remaining_space - shifted;
-        elements[i].size += consumed;
+        w.elements[i].size += consumed;
         remaining_space -= consumed;
       }
       break;
     }
 
     case FlexboxConfig::AlignContent::SpaceBetween: {
-      for (int i = ys.size() - 1; i >= 1; --i) {  // NOLINT
+      for (int i = lines - 1; i >= 1; --i) {  // NOLINT
         ys[i] += remaining_space;
         remaining_space = remaining_space * (i - 1) / i;
       }
@@ -180,7 +159,7 @@ void SetY(Global& g, std::vector<Line> lines) {
     }
 
     case FlexboxConfig::AlignContent::SpaceAround: {
-      for (int i = ys.size() - 1; i >= 0; --i) {  // NOLINT
+      for (int i = lines - 1; i >= 0; --i) {  // NOLINT
         ys[i] += remaining_space * (2 * i + 1) / (2 * i + 2);
         remaining_space = remaining_space * (2 * i) / (2 * i + 2);
       }
@@ -188,7 +167,7 @@ void SetY(Global& g, std::vector<Line> lines) {
     }
 
     case FlexboxConfig::AlignContent::SpaceEvenly: {
-      for (int i = ys.size() - 1; i >= 0; --i) {  // NOLINT
+      for (int i = lines - 1; i >= 0; --i) {  // NOLINT
         ys[i] += remaining_space * (i + 1) / (i + 2);
         remaining_space = remaining_space * (i + 1) / (i + 2);
       }
@@ -197,36 +176,37 @@ void SetY(Global& g, std::vector<Line> lines) {
   }
 
   // [Align items]
-  for (size_t i = 0; i < lines.size(); ++i) {
-    auto& element = elements[i];
-    for (auto* block : lines[i].blocks) {
+  for (int line = 0; line < lines; ++line) {
+    const auto& element = w.elements[line];
+    for (int i = w.lines[line]; i < w.lines[line + 1]; ++i) {
+      Block& block = g.blocks[i];
       const bool stretch =
-          block->flex_grow_y != 0 ||
+          block.*cross.flex_grow != 0 ||
           g.config.align_content == FlexboxConfig::AlignContent::Stretch;
-      const int size =
-          stretch ? element.size : std::min(element.size, block->min_size_y);
+      const int size = stretch ? element.size
+                               : std::min(element.size, block.*cross.min_size);
       switch (g.config.align_items) {
         case FlexboxConfig::AlignItems::FlexStart: {
-          block->y = ys[i];
-          block->dim_y = size;
+          block.*cross.position = ys[line];
+          block.*cross.dim = size;
           break;
         }
 
         case FlexboxConfig::AlignItems::Center: {
-          block->y = ys[i] + (element.size - size) / 2;
-          block->dim_y = size;
+          block.*cross.position = ys[line] + (element.size - size) / 2;
+          block.*cross.dim = size;
           break;
         }
 
         case FlexboxConfig::AlignItems::FlexEnd: {
-          block->y = ys[i] + element.size - size;
-          block->dim_y = size;
+          block.*cross.position = ys[line] + element.size - size;
+          block.*cross.dim = size;
           break;
         }
 
         case FlexboxConfig::AlignItems::Stretch: {
-          block->y = ys[i];
-          block->dim_y = element.size;
+          block.*cross.position = ys[line];
+          block.*cross.dim = element.size;
           break;
         }
       }
@@ -234,48 +214,51 @@ void SetY(Global& g, std::vector<Line> lines) {
   }
 }
 
-void JustifyContent(Global& g, std::vector<Line> lines) {
-  for (auto& line : lines) {
-    Block* last = line.blocks.back();
-    int remaining_space = g.size_x - last->x - last->dim_x;
+void JustifyContent(Global& g, Workspace& w, const Axis& main) {
+  for (size_t line = 0; line + 1 < w.lines.size(); ++line) {
+    Block* blocks = g.blocks.data() + w.lines[line];
+    const int size = w.lines[line + 1] - w.lines[line];
+    const Block& last = blocks[size - 1];
+    int remaining_space = main.size - last.*main.position - last.*main.dim;
     switch (g.config.justify_content) {
       case FlexboxConfig::JustifyContent::FlexStart:
       case FlexboxConfig::JustifyContent::Stretch:
         break;
 
       case FlexboxConfig::JustifyContent::FlexEnd: {
-        for (auto* block : line.blocks) {
-          block->x += remaining_space;
+        for (int i = 0; i < size; ++i) {
+          blocks[i].*main.position += remaining_space;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::Center: {
-        for (auto* block : line.blocks) {
-          block->x += remaining_space / 2;
+        for (int i = 0; i < size; ++i) {
+          blocks[i].*main.position += remaining_space / 2;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceBetween: {
-        for (int i = (int)line.blocks.size() - 1; i >= 1; --i) {
-          line.blocks[i]->x += remaining_space;
+        for (int i = size - 1; i >= 1; --i) {
+          blocks[i].*main.position += remaining_space;
           remaining_space = remaining_space * (i - 1) / i;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceAround: {
-        for (int i = (int)line.blocks.size() - 1; i >= 0; --i) {
-          line.blocks[i]->x += remaining_space * (2 * i + 1) / (2 * i + 2);
+        for (int i = size - 1; i >= 0; --i) {
+          blocks[i].*main.position +=
+              remaining_space * (2 * i + 1) / (2 * i + 2);
           remaining_space = remaining_space * (2 * i) / (2 * i + 2);
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceEvenly: {
-        for (int i = (int)line.blocks.size() - 1; i >= 0; --i) {
-          line.blocks[i]->x += remaining_space * (i + 1) / (i + 2);
+        for (int i = size - 1; i >= 0; --i) {
+          blocks[i].*main.position += remaining_space * (i + 1) / (i + 2);
           remaining_space = remaining_space * (i + 1) / (i + 2);
         }
         break;
@@ -283,80 +266,49 @@ void JustifyContent(Global& g, std::vector<Line> lines) {
     }
   }
 }
-}  // namespace
 
-namespace {
+// The inversed directions are computed like the normal ones, and mirrored.
+void Mirror(Global& g, const Axis& axis) {
+  for (auto& block : g.blocks) {
+    block.*axis.position = axis.size - block.*axis.position - block.*axis.dim;
+  }
+}
 
-void Compute1(Global& global);
-void Compute2(Global& global);
-void Compute3(Global& global);
+}  // namespace
 
-void Compute1(Global& global) {
-  if (global.config.direction == FlexboxConfig::Direction::RowInversed) {
-    SymmetryX(global);
-    Compute2(global);
-    SymmetryX(global);
-    return;
-  }
-  Compute2(global);
+void Compute(Global& global) {
+  Workspace workspace;
+  Compute(global, workspace);
 }
 
-void Compute2(Global& global) {
-  if (global.config.wrap == FlexboxConfig::Wrap::WrapInversed) {
-    SymmetryY(global);
-    Compute3(global);
-    SymmetryY(global);
+void Compute(Global& global, Workspace& workspace) {
+  if (global.blocks.empty()) {
     return;
   }
-  Compute3(global);
-}
-
-void Compute3(Global& global) {
-  // Step 1: Lay out every elements into rows:
-  std::vector<Line> lines;
-  {
-    Line line;
-    int x = 0;
-    for (auto& block : global.blocks) {
-      // Does it fit the end of the row?
-      // No? Then we need to start a new one:
-      if (x + block.min_size_x > global.size_x) {
-        x = 0;
-        if (!line.blocks.empty()) {
-          lines.push_back(std::move(line));
-        }
-        line = Line();
-      }
 
-      block.line = (int)lines.size();
-      block.line_position = (int)line.blocks.size();
-      line.blocks.push_back(&block);
-      x += block.min_size_x + global.config.gap_x;
-    }
-    if (!line.blocks.empty()) {
-      lines.push_back(std::move(line));
-    }
-  }
+  const bool column =
+      global.config.direction == FlexboxConfig::Direction::Column ||
+      global.config.direction == FlexboxConfig::Direction::ColumnInversed;
+  const Axis main = column ? AxisY(global) : AxisX(global);
+  const Axis cross = column ? AxisX(global) : AxisY(global);
 
-  // Step 2: Set positions on the X axis.
-  SetX(global, lines);
-  JustifyContent(global, lines);  // Distribute remaining space.
+  // Step 1: Lay out every elements into lines.
+  SetLines(global, workspace, main);
 
-  // Step 3: Set positions on the Y axis.
-  SetY(global, lines);
-}
+  // Step 2: Set positions on the main axis.
+  SetX(global, workspace, main);
+  JustifyContent(global, workspace, main);  // Distribute remaining space.
 
-}  // namespace
+  // Step 3: Set positions on the cross axis.
+  SetY(global, workspace, cross);
 
-void Compute(Global& global) {
-  if (global.config.direction == FlexboxConfig::Direction::Column ||
+  if (global.config.direction == FlexboxConfig::Direction::RowInversed ||
       global.config.direction == FlexboxConfig::Direction::ColumnInversed) {
-    SymmetryXY(global);
-    Compute1(global);
-    SymmetryXY(global);
-    return;
+    Mirror(global, main);
+  }
+  if (global.config.wrap == FlexboxConfig::Wrap::WrapInversed) {
+    Mirror(global, cross);
   }
-  Compute1(global);
 }
 
 }  // namespace ftxui::flexbox_helper
@@ -2,6 +2,8 @@
 #define FTXUI_DOM_FLEXBOX_HELPER_HPP
 
 #include <vector>
+
+#include "ftxui/dom/box_helper.hpp"
 #include "ftxui/dom/flexbox_config.hpp"
 
 namespace ftxui {
@@ -33,7 +35,15 @@ struct Global {
   int size_y;
 };
 
+// The memory used by Compute(). Keep it across calls, to avoid allocating.
+struct Workspace {
+  std::vector<int> lines;  // The index of the first block of every line.
+  std::vector<box_helper::Element> elements;
+  std::vector<int> positions;
+};
+
 void Compute(Global& global);
+void Compute(Global& global, Workspace& workspace);
 
 }  // namespace flexbox_helper
 }  // namespace ftxui
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <ftxui/dom/flexbox_config.hpp>  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::Direction::Column, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::Direction::RowInversed
 #include <memory>                        // for allocator_traits<>::value_type
+#include <vector>                        // for vector
 
 #include "ftxui/dom/flexbox_helper.hpp"
 
@@ -226,6 +227,40 @@ TEST(FlexboxHelperTest, BasicColumnInversed) {
   EXPECT_EQ(g.blocks[4].dim_y, 5);
 }
 
+TEST(FlexboxHelperTest, ReuseWorkspace) {
+  flexbox_helper::Block block_10_5;
+  block_10_5.min_size_x = 10;
+  block_10_5.min_size_y = 5;
+
+  flexbox_helper::Workspace workspace;
+  for (auto direction : {
+           FlexboxConfig::Direction::Row,
+           FlexboxConfig::Direction::RowInversed,
+           FlexboxConfig::Direction::Column,
+           FlexboxConfig::Direction::ColumnInversed,
+       }) {
+    for (size_t count : {5u, 2u, 7u}) {
+      flexbox_helper::Global g;
+      g.blocks = std::vector<flexbox_helper::Block>(count, block_10_5);
+      g.size_x = 32;
+      g.size_y = 16;
+      g.config = FlexboxConfig().Set(direction);
+      flexbox_helper::Global expected = g;
+
+      flexbox_helper::Compute(g, workspace);
+      flexbox_helper::Compute(expected);
+
+      for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(g.blocks[i].line, expected.blocks[i].line);
+        EXPECT_EQ(g.blocks[i].x, expected.blocks[i].x);
+        EXPECT_EQ(g.blocks[i].y, expected.blocks[i].y);
+        EXPECT_EQ(g.blocks[i].dim_x, expected.blocks[i].dim_x);
+        EXPECT_EQ(g.blocks[i].dim_y, expected.blocks[i].dim_y);
+      }
+    }
+  }
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -453,6 +453,28 @@ TEST(FlexboxTest, Focus) {
             "-");
 }
 
+TEST(FlexboxTest, RenderAgain) {
+  auto make = [] {
+    return hflow({
+        text("aaa"),
+        text("bbb"),
+        text("ccc"),
+        text("ddd"),
+    });
+  };
+  auto draw = [](const Element& element, int width) {
+    Screen screen(width, 2);
+    Render(screen, element);
+    return screen.ToString();
+  };
+
+  // The layouts kept from the previous frames must match the new size.
+  auto document = make();
+  for (int width : {12, 6, 6, 9, 12}) {
+    EXPECT_EQ(draw(document, width), draw(make(), width));
+  }
+}
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
@@ -1,14 +1,16 @@
 #include <algorithm>  // for max, min
+#include <cstddef>    // for size_t
 #include <memory>     // for make_shared, __shared_ptr_access
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, Elements, focus, frame, select, xframe, yframe
+#include "ftxui/dom/elements.hpp"  // for Element, unpack, Elements, focus, frame, select, xframe, yframe, scrollable
 #include "ftxui/dom/node.hpp"  // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::FOCUSED, Requirement::SELECTED
 #include "ftxui/screen/box.hpp"      // for Box
 #include "ftxui/screen/screen.hpp"   // for Screen, Screen::Cursor
 #include "ftxui/util/autoreset.hpp"  // for AutoReset
+#include "ftxui/util/ref.hpp"        // for Ref
 
 namespace ftxui {
 
@@ -31,12 +33,12 @@ class Select : public Node {
 
   void SetBox(Box box) override {
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    SetChildBox(0, box);
   }
 };
 
 Element select(Element child) {
-  return std::make_shared<Select>(unpack(std::move(child)));
+  return MakeNode<Select>(unpack(std::move(child)));
 }
 
 // -----------------------------------------------------------------------------
@@ -81,7 +83,7 @@ class Focus : public Select {
 };
 
 Element focus(Element child) {
-  return std::make_shared<Focus>(unpack(std::move(child)));
+  return MakeNode<Focus>(unpack(std::move(child)));
 }
 
 // -----------------------------------------------------------------------------
@@ -121,13 +123,13 @@ class Frame : public Node {
       children_box.y_max = box.y_min + internal_dimy - dy;
     }
 
-    children_[0]->SetBox(children_box);
+    SetChildBox(0, children_box);
   }
 
   void Render(Screen& screen) override {
     const AutoReset<Box> stencil(&screen.stencil,
                                  Box::Intersection(box_, screen.stencil));
-    children_[0]->Render(screen);
+    RenderChild(screen, size_t(0));
   }
 
  private:
@@ -140,15 +142,88 @@ class Frame : public Node {
 /// displayed. The view is scrollable to make the focused element visible.
 /// @see focus
 Element frame(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, true);
+  return MakeNode<Frame>(unpack(std::move(child)), true, true);
 }
 
 Element xframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, false);
+  return MakeNode<Frame>(unpack(std::move(child)), true, false);
 }
 
 Element yframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), false, true);
+  return MakeNode<Frame>(unpack(std::move(child)), false, true);
+}
+
+// -----------------------------------------------------------------------------
+
+// A vertical frame, scrolled to an offset given by the application instead of
+// centered on the focused element. The children are drawn within the
+// viewport's stencil, so the virtual ones, like virtualList, only build the
+// visible rows.
+class Scrollable : public Node {
+ public:
+  Scrollable(Elements children, Ref<int> offset, int extent)
+      : Node(std::move(children)), offset_(offset), extent_(extent) {}
+
+  void ComputeRequirement() override {
+    Node::ComputeRequirement();
+    requirement_ = children_[0]->requirement();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    const int viewport = box.y_max - box.y_min + 1;
+    const int content =
+        std::max(extent_ >= 0 ? extent_ : requirement_.min_y, viewport);
+
+    // Scroll as little as possible to show the focused element. The selected
+    // ones, like the default row of virtualList, don't move the view.
+    int& offset = *offset_;
+    if (requirement_.selection == Requirement::FOCUSED) {
+      const Box& selected_box = requirement_.selected_box;
+      offset = std::min(offset, selected_box.y_min);
+      offset = std::max(offset, selected_box.y_max - viewport + 1);
+    }
+    offset = std::max(0, std::min(content - viewport, offset));
+
+    Box children_box = box;
+    children_box.y_min = box.y_min - offset;
+    children_box.y_max = children_box.y_min + content - 1;
+    SetChildBox(0, children_box);
+  }
+
+  void Render(Screen& screen) override {
+    const AutoReset<Box> stencil(&screen.stencil,
+                                 Box::Intersection(box_, screen.stencil));
+    RenderChild(screen, size_t(0));
+  }
+
+ private:
+  Ref<int> offset_;
+  const int extent_;
+};
+
+/// @brief A vertical frame, scrolled to |offset| rows from the top. Unlike
+/// yframe, the application controls the scroll position, e.g. from the mouse
+/// wheel. Only the visible part of the element is drawn: the virtual elements,
+/// like virtualList, only build the rows inside the viewport.
+/// @param offset The first visible row. It is clamped to the content, and
+///               updated to keep the focused element visible, scrolling as
+///               little as possible.
+/// @param extent The height of the content, or -1 to use the one required by
+///               the element.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// int offset = 50'000;
+/// Element document = virtualList(100'000, 1, row) |
+///                    scrollable(&offset) | size(HEIGHT, EQUAL, 20);
+/// ```
+Decorator scrollable(Ref<int> offset, int extent) {
+  return [offset, extent](Element child) {
+    return MakeNode<Scrollable>(unpack(std::move(child)), offset, extent);
+  };
 }
 
 class FocusCursor : public Focus {
@@ -156,7 +231,6 @@ class FocusCursor : public Focus {
   FocusCursor(Elements children, Screen::Cursor::Shape shape)
       : Focus(std::move(children)), shape_(shape) {}
 
- private:
   void Render(Screen& screen) override {
     Select::Render(screen);  // NOLINT
     screen.SetCursor(Screen::Cursor{
@@ -165,31 +239,33 @@ class FocusCursor : public Focus {
         shape_,
     });
   }
+
+ private:
   Screen::Cursor::Shape shape_;
 };
 
 Element focusCursorBlock(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::Block);
 }
 Element focusCursorBlockBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::BlockBlinking);
 }
 Element focusCursorBar(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::Bar);
 }
 Element focusCursorBarBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::BarBlinking);
 }
 Element focusCursorUnderline(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::Underline);
 }
 Element focusCursorUnderlineBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
+  return MakeNode<FocusCursor>(unpack(std::move(child)),
                                        Screen::Cursor::UnderlineBlinking);
 }
 
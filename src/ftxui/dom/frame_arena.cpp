@@ -0,0 +1,127 @@
+#include "ftxui/dom/frame_arena.hpp"
+
+#include <algorithm>  // for max
+#include <atomic>     // for atomic
+#include <cstring>    // for memcpy
+#include <memory_resource>  // for memory_resource, get_default_resource
+#include <new>        // for placement new
+
+namespace ftxui {
+
+namespace {
+constexpr size_t kAlignment = alignof(std::max_align_t);
+constexpr size_t kBlockSize = 64 * 1024;  // NOLINT
+
+size_t RoundUp(size_t size) {
+  return (size + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+thread_local FrameArena* g_current = nullptr;  // NOLINT
+}  // namespace
+
+// The blocks of memory allocations are taken from. Every allocation is
+// preceded by a pointer to its block.
+struct FrameArena::Block {
+  // One reference per live allocation, plus one held by the arena while this
+  // is its current block. Allocations might be released from another thread.
+  std::atomic<size_t> references = 1;
+  size_t used = 0;
+  size_t capacity = 0;
+  std::pmr::memory_resource* upstream = nullptr;
+
+  static Block* New(size_t capacity, std::pmr::memory_resource* upstream) {
+    void* memory =
+        upstream->allocate(RoundUp(sizeof(Block)) + capacity, kAlignment);
+    auto* block = new (memory) Block();
+    block->capacity = capacity;
+    block->upstream = upstream;
+    return block;
+  }
+
+  static void Release(Block* block) {
+    if (block->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::pmr::memory_resource* upstream = block->upstream;
+      const size_t size = RoundUp(sizeof(Block)) + block->capacity;
+      block->~Block();
+      upstream->deallocate(block, size, kAlignment);
+    }
+  }
+
+  char* data() {
+    return reinterpret_cast<char*>(this) + RoundUp(sizeof(Block));  // NOLINT
+  }
+};
+
+FrameArena::FrameArena() : FrameArena(std::pmr::get_default_resource()) {}
+
+/// @brief An arena taking its blocks from |upstream|. The blocks might be
+/// released from the threads destroying the Elements.
+FrameArena::FrameArena(std::pmr::memory_resource* upstream)
+    : upstream_(upstream) {}
+
+FrameArena::~FrameArena() {
+  if (block_ != nullptr) {
+    Block::Release(block_);
+  }
+}
+
+FrameArena::Scope::Scope(FrameArena* arena) : previous_(g_current) {
+  g_current = arena;
+}
+
+FrameArena::Scope::~Scope() {
+  g_current = previous_;
+}
+
+/// @brief Reuse the memory of the previous frame. This is only possible once
+/// its Elements are all destroyed. Otherwise, the arena continues allocating
+/// after them.
+void FrameArena::Reset() {
+  if (block_ != nullptr &&
+      block_->references.load(std::memory_order_acquire) == 1) {
+    block_->used = 0;
+  }
+}
+
+/// @brief The bytes of the block allocated from.
+size_t FrameArena::MemoryUsage() const {
+  return block_ != nullptr ? RoundUp(sizeof(Block)) + block_->capacity : 0;
+}
+
+/// @brief The arena active on the current thread, or nullptr.
+// static
+FrameArena* FrameArena::Current() {
+  return g_current;
+}
+
+/// @brief Allocate |size| bytes, aligned for any type.
+void* FrameArena::Allocate(size_t size) {
+  const size_t total = kAlignment + RoundUp(size);
+  if (block_ == nullptr || block_->used + total > block_->capacity) {
+    if (block_ != nullptr) {
+      Block::Release(block_);
+    }
+    block_ = Block::New(std::max(kBlockSize, total), upstream_);
+  }
+
+  char* header = block_->data() + block_->used;  // NOLINT
+  block_->used += total;
+  block_->references.fetch_add(1, std::memory_order_relaxed);
+  std::memcpy(header, &block_, sizeof(Block*));
+  return header + kAlignment;  // NOLINT
+}
+
+/// @brief Release memory returned by Allocate().
+// static
+void FrameArena::Deallocate(void* pointer) {
+  Block* block = nullptr;
+  std::memcpy(&block, static_cast<char*>(pointer) - kAlignment,  // NOLINT
+              sizeof(Block*));
+  Block::Release(block);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <cstddef>          // for size_t
+#include <memory_resource>  // for memory_resource, new_delete_resource
+#include <string>           // for allocator, string
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"     // for text, vbox, border, Element
+#include "ftxui/dom/frame_arena.hpp"  // for FrameArena
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+Element Document() {
+  return vbox({
+             text("hello"),
+             text("world"),
+         }) |
+         border;
+}
+
+// Count the memory allocated from it.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocated = 0;
+  size_t deallocated = 0;
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    allocated += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    deallocated += bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+std::string Draw(const Element& element) {
+  Screen screen(7, 4);
+  Render(screen, element);
+  return screen.ToString();
+}
+}  // namespace
+
+TEST(FrameArenaTest, Current) {
+  EXPECT_EQ(FrameArena::Current(), nullptr);
+  FrameArena arena;
+  {
+    const FrameArena::Scope scope(&arena);
+    EXPECT_EQ(FrameArena::Current(), &arena);
+    {
+      FrameArena nested;
+      const FrameArena::Scope nested_scope(&nested);
+      EXPECT_EQ(FrameArena::Current(), &nested);
+    }
+    EXPECT_EQ(FrameArena::Current(), &arena);
+  }
+  EXPECT_EQ(FrameArena::Current(), nullptr);
+}
+
+TEST(FrameArenaTest, Render) {
+  const std::string expected = Draw(Document());
+  FrameArena arena;
+  for (int i = 0; i < 3; ++i) {
+    arena.Reset();
+    Element document;
+    {
+      const FrameArena::Scope scope(&arena);
+      document = Document();
+    }
+    EXPECT_EQ(Draw(document), expected);
+  }
+}
+
+TEST(FrameArenaTest, ElementOutlivesReset) {
+  const std::string expected = Draw(Document());
+  FrameArena arena;
+  Element kept;
+  {
+    const FrameArena::Scope scope(&arena);
+    kept = Document();
+  }
+
+  // Allocate enough to use several blocks, while |kept| is alive.
+  for (int i = 0; i < 100; ++i) {
+    arena.Reset();
+    const FrameArena::Scope scope(&arena);
+    std::vector<Element> elements;
+    for (int j = 0; j < 100; ++j) {
+      elements.push_back(Document());
+    }
+    EXPECT_EQ(Draw(elements.back()), expected);
+  }
+  EXPECT_EQ(Draw(kept), expected);
+}
+
+TEST(FrameArenaTest, ElementOutlivesArena) {
+  const std::string expected = Draw(Document());
+  Element kept;
+  {
+    FrameArena arena;
+    const FrameArena::Scope scope(&arena);
+    kept = Document();
+  }
+  EXPECT_EQ(Draw(kept), expected);
+}
+
+TEST(FrameArenaTest, MemoryResource) {
+  const std::string expected = Draw(Document());
+  CountingResource resource;
+  {
+    FrameArena arena(&resource);
+    const FrameArena::Scope scope(&arena);
+    Screen screen(7, 4, &resource);
+    const size_t screen_allocated = resource.allocated;
+    EXPECT_GT(screen_allocated, 0u);
+
+    Render(screen, Document());
+    EXPECT_GT(resource.allocated, screen_allocated);
+    EXPECT_EQ(screen.ToString(), expected);
+
+    // The screens swapping their pixels keep drawing the same.
+    Screen other(7, 4);
+    other.SwapPixels(screen);
+    EXPECT_EQ(other.ToString(), expected);
+
+    const Canvas canvas(10, 10, &resource);
+    EXPECT_EQ(canvas.width(), 10);
+  }
+  EXPECT_EQ(resource.allocated, resource.deallocated);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator, string, to_string
+
+#include "ftxui/dom/elements.hpp"  // for scrollable, virtualList, text, vbox, focus, size
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+Element Rows(int count, int focused = -1) {
+  Elements rows;
+  for (int i = 0; i < count; ++i) {
+    Element row = text(std::to_string(i));
+    rows.push_back(i == focused ? focus(row) : row);
+  }
+  return vbox(std::move(rows));
+}
+
+std::string Draw(Element element, int height) {
+  Screen screen(6, height);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(FrameTest, Scrollable) {
+  int offset = 3;
+  EXPECT_EQ(Draw(Rows(10) | scrollable(&offset), 2), "3     \r\n4     ");
+
+  // Clamped to the content.
+  offset = 20;
+  EXPECT_EQ(Draw(Rows(10) | scrollable(&offset), 2), "8     \r\n9     ");
+  EXPECT_EQ(offset, 8);
+  offset = -5;
+  EXPECT_EQ(Draw(Rows(10) | scrollable(&offset), 2), "0     \r\n1     ");
+  EXPECT_EQ(offset, 0);
+}
+
+TEST(FrameTest, ScrollableFocus) {
+  // The focused row is made visible, scrolling as little as possible.
+  int offset = 0;
+  EXPECT_EQ(Draw(Rows(10, 5) | scrollable(&offset), 3),
+            "3     \r\n4     \r\n5     ");
+  EXPECT_EQ(offset, 3);
+  EXPECT_EQ(Draw(Rows(10, 4) | scrollable(&offset), 3),
+            "3     \r\n4     \r\n5     ");
+  EXPECT_EQ(Draw(Rows(10, 1) | scrollable(&offset), 3),
+            "1     \r\n2     \r\n3     ");
+  EXPECT_EQ(offset, 1);
+}
+
+TEST(FrameTest, ScrollableVirtual) {
+  int built = 0;
+  auto row = [&](int i) {
+    built++;
+    return text(std::to_string(i));
+  };
+  int offset = 50'000;
+  EXPECT_EQ(Draw(virtualList(100'000, 1, row) | scrollable(&offset), 2),
+            "50000 \r\n50001 ");
+  EXPECT_LE(built, 3);
+
+  // The extent can be larger than the content.
+  offset = 100;
+  EXPECT_EQ(Draw(Rows(3) | scrollable(&offset, 50), 2), "      \r\n      ");
+  EXPECT_EQ(offset, 48);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,41 +1,48 @@
 #include <memory>  // for allocator, make_shared
-#include <string>  // for string
 
 #include "ftxui/dom/elements.hpp"  // for GaugeDirection, Element, GaugeDirection::Down, GaugeDirection::Left, GaugeDirection::Right, GaugeDirection::Up, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
 #include "ftxui/dom/node.hpp"      // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+#include "ftxui/screen/glyph.hpp"     // for Glyph
+#include "ftxui/screen/screen.hpp"    // for Screen, Screen::SpanStyle
 
 namespace ftxui {
 
+// Built at compile time. Drawing a gauge only copies them.
 // NOLINTNEXTLINE
-static const std::string charset_horizontal[11] = {
+constexpr Glyph charset_horizontal[11] = {
 #if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
     // Microsoft's terminals often use fonts not handling the 8 unicode
     // characters for representing the whole gauge. Fallback with less.
-    " ", " ", " ", " ", "▌", "▌", "▌", "█", "█", "█",
+    Glyph::Narrow(" "), Glyph::Narrow(" "), Glyph::Narrow(" "),
+    Glyph::Narrow(" "), Glyph::Narrow("▌"), Glyph::Narrow("▌"),
+    Glyph::Narrow("▌"), Glyph::Narrow("█"), Glyph::Narrow("█"),
+    Glyph::Narrow("█"),
 #else
-    " ", " ", "▏", "▎", "▍", "▌", "▋", "▊", "▉", "█",
+    Glyph::Narrow(" "), Glyph::Narrow(" "), Glyph::Narrow("▏"),
+    Glyph::Narrow("▎"), Glyph::Narrow("▍"), Glyph::Narrow("▌"),
+    Glyph::Narrow("▋"), Glyph::Narrow("▊"), Glyph::Narrow("▉"),
+    Glyph::Narrow("█"),
 #endif
     // An extra character in case when the fuzzer manage to have:
     // int(9 * (limit - limit_int) = 9
-    "█"};
+    Glyph::Narrow("█")};
 
 // NOLINTNEXTLINE
-static const std::string charset_vertical[10] = {
-    "█",
-    "▇",
-    "▆",
-    "▅",
-    "▄",
-    "▃",
-    "▂",
-    "▁",
-    " ",
+constexpr Glyph charset_vertical[10] = {
+    Glyph::Narrow("█"),
+    Glyph::Narrow("▇"),
+    Glyph::Narrow("▆"),
+    Glyph::Narrow("▅"),
+    Glyph::Narrow("▄"),
+    Glyph::Narrow("▃"),
+    Glyph::Narrow("▂"),
+    Glyph::Narrow("▁"),
+    Glyph::Narrow(" "),
     // An extra character in case when the fuzzer manage to have:
     // int(8 * (limit - limit_int) = 8
-    " ",
+    Glyph::Narrow(" "),
 };
 
 class Gauge : public Node {
@@ -113,9 +120,7 @@ class Gauge : public Node {
     }
 
     if (invert) {
-      for (int x = box_.x_min; x <= box_.x_max; x++) {
-        screen.PixelAt(x, y).inverted ^= true;
-      }
+      screen.ApplyStyleRect({box_.x_min, box_.x_max, y, y}, Inverted());
     }
   }
 
@@ -143,13 +148,17 @@ class Gauge : public Node {
     }
 
     if (invert) {
-      for (int y = box_.y_min; y <= box_.y_max; y++) {
-        screen.PixelAt(x, y).inverted ^= true;
-      }
+      screen.ApplyStyleRect({x, x, box_.y_min, box_.y_max}, Inverted());
     }
   }
 
  private:
+  static Screen::SpanStyle Inverted() {
+    Screen::SpanStyle style;
+    style.inverted = true;
+    return style;
+  }
+
   float progress_;
   GaugeDirection direction_;
 };
@@ -160,7 +169,7 @@ class Gauge : public Node {
 //  @param direction Direction of progress bars progression.
 /// @ingroup dom
 Element gaugeDirection(float progress, GaugeDirection direction) {
-  return std::make_shared<Gauge>(progress, direction);
+  return MakeNode<Gauge>(progress, direction);
 }
 
 /// @brief Draw a high definition progress bar progressing from left to right.
@@ -0,0 +1,230 @@
+#include <algorithm>  // for max, min
+#include <cmath>      // for cos, sin, sqrt, lround
+#include <memory>     // for make_shared
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"  // for Element, Decorator, linearGradient, radialGradient
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/color.hpp"        // for Color
+#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+
+namespace ftxui {
+
+namespace {
+
+// The terminal cells are about twice as high as they are wide.
+constexpr float kCellAspectRatio = 2.F;
+
+// Apply a gradient to the box of a child. The stops are computed once per
+// render, using Color::Gradient(), then every cell only indexes them.
+class Gradient : public NodeDecorator {
+ public:
+  Gradient(Element child, Color from, Color to, bool background)
+      : NodeDecorator(std::move(child)),
+        from_(from),
+        to_(to),
+        background_(background) {}
+
+  void Render(Screen& screen) override {
+    if (box_.x_min <= box_.x_max && box_.y_min <= box_.y_max) {
+      // The position of each cell along the gradient, in [0, 1].
+      const float length = Prepare();
+      stops_.resize(std::max(2, int(std::ceil(length)) + 1));
+      Color::Gradient(from_, to_, stops_);
+      const float scale = float(stops_.size() - 1);
+
+      for (int y = box_.y_min; y <= box_.y_max; ++y) {
+        for (int x = box_.x_min; x <= box_.x_max; ++x) {
+          const float t = Position(x - box_.x_min, y - box_.y_min);
+          const auto index = size_t(std::lround(
+              std::min(std::max(t, 0.F), 1.F) * scale));  // NOLINT
+          Pixel& pixel = screen.PixelAt(x, y);
+          (background_ ? pixel.background_color : pixel.foreground_color) =
+              stops_[index];
+        }
+      }
+    }
+    NodeDecorator::Render(screen);
+  }
+
+ protected:
+  // Compute the geometry of the gradient for the current box. Returns its
+  // length across the box, in cells. This defines the number of stops.
+  virtual float Prepare() = 0;
+
+  // The position of the cell (x, y), relative to the box, along the gradient.
+  virtual float Position(int x, int y) const = 0;
+
+ private:
+  Color from_;
+  Color to_;
+  bool background_;
+  std::vector<Color> stops_;
+};
+
+class LinearGradient : public Gradient {
+ public:
+  LinearGradient(Element child,
+                 float angle,
+                 Color from,
+                 Color to,
+                 bool background)
+      : Gradient(std::move(child), from, to, background),
+        dx_(std::cos(angle * kPi / 180.F)),                     // NOLINT
+        dy_(std::sin(angle * kPi / 180.F) * kCellAspectRatio) {}  // NOLINT
+
+ private:
+  static constexpr float kPi = 3.14159265358979F;
+
+  // The projection of (x, y) on the direction of the gradient. The box spans
+  // [|min_|, |max_|].
+  float Project(int x, int y) const { return float(x) * dx_ + float(y) * dy_; }
+
+  float Prepare() override {
+    const int width = box_.x_max - box_.x_min;
+    const int height = box_.y_max - box_.y_min;
+    const float corners[4] = {
+        Project(0, 0),
+        Project(width, 0),
+        Project(0, height),
+        Project(width, height),
+    };
+    min_ = *std::min_element(std::begin(corners), std::end(corners));
+    max_ = *std::max_element(std::begin(corners), std::end(corners));
+    return max_ - min_;
+  }
+
+  float Position(int x, int y) const override {
+    return max_ == min_ ? 0.F : (Project(x, y) - min_) / (max_ - min_);
+  }
+
+  float dx_;
+  float dy_;
+  float min_ = 0.F;
+  float max_ = 0.F;
+};
+
+class RadialGradient : public Gradient {
+ public:
+  using Gradient::Gradient;
+
+ private:
+  // The distance from the center of the box, correcting the aspect ratio of
+  // the cells.
+  float Distance(int x, int y) const {
+    const float dx = float(x) - float(box_.x_max - box_.x_min) / 2.F;
+    const float dy =
+        (float(y) - float(box_.y_max - box_.y_min) / 2.F) * kCellAspectRatio;
+    return std::sqrt(dx * dx + dy * dy);
+  }
+
+  float Prepare() override {
+    radius_ = Distance(0, 0);
+    return radius_;
+  }
+
+  float Position(int x, int y) const override {
+    return radius_ == 0.F ? 0.F : Distance(x, y) / radius_;
+  }
+
+  float radius_ = 0.F;
+};
+
+}  // namespace
+
+/// @brief Color the foreground of an element using a linear gradient.
+/// @param angle The direction of the gradient, in degrees. 0 goes from left
+///        to right, 90 from top to bottom.
+/// @param from The color at the beginning of the gradient.
+/// @param to The color at its end.
+/// @param child The input element.
+/// @return The output element colored.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = linearGradient(0, Color::Red, Color::Blue, text("Hi"));
+/// ```
+Element linearGradient(float angle, Color from, Color to, Element child) {
+  return MakeNode<LinearGradient>(std::move(child), angle, from, to,
+                                          /*background=*/false);
+}
+
+/// @brief Color the background of an element using a linear gradient.
+/// @see linearGradient
+/// @ingroup dom
+Element bgLinearGradient(float angle, Color from, Color to, Element child) {
+  return MakeNode<LinearGradient>(std::move(child), angle, from, to,
+                                          /*background=*/true);
+}
+
+/// @brief Color the foreground of an element using a radial gradient, going
+/// from its center to its corners.
+/// @param center The color at the center.
+/// @param edge The color at the corners.
+/// @param child The input element.
+/// @return The output element colored.
+/// @ingroup dom
+Element radialGradient(Color center, Color edge, Element child) {
+  return MakeNode<RadialGradient>(std::move(child), center, edge,
+                                          /*background=*/false);
+}
+
+/// @brief Color the background of an element using a radial gradient.
+/// @see radialGradient
+/// @ingroup dom
+Element bgRadialGradient(Color center, Color edge, Element child) {
+  return MakeNode<RadialGradient>(std::move(child), center, edge,
+                                          /*background=*/true);
+}
+
+/// @brief Decorate using a foreground linear gradient.
+/// @see linearGradient
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = text("Hello") | linearGradient(0, Color::Red, Color::Blue);
+/// ```
+Decorator linearGradient(float angle, Color from, Color to) {
+  return [=](Element child) {
+    return linearGradient(angle, from, to, std::move(child));
+  };
+}
+
+/// @brief Decorate using a background linear gradient.
+/// @see linearGradient
+/// @ingroup dom
+Decorator bgLinearGradient(float angle, Color from, Color to) {
+  return [=](Element child) {
+    return bgLinearGradient(angle, from, to, std::move(child));
+  };
+}
+
+/// @brief Decorate using a foreground radial gradient.
+/// @see radialGradient
+/// @ingroup dom
+Decorator radialGradient(Color center, Color edge) {
+  return [=](Element child) {
+    return radialGradient(center, edge, std::move(child));
+  };
+}
+
+/// @brief Decorate using a background radial gradient.
+/// @see radialGradient
+/// @ingroup dom
+Decorator bgRadialGradient(Color center, Color edge) {
+  return [=](Element child) {
+    return bgRadialGradient(center, edge, std::move(child));
+  };
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
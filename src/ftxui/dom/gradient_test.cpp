@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <array>  // for array
+
+#include "ftxui/dom/elements.hpp"  // for linearGradient, radialGradient, text
+#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+#include "ftxui/screen/terminal.hpp"  // for SetColorSupport
+
+namespace ftxui {
+
+TEST(GradientTest, Stops) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  std::array<Color, 3> stops;
+  Color::Gradient(Color::RGB(0, 0, 0), Color::RGB(200, 100, 0), stops);
+  EXPECT_EQ(stops[0], Color::RGB(0, 0, 0));
+  // In linear light, the middle is brighter than the average.
+  EXPECT_EQ(stops[1], Color::RGB(141, 71, 0));
+  EXPECT_EQ(stops[2], Color::RGB(200, 100, 0));
+}
+
+TEST(GradientTest, StopsKeepEnds) {
+  std::array<Color, 4> stops;
+  Color::Gradient(Color::Red, Color::Blue, stops);
+  EXPECT_EQ(stops[0], Color::Red);
+  EXPECT_EQ(stops[3], Color::Blue);
+
+  // The transparent color can't be interpolated.
+  Color::Gradient(Color::Red, Color(), stops);
+  EXPECT_EQ(stops[1], Color::Red);
+  EXPECT_EQ(stops[2], Color());
+}
+
+TEST(GradientTest, Linear) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  auto element = text("abcde") |
+                 linearGradient(0, Color::RGB(0, 0, 0), Color::RGB(0, 0, 200));
+  Screen screen(5, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::RGB(0, 0, 0));
+  EXPECT_EQ(screen.PixelAt(2, 0).foreground_color, Color::RGB(0, 0, 141));
+  EXPECT_EQ(screen.PixelAt(4, 0).foreground_color, Color::RGB(0, 0, 200));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Color());
+}
+
+TEST(GradientTest, LinearVertical) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  auto element = vbox({text("a"), text("b"), text("c")}) |
+                 bgLinearGradient(90, Color::Red, Color::Blue);
+  Screen screen(2, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Color::Red);
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color, Color::Red);
+  EXPECT_EQ(screen.PixelAt(0, 2).background_color, Color::Blue);
+}
+
+TEST(GradientTest, Radial) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  auto element = text("abcde") | radialGradient(Color::Red, Color::Blue);
+  Screen screen(5, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(2, 0).foreground_color, Color::Red);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::Blue);
+  EXPECT_EQ(screen.PixelAt(4, 0).foreground_color, Color::Blue);
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color,
+            screen.PixelAt(3, 0).foreground_color);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,32 +1,44 @@
 #include <functional>  // for function
 #include <memory>      // for allocator, make_shared
+#include <span>        // for span
 #include <string>      // for string
 #include <utility>     // for move
 #include <vector>      // for vector
 
-#include "ftxui/dom/elements.hpp"     // for GraphFunction, Element, graph
+#include "ftxui/dom/elements.hpp"  // for GraphFunction, GraphBufferFunction, Element, graph
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/screen.hpp"    // for Screen
 
 namespace ftxui {
 
 // NOLINTNEXTLINE
-static std::string charset[] =
+constexpr Glyph charset[9] = {
 #if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
     // Microsoft's terminals often use fonts not handling the 8 unicode
     // characters for representing the whole graph. Fallback with less.
-    {" ", " ", "█", " ", "█", "█", "█", "█", "█"};
+    Glyph::Narrow(" "), Glyph::Narrow(" "), Glyph::Narrow("█"),
+    Glyph::Narrow(" "), Glyph::Narrow("█"), Glyph::Narrow("█"),
+    Glyph::Narrow("█"), Glyph::Narrow("█"), Glyph::Narrow("█"),
 #else
-    {" ", "▗", "▐", "▖", "▄", "▟", "▌", "▙", "█"};
+    Glyph::Narrow(" "), Glyph::Narrow("▗"), Glyph::Narrow("▐"),
+    Glyph::Narrow("▖"), Glyph::Narrow("▄"), Glyph::Narrow("▟"),
+    Glyph::Narrow("▌"), Glyph::Narrow("▙"), Glyph::Narrow("█"),
 #endif
+};
 
-class Graph : public Node {
- public:
-  explicit Graph(GraphFunction graph_function)
-      : graph_function_(std::move(graph_function)) {}
+namespace {
 
+// The heights of the graphs, reused by every graph drawn on the thread.
+std::vector<int>& Buffer() {
+  thread_local std::vector<int> buffer;
+  return buffer;
+}
+
+class GraphBase : public Node {
+ public:
   void ComputeRequirement() override {
     requirement_.flex_grow_x = 1;
     requirement_.flex_grow_y = 1;
@@ -36,10 +48,9 @@ class Graph : public Node {
     requirement_.min_y = 3;
   }
 
-  void Render(Screen& screen) override {
-    const int width = (box_.x_max - box_.x_min + 1) * 2;
-    const int height = (box_.y_max - box_.y_min + 1) * 2;
-    auto data = graph_function_(width, height);
+ protected:
+  // Draw the |data|, two heights per column.
+  void Draw(Screen& screen, const int* data) const {
     int i = 0;
     for (int x = box_.x_min; x <= box_.x_max; ++x) {
       const int height_1 = 2 * box_.y_max - data[i++];
@@ -53,14 +64,65 @@ class Graph : public Node {
     }
   }
 
+  int width() const { return (box_.x_max - box_.x_min + 1) * 2; }
+  int height() const { return (box_.y_max - box_.y_min + 1) * 2; }
+};
+
+class Graph : public GraphBase {
+ public:
+  explicit Graph(GraphFunction graph_function)
+      : graph_function_(std::move(graph_function)) {}
+
+  void Render(Screen& screen) override {
+    auto data = graph_function_(width(), height());
+    Draw(screen, data.data());
+  }
+
  private:
   GraphFunction graph_function_;
 };
 
+class GraphBuffer : public GraphBase {
+ public:
+  explicit GraphBuffer(GraphBufferFunction graph_function)
+      : graph_function_(std::move(graph_function)) {}
+
+  void Render(Screen& screen) override {
+    std::vector<int>& buffer = Buffer();
+    buffer.assign(width(), 0);
+    graph_function_(std::span<int>(buffer), height());
+    Draw(screen, buffer.data());
+  }
+
+ private:
+  GraphBufferFunction graph_function_;
+};
+
+}  // namespace
+
 /// @brief Draw a graph using a GraphFunction.
 /// @param graph_function the function to be called to get the data.
 Element graph(GraphFunction graph_function) {
-  return std::make_shared<Graph>(std::move(graph_function));
+  return MakeNode<Graph>(std::move(graph_function));
+}
+
+/// @brief Draw a graph, whose data is written by |graph_function| into a
+/// buffer reused across the graphs and the frames, instead of a new vector.
+/// @param graph_function Called with one height per half column, to be
+///                       written, and the height of the graph.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto sine = [&](std::span<int> heights, int height) {
+///   for (size_t x = 0; x < heights.size(); ++x) {
+///     heights[x] = int((0.5 + 0.5 * std::sin(x * 0.1 + t)) * (height - 1));
+///   }
+/// };
+/// Element document = graph(sine) | border;
+/// ```
+Element graph(GraphBufferFunction graph_function) {
+  return MakeNode<GraphBuffer>(std::move(graph_function));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <algorithm>  // for copy
+#include <span>       // for span
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"   // for graph, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+TEST(GraphTest, Buffer) {
+  auto heights = [](int width) {
+    std::vector<int> out(width);
+    for (int x = 0; x < width; ++x) {
+      out[x] = x % 6;
+    }
+    return out;
+  };
+
+  Screen expected(5, 3);
+  Render(expected, graph([&](int width, int /*height*/) {
+           return heights(width);
+         }));
+
+  const int* buffer = nullptr;
+  for (int frame = 0; frame < 2; ++frame) {
+    Screen screen(5, 3);
+    Render(screen, graph([&](std::span<int> out, int height) {
+             EXPECT_EQ(out.size(), 10u);
+             EXPECT_EQ(height, 6);
+             const std::vector<int> values = heights(int(out.size()));
+             std::copy(values.begin(), values.end(), out.begin());
+             if (buffer) {
+               EXPECT_EQ(out.data(), buffer);  // Reused.
+             }
+             buffer = out.data();
+           }));
+    EXPECT_EQ(screen.ToString(), expected.ToString());
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
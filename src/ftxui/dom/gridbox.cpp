@@ -4,35 +4,20 @@
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/dom/box_helper.hpp"   // for Element, Compute
+#include "ftxui/dom/box_helper.hpp"   // for Element, Compute, Scratch
 #include "ftxui/dom/elements.hpp"     // for Elements, filler, Element, gridbox
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/util.hpp"      // for HeapSize
 
 namespace ftxui {
 class Screen;
 
-namespace {
-
-// Accumulate the values of a list U[n] into v[n]. So that:
-// V[0] = 0;
-// V[n+1] = v[n] + U[n]
-// return the sum of U[n].
-int Integrate(std::vector<int>& elements) {
-  int accu = 0;
-  for (auto& i : elements) {
-    const int old_accu = accu;
-    accu += i;
-    i = old_accu;
-  }
-  return accu;
-}
-}  // namespace
-
 class GridBox : public Node {
  public:
-  explicit GridBox(std::vector<Elements> lines) : lines_(std::move(lines)) {
+  GridBox(std::vector<Elements> lines, std::vector<int> column_widths)
+      : lines_(std::move(lines)), column_widths_(std::move(column_widths)) {
     y_size = (int)lines_.size();
     for (const auto& line : lines_) {
       x_size = std::max(x_size, (int)line.size());
@@ -42,6 +27,13 @@ class GridBox : public Node {
         line.push_back(filler());
       }
     }
+    column_widths_.resize(x_size, -1);
+
+    // The cells, line by line. They are laid out by the Node helpers.
+    children_.reserve(size_t(x_size) * size_t(y_size));
+    for (auto& line : lines_) {
+      children_.insert(children_.end(), line.begin(), line.end());
+    }
   }
 
   void ComputeRequirement() override {
@@ -52,101 +44,128 @@ class GridBox : public Node {
     requirement_.flex_shrink_x = 0;
     requirement_.flex_shrink_y = 0;
 
-    for (auto& line : lines_) {
-      for (auto& cell : line) {
-        cell->ComputeRequirement();
+    ComputeChildrenRequirement();
+
+    // Compute the size of each columns/row, in a single pass over the cells.
+    // They are kept for SetBox().
+    box_helper::Element init;
+    init.min_size = 0;
+    init.flex_grow = 1024;    // NOLINT
+    init.flex_shrink = 1024;  // NOLINT
+    elements_x_.assign(x_size, init);
+    elements_y_.assign(y_size, init);
+
+    requirement_.selection = Requirement::NORMAL;
+    int selected_x = 0;
+    int selected_y = 0;
+    for (int y = 0; y < y_size; ++y) {
+      auto& e_y = elements_y_[y];
+      for (int x = 0; x < x_size; ++x) {
+        const auto& requirement = lines_[y][x]->requirement();
+        e_y.min_size = std::max(e_y.min_size, requirement.min_y);
+        e_y.flex_grow = std::min(e_y.flex_grow, requirement.flex_grow_y);
+        e_y.flex_shrink = std::min(e_y.flex_shrink, requirement.flex_shrink_y);
+        if (column_widths_[x] < 0) {
+          auto& e_x = elements_x_[x];
+          e_x.min_size = std::max(e_x.min_size, requirement.min_x);
+          e_x.flex_grow = std::min(e_x.flex_grow, requirement.flex_grow_x);
+          e_x.flex_shrink =
+              std::min(e_x.flex_shrink, requirement.flex_shrink_x);
+        }
+
+        // The selected/focused child. On ties, the first one column by column.
+        if (requirement.selection > requirement_.selection ||
+            (requirement.selection == requirement_.selection &&
+             requirement.selection != Requirement::NORMAL && x < selected_x)) {
+          requirement_.selection = requirement.selection;
+          selected_x = x;
+          selected_y = y;
+        }
       }
     }
 
-    // Compute the size of each columns/row.
-    std::vector<int> size_x(x_size, 0);
-    std::vector<int> size_y(y_size, 0);
+    // The pinned columns don't depend on their cells.
     for (int x = 0; x < x_size; ++x) {
-      for (int y = 0; y < y_size; ++y) {
-        size_x[x] = std::max(size_x[x], lines_[y][x]->requirement().min_x);
-        size_y[y] = std::max(size_y[y], lines_[y][x]->requirement().min_y);
+      if (column_widths_[x] >= 0) {
+        elements_x_[x].min_size = column_widths_[x];
+        elements_x_[x].flex_grow = 0;
+        elements_x_[x].flex_shrink = 0;
       }
     }
 
-    requirement_.min_x = Integrate(size_x);
-    requirement_.min_y = Integrate(size_y);
+    int offset_x = 0;
+    int offset_y = 0;
+    for (int x = 0; x < x_size; ++x) {
+      requirement_.min_x += elements_x_[x].min_size;
+    }
+    for (int x = 0; x < selected_x; ++x) {
+      offset_x += elements_x_[x].min_size;
+    }
+    for (int y = 0; y < y_size; ++y) {
+      requirement_.min_y += elements_y_[y].min_size;
+    }
+    for (int y = 0; y < selected_y; ++y) {
+      offset_y += elements_y_[y].min_size;
+    }
 
     // Forward the selected/focused child state:
-    requirement_.selection = Requirement::NORMAL;
-    for (int x = 0; x < x_size; ++x) {
-      for (int y = 0; y < y_size; ++y) {
-        if (requirement_.selection >= lines_[y][x]->requirement().selection) {
-          continue;
-        }
-        requirement_.selection = lines_[y][x]->requirement().selection;
-        requirement_.selected_box = lines_[y][x]->requirement().selected_box;
-        requirement_.selected_box.x_min += size_x[x];
-        requirement_.selected_box.x_max += size_x[x];
-        requirement_.selected_box.y_min += size_y[y];
-        requirement_.selected_box.y_max += size_y[y];
-      }
+    if (requirement_.selection != Requirement::NORMAL) {
+      requirement_.selected_box =
+          lines_[selected_y][selected_x]->requirement().selected_box;
+      requirement_.selected_box.x_min += offset_x;
+      requirement_.selected_box.x_max += offset_x;
+      requirement_.selected_box.y_min += offset_y;
+      requirement_.selected_box.y_max += offset_y;
     }
   }
 
   void SetBox(Box box) override {
     Node::SetBox(box);
 
-    box_helper::Element init;
-    init.min_size = 0;
-    init.flex_grow = 1024;    // NOLINT
-    init.flex_shrink = 1024;  // NOLINT
-    std::vector<box_helper::Element> elements_x(x_size, init);
-    std::vector<box_helper::Element> elements_y(y_size, init);
-
-    for (int y = 0; y < y_size; ++y) {
-      for (int x = 0; x < x_size; ++x) {
-        const auto& cell = lines_[y][x];
-        const auto& requirement = cell->requirement();
-        auto& e_x = elements_x[x];
-        auto& e_y = elements_y[y];
-        e_x.min_size = std::max(e_x.min_size, requirement.min_x);
-        e_y.min_size = std::max(e_y.min_size, requirement.min_y);
-        e_x.flex_grow = std::min(e_x.flex_grow, requirement.flex_grow_x);
-        e_y.flex_grow = std::min(e_y.flex_grow, requirement.flex_grow_y);
-        e_x.flex_shrink = std::min(e_x.flex_shrink, requirement.flex_shrink_x);
-        e_y.flex_shrink = std::min(e_y.flex_shrink, requirement.flex_shrink_y);
-      }
-    }
-
     const int target_size_x = box.x_max - box.x_min + 1;
     const int target_size_y = box.y_max - box.y_min + 1;
-    box_helper::Compute(&elements_x, target_size_x);
-    box_helper::Compute(&elements_y, target_size_y);
+    box_helper::Compute(elements_x_, target_size_x);
+    box_helper::Compute(elements_y_, target_size_y);
 
+    const box_helper::Scratch scratch(children_.size());
+    const auto boxes = scratch.boxes;
     Box box_y = box;
     int y = box_y.y_min;
     for (int iy = 0; iy < y_size; ++iy) {
       box_y.y_min = y;
-      y += elements_y[iy].size;
+      y += elements_y_[iy].size;
       box_y.y_max = y - 1;
 
       Box box_x = box_y;
       int x = box_x.x_min;
       for (int ix = 0; ix < x_size; ++ix) {
         box_x.x_min = x;
-        x += elements_x[ix].size;
+        x += elements_x_[ix].size;
         box_x.x_max = x - 1;
-        lines_[iy][ix]->SetBox(box_x);
+        boxes[size_t(iy) * size_t(x_size) + size_t(ix)] = box_x;
       }
     }
+    SetChildrenBox(boxes);
   }
 
-  void Render(Screen& screen) override {
-    for (auto& line : lines_) {
-      for (auto& cell : line) {
-        cell->Render(screen);
-      }
+  size_t MemoryUsage() const override {
+    size_t bytes = Node::MemoryUsage() + util::HeapSize(lines_) +
+                   util::HeapSize(column_widths_) +
+                   util::HeapSize(elements_x_) + util::HeapSize(elements_y_);
+    for (const auto& line : lines_) {
+      bytes += util::HeapSize(line);
     }
+    return bytes;
   }
 
   int x_size = 0;
   int y_size = 0;
   std::vector<Elements> lines_;
+  std::vector<int> column_widths_;
+
+  // The size of the columns and rows, computed by ComputeRequirement().
+  std::vector<box_helper::Element> elements_x_;
+  std::vector<box_helper::Element> elements_y_;
 };
 
 /// @brief A container displaying a grid of elements.
@@ -176,7 +195,25 @@ class GridBox : public Node {
 /// ╰──────────╯╰──────╯╰──────────╯
 /// ```
 Element gridbox(std::vector<Elements> lines) {
-  return std::make_shared<GridBox>(std::move(lines));
+  return MakeNode<GridBox>(std::move(lines), std::vector<int>());
+}
+
+/// @brief A container displaying a grid of elements, with some of the column
+/// widths pinned. The width of a pinned column doesn't depend on its cells, so
+/// the cells don't need to be visited for it.
+/// @param lines A list of lines, each line being a list of elements.
+/// @param column_widths The width of every column. The negative ones, and the
+/// missing ones, are computed from the cells.
+/// @return The container.
+///
+/// #### Example
+///
+/// ```cpp
+/// // A grid of metrics, 6 characters wide.
+/// auto document = gridbox(std::move(lines), std::vector<int>(columns, 6));
+/// ```
+Element gridbox(std::vector<Elements> lines, std::vector<int> column_widths) {
+  return MakeNode<GridBox>(std::move(lines), std::move(column_widths));
 }
 
 }  // namespace ftxui
@@ -614,6 +614,21 @@ TEST(GridboxTest, Focus) {
             "╰──╯");
 }
 
+TEST(GridboxTest, PinnedColumnWidths) {
+  auto root = gridbox(
+      {
+          {text("abc"), text("1"), text("abc")},
+          {text("d"), text("2"), text("d")},
+      },
+      {2, -1});
+
+  Screen screen(8, 2);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "ab1abc  \r\n"
+            "d 2d    ");
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -4,7 +4,7 @@
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/dom/box_helper.hpp"   // for Element, Compute
+#include "ftxui/dom/box_helper.hpp"   // for Element, Compute, Scratch
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, hbox
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
@@ -24,8 +24,8 @@ class HBox : public Node {
     requirement_.flex_shrink_x = 0;
     requirement_.flex_shrink_y = 0;
     requirement_.selection = Requirement::NORMAL;
+    ComputeChildrenRequirement();
     for (auto& child : children_) {
-      child->ComputeRequirement();
       if (requirement_.selection < child->requirement().selection) {
         requirement_.selection = child->requirement().selection;
         requirement_.selected_box = child->requirement().selected_box;
@@ -41,7 +41,8 @@ class HBox : public Node {
   void SetBox(Box box) override {
     Node::SetBox(box);
 
-    std::vector<box_helper::Element> elements(children_.size());
+    const box_helper::Scratch scratch(children_.size());
+    const auto elements = scratch.elements;
     for (size_t i = 0; i < children_.size(); ++i) {
       auto& element = elements[i];
       const auto& requirement = children_[i]->requirement();
@@ -50,15 +51,17 @@ class HBox : public Node {
       element.flex_shrink = requirement.flex_shrink_x;
     }
     const int target_size = box.x_max - box.x_min + 1;
-    box_helper::Compute(&elements, target_size);
+    box_helper::Compute(elements, target_size);
 
+    const auto boxes = scratch.boxes;
     int x = box.x_min;
     for (size_t i = 0; i < children_.size(); ++i) {
-      box.x_min = x;
-      box.x_max = x + elements[i].size - 1;
-      children_[i]->SetBox(box);
-      x = box.x_max + 1;
+      boxes[i] = box;
+      boxes[i].x_min = x;
+      boxes[i].x_max = x + elements[i].size - 1;
+      x = boxes[i].x_max + 1;
     }
+    SetChildrenBox(boxes);
   }
 };
 
@@ -75,7 +78,7 @@ class HBox : public Node {
 /// });
 /// ```
 Element hbox(Elements children) {
-  return std::make_shared<HBox>(std::move(children));
+  return MakeNode<HBox>(std::move(children));
 }
 
 }  // namespace ftxui
@@ -356,6 +356,18 @@ TEST(HBoxTest, FlexGrow_NoFlex_FlewShrink) {
   }
 }
 
+TEST(HBoxTest, VariadicArguments) {
+  Elements middle = {text("c"), text("d")};
+  const Element first = text("a");
+  auto root = hbox(first, text("b"), middle, Elements{text("e")}, 42);
+  EXPECT_EQ(middle.size(), 2u);
+  EXPECT_NE(middle[0], nullptr);
+
+  Screen screen(6, 1);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(), "abcde ");
+}
+
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
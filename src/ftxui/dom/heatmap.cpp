@@ -0,0 +1,155 @@
+#include <algorithm>  // for max, min
+#include <cstddef>    // for size_t
+#include <memory>     // for make_shared
+#include <span>       // for span
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/color_map.hpp"    // for ColorMap
+#include "ftxui/dom/elements.hpp"     // for Element, heatmap
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/glyph.hpp"     // for Glyph
+#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+
+namespace ftxui {
+
+/// @brief Constructor.
+/// @param stops The colors of the gradient, evenly spread over the range.
+/// @param min The value mapped to the first stop.
+/// @param max The value mapped to the last stop.
+/// @param size The number of colors the gradient is quantized into.
+ColorMap::ColorMap(const std::vector<Color>& stops,
+                   float min,
+                   float max,
+                   size_t size)
+    : min_(min) {
+  size = std::max(size, size_t(1));
+  std::vector<Color> table(size, stops.empty() ? Color() : stops[0]);
+  if (stops.size() >= 2) {
+    const size_t segments = stops.size() - 1;
+    for (size_t i = 0; i < size; ++i) {
+      const float position = size == 1 ? 0.f
+                                       : float(i) * float(segments) /
+                                             float(size - 1);
+      const size_t segment = std::min(size_t(position), segments - 1);
+      const float t = position - float(segment);
+      // The stops are kept as is, e.g. as palette colors.
+      table[i] = t == 0.f ? stops[segment]
+                          : Color::Interpolate(t, stops[segment],
+                                               stops[segment + 1]);
+    }
+    table.back() = stops.back();
+  }
+  table_ = std::make_shared<const std::vector<Color>>(std::move(table));
+  if (max > min) {
+    scale_ = float(size) / (max - min);
+  }
+}
+
+namespace {
+
+// The upper half of a cell, drawn in the foreground color. The lower half
+// shows the background color.
+constexpr Glyph kUpperHalf = Glyph::Narrow("▀");
+
+// Only the cells inside the stencil are visited. They are colored, without
+// creating any node or Color per cell.
+class Heatmap : public Node {
+ public:
+  Heatmap(int width,
+          int height,
+          const float* values,
+          ColorMap map,
+          bool half_blocks)
+      : width_(std::max(0, width)),
+        height_(std::max(0, height)),
+        values_(values),
+        map_(std::move(map)),
+        half_blocks_(half_blocks) {}
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement();
+    requirement_.min_x = width_;
+    requirement_.min_y = half_blocks_ ? (height_ + 1) / 2 : height_;
+  }
+
+  void Render(Screen& screen) override {
+    const int rows = requirement_.min_y;
+    const int x_min = std::max(box_.x_min, screen.stencil.x_min);
+    const int x_max = std::min({box_.x_max, screen.stencil.x_max,
+                                box_.x_min + width_ - 1});
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min({box_.y_max, screen.stencil.y_max,
+                                box_.y_min + rows - 1});
+    if (values_ == nullptr || x_min > x_max) {
+      return;
+    }
+    for (int y = y_min; y <= y_max; ++y) {
+      const std::span<Pixel> row = screen.Row(y);
+      const int cell_y = y - box_.y_min;
+      if (!half_blocks_) {
+        const float* values = values_ + cell_y * width_ - box_.x_min;
+        for (int x = x_min; x <= x_max; ++x) {
+          row[x].background_color = map_(values[x]);  // NOLINT
+        }
+        continue;
+      }
+      const float* top = values_ + 2 * cell_y * width_ - box_.x_min;
+      const bool has_bottom = 2 * cell_y + 1 < height_;
+      for (int x = x_min; x <= x_max; ++x) {
+        Pixel& pixel = row[x];
+        pixel.character = kUpperHalf;
+        pixel.foreground_color = map_(top[x]);  // NOLINT
+        if (has_bottom) {
+          pixel.background_color = map_(top[x + width_]);  // NOLINT
+        }
+      }
+    }
+  }
+
+ private:
+  const int width_;
+  const int height_;
+  const float* values_;
+  const ColorMap map_;
+  const bool half_blocks_;
+};
+
+}  // namespace
+
+/// @brief Draw a grid of values as colored cells. The colors are looked up in
+/// the quantized table of |map|, without creating any element per cell.
+/// @param width The number of columns of the grid.
+/// @param height The number of rows of the grid.
+/// @param values The width * height values, row after row. They are read when
+///               the element is drawn, and must outlive it.
+/// @param map The colors of the values.
+/// @param half_blocks Draw two rows of the grid per line, using the upper half
+///                    block character, doubling the vertical resolution.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<float> load(64 * 16);
+/// ...
+/// Element document = heatmap(64, 16, load.data(),
+///                            ColorMap({Color::Black, Color::Red}), true);
+/// ```
+Element heatmap(int width,
+                int height,
+                const float* values,
+                ColorMap map,
+                bool half_blocks) {
+  return MakeNode<Heatmap>(width, height, values, std::move(map),
+                           half_blocks);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
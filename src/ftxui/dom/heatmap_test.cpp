@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <vector>  // for vector
+
+#include "ftxui/dom/color_map.hpp"  // for ColorMap
+#include "ftxui/dom/elements.hpp"   // for heatmap, text, dbox
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+TEST(HeatmapTest, ColorMap) {
+  const ColorMap map({Color::RGB(0, 0, 0), Color::RGB(255, 0, 0),
+                      Color::RGB(255, 255, 255)},
+                     0.f, 10.f, 3);
+  EXPECT_EQ(map.size(), 3u);
+  EXPECT_EQ(map(0.f), Color::RGB(0, 0, 0));
+  EXPECT_EQ(map(5.f), Color::RGB(255, 0, 0));
+  EXPECT_EQ(map(10.f), Color::RGB(255, 255, 255));
+
+  // Out of the range.
+  EXPECT_EQ(map(-3.f), Color::RGB(0, 0, 0));
+  EXPECT_EQ(map(1e9f), Color::RGB(255, 255, 255));
+  EXPECT_EQ(map(0.f / 0.f), Color::RGB(0, 0, 0));
+}
+
+TEST(HeatmapTest, Render) {
+  const ColorMap map({Color::Black, Color::White}, 0.f, 1.f, 2);
+  const std::vector<float> values = {0.f, 1.f, 1.f,  //
+                                     1.f, 0.f, 0.f};
+  Screen screen(4, 3);
+  Render(screen, dbox({text("abcd"), heatmap(3, 2, values.data(), map)}));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Color(Color::Black));
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color, Color(Color::White));
+  EXPECT_EQ(screen.PixelAt(0, 1).background_color, Color(Color::White));
+  EXPECT_EQ(screen.PixelAt(2, 1).background_color, Color(Color::Black));
+  EXPECT_EQ(screen.PixelAt(3, 0).background_color, Color());
+  EXPECT_EQ(screen.PixelAt(0, 2).background_color, Color());
+
+  // The characters are kept.
+  EXPECT_EQ(screen.PixelAt(1, 0).character, "b");
+}
+
+TEST(HeatmapTest, HalfBlocks) {
+  const ColorMap map({Color::Black, Color::White}, 0.f, 1.f, 2);
+  const std::vector<float> values = {0.f, 1.f,  //
+                                     1.f, 0.f,  //
+                                     1.f, 1.f};
+  Screen screen(2, 2);
+  Render(screen, heatmap(2, 3, values.data(), map, /*half_blocks=*/true));
+  EXPECT_EQ(screen.PixelAt(1, 1).character, "▀");
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color(Color::Black));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Color(Color::White));
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color, Color(Color::White));
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color, Color(Color::Black));
+
+  // The last row has no lower half.
+  EXPECT_EQ(screen.PixelAt(0, 1).foreground_color, Color(Color::White));
+  EXPECT_EQ(screen.PixelAt(0, 1).background_color, Color());
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,70 @@
+#include "ftxui/dom/hit_index.hpp"
+
+#include <algorithm>  // for max, min
+
+namespace ftxui {
+
+namespace {
+thread_local HitIndex* g_current = nullptr;  // NOLINT
+}  // namespace
+
+HitIndex::Scope::Scope(HitIndex* index) : previous_(g_current) {
+  g_current = index;
+}
+
+HitIndex::Scope::~Scope() {
+  g_current = previous_;
+}
+
+/// @brief The index active on the current thread, or nullptr.
+// static
+HitIndex* HitIndex::Current() {
+  return g_current;
+}
+
+/// @brief Remove every box, and cover a screen of |dimx| x |dimy| cells. The
+/// boxes outside of the screen are ignored.
+void HitIndex::Reset(int dimx, int dimy) {
+  columns_ = (std::max(0, dimx) + kBucketX - 1) / kBucketX;
+  rows_ = (std::max(0, dimy) + kBucketY - 1) / kBucketY;
+  // Keep the memory of the buckets from one frame to the next.
+  buckets_.resize(size_t(columns_) * size_t(rows_));
+  for (auto& bucket : buckets_) {
+    bucket.clear();
+  }
+}
+
+/// @brief Add |box| to the buckets it overlaps.
+void HitIndex::Add(const Box& box) {
+  if (box.x_min > box.x_max || box.y_min > box.y_max) {
+    return;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  const int x_min = std::max(0, box.x_min / kBucketX);
+  const int x_max = std::min(columns_ - 1, box.x_max / kBucketX);
+  const int y_min = std::max(0, box.y_min / kBucketY);
+  const int y_max = std::min(rows_ - 1, box.y_max / kBucketY);
+  for (int y = y_min; y <= y_max; ++y) {
+    for (int x = x_min; x <= x_max; ++x) {
+      buckets_[size_t(y) * size_t(columns_) + size_t(x)].push_back(box);
+    }
+  }
+}
+
+/// @brief Whether the cell (x, y) is inside one of the boxes added since the
+/// last Reset().
+bool HitIndex::Hit(int x, int y) const {
+  if (x < 0 || y < 0 || x / kBucketX >= columns_ || y / kBucketY >= rows_) {
+    return false;
+  }
+  const auto& bucket =
+      buckets_[size_t(y / kBucketY) * size_t(columns_) + size_t(x / kBucketX)];
+  return std::any_of(bucket.begin(), bucket.end(),
+                     [&](const Box& box) { return box.Contain(x, y); });
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include "ftxui/dom/elements.hpp"   // for text, hbox, vbox, reflect, filler
+#include "ftxui/dom/hit_index.hpp"  // for HitIndex
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+TEST(HitIndexTest, Empty) {
+  HitIndex index;
+  EXPECT_FALSE(index.Hit(0, 0));
+  index.Reset(10, 10);
+  EXPECT_FALSE(index.Hit(0, 0));
+  EXPECT_FALSE(index.Hit(-1, 20));
+}
+
+TEST(HitIndexTest, Reflect) {
+  Box box_a;
+  Box box_b;
+  Element document = vbox({
+      hbox({
+          text("aa") | reflect(box_a),
+          filler(),
+          text("b") | reflect(box_b),
+      }),
+      filler(),
+  });
+
+  Screen screen(40, 5);
+  HitIndex index;
+  index.Reset(screen.dimx(), screen.dimy());
+  {
+    const HitIndex::Scope scope(&index);
+    EXPECT_EQ(HitIndex::Current(), &index);
+    Render(screen, document);
+  }
+  EXPECT_EQ(HitIndex::Current(), nullptr);
+
+  EXPECT_TRUE(index.Hit(0, 0));
+  EXPECT_TRUE(index.Hit(1, 0));
+  EXPECT_FALSE(index.Hit(2, 0));
+  EXPECT_FALSE(index.Hit(20, 0));
+  EXPECT_TRUE(index.Hit(39, 0));
+  EXPECT_FALSE(index.Hit(0, 1));
+
+  index.Reset(screen.dimx(), screen.dimy());
+  EXPECT_FALSE(index.Hit(0, 0));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
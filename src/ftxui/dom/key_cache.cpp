@@ -0,0 +1,85 @@
+#include "ftxui/dom/key_cache.hpp"
+
+#include <string>   // for string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"  // for Element, Decorator, key, retained
+
+namespace ftxui {
+
+namespace {
+thread_local KeyCache* g_current = nullptr;  // NOLINT
+}  // namespace
+
+KeyCache::Scope::Scope(KeyCache* cache) : cache_(cache), previous_(g_current) {
+  g_current = cache;
+}
+
+KeyCache::Scope::~Scope() {
+  g_current = previous_;
+  cache_->EndFrame();
+}
+
+/// @brief The cache active on the current thread, or nullptr.
+// static
+KeyCache* KeyCache::Current() {
+  return g_current;
+}
+
+/// @brief Return the element of the previous frame associated with |key|, or
+/// |element| if there was none. The result is kept for the next frame.
+Element KeyCache::Reconcile(const std::string& key, Element element) {
+  // The key was already used during this frame.
+  auto it = current_.find(key);
+  if (it != current_.end()) {
+    return it->second;
+  }
+
+  auto previous = previous_.find(key);
+  if (previous != previous_.end()) {
+    element = std::move(previous->second);
+    previous_.erase(previous);
+  }
+  current_.emplace(key, element);
+  return element;
+}
+
+// Release the elements unused during the frame.
+void KeyCache::EndFrame() {
+  previous_.swap(current_);
+  current_.clear();
+}
+
+/// @brief Identify the element across frames. When a KeyCache is active, the
+/// element created with the same key during the previous frame is reused,
+/// with its layout. The key must identify the content of the element.
+/// @param k The identifier of the element.
+/// @ingroup dom
+/// @see KeyCache
+///
+/// ### Example
+///
+/// ```cpp
+/// auto renderer = Renderer([&] {
+///   return vbox({
+///     text(status),
+///     HelpPanel() | key("help"),
+///     Chart(data) | key("chart-" + std::to_string(data_version)),
+///   });
+/// });
+/// ```
+Decorator key(std::string k) {
+  return [k = std::move(k)](Element child) {
+    KeyCache* cache = KeyCache::Current();
+    if (cache == nullptr) {
+      return child;
+    }
+    return cache->Reconcile(k, retained(std::move(child)));
+  };
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator, string
+
+#include "ftxui/dom/elements.hpp"   // for key, text, vbox, Element
+#include "ftxui/dom/key_cache.hpp"  // for KeyCache
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+TEST(KeyCacheTest, NoCache) {
+  EXPECT_EQ(KeyCache::Current(), nullptr);
+  Element element = text("a");
+  Node* node = element.get();
+  EXPECT_EQ((std::move(element) | key("a")).get(), node);
+}
+
+TEST(KeyCacheTest, Reuse) {
+  KeyCache cache;
+  Node* first = nullptr;
+  {
+    const KeyCache::Scope scope(&cache);
+    EXPECT_EQ(KeyCache::Current(), &cache);
+    first = (text("a") | key("a")).get();
+  }
+  EXPECT_EQ(KeyCache::Current(), nullptr);
+  EXPECT_EQ(cache.size(), 1u);
+
+  {
+    const KeyCache::Scope scope(&cache);
+    Element element = text("b") | key("a");
+    EXPECT_EQ(element.get(), first);
+
+    // The content associated with the key is kept.
+    Screen screen(1, 1);
+    Render(screen, element);
+    EXPECT_EQ(screen.ToString(), "a");
+  }
+}
+
+TEST(KeyCacheTest, SameFrame) {
+  KeyCache cache;
+  const KeyCache::Scope scope(&cache);
+  Element a = text("a") | key("a");
+  Element b = text("b") | key("a");
+  EXPECT_EQ(a.get(), b.get());
+}
+
+TEST(KeyCacheTest, UnusedKeysAreReleased) {
+  KeyCache cache;
+  {
+    const KeyCache::Scope scope(&cache);
+    auto a = text("a") | key("a");
+    auto b = text("b") | key("b");
+  }
+  EXPECT_EQ(cache.size(), 2u);
+  {
+    const KeyCache::Scope scope(&cache);
+    auto a = text("a") | key("a");
+  }
+  EXPECT_EQ(cache.size(), 1u);
+  {
+    const KeyCache::Scope scope(&cache);
+  }
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(KeyCacheTest, Render) {
+  KeyCache cache;
+  for (int i = 0; i < 3; ++i) {
+    Element document;
+    {
+      const KeyCache::Scope scope(&cache);
+      document = vbox({
+          text(std::to_string(i)),
+          text("static") | key("static"),
+      });
+    }
+    Screen screen(6, 2);
+    Render(screen, document);
+    EXPECT_EQ(screen.ToString(), std::to_string(i) + "     \r\nstatic");
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
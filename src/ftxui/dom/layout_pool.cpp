@@ -0,0 +1,109 @@
+#include "ftxui/dom/layout_pool.hpp"
+
+namespace ftxui {
+
+namespace {
+thread_local LayoutPool* g_current = nullptr;  // NOLINT
+}  // namespace
+
+/// @brief Start |threads| threads, waiting for layouts.
+/// @param threads the number of threads added to the calling one.
+/// @param min_weight the number of descendants a child needs to be laid out in
+///                   parallel with its siblings.
+LayoutPool::LayoutPool(int threads, size_t min_weight)
+    : min_weight_(min_weight) {
+  for (int i = 0; i < threads; ++i) {
+    threads_.emplace_back([this] { Work(); });
+  }
+}
+
+LayoutPool::~LayoutPool() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+LayoutPool::Scope::Scope(LayoutPool* pool) : previous_(g_current) {
+  g_current = pool;
+}
+
+LayoutPool::Scope::~Scope() {
+  g_current = previous_;
+}
+
+/// @brief The pool active on the current thread, or nullptr.
+LayoutPool* LayoutPool::Current() {
+  return g_current;
+}
+
+/// @brief Call |function| for every index in [0, count), from the threads of
+/// the pool and the calling one. Returns once every call returned. The calls
+/// made from |function| are serial.
+void LayoutPool::ParallelFor(size_t count,
+                             const std::function<void(size_t)>& function) {
+  const std::unique_lock<std::mutex> busy(busy_, std::try_to_lock);
+  if (count < 2 || threads_.empty() || !busy.owns_lock()) {
+    for (size_t i = 0; i < count; ++i) {
+      function(i);
+    }
+    return;
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    function_ = &function;
+    count_ = count;
+    next_ = 0;
+    job_++;
+    working_ = static_cast<int>(threads_.size());
+  }
+  wake_.notify_all();
+
+  // The threads pick the next index once they are done with the previous one,
+  // so the large children don't hold the small ones back.
+  LayoutPool* const current = g_current;
+  g_current = nullptr;
+  Run();
+  g_current = current;
+
+  // Wait for the threads, so that none of them uses |function| afterward.
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this] { return working_ == 0; });
+  function_ = nullptr;
+}
+
+void LayoutPool::Run() {
+  for (size_t i = next_++; i < count_; i = next_++) {
+    (*function_)(i);
+  }
+}
+
+void LayoutPool::Work() {
+  uint64_t job = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [&] { return quit_ || job_ != job; });
+      if (quit_) {
+        return;
+      }
+      job = job_;
+    }
+    Run();
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (--working_ == 0) {
+      done_.notify_one();
+    }
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <atomic>  // for atomic
+#include <string>  // for string, to_string
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"     // for text, hbox, vbox, gridbox, flexbox
+#include "ftxui/dom/layout_pool.hpp"  // for LayoutPool
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+
+Element Panel(int i) {
+  Elements lines;
+  for (int j = 0; j < 8; ++j) {
+    lines.push_back(hbox({
+        text("metric " + std::to_string(j)),
+        filler(),
+        gauge(float((i * 7 + j) % 10) / 10.F) | flex,
+        text(std::to_string(i * j)),
+    }));
+  }
+  return window(text("panel " + std::to_string(i)), vbox(std::move(lines)));
+}
+
+Element Wallboard() {
+  std::vector<Elements> rows;
+  for (int y = 0; y < 4; ++y) {
+    Elements row;
+    for (int x = 0; x < 4; ++x) {
+      Element panel = Panel(y * 4 + x);
+      if (x == 2 && y == 1) {
+        panel |= focus;
+      }
+      row.push_back(panel);
+    }
+    rows.push_back(std::move(row));
+  }
+  Elements flow;
+  for (int i = 0; i < 8; ++i) {
+    flow.push_back(paragraph("a flowing paragraph, wrapped to the width") |
+                   border | size(WIDTH, EQUAL, 20));
+  }
+  return vbox({
+      gridbox(std::move(rows)),
+      flexbox(std::move(flow)),
+      hbox({Panel(100), Panel(101), Panel(102)}),
+  });
+}
+
+}  // namespace
+
+TEST(LayoutPoolTest, ParallelFor) {
+  LayoutPool pool(3);
+  for (int count : {0, 1, 2, 100}) {
+    std::vector<std::atomic<int>> calls(static_cast<size_t>(count));
+    pool.ParallelFor(calls.size(), [&](size_t i) { calls[i]++; });
+    for (auto& call : calls) {
+      EXPECT_EQ(call, 1);
+    }
+  }
+}
+
+TEST(LayoutPoolTest, Scope) {
+  LayoutPool pool(2);
+  EXPECT_EQ(LayoutPool::Current(), nullptr);
+  {
+    LayoutPool::Scope scope(&pool);
+    EXPECT_EQ(LayoutPool::Current(), &pool);
+
+    // The calls are serial, from every thread.
+    std::atomic<int> nested = 0;
+    pool.ParallelFor(10, [&](size_t /*i*/) {
+      if (LayoutPool::Current() != nullptr) {
+        nested++;
+      }
+    });
+    EXPECT_EQ(nested, 0);
+  }
+  EXPECT_EQ(LayoutPool::Current(), nullptr);
+}
+
+TEST(LayoutPoolTest, SameAsSerial) {
+  Screen serial(200, 100);
+  Render(serial, Wallboard());
+
+  LayoutPool pool(3, /*min_weight=*/8);
+  for (int i = 0; i < 10; ++i) {
+    Screen parallel(200, 100);
+    {
+      LayoutPool::Scope scope(&pool);
+      Render(parallel, Wallboard());
+    }
+    EXPECT_EQ(parallel.ToString(), serial.ToString());
+  }
+}
+
+TEST(LayoutPoolTest, Frame) {
+  auto document = [] { return Wallboard() | frame | size(HEIGHT, EQUAL, 40); };
+  Screen serial(200, 40);
+  Render(serial, document());
+
+  LayoutPool pool(3, /*min_weight=*/8);
+  LayoutPool::Scope scope(&pool);
+  Screen parallel(200, 40);
+  Render(parallel, document());
+  EXPECT_EQ(parallel.ToString(), serial.ToString());
+}
+
+TEST(LayoutPoolTest, ParallelRender) {
+  auto document = [] {
+    return vbox({
+        Wallboard(),
+        dbox({Panel(200), Panel(201) | center}),
+        canvas(200, 40,
+               [](Canvas& c) { c.DrawPointLine(0, 0, 199, 39); }) |
+            border,
+    });
+  };
+  Screen serial(200, 200);
+  Render(serial, document());
+
+  LayoutPool pool(3, /*min_weight=*/8);
+  pool.SetParallelRender(true);
+  for (int i = 0; i < 10; ++i) {
+    Screen parallel(200, 200);
+    {
+      LayoutPool::Scope scope(&pool);
+      Render(parallel, document());
+    }
+    EXPECT_EQ(parallel.ToString(), serial.ToString());
+    EXPECT_EQ(parallel.cursor().x, serial.cursor().x);
+    EXPECT_EQ(parallel.cursor().y, serial.cursor().y);
+  }
+}
+
+TEST(LayoutPoolTest, ParallelRenderFrame) {
+  auto document = [] {
+    return Wallboard() | focusPositionRelative(0.5F, 0.5F) | frame |
+           size(HEIGHT, EQUAL, 30);
+  };
+  Screen serial(150, 30);
+  Render(serial, document());
+
+  LayoutPool pool(3, /*min_weight=*/8);
+  pool.SetParallelRender(true);
+  LayoutPool::Scope scope(&pool);
+  Screen parallel(150, 30);
+  Render(parallel, document());
+  EXPECT_EQ(parallel.ToString(), serial.ToString());
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,123 @@
+#include "ftxui/dom/log_buffer.hpp"
+
+#include <algorithm>  // for max, min
+#include <utility>    // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, logView
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for Glyphs
+#include "ftxui/util/ref.hpp"         // for ConstRef
+
+namespace ftxui {
+
+/// @brief Constructor.
+/// @param capacity the number of lines kept. The oldest ones are removed
+/// first.
+LogBuffer::LogBuffer(size_t capacity)
+    : lines_(std::max(capacity, size_t(1))) {}
+
+/// @brief Append a line, removing the oldest one if the buffer is full. Every
+/// '\n' starts a new line.
+/// @param text the content of the line.
+void LogBuffer::Append(std::string_view text) {
+  size_t begin = 0;
+  size_t end = text.find('\n');
+  while (end != std::string_view::npos) {
+    AppendLine(text.substr(begin, end - begin));
+    begin = end + 1;
+    end = text.find('\n', begin);
+  }
+  AppendLine(text.substr(begin));
+}
+
+void LogBuffer::AppendLine(std::string_view line) {
+  // Reuse the memory of the line being replaced.
+  std::vector<Glyph>& cells = lines_[appended_ % lines_.size()];
+  cells.clear();
+  for (const GlyphView& glyph : Glyphs(line)) {
+    cells.emplace_back(glyph.text);
+    if (glyph.width == 2) {
+      cells.emplace_back();
+    }
+  }
+  appended_++;
+  size_ = std::min(size_ + 1, lines_.size());
+}
+
+/// @brief Remove every line.
+void LogBuffer::Clear() {
+  // The lines are counted from the first one ever appended, for appended().
+  size_ = 0;
+}
+
+/// @brief The cells of the |index|-th oldest line.
+const std::vector<Glyph>& LogBuffer::operator[](size_t index) const {
+  return lines_[(appended_ - size_ + index) % lines_.size()];
+}
+
+namespace {
+
+class LogView : public Node {
+ public:
+  LogView(ConstRef<LogBuffer> buffer, int scroll)
+      : buffer_(std::move(buffer)), scroll_(scroll) {}
+
+  void ComputeRequirement() override {
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    const LogBuffer& buffer = *buffer_;
+    const int height = box_.y_max - box_.y_min + 1;
+    const int size = static_cast<int>(buffer.size());
+    const int last = std::clamp(size - scroll_, 0, size);
+    const int first = std::max(0, last - height);
+
+    // Only the visible lines are read.
+    int y = box_.y_max - (last - first) + 1;
+    for (int i = first; i < last; ++i, ++y) {
+      int x = box_.x_min;
+      for (const Glyph& cell : buffer[size_t(i)]) {
+        if (x > box_.x_max) {
+          break;
+        }
+        screen.PixelAt(x++, y).character = cell;
+      }
+    }
+  }
+
+ private:
+  ConstRef<LogBuffer> buffer_;
+  int scroll_;
+};
+
+}  // namespace
+
+/// @brief Draw the last lines of a LogBuffer, filling the element from the
+/// bottom. Only the visible lines are drawn.
+/// @param buffer the lines, or a pointer to them.
+/// @param scroll the number of lines skipped, from the bottom.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// LogBuffer logs(10000);
+/// ...
+/// Element document = logView(&logs) | border;
+/// ```
+Element logView(ConstRef<LogBuffer> buffer, int scroll) {
+  return MakeNode<LogView>(std::move(buffer), scroll);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <string>  // for to_string
+
+#include "ftxui/dom/elements.hpp"    // for logView
+#include "ftxui/dom/log_buffer.hpp"  // for LogBuffer
+#include "ftxui/dom/node.hpp"        // for Render
+#include "ftxui/screen/screen.hpp"   // for Screen
+
+namespace ftxui {
+
+TEST(LogBufferTest, RingBuffer) {
+  LogBuffer logs(3);
+  for (int i = 0; i < 5; ++i) {
+    logs.Append(std::to_string(i));
+  }
+  EXPECT_EQ(logs.size(), 3u);
+  EXPECT_EQ(logs.appended(), 5u);
+  EXPECT_EQ(logs[0].size(), 1u);
+  EXPECT_EQ(logs[0][0], "2");
+  EXPECT_EQ(logs[2][0], "4");
+
+  logs.Clear();
+  EXPECT_EQ(logs.size(), 0u);
+  EXPECT_EQ(logs.appended(), 5u);
+}
+
+TEST(LogBufferTest, SplitLines) {
+  LogBuffer logs(10);
+  logs.Append("a\nbc\n\nd");
+  ASSERT_EQ(logs.size(), 4u);
+  EXPECT_EQ(logs[1].size(), 2u);
+  EXPECT_EQ(logs[2].size(), 0u);
+  EXPECT_EQ(logs[3][0], "d");
+}
+
+TEST(LogBufferTest, Fullwidth) {
+  LogBuffer logs(10);
+  logs.Append("测a");
+  ASSERT_EQ(logs[0].size(), 3u);
+  EXPECT_EQ(logs[0][0], "测");
+  EXPECT_TRUE(logs[0][1].empty());
+  EXPECT_EQ(logs[0][2], "a");
+}
+
+TEST(LogBufferTest, RenderTail) {
+  LogBuffer logs(100);
+  for (int i = 0; i < 10; ++i) {
+    logs.Append("line " + std::to_string(i));
+  }
+  Screen screen(6, 3);
+  Render(screen, logView(&logs));
+  EXPECT_EQ(screen.ToString(),
+            "line 7\r\n"
+            "line 8\r\n"
+            "line 9");
+
+  Render(screen, logView(&logs, 2));
+  EXPECT_EQ(screen.ToString(),
+            "line 5\r\n"
+            "line 6\r\n"
+            "line 7");
+}
+
+TEST(LogBufferTest, RenderFromTheBottom) {
+  LogBuffer logs(100);
+  logs.Append("a");
+  Screen screen(2, 3);
+  Render(screen, logView(&logs));
+  EXPECT_EQ(screen.ToString(),
+            "  \r\n"
+            "  \r\n"
+            "a ");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
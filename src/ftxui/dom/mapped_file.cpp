@@ -0,0 +1,330 @@
+#include "ftxui/dom/mapped_file.hpp"
+
+#include <algorithm>  // for max, min
+#include <climits>    // for INT_MAX
+#include <cstring>    // for memchr
+#include <memory>     // for make_shared, shared_ptr
+#include <utility>    // for move
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>     // for open, O_RDONLY
+#include <sys/mman.h>  // for mmap, munmap, madvise
+#include <sys/stat.h>  // for fstat, stat
+#include <unistd.h>    // for close
+#endif
+
+#include "ftxui/dom/elements.hpp"     // for Element, fileView
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for Glyphs, GlyphView
+
+namespace ftxui {
+
+namespace {
+
+constexpr size_t kSampling = 64;            // NOLINT
+constexpr size_t kChunk = 4 * 1024 * 1024;  // NOLINT
+constexpr int kHexBytes = 16;               // NOLINT
+// The columns of a hex row, after the offset: "  xx xx ... xx  xx ... xx  ".
+constexpr int kHexColumns = 2 + 3 * kHexBytes + 2;  // NOLINT
+
+const char* Find(const char* begin, const char* end) {
+  return static_cast<const char*>(
+      std::memchr(begin, '\n', static_cast<size_t>(end - begin)));
+}
+
+}  // namespace
+
+/// @brief Map the file at |path|. Its lines are indexed in the background.
+/// @param path the file to show.
+/// @param on_progress called by the indexing thread, every time new lines are
+///                    indexed. For instance, to redraw the screen.
+MappedFile::MappedFile(const std::string& path,
+                       std::function<void()> on_progress)
+    : on_progress_(std::move(on_progress)) {
+#if defined(_WIN32)
+  file_ = CreateFileA(path.c_str(), GENERIC_READ,
+                      FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_ == INVALID_HANDLE_VALUE) {
+    file_ = nullptr;
+    indexed_ = true;
+    return;
+  }
+  LARGE_INTEGER size;
+  GetFileSizeEx(file_, &size);
+  size_ = static_cast<size_t>(size.QuadPart);
+  if (size_ != 0) {
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_) {
+      data_ = static_cast<const char*>(
+          MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    }
+    if (!data_) {
+      size_ = 0;
+      indexed_ = true;
+      return;
+    }
+  }
+#else
+  const int fd = open(path.c_str(), O_RDONLY);  // NOLINT
+  if (fd < 0) {
+    indexed_ = true;
+    return;
+  }
+  struct stat st = {};
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    indexed_ = true;
+    return;
+  }
+  size_ = static_cast<size_t>(st.st_size);
+  if (size_ != 0) {
+    void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {  // NOLINT
+      close(fd);
+      size_ = 0;
+      indexed_ = true;
+      return;
+    }
+    // The index reads the whole file once, from the start.
+    madvise(data, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(data);
+  }
+  // The mapping remains valid after the file is closed.
+  close(fd);
+#endif
+
+  is_open_ = true;
+  starts_.push_back(0);
+#if defined(__EMSCRIPTEN__)
+  Index();
+#else
+  thread_ = std::thread([this] { Index(); });
+#endif
+}
+
+MappedFile::~MappedFile() {
+  quit_ = true;
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+#if defined(_WIN32)
+  if (data_) {
+    UnmapViewOfFile(data_);
+  }
+  if (mapping_) {
+    CloseHandle(mapping_);
+  }
+  if (file_) {
+    CloseHandle(file_);
+  }
+#else
+  if (data_) {
+    munmap(const_cast<char*>(data_), size_);  // NOLINT
+  }
+#endif
+}
+
+// Run by the indexing thread. The offsets are published once per chunk, so
+// that the lock is rarely taken.
+void MappedFile::Index() {
+  const char* const end = data_ + size_;
+  const char* it = data_;
+  size_t lines = 0;
+  std::vector<size_t> starts;
+  while (it != end && !quit_) {
+    const char* chunk_end = std::min(it + kChunk, end);
+    while (const char* eol = Find(it, chunk_end)) {
+      it = eol + 1;
+      if (++lines % kSampling == 0) {
+        starts.push_back(static_cast<size_t>(it - data_));
+      }
+    }
+    it = chunk_end;
+
+    // The last line doesn't need a final '\n'.
+    const bool last = it == end && size_ != 0 && end[-1] != '\n';
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      starts_.insert(starts_.end(), starts.begin(), starts.end());
+      lines_ = lines + (last ? 1 : 0);
+    }
+    starts.clear();
+    if (on_progress_) {
+      on_progress_();
+    }
+  }
+  indexed_ = true;
+}
+
+/// @brief The number of lines indexed so far. A final '\n' doesn't start a new
+/// line.
+size_t MappedFile::line_count() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return lines_;
+}
+
+/// @brief Block until the whole file was indexed.
+void MappedFile::WaitIndexed() {
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+/// @brief The |index|-th line, without its '\n'.
+/// @param index the line. It must be lower than line_count().
+std::string_view MappedFile::Line(size_t index) const {
+  size_t start = 0;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    start = starts_[index / kSampling];
+  }
+  const char* const end = data_ + size_;
+  const char* it = data_ + start;
+  for (size_t i = index % kSampling; i > 0; --i) {
+    it = Find(it, end) + 1;
+  }
+  const char* eol = Find(it, end);
+  return {it, static_cast<size_t>((eol ? eol : end) - it)};
+}
+
+namespace {
+
+class FileView : public Node {
+ public:
+  FileView(std::shared_ptr<const MappedFile> file, bool hex)
+      : file_(std::move(file)), hex_(hex) {
+    // Large files get a wider offset column.
+    for (size_t size = file_->size(); size > 0xFFFFFFFF; size >>= 4) {
+      offset_digits_++;
+    }
+  }
+
+  void ComputeRequirement() override {
+    const size_t rows = hex_ ? (file_->size() + kHexBytes - 1) / kHexBytes
+                             : file_->line_count();
+    requirement_.min_y = static_cast<int>(std::min(rows, size_t(INT_MAX)));
+    if (hex_) {
+      requirement_.min_x = offset_digits_ + kHexColumns + kHexBytes + 2;
+    } else {
+      requirement_.flex_grow_x = 1;
+      requirement_.flex_shrink_x = 1;
+    }
+  }
+
+  void Render(Screen& screen) override {
+    // Only the visible rows are read.
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min(box_.y_max, screen.stencil.y_max);
+    x_max_ = std::min(box_.x_max, screen.stencil.x_max);
+    for (int y = y_min; y <= y_max; ++y) {
+      const auto row = static_cast<size_t>(y - box_.y_min);
+      if (hex_) {
+        RenderHex(screen, y, row);
+      } else if (row < file_->line_count()) {
+        RenderLine(screen, y, file_->Line(row));
+      }
+    }
+  }
+
+ private:
+  void RenderLine(Screen& screen, int y, std::string_view line) const {
+    int x = box_.x_min;
+    for (const GlyphView& glyph : Glyphs(line)) {
+      if (x > x_max_) {
+        return;
+      }
+      screen.PixelAt(x, y).character = Glyph(glyph.text);
+      if (glyph.width == 2) {
+        screen.PixelAt(x + 1, y).character = Glyph();
+      }
+      x += glyph.width;
+    }
+  }
+
+  void RenderHex(Screen& screen, int y, size_t row) const {
+    static constexpr std::string_view kDigits = "0123456789abcdef";
+    const size_t offset = row * kHexBytes;
+    if (offset >= file_->size()) {
+      return;
+    }
+    const std::string_view bytes = file_->data().substr(offset, kHexBytes);
+    int x = box_.x_min;
+    auto put = [&](std::string_view c) {
+      if (x <= x_max_) {
+        screen.PixelAt(x, y).character = Glyph(c);
+      }
+      x++;
+    };
+
+    for (int i = offset_digits_ - 1; i >= 0; --i) {
+      put(kDigits.substr((offset >> (4 * i)) & 0xF, 1));
+    }
+    x++;
+    for (size_t i = 0; i < bytes.size(); ++i) {
+      const auto byte = static_cast<unsigned char>(bytes[i]);
+      x += (i % 8 == 0) ? 1 : 0;
+      put(kDigits.substr(byte >> 4, 1));
+      put(kDigits.substr(byte & 0xF, 1));
+      x++;
+    }
+    x = box_.x_min + offset_digits_ + kHexColumns;
+    put("|");
+    for (const char c : bytes) {
+      // The bytes are views into the mapping.
+      put((c >= ' ' && c <= '~') ? std::string_view(&c, 1) : ".");
+    }
+    put("|");
+  }
+
+  std::shared_ptr<const MappedFile> file_;
+  bool hex_;
+  int offset_digits_ = 8;  // NOLINT
+  int x_max_ = 0;
+};
+
+}  // namespace
+
+/// @brief Draw a MappedFile, one line per row. Only the visible lines are
+/// read, so it can be put in a frame, however large the file is. The lines
+/// not indexed yet are not drawn.
+/// @param file the file.
+/// @param hex whether the content is drawn as a hex dump, 16 bytes per row.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// auto file = std::make_shared<MappedFile>("server.log");
+/// Element element = fileView(file) | focusPosition(0, scroll) | frame;
+/// ```
+Element fileView(std::shared_ptr<const MappedFile> file, bool hex) {
+  return MakeNode<FileView>(std::move(file), hex);
+}
+
+/// @brief Map the file at |path|, and draw it. The file is mapped every time
+/// this is called: keep a MappedFile to draw it on every frame instead.
+/// @param path the file.
+/// @param hex whether the content is drawn as a hex dump, 16 bytes per row.
+/// @ingroup dom
+Element fileView(const std::string& path, bool hex) {
+  auto file = std::make_shared<MappedFile>(path);
+  file->WaitIndexed();
+  return fileView(std::move(file), hex);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
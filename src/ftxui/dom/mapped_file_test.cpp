@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <cstdio>      // for remove
+#include <filesystem>  // for temp_directory_path
+#include <fstream>     // for ofstream
+#include <memory>      // for make_shared
+#include <string>      // for string, to_string
+
+#include "ftxui/dom/elements.hpp"     // for fileView, frame, focusPosition
+#include "ftxui/dom/mapped_file.hpp"  // for MappedFile
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+
+class TempFile {
+ public:
+  explicit TempFile(const std::string& content)
+      : path_((std::filesystem::temp_directory_path() /
+               ("ftxui_mapped_file_" + TestName() + "_" +
+                std::to_string(counter_++)))
+                  .string()) {
+    std::ofstream(path_, std::ios::binary) << content;
+  }
+  ~TempFile() { std::remove(path_.c_str()); }
+  const std::string& path() const { return path_; }
+
+ private:
+  // The tests run in parallel processes. The name of the test keeps their
+  // files apart.
+  static std::string TestName() {
+    return ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  }
+
+  static inline int counter_ = 0;
+  std::string path_;
+};
+
+}  // namespace
+
+TEST(MappedFileTest, Missing) {
+  MappedFile file("/this/file/does/not/exist");
+  EXPECT_FALSE(file.is_open());
+  EXPECT_EQ(file.line_count(), 0u);
+}
+
+TEST(MappedFileTest, Empty) {
+  TempFile temp("");
+  MappedFile file(temp.path());
+  file.WaitIndexed();
+  EXPECT_TRUE(file.is_open());
+  EXPECT_TRUE(file.indexed());
+  EXPECT_EQ(file.line_count(), 0u);
+}
+
+TEST(MappedFileTest, Lines) {
+  TempFile temp("a\nbc\n\nd");
+  MappedFile file(temp.path());
+  file.WaitIndexed();
+  ASSERT_EQ(file.line_count(), 4u);
+  EXPECT_EQ(file.Line(0), "a");
+  EXPECT_EQ(file.Line(1), "bc");
+  EXPECT_EQ(file.Line(2), "");
+  EXPECT_EQ(file.Line(3), "d");
+}
+
+TEST(MappedFileTest, ManyLines) {
+  std::string content;
+  for (int i = 0; i < 1'000'000; ++i) {
+    content += std::to_string(i) + "\n";
+  }
+  TempFile temp(content);
+  MappedFile file(temp.path());
+  file.WaitIndexed();
+  ASSERT_EQ(file.line_count(), 1'000'000u);
+  EXPECT_EQ(file.Line(0), "0");
+  EXPECT_EQ(file.Line(63), "63");
+  EXPECT_EQ(file.Line(64), "64");
+  EXPECT_EQ(file.Line(654321), "654321");
+  EXPECT_EQ(file.Line(999'999), "999999");
+}
+
+TEST(MappedFileTest, Render) {
+  std::string content;
+  for (int i = 0; i < 1000; ++i) {
+    content += "line " + std::to_string(i) + "\n";
+  }
+  TempFile temp(content);
+  auto file = std::make_shared<MappedFile>(temp.path());
+  file->WaitIndexed();
+  Screen screen(7, 2);
+  Render(screen, fileView(file) | focusPosition(0, 500) | frame);
+  EXPECT_EQ(screen.ToString(),
+            "line 50\r\n"
+            "line 50");
+}
+
+TEST(MappedFileTest, Hex) {
+  TempFile temp("Hello world\n\x01\xff");
+  Screen screen(78, 1);
+  Render(screen, fileView(temp.path(), /*hex=*/true));
+  EXPECT_EQ(screen.ToString(),
+            "00000000  48 65 6c 6c 6f 20 77 6f  72 6c 64 0a 01 ff        "
+            "|Hello world...|  ");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,15 +1,41 @@
+#include <algorithm>              // for max
+#include <chrono>                 // for steady_clock, nanoseconds
 #include <ftxui/screen/box.hpp>  // for Box
 #include <utility>               // for move
+#include <vector>                // for vector
 
+#include "ftxui/dom/hit_index.hpp"    // for HitIndex
+#include "ftxui/dom/layout_pool.hpp"  // for LayoutPool
 #include "ftxui/dom/node.hpp"
+#include "ftxui/dom/profiler.hpp"     // for Profiler
 #include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/util.hpp"    // for HeapSize
 
 namespace ftxui {
 
+namespace {
+// The opaque boxes hiding the layer being drawn. Per thread, since the
+// subscreens can be drawn from several threads.
+thread_local std::vector<Box> g_occluders;  // NOLINT
+}  // namespace
+
 Node::Node() = default;
 Node::Node(Elements children) : children_(std::move(children)) {}
 Node::~Node() = default;
 
+#if defined(FTXUI_INTRUSIVE_ELEMENT)
+// Called when the last reference is released.
+void Node::Destroy() {
+  if (!from_arena_) {
+    delete this;  // NOLINT
+    return;
+  }
+  void* memory = dynamic_cast<void*>(this);
+  this->~Node();
+  FrameArena::Deallocate(memory);
+}
+#endif
+
 /// @brief Compute how much space an elements needs.
 /// @ingroup dom
 void Node::ComputeRequirement() {
@@ -24,19 +50,334 @@ void Node::SetBox(Box box) {
   box_ = box;
 }
 
-/// @brief Display an element on a ftxui::Screen.
+/// @brief Display an element on a ftxui::Screen. The children outside of the
+/// stencil are skipped.
 /// @ingroup dom
 void Node::Render(Screen& screen) {
+  if (!RenderInParallel(screen)) {
+    for (size_t i = 0; i < children_.size(); ++i) {
+      RenderChild(screen, i);
+    }
+  }
+}
+
+void Node::RenderChild(Screen& screen, size_t index) {
+  Node* child = children_[index].get();
+  if (child->shared_ && index < children_boxes_.size() &&
+      child->box_ != children_boxes_[index]) {
+    child->SetBox(children_boxes_[index]);
+  }
+  RenderChild(screen, child);
+}
+
+/// @brief The bytes of memory held by this node, without its children.
+/// @ingroup dom
+size_t Node::MemoryUsage() const {
+  return allocated_size_ + util::HeapSize(children_) +
+         util::HeapSize(children_boxes_);
+}
+
+/// @brief The part of the box fully overwritten by Render(). By default, the
+/// largest opaque box of the children, within the box of this element.
+/// @ingroup dom
+Box Node::OpaqueBox() {
+  Box opaque{0, -1, 0, -1};
+  int opaque_area = 0;
   for (auto& child : children_) {
-    child->Render(screen);
+    const Box box = Box::Intersection(child->OpaqueBox(), box_);
+    const int area = std::max(0, box.x_max - box.x_min + 1) *
+                     std::max(0, box.y_max - box.y_min + 1);
+    if (area > opaque_area) {
+      opaque = box;
+      opaque_area = area;
+    }
+  }
+  return opaque;
+}
+
+void Node::PushOccluder(const Box& box) {
+  g_occluders.push_back(box);
+}
+
+void Node::PopOccluder() {
+  g_occluders.pop_back();
+}
+
+// Whether |box| is entirely hidden by one of the occluders.
+bool Node::Occluded(const Box& box) {
+  for (const Box& occluder : g_occluders) {
+    if (occluder.x_min <= box.x_min && occluder.x_max >= box.x_max &&
+        occluder.y_min <= box.y_min && occluder.y_max >= box.y_max) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<Box> Node::Occluders(const Box& box) {
+  std::vector<Box> occluders;
+  for (const Box& occluder : g_occluders) {
+    if (occluder.x_min <= box.x_max && occluder.x_max >= box.x_min &&
+        occluder.y_min <= box.y_max && occluder.y_max >= box.y_min) {
+      occluders.push_back(occluder);
+    }
+  }
+  return occluders;
+}
+
+// Draw the children from the threads of the active pool, each into a
+// subscreen of its box. Return false, without drawing anything, when they are
+// too small, or when their boxes overlap.
+bool Node::RenderInParallel(Screen& screen) {
+  LayoutPool* pool = LayoutPool::Current();
+  if (pool == nullptr || !pool->parallel_render() || children_.size() < 2 ||
+      ContainsShared()) {
+    return false;
+  }
+
+  std::vector<Box> boxes(children_.size());
+  int large = 0;
+  for (size_t i = 0; i < children_.size(); ++i) {
+    Node* child = children_[i].get();
+    const Box& box = child->box_;
+    boxes[i] = Box::Intersection(box, screen.stencil);
+    const int width = boxes[i].x_max - boxes[i].x_min + 1;
+    const int height = boxes[i].y_max - boxes[i].y_min + 1;
+    if (width <= 0 || height <= 0) {
+      // RenderChild() would still draw the empty boxes inside the stencil.
+      if (box.x_min <= screen.stencil.x_max &&
+          box.x_max >= screen.stencil.x_min &&
+          box.y_min <= screen.stencil.y_max &&
+          box.y_max >= screen.stencil.y_min) {
+        return false;
+      }
+      continue;
+    }
+    const size_t area = static_cast<size_t>(width) * size_t(height);
+    if (child->Weight() >= pool->min_weight() ||
+        area >= 64 * pool->min_weight()) {  // NOLINT
+      large++;
+    }
+    for (size_t j = 0; j < i; ++j) {
+      const Box overlap = Box::Intersection(boxes[i], boxes[j]);
+      if (overlap.x_min <= overlap.x_max && overlap.y_min <= overlap.y_max) {
+        return false;
+      }
+    }
+  }
+  if (large < 2) {
+    return false;
+  }
+
+  std::vector<Screen> subscreens;
+  subscreens.reserve(children_.size());
+  for (const Box& box : boxes) {
+    subscreens.push_back(screen.Subscreen(box));
+  }
+  HitIndex* const hit_index = HitIndex::Current();
+  pool->ParallelFor(children_.size(), [&](size_t i) {
+    const HitIndex::Scope hit_index_scope(hit_index);
+    if (boxes[i].x_min <= boxes[i].x_max && boxes[i].y_min <= boxes[i].y_max) {
+      children_[i]->Render(subscreens[i]);
+    }
+  });
+  for (const Screen& subscreen : subscreens) {
+    screen.MergeSubscreen(subscreen);
+  }
+  return true;
+}
+
+size_t Node::Weight() {
+  if (weight_ == 0) {
+    weight_ = 1;
+    contains_shared_ = shared_;
+    contains_reflect_ = reflect_;
+    for (auto& child : children_) {
+      weight_ += child->Weight();
+      contains_shared_ = contains_shared_ || child->contains_shared_;
+      contains_reflect_ = contains_reflect_ || child->contains_reflect_;
+    }
+  }
+  return weight_;
+}
+
+bool Node::ContainsShared() {
+  Weight();
+  return contains_shared_;
+}
+
+bool Node::ContainsReflect() {
+  Weight();
+  return contains_reflect_;
+}
+
+// The active pool, when at least two children are large enough to be laid out
+// in parallel.
+LayoutPool* Node::ParallelPool() {
+  LayoutPool* pool = LayoutPool::Current();
+  if (pool == nullptr || !pool->parallel_layout() || children_.size() < 2 ||
+      ContainsShared()) {
+    return nullptr;
+  }
+  int large = 0;
+  for (auto& child : children_) {
+    if (child->Weight() >= pool->min_weight() && ++large == 2) {
+      return pool;
+    }
+  }
+  return nullptr;
+}
+
+void Node::ComputeChildrenRequirement() {
+  if (LayoutPool* pool = ParallelPool()) {
+    pool->ParallelFor(children_.size(),
+                      [this](size_t i) { children_[i]->ComputeRequirement(); });
+    return;
+  }
+  for (auto& child : children_) {
+    if (!child->shared_) {
+      child->ComputeRequirement();
+    }
+  }
+}
+
+void Node::SetChildrenBox(std::span<const Box> boxes) {
+  if (LayoutPool* pool = ParallelPool()) {
+    pool->ParallelFor(children_.size(), [this, boxes](size_t i) {
+      children_[i]->SetBox(boxes[i]);
+    });
+    return;
+  }
+  for (size_t i = 0; i < children_.size(); ++i) {
+    SetChildBox(i, boxes[i]);
   }
 }
 
+void Node::SetChildBox(size_t index, Box box) {
+  Node* child = children_[index].get();
+  if (child->shared_) {
+    // The other uses of the shared child are laid out before this one is
+    // drawn. Its box is restored by RenderChild().
+    children_boxes_.resize(children_.size());
+    children_boxes_[index] = box;
+  }
+  child->SetBox(box);
+}
+
 void Node::Check(Status* status) {
   for (auto& child : children_) {
     child->Check(status);
   }
-  status->need_iteration |= (status->iteration == 0);
+}
+
+/// @brief Compute the requirement of an element, like the first layout pass of
+/// Render(). The caller can use it to size the Screen, and then call Render()
+/// with |measured|, which doesn't compute it again.
+/// @ingroup dom
+void Measure(Node* node) {
+  Node::Status status;
+  node->Check(&status);
+  node->ComputeRequirement();
+}
+
+/// @brief Lay out an element into |box|. A pass computes the requirement, and
+/// assigns the boxes. The passes are repeated only while some node requests it,
+/// up to 20.
+/// @param measured Whether Measure() was called, and the first pass doesn't
+/// need to compute the requirement again.
+/// @return The number of passes.
+/// @ingroup dom
+int ComputeLayout(Node* node, Box box, bool measured) {
+  Node::Status status;
+  if (!measured) {
+    Measure(node);
+  }
+  const int max_iterations = 20;
+  while (true) {
+    node->SetBox(box);
+
+    // Check if the element needs another iteration of the layout algorithm.
+    status.need_iteration = false;
+    status.iteration++;
+    node->Check(&status);
+    if (!status.need_iteration || status.iteration >= max_iterations) {
+      return status.iteration;
+    }
+    node->ComputeRequirement();
+  }
+}
+
+/// @brief Lay out an element into |box|, without drawing it. Its requirement
+/// and its boxes can be inspected, and Render(screen, layout) draws it without
+/// laying it out again.
+/// @ingroup dom
+LayoutResult Layout(Element element, Box box) {
+  LayoutResult layout;
+  layout.iterations = ComputeLayout(element.get(), box);
+  layout.element = std::move(element);
+  layout.box = box;
+  return layout;
+}
+
+/// @brief Display an element laid out by Layout() on a ftxui::Screen. It is
+/// laid out again only when the screen doesn't match its box.
+/// @ingroup dom
+void Render(Screen& screen, const LayoutResult& layout) {
+  Box box;
+  box.x_max = screen.dimx() - 1;
+  box.y_max = screen.dimy() - 1;
+  if (layout.box != box) {
+    ComputeLayout(layout.element.get(), box);
+  }
+  screen.stencil = box;
+  layout.element->Render(screen);
+  screen.ApplyShader();
+}
+
+/// @brief Draw a document taller than any reasonable Screen, like a report of
+/// thousands of lines, without allocating a Screen for all of it. It is laid
+/// out once, |width| columns wide and as tall as it requires. Then, every tile
+/// of |tile_rows| rows is drawn into the same Screen, by moving the document
+/// up, and streamed to |sink|.
+/// @param sink Receives the output, identical to the ToString() of a Screen
+///             holding the whole document, in chunks.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// RenderTiled(report, 120, 256, [](std::string_view chunk) {
+///   std::fwrite(chunk.data(), 1, chunk.size(), stdout);
+/// });
+/// ```
+void RenderTiled(Element element,
+                 int width,
+                 int tile_rows,
+                 const Screen::Sink& sink) {
+  Node* node = element.get();
+  Measure(node);
+  const int height = node->requirement().min_y;
+  width = std::max(width, 0);
+  tile_rows = std::max(tile_rows, 1);
+  ComputeLayout(node, Box{0, width - 1, 0, height - 1}, /*measured=*/true);
+
+  Screen tile(width, std::min(tile_rows, height));
+  for (int y = 0; y < height; y += tile_rows) {
+    const int rows = std::min(tile_rows, height - y);
+    if (rows != tile.dimy()) {
+      tile = Screen(width, rows);
+    }
+    tile.Clear();
+    // The layout doesn't depend on the position: the boxes move up only.
+    node->SetBox(Box{0, width - 1, -y, height - 1 - y});
+    tile.stencil = Box{0, width - 1, 0, rows - 1};
+    node->Render(tile);
+    tile.ApplyShader();
+    if (y != 0) {
+      sink("\r\n");
+    }
+    tile.Print(sink);
+  }
 }
 
 /// @brief Display an element on a ftxui::Screen.
@@ -48,34 +389,56 @@ void Render(Screen& screen, const Element& element) {
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Render(Screen& screen, Node* node) {
+  Render(screen, node, nullptr);
+}
+
+/// @brief Display an element on a ftxui::Screen, measuring how long every step
+/// took.
+/// @param timings Receives the time of every step, added to its values. Can be
+/// nullptr.
+/// @param measured Whether Measure() was already called on |node|.
+/// @ingroup dom
+void Render(Screen& screen,
+            Node* node,
+            RenderTimings* timings,
+            bool measured) {
+  using Clock = std::chrono::steady_clock;
+  Clock::time_point start;
+  // Add the time elapsed since |start| to the |step|, and restart.
+  auto lap = [&](std::chrono::nanoseconds RenderTimings::*step) {
+    if (timings) {
+      const Clock::time_point now = Clock::now();
+      timings->*step += now - start;
+      start = now;
+    }
+  };
+  if (timings) {
+    start = Clock::now();
+  }
+
   Box box;
   box.x_min = 0;
   box.y_min = 0;
   box.x_max = screen.dimx() - 1;
   box.y_max = screen.dimy() - 1;
 
-  Node::Status status;
-  node->Check(&status);
-  const int max_iterations = 20;
-  while (status.need_iteration && status.iteration < max_iterations) {
-    // Step 1: Find what dimension this elements wants to be.
-    node->ComputeRequirement();
-
-    // Step 2: Assign a dimension to the element.
-    node->SetBox(box);
-
-    // Check if the element needs another iteration of the layout algorithm.
-    status.need_iteration = false;
-    status.iteration++;
-    node->Check(&status);
+  // Step 1: Find what dimension this elements wants to be, and assign it.
+  const int iterations = ComputeLayout(node, box, measured);
+  if (Profiler* profiler = Profiler::Current()) {
+    for (int i = 0; i < iterations; ++i) {
+      profiler->AddIteration();
+    }
   }
+  lap(&RenderTimings::layout);
 
-  // Step 3: Draw the element.
+  // Step 2: Draw the element.
   screen.stencil = box;
   node->Render(screen);
+  lap(&RenderTimings::draw);
 
-  // Step 4: Apply shaders
+  // Step 3: Apply shaders
   screen.ApplyShader();
+  lap(&RenderTimings::shaders);
 }
 
 }  // namespace ftxui
@@ -15,7 +15,7 @@ void NodeDecorator::ComputeRequirement() {
 
 void NodeDecorator::SetBox(Box box) {
   Node::SetBox(box);
-  children_[0]->SetBox(box);
+  SetChildBox(0, box);
 }
 
 }  // namespace ftxui
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <string>   // for allocator, string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"     // for text, Element
+#include "ftxui/dom/frame_arena.hpp"  // for FrameArena
+#include "ftxui/dom/node.hpp"         // for Node, MakeNode, Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// Element is either a std::shared_ptr<Node>, or a NodePtr<Node> when
+// FTXUI_INTRUSIVE_ELEMENT is defined. Both must behave the same.
+
+namespace ftxui {
+
+namespace {
+int g_destroyed = 0;  // NOLINT
+
+class Counted : public Node {
+ public:
+  Counted() = default;
+  Counted(const Counted&) = delete;
+  Counted(Counted&&) = delete;
+  Counted& operator=(const Counted&) = delete;
+  Counted& operator=(Counted&&) = delete;
+  ~Counted() override { g_destroyed++; }
+};
+}  // namespace
+
+TEST(NodePtrTest, Null) {
+  Element element;
+  EXPECT_FALSE(element);
+  EXPECT_EQ(element, nullptr);
+  EXPECT_EQ(nullptr, element);
+  element = text("text");
+  EXPECT_TRUE(element);
+  EXPECT_NE(element, nullptr);
+  element = nullptr;
+  EXPECT_FALSE(element);
+}
+
+TEST(NodePtrTest, Lifetime) {
+  g_destroyed = 0;
+  {
+    auto counted = MakeNode<Counted>();
+    Element a = counted;  // Conversion to the base.
+    Element b = a;
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.get(), counted.get());
+    counted.reset();
+    a = nullptr;
+    EXPECT_EQ(g_destroyed, 0);
+    Element c = std::move(b);
+    EXPECT_FALSE(b);  // NOLINT
+    EXPECT_EQ(g_destroyed, 0);
+  }
+  EXPECT_EQ(g_destroyed, 1);
+}
+
+TEST(NodePtrTest, Arena) {
+  g_destroyed = 0;
+  FrameArena arena;
+  Element kept;
+  {
+    const FrameArena::Scope scope(&arena);
+    kept = MakeNode<Counted>();
+    Element other = MakeNode<Counted>();
+  }
+  EXPECT_EQ(g_destroyed, 1);
+  kept = nullptr;
+  EXPECT_EQ(g_destroyed, 2);
+}
+
+TEST(NodePtrTest, Render) {
+  Element element = text("text");
+  Element copy = element;
+  Screen screen(4, 1);
+  Render(screen, copy);
+  EXPECT_EQ(screen.ToString(), "text");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,180 @@
+#include "ftxui/dom/node.hpp"
+#include <gtest/gtest.h>
+#include <atomic>  // for atomic
+#include <string>  // for string, to_string
+#include <thread>  // for thread
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"  // for vbox, paragraph, Element, text, frame, border, color
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// Count the layout passes, and request |extra| more than the first.
+class Counter : public Node {
+ public:
+  explicit Counter(int extra) : extra_(extra) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+    measured++;
+  }
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    arranged++;
+  }
+  void Check(Status* status) override {
+    status->need_iteration |=
+        status->iteration != 0 && status->iteration <= extra_;
+  }
+
+  const Box& box() const { return box_; }
+
+  int measured = 0;
+  int arranged = 0;
+
+ private:
+  int extra_;
+};
+
+}  // namespace
+
+TEST(NodeTest, OnePass) {
+  auto counter = MakeNode<Counter>(0);
+  Element document = vbox({counter});
+  Screen screen(5, 5);
+  Render(screen, document);
+  EXPECT_EQ(counter->measured, 1);
+  EXPECT_EQ(counter->arranged, 1);
+}
+
+TEST(NodeTest, Measured) {
+  auto counter = MakeNode<Counter>(0);
+  Element document = vbox({counter});
+  Measure(document.get());
+  EXPECT_EQ(document->requirement().min_y, 1);
+
+  Screen screen(5, 5);
+  Render(screen, document.get(), nullptr, /*measured=*/true);
+  EXPECT_EQ(counter->measured, 1);
+  EXPECT_EQ(counter->arranged, 1);
+}
+
+TEST(NodeTest, Iterations) {
+  auto counter = MakeNode<Counter>(2);
+  Element document = vbox({counter});
+  Box box;
+  box.x_max = 4;
+  box.y_max = 4;
+  EXPECT_EQ(ComputeLayout(document.get(), box), 3);
+  EXPECT_EQ(counter->measured, 3);
+  EXPECT_EQ(counter->arranged, 3);
+}
+
+TEST(NodeTest, LayoutThenRender) {
+  auto counter = MakeNode<Counter>(0);
+  Box box;
+  box.x_max = 4;
+  box.y_max = 2;
+  const LayoutResult layout = Layout(vbox({counter}), box);
+  EXPECT_EQ(layout.iterations, 1);
+  EXPECT_EQ(layout.dimensions().dimx, 5);
+  EXPECT_EQ(layout.dimensions().dimy, 3);
+  EXPECT_EQ(counter->box().y_max, 0);
+
+  // The screen matches the box: no layout pass.
+  Screen screen(5, 3);
+  Render(screen, layout);
+  EXPECT_EQ(counter->measured, 1);
+  EXPECT_EQ(counter->arranged, 1);
+
+  // It doesn't: laid out again.
+  Screen larger(6, 3);
+  Render(larger, layout);
+  EXPECT_EQ(counter->measured, 2);
+  EXPECT_EQ(counter->arranged, 2);
+}
+
+TEST(NodeTest, ParagraphConverges) {
+  Element document = vbox({paragraph("a b c d e f g h")});
+  Measure(document.get());
+  Screen screen(5, 5);
+  Render(screen, document.get(), nullptr, /*measured=*/true);
+  EXPECT_EQ(screen.ToString(),
+            "a b c\r\n"
+            "d e f\r\n"
+            "g h  \r\n"
+            "     \r\n"
+            "     ");
+}
+
+TEST(NodeTest, RenderTiled) {
+  auto make = [] {
+    Elements rows;
+    for (int i = 0; i < 23; ++i) {
+      rows.push_back(text("row " + std::to_string(i)) | color(Color::Red));
+    }
+    return border(vbox(std::move(rows)));
+  };
+  Screen full(12, 25);
+  Render(full, make());
+
+  for (int tile_rows : {1, 4, 25, 100}) {
+    std::string output;
+    int chunks = 0;
+    RenderTiled(make(), 12, tile_rows, [&](std::string_view chunk) {
+      output += chunk;
+      ++chunks;
+    });
+    EXPECT_EQ(output, full.ToString()) << tile_rows;
+    EXPECT_GE(chunks, (25 + tile_rows - 1) / tile_rows);
+  }
+}
+
+TEST(NodeTest, RenderConcurrently) {
+  // Drawn partly outside of the frame, with colors and long graphemes.
+  auto document = [] {
+    Elements lines;
+    for (int i = 0; i < 40; ++i) {
+      lines.push_back(hbox({
+          text(std::to_string(i)) | color(Color::Red),
+          text(" 👨‍👩‍👧 ") | bgcolor(Color::Blue),
+          paragraph("lorem ipsum dolor sit amet"),
+      }));
+    }
+    return vbox(std::move(lines)) | focusPositionRelative(0.F, 0.5F) | frame |
+           border;
+  };
+  auto draw = [&] {
+    Screen screen(30, 10);
+    Render(screen, document());
+    return screen.ToString();
+  };
+  const std::string expected = draw();
+
+  std::vector<std::thread> threads;
+  std::atomic<int> mismatches = 0;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 50; ++j) {
+        if (draw() != expected) {
+          mismatches++;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(mismatches, 0);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,22 +1,267 @@
-#include <sstream>  // for basic_istream, stringstream
-#include <string>   // for string, allocator, getline
-#include <utility>  // for move
+#include <algorithm>  // for max, min
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <memory>     // for shared_ptr, make_shared
+#include <sstream>    // for basic_istream, stringstream
+#include <string>     // for string, allocator, getline
+#include <utility>    // for move
+#include <vector>     // for vector
 
-#include "ftxui/dom/elements.hpp"  // for flexbox, Element, text, Elements, operator|, xflex, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
-#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::JustifyContent, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::FlexEnd, FlexboxConfig::JustifyContent::SpaceBetween
+#include "ftxui/dom/elements.hpp"  // for Element, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
+#include "ftxui/dom/node.hpp"         // for Node, Node::Status
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for Glyphs
 
 namespace ftxui {
 
 namespace {
-Elements Split(const std::string& the_text) {
-  Elements output;
+
+// The words of a paragraph, segmented into the glyphs of their cells.
+// Fullwidth glyphs are followed by an empty cell, reserving their space.
+struct Words {
+  std::string text;
+  std::vector<Glyph> cells;
+  std::vector<int> begin;  // The word |i| is the cells [begin[i], begin[i+1]).
+
+  int size() const { return static_cast<int>(begin.size()) - 1; }
+  int Width(int i) const { return begin[i + 1] - begin[i]; }
+};
+
+std::shared_ptr<const Words> Segment(const std::string& the_text) {
+  auto words = std::make_shared<Words>();
+  words->text = the_text;
+  words->cells.reserve(the_text.size());
   std::stringstream ss(the_text);
   std::string word;
   while (std::getline(ss, word, ' ')) {
-    output.push_back(text(word));
+    words->begin.push_back(static_cast<int>(words->cells.size()));
+    for (const GlyphView& glyph : Glyphs(word)) {
+      words->cells.emplace_back(glyph.text);
+      if (glyph.width == 2) {
+        words->cells.emplace_back();
+      }
+    }
+  }
+  words->begin.push_back(static_cast<int>(words->cells.size()));
+  return words;
+}
+
+// The paragraphs are usually drawn again on the next frames. The last ones
+// segmented by the current thread are kept.
+std::shared_ptr<const Words> SegmentCached(const std::string& the_text) {
+  constexpr size_t kCacheSize = 8;
+  thread_local std::array<std::shared_ptr<const Words>, kCacheSize> cache;
+  thread_local size_t next = 0;
+  for (const auto& words : cache) {
+    if (words && words->text == the_text) {
+      return words;
+    }
   }
-  return output;
+  auto words = Segment(the_text);
+  cache[next] = words;
+  next = (next + 1) % kCacheSize;
+  return words;
 }
+
+enum class Align { Left, Right, Center, Justify };
+
+// The position of the words on their lines, for a given width.
+struct WordLayout {
+  int width = -1;
+  bool for_requirement = false;
+
+  std::vector<int> lines;  // The first item of every line.
+  std::vector<int> x;
+  std::vector<int> dim;
+  int extent = 0;  // The width used by the longest line.
+};
+
+// Lay out the words with one space in between, wrapping on the next line when
+// full. This matches a flexbox of the words, aligned with |align|.
+class Paragraph : public Node {
+ public:
+  Paragraph(std::shared_ptr<const Words> words, Align align)
+      : words_(std::move(words)), align_(align) {
+    requirement_.flex_grow_x = 1;
+  }
+
+  void ComputeRequirement() override {
+    const WordLayout& layout = Compute(asked_, true);
+    requirement_.min_x = layout.extent;
+    requirement_.min_y = static_cast<int>(layout.lines.size()) - 1;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    const int asked_previous = asked_;
+    asked_ = std::min(asked_, box.x_max - box.x_min + 1);
+    need_iteration_ = (asked_ != asked_previous);
+
+    // Like flexbox, iterate again while the lines are clipped.
+    const WordLayout& layout = Compute(box.x_max - box.x_min + 1, false);
+    need_iteration_ |=
+        static_cast<int>(layout.lines.size()) - 1 > box.y_max - box.y_min + 1;
+  }
+
+  void Check(Status* status) override {
+    if (status->iteration == 0) {
+      asked_ = 6000;  // NOLINT
+      need_iteration_ = true;
+    }
+    status->need_iteration |= need_iteration_;
+  }
+
+  void Render(Screen& screen) override {
+    const WordLayout& layout = Compute(box_.x_max - box_.x_min + 1, false);
+    // Only the lines visible are drawn.
+    const int lines = static_cast<int>(layout.lines.size()) - 1;
+    const int line_min =
+        std::max(box_.y_min, screen.stencil.y_min) - box_.y_min;
+    const int line_max =
+        std::min({box_.y_max, screen.stencil.y_max, box_.y_min + lines - 1}) -
+        box_.y_min;
+    for (int line = line_min; line <= line_max; ++line) {
+      const int y = box_.y_min + line;
+      const int end = std::min(layout.lines[line + 1], words_->size());
+      for (int i = layout.lines[line]; i < end; ++i) {
+        const int x_min = box_.x_min + layout.x[i];
+        const int x_max = std::min(box_.x_max, x_min + layout.dim[i] - 1);
+        int x = std::max(x_min, box_.x_min);
+        for (int cell = words_->begin[i] + (x - x_min);
+             cell < words_->begin[i + 1] && x <= x_max; ++cell, ++x) {
+          screen.PixelAt(x, y).character = words_->cells[cell];
+        }
+      }
+    }
+  }
+
+ private:
+  // A justified paragraph ends with an empty flexible item, filling its last
+  // line.
+  int Items() const {
+    return words_->size() + (align_ == Align::Justify ? 1 : 0);
+  }
+  int Width(int i) const { return i < words_->size() ? words_->Width(i) : 0; }
+  bool Grow(int i) const { return i >= words_->size(); }
+
+  // The layouts for the last widths are kept, as the successive frames and
+  // iterations mostly use the same ones.
+  const WordLayout& Compute(int width, bool for_requirement) {
+    for (const WordLayout& layout : layouts_) {
+      if (layout.width == width && layout.for_requirement == for_requirement) {
+        return layout;
+      }
+    }
+    WordLayout& layout = layouts_[layouts_next_];
+    layouts_next_ = (layouts_next_ + 1) % layouts_.size();
+    layout.width = width;
+    layout.for_requirement = for_requirement;
+    ComputeLines(layout);
+    ComputePositions(layout);
+    return layout;
+  }
+
+  void ComputeLines(WordLayout& layout) const {
+    layout.lines.clear();
+    layout.lines.push_back(0);
+    int x = 0;
+    for (int i = 0; i < Items(); ++i) {
+      // Does it fit the end of the line? No? Then we start a new one:
+      if (x + Width(i) > layout.width) {
+        x = 0;
+        if (layout.lines.back() != i) {
+          layout.lines.push_back(i);
+        }
+      }
+      x += Width(i) + 1;
+    }
+    layout.lines.push_back(Items());
+    if (Items() == 0) {
+      layout.lines.pop_back();
+    }
+  }
+
+  // NOLINTNEXTLINE(readability-function-cognitive-complexity)
+  void ComputePositions(WordLayout& layout) const {
+    layout.x.resize(Items());
+    layout.dim.resize(Items());
+    layout.extent = 0;
+    for (size_t line = 0; line + 1 < layout.lines.size(); ++line) {
+      const int begin = layout.lines[line];
+      const int end = layout.lines[line + 1];
+
+      // Only a single word can be wider than the line. It is truncated.
+      int size = 0;
+      bool grow = false;
+      for (int i = begin; i < end; ++i) {
+        size += Width(i);
+        grow |= !layout.for_requirement && Grow(i);
+      }
+      const int target = layout.width - (end - begin - 1);
+      int x = 0;
+      for (int i = begin; i < end; ++i) {
+        int dim = Width(i);
+        if (size > target) {
+          dim = dim == 0 ? 0 : target;
+        } else if (grow && Grow(i)) {
+          dim += target - size;
+        }
+        layout.x[i] = x;
+        layout.dim[i] = dim;
+        x += dim + 1;
+      }
+
+      const int last = end - 1;
+      const int extent = layout.x[last] + layout.dim[last];
+      layout.extent = line == 0 ? extent : std::max(layout.extent, extent);
+      if (!layout.for_requirement) {
+        Justify(layout, begin, end);
+      }
+    }
+  }
+
+  void Justify(WordLayout& layout, int begin, int end) const {
+    const int last = end - 1;
+    int remaining_space = layout.width - layout.x[last] - layout.dim[last];
+    switch (align_) {
+      case Align::Left:
+        break;
+
+      case Align::Right: {
+        for (int i = begin; i < end; ++i) {
+          layout.x[i] += remaining_space;
+        }
+        break;
+      }
+
+      case Align::Center: {
+        for (int i = begin; i < end; ++i) {
+          layout.x[i] += remaining_space / 2;
+        }
+        break;
+      }
+
+      case Align::Justify: {
+        for (int i = end - begin - 1; i >= 1; --i) {
+          layout.x[begin + i] += remaining_space;
+          remaining_space = remaining_space * (i - 1) / i;
+        }
+        break;
+      }
+    }
+  }
+
+  std::shared_ptr<const Words> words_;
+  const Align align_;
+  std::array<WordLayout, 4> layouts_;
+  size_t layouts_next_ = 0;
+  int asked_ = 6000;  // NOLINT
+  bool need_iteration_ = true;
+};
+
 }  // namespace
 
 /// @brief Return an element drawing the paragraph on multiple lines.
@@ -31,8 +276,7 @@ Element paragraph(const std::string& the_text) {
 /// @ingroup dom
 /// @see flexbox.
 Element paragraphAlignLeft(const std::string& the_text) {
-  static const auto config = FlexboxConfig().SetGap(1, 0);
-  return flexbox(Split(the_text), config);
+  return MakeNode<Paragraph>(SegmentCached(the_text), Align::Left);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
@@ -40,9 +284,7 @@ Element paragraphAlignLeft(const std::string& the_text) {
 /// @ingroup dom
 /// @see flexbox.
 Element paragraphAlignRight(const std::string& the_text) {
-  static const auto config =
-      FlexboxConfig().SetGap(1, 0).Set(FlexboxConfig::JustifyContent::FlexEnd);
-  return flexbox(Split(the_text), config);
+  return MakeNode<Paragraph>(SegmentCached(the_text), Align::Right);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
@@ -50,9 +292,7 @@ Element paragraphAlignRight(const std::string& the_text) {
 /// @ingroup dom
 /// @see flexbox.
 Element paragraphAlignCenter(const std::string& the_text) {
-  static const auto config =
-      FlexboxConfig().SetGap(1, 0).Set(FlexboxConfig::JustifyContent::Center);
-  return flexbox(Split(the_text), config);
+  return MakeNode<Paragraph>(SegmentCached(the_text), Align::Center);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned
@@ -61,11 +301,7 @@ Element paragraphAlignCenter(const std::string& the_text) {
 /// @ingroup dom
 /// @see flexbox.
 Element paragraphAlignJustify(const std::string& the_text) {
-  static const auto config = FlexboxConfig().SetGap(1, 0).Set(
-      FlexboxConfig::JustifyContent::SpaceBetween);
-  Elements words = Split(the_text);
-  words.push_back(text("") | xflex);
-  return flexbox(std::move(words), config);
+  return MakeNode<Paragraph>(SegmentCached(the_text), Align::Justify);
 }
 
 }  // namespace ftxui
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator, string
+
+#include "ftxui/dom/elements.hpp"  // for paragraph, paragraphAlignRight, paragraphAlignCenter, paragraphAlignJustify, hbox, text, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+std::string Draw(const Element& element, int width, int height) {
+  Screen screen(width, height);
+  Render(screen, element);
+  return screen.ToString();
+}
+}  // namespace
+
+TEST(ParagraphTest, Left) {
+  EXPECT_EQ(Draw(paragraph("aa bbb c dd"), 7, 3),
+            "aa bbb \r\n"
+            "c dd   \r\n"
+            "       ");
+}
+
+TEST(ParagraphTest, Right) {
+  EXPECT_EQ(Draw(paragraphAlignRight("aa bbb c dd"), 7, 2),
+            " aa bbb\r\n"
+            "   c dd");
+}
+
+TEST(ParagraphTest, Center) {
+  EXPECT_EQ(Draw(paragraphAlignCenter("aa bbb c dd"), 8, 2),
+            "aa bbb c\r\n"
+            "   dd   ");
+}
+
+TEST(ParagraphTest, Justify) {
+  EXPECT_EQ(Draw(paragraphAlignJustify("a b c d e"), 8, 2),
+            "a b c  d\r\n"
+            "e       ");
+}
+
+TEST(ParagraphTest, LongWordIsTruncated) {
+  EXPECT_EQ(Draw(paragraph("a abcdefgh b"), 4, 3),
+            "a   \r\n"
+            "abcd\r\n"
+            "b   ");
+}
+
+TEST(ParagraphTest, Requirement) {
+  // The paragraph takes the width given, and the lines it needs.
+  auto document = hbox({paragraph("aa bb cc"), text("|")});
+  EXPECT_EQ(Draw(document, 6, 3),
+            "aa bb|\r\n"
+            "cc    \r\n"
+            "      ");
+}
+
+TEST(ParagraphTest, RenderAgain) {
+  // The layouts kept from the previous frames must match the new size.
+  auto document = paragraph("aa bb cc dd");
+  for (int width : {11, 5, 5, 8, 11}) {
+    EXPECT_EQ(Draw(document, width, 3),
+              Draw(paragraph("aa bb cc dd"), width, 3));
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,256 @@
+#include "ftxui/dom/profiler.hpp"
+
+#include <algorithm>  // for find_if, max, min, sort
+#include <cstdlib>    // for free
+#include <memory>     // for make_shared
+#include <mutex>      // for mutex, lock_guard
+#include <string>     // for string, to_string
+#include <typeinfo>   // for type_info
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#if defined(__GNUG__)
+#include <cxxabi.h>  // for __cxa_demangle
+#endif
+
+#include "ftxui/dom/elements.hpp"  // for Element, text, gridbox, window, debugOverlay
+#include "ftxui/dom/node.hpp"      // for Node
+#include "ftxui/dom/tree_helper.hpp"  // for Describe, TypeName
+
+namespace ftxui {
+
+namespace {
+
+thread_local Profiler* g_current = nullptr;  // NOLINT
+
+// The names of the types of node, indexed by their identifier.
+struct Types {
+  std::mutex mutex;
+  std::vector<std::string> names;
+};
+
+Types& GetTypes() {
+  static Types types;
+  return types;
+}
+
+// "ftxui::(anonymous namespace)::Border" becomes "Border".
+std::string ShortName(const char* name) {
+  std::string out = name;
+#if defined(__GNUG__)
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status == 0 && demangled) {
+    out = demangled;
+  }
+  std::free(demangled);  // NOLINT
+#endif
+  const size_t end = out.find('<');
+  const size_t start = out.rfind("::", end);
+  if (start != std::string::npos) {
+    out.erase(0, start + 2);
+  }
+  return out;
+}
+
+std::string Microseconds(std::chrono::nanoseconds time) {
+  return std::to_string(time.count() / 1000) + "µs";  // NOLINT
+}
+
+}  // namespace
+
+namespace tree_helper {
+
+std::string TypeName(const std::type_info& type) {
+  std::string name = ShortName(type.name());
+  const std::string profiled = "Profiled<";
+  if (name.rfind(profiled, 0) == 0 && name.back() == '>') {
+    name = ShortName(
+        name.substr(profiled.size(), name.size() - profiled.size() - 1)
+            .c_str());
+  }
+  return name;
+}
+
+}  // namespace tree_helper
+
+/// @brief The number of calls, of every phase.
+int ProfileReport::Entry::calls() const {
+  int calls = 0;
+  for (const int c : count) {
+    calls += c;
+  }
+  return calls;
+}
+
+/// @brief The time spent in every phase, excluding the children.
+std::chrono::nanoseconds ProfileReport::Entry::total() const {
+  std::chrono::nanoseconds total = {};
+  for (const auto t : time) {
+    total += t;
+  }
+  return total;
+}
+
+/// @brief The time spent by every node.
+std::chrono::nanoseconds ProfileReport::total() const {
+  std::chrono::nanoseconds total = {};
+  for (const Entry& entry : entries) {
+    total += entry.total();
+  }
+  return total;
+}
+
+/// @brief Whether FTXUI was built with the FTXUI_PROFILE option. Otherwise,
+/// the nodes are never measured.
+bool Profiler::Enabled() {
+#if defined(FTXUI_PROFILE)
+  return true;
+#else
+  return false;
+#endif
+}
+
+Profiler::Scope::Scope(Profiler* profiler) : previous_(g_current) {
+  g_current = profiler;
+}
+
+Profiler::Scope::~Scope() {
+  g_current = previous_;
+}
+
+/// @brief The profiler active on the current thread, or nullptr.
+Profiler* Profiler::Current() {
+  return g_current;
+}
+
+/// @brief What was measured since the previous call, sorted by decreasing
+/// time.
+ProfileReport Profiler::TakeReport() {
+  ProfileReport report;
+  report.iterations = iterations_;
+  {
+    Types& types = GetTypes();
+    const std::lock_guard<std::mutex> lock(types.mutex);
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      if (entries_[i].calls() != 0) {
+        report.entries.push_back(std::move(entries_[i]));
+        report.entries.back().name = types.names[i];
+      }
+    }
+  }
+  std::sort(report.entries.begin(), report.entries.end(),
+            [](const auto& a, const auto& b) { return a.total() > b.total(); });
+  entries_.clear();
+  iterations_ = 0;
+  return report;
+}
+
+/// @brief The identifier of a type of node.
+/// @param name its std::type_info::name().
+size_t Profiler::RegisterType(const char* name) {
+  Types& types = GetTypes();
+  const std::lock_guard<std::mutex> lock(types.mutex);
+  types.names.push_back(ShortName(name));
+  return types.names.size() - 1;
+}
+
+Profiler::Measure::Measure(size_t type, Phase phase) : profiler_(g_current) {
+  if (!profiler_) {
+    return;
+  }
+  type_ = type;
+  phase_ = phase;
+  parent_ = profiler_->active_;
+  profiler_->active_ = this;
+  start_ = std::chrono::steady_clock::now();
+}
+
+Profiler::Measure::~Measure() {
+  if (!profiler_) {
+    return;
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start_;
+  auto& entries = profiler_->entries_;
+  if (entries.size() <= type_) {
+    entries.resize(type_ + 1);
+  }
+  const auto phase = static_cast<size_t>(phase_);
+  entries[type_].count[phase]++;
+  entries[type_].time[phase] +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed) - children_;
+  profiler_->active_ = parent_;
+  if (parent_) {
+    parent_->children_ +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+  }
+}
+
+/// @brief Count the nodes of a tree, by type, with the memory they hold, and
+/// find its largest subtrees. A subtree made mostly of a single child, like a
+/// border around a frame, is skipped in favor of that child.
+/// @param root The root of the tree, like the Element of a frame.
+/// @param largest The number of subtrees reported.
+/// @ingroup dom
+TreeReport DescribeTree(const Node& root, size_t largest) {
+  return tree_helper::Describe(
+      root, largest,
+      [](const Node& node, const auto& f) {
+        for (size_t i = 0; i < node.children_.size(); ++i) {
+          if (node.children_[i]) {
+            f(i, *node.children_[i]);
+          }
+        }
+      },
+      [](const Node& node) { return node.MemoryUsage(); });
+}
+
+/// @brief Draw the types of node taking the most time in |report|, with their
+/// number of calls, and the time spent laying them out and drawing them. For
+/// instance, on top of the frame it measured.
+/// @param report the report, like ScreenInteractive::FrameProfile().
+/// @param rows the number of types of node displayed.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// auto renderer = Renderer([&] {
+///   return dbox({
+///     main->Render(),
+///     debugOverlay(screen.FrameProfile()) | align_right,
+///   });
+/// });
+/// ```
+Element debugOverlay(const ProfileReport& report, int rows) {
+  using Phase = ProfileReport::Phase;
+  std::vector<Elements> lines = {{
+      text("Node "),
+      text("Calls ") | align_right,
+      text("Layout ") | align_right,
+      text("Render") | align_right,
+  }};
+  const size_t count =
+      std::min(report.entries.size(), static_cast<size_t>(std::max(0, rows)));
+  for (size_t i = 0; i < count; ++i) {
+    const ProfileReport::Entry& entry = report.entries[i];
+    const auto layout =
+        entry.time[size_t(Phase::ComputeRequirement)] +
+        entry.time[size_t(Phase::SetBox)] + entry.time[size_t(Phase::Check)];
+    lines.push_back({
+        text(entry.name + " "),
+        text(std::to_string(entry.calls()) + " ") | align_right,
+        text(Microseconds(layout) + " ") | align_right,
+        text(Microseconds(entry.time[size_t(Phase::Render)])) | align_right,
+    });
+  }
+  const std::string title = "Profile: " + Microseconds(report.total()) + ", " +
+                            std::to_string(report.iterations) + " iterations";
+  return window(text(title), gridbox(std::move(lines))) | clear_under;
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
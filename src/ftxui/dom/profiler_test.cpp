@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <algorithm>  // for find_if
+#include <chrono>     // for microseconds
+#include <string>     // for string
+
+#include "ftxui/dom/elements.hpp"  // for text, vbox, hbox, border, debugOverlay
+#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/profiler.hpp"  // for Profiler, ProfileReport, DescribeTree
+#include "ftxui/screen/glyph.hpp"   // for Glyph
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+const ProfileReport::Entry* Find(const ProfileReport& report,
+                                 const std::string& name) {
+  auto it = std::find_if(report.entries.begin(), report.entries.end(),
+                         [&](const auto& entry) { return entry.name == name; });
+  return it == report.entries.end() ? nullptr : &*it;
+}
+
+}  // namespace
+
+TEST(ProfilerTest, Report) {
+  auto document = vbox({
+      text("a") | border,
+      text("b") | border,
+      text("c"),
+  });
+
+  Profiler profiler;
+  {
+    const Profiler::Scope scope(&profiler);
+    EXPECT_EQ(Profiler::Current(), &profiler);
+    Screen screen(10, 10);
+    Render(screen, document);
+  }
+  EXPECT_EQ(Profiler::Current(), nullptr);
+
+  const ProfileReport report = profiler.TakeReport();
+  EXPECT_EQ(report.iterations, 1);
+  if (!Profiler::Enabled()) {
+    EXPECT_TRUE(report.entries.empty());
+    return;
+  }
+
+  using Phase = ProfileReport::Phase;
+  const ProfileReport::Entry* text = Find(report, "Text");
+  ASSERT_NE(text, nullptr);
+  EXPECT_EQ(text->count[size_t(Phase::ComputeRequirement)], 3);
+  EXPECT_EQ(text->count[size_t(Phase::SetBox)], 3);
+  EXPECT_EQ(text->count[size_t(Phase::Render)], 3);
+  const ProfileReport::Entry* border = Find(report, "Border");
+  ASSERT_NE(border, nullptr);
+  EXPECT_EQ(border->count[size_t(Phase::Render)], 2);
+  ASSERT_NE(Find(report, "VBox"), nullptr);
+
+  // The entries are sorted, and the report starts over.
+  for (size_t i = 1; i < report.entries.size(); ++i) {
+    EXPECT_GE(report.entries[i - 1].total(), report.entries[i].total());
+  }
+  EXPECT_TRUE(profiler.TakeReport().entries.empty());
+}
+
+TEST(ProfilerTest, NotActive) {
+  Profiler profiler;
+  Screen screen(10, 1);
+  Render(screen, text("a"));
+  const ProfileReport report = profiler.TakeReport();
+  EXPECT_TRUE(report.entries.empty());
+  EXPECT_EQ(report.iterations, 0);
+}
+
+TEST(ProfilerTest, DebugOverlay) {
+  ProfileReport report;
+  report.iterations = 2;
+  report.entries.resize(2);
+  report.entries[0].name = "Text";
+  report.entries[0].count = {3, 3, 3, 6};
+  report.entries[0].time[0] = std::chrono::microseconds(12);
+  report.entries[0].time[2] = std::chrono::microseconds(30);
+  report.entries[1].name = "VBox";
+  report.entries[1].count = {1, 1, 1, 2};
+
+  Screen screen(29, 4);
+  Render(screen, debugOverlay(report, 1));
+  EXPECT_EQ(screen.ToString(),
+            "╭Profile: 42µs, 2 iterations╮\r\n"
+            "│Node Calls Layout Render   │\r\n"
+            "│Text    15   12µs   30µs   │\r\n"
+            "╰───────────────────────────╯");
+}
+
+TEST(ProfilerTest, DescribeTree) {
+  auto document = vbox({
+      hbox({text("a"), text("b"), text("c"), text("d")}) | border,
+      text("e"),
+  });
+
+  const TreeReport report = DescribeTree(*document, 2);
+  EXPECT_EQ(report.nodes, 8u);
+  EXPECT_EQ(report.depth, 4);
+  ASSERT_EQ(report.types.size(), 4u);
+  EXPECT_EQ(report.types[0].name, "Text");
+  EXPECT_EQ(report.types[0].count, 5u);
+  EXPECT_EQ(report.types[1].name, "Border");
+  EXPECT_EQ(report.types[1].count, 1u);
+
+  // The border, wrapping the hbox, and the leaves are skipped.
+  ASSERT_EQ(report.largest.size(), 2u);
+  EXPECT_EQ(report.largest[0].path, "VBox");
+  EXPECT_EQ(report.largest[0].nodes, 8u);
+  EXPECT_EQ(report.largest[0].depth, 4);
+  EXPECT_EQ(report.largest[1].path, "VBox > Border[0] > HBox[0]");
+  EXPECT_EQ(report.largest[1].nodes, 5u);
+  EXPECT_EQ(report.largest[1].depth, 2);
+}
+
+TEST(ProfilerTest, DescribeTreeMemory) {
+  const std::string long_text(200, 'a');
+  auto document = vbox({text("a"), text(long_text), text("b")});
+
+  const TreeReport report = DescribeTree(*document);
+  ASSERT_EQ(report.types.size(), 2u);
+  const TreeReport::Type& texts = report.types[0];
+  const TreeReport::Type& vbox = report.types[1];
+  EXPECT_EQ(texts.name, "Text");
+  EXPECT_EQ(vbox.name, "VBox");
+  // The long text holds its cells.
+  EXPECT_GE(texts.bytes, long_text.size() * sizeof(Glyph));
+  EXPECT_GE(vbox.bytes, sizeof(Node) + 3 * sizeof(Element));
+  EXPECT_EQ(report.bytes, texts.bytes + vbox.bytes);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
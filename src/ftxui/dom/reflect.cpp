@@ -3,6 +3,7 @@
 #include <vector>   // for __alloc_traits<>::value_type
 
 #include "ftxui/dom/elements.hpp"     // for Element, unpack, Decorator, reflect
+#include "ftxui/dom/hit_index.hpp"    // for HitIndex
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -14,21 +15,28 @@ namespace ftxui {
 class Reflect : public Node {
  public:
   Reflect(Element child, Box& box)
-      : Node(unpack(std::move(child))), reflected_box_(box) {}
+      : Node(unpack(std::move(child))), reflected_box_(box) {
+    reflect_ = true;
+  }
 
-  void ComputeRequirement() final {
+  void ComputeRequirement() override {
     Node::ComputeRequirement();
     requirement_ = children_[0]->requirement();
   }
 
-  void SetBox(Box box) final {
-    reflected_box_ = box;
+  void SetBox(Box box) override {
+    // Until drawn, the element isn't visible. It is not drawn when it is
+    // outside of the stencil.
+    reflected_box_ = Box{0, -1, 0, -1};
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    SetChildBox(0, box);
   }
 
-  void Render(Screen& screen) final {
-    reflected_box_ = Box::Intersection(screen.stencil, reflected_box_);
+  void Render(Screen& screen) override {
+    reflected_box_ = Box::Intersection(screen.stencil, box_);
+    if (HitIndex* index = HitIndex::Current()) {
+      index->Add(reflected_box_);
+    }
     return Node::Render(screen);
   }
 
@@ -38,7 +46,7 @@ class Reflect : public Node {
 
 Decorator reflect(Box& box) {
   return [&](Element child) -> Element {
-    return std::make_shared<Reflect>(std::move(child), box);
+    return MakeNode<Reflect>(std::move(child), box);
   };
 }
 
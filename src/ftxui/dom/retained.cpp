@@ -0,0 +1,110 @@
+#include <cstddef>  // for size_t
+#include <memory>   // for make_shared
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"        // for Element, Decorator, retained, retainedVersion
+#include "ftxui/dom/node.hpp"            // for Node, Node::Status
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/util/ref.hpp"            // for ConstRef
+
+namespace ftxui {
+
+namespace {
+
+// Cache the layout of the child. Once the layout of the subtree converged, the
+// next layout passes reuse its Requirement, and skip the subtree as long as it
+// is given the same Box. The cache is invalidated when the version changes.
+class Retained : public NodeDecorator {
+ public:
+  Retained(Element child, ConstRef<size_t> version)
+      : NodeDecorator(std::move(child)),
+        version_(std::move(version)),
+        cached_version_(*version_) {}
+
+  void ComputeRequirement() override {
+    if (*version_ != cached_version_) {
+      cached_version_ = *version_;
+      cached_ = false;
+    }
+    requirement_from_cache_ = cached_;
+    if (!cached_) {
+      NodeDecorator::ComputeRequirement();
+    }
+  }
+
+  void SetBox(Box box) override {
+    if (cached_ && box == box_) {
+      return;
+    }
+    // The cached requirement might depend on the previous box. Compute it
+    // again during the next iteration.
+    stale_ |= requirement_from_cache_;
+    cached_ = false;
+    NodeDecorator::SetBox(box);
+  }
+
+  void Check(Status* status) override {
+    if (cached_) {
+      return;
+    }
+
+    const bool parent_need_iteration = status->need_iteration;
+    status->need_iteration = false;
+    children_[0]->Check(status);
+    const bool need_iteration = status->need_iteration || stale_;
+    stale_ = false;
+
+    // The layout of the subtree converged.
+    if (status->iteration != 0 && !need_iteration) {
+      cached_ = true;
+    }
+
+    status->need_iteration = parent_need_iteration || need_iteration;
+  }
+
+ private:
+  ConstRef<size_t> version_;
+  size_t cached_version_;
+  bool cached_ = false;
+  bool requirement_from_cache_ = false;
+  bool stale_ = false;
+};
+
+}  // namespace
+
+/// @brief Cache the layout of an element, across layout passes and frames.
+/// This is useful for large elements kept alive by the application, and
+/// inserted in every frame. When given the same Box, their layout is reused
+/// instead of being computed again.
+/// @param child The element whose layout is cached. Its content must not
+///              change, unless the version changes.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element help = BuildHelpTable() | retained;
+/// auto renderer = Renderer([&] { return vbox({ header(), help }); });
+/// ```
+Element retained(Element child) {
+  return MakeNode<Retained>(std::move(child), size_t(0));
+}
+
+/// @brief Cache the layout of an element. The cache is invalidated when
+/// |version| changes.
+/// @param version A counter incremented when the content of the element
+///                changes.
+/// @ingroup dom
+/// @see retained
+Decorator retainedVersion(ConstRef<size_t> version) {
+  return [version](Element child) {
+    return MakeNode<Retained>(std::move(child), version);
+  };
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
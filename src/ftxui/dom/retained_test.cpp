@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <cstddef>  // for size_t
+#include <string>   // for allocator, string
+
+#include "ftxui/dom/elements.hpp"  // for retained, retainedVersion, text, vbox, paragraph, Element
+#include "ftxui/dom/node.hpp"      // for Node, Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// A text element counting its layout passes.
+class Counter : public Node {
+ public:
+  explicit Counter(int* count) : Node({text("counter")}), count_(count) {}
+
+  void ComputeRequirement() override {
+    (*count_)++;
+    children_[0]->ComputeRequirement();
+    requirement_ = children_[0]->requirement();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    children_[0]->SetBox(box);
+  }
+
+ private:
+  int* count_;
+};
+
+std::string Draw(const Element& element, int width = 10, int height = 2) {
+  Screen screen(width, height);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(RetainedTest, Basic) {
+  int count = 0;
+  Element element = MakeNode<Counter>(&count) | retained;
+  EXPECT_EQ(Draw(element), "counter   \r\n          ");
+  EXPECT_EQ(count, 1);
+
+  // Same box: the layout is reused.
+  EXPECT_EQ(Draw(element), "counter   \r\n          ");
+  EXPECT_EQ(count, 1);
+
+  // Different box: the layout is computed again.
+  EXPECT_EQ(Draw(vbox({text("-"), element})), "-         \r\ncounter   ");
+  EXPECT_EQ(count, 2);
+}
+
+TEST(RetainedTest, Version) {
+  int count = 0;
+  size_t version = 0;
+  Element element = MakeNode<Counter>(&count) | retainedVersion(&version);
+  Draw(element);
+  Draw(element);
+  EXPECT_EQ(count, 1);
+  version++;
+  Draw(element);
+  EXPECT_EQ(count, 2);
+  Draw(element);
+  EXPECT_EQ(count, 2);
+}
+
+TEST(RetainedTest, WithinIterations) {
+  // The paragraph needs several layout iterations. The retained sibling is
+  // computed only once.
+  int count = 0;
+  Element element = vbox({
+      MakeNode<Counter>(&count) | retained,
+      paragraph("a b c d e f g h i j"),
+  });
+  EXPECT_EQ(Draw(element, 10, 3), "counter   \r\na b c d e \r\nf g h i j ");
+  EXPECT_EQ(count, 1);
+}
+
+TEST(RetainedTest, Paragraph) {
+  // The retained element requires several iterations itself.
+  Element element = paragraph("a b c d e f g h i j") | retained;
+  const std::string expected = "a b c d e \r\nf g h i j ";
+  EXPECT_EQ(Draw(element), expected);
+  EXPECT_EQ(Draw(element), expected);
+  EXPECT_EQ(Draw(element, 6, 4), "a b c \r\nd e f \r\ng h i \r\nj     ");
+  EXPECT_EQ(Draw(element), expected);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
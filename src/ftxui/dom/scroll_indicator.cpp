@@ -18,6 +18,7 @@ namespace ftxui {
 /// @ingroup dom
 Element vscroll_indicator(Element child) {
   class Impl : public NodeDecorator {
+   public:
     using NodeDecorator::NodeDecorator;
 
     void ComputeRequirement() override {
@@ -31,10 +32,10 @@ Element vscroll_indicator(Element child) {
       if (box_.x_min > box_.x_max) {
         box_.x_max--;
       }
-      children_[0]->SetBox(box);
+      SetChildBox(0, box);
     }
 
-    void Render(Screen& screen) final {
+    void Render(Screen& screen) override {
       NodeDecorator::Render(screen);
 
       const Box& stencil = screen.stencil;
@@ -68,7 +69,7 @@ Element vscroll_indicator(Element child) {
       }
     };
   };
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
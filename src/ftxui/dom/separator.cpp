@@ -8,27 +8,28 @@
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
 
 namespace ftxui {
 
 namespace {
-using Charset = std::array<std::string, 2>;  // NOLINT
-using Charsets = std::array<Charset, 5>;     // NOLINT
-// NOLINTNEXTLINE
-const Charsets charsets = {
-    Charset{"│", "─"},  //
-    Charset{"┃", "━"},  //
-    Charset{"║", "═"},  //
-    Charset{"│", "─"},  //
-    Charset{" ", " "},  //
+using Charset = std::array<Glyph, 2>;     // NOLINT
+using Charsets = std::array<Charset, 5>;  // NOLINT
+// Built at compile time. Drawing a separator only copies them.
+constexpr Charsets charsets = {
+    Charset{Glyph::Narrow("│"), Glyph::Narrow("─")},  //
+    Charset{Glyph::Narrow("┃"), Glyph::Narrow("━")},  //
+    Charset{Glyph::Narrow("║"), Glyph::Narrow("═")},  //
+    Charset{Glyph::Narrow("│"), Glyph::Narrow("─")},  //
+    Charset{Glyph::Narrow(" "), Glyph::Narrow(" ")},  //
 };
 
 }  // namespace
 
 class Separator : public Node {
  public:
-  explicit Separator(std::string value) : value_(std::move(value)) {}
+  explicit Separator(const std::string& value) : value_(value) {}
 
   void ComputeRequirement() override {
     requirement_.min_x = 1;
@@ -43,9 +44,10 @@ class Separator : public Node {
         pixel.automerge = true;
       }
     }
+    screen.AddAutoMergeRegion(box_);
   }
 
-  std::string value_;
+  Glyph value_;
 };
 
 class SeparatorAuto : public Node {
@@ -61,7 +63,7 @@ class SeparatorAuto : public Node {
     const bool is_column = (box_.x_max == box_.x_min);
     const bool is_line = (box_.y_min == box_.y_max);
 
-    const std::string c = charsets[style_][int(is_line && !is_column)];
+    const Glyph& c = charsets[style_][int(is_line && !is_column)];
 
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
       for (int x = box_.x_min; x <= box_.x_max; ++x) {
@@ -70,6 +72,7 @@ class SeparatorAuto : public Node {
         pixel.automerge = true;
       }
     }
+    screen.AddAutoMergeRegion(box_);
   }
 
   BorderStyle style_;
@@ -82,11 +85,8 @@ class SeparatorWithPixel : public SeparatorAuto {
     pixel_.automerge = true;
   }
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = pixel_;
-      }
-    }
+    screen.FillRect(box_, pixel_);
+    screen.AddAutoMergeRegion(box_);
   }
 
  private:
@@ -126,7 +126,7 @@ class SeparatorWithPixel : public SeparatorAuto {
 /// down
 /// ```
 Element separator() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeNode<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -163,7 +163,7 @@ Element separator() {
 /// down
 /// ```
 Element separatorStyled(BorderStyle style) {
-  return std::make_shared<SeparatorAuto>(style);
+  return MakeNode<SeparatorAuto>(style);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -199,7 +199,7 @@ Element separatorStyled(BorderStyle style) {
 /// down
 /// ```
 Element separatorLight() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeNode<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -235,7 +235,7 @@ Element separatorLight() {
 /// down
 /// ```
 Element separatorHeavy() {
-  return std::make_shared<SeparatorAuto>(HEAVY);
+  return MakeNode<SeparatorAuto>(HEAVY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -271,7 +271,7 @@ Element separatorHeavy() {
 /// down
 /// ```
 Element separatorDouble() {
-  return std::make_shared<SeparatorAuto>(DOUBLE);
+  return MakeNode<SeparatorAuto>(DOUBLE);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -307,7 +307,7 @@ Element separatorDouble() {
 /// down
 /// ```
 Element separatorEmpty() {
-  return std::make_shared<SeparatorAuto>(EMPTY);
+  return MakeNode<SeparatorAuto>(EMPTY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -344,7 +344,7 @@ Element separatorEmpty() {
 /// down
 /// ```
 Element separatorCharacter(std::string value) {
-  return std::make_shared<Separator>(std::move(value));
+  return MakeNode<Separator>(value);
 }
 
 /// @brief Draw a separator in between two element filled with a given pixel.
@@ -374,7 +374,7 @@ Element separatorCharacter(std::string value) {
 /// Down
 /// ```
 Element separator(Pixel pixel) {
-  return std::make_shared<SeparatorWithPixel>(std::move(pixel));
+  return MakeNode<SeparatorWithPixel>(std::move(pixel));
 }
 
 /// @brief Draw an horizontal bar, with the area in between left/right colored
@@ -424,10 +424,11 @@ Element separatorHSelector(float left,
         const bool b_empty = demi_cell_left == b || demi_cell_right == b;
 
         if (!a_empty && !b_empty) {
-          pixel.character = "─";
+          pixel.character = Glyph::Narrow("─");
           pixel.automerge = true;
         } else {
-          pixel.character = a_empty ? "╶" : "╴";  // NOLINT
+          pixel.character =
+              a_empty ? Glyph::Narrow("╶") : Glyph::Narrow("╴");  // NOLINT
           pixel.automerge = false;
         }
 
@@ -437,6 +438,7 @@ Element separatorHSelector(float left,
           pixel.foreground_color = unselected_color_;
         }
       }
+      screen.AddAutoMergeRegion(box_);
     }
 
     float left_;
@@ -444,7 +446,7 @@ Element separatorHSelector(float left,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(left, right, unselected_color, selected_color);
+  return MakeNode<Impl>(left, right, unselected_color, selected_color);
 }
 
 /// @brief Draw an vertical bar, with the area in between up/downcolored
@@ -494,10 +496,11 @@ Element separatorVSelector(float up,
         const bool b_empty = demi_cell_up == b || demi_cell_down == b;
 
         if (!a_empty && !b_empty) {
-          pixel.character = "│";
+          pixel.character = Glyph::Narrow("│");
           pixel.automerge = true;
         } else {
-          pixel.character = a_empty ? "╷" : "╵";  // NOLINT
+          pixel.character =
+              a_empty ? Glyph::Narrow("╷") : Glyph::Narrow("╵");  // NOLINT
           pixel.automerge = false;
         }
 
@@ -507,6 +510,7 @@ Element separatorVSelector(float up,
           pixel.foreground_color = unselected_color_;
         }
       }
+      screen.AddAutoMergeRegion(box_);
     }
 
     float up_;
@@ -514,7 +518,7 @@ Element separatorVSelector(float up,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(up, down, unselected_color, selected_color);
+  return MakeNode<Impl>(up, down, unselected_color, selected_color);
 }
 
 }  // namespace ftxui
@@ -0,0 +1,42 @@
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"  // for Element, shared
+#include "ftxui/dom/node.hpp"      // for Node, Node::Status
+
+namespace ftxui {
+
+/// @brief Make an element reusable several times in the same document,
+/// instead of building one per use. Its requirement is computed once, here.
+/// The parents, like hbox, vbox, border or frame, store the box of every use,
+/// and move it there before drawing it. Custom parents must lay it out with
+/// Node::SetChildBox(), or Node::SetChildrenBox(), and draw it with
+/// Node::RenderChild().
+/// @param element The element to share. Its content must not change. It must
+///                not be built inside a FrameArena::Scope, nor used from
+///                several threads. The documents using it are laid out and
+///                drawn from a single thread.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// thread_local const Element badge = text(" OK ") | inverted | shared;
+/// Elements rows;
+/// for (const auto& service : services) {
+///   rows.push_back(hbox({text(service.name), filler(), badge}));
+/// }
+/// ```
+Element shared(Element element) {
+  Node::Status status;
+  element->Check(&status);
+  element->ComputeRequirement();
+  element->shared_ = true;
+  element->Weight();
+  return element;
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <string>   // for allocator, string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"     // for shared, text, hbox, vbox, dbox, border, filler, separator, bold, window, yframe, size, Element
+#include "ftxui/dom/layout_pool.hpp"  // for LayoutPool
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+
+std::string Draw(const Element& element, int width, int height) {
+  Screen screen(width, height);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+// A 3x3 grid, built from the cells returned by |cell| and |space|.
+template <class Cell, class Space>
+Element Grid(Cell cell, Space space) {
+  Elements rows;
+  for (int y = 0; y < 3; ++y) {
+    rows.push_back(hbox({cell(), space(), cell(), space(), cell()}));
+  }
+  return vbox(std::move(rows));
+}
+
+}  // namespace
+
+TEST(SharedTest, SameAsCopies) {
+  const Element cell = text("ab") | border | shared;
+  const Element space = text(" ") | shared;
+  const auto shared_cell = [&] { return cell; };
+  const auto shared_space = [&] { return space; };
+  const std::string expected =
+      Draw(Grid([] { return text("ab") | border; }, [] { return text(" "); }),
+           14, 9);
+  EXPECT_EQ(Draw(Grid(shared_cell, shared_space), 14, 9), expected);
+
+  // The shared elements can be used again, with other boxes.
+  EXPECT_EQ(Draw(Grid(shared_cell, shared_space), 14, 9), expected);
+  EXPECT_EQ(Draw(vbox({hbox({cell, filler(), cell}), separator(), cell}), 8, 7),
+            Draw(vbox({
+                     hbox({text("ab") | border, filler(),
+                           text("ab") | border}),
+                     separator(),
+                     text("ab") | border,
+                 }),
+                 8, 7));
+}
+
+TEST(SharedTest, Layers) {
+  const Element cell = text("x") | shared;
+  EXPECT_EQ(Draw(dbox({hbox({cell, text("--")}), hbox({text("-"), cell})}),
+                 3, 1),
+            "-x-");
+}
+
+TEST(SharedTest, Decorators) {
+  const Element cell = text("ab") | shared;
+  EXPECT_EQ(Draw(hbox({cell | border, cell | bold | border,
+                       window(cell, cell), cell | yframe}),
+                 16, 3),
+            Draw(hbox({text("ab") | border, text("ab") | bold | border,
+                       window(text("ab"), text("ab")), text("ab") | yframe}),
+                 16, 3));
+  EXPECT_EQ(Draw(vbox({cell | border, cell | size(WIDTH, EQUAL, 3)}), 4, 4),
+            "╭──╮\r\n"
+            "│ab│\r\n"
+            "╰──╯\r\n"
+            "ab  ");
+}
+
+TEST(SharedTest, LayoutPool) {
+  const Element cell = text("ab") | border | shared;
+  const Element space = text(" ") | shared;
+  const auto shared_cell = [&] { return cell; };
+  const auto shared_space = [&] { return space; };
+  const std::string expected = Draw(Grid(shared_cell, shared_space), 14, 9);
+
+  // The documents containing shared elements are laid out serially.
+  LayoutPool pool(3, /*min_weight=*/1);
+  LayoutPool::Scope scope(&pool);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(Draw(Grid(shared_cell, shared_space), 14, 9), expected);
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -67,7 +67,7 @@ class Size : public Node {
           break;
       }
     }
-    children_[0]->SetBox(box);
+    SetChildBox(0, box);
   }
 
  private:
@@ -84,7 +84,7 @@ class Size : public Node {
 /// @ingroup dom
 Decorator size(Direction direction, Constraint constraint, int value) {
   return [=](Element e) {
-    return std::make_shared<Size>(std::move(e), direction, constraint, value);
+    return MakeNode<Size>(std::move(e), direction, constraint, value);
   };
 }
 
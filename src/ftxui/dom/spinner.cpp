@@ -1,272 +1,321 @@
-#include <cstddef>  // for size_t
-#include <memory>   // for allocator, allocator_traits<>::value_type
-#include <string>   // for basic_string, string
-#include <utility>  // for move
-#include <vector>   // for vector, __alloc_traits<>::value_type
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <memory>       // for allocator, allocator_traits<>::value_type
+#include <span>         // for span
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector, __alloc_traits<>::value_type
 
 #include "ftxui/dom/elements.hpp"  // for Element, gauge, text, vbox, spinner
 
 namespace ftxui {
 
 namespace {
-// NOLINTNEXTLINE
-const std::vector<std::vector<std::vector<std::string>>> elements = {
-    {
-        {"Replaced by the gauge"},
-    },
-    {
-        {".  "},
-        {".. "},
-        {"..."},
-    },
-    {
-        {"|"},
-        {"/"},
-        {"-"},
-        {"\\"},
-    },
-    {
-        {"+"},
-        {"x"},
-    },
-    {
-        {"|  "},
-        {"|| "},
-        {"|||"},
-    },
-    {
-        {"←"},
-        {"↖"},
-        {"↑"},
-        {"↗"},
-        {"→"},
-        {"↘"},
-        {"↓"},
-        {"↙"},
-    },
-    {
-        {"▁"},
-        {"▂"},
-        {"▃"},
-        {"▄"},
-        {"▅"},
-        {"▆"},
-        {"▇"},
-        {"█"},
-        {"▇"},
-        {"▆"},
-        {"▅"},
-        {"▄"},
-        {"▃"},
-        {"▁"},
-    },
-    {
-        {"▉"},
-        {"▊"},
-        {"▋"},
-        {"▌"},
-        {"▍"},
-        {"▎"},
-        {"▏"},
-        {"▎"},
-        {"▍"},
-        {"▌"},
-        {"▋"},
-        {"▊"},
-    },
-    {
-        {"▖"},
-        {"▘"},
-        {"▝"},
-        {"▗"},
-    },
-    {
-        {"◢"},
-        {"◣"},
-        {"◤"},
-        {"◥"},
-    },
-    {
-        {"◰"},
-        {"◳"},
-        {"◲"},
-        {"◱"},
-    },
-    {
-        {"◴"},
-        {"◷"},
-        {"◶"},
-        {"◵"},
-    },
-    {
-        {"◐"},
-        {"◓"},
-        {"◑"},
-        {"◒"},
-    },
-    {
-        {"◡"},
-        {"⊙"},
-        {"◠"},
-    },
-    {
-        {"⠁"},
-        {"⠂"},
-        {"⠄"},
-        {"⡀"},
-        {"⢀"},
-        {"⠠"},
-        {"⠐"},
-        {"⠈"},
-    },
-    {
-        {"⠋"},
-        {"⠙"},
-        {"⠹"},
-        {"⠸"},
-        {"⠼"},
-        {"⠴"},
-        {"⠦"},
-        {"⠧"},
-        {"⠇"},
-        {"⠏"},
-    },
-    {
-        {"(*----------)"}, {"(-*---------)"}, {"(--*--------)"},
-        {"(---*-------)"}, {"(----*------)"}, {"(-----*-----)"},
-        {"(------*----)"}, {"(-------*---)"}, {"(--------*--)"},
-        {"(---------*-)"}, {"(----------*)"}, {"(---------*-)"},
-        {"(--------*--)"}, {"(-------*---)"}, {"(------*----)"},
-        {"(-----*-----)"}, {"(----*------)"}, {"(---*-------)"},
-        {"(--*--------)"}, {"(-*---------)"},
-    },
-    {
-        {"[      ]"},
-        {"[=     ]"},
-        {"[==    ]"},
-        {"[===   ]"},
-        {"[====  ]"},
-        {"[===== ]"},
-        {"[======]"},
-        {"[===== ]"},
-        {"[====  ]"},
-        {"[===   ]"},
-        {"[==    ]"},
-        {"[=     ]"},
-    },
-    {
-        {"[      ]"},
-        {"[=     ]"},
-        {"[==    ]"},
-        {"[===   ]"},
-        {"[====  ]"},
-        {"[===== ]"},
-        {"[======]"},
-        {"[ =====]"},
-        {"[  ====]"},
-        {"[   ===]"},
-        {"[    ==]"},
-        {"[     =]"},
-    },
-    {
-        {"[==    ]"},
-        {"[==    ]"},
-        {"[==    ]"},
-        {"[==    ]"},
-        {"[==    ]"},
-        {" [==   ]"},
-        {"[  ==  ]"},
-        {"[   == ]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[   ==] "},
-        {"[  ==  ]"},
-        {"[ ==   ]"},
-    },
-    {
-        {
-            " ─╮",
-            "  │",
-            "   ",
-        },
-        {
-            "  ╮",
-            "  │",
-            "  ╯",
-        },
-        {
-            "   ",
-            "  │",
-            " ─╯",
-        },
-        {
-            "   ",
-            "   ",
-            "╰─╯",
-        },
-        {
-            "   ",
-            "│  ",
-            "╰─ ",
-        },
-        {
-            "╭  ",
-            "│  ",
-            "╰  ",
-        },
-        {
-            "╭─ ",
-            "│  ",
-            "   ",
-        },
-        {
-            "╭─╮",
-            "   ",
-            "   ",
-        },
-    },
-    {
-        {
-            "   /\\O ",
-            "    /\\/",
-            "   /\\  ",
-            "  /  \\ ",
-            "LOL  LOL",
-        },
-        {
-            "    _O  ",
-            "   //|_ ",
-            "    |   ",
-            "   /|   ",
-            "   LLOL ",
-        },
-        {
-            "     O  ",
-            "    /_  ",
-            "    |\\  ",
-            "   / |  ",
-            " LOLLOL ",
-        },
-    },
-    {
-        {"       ", "_______", "       "},
-        {"       ", "______/", "       "},
-        {"      _", "_____/ ", "       "},
-        {"     _ ", "____/ \\", "       "},
-        {"    _  ", "___/ \\ ", "      \\"},
-        {"   _   ", "__/ \\  ", "     \\_"},
-        {"  _    ", "_/ \\   ", "    \\_/"},
-        {" _     ", "/ \\   _", "   \\_/ "},
-        {"_      ", " \\   __", "  \\_/  "},
-        {"       ", "\\   ___", " \\_/   "},
-        {"       ", "    ___", "\\_/    "},
-        {"       ", "  _____", "_/     "},
-        {"       ", " ______", "/      "},
-        {"       ", "_______", "       "},
-    },
+constexpr std::array<std::string_view, 1> kGauge = {
+    "Replaced by the gauge",
+};
+
+constexpr std::array<std::string_view, 3> kDots = {
+    ".  ",
+    ".. ",
+    "...",
+};
+
+constexpr std::array<std::string_view, 4> kLine = {
+    "|",
+    "/",
+    "-",
+    "\\",
+};
+
+constexpr std::array<std::string_view, 2> kCross = {
+    "+",
+    "x",
+};
+
+constexpr std::array<std::string_view, 3> kBars = {
+    "|  ",
+    "|| ",
+    "|||",
+};
+
+constexpr std::array<std::string_view, 8> kArrows = {
+    "←",
+    "↖",
+    "↑",
+    "↗",
+    "→",
+    "↘",
+    "↓",
+    "↙",
+};
+
+constexpr std::array<std::string_view, 14> kVerticalBar = {
+    "▁",
+    "▂",
+    "▃",
+    "▄",
+    "▅",
+    "▆",
+    "▇",
+    "█",
+    "▇",
+    "▆",
+    "▅",
+    "▄",
+    "▃",
+    "▁",
+};
+
+constexpr std::array<std::string_view, 12> kHorizontalBar = {
+    "▉",
+    "▊",
+    "▋",
+    "▌",
+    "▍",
+    "▎",
+    "▏",
+    "▎",
+    "▍",
+    "▌",
+    "▋",
+    "▊",
+};
+
+constexpr std::array<std::string_view, 4> kQuadrants = {
+    "▖",
+    "▘",
+    "▝",
+    "▗",
+};
+
+constexpr std::array<std::string_view, 4> kTriangles = {
+    "◢",
+    "◣",
+    "◤",
+    "◥",
+};
+
+constexpr std::array<std::string_view, 4> kSquares = {
+    "◰",
+    "◳",
+    "◲",
+    "◱",
+};
+
+constexpr std::array<std::string_view, 4> kQuarterCircles = {
+    "◴",
+    "◷",
+    "◶",
+    "◵",
+};
+
+constexpr std::array<std::string_view, 4> kHalfCircles = {
+    "◐",
+    "◓",
+    "◑",
+    "◒",
+};
+
+constexpr std::array<std::string_view, 3> kArc = {
+    "◡",
+    "⊙",
+    "◠",
+};
+
+constexpr std::array<std::string_view, 8> kBrailleDot = {
+    "⠁",
+    "⠂",
+    "⠄",
+    "⡀",
+    "⢀",
+    "⠠",
+    "⠐",
+    "⠈",
+};
+
+constexpr std::array<std::string_view, 10> kBrailleSpin = {
+    "⠋",
+    "⠙",
+    "⠹",
+    "⠸",
+    "⠼",
+    "⠴",
+    "⠦",
+    "⠧",
+    "⠇",
+    "⠏",
+};
+
+constexpr std::array<std::string_view, 20> kBouncingStar = {
+    "(*----------)",
+    "(-*---------)",
+    "(--*--------)",
+    "(---*-------)",
+    "(----*------)",
+    "(-----*-----)",
+    "(------*----)",
+    "(-------*---)",
+    "(--------*--)",
+    "(---------*-)",
+    "(----------*)",
+    "(---------*-)",
+    "(--------*--)",
+    "(-------*---)",
+    "(------*----)",
+    "(-----*-----)",
+    "(----*------)",
+    "(---*-------)",
+    "(--*--------)",
+    "(-*---------)",
+};
+
+constexpr std::array<std::string_view, 12> kGrowingBar = {
+    "[      ]",
+    "[=     ]",
+    "[==    ]",
+    "[===   ]",
+    "[====  ]",
+    "[===== ]",
+    "[======]",
+    "[===== ]",
+    "[====  ]",
+    "[===   ]",
+    "[==    ]",
+    "[=     ]",
+};
+
+constexpr std::array<std::string_view, 12> kFillingBar = {
+    "[      ]",
+    "[=     ]",
+    "[==    ]",
+    "[===   ]",
+    "[====  ]",
+    "[===== ]",
+    "[======]",
+    "[ =====]",
+    "[  ====]",
+    "[   ===]",
+    "[    ==]",
+    "[     =]",
+};
+
+constexpr std::array<std::string_view, 16> kBouncingBar = {
+    "[==    ]",
+    "[==    ]",
+    "[==    ]",
+    "[==    ]",
+    "[==    ]",
+    " [==   ]",
+    "[  ==  ]",
+    "[   == ]",
+    "[    ==]",
+    "[    ==]",
+    "[    ==]",
+    "[    ==]",
+    "[    ==]",
+    "[   ==] ",
+    "[  ==  ]",
+    "[ ==   ]",
+};
+
+constexpr std::array<std::string_view, 8> kCorners = {
+    " ─╮\n"
+    "  │\n"
+    "   ",
+    "  ╮\n"
+    "  │\n"
+    "  ╯",
+    "   \n"
+    "  │\n"
+    " ─╯",
+    "   \n"
+    "   \n"
+    "╰─╯",
+    "   \n"
+    "│  \n"
+    "╰─ ",
+    "╭  \n"
+    "│  \n"
+    "╰  ",
+    "╭─ \n"
+    "│  \n"
+    "   ",
+    "╭─╮\n"
+    "   \n"
+    "   ",
+};
+
+constexpr std::array<std::string_view, 3> kDancer = {
+    "   /\\O \n"
+    "    /\\/\n"
+    "   /\\  \n"
+    "  /  \\ \n"
+    "LOL  LOL",
+    "    _O  \n"
+    "   //|_ \n"
+    "    |   \n"
+    "   /|   \n"
+    "   LLOL ",
+    "     O  \n"
+    "    /_  \n"
+    "    |\\  \n"
+    "   / |  \n"
+    " LOLLOL ",
+};
+
+constexpr std::array<std::string_view, 14> kWave = {
+    "       \n"
+    "_______\n"
+    "       ",
+    "       \n"
+    "______/\n"
+    "       ",
+    "      _\n"
+    "_____/ \n"
+    "       ",
+    "     _ \n"
+    "____/ \\\n"
+    "       ",
+    "    _  \n"
+    "___/ \\ \n"
+    "      \\",
+    "   _   \n"
+    "__/ \\  \n"
+    "     \\_",
+    "  _    \n"
+    "_/ \\   \n"
+    "    \\_/",
+    " _     \n"
+    "/ \\   _\n"
+    "   \\_/ ",
+    "_      \n"
+    " \\   __\n"
+    "  \\_/  ",
+    "       \n"
+    "\\   ___\n"
+    " \\_/   ",
+    "       \n"
+    "    ___\n"
+    "\\_/    ",
+    "       \n"
+    "  _____\n"
+    "_/     ",
+    "       \n"
+    " ______\n"
+    "/      ",
+    "       \n"
+    "_______\n"
+    "       ",
+};
+
+// The lines of a frame are separated by '\n'.
+constexpr std::array<std::span<const std::string_view>, 23> kCharsets = {
+    kGauge, kDots, kLine, kCross, kBars, kArrows, kVerticalBar, kHorizontalBar,
+    kQuadrants, kTriangles, kSquares, kQuarterCircles, kHalfCircles, kArc,
+    kBrailleDot, kBrailleSpin, kBouncingStar, kGrowingBar, kFillingBar,
+    kBouncingBar, kCorners, kDancer, kWave,
 };
 
 }  // namespace
@@ -286,11 +335,17 @@ Element spinner(int charset_index, size_t image_index) {
     }
     return gauge(float(image_index) * 0.05F);  // NOLINT
   }
-  charset_index %= (int)elements.size();
-  image_index %= (int)elements[charset_index].size();
+  charset_index %= (int)kCharsets.size();
+  const auto& frames = kCharsets[charset_index];
+  std::string_view frame = frames[image_index % frames.size()];
   std::vector<Element> lines;
-  for (const auto& it : elements[charset_index][image_index]) {
-    lines.push_back(text(it));
+  while (true) {
+    const size_t eol = frame.find('\n');
+    lines.push_back(text(std::string(frame.substr(0, eol))));
+    if (eol == std::string_view::npos) {
+      break;
+    }
+    frame.remove_prefix(eol + 1);
   }
   return vbox(std::move(lines));
 }
@@ -0,0 +1,104 @@
+#include "ftxui/dom/static_layout.hpp"
+
+#include <algorithm>  // for max
+#include <cstddef>    // for size_t
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/box_helper.hpp"   // for Scratch
+#include "ftxui/dom/elements.hpp"     // for Element, Elements, emptyElement
+#include "ftxui/dom/node.hpp"         // for Node, MakeNode
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+
+namespace ftxui {
+
+namespace {
+
+// The children are laid out in the slots of |layout_|, whatever their
+// requirement along the axis of the layout.
+class StaticBox : public Node {
+ public:
+  StaticBox(const StaticLayout& layout, Elements children, bool horizontal)
+      : Node(std::move(children)), layout_(layout), horizontal_(horizontal) {
+    for (auto& child : children_) {
+      if (!child) {
+        child = emptyElement();
+      }
+    }
+  }
+
+  void ComputeRequirement() override {
+    requirement_ = {};
+    ComputeChildrenRequirement();
+    int& size = horizontal_ ? requirement_.min_x : requirement_.min_y;
+    int& cross = horizontal_ ? requirement_.min_y : requirement_.min_x;
+    size = layout_.size;
+    (horizontal_ ? requirement_.flex_grow_x : requirement_.flex_grow_y) =
+        layout_.flex != 0 ? 1 : 0;
+
+    // The children are at the start of their slot, when the layout is as
+    // small as possible.
+    int start = 0;
+    for (size_t i = 0; i < children_.size(); ++i) {
+      const Requirement& child = children_[i]->requirement();
+      cross = std::max(cross, horizontal_ ? child.min_y : child.min_x);
+      if (requirement_.selection < child.selection) {
+        requirement_.selection = child.selection;
+        requirement_.selected_box = child.selected_box;
+        int& min = horizontal_ ? requirement_.selected_box.x_min
+                               : requirement_.selected_box.y_min;
+        int& max = horizontal_ ? requirement_.selected_box.x_max
+                               : requirement_.selected_box.y_max;
+        min += start;
+        max += start;
+      }
+      start += layout_.slots[i].size;
+    }
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    std::vector<int> sizes(children_.size());
+    const int cells = horizontal_ ? box.x_max - box.x_min + 1
+                                  : box.y_max - box.y_min + 1;
+    layout_.Distribute(cells, sizes);
+
+    const box_helper::Scratch scratch(children_.size());
+    const auto boxes = scratch.boxes;
+    int start = horizontal_ ? box.x_min : box.y_min;
+    for (size_t i = 0; i < children_.size(); ++i) {
+      boxes[i] = box;
+      int& min = horizontal_ ? boxes[i].x_min : boxes[i].y_min;
+      int& max = horizontal_ ? boxes[i].x_max : boxes[i].y_max;
+      min = start;
+      max = start + sizes[i] - 1;
+      start = max + 1;
+    }
+    SetChildrenBox(boxes);
+  }
+
+ private:
+  const StaticLayout& layout_;
+  const bool horizontal_;
+};
+
+}  // namespace
+
+namespace static_layout_internal {
+
+Element StaticHBox(const StaticLayout& layout, Elements children) {
+  return MakeNode<StaticBox>(layout, std::move(children), true);
+}
+
+Element StaticVBox(const StaticLayout& layout, Elements children) {
+  return MakeNode<StaticBox>(layout, std::move(children), false);
+}
+
+}  // namespace static_layout_internal
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
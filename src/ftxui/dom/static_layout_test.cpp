@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <array>   // for array
+#include <string>  // for string
+
+#include "ftxui/dom/elements.hpp"       // for text, vbox, focus
+#include "ftxui/dom/node.hpp"           // for Render
+#include "ftxui/dom/static_layout.hpp"  // for staticHBox, staticVBox, StaticSizes
+#include "ftxui/screen/screen.hpp"      // for Screen
+
+namespace ftxui {
+
+using namespace slot;
+
+// The sizes are computed at compile time.
+static_assert(StaticSizes<Fixed<2>, Flex<>, Fixed<3>>(10) ==
+              std::array<int, 3>{2, 5, 3});
+static_assert(StaticSizes<Flex<1>, Flex<2>>(10) == std::array<int, 2>{3, 7});
+static_assert(StaticSizes<Fixed<2>, Flex<>, Fixed<3>>(4) ==
+              std::array<int, 3>{2, 0, 2});
+
+TEST(StaticLayoutTest, HBox) {
+  auto root = staticHBox<Fixed<3>, Flex<>, Fixed<2>>({
+      text("abcdef"),
+      text("xyz"),
+      text("12"),
+  });
+  Screen screen(10, 1);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(), "abcxyz  12");
+
+  // Too small: the last slots are truncated.
+  Screen small(4, 1);
+  Render(small, root);
+  EXPECT_EQ(small.ToString(), "abc1");
+}
+
+TEST(StaticLayoutTest, VBox) {
+  auto root = staticVBox<Fixed<1>, Flex<>, Fixed<1>>({
+      text("head"),
+      vbox({text("a"), text("b")}),
+      text("foot"),
+  });
+  Screen screen(4, 5);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "head\r\n"
+            "a   \r\n"
+            "b   \r\n"
+            "    \r\n"
+            "foot");
+}
+
+TEST(StaticLayoutTest, Requirement) {
+  auto root = staticHBox<Fixed<3>, Flex<>, Fixed<2>>({
+      text("a"),
+      vbox({text("b"), text("c") | focus}),
+      text("d"),
+  });
+  root->ComputeRequirement();
+  EXPECT_EQ(root->requirement().min_x, 5);
+  EXPECT_EQ(root->requirement().min_y, 2);
+  EXPECT_EQ(root->requirement().flex_grow_x, 1);
+  EXPECT_EQ(root->requirement().selection, Requirement::FOCUSED);
+  EXPECT_EQ(root->requirement().selected_box.x_min, 3);
+  EXPECT_EQ(root->requirement().selected_box.y_min, 1);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,103 @@
+#include <memory>   // for make_shared
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"        // for Element, Decorator, style
+#include "ftxui/dom/node.hpp"            // for Node
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/dom/style.hpp"           // for Style
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/color.hpp"        // for Color
+#include "ftxui/screen/screen.hpp"       // for Screen, Screen::SpanStyle
+
+namespace ftxui {
+
+namespace {
+
+// Apply every attribute of a Style in a single pass over the pixels. The
+// attributes are applied before or after the child, like the decorator they
+// replace: bold, strikethrough, underlinedDouble and the colors are drawn
+// first and can be overridden by the child. The others are applied after.
+class StyleNode final : public NodeDecorator {
+ public:
+  StyleNode(Element child, const Style& style)
+      : NodeDecorator(std::move(child)), style_(style) {}
+
+  // Add the attributes of a decorator wrapping this node. The attributes
+  // drawn before the child are overridden by the ones of this node.
+  void Wrap(const Style& outer) { style_.Wrap(outer); }
+
+  void Render(Screen& screen) override {
+    const Style& s = style_;
+    if (s.bold || s.strikethrough || s.underlined_double ||
+        s.foreground_color || s.background_color) {
+      Screen::SpanStyle before;
+      before.bold = s.bold;
+      before.strikethrough = s.strikethrough;
+      before.underlined_double = s.underlined_double;
+      before.set_foreground = s.foreground_color.has_value();
+      before.foreground_color = s.foreground_color.value_or(Color());
+      before.set_background = s.background_color.has_value();
+      before.background_color = s.background_color.value_or(Color());
+      screen.ApplyStyleRect(box_, before);
+    }
+
+    Node::Render(screen);
+
+    if (s.blink || s.dim || s.underlined || s.inverted) {
+      Screen::SpanStyle after;
+      after.blink = s.blink;
+      after.dim = s.dim;
+      after.underlined = s.underlined;
+      after.inverted = s.inverted;
+      screen.ApplyStyleRect(box_, after);
+    }
+  }
+
+ private:
+  Style style_;
+};
+
+}  // namespace
+
+void Style::Wrap(const Style& outer) {
+  blink |= outer.blink;
+  bold |= outer.bold;
+  dim |= outer.dim;
+  inverted ^= outer.inverted;
+  underlined |= outer.underlined;
+  underlined_double |= outer.underlined_double;
+  strikethrough |= outer.strikethrough;
+  if (!foreground_color) {
+    foreground_color = outer.foreground_color;
+  }
+  if (!background_color) {
+    background_color = outer.background_color;
+  }
+}
+
+/// @brief Apply a set of text attributes, in a single pass.
+/// When |child| is itself a style() owned by nobody else (for instance
+/// `text("x") | bold | dim`), the attributes are merged into it instead of
+/// nesting a new node.
+/// @ingroup dom
+Element style(Element child, const Style& style) {
+  if (child.use_count() == 1) {
+    if (auto* node = dynamic_cast<StyleNode*>(child.get())) {
+      node->Wrap(style);
+      return child;
+    }
+  }
+  return MakeNode<StyleNode>(std::move(child), style);
+}
+
+/// @brief Decorate using a set of text attributes.
+/// @ingroup dom
+Decorator style(const Style& s) {
+  return [s](Element child) { return style(std::move(child), s); };
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
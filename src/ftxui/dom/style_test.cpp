@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator
+
+#include "ftxui/dom/elements.hpp"  // for operator|, text, bold, dim, color, style
+#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/style.hpp"     // for Style
+#include "ftxui/screen/color.hpp"  // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+
+namespace ftxui {
+
+namespace {
+Pixel Draw(const Element& element) {
+  Screen screen(1, 1);
+  Render(screen, element);
+  return screen.PixelAt(0, 0);
+}
+}  // namespace
+
+TEST(StyleTest, Basic) {
+  Style s;
+  s.bold = true;
+  s.underlined = true;
+  s.foreground_color = Color::Red;
+  const Pixel pixel = Draw(text("x") | style(s));
+  EXPECT_TRUE(pixel.bold);
+  EXPECT_TRUE(pixel.underlined);
+  EXPECT_FALSE(pixel.dim);
+  EXPECT_EQ(pixel.foreground_color, Color::Red);
+  EXPECT_EQ(pixel.background_color, Color::Default);
+}
+
+TEST(StyleTest, Fold) {
+  const Pixel pixel = Draw(text("x") | bold | dim | color(Color::Red) |
+                           bgcolor(Color::Blue) | inverted | blink |
+                           underlined | underlinedDouble | strikethrough);
+  EXPECT_TRUE(pixel.bold);
+  EXPECT_TRUE(pixel.dim);
+  EXPECT_TRUE(pixel.inverted);
+  EXPECT_TRUE(pixel.blink);
+  EXPECT_TRUE(pixel.underlined);
+  EXPECT_TRUE(pixel.underlined_double);
+  EXPECT_TRUE(pixel.strikethrough);
+  EXPECT_EQ(pixel.foreground_color, Color::Red);
+  EXPECT_EQ(pixel.background_color, Color::Blue);
+}
+
+TEST(StyleTest, InnerColorWins) {
+  const Pixel pixel =
+      Draw(text("x") | color(Color::Red) | color(Color::Blue) |
+           bgcolor(Color::Green) | bgcolor(Color::Yellow));
+  EXPECT_EQ(pixel.foreground_color, Color::Red);
+  EXPECT_EQ(pixel.background_color, Color::Green);
+}
+
+TEST(StyleTest, InvertedToggles) {
+  EXPECT_TRUE(Draw(text("x") | inverted).inverted);
+  EXPECT_FALSE(Draw(text("x") | inverted | inverted).inverted);
+  EXPECT_TRUE(Draw(text("x") | inverted | bold | inverted | inverted).inverted);
+}
+
+TEST(StyleTest, SharedChildIsNotModified) {
+  const Element shared = text("x") | bold;
+  const Element decorated = shared | dim;
+  EXPECT_TRUE(Draw(decorated).dim);
+  EXPECT_TRUE(Draw(decorated).bold);
+  EXPECT_FALSE(Draw(shared).dim);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,10 +1,15 @@
 #include "ftxui/dom/table.hpp"
 
-#include <algorithm>  // for max
+#include <algorithm>   // for max, min
+#include <functional>  // for function
 #include <memory>   // for allocator, shared_ptr, allocator_traits<>::value_type
+#include <optional>  // for optional
+#include <string>       // for string
+#include <string_view>  // for string_view
 #include <utility>  // for move, swap
 
-#include "ftxui/dom/elements.hpp"  // for Element, operator|, text, separatorCharacter, Elements, BorderStyle, Decorator, emptyElement, size, gridbox, EQUAL, flex, flex_shrink, HEIGHT, WIDTH
+#include "ftxui/dom/elements.hpp"  // for Element, operator|, text, separatorCharacter, Elements, BorderStyle, Decorator, emptyElement, size, gridbox, EQUAL, flex, flex_shrink, HEIGHT, WIDTH, style
+#include "ftxui/dom/style.hpp"     // for Style
 
 namespace ftxui {
 namespace {
@@ -14,7 +19,7 @@ bool IsCell(int x, int y) {
 }
 
 // NOLINTNEXTLINE
-static std::string charset[5][6] = {
+constexpr std::string_view charset[5][6] = {
     {"┌", "┐", "└", "┘", "─", "│"},  //
     {"┏", "┓", "┗", "┛", "━", "┃"},  //
     {"╔", "╗", "╚", "╝", "═", "║"},  //
@@ -22,6 +27,13 @@ static std::string charset[5][6] = {
     {" ", " ", " ", " ", " ", " "},  //
 };
 
+// The separator drawn with the |index|th character of |border|, merged with
+// its neighbours.
+Element MergedSeparator(BorderStyle border, int index) {
+  return separatorCharacter(std::string(charset[border][index])) |  // NOLINT
+         automerge;
+}
+
 int Wrap(int input, int modulo) {
   input %= modulo;
   input += modulo;
@@ -153,7 +165,39 @@ TableSelection Table::SelectAll() {
   return output;
 }
 
+// Record |style| around the ones recorded for the element (x, y).
+void Table::AddStyle(int x, int y, const Style& style) {
+  if (styles_.empty()) {
+    styles_.resize(size_t(dim_x_) * size_t(dim_y_));
+  }
+  std::optional<Style>& record = styles_[size_t(y) * size_t(dim_x_) + x];
+  if (record) {
+    record->Wrap(style);
+  } else {
+    record = style;
+  }
+}
+
+// Wrap the elements into their recorded Style. style() merges it into the
+// element when it is already a style(), instead of adding a node.
+void Table::ApplyStyles() {
+  if (styles_.empty()) {
+    return;
+  }
+  for (int y = 0; y < dim_y_; ++y) {
+    for (int x = 0; x < dim_x_; ++x) {
+      const std::optional<Style>& record =
+          styles_[size_t(y) * size_t(dim_x_) + x];
+      if (record) {
+        elements_[y][x] = style(std::move(elements_[y][x]), *record);
+      }
+    }
+  }
+  styles_.clear();
+}
+
 Element Table::Render() {
+  ApplyStyles();
   for (int y = 0; y < dim_y_; ++y) {
     for (int x = 0; x < dim_x_; ++x) {
       auto& it = elements_[y][x];
@@ -179,82 +223,158 @@ Element Table::Render() {
   return gridbox(std::move(elements_));
 }
 
-// NOLINTNEXTLINE
-void TableSelection::Decorate(Decorator decorator) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      Element& e = table_->elements_[y][x];
-      e = std::move(e) | decorator;
+// Apply |f| to the elements of a rectangle, clipped to the table.
+void TableSelection::ForEach(int x_min,
+                             int x_max,
+                             int y_min,
+                             int y_max,
+                             const std::function<void(int, int, Element&)>& f) {
+  x_min = std::max(x_min, 0);
+  x_max = std::min(x_max, table_->dim_x_ - 1);
+  y_min = std::max(y_min, 0);
+  y_max = std::min(y_max, table_->dim_y_ - 1);
+  for (int y = y_min; y <= y_max; ++y) {
+    for (int x = x_min; x <= x_max; ++x) {
+      f(x, y, table_->elements_[y][x]);
     }
   }
 }
 
+// Apply |f| to the elements targeted by a Decorate*() function.
+void TableSelection::ForEachTarget(
+    Target target,
+    int modulo,
+    int shift,
+    const std::function<void(int, int, Element&)>& f) {
+  switch (target) {
+    case Target::All:
+      ForEach(x_min_, x_max_, y_min_, y_max_, f);
+      return;
+    case Target::AlternateRow:
+      ForEach(x_min_, x_max_, y_min_ + 1, y_max_ - 1,
+              [&](int x, int y, Element& e) {
+                if (y % 2 == 1 && (y / 2) % modulo == shift) {
+                  f(x, y, e);
+                }
+              });
+      return;
+    case Target::AlternateColumn:
+      ForEach(x_min_, x_max_, y_min_, y_max_, [&](int x, int y, Element& e) {
+        if (y % 2 == 1 && (x / 2) % modulo == shift) {
+          f(x, y, e);
+        }
+      });
+      return;
+    case Target::Cells:
+      ForEach(x_min_, x_max_, y_min_, y_max_, [&](int x, int y, Element& e) {
+        if (y % 2 == 1 && x % 2 == 1) {
+          f(x, y, e);
+        }
+      });
+      return;
+    case Target::CellsAlternateColumn:
+      ForEach(x_min_, x_max_, y_min_, y_max_, [&](int x, int y, Element& e) {
+        if (y % 2 == 1 && x % 2 == 1 && ((x / 2) % modulo == shift)) {
+          f(x, y, e);
+        }
+      });
+      return;
+    case Target::CellsAlternateRow:
+      ForEach(x_min_, x_max_, y_min_, y_max_, [&](int x, int y, Element& e) {
+        if (y % 2 == 1 && x % 2 == 1 && ((y / 2) % modulo == shift)) {
+          f(x, y, e);
+        }
+      });
+      return;
+  }
+}
+
+void TableSelection::Decorate(Target target,
+                              int modulo,
+                              int shift,
+                              const Decorator& decorator) {
+  ForEachTarget(target, modulo, shift, [&](int /*x*/, int /*y*/, Element& e) {
+    e = std::move(e) | decorator;
+  });
+}
+
+void TableSelection::Decorate(Target target,
+                              int modulo,
+                              int shift,
+                              const Style& style) {
+  ForEachTarget(target, modulo, shift, [&](int x, int y, Element& /*e*/) {
+    table_->AddStyle(x, y, style);
+  });
+}
+
+// NOLINTNEXTLINE
+void TableSelection::Decorate(Decorator decorator) {
+  Decorate(Target::All, 1, 0, decorator);
+}
+
 // NOLINTNEXTLINE
 void TableSelection::DecorateCells(Decorator decorator) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && x % 2 == 1) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  Decorate(Target::Cells, 1, 0, decorator);
 }
 
 // NOLINTNEXTLINE
 void TableSelection::DecorateAlternateColumn(Decorator decorator,
                                              int modulo,
                                              int shift) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && (x / 2) % modulo == shift) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  Decorate(Target::AlternateColumn, modulo, shift, decorator);
 }
 
 // NOLINTNEXTLINE
 void TableSelection::DecorateAlternateRow(Decorator decorator,
                                           int modulo,
                                           int shift) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && (y / 2) % modulo == shift) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  Decorate(Target::AlternateRow, modulo, shift, decorator);
 }
 
 // NOLINTNEXTLINE
 void TableSelection::DecorateCellsAlternateColumn(Decorator decorator,
                                                   int modulo,
                                                   int shift) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && x % 2 == 1 && ((x / 2) % modulo == shift)) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  Decorate(Target::CellsAlternateColumn, modulo, shift, decorator);
 }
 
 // NOLINTNEXTLINE
 void TableSelection::DecorateCellsAlternateRow(Decorator decorator,
                                                int modulo,
                                                int shift) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      if (y % 2 == 1 && x % 2 == 1 && ((y / 2) % modulo == shift)) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
-      }
-    }
-  }
+  Decorate(Target::CellsAlternateRow, modulo, shift, decorator);
+}
+
+void TableSelection::Decorate(const Style& style) {
+  Decorate(Target::All, 1, 0, style);
+}
+
+void TableSelection::DecorateCells(const Style& style) {
+  Decorate(Target::Cells, 1, 0, style);
+}
+
+void TableSelection::DecorateAlternateColumn(const Style& style,
+                                             int modulo,
+                                             int shift) {
+  Decorate(Target::AlternateColumn, modulo, shift, style);
+}
+
+void TableSelection::DecorateAlternateRow(const Style& style,
+                                          int modulo,
+                                          int shift) {
+  Decorate(Target::AlternateRow, modulo, shift, style);
+}
+
+void TableSelection::DecorateCellsAlternateColumn(const Style& style,
+                                                  int modulo,
+                                                  int shift) {
+  Decorate(Target::CellsAlternateColumn, modulo, shift, style);
+}
+
+void TableSelection::DecorateCellsAlternateRow(const Style& style,
+                                               int modulo,
+                                               int shift) {
+  Decorate(Target::CellsAlternateRow, modulo, shift, style);
 }
 
 void TableSelection::Border(BorderStyle border) {
@@ -263,77 +383,66 @@ void TableSelection::Border(BorderStyle border) {
   BorderTop(border);
   BorderBottom(border);
 
-  // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_min_] = text(charset[border][0]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_max_] = text(charset[border][1]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_min_] = text(charset[border][2]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_max_] = text(charset[border][3]) | automerge;
+  auto corner = [&](int x, int y, int index) {
+    ForEach(x, x, y, y, [&](int /*x*/, int /*y*/, Element& e) {
+      e = text(std::string(charset[border][index])) | automerge;  // NOLINT
+    });
+  };
+  corner(x_min_, y_min_, 0);
+  corner(x_max_, y_min_, 1);
+  corner(x_min_, y_max_, 2);
+  corner(x_max_, y_max_, 3);
 }
 
 void TableSelection::Separator(BorderStyle border) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
-      if (y % 2 == 0 || x % 2 == 0) {
-        Element& e = table_->elements_[y][x];
-        e = (y % 2 == 1)
-                ? separatorCharacter(charset[border][5]) | automerge   // NOLINT
-                : separatorCharacter(charset[border][4]) | automerge;  // NOLINT
-      }
-    }
-  }
+  ForEach(x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+          [&](int x, int y, Element& e) {
+            if (y % 2 == 0 || x % 2 == 0) {
+              e = MergedSeparator(border, (y % 2 == 1) ? 5 : 4);
+            }
+          });
 }
 
 void TableSelection::SeparatorVertical(BorderStyle border) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
-      if (x % 2 == 0) {
-        table_->elements_[y][x] =
-            separatorCharacter(charset[border][5]) | automerge;  // NOLINT
-      }
-    }
-  }
+  ForEach(x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+          [&](int x, int /*y*/, Element& e) {
+            if (x % 2 == 0) {
+              e = MergedSeparator(border, 5);
+            }
+          });
 }
 
 void TableSelection::SeparatorHorizontal(BorderStyle border) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
-      if (y % 2 == 0) {
-        table_->elements_[y][x] =
-            separatorCharacter(charset[border][4]) | automerge;  // NOLINT
-      }
-    }
-  }
+  ForEach(x_min_ + 1, x_max_ - 1, y_min_ + 1, y_max_ - 1,
+          [&](int /*x*/, int y, Element& e) {
+            if (y % 2 == 0) {
+              e = MergedSeparator(border, 4);
+            }
+          });
 }
 
 void TableSelection::BorderLeft(BorderStyle border) {
-  for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_min_] =
-        separatorCharacter(charset[border][5]) | automerge;  // NOLINT
-  }
+  ForEach(x_min_, x_min_, y_min_, y_max_, [&](int /*x*/, int /*y*/, Element& e) {
+    e = MergedSeparator(border, 5);
+  });
 }
 
 void TableSelection::BorderRight(BorderStyle border) {
-  for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_max_] =
-        separatorCharacter(charset[border][5]) | automerge;  // NOLINT
-  }
+  ForEach(x_max_, x_max_, y_min_, y_max_, [&](int /*x*/, int /*y*/, Element& e) {
+    e = MergedSeparator(border, 5);
+  });
 }
 
 void TableSelection::BorderTop(BorderStyle border) {
-  for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_min_][x] =
-        separatorCharacter(charset[border][4]) | automerge;  // NOLINT
-  }
+  ForEach(x_min_, x_max_, y_min_, y_min_, [&](int /*x*/, int /*y*/, Element& e) {
+    e = MergedSeparator(border, 4);
+  });
 }
 
 void TableSelection::BorderBottom(BorderStyle border) {
-  for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_max_][x] =
-        separatorCharacter(charset[border][4]) | automerge;  // NOLINT
-  }
+  ForEach(x_min_, x_max_, y_max_, y_max_, [&](int /*x*/, int /*y*/, Element& e) {
+    e = MergedSeparator(border, 4);
+  });
 }
 
 }  // namespace ftxui
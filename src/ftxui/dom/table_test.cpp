@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 #include <memory>  // for allocator
+#include <string>  // for string
+#include <vector>  // for vector
 
 #include "ftxui/dom/elements.hpp"  // for LIGHT, flex, center, EMPTY, DOUBLE
 #include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/style.hpp"  // for Style
 #include "ftxui/dom/table.hpp"
 #include "ftxui/screen/screen.hpp"  // for Screen
 
@@ -730,6 +733,40 @@ TEST(TableTest, Merge) {
       screen.ToString());
 }
 
+TEST(TableTest, Style) {
+  auto cells = [] {
+    return std::vector<std::vector<std::string>>{
+        {"a", "b", "c"},
+        {"d", "e", "f"},
+        {"g", "h", "i"},
+    };
+  };
+  auto draw = [](Table& table) {
+    Screen screen(7, 7);
+    Render(screen, table.Render());
+    return screen.ToString();
+  };
+
+  Style stripe;
+  stripe.background_color = Color::RGB(10, 20, 30);
+  Style strong;
+  strong.bold = true;
+  strong.foreground_color = Color::RGB(200, 0, 0);
+
+  auto decorated = Table(cells());
+  decorated.SelectAll().Border(LIGHT);
+  decorated.SelectAll().DecorateCellsAlternateRow(
+      bgcolor(Color::RGB(10, 20, 30)));
+  decorated.SelectColumn(1).Decorate(bold | color(Color::RGB(200, 0, 0)));
+
+  auto styled = Table(cells());
+  styled.SelectAll().Border(LIGHT);
+  styled.SelectAll().DecorateCellsAlternateRow(stripe);
+  styled.SelectColumn(1).Decorate(strong);
+
+  EXPECT_EQ(draw(styled), draw(decorated));
+}
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
@@ -1,27 +1,98 @@
-#include <algorithm>  // for min
-#include <memory>     // for make_shared
-#include <string>     // for string, wstring
-#include <utility>    // for move
-#include <vector>     // for vector
+#include <algorithm>     // for min, clamp, all_of
+#include <array>         // for array
+#include <charconv>      // for to_chars, chars_format
+#include <cstddef>       // for size_t
+#include <cstdint>       // for int64_t, uint64_t, uint8_t
+#include <cstring>       // for memcpy
+#include <memory>        // for make_shared
+#include <string>        // for string, wstring
+#include <string_view>   // for string_view
+#include <system_error>  // for errc
+#include <vector>        // for vector
 
 #include "ftxui/dom/deprecated.hpp"   // for text, vtext
-#include "ftxui/dom/elements.hpp"     // for Element, text, vtext
+#include "ftxui/dom/elements.hpp"     // for Element, text, textf, vtext
 #include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/text_part.hpp"    // for TextPart
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
-#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, to_string
+#include "ftxui/screen/string.hpp"    // for Glyphs, to_string
+#include "ftxui/screen/util.hpp"      // for HeapSize
 
 namespace ftxui {
 
 using ftxui::Screen;
 
+namespace {
+// Segment |text| into the glyphs of the cells it is drawn onto. Fullwidth
+// glyphs are followed by an empty cell, reserving their space.
+std::vector<Glyph> Segment(const std::string& text) {
+  std::vector<Glyph> cells;
+  cells.reserve(text.size());
+  for (const GlyphView& glyph : Glyphs(text)) {
+    cells.emplace_back(glyph.text);
+    if (glyph.width == 2) {
+      cells.emplace_back();
+    }
+  }
+  return cells;
+}
+
+// The glyphs of the printable ASCII characters.
+constexpr auto kAsciiGlyphs = []() consteval {
+  std::array<Glyph, 128> glyphs{};
+  for (int c = ' '; c < 127; ++c) {
+    const char character = static_cast<char>(c);
+    glyphs[c] = Glyph::Narrow(std::string_view(&character, 1));
+  }
+  return glyphs;
+}();
+
+bool IsPrintableAscii(std::string_view text) {
+  return std::all_of(text.begin(), text.end(),
+                     [](char c) { return c >= ' ' && c < 127; });
+}
+
+// Format the number of |part| into |buffer|. The strings are returned as is.
+std::string_view Format(const TextPart& part, std::array<char, 512>& buffer) {
+  char* const first = buffer.data();
+  char* const last = first + buffer.size();
+  std::to_chars_result result{first, std::errc()};
+  switch (part.type) {
+    case TextPart::Type::String:
+      return part.text;
+    case TextPart::Type::Signed:
+      result = std::to_chars(first, last, part.signed_value);
+      break;
+    case TextPart::Type::Unsigned:
+      result = std::to_chars(first, last, part.unsigned_value);
+      break;
+    case TextPart::Type::Double:
+      // The precision is bounded, so that the largest doubles fit.
+      result = part.precision < 0
+                   ? std::to_chars(first, last, part.double_value)
+                   : std::to_chars(first, last, part.double_value,
+                                   std::chars_format::fixed,
+                                   std::min(part.precision, 100));
+      break;
+  }
+  if (result.ec != std::errc()) {
+    return {};
+  }
+  return {first, static_cast<size_t>(result.ptr - first)};
+}
+}  // namespace
+
+// The text is segmented once, at construction. The cells are reused for both
+// the layout and the rendering.
 class Text : public Node {
  public:
-  explicit Text(std::string text) : text_(std::move(text)) {}
+  explicit Text(const std::string& text) : cells_(Segment(text)) {}
 
   void ComputeRequirement() override {
-    requirement_.min_x = string_width(text_);
+    requirement_.min_x = static_cast<int>(cells_.size());
     requirement_.min_y = 1;
   }
 
@@ -31,7 +102,7 @@ class Text : public Node {
     if (y > box_.y_max) {
       return;
     }
-    for (const auto& cell : Utf8ToGlyphs(text_)) {
+    for (const Glyph& cell : cells_) {
       if (x > box_.x_max) {
         return;
       }
@@ -40,18 +111,68 @@ class Text : public Node {
     }
   }
 
+  size_t MemoryUsage() const override {
+    return Node::MemoryUsage() + util::HeapSize(cells_);
+  }
+
+ private:
+  std::vector<Glyph> cells_;
+};
+
+namespace {
+
+// A short printable ASCII text, like a number, stored inline. Every character
+// takes one cell, so it is never segmented.
+class AsciiText : public Node {
+ public:
+  static constexpr size_t kCapacity = 31;
+
+  explicit AsciiText(std::string_view text)
+      : size_(static_cast<uint8_t>(text.size())) {
+    std::memcpy(data_, text.data(), text.size());
+  }
+
+  void ComputeRequirement() override {
+    requirement_.min_x = size_;
+    requirement_.min_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    const int y = box_.y_min;
+    if (y > box_.y_max) {
+      return;
+    }
+    const int size = std::min(int(size_), box_.x_max - box_.x_min + 1);
+    for (int i = 0; i < size; ++i) {
+      screen.PixelAt(box_.x_min + i, y).character =
+          kAsciiGlyphs[static_cast<uint8_t>(data_[i])];  // NOLINT
+    }
+  }
+
  private:
-  std::string text_;
+  char data_[kCapacity];  // NOLINT
+  uint8_t size_;
 };
 
+// An AsciiText when |text| allows it, or else a Text.
+Element MakeText(std::string_view text) {
+  if (text.size() <= AsciiText::kCapacity && IsPrintableAscii(text)) {
+    return MakeNode<AsciiText>(text);
+  }
+  return MakeNode<Text>(std::string(text));
+}
+
+}  // namespace
+
 class VText : public Node {
  public:
-  explicit VText(std::string text)
-      : text_(std::move(text)), width_{std::min(string_width(text_), 1)} {}
+  explicit VText(const std::string& text)
+      : cells_(Segment(text)),
+        width_{std::min(static_cast<int>(cells_.size()), 1)} {}
 
   void ComputeRequirement() override {
     requirement_.min_x = width_;
-    requirement_.min_y = string_width(text_);
+    requirement_.min_y = static_cast<int>(cells_.size());
   }
 
   void Render(Screen& screen) override {
@@ -60,17 +181,21 @@ class VText : public Node {
     if (x + width_ - 1 > box_.x_max) {
       return;
     }
-    for (const auto& it : Utf8ToGlyphs(text_)) {
+    for (const Glyph& cell : cells_) {
       if (y > box_.y_max) {
         return;
       }
-      screen.PixelAt(x, y).character = it;
+      screen.PixelAt(x, y).character = cell;
       y += 1;
     }
   }
 
+  size_t MemoryUsage() const override {
+    return Node::MemoryUsage() + util::HeapSize(cells_);
+  }
+
  private:
-  std::string text_;
+  std::vector<Glyph> cells_;
   int width_ = 1;
 };
 
@@ -90,7 +215,7 @@ class VText : public Node {
 /// Hello world!
 /// ```
 Element text(std::string text) {
-  return std::make_shared<Text>(std::move(text));
+  return MakeNode<Text>(text);
 }
 
 /// @brief Display a piece of unicode text.
@@ -109,7 +234,90 @@ Element text(std::string text) {
 /// Hello world!
 /// ```
 Element text(std::wstring text) {  // NOLINT
-  return std::make_shared<Text>(to_string(text));
+  return MakeNode<Text>(to_string(text));
+}
+
+/// @brief Display an integer. It is formatted without allocating any string.
+/// @ingroup dom
+/// @see textf
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = text(42);
+/// ```
+Element text(int64_t value) {
+  return textf({value});
+}
+
+/// @brief Display an unsigned integer. It is formatted without allocating any
+/// string.
+/// @ingroup dom
+/// @see textf
+Element text(uint64_t value) {
+  return textf({value});
+}
+
+/// @brief Display a double with |precision| digits after the point. It is
+/// formatted without allocating any string.
+/// @ingroup dom
+/// @see textf
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = text(3.14159, 2);
+/// ```
+///
+/// ### Output
+///
+/// ```bash
+/// 3.14
+/// ```
+Element text(double value, int precision) {
+  return textf({{value, precision}});
+}
+
+/// @brief Display the concatenation of strings and numbers. The numbers are
+/// formatted with std::to_chars. The short ASCII results are stored inline in
+/// the element, without allocating any string, and their width is their
+/// length.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = textf({"CPU ", {cpu, 1}, "% ", threads, " threads"});
+/// ```
+///
+/// ### Output
+///
+/// ```bash
+/// CPU 12.5% 8 threads
+/// ```
+Element textf(std::initializer_list<TextPart> parts) {
+  std::array<char, 512> buffer;  // NOLINT
+  std::array<char, AsciiText::kCapacity> line;  // NOLINT
+  size_t size = 0;
+  for (const TextPart& part : parts) {
+    const std::string_view view = Format(part, buffer);
+    if (size + view.size() > line.size()) {
+      size = line.size() + 1;
+      break;
+    }
+    std::memcpy(line.data() + size, view.data(), view.size());
+    size += view.size();
+  }
+  if (size <= line.size()) {
+    return MakeText({line.data(), size});
+  }
+
+  // Too long to be stored inline.
+  std::string text;
+  for (const TextPart& part : parts) {
+    text += Format(part, buffer);
+  }
+  return MakeText(text);
 }
 
 /// @brief Display a piece of unicode text vertically.
@@ -139,7 +347,7 @@ Element text(std::wstring text) {  // NOLINT
 /// !
 /// ```
 Element vtext(std::string text) {
-  return std::make_shared<VText>(std::move(text));
+  return MakeNode<VText>(text);
 }
 
 /// @brief Display a piece unicode text vertically.
@@ -169,7 +377,7 @@ Element vtext(std::string text) {
 /// !
 /// ```
 Element vtext(std::wstring text) {  // NOLINT
-  return std::make_shared<VText>(to_string(text));
+  return MakeNode<VText>(to_string(text));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,359 @@
+#include "ftxui/dom/text_document.hpp"
+
+#include <algorithm>  // for max, min
+#include <utility>    // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, textDocument
+#include "ftxui/dom/node.hpp"         // for Node, Node::Status
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for Glyphs, GlyphView
+#include "ftxui/util/ref.hpp"         // for ConstRef
+
+namespace ftxui {
+
+namespace {
+
+constexpr size_t kBlockSize = 64 * 1024;  // NOLINT
+
+int Width(std::string_view text) {
+  int width = 0;
+  for (const GlyphView& glyph : Glyphs(text)) {
+    width += glyph.width;
+  }
+  return width;
+}
+
+size_t LowBit(size_t i) {
+  return i & (~i + 1);
+}
+
+// Break |line| into rows of at most |width| cells, between its words. The
+// words too long are broken between their glyphs. Call |emit| with the
+// position of every glyph, and return the number of rows.
+template <class Emit>
+int WrapLine(std::string_view line, int width, const Emit& emit) {
+  int x = 0;
+  int y = 0;
+  size_t begin = 0;
+  while (true) {
+    const size_t end = std::min(line.find(' ', begin), line.size());
+    const std::string_view word = line.substr(begin, end - begin);
+    if (begin != 0) {
+      // The space between two words. It is dropped at the end of the rows.
+      if (x > 0 && x + 1 + Width(word) > width) {
+        x = 0;
+        y++;
+      } else {
+        emit(x++, y, GlyphView{" ", 1});
+      }
+    }
+    for (const GlyphView& glyph : Glyphs(word)) {
+      if (x > 0 && x + glyph.width > width) {
+        x = 0;
+        y++;
+      }
+      emit(x, y, glyph);
+      x += glyph.width;
+    }
+    if (end == line.size()) {
+      return y + 1;
+    }
+    begin = end + 1;
+  }
+}
+
+}  // namespace
+
+/// @brief An empty document.
+TextDocument::TextDocument() {
+  Clear();
+}
+
+/// @brief A document holding |text|.
+/// @param text the content of the document. Lines are separated by '\n'.
+TextDocument::TextDocument(std::string_view text) {
+  Clear();
+  Append(text);
+}
+
+/// @brief Append |text| at the end of the document. Every '\n' starts a new
+/// line.
+void TextDocument::Append(std::string_view text) {
+  size_t begin = 0;
+  while (true) {
+    const size_t end = std::min(text.find('\n', begin), text.size());
+    AppendToLine(text.substr(begin, end - begin));
+    if (end == text.size()) {
+      return;
+    }
+    const auto block_end = static_cast<uint32_t>(blocks_.back().size());
+    lines_.push_back({static_cast<uint32_t>(blocks_.size() - 1), block_end,
+                      block_end, 0});
+    begin = end + 1;
+  }
+}
+
+// Append |text| to the last line. The lines never span two blocks: the last
+// one moves to a new block, instead of overflowing the previous one.
+void TextDocument::AppendToLine(std::string_view text) {
+  if (text.empty()) {
+    return;
+  }
+  LineRef& line = lines_.back();
+  if (blocks_.back().size() + text.size() > kBlockSize && line.begin != 0) {
+    std::string block;
+    block.reserve(std::max(kBlockSize, line.end - line.begin + text.size()));
+    block.append(blocks_.back(), line.begin, line.end - line.begin);
+    blocks_.back().resize(line.begin);
+    blocks_.push_back(std::move(block));
+    line.block++;
+    line.end -= line.begin;
+    line.begin = 0;
+  }
+  blocks_.back().append(text);
+  line.end += static_cast<uint32_t>(text.size());
+  line.width += Width(text);
+  max_width_ = std::max(max_width_, line.width);
+}
+
+/// @brief Remove the whole content of the document.
+void TextDocument::Clear() {
+  blocks_.clear();
+  blocks_.emplace_back();
+  blocks_.back().reserve(kBlockSize);
+  lines_.clear();
+  lines_.emplace_back();
+  max_width_ = 0;
+  wrap_width_ = 0;
+}
+
+/// @brief The number of lines. A final '\n' doesn't start a new line.
+size_t TextDocument::line_count() const {
+  const LineRef& last = lines_.back();
+  const bool last_empty = last.begin == last.end;
+  return lines_.size() - ((lines_.size() > 1 && last_empty) ? 1 : 0);
+}
+
+/// @brief The content of the |index|-th line, without its '\n'.
+std::string_view TextDocument::Line(size_t index) const {
+  const LineRef& line = lines_[index];
+  return std::string_view(blocks_[line.block])
+      .substr(line.begin, line.end - line.begin);
+}
+
+// Update the rows of the lines, wrapped at |width|. The new lines, and the
+// last one if it changed, are estimated from their width.
+void TextDocument::Wrap(int width) const {
+  width = std::max(width, 1);
+  const size_t count = line_count();
+  if (width != wrap_width_ || count < wrap_rows_.size()) {
+    wrap_width_ = width;
+    wrap_total_ = 0;
+    wrap_rows_.clear();
+    wrap_exact_.clear();
+    wrap_tree_.clear();
+  }
+  auto estimate = [&](const LineRef& line) {
+    return std::max(1, (line.width + width - 1) / width);
+  };
+
+  if (!wrap_rows_.empty()) {
+    const size_t last = wrap_rows_.size() - 1;
+    if (!IsSameLine(lines_[last], wrap_last_)) {
+      wrap_exact_[last] = false;
+      SetRows(last, estimate(lines_[last]));
+    }
+  }
+
+  while (wrap_rows_.size() < count) {
+    const int rows = estimate(lines_[wrap_rows_.size()]);
+    wrap_rows_.push_back(rows);
+    wrap_exact_.push_back(false);
+    // The node |i| of the tree sums the lines in (i - LowBit(i), i].
+    const size_t i = wrap_rows_.size();
+    int sum = rows;
+    for (size_t j = i - 1; j > i - LowBit(i); j -= LowBit(j)) {
+      sum += wrap_tree_[j - 1];
+    }
+    wrap_tree_.push_back(sum);
+    wrap_total_ += rows;
+  }
+  if (count != 0) {
+    wrap_last_ = lines_[count - 1];
+  }
+}
+
+void TextDocument::SetRows(size_t line, int rows) const {
+  const int delta = rows - wrap_rows_[line];
+  wrap_rows_[line] = rows;
+  wrap_total_ += delta;
+  for (size_t i = line + 1; i <= wrap_tree_.size(); i += LowBit(i)) {
+    wrap_tree_[i - 1] += delta;
+  }
+}
+
+int TextDocument::RowsBefore(size_t line) const {
+  int rows = 0;
+  for (size_t i = line; i > 0; i -= LowBit(i)) {
+    rows += wrap_tree_[i - 1];
+  }
+  return rows;
+}
+
+size_t TextDocument::LineAtRow(int row, int* line_row) const {
+  size_t step = 1;
+  while (step * 2 <= wrap_tree_.size()) {
+    step *= 2;
+  }
+  size_t line = 0;
+  for (; step > 0; step /= 2) {
+    if (line + step <= wrap_tree_.size() &&
+        wrap_tree_[line + step - 1] <= row) {
+      line += step;
+      row -= wrap_tree_[line - 1];
+    }
+  }
+  *line_row = row;
+  return line;
+}
+
+void TextDocument::Refine(size_t line) const {
+  if (wrap_exact_[line]) {
+    return;
+  }
+  wrap_exact_[line] = true;
+  SetRows(line, WrapLine(Line(line), wrap_width_,
+                         [](int /*x*/, int /*y*/, const GlyphView& /*g*/) {}));
+}
+
+class TextDocumentNode : public Node {
+ public:
+  TextDocumentNode(ConstRef<TextDocument> document, bool wrap)
+      : document_(std::move(document)), wrap_(wrap) {
+    asked_ = document_->wrap_width_;
+  }
+
+  void ComputeRequirement() override {
+    const TextDocument& document = *document_;
+    requirement_.min_y = static_cast<int>(document.line_count());
+    if (!wrap_) {
+      requirement_.min_x = document.max_width();
+      return;
+    }
+    // The width is known after the first SetBox().
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_shrink_x = 1;
+    if (asked_ > 0) {
+      document.Wrap(asked_);
+      requirement_.min_y = document.Rows();
+    }
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    if (wrap_) {
+      const int width = box.x_max - box.x_min + 1;
+      need_iteration_ = (width != asked_);
+      asked_ = width;
+    }
+  }
+
+  void Check(Status* status) override {
+    Node::Check(status);
+    status->need_iteration |= need_iteration_;
+  }
+
+  void Render(Screen& screen) override {
+    // Only the visible rows are drawn.
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min(box_.y_max, screen.stencil.y_max);
+    const int x_max = std::min(box_.x_max, screen.stencil.x_max);
+    if (y_min > y_max || box_.x_min > x_max) {
+      return;
+    }
+    if (wrap_) {
+      RenderWrapped(screen, y_min, y_max, x_max);
+      return;
+    }
+
+    const TextDocument& document = *document_;
+    const int count = static_cast<int>(document.line_count());
+    for (int y = y_min; y <= y_max && y - box_.y_min < count; ++y) {
+      int x = box_.x_min;
+      for (const GlyphView& glyph : Glyphs(document.Line(y - box_.y_min))) {
+        if (x > x_max) {
+          break;
+        }
+        Draw(screen, x, y, glyph);
+        x += glyph.width;
+      }
+    }
+  }
+
+ private:
+  void RenderWrapped(Screen& screen, int y_min, int y_max, int x_max) {
+    const TextDocument& document = *document_;
+    const int width = box_.x_max - box_.x_min + 1;
+    document.Wrap(width);
+    if (document.Rows() <= y_min - box_.y_min) {
+      return;
+    }
+    int line_row = 0;
+    size_t line = document.LineAtRow(y_min - box_.y_min, &line_row);
+    int y = y_min - line_row;
+    for (; line < document.line_count() && y <= y_max; ++line) {
+      // Refining the lines before |line| would move it. They are estimated.
+      document.Refine(line);
+      const int rows = WrapLine(
+          document.Line(line), width,
+          [&](int x, int row, const GlyphView& glyph) {
+            const bool visible = y + row >= y_min && y + row <= y_max;
+            if (visible && box_.x_min + x <= x_max) {
+              Draw(screen, box_.x_min + x, y + row, glyph);
+            }
+          });
+      y += rows;
+    }
+  }
+
+  static void Draw(Screen& screen, int x, int y, const GlyphView& glyph) {
+    screen.PixelAt(x, y).character = Glyph(glyph.text);
+    if (glyph.width == 2) {
+      screen.PixelAt(x + 1, y).character = Glyph();
+    }
+  }
+
+  ConstRef<TextDocument> document_;
+  bool wrap_;
+  int asked_ = 0;
+  bool need_iteration_ = false;
+};
+
+/// @brief Draw a TextDocument. Only the visible lines are read, so it can be
+/// put in a frame, however large the document is.
+/// @param document the text, or a pointer to it.
+/// @param wrap whether the lines are broken between their words to fit the
+///             width. By default, the element is as wide as the longest line.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// TextDocument document(dump);
+/// Element element = textDocument(&document, /*wrap=*/true)
+///                 | focusPosition(0, scroll)
+///                 | vscroll_indicator
+///                 | frame;
+/// ```
+Element textDocument(ConstRef<TextDocument> document, bool wrap) {
+  return MakeNode<TextDocumentNode>(std::move(document), wrap);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+
+#include "ftxui/dom/elements.hpp"       // for textDocument, frame, focusPosition
+#include "ftxui/dom/node.hpp"           // for Render
+#include "ftxui/dom/text_document.hpp"  // for TextDocument
+#include "ftxui/screen/screen.hpp"      // for Screen
+
+namespace ftxui {
+
+TEST(TextDocumentTest, Lines) {
+  TextDocument document("a\nbc\n\nd");
+  ASSERT_EQ(document.line_count(), 4u);
+  EXPECT_EQ(document.Line(1), "bc");
+  EXPECT_EQ(document.Line(2), "");
+  EXPECT_EQ(document.Line(3), "d");
+
+  // A line can be appended in several parts. A final '\n' doesn't start a new
+  // line.
+  document.Append("ef\ngh");
+  document.Append("i\n");
+  ASSERT_EQ(document.line_count(), 5u);
+  EXPECT_EQ(document.Line(3), "def");
+  EXPECT_EQ(document.Line(4), "ghi");
+  EXPECT_EQ(document.max_width(), 3);
+
+  document.Clear();
+  EXPECT_EQ(document.line_count(), 1u);
+  EXPECT_EQ(document.Line(0), "");
+}
+
+TEST(TextDocumentTest, ManyBlocks) {
+  TextDocument document;
+  for (int i = 0; i < 20000; ++i) {
+    document.Append("line " + std::to_string(i) + "\n");
+  }
+  ASSERT_EQ(document.line_count(), 20000u);
+  EXPECT_EQ(document.Line(0), "line 0");
+  EXPECT_EQ(document.Line(12345), "line 12345");
+  EXPECT_EQ(document.Line(19999), "line 19999");
+
+  // A line longer than a block.
+  const std::string long_line(100000, 'x');
+  document.Append(long_line);
+  EXPECT_EQ(document.Line(20000), long_line);
+  EXPECT_EQ(document.max_width(), 100000);
+}
+
+TEST(TextDocumentTest, Render) {
+  TextDocument document("abc\n测d\nefghij");
+  Element element = textDocument(&document);
+  element->ComputeRequirement();
+  EXPECT_EQ(element->requirement().min_x, 6);
+  EXPECT_EQ(element->requirement().min_y, 3);
+
+  Screen screen(4, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "abc \r\n"
+            "测d \r\n"
+            "efgh");
+}
+
+TEST(TextDocumentTest, Wrap) {
+  TextDocument document("hello world foo\nabcdefghijk\n\nend");
+  Screen screen(5, 8);
+  Render(screen, textDocument(&document, /*wrap=*/true));
+  EXPECT_EQ(screen.ToString(),
+            "hello\r\n"
+            "world\r\n"
+            "foo  \r\n"
+            "abcde\r\n"
+            "fghij\r\n"
+            "k    \r\n"
+            "     \r\n"
+            "end  ");
+}
+
+TEST(TextDocumentTest, Frame) {
+  TextDocument document;
+  for (int i = 0; i < 100000; ++i) {
+    document.Append(std::to_string(i) + "\n");
+  }
+  Screen screen(6, 3);
+  Render(screen, textDocument(&document) | focusPosition(0, 50000) | frame);
+  EXPECT_EQ(screen.ToString(),
+            "49999 \r\n"
+            "50000 \r\n"
+            "50001 ");
+}
+
+TEST(TextDocumentTest, WrapFrame) {
+  TextDocument document;
+  for (int i = 0; i < 1000; ++i) {
+    document.Append("aa bb\n");
+  }
+  Screen screen(3, 2);
+  Render(screen, textDocument(&document, /*wrap=*/true) |
+                     focusPosition(0, 1000) | frame);
+  // Every line takes 2 rows: "aa", then "bb".
+  EXPECT_EQ(screen.ToString(),
+            "aa \r\n"
+            "bb ");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
-#include <string>  // for allocator, string
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int64_t, uint64_t
+#include <string>   // for allocator, string
 
-#include "ftxui/dom/elements.hpp"   // for text, operator|, border, Element
+#include "ftxui/dom/elements.hpp"   // for text, textf, operator|, border, Element
 #include "ftxui/dom/node.hpp"       // for Render
 #include "ftxui/screen/screen.hpp"  // for Screen
 
@@ -117,6 +119,45 @@ TEST(TextTest, CombiningCharactersWithSpace) {
   EXPECT_EQ(t, screen.ToString());
 }
 
+namespace {
+// Draw |element| on a screen of its width.
+std::string Draw(Element element) {
+  Screen screen(Dimension::Fit(element).dimx, 1);
+  Render(screen, element);
+  return screen.ToString();
+}
+}  // namespace
+
+TEST(TextTest, Numbers) {
+  EXPECT_EQ(Draw(text(42)), "42");
+  EXPECT_EQ(Draw(text(-7)), "-7");
+  EXPECT_EQ(Draw(text(int64_t(-9223372036854775807) - 1)),
+            "-9223372036854775808");
+  EXPECT_EQ(Draw(text(uint64_t(18446744073709551615U))),
+            "18446744073709551615");
+  EXPECT_EQ(Draw(text(size_t(3))), "3");
+  EXPECT_EQ(Draw(text(3.14159, 2)), "3.14");
+  EXPECT_EQ(Draw(text(2.5, 0)), "2");
+  EXPECT_EQ(Draw(text(1e300, 1)).substr(0, 4), "1000");
+}
+
+TEST(TextTest, Textf) {
+  EXPECT_EQ(Draw(textf({"CPU ", {12.46, 1}, "% ", 8, " threads"})),
+            "CPU 12.5% 8 threads");
+  EXPECT_EQ(Draw(textf({0.25, "/", 1u})), "0.25/1");
+  EXPECT_EQ(Draw(textf({})), "");
+
+  // The non ASCII and the long texts are segmented like text().
+  EXPECT_EQ(Draw(textf({"測試 ", 1})), "測試 1");
+  const std::string long_text(40, 'a');
+  EXPECT_EQ(Draw(textf({long_text, 1})), long_text + "1");
+
+  // Truncated by the box.
+  Screen screen(3, 1);
+  Render(screen, text(123456));
+  EXPECT_EQ(screen.ToString(), "123");
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -0,0 +1,389 @@
+#include "ftxui/dom/time_series.hpp"
+
+#include <algorithm>  // for max, min, clamp
+#include <cmath>      // for lround, isnan
+#include <utility>    // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, timeSeries, sparkline
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/util/ref.hpp"         // for ConstRef
+
+namespace ftxui {
+
+/// @brief Constructor.
+/// @param capacity the number of samples kept. The oldest ones are removed
+/// first.
+TimeSeries::TimeSeries(size_t capacity)
+    : samples_(std::max(capacity, size_t(1))) {}
+
+/// @brief Append a sample, removing the oldest one if the buffer is full.
+void TimeSeries::Push(float value) {
+  const size_t index = pushed_;
+  samples_[index % samples_.size()] = value;
+  pushed_++;
+  size_ = std::min(size_ + 1, samples_.size());
+
+  // Drop the samples removed from the buffer, and then the ones which can't be
+  // the minimum, respectively the maximum, anymore.
+  const size_t begin = pushed_ - size_;
+  auto sample = [&](size_t i) { return samples_[i % samples_.size()]; };
+  if (!minima_.empty() && minima_.front() < begin) {
+    minima_.pop_front();
+  }
+  if (!maxima_.empty() && maxima_.front() < begin) {
+    maxima_.pop_front();
+  }
+  while (!minima_.empty() && sample(minima_.back()) >= value) {
+    minima_.pop_back();
+  }
+  while (!maxima_.empty() && sample(maxima_.back()) <= value) {
+    maxima_.pop_back();
+  }
+  minima_.push_back(index);
+  maxima_.push_back(index);
+}
+
+/// @brief Remove every sample.
+void TimeSeries::Clear() {
+  size_ = 0;
+  pushed_ = 0;
+  bucket_size_ = 0;
+  complete_.clear();
+  minima_.clear();
+  maxima_.clear();
+}
+
+/// @brief The |index|-th oldest sample.
+float TimeSeries::operator[](size_t index) const {
+  return samples_[(pushed_ - size_ + index) % samples_.size()];
+}
+
+/// @brief Display the values in [min, max]. By default, the range adapts to
+/// the samples.
+void TimeSeries::SetRange(float min, float max) {
+  fixed_range_ = true;
+  min_ = min;
+  max_ = max;
+}
+
+/// @brief The lower bound of the range given to SetRange(), or else the
+/// minimum of the samples.
+float TimeSeries::min() const {
+  if (fixed_range_ || minima_.empty()) {
+    return min_;
+  }
+  return samples_[minima_.front() % samples_.size()];
+}
+
+/// @brief The upper bound of the range given to SetRange(), or else the
+/// maximum of the samples.
+float TimeSeries::max() const {
+  if (fixed_range_ || maxima_.empty()) {
+    return max_;
+  }
+  return samples_[maxima_.front() % samples_.size()];
+}
+
+// The bucket of the samples in [begin, end), counted since Clear().
+TimeSeries::Bucket TimeSeries::Compute(size_t begin, size_t end) const {
+  Bucket bucket;
+  bucket.first = samples_[begin % samples_.size()];
+  bucket.last = samples_[(end - 1) % samples_.size()];
+  bucket.min = bucket.first;
+  bucket.max = bucket.first;
+  for (size_t i = begin + 1; i < end; ++i) {
+    const float value = samples_[i % samples_.size()];
+    bucket.min = std::min(bucket.min, value);
+    bucket.max = std::max(bucket.max, value);
+  }
+  return bucket;
+}
+
+/// @brief Reduce the samples to at most |count| buckets, from the oldest one.
+/// Each keeps the minimum and the maximum of its samples.
+const std::vector<TimeSeries::Bucket>& TimeSeries::Decimate(int count) const {
+  buckets_.clear();
+  if (count <= 0 || size_ == 0) {
+    return buckets_;
+  }
+  const size_t begin = pushed_ - size_;
+
+  // The buckets are aligned on multiples of their size, so that they remain
+  // valid when samples are pushed.
+  const size_t size = (samples_.size() + size_t(count) - 1) / size_t(count);
+  if (size != bucket_size_) {
+    bucket_size_ = size;
+    complete_.clear();
+  }
+
+  // Update the complete buckets, contained in [begin, pushed_).
+  const size_t complete_begin = (begin + size - 1) / size;
+  const size_t complete_end = pushed_ / size;
+  while (!complete_.empty() && first_bucket_ < complete_begin) {
+    complete_.pop_front();
+    first_bucket_++;
+  }
+  if (complete_.empty() || first_bucket_ > complete_begin) {
+    complete_.clear();
+    first_bucket_ = complete_begin;
+  }
+  while (first_bucket_ + complete_.size() < complete_end) {
+    const size_t bucket = first_bucket_ + complete_.size();
+    complete_.push_back(Compute(bucket * size, (bucket + 1) * size));
+  }
+
+  // The buffer might start in the middle of a bucket, making one too many.
+  // This drops the oldest samples.
+  const size_t last = (pushed_ - 1) / size;
+  size_t first = begin / size;
+  if (last - first >= size_t(count)) {
+    first = last + 1 - size_t(count);
+  }
+  for (size_t bucket = first; bucket <= last; ++bucket) {
+    if (bucket >= first_bucket_ && bucket < complete_end) {
+      buckets_.push_back(complete_[bucket - first_bucket_]);
+    } else {
+      buckets_.push_back(Compute(std::max(bucket * size, begin),
+                                 std::min((bucket + 1) * size, pushed_)));
+    }
+  }
+  return buckets_;
+}
+
+// Call |plot| with the lines drawing the samples on |canvas|, one bucket per
+// column of dots.
+template <class Plot>
+void TimeSeries::DrawWith(const Canvas& canvas, const Plot& plot) const {
+  const std::vector<Bucket>& buckets = Decimate(canvas.width());
+  if (buckets.empty()) {
+    return;
+  }
+
+  float min = min_;
+  float max = max_;
+  if (!fixed_range_) {
+    min = buckets[0].min;
+    max = buckets[0].max;
+    for (const Bucket& bucket : buckets) {
+      min = std::min(min, bucket.min);
+      max = std::max(max, bucket.max);
+    }
+  }
+
+  const int height = canvas.height();
+  auto y = [&](float value) {
+    if (max <= min) {
+      return (height - 1) / 2;
+    }
+    // Values out of the range are drawn just outside of the canvas.
+    const float ratio = (value - min) / (max - min);
+    const float dot = std::clamp(float(height - 1) * (1.f - ratio),  //
+                                 -1.f, float(height));
+    return int(std::lround(dot));
+  };
+
+  for (size_t i = 0; i < buckets.size(); ++i) {
+    const int x = int(i);
+    if (i != 0) {
+      plot(x - 1, y(buckets[i - 1].last), x, y(buckets[i].first));
+    }
+    plot(x, y(buckets[i].max), x, y(buckets[i].min));
+  }
+}
+
+/// @brief Draw the samples as a line made of braille dots, covering the
+/// canvas.
+void TimeSeries::Draw(Canvas& canvas) const {
+  DrawWith(canvas, [&](int x1, int y1, int x2, int y2) {
+    canvas.DrawPointLine(x1, y1, x2, y2);
+  });
+}
+
+/// @brief Draw the samples as a line made of braille dots, covering the
+/// canvas.
+/// @param color the color of the line.
+void TimeSeries::Draw(Canvas& canvas, const Color& color) const {
+  DrawWith(canvas, [&](int x1, int y1, int x2, int y2) {
+    canvas.DrawPointLine(x1, y1, x2, y2, color);
+  });
+}
+
+namespace {
+
+class TimeSeriesNode : public Node {
+ public:
+  explicit TimeSeriesNode(ConstRef<TimeSeries> series)
+      : series_(std::move(series)) {}
+
+  void ComputeRequirement() override {
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+    requirement_.min_x = 3;
+    requirement_.min_y = 3;
+  }
+
+  void Render(Screen& screen) override {
+    const int width = box_.x_max - box_.x_min + 1;
+    const int height = box_.y_max - box_.y_min + 1;
+    if (width <= 0 || height <= 0) {
+      return;
+    }
+    Canvas canvas(width * 2, height * 4);
+    series_->Draw(canvas);
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        screen.PixelAt(box_.x_min + x, box_.y_min + y) = canvas.GetPixel(x, y);
+      }
+    }
+  }
+
+ private:
+  ConstRef<TimeSeries> series_;
+};
+
+// NOLINTNEXTLINE
+constexpr Glyph charset_blocks[9] = {
+    Glyph::Narrow(" "), Glyph::Narrow("▁"), Glyph::Narrow("▂"),
+    Glyph::Narrow("▃"), Glyph::Narrow("▄"), Glyph::Narrow("▅"),
+    Glyph::Narrow("▆"), Glyph::Narrow("▇"), Glyph::Narrow("█"),
+};
+
+// The newest samples, right aligned. Only the ones fitting in the box are
+// visited, and the range is maintained by the TimeSeries.
+class Sparkline : public Node {
+ public:
+  Sparkline(ConstRef<TimeSeries> series, SparklineOption option)
+      : series_(std::move(series)), option_(option) {}
+
+  void ComputeRequirement() override {
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    const int width = box_.x_max - box_.x_min + 1;
+    const int height = box_.y_max - box_.y_min + 1;
+    if (width <= 0 || height <= 0) {
+      return;
+    }
+    if (option_.style == SparklineOption::Braille) {
+      RenderBraille(screen, width, height);
+    } else {
+      RenderBlocks(screen, width, height);
+    }
+  }
+
+ private:
+  // The position of |value| in the range, in [0, 1].
+  float Ratio(float value) const {
+    const float min = series_->min();
+    const float max = series_->max();
+    if (max <= min) {
+      return 0.f;
+    }
+    return std::clamp((value - min) / (max - min), 0.f, 1.f);
+  }
+
+  void RenderBlocks(Screen& screen, int width, int height) {
+    const TimeSeries& series = *series_;
+    const size_t count = std::min(series.size(), size_t(width));
+    const int x = box_.x_max - int(count) + 1;
+    const int levels = 8 * height;
+    for (size_t i = 0; i < count; ++i) {
+      const float value = series[series.size() - count + i];
+      if (std::isnan(value)) {
+        continue;
+      }
+      // The minimum is drawn as the lowest bar, instead of nothing.
+      const int level = 1 + int(std::lround(Ratio(value) * float(levels - 1)));
+      for (int row = 0; row < height && level > 8 * row; ++row) {
+        screen.PixelAt(x + int(i), box_.y_max - row).character =
+            charset_blocks[std::min(level - 8 * row, 8)];  // NOLINT
+      }
+    }
+  }
+
+  void RenderBraille(Screen& screen, int width, int height) {
+    const TimeSeries& series = *series_;
+    Canvas canvas(width * 2, height * 4);
+    const size_t count = std::min(series.size(), size_t(canvas.width()));
+    const int x = canvas.width() - int(count);
+    const float bottom = float(canvas.height() - 1);
+    auto y = [&](float value) {
+      return int(std::lround(bottom * (1.f - Ratio(value))));
+    };
+    for (size_t i = 0; i < count; ++i) {
+      const float value = series[series.size() - count + i];
+      if (i == 0) {
+        canvas.DrawPoint(x, y(value), true);
+      } else {
+        const float previous = series[series.size() - count + i - 1];
+        canvas.DrawPointLine(x + int(i) - 1, y(previous), x + int(i), y(value));
+      }
+    }
+    for (int dy = 0; dy < height; ++dy) {
+      for (int dx = 0; dx < width; ++dx) {
+        screen.PixelAt(box_.x_min + dx, box_.y_min + dy) =
+            canvas.GetPixel(dx, dy);
+      }
+    }
+  }
+
+  ConstRef<TimeSeries> series_;
+  SparklineOption option_;
+};
+
+}  // namespace
+
+/// @brief Draw a TimeSeries, as a line chart made of braille dots. The samples
+/// are decimated to the width of the element, keeping their minimum and
+/// maximum.
+/// @param series the samples, or a pointer to them.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// TimeSeries latency(10000);
+/// ...
+/// Element document = timeSeries(&latency) | color(Color::Red) | border;
+/// ```
+Element timeSeries(ConstRef<TimeSeries> series) {
+  return MakeNode<TimeSeriesNode>(std::move(series));
+}
+
+/// @brief Draw the newest samples of a TimeSeries, as a sparkline a line high.
+/// Only the samples fitting in the element are visited, one per column, or two
+/// with braille dots. The range is the one of the whole TimeSeries, maintained
+/// as the samples are pushed.
+/// @param series the samples, or a pointer to them.
+/// @param option the characters used.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// TimeSeries load(60);
+/// ...
+/// Element document = hbox({
+///   text("load "),
+///   sparkline(&load) | size(WIDTH, EQUAL, 20),
+/// });
+/// ```
+Element sparkline(ConstRef<TimeSeries> series, SparklineOption option) {
+  return MakeNode<Sparkline>(std::move(series), option);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <algorithm>  // for max, min
+#include <cstddef>    // for size_t
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"     // for timeSeries, sparkline
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/dom/time_series.hpp"  // for TimeSeries
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+TEST(TimeSeriesTest, RingBuffer) {
+  TimeSeries series(4);
+  for (int i = 0; i < 6; ++i) {
+    series.Push(float(i));
+  }
+  EXPECT_EQ(series.size(), 4u);
+  EXPECT_EQ(series[0], 2.f);
+  EXPECT_EQ(series[3], 5.f);
+
+  series.Clear();
+  EXPECT_EQ(series.size(), 0u);
+  EXPECT_TRUE(series.Decimate(10).empty());
+}
+
+TEST(TimeSeriesTest, DecimateKeepsSpikes) {
+  TimeSeries series(1000);
+  for (int i = 0; i < 1000; ++i) {
+    series.Push(i == 501 ? 100.f : i == 733 ? -50.f : 0.f);
+  }
+  const auto& buckets = series.Decimate(10);
+  ASSERT_EQ(buckets.size(), 10u);
+  EXPECT_EQ(buckets[5].max, 100.f);
+  EXPECT_EQ(buckets[7].min, -50.f);
+  EXPECT_EQ(buckets[0].max, 0.f);
+}
+
+TEST(TimeSeriesTest, DecimateIncrementally) {
+  // Decimating after every sample must give the same buckets as decimating
+  // once at the end.
+  TimeSeries incremental(300);
+  TimeSeries once(300);
+  for (int i = 0; i < 2000; ++i) {
+    const float value = float((i * 37) % 101);
+    incremental.Push(value);
+    once.Push(value);
+    incremental.Decimate(40);
+  }
+  const std::vector<TimeSeries::Bucket> expected = once.Decimate(40);
+  const std::vector<TimeSeries::Bucket>& buckets = incremental.Decimate(40);
+  ASSERT_EQ(buckets.size(), expected.size());
+  EXPECT_LE(buckets.size(), 40u);
+  for (size_t i = 0; i < buckets.size(); ++i) {
+    EXPECT_EQ(buckets[i].min, expected[i].min);
+    EXPECT_EQ(buckets[i].max, expected[i].max);
+    EXPECT_EQ(buckets[i].first, expected[i].first);
+    EXPECT_EQ(buckets[i].last, expected[i].last);
+  }
+}
+
+TEST(TimeSeriesTest, Render) {
+  TimeSeries series(4);
+  for (int i = 0; i < 4; ++i) {
+    series.Push(float(i));
+  }
+  Screen screen(2, 1);
+  Render(screen, timeSeries(&series));
+  EXPECT_EQ(screen.ToString(), "⡠⠊");
+}
+
+TEST(TimeSeriesTest, RunningRange) {
+  TimeSeries series(7);
+  EXPECT_EQ(series.min(), 0.f);
+  for (int i = 0; i < 100; ++i) {
+    series.Push(float((i * 37) % 23));
+    float min = series[0];
+    float max = series[0];
+    for (size_t j = 0; j < series.size(); ++j) {
+      min = std::min(min, series[j]);
+      max = std::max(max, series[j]);
+    }
+    EXPECT_EQ(series.min(), min);
+    EXPECT_EQ(series.max(), max);
+  }
+
+  series.SetRange(-1.f, 1.f);
+  EXPECT_EQ(series.min(), -1.f);
+  EXPECT_EQ(series.max(), 1.f);
+}
+
+TEST(TimeSeriesTest, Sparkline) {
+  TimeSeries series(100);
+  for (int i = 0; i <= 8; ++i) {
+    series.Push(float(i));
+  }
+  Screen screen(12, 1);
+  Render(screen, sparkline(&series));
+  EXPECT_EQ(screen.ToString(), "   ▁▂▃▄▅▅▆▇█");
+
+  // Only the newest samples fit, in the range of the whole buffer.
+  Screen narrow(3, 1);
+  Render(narrow, sparkline(&series));
+  EXPECT_EQ(narrow.ToString(), "▆▇█");
+
+  Screen tall(1, 2);
+  Render(tall, sparkline(&series));
+  EXPECT_EQ(tall.ToString(), "█\r\n█");
+}
+
+TEST(TimeSeriesTest, SparklineBraille) {
+  TimeSeries series(4);
+  for (int i = 0; i < 4; ++i) {
+    series.Push(float(i));
+  }
+  Screen screen(3, 1);
+  Render(screen, sparkline(&series, {SparklineOption::Braille}));
+  EXPECT_EQ(screen.ToString(), " ⡠⠊");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
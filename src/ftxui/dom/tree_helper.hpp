@@ -0,0 +1,120 @@
+#ifndef FTXUI_DOM_TREE_HELPER_HPP
+#define FTXUI_DOM_TREE_HELPER_HPP
+
+#include <algorithm>      // for find_if, max, sort
+#include <cstddef>        // for size_t
+#include <string>         // for string, to_string
+#include <typeindex>      // for type_index
+#include <typeinfo>       // for type_info, typeid
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for pair
+#include <vector>         // for vector
+
+#include "ftxui/dom/profiler.hpp"  // for TreeReport
+
+namespace ftxui {
+namespace tree_helper {
+
+// The short name of |type|: "ftxui::(anonymous namespace)::Border" becomes
+// "Border". With FTXUI_PROFILE, "Profiled<Border>" is reported as "Border".
+std::string TypeName(const std::type_info& type);
+
+// Count the nodes of the tree of |root|, by type, with the memory they hold,
+// and find its |largest| biggest subtrees. See DescribeTree().
+//
+// |for_each_child(node, f)| calls f(index, child) for every child of |node|,
+// and |memory_usage(node)| returns the bytes it holds, without its children.
+template <class T, class ForEachChild, class MemoryUsage>
+TreeReport Describe(const T& root,
+                    size_t largest,
+                    const ForEachChild& for_each_child,
+                    const MemoryUsage& memory_usage) {
+  TreeReport report;
+  // The totals of every type, by name, and by type.
+  std::unordered_map<std::string, TreeReport::Type> by_name;
+  std::unordered_map<std::type_index, TreeReport::Type*> by_type;
+  // The names of the nodes from the root, with their index in their parent.
+  std::vector<std::pair<const std::string*, size_t>> path;
+
+  const auto path_string = [&] {
+    std::string out;
+    for (size_t i = 0; i < path.size(); ++i) {
+      if (i != 0) {
+        out += " > ";
+      }
+      out += *path[i].first;
+      if (i != 0) {
+        out += "[" + std::to_string(path[i].second) + "]";
+      }
+    }
+    return out;
+  };
+
+  // The number of nodes, and the depth, of the subtree of |node|.
+  const auto walk = [&](const auto& self, const T& node,
+                        size_t index) -> std::pair<size_t, int> {
+    auto it = by_type.find(typeid(node));
+    if (it == by_type.end()) {
+      std::string name = TypeName(typeid(node));
+      TreeReport::Type& type = by_name[name];
+      type.name = std::move(name);
+      it = by_type.emplace(typeid(node), &type).first;
+    }
+    TreeReport::Type& type = *it->second;
+    const size_t bytes = memory_usage(node);
+    type.count++;
+    type.bytes += bytes;
+    report.bytes += bytes;
+    path.emplace_back(&type.name, index);
+
+    size_t nodes = 1;
+    size_t biggest_child = 0;
+    int depth = 0;
+    for_each_child(node, [&](size_t i, const T& child) {
+      const auto subtree = self(self, child, i);
+      nodes += subtree.first;
+      biggest_child = std::max(biggest_child, subtree.first);
+      depth = std::max(depth, subtree.second);
+    });
+    depth++;
+
+    // Keep the |largest| biggest subtrees, sorted.
+    auto& subtrees = report.largest;
+    // Most of the descendants are in one child. The leaves are skipped too.
+    const bool wrapper = biggest_child * 10 >= (nodes - 1) * 9;  // NOLINT
+    if (!wrapper && largest != 0 &&
+        (subtrees.size() < largest || subtrees.back().nodes < nodes)) {
+      if (subtrees.size() == largest) {
+        subtrees.pop_back();
+      }
+      auto position =
+          std::find_if(subtrees.begin(), subtrees.end(),
+                       [&](const auto& s) { return s.nodes < nodes; });
+      subtrees.insert(position, {path_string(), nodes, depth});
+    }
+
+    path.pop_back();
+    return {nodes, depth};
+  };
+
+  const auto tree = walk(walk, root, 0);
+  report.nodes = tree.first;
+  report.depth = tree.second;
+  for (auto& [name, type] : by_name) {
+    report.types.push_back(std::move(type));
+  }
+  std::sort(report.types.begin(), report.types.end(),
+            [](const auto& a, const auto& b) {
+              return a.count != b.count ? a.count > b.count : a.name < b.name;
+            });
+  return report;
+}
+
+}  // namespace tree_helper
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_TREE_HELPER_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -6,7 +6,7 @@
 #include <vector>       // for vector
 
 #include "ftxui/dom/elements.hpp"  // for Element, Decorator, Elements, operator|, Fit, emptyElement, nothing, operator|=
-#include "ftxui/dom/node.hpp"      // for Node, Node::Status
+#include "ftxui/dom/node.hpp"      // for Node, Measure, LayoutResult
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Full
@@ -14,14 +14,6 @@
 
 namespace ftxui {
 
-namespace {
-Decorator compose(Decorator a, Decorator b) {
-  return [a = std::move(a), b = std::move(b)](Element element) {
-    return b(a(std::move(element)));
-  };
-}
-}  // namespace
-
 /// @brief A decoration doing absolutely nothing.
 /// @ingroup dom
 Element nothing(Element element) {
@@ -45,11 +37,10 @@ Decorator operator|(Decorator a, Decorator b) {
 /// @return the set of decorated element.
 /// @ingroup dom
 Elements operator|(Elements elements, Decorator decorator) {  // NOLINT
-  Elements output;
   for (auto& it : elements) {
-    output.push_back(std::move(it) | decorator);
+    it = decorator(std::move(it));
   }
-  return output;
+  return elements;
 }
 
 /// @brief From an element, apply a decorator.
@@ -81,7 +72,7 @@ Element operator|(Element element, Decorator decorator) {  // NOLINT
 /// element |= bold;
 /// ```
 Element& operator|=(Element& e, Decorator d) {
-  e = e | std::move(d);
+  e = d(std::move(e));
   return e;
 }
 
@@ -99,7 +90,7 @@ Dimensions Dimension::Fit(Element& e) {
   Node::Status status;
   e->Check(&status);
   const int max_iteration = 20;
-  while (status.need_iteration && status.iteration < max_iteration) {
+  while (status.iteration < max_iteration) {
     e->ComputeRequirement();
 
     // Don't give the element more space than it needs:
@@ -126,16 +117,56 @@ Dimensions Dimension::Fit(Element& e) {
   };
 }
 
+/// @brief Lay out an element into the minimal box fitting it, within the
+/// terminal. Unlike Fit(), the layout is kept:
+/// ```cpp
+/// LayoutResult layout = Dimension::FitLayout(document);
+/// auto screen = Screen::Create(layout.dimensions());
+/// Render(screen, layout);  // Doesn't lay out the document again.
+/// ```
+/// @see Fit
+/// @ingroup dom
+LayoutResult Dimension::FitLayout(Element element) {
+  const Dimensions fullsize = Dimension::Full();
+  Measure(element.get());
+
+  Box box;
+  Node::Status status;
+  const int max_iteration = 20;
+  while (true) {
+    // Don't give the element more space than it needs, but not more than the
+    // size of the terminal emulator either.
+    box.x_max = std::min(element->requirement().min_x, fullsize.dimx) - 1;
+    box.y_max = std::min(element->requirement().min_y, fullsize.dimy) - 1;
+    element->SetBox(box);
+
+    status.need_iteration = false;
+    status.iteration++;
+    element->Check(&status);
+    if (!status.need_iteration || status.iteration >= max_iteration) {
+      break;
+    }
+    element->ComputeRequirement();
+  }
+
+  LayoutResult layout;
+  layout.element = std::move(element);
+  layout.box = box;
+  layout.iterations = status.iteration;
+  return layout;
+}
+
 /// An element of size 0x0 drawing nothing.
 /// @ingroup dom
 Element emptyElement() {
   class Impl : public Node {
+   public:
     void ComputeRequirement() override {
       requirement_.min_x = 0;
       requirement_.min_y = 0;
     }
   };
-  return std::make_unique<Impl>();
+  return MakeNode<Impl>();
 }
 
 }  // namespace ftxui
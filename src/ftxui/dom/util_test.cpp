@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <string>   // for allocator, string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"  // for operator|, text, compose, Element
+#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/screen/color.hpp"  // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+
+namespace ftxui {
+
+namespace {
+Element Tag(Element element, const std::string& tag) {
+  return hbox({text(tag), std::move(element)});
+}
+
+std::string Draw(const Element& element) {
+  Screen screen(6, 1);
+  Render(screen, element);
+  return screen.ToString();
+}
+}  // namespace
+
+TEST(UtilTest, ComposeOrder) {
+  auto a = [](Element e) { return Tag(std::move(e), "a"); };
+  auto b = [](Element e) { return Tag(std::move(e), "b"); };
+  auto decorator = compose(a, b);
+  EXPECT_EQ(Draw(text("x") | decorator), Draw(text("x") | a | b));
+  EXPECT_EQ(Draw(text("x") | decorator), "bax   ");
+}
+
+TEST(UtilTest, ComposeAsDecorator) {
+  const Decorator decorator = compose(bold, color(Color::Red));
+  Screen screen(1, 1);
+  Render(screen, text("x") | decorator);
+  EXPECT_TRUE(screen.PixelAt(0, 0).bold);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::Red);
+}
+
+TEST(UtilTest, PipeElements) {
+  Elements elements = {text("a"), text("b")};
+  elements = std::move(elements) | compose(bold, inverted);
+  Screen screen(2, 1);
+  Render(screen, hbox(std::move(elements)));
+  EXPECT_TRUE(screen.PixelAt(0, 0).bold);
+  EXPECT_TRUE(screen.PixelAt(1, 0).inverted);
+}
+
+TEST(UtilTest, PipeAssign) {
+  Element element = text("x");
+  element |= [](Element e) { return Tag(std::move(e), "a"); };
+  EXPECT_EQ(Draw(element), "ax    ");
+  element |= compose(bold);
+  Screen screen(2, 1);
+  Render(screen, element);
+  EXPECT_TRUE(screen.PixelAt(1, 0).bold);
+}
+
+TEST(UtilTest, FitLayout) {
+  const Element document = vbox({
+      text("abc"),
+      text("de"),
+  });
+  const LayoutResult layout = Dimension::FitLayout(document);
+  EXPECT_EQ(layout.dimensions().dimx, 3);
+  EXPECT_EQ(layout.dimensions().dimy, 2);
+
+  auto screen = Screen::Create(layout.dimensions());
+  Render(screen, layout);
+  EXPECT_EQ(screen.ToString(),
+            "abc\r\n"
+            "de ");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
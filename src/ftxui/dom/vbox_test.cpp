@@ -4,8 +4,9 @@
 #include <string>     // for string, allocator, basic_string
 #include <vector>     // for vector
 
-#include "ftxui/dom/elements.hpp"  // for vtext, operator|, vbox, Element, flex_grow, flex_shrink
-#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/elements.hpp"  // for vtext, operator|, vbox, Element, flex_grow, flex_shrink, yframe, focus, reflect
+#include "ftxui/dom/node.hpp"       // for Node, Render
+#include "ftxui/screen/box.hpp"     // for Box
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 namespace ftxui {
@@ -17,6 +18,30 @@ std::string rotate(std::string str) {
   return str;
 }
 
+// A text element counting how many times it is drawn.
+class Counter : public Node {
+ public:
+  explicit Counter(int* count) : Node({text("x")}), count_(count) {}
+
+  void ComputeRequirement() override {
+    children_[0]->ComputeRequirement();
+    requirement_ = children_[0]->requirement();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    children_[0]->SetBox(box);
+  }
+
+  void Render(Screen& screen) override {
+    (*count_)++;
+    Node::Render(screen);
+  }
+
+ private:
+  int* count_;
+};
+
 }  // namespace
 
 TEST(VBoxText, NoFlex_NoFlex_NoFlex) {
@@ -364,6 +389,36 @@ TEST(VBoxText, FlexGrow_NoFlex_FlewShrink) {
   }
 }
 
+TEST(VBoxTest, OffscreenChildrenAreNotDrawn) {
+  int count = 0;
+  Elements lines;
+  for (int i = 0; i < 100; ++i) {
+    lines.push_back(MakeNode<Counter>(&count));
+  }
+  lines[50] = lines[50] | focus;
+  Screen screen(1, 5);
+  Render(screen, vbox(std::move(lines)) | yframe);
+  EXPECT_EQ(count, 5);
+  EXPECT_EQ(screen.ToString(), "x\r\nx\r\nx\r\nx\r\nx");
+}
+
+TEST(VBoxTest, OffscreenReflect) {
+  Box visible;
+  Box hidden;
+  auto frame = vbox({
+                   text("a") | reflect(visible),
+                   text("b"),
+                   text("c") | reflect(hidden),
+               }) |
+               yframe | size(HEIGHT, EQUAL, 2);
+  Screen screen(1, 3);
+  Render(screen, vbox({frame, text("d")}));
+  EXPECT_EQ(screen.ToString(), "a\r\nb\r\nd");
+  EXPECT_TRUE(visible.Contain(0, 0));
+  // "c" is hidden by the frame. It must not be reported over "d".
+  EXPECT_FALSE(hidden.Contain(0, 2));
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -0,0 +1,108 @@
+#include <algorithm>   // for max, min
+#include <functional>  // for function
+#include <memory>      // for make_shared
+#include <utility>     // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, virtualList
+#include "ftxui/dom/node.hpp"         // for Node, ComputeLayout
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// The rows are created only when drawn, and only the ones intersecting the
+// stencil. The layout never visits the others.
+class VirtualList : public Node {
+ public:
+  VirtualList(int count,
+              int row_height,
+              std::function<Element(int)> row,
+              int selected)
+      : count_(std::max(0, count)),
+        row_height_(std::max(1, row_height)),
+        row_(std::move(row)),
+        selected_(std::max(0, std::min(selected, count_ - 1))) {}
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement();
+    requirement_.min_y = count_ * row_height_;
+    if (count_ == 0) {
+      return;
+    }
+
+    // The width is estimated from the selected row.
+    Element selected = row_(selected_);
+    selected->ComputeRequirement();
+    requirement_.min_x = selected->requirement().min_x;
+
+    requirement_.selection = Requirement::SELECTED;
+    requirement_.selected_box.x_min = 0;
+    requirement_.selected_box.x_max = requirement_.min_x - 1;
+    requirement_.selected_box.y_min = selected_ * row_height_;
+    requirement_.selected_box.y_max = (selected_ + 1) * row_height_ - 1;
+  }
+
+  void Render(Screen& screen) override {
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min(box_.y_max, screen.stencil.y_max);
+    if (y_min > y_max || count_ == 0) {
+      return;
+    }
+    const int first = (y_min - box_.y_min) / row_height_;
+    const int last = std::min(count_ - 1, (y_max - box_.y_min) / row_height_);
+    for (int i = first; i <= last; ++i) {
+      Box box = box_;
+      box.y_min = box_.y_min + i * row_height_;
+      box.y_max = box.y_min + row_height_ - 1;
+      Element row = row_(i);
+      ComputeLayout(row.get(), box);
+      row->Render(screen);
+    }
+  }
+
+ private:
+  const int count_;
+  const int row_height_;
+  std::function<Element(int)> row_;
+  const int selected_;
+};
+
+}  // namespace
+
+/// @brief A list of |count| rows of |row_height| lines, created on demand.
+/// Only the rows intersecting the visible area are created, laid out and drawn.
+/// The cost doesn't depend on |count|. Use it inside a frame, to display a
+/// large number of rows.
+/// @param count The number of rows.
+/// @param row_height The height of every row.
+/// @param row Create the row at a given index.
+/// @param selected The index of the row the frame must keep visible.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// auto document = virtualList(
+///     1'000'000, 1,
+///     [&](int i) {
+///       auto row = text(results[i]);
+///       return i == selected ? row | inverted : row;
+///     },
+///     selected) |
+///     vscroll_indicator | yframe;
+/// ```
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> row,
+                    int selected) {
+  return MakeNode<VirtualList>(count, row_height, std::move(row), selected);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator, to_string, string
+
+#include "ftxui/dom/elements.hpp"  // for virtualList, text, yframe, vbox, Element
+#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+const int kMillion = 1'000'000;
+}  // namespace
+
+TEST(VirtualListTest, Basic) {
+  auto element = virtualList(3, 1, [](int i) { return text(std::to_string(i)); });
+  Screen screen(2, 4);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "0 \r\n"
+            "1 \r\n"
+            "2 \r\n"
+            "  ");
+}
+
+TEST(VirtualListTest, OnlyVisibleRowsAreCreated) {
+  int created = 0;
+  auto row = [&](int i) {
+    created++;
+    return text(std::to_string(i));
+  };
+  auto element = virtualList(kMillion, 1, row, 500'000) | yframe;
+  Screen screen(6, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "499999\r\n"
+            "500000\r\n"
+            "500001");
+  EXPECT_LE(created, 10);
+}
+
+TEST(VirtualListTest, RowHeight) {
+  auto row = [](int i) {
+    return vbox({text(std::to_string(i)), text("-")});
+  };
+  auto element = virtualList(kMillion, 2, row, 10) | yframe;
+  Screen screen(2, 4);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "- \r\n"
+            "10\r\n"
+            "- \r\n"
+            "11");
+}
+
+TEST(VirtualListTest, Empty) {
+  auto element = virtualList(0, 1, [](int) { return text("x"); });
+  Screen screen(2, 2);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "  \r\n"
+            "  ");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,487 @@
+#include <algorithm>   // for max, min, sort
+#include <functional>  // for function
+#include <string>      // for string
+#include <utility>     // for move, swap, pair
+#include <vector>      // for vector
+
+#include "ftxui/dom/elements.hpp"  // for Element, operator|, size, gridbox, align_right, hcenter, EQUAL, HEIGHT, WIDTH
+#include "ftxui/dom/node.hpp"         // for Node, ComputeLayout
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/table.hpp"        // for VirtualTable, VirtualTableSelection, TableSelection, Table
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for string_width
+
+namespace ftxui {
+namespace {
+
+// The number of rows the width of the columns is sampled from.
+const int kSampledRows = 100;
+
+int Wrap(int input, int modulo) {
+  input %= modulo;
+  input += modulo;
+  input %= modulo;
+  return input;
+}
+
+void Order(int& a, int& b) {
+  if (a >= b) {
+    std::swap(a, b);
+  }
+}
+
+// The number of even integers in [0, n].
+int Evens(int n) {
+  return n < 0 ? 0 : n / 2 + 1;
+}
+
+}  // namespace
+
+// The Node drawing the visible rows of a VirtualTable.
+class VirtualTable::Rows : public Node {
+ public:
+  Rows(VirtualTable table, int selected)
+      : table_(std::move(table)),
+        selected_(std::max(0, std::min(selected, table_.rows_ - 1))) {
+    for (int width : table_.widths_) {
+      width_ += width;
+    }
+    for (bool separator : table_.separator_columns_) {
+      width_ += separator ? 1 : 0;
+    }
+  }
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement();
+    requirement_.min_x = width_;
+    requirement_.min_y = table_.LinesBefore(2 * table_.rows_ + 1);
+    if (table_.rows_ == 0) {
+      return;
+    }
+    const int line = table_.LinesBefore(2 * selected_ + 1);
+    requirement_.selection = Requirement::SELECTED;
+    requirement_.selected_box.x_min = 0;
+    requirement_.selected_box.x_max = width_ - 1;
+    requirement_.selected_box.y_min = line;
+    requirement_.selected_box.y_max = line;
+  }
+
+  void Render(Screen& screen) override {
+    const int top = std::max(box_.y_min, screen.stencil.y_min) - box_.y_min;
+    const int bottom = std::min(box_.y_max, screen.stencil.y_max) - box_.y_min;
+    if (top > bottom || table_.rows_ == 0) {
+      return;
+    }
+
+    // The first row ending below |top|, and the last row starting above
+    // |bottom|.
+    int first = 0;
+    int last = table_.rows_ - 1;
+    for (int min = 0, max = table_.rows_ - 1; min <= max;) {
+      const int middle = min + (max - min) / 2;
+      if (table_.LinesBefore(2 * middle + 2) > top) {
+        first = middle;
+        max = middle - 1;
+      } else {
+        min = middle + 1;
+      }
+    }
+    for (int min = first, max = table_.rows_ - 1; min <= max;) {
+      const int middle = min + (max - min) / 2;
+      if (table_.LinesBefore(2 * middle) <= bottom) {
+        last = middle;
+        min = middle + 1;
+      } else {
+        max = middle - 1;
+      }
+    }
+
+    Box box;
+    box.x_min = box_.x_min;
+    box.x_max = box_.x_min + width_ - 1;
+    box.y_min = box_.y_min + table_.LinesBefore(2 * first);
+    box.y_max = box_.y_min + table_.LinesBefore(2 * last + 3) - 1;
+    Element rows = table_.RenderRows(first, last);
+    ComputeLayout(rows.get(), box);
+    rows->Render(screen);
+  }
+
+ private:
+  VirtualTable table_;
+  int selected_;
+  int width_ = 0;
+};
+
+VirtualTable::VirtualTable(int rows, int columns, RowProvider row)
+    : rows_(std::max(0, rows)),
+      columns_(std::max(0, columns)),
+      row_(std::move(row)),
+      widths_(columns_, -1),
+      alignments_(columns_, TableAlign::Left),
+      separator_columns_(2 * columns_ + 1, false) {}
+
+/// @brief Set the width of a column, instead of sampling it from the first
+/// rows.
+void VirtualTable::SetColumnWidth(int column, int width) {
+  widths_[Wrap(column, columns_)] = std::max(0, width);
+}
+
+/// @brief Set where the cells narrower than the column are drawn. They are
+/// aligned to the left by default.
+void VirtualTable::SetColumnAlignment(int column, TableAlign align) {
+  alignments_[Wrap(column, columns_)] = align;
+}
+
+VirtualTableSelection VirtualTable::SelectRow(int index) {
+  return SelectRectangle(0, -1, index, index);
+}
+
+VirtualTableSelection VirtualTable::SelectRows(int row_min, int row_max) {
+  return SelectRectangle(0, -1, row_min, row_max);
+}
+
+VirtualTableSelection VirtualTable::SelectColumn(int index) {
+  return SelectRectangle(index, index, 0, -1);
+}
+
+VirtualTableSelection VirtualTable::SelectColumns(int column_min,
+                                                  int column_max) {
+  return SelectRectangle(column_min, column_max, 0, -1);
+}
+
+VirtualTableSelection VirtualTable::SelectCell(int column, int row) {
+  return SelectRectangle(column, column, row, row);
+}
+
+VirtualTableSelection VirtualTable::SelectRectangle(int column_min,
+                                                    int column_max,
+                                                    int row_min,
+                                                    int row_max) {
+  column_min = Wrap(column_min, columns_);
+  column_max = Wrap(column_max, columns_);
+  Order(column_min, column_max);
+  row_min = Wrap(row_min, rows_);
+  row_max = Wrap(row_max, rows_);
+  Order(row_min, row_max);
+
+  VirtualTableSelection output;  // NOLINT
+  output.table_ = this;
+  output.x_min_ = 2 * column_min;
+  output.x_max_ = 2 * column_max + 2;
+  output.y_min_ = 2 * row_min;
+  output.y_max_ = 2 * row_max + 2;
+  return output;
+}
+
+VirtualTableSelection VirtualTable::SelectAll() {
+  VirtualTableSelection output;  // NOLINT
+  output.table_ = this;
+  output.x_min_ = 0;
+  output.x_max_ = 2 * columns_;
+  output.y_min_ = 0;
+  output.y_max_ = 2 * rows_;
+  return output;
+}
+
+/// @brief Draw the table. Only the rows visible are created.
+/// @param selected The row the frame must keep visible.
+Element VirtualTable::Render(int selected) {
+  // Sample the width of the columns not set, once.
+  std::vector<int> sampled;
+  for (int column = 0; column < columns_; ++column) {
+    if (widths_[column] < 0) {
+      sampled.push_back(column);
+      widths_[column] = 0;
+    }
+  }
+  const int sampled_rows = sampled.empty() ? 0 : std::min(rows_, kSampledRows);
+  for (int row = 0; row < sampled_rows; ++row) {
+    std::vector<std::string> cells = row_(row);
+    for (int column : sampled) {
+      if (column < (int)cells.size()) {
+        widths_[column] =
+            std::max(widths_[column], string_width(cells[column]));
+      }
+    }
+  }
+
+  // Merge the separator lines, to count them.
+  std::sort(separator_lines_.begin(), separator_lines_.end());
+  std::vector<std::pair<int, int>> merged;
+  for (auto line : separator_lines_) {
+    if (!merged.empty() && line.first <= merged.back().second + 1) {
+      merged.back().second = std::max(merged.back().second, line.second);
+    } else {
+      merged.push_back(line);
+    }
+  }
+  separator_lines_ = std::move(merged);
+
+  return MakeNode<Rows>(*this, selected);
+}
+
+// The number of lines taken by the grid lines [0, y). The rows take one line.
+// The lines between them take one, if a separator is drawn.
+int VirtualTable::LinesBefore(int y) const {
+  int lines = y / 2;
+  for (auto [min, max] : separator_lines_) {
+    max = std::min(max, y - 1);
+    if (min <= max) {
+      lines += Evens(max) - Evens(min - 1);
+    }
+  }
+  return lines;
+}
+
+bool VirtualTable::IsSeparatorLine(int y) const {
+  if (y % 2 == 1) {
+    return false;
+  }
+  for (auto [min, max] : separator_lines_) {
+    if (min <= y && y <= max) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Build the Table of the rows [first, last], with the recorded styling.
+Element VirtualTable::RenderRows(int first, int last) const {
+  std::vector<std::vector<std::string>> cells;
+  cells.reserve(last - first + 1);
+  for (int row = first; row <= last; ++row) {
+    cells.push_back(row_(row));
+    cells.back().resize(columns_);
+  }
+  Table table(std::move(cells));
+
+  // Aligned before being decorated, so that the decorators cover the whole
+  // cell.
+  for (int y = 1; y < table.dim_y_; y += 2) {
+    for (int x = 1; x < table.dim_x_; x += 2) {
+      Element& element = table.elements_[y][x];
+      switch (alignments_[x / 2]) {
+        case TableAlign::Left:
+          break;
+        case TableAlign::Center:
+          element = hcenter(std::move(element));
+          break;
+        case TableAlign::Right:
+          element = align_right(std::move(element));
+          break;
+      }
+    }
+  }
+
+  for (const Operation& operation : operations_) {
+    TableSelection selection;  // NOLINT
+    selection.table_ = &table;
+    selection.x_min_ = operation.x_min;
+    selection.x_max_ = operation.x_max;
+    selection.y_min_ = operation.y_min - 2 * first;
+    selection.y_max_ = operation.y_max - 2 * first;
+    operation.apply(selection, first);
+  }
+
+  table.ApplyStyles();
+
+  // The size of the cells doesn't depend on the rows visible.
+  for (int y = 0; y < table.dim_y_; ++y) {
+    const int height = (y % 2 == 1 || IsSeparatorLine(y + 2 * first)) ? 1 : 0;
+    for (int x = 0; x < table.dim_x_; ++x) {
+      const int width =
+          (x % 2 == 1) ? widths_[x / 2] : (separator_columns_[x] ? 1 : 0);
+      Element& element = table.elements_[y][x];
+      element = std::move(element) | size(WIDTH, EQUAL, width) |
+                size(HEIGHT, EQUAL, height);
+    }
+  }
+  return gridbox(std::move(table.elements_));
+}
+
+void VirtualTableSelection::Record(
+    std::function<void(TableSelection&, int first_row)> apply) {
+  table_->operations_.push_back(
+      {x_min_, x_max_, y_min_, y_max_, std::move(apply)});
+}
+
+// A separator character is drawn in the columns [x_min, x_max], next to a
+// cell. The ones drawn at the corners of the cells take no space.
+void VirtualTableSelection::MarkColumns(int x_min, int x_max) {
+  for (int x = x_min; x <= x_max; ++x) {
+    if (x % 2 == 0) {
+      table_->separator_columns_[x] = true;
+    }
+  }
+}
+
+// A separator character is drawn in the lines [y_min, y_max], above or below
+// a cell.
+void VirtualTableSelection::MarkLines(int y_min, int y_max) {
+  table_->separator_lines_.emplace_back(y_min, y_max);
+}
+
+// NOLINTNEXTLINE
+void VirtualTableSelection::Decorate(Decorator decorator) {
+  Record([decorator](TableSelection& selection, int /*first_row*/) {
+    selection.Decorate(decorator);
+  });
+}
+
+// NOLINTNEXTLINE
+void VirtualTableSelection::DecorateCells(Decorator decorator) {
+  Record([decorator](TableSelection& selection, int /*first_row*/) {
+    selection.DecorateCells(decorator);
+  });
+}
+
+// NOLINTNEXTLINE
+void VirtualTableSelection::DecorateAlternateColumn(Decorator decorator,
+                                                    int modulo,
+                                                    int shift) {
+  Record([=](TableSelection& selection, int /*first_row*/) {
+    selection.DecorateAlternateColumn(decorator, modulo, shift);
+  });
+}
+
+// NOLINTNEXTLINE
+void VirtualTableSelection::DecorateAlternateRow(Decorator decorator,
+                                                 int modulo,
+                                                 int shift) {
+  Record([=](TableSelection& selection, int first_row) {
+    selection.DecorateAlternateRow(decorator, modulo,
+                                   Wrap(shift - first_row, modulo));
+  });
+}
+
+// NOLINTNEXTLINE
+void VirtualTableSelection::DecorateCellsAlternateColumn(Decorator decorator,
+                                                         int modulo,
+                                                         int shift) {
+  Record([=](TableSelection& selection, int /*first_row*/) {
+    selection.DecorateCellsAlternateColumn(decorator, modulo, shift);
+  });
+}
+
+// NOLINTNEXTLINE
+void VirtualTableSelection::DecorateCellsAlternateRow(Decorator decorator,
+                                                      int modulo,
+                                                      int shift) {
+  Record([=](TableSelection& selection, int first_row) {
+    selection.DecorateCellsAlternateRow(decorator, modulo,
+                                        Wrap(shift - first_row, modulo));
+  });
+}
+
+void VirtualTableSelection::Decorate(const Style& style) {
+  Record([style](TableSelection& selection, int /*first_row*/) {
+    selection.Decorate(style);
+  });
+}
+
+void VirtualTableSelection::DecorateCells(const Style& style) {
+  Record([style](TableSelection& selection, int /*first_row*/) {
+    selection.DecorateCells(style);
+  });
+}
+
+void VirtualTableSelection::DecorateAlternateColumn(const Style& style,
+                                                    int modulo,
+                                                    int shift) {
+  Record([=](TableSelection& selection, int /*first_row*/) {
+    selection.DecorateAlternateColumn(style, modulo, shift);
+  });
+}
+
+void VirtualTableSelection::DecorateAlternateRow(const Style& style,
+                                                 int modulo,
+                                                 int shift) {
+  Record([=](TableSelection& selection, int first_row) {
+    selection.DecorateAlternateRow(style, modulo,
+                                   Wrap(shift - first_row, modulo));
+  });
+}
+
+void VirtualTableSelection::DecorateCellsAlternateColumn(const Style& style,
+                                                         int modulo,
+                                                         int shift) {
+  Record([=](TableSelection& selection, int /*first_row*/) {
+    selection.DecorateCellsAlternateColumn(style, modulo, shift);
+  });
+}
+
+void VirtualTableSelection::DecorateCellsAlternateRow(const Style& style,
+                                                      int modulo,
+                                                      int shift) {
+  Record([=](TableSelection& selection, int first_row) {
+    selection.DecorateCellsAlternateRow(style, modulo,
+                                        Wrap(shift - first_row, modulo));
+  });
+}
+
+void VirtualTableSelection::Border(BorderStyle border) {
+  MarkColumns(x_min_, x_min_);
+  MarkColumns(x_max_, x_max_);
+  MarkLines(y_min_, y_min_);
+  MarkLines(y_max_, y_max_);
+  Record([border](TableSelection& selection, int /*first_row*/) {
+    selection.Border(border);
+  });
+}
+
+void VirtualTableSelection::BorderLeft(BorderStyle border) {
+  MarkColumns(x_min_, x_min_);
+  Record([border](TableSelection& selection, int /*first_row*/) {
+    selection.BorderLeft(border);
+  });
+}
+
+void VirtualTableSelection::BorderRight(BorderStyle border) {
+  MarkColumns(x_max_, x_max_);
+  Record([border](TableSelection& selection, int /*first_row*/) {
+    selection.BorderRight(border);
+  });
+}
+
+void VirtualTableSelection::BorderTop(BorderStyle border) {
+  MarkLines(y_min_, y_min_);
+  Record([border](TableSelection& selection, int /*first_row*/) {
+    selection.BorderTop(border);
+  });
+}
+
+void VirtualTableSelection::BorderBottom(BorderStyle border) {
+  MarkLines(y_max_, y_max_);
+  Record([border](TableSelection& selection, int /*first_row*/) {
+    selection.BorderBottom(border);
+  });
+}
+
+void VirtualTableSelection::Separator(BorderStyle border) {
+  MarkColumns(x_min_ + 1, x_max_ - 1);
+  MarkLines(y_min_ + 1, y_max_ - 1);
+  Record([border](TableSelection& selection, int /*first_row*/) {
+    selection.Separator(border);
+  });
+}
+
+void VirtualTableSelection::SeparatorVertical(BorderStyle border) {
+  MarkColumns(x_min_ + 1, x_max_ - 1);
+  Record([border](TableSelection& selection, int /*first_row*/) {
+    selection.SeparatorVertical(border);
+  });
+}
+
+void VirtualTableSelection::SeparatorHorizontal(BorderStyle border) {
+  MarkLines(y_min_ + 1, y_max_ - 1);
+  Record([border](TableSelection& selection, int /*first_row*/) {
+    selection.SeparatorHorizontal(border);
+  });
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
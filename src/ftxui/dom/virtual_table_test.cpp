@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator, string, to_string
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"  // for LIGHT, DOUBLE, yframe, inverted, operator|
+#include "ftxui/dom/node.hpp"   // for Render
+#include "ftxui/dom/table.hpp"  // for VirtualTable, Table
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+std::vector<std::vector<std::string>> Cells(int rows) {
+  std::vector<std::vector<std::string>> cells;
+  for (int i = 0; i < rows; ++i) {
+    cells.push_back({std::to_string(i), "x" + std::to_string(i % 3)});
+  }
+  return cells;
+}
+
+std::vector<std::string> Row(int i) {
+  return {std::to_string(i), "x" + std::to_string(i % 3)};
+}
+
+std::string Draw(const Element& element, int width, int height) {
+  Screen screen(width, height);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(VirtualTableTest, SameAsTable) {
+  auto table = Table(Cells(4));
+  table.SelectAll().Border(LIGHT);
+  table.SelectRow(0).BorderBottom(DOUBLE);
+  table.SelectColumn(0).BorderRight(LIGHT);
+  table.SelectRows(1, -1).DecorateCellsAlternateRow(inverted);
+
+  auto virtual_table = VirtualTable(4, 2, Row);
+  virtual_table.SelectAll().Border(LIGHT);
+  virtual_table.SelectRow(0).BorderBottom(DOUBLE);
+  virtual_table.SelectColumn(0).BorderRight(LIGHT);
+  virtual_table.SelectRows(1, -1).DecorateCellsAlternateRow(inverted);
+
+  EXPECT_EQ(Draw(virtual_table.Render(), 6, 8), Draw(table.Render(), 6, 8));
+}
+
+TEST(VirtualTableTest, Style) {
+  Style stripe;
+  stripe.inverted = true;
+
+  auto table = Table(Cells(5));
+  table.SelectAll().Border(LIGHT);
+  table.SelectRows(1, -1).DecorateCellsAlternateRow(stripe);
+
+  auto virtual_table = VirtualTable(5, 2, Row);
+  virtual_table.SelectAll().Border(LIGHT);
+  virtual_table.SelectRows(1, -1).DecorateCellsAlternateRow(stripe);
+
+  EXPECT_EQ(Draw(virtual_table.Render(), 6, 7), Draw(table.Render(), 6, 7));
+}
+
+TEST(VirtualTableTest, Separator) {
+  auto table = Table(Cells(3));
+  table.SelectAll().Separator(LIGHT);
+
+  auto virtual_table = VirtualTable(3, 2, Row);
+  virtual_table.SelectAll().Separator(LIGHT);
+
+  EXPECT_EQ(Draw(virtual_table.Render(), 5, 5), Draw(table.Render(), 5, 5));
+}
+
+TEST(VirtualTableTest, OnlyVisibleRowsAreCreated) {
+  int created = 0;
+  auto table = VirtualTable(500'000, 2, [&](int i) {
+    created++;
+    return Row(i);
+  });
+  table.SetColumnWidth(0, 6);
+  table.SelectAll().Border(LIGHT);
+  table.SelectRow(0).BorderBottom(LIGHT);
+
+  EXPECT_EQ(Draw(table.Render(250'000) | yframe, 10, 3),
+            "│249999x0│\r\n"
+            "│250000x1│\r\n"
+            "│250001x2│");
+  // The rows sampled for the width, and the visible ones.
+  EXPECT_LE(created, 100 + 10);
+}
+
+TEST(VirtualTableTest, AlternateRowWhileScrolled) {
+  auto table = VirtualTable(1000, 2, Row);
+  table.SetColumnWidth(0, 3);
+  table.SelectAll().DecorateCellsAlternateRow(inverted);
+
+  Screen screen(5, 3);
+  Render(screen, table.Render(501) | yframe);
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[7m500x2\x1B[0m\r\n"
+            "501x0\r\n"
+            "\x1B[7m502x1\x1B[0m");
+  // The even rows are inverted, as in the whole table.
+  EXPECT_TRUE(screen.PixelAt(0, 0).inverted);
+  EXPECT_FALSE(screen.PixelAt(0, 1).inverted);
+  EXPECT_TRUE(screen.PixelAt(0, 2).inverted);
+}
+
+TEST(VirtualTableTest, ColumnWidth) {
+  auto table = VirtualTable(3, 2, Row);
+  table.SetColumnWidth(0, 3);
+  table.SelectAll().SeparatorVertical(LIGHT);
+  EXPECT_EQ(Draw(table.Render(), 7, 3),
+            "0  │x0 \r\n"
+            "1  │x1 \r\n"
+            "2  │x2 ");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,261 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>  // for int64_t
+#include <string>   // for string
+
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for string_width, Utf8ToGlyphs
+#include "ftxui/screen/terminal.hpp"  // for SetColorSupport
+
+namespace ftxui {
+
+static void BenchmarkResetPosition(benchmark::State& state) {
+  const Screen screen(80, static_cast<int>(state.range(0)));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(screen.ResetPosition());
+  }
+}
+BENCHMARK(BenchmarkResetPosition)->Range(1, 256);
+
+static void BenchmarkResetPositionClear(benchmark::State& state) {
+  const Screen screen(80, static_cast<int>(state.range(0)));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(screen.ResetPosition(/*clear=*/true));
+  }
+}
+BENCHMARK(BenchmarkResetPositionClear)->Range(1, 256);
+
+// A grid of crossing separators, all of them merged, on a screen of
+// state.range(0) rows.
+static void BenchmarkApplyShader(benchmark::State& state) {
+  Screen screen(200, static_cast<int>(state.range(0)));
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    screen.Clear();
+    for (int y = 0; y < screen.dimy(); ++y) {
+      for (int x = 0; x < screen.dimx(); ++x) {
+        if (x % 4 == 0 || y % 4 == 0) {
+          screen.PixelAt(x, y).character = x % 4 == 0 ? "│" : "─";
+          screen.PixelAt(x, y).automerge = true;
+        }
+      }
+    }
+    state.ResumeTiming();
+    screen.ApplyShader();
+  }
+}
+BENCHMARK(BenchmarkApplyShader)->Range(8, 256);
+
+// Plain text, on a screen of state.range(0) x state.range(0) / 3 cells.
+static void BenchmarkToString(benchmark::State& state) {
+  const int dimx = static_cast<int>(state.range(0));
+  Screen screen(dimx, dimx / 3);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      screen.PixelAt(x, y).character = std::string(1, char('a' + (x + y) % 26));
+    }
+  }
+  std::string out;
+  while (state.KeepRunning()) {
+    out.clear();
+    screen.ToString(out);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(out.size()));
+}
+BENCHMARK(BenchmarkToString)->RangeMultiplier(2)->Range(32, 512);
+
+// Like BenchmarkToString, but the colors and attributes change on every cell.
+static void BenchmarkToStringStyled(benchmark::State& state) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const int dimx = static_cast<int>(state.range(0));
+  Screen screen(dimx, dimx / 3);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      Pixel& pixel = screen.PixelAt(x, y);
+      pixel.character = std::string(1, char('a' + (x + y) % 26));
+      pixel.foreground_color = Color::RGB(x % 256, y % 256, (x * y) % 256);
+      pixel.background_color = Color::Palette256((x + y) % 256);
+      pixel.bold = x % 2 == 0;
+      pixel.underlined = y % 3 == 0;
+    }
+  }
+  std::string out;
+  while (state.KeepRunning()) {
+    out.clear();
+    screen.ToString(out);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(out.size()));
+}
+BENCHMARK(BenchmarkToStringStyled)->RangeMultiplier(2)->Range(32, 512);
+
+// Like BenchmarkToStringStyled, with the few styles of a typical interface.
+static void BenchmarkToStringFewStyles(benchmark::State& state) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const int dimx = static_cast<int>(state.range(0));
+  Screen screen(dimx, dimx / 3);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      const int style = (x / 4 + y) % 8;
+      Pixel& pixel = screen.PixelAt(x, y);
+      pixel.character = std::string(1, char('a' + (x + y) % 26));
+      pixel.foreground_color = Color::RGB(200, 32 * style, 100);
+      pixel.background_color = Color::Palette256(style);
+      pixel.bold = style % 2 == 0;
+      pixel.inverted = style % 3 == 0;
+    }
+  }
+  std::string out;
+  while (state.KeepRunning()) {
+    out.clear();
+    screen.ToString(out);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(out.size()));
+}
+BENCHMARK(BenchmarkToStringFewStyles)->RangeMultiplier(2)->Range(32, 512);
+
+// Like BenchmarkToStringStyled, without the styles.
+static void BenchmarkToPlainText(benchmark::State& state) {
+  const int dimx = static_cast<int>(state.range(0));
+  Screen screen(dimx, dimx / 3);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      Pixel& pixel = screen.PixelAt(x, y);
+      pixel.character = std::string(1, char('a' + (x + y) % 26));
+      pixel.foreground_color = Color::RGB(x % 256, y % 256, (x * y) % 256);
+      pixel.bold = x % 2 == 0;
+    }
+  }
+  std::string out;
+  while (state.KeepRunning()) {
+    screen.ToPlainText(out);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(out.size()));
+}
+BENCHMARK(BenchmarkToPlainText)->RangeMultiplier(2)->Range(32, 512);
+
+// A wide screen, where a single cell changes on every row.
+static void BenchmarkToStringDiff(benchmark::State& state) {
+  Screen previous(300, 80);
+  Screen next(300, 80);
+  for (int y = 0; y < next.dimy(); ++y) {
+    for (int x = 0; x < next.dimx(); ++x) {
+      previous.at(x, y) = "a";
+      next.at(x, y) = "a";
+    }
+    next.at((y * 7) % next.dimx(), y) = "b";
+  }
+  std::string out;
+  while (state.KeepRunning()) {
+    next.ToStringDiff(previous, out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BenchmarkToStringDiff);
+
+// A screen of emojis, fullwidth, and made of several codepoints.
+static void BenchmarkToStringEmoji(benchmark::State& state) {
+  auto screen = Screen::Create(Dimension::Fixed(80), Dimension::Fixed(24));
+  const char* emojis[] = {"🎅", "👍🏽", "👨‍👩‍👧‍👦", "测"};
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x + 1 < screen.dimx(); x += 2) {
+      screen.PixelAt(x, y).character = emojis[(x + y) % 4];
+    }
+  }
+  std::string out;
+  while (state.KeepRunning()) {
+    out.clear();
+    screen.ToString(out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BenchmarkToStringEmoji);
+
+// A gradient of RGB colors, displayed by a terminal supporting 256 colors.
+static void BenchmarkColorPalette256Fallback(benchmark::State& state) {
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  while (state.KeepRunning()) {
+    for (int i = 0; i < 256; ++i) {
+      benchmark::DoNotOptimize(Color::RGB(i, 255 - i, i / 2));
+    }
+  }
+}
+BENCHMARK(BenchmarkColorPalette256Fallback);
+
+// The rainbow of examples/dom/color_truecolor_HSV.cpp.
+static void BenchmarkColorHSV(benchmark::State& state) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  while (state.KeepRunning()) {
+    for (int value = 0; value < 256; value += 15) {
+      for (int hue = 0; hue < 256; ++hue) {
+        benchmark::DoNotOptimize(Color::HSV(hue, 255, value));
+        benchmark::DoNotOptimize(Color::HSV(hue, 255, 255));
+      }
+    }
+  }
+}
+BENCHMARK(BenchmarkColorHSV);
+
+// A log line, mostly ASCII.
+static void BenchmarkStringWidth(benchmark::State& state) {
+  std::string line;
+  for (int i = 0; i < 20; ++i) {
+    line += "[INFO] 2022-06-01 12:34:56 request served in 12ms ";
+  }
+  line += "✓";
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(string_width(line));
+  }
+}
+BENCHMARK(BenchmarkStringWidth);
+
+// A line of CJK characters, mixed with combining characters.
+static void BenchmarkStringWidthUnicode(benchmark::State& state) {
+  std::string line;
+  for (int i = 0; i < 20; ++i) {
+    line += "测试 ā 🪐 a⃒ ";
+  }
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(string_width(line));
+  }
+}
+BENCHMARK(BenchmarkStringWidthUnicode);
+
+// Split a line of state.range(0) repetitions of a ASCII, CJK, or emoji text,
+// as selected by state.range(1).
+static void BenchmarkUtf8ToGlyphs(benchmark::State& state) {
+  const char* texts[] = {"request served ", "测试文本 ", "👍🏽👨‍👩‍👧‍👦🎅 "};
+  std::string line;
+  for (int i = 0; i < state.range(0); ++i) {
+    line += texts[state.range(1)];
+  }
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(Utf8ToGlyphs(line));
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(line.size()));
+}
+BENCHMARK(BenchmarkUtf8ToGlyphs)->ArgsProduct({{1, 16, 256}, {0, 1, 2}});
+
+// Like BenchmarkUtf8ToGlyphs, for string_width.
+static void BenchmarkStringWidthSweep(benchmark::State& state) {
+  const char* texts[] = {"request served ", "测试文本 ", "👍🏽👨‍👩‍👧‍👦🎅 "};
+  std::string line;
+  for (int i = 0; i < state.range(0); ++i) {
+    line += texts[state.range(1)];
+  }
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(string_width(line));
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(line.size()));
+}
+BENCHMARK(BenchmarkStringWidthSweep)->ArgsProduct({{1, 16, 256}, {0, 1, 2}});
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,7 +1,11 @@
 #include "ftxui/screen/color.hpp"
 
 #include <array>        // for array
-#include <string_view>  // for literals
+#include <cmath>        // for sqrt
+#include <cstdint>      // for uint8_t
+#include <string>       // for string
+#include <string_view>  // for literals, string_view
+#include <type_traits>  // for is_trivially_copyable_v
 
 #include "ftxui/screen/color_info.hpp"  // for GetColorInfo, ColorInfo
 #include "ftxui/screen/terminal.hpp"  // for ColorSupport, Color, Palette256, TrueColor
@@ -30,34 +34,231 @@ const std::array<const char*, 33> palette16code = {
     "97", "107",  //
 };
 
-}  // namespace
+// A short precomputed string, like "255" or "48;5;255".
+struct SgrCode {
+  std::array<char, 8> data = {};  // NOLINT
+  uint8_t size = 0;
+
+  constexpr void Append(const char* value) {
+    while (*value != '\0') {
+      data[size++] = *value++;  // NOLINT
+    }
+  }
+
+  constexpr void Append(uint8_t value) {
+    // NOLINTBEGIN
+    if (value >= 100) {
+      data[size++] = char('0' + value / 100);
+    }
+    if (value >= 10) {
+      data[size++] = char('0' + value / 10 % 10);
+    }
+    data[size++] = char('0' + value % 10);
+    // NOLINTEND
+  }
+
+  std::string_view view() const { return {data.data(), size}; }
+};
+
+constexpr std::array<SgrCode, 256> MakeDecimalCodes() {
+  std::array<SgrCode, 256> codes = {};
+  for (int i = 0; i < 256; ++i) {  // NOLINT
+    codes[i].Append(uint8_t(i));   // NOLINT
+  }
+  return codes;
+}
+
+constexpr std::array<SgrCode, 256> MakePalette256Codes(const char* prefix) {
+  std::array<SgrCode, 256> codes = {};
+  for (int i = 0; i < 256; ++i) {  // NOLINT
+    codes[i].Append(prefix);       // NOLINT
+    codes[i].Append(uint8_t(i));   // NOLINT
+  }
+  return codes;
+}
+
+// The decimal representation of every uint8_t.
+constexpr std::array<SgrCode, 256> decimal_code = MakeDecimalCodes();
+
+// The SGR parameters of every Palette256 color, as foreground and background.
+constexpr std::array<std::array<SgrCode, 256>, 2> palette256code = {
+    MakePalette256Codes("38;5;"),
+    MakePalette256Codes("48;5;"),
+};
+
+// The palette of 256 colors starts with the 16 colors, followed by a 6x6x6
+// cube, and 24 grays.
+constexpr std::array<int, 6> cube_levels = {0, 95, 135, 175, 215, 255};
+constexpr int cube_begin = 16;
+constexpr int gray_begin = 232;
+constexpr int gray_count = 24;
+
+constexpr int Gray(int index) {
+  return 8 + 10 * index;  // NOLINT
+}
 
-bool Color::operator==(const Color& rhs) const {
-  return red_ == rhs.red_ && green_ == rhs.green_ && blue_ == rhs.blue_ &&
-         type_ == rhs.type_;
+// For every channel value, the index of the nearest cube level. Ties are
+// resolved toward the lowest.
+constexpr std::array<uint8_t, 256> MakeNearestCubeLevel() {
+  std::array<uint8_t, 256> table = {};
+  for (int value = 0; value < 256; ++value) {  // NOLINT
+    int best = 0;
+    for (int i = 1; i < 6; ++i) {  // NOLINT
+      const int distance = cube_levels[i] - value;
+      const int best_distance = cube_levels[best] - value;
+      if (distance * distance < best_distance * best_distance) {
+        best = i;
+      }
+    }
+    table[value] = uint8_t(best);  // NOLINT
+  }
+  return table;
 }
 
-bool Color::operator!=(const Color& rhs) const {
-  return !operator==(rhs);
+// For every sum of the three channels, the index of the nearest gray. The
+// distance to a gray only depends on its distance to the mean of the channels.
+constexpr std::array<uint8_t, 3 * 255 + 1> MakeNearestGray() {
+  std::array<uint8_t, 3 * 255 + 1> table = {};
+  for (int sum = 0; sum < int(table.size()); ++sum) {
+    int best = 0;
+    for (int i = 1; i < gray_count; ++i) {
+      const int distance = 3 * Gray(i) - sum;
+      const int best_distance = 3 * Gray(best) - sum;
+      if (distance * distance < best_distance * best_distance) {
+        best = i;
+      }
+    }
+    table[sum] = uint8_t(best);  // NOLINT
+  }
+  return table;
+}
+
+constexpr std::array<uint8_t, 256> nearest_cube_level = MakeNearestCubeLevel();
+constexpr std::array<uint8_t, 3 * 255 + 1> nearest_gray = MakeNearestGray();
+
+// The index of the nearest color of the 256 colors palette, excluding the 16
+// first ones, whose values depend on the terminal. This is equivalent to
+// searching the whole palette, keeping the first nearest color, but only costs
+// a few table lookups.
+uint8_t NearestPalette256(uint8_t red, uint8_t green, uint8_t blue) {
+  auto distance = [&](int r, int g, int b) {
+    return (r - red) * (r - red) +      //
+           (g - green) * (g - green) +  //
+           (b - blue) * (b - blue);
+  };
+
+  // The cube is a grid, the nearest point is the nearest level of every
+  // channel.
+  const int r = nearest_cube_level[red];    // NOLINT
+  const int g = nearest_cube_level[green];  // NOLINT
+  const int b = nearest_cube_level[blue];   // NOLINT
+  const int cube_distance =
+      distance(cube_levels[r], cube_levels[g], cube_levels[b]);  // NOLINT
+
+  const int gray = nearest_gray[red + green + blue];  // NOLINT
+  const int gray_distance = distance(Gray(gray), Gray(gray), Gray(gray));
+
+  // On ties, the cube comes first in the palette.
+  if (cube_distance <= gray_distance) {
+    return uint8_t(cube_begin + 36 * r + 6 * g + b);  // NOLINT
+  }
+  return uint8_t(gray_begin + gray);
+}
+
+struct RGBComponents {
+  uint8_t red = 0;
+  uint8_t green = 0;
+  uint8_t blue = 0;
+};
+
+// Convert HSV to RGB, using 8 bits fixed point arithmetic.
+constexpr RGBComponents HSVToRGB(uint8_t h, uint8_t s, uint8_t v) {
+  // NOLINTBEGIN
+  const uint8_t region = h / 43;
+  const uint8_t remainder = (h - (region * 43)) * 6;
+  const uint8_t p = (v * (255 - s)) >> 8;
+  const uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+  const uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+  // clang-format off
+  switch (region) {
+    case 0: return {v, t, p};
+    case 1: return {q, v, p};
+    case 2: return {p, v, t};
+    case 3: return {p, q, v};
+    case 4: return {t, p, v};
+    case 5: return {v, p, q};
+  }
+  // clang-format on
+  return {0, 0, 0};
+  // NOLINTEND
+}
+
+constexpr std::array<RGBComponents, 256> MakeHueWheel() {
+  std::array<RGBComponents, 256> wheel = {};
+  for (int h = 0; h < 256; ++h) {               // NOLINT
+    wheel[h] = HSVToRGB(uint8_t(h), 255, 255);  // NOLINT
+  }
+  return wheel;
+}
+
+// The fully saturated and bright color of every hue.
+constexpr std::array<RGBComponents, 256> hue_wheel = MakeHueWheel();
+
+}  // namespace
+
+// Colors are stored in Pixels, compared byte per byte, and packed. They must
+// remain small and trivially copyable.
+static_assert(sizeof(Color) == sizeof(uint32_t), "Color must be 32 bits");
+static_assert(std::is_trivially_copyable_v<Color>,
+              "Color must be trivially copyable");
+
+/// @brief Build a color from the value returned by Pack().
+/// @param packed The packed color.
+/// @ingroup screen
+// static
+Color Color::Unpack(uint32_t packed) {
+  Color color;
+  color.type_ = ColorType(packed & 0xFFU);  // NOLINT
+  color.red_ = uint8_t(packed >> 8U);       // NOLINT
+  color.green_ = uint8_t(packed >> 16U);    // NOLINT
+  color.blue_ = uint8_t(packed >> 24U);     // NOLINT
+  return color;
 }
 
 std::string Color::Print(bool is_background_color) const {
+  std::string out;
+  Print(out, is_background_color);
+  return out;
+}
+
+/// @brief Append the SGR parameters selecting this color to |out|.
+/// It doesn't allocate, besides growing |out| if needed.
+/// @param out The string to append the parameters to.
+/// @param is_background_color Whether this is the background color.
+void Color::Print(std::string& out, bool is_background_color) const {
   switch (type_) {
     case ColorType::Palette1:
-      return is_background_color ? "49"s : "39"s;
+      out += is_background_color ? "49"sv : "39"sv;
+      return;
 
     case ColorType::Palette16:
-      return palette16code[2 * red_ + is_background_color];  // NOLINT;
+      out += palette16code[2 * red_ + is_background_color];  // NOLINT;
+      return;
 
     case ColorType::Palette256:
-      return (is_background_color ? "48;5;"s : "38;5;"s) + std::to_string(red_);
+      out += palette256code[is_background_color][red_].view();  // NOLINT
+      return;
 
     case ColorType::TrueColor:
     default:
-      return (is_background_color ? "48;2;"s : "38;2;"s)  //
-             + std::to_string(red_) + ";"                 //
-             + std::to_string(green_) + ";"               //
-             + std::to_string(blue_);                     //
+      out += is_background_color ? "48;2;"sv : "38;2;"sv;
+      out += decimal_code[red_].view();  // NOLINT
+      out += ';';
+      out += decimal_code[green_].view();  // NOLINT
+      out += ';';
+      out += decimal_code[blue_].view();  // NOLINT
+      return;
   }
 }
 
@@ -96,24 +297,7 @@ Color::Color(uint8_t red, uint8_t green, uint8_t blue)
     return;
   }
 
-  // Find the closest Color from the database:
-  const int max_distance = 256 * 256 * 3;
-  int closest = max_distance;
-  int best = 0;
-  const int database_begin = 16;
-  const int database_end = 256;
-  for (int i = database_begin; i < database_end; ++i) {
-    const ColorInfo color_info = GetColorInfo(Color::Palette256(i));
-    const int dr = color_info.red - red;
-    const int dg = color_info.green - green;
-    const int db = color_info.blue - blue;
-    const int dist = dr * dr + dg * dg + db * db;
-    if (closest > dist) {
-      closest = dist;
-      best = i;
-    }
-  }
-
+  const uint8_t best = NearestPalette256(red, green, blue);
   if (Terminal::ColorSupport() == Terminal::Color::Palette256) {
     type_ = ColorType::Palette256;
     red_ = best;
@@ -148,23 +332,11 @@ Color Color::HSV(uint8_t h, uint8_t s, uint8_t v) {
     return {0, 0, 0};
   }
 
-  uint8_t region = h / 43;                                        // NOLINT
-  uint8_t remainder = (h - (region * 43)) * 6;                    // NOLINT
-  uint8_t p = (v * (255 - s)) >> 8;                               // NOLINT
-  uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;          // NOLINT
-  uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;  // NOLINT
-
-  // clang-format off
-  switch (region) {              // NOLINT
-    case 0: return Color(v,t,p); // NOLINT
-    case 1: return Color(q,v,p); // NOLINT
-    case 2: return Color(p,v,t); // NOLINT
-    case 3: return Color(p,q,v); // NOLINT
-    case 4: return Color(t,p,v); // NOLINT
-    case 5: return Color(v,p,q); // NOLINT
-  }                              // NOLINT
-  // clang-format on
-  return {0, 0, 0};
+  // The fully saturated and bright colors are commonly used to draw rainbows.
+  const RGBComponents rgb = (s == 255 && v == 255)  // NOLINT
+                                ? hue_wheel[h]       // NOLINT
+                                : HSVToRGB(h, s, v);
+  return {rgb.red, rgb.green, rgb.blue};
 }
 
 // static
@@ -178,47 +350,14 @@ Color Color::Interpolate(float t, const Color& a, const Color& b) {
     }
   }
 
-  auto get_color = [](const Color& color,  //
-                      uint8_t* red, uint8_t* green, uint8_t* blue) {
-    switch (color.type_) {
-      case ColorType::Palette1: {
-        return;
-      }
-
-      case ColorType::Palette16: {
-        const ColorInfo info = GetColorInfo(Color::Palette16(color.red_));
-        *red = info.red;
-        *green = info.green;
-        *blue = info.blue;
-        return;
-      }
-
-      case ColorType::Palette256: {
-        const ColorInfo info = GetColorInfo(Color::Palette256(color.red_));
-        *red = info.red;
-        *green = info.green;
-        *blue = info.blue;
-        return;
-      }
-
-      case ColorType::TrueColor:
-      default: {
-        *red = color.red_;
-        *green = color.green_;
-        *blue = color.blue_;
-        return;
-      }
-    }
-  };
-
   uint8_t red_a = 0;
   uint8_t green_a = 0;
   uint8_t blue_a = 0;
   uint8_t red_b = 0;
   uint8_t green_b = 0;
   uint8_t blue_b = 0;
-  get_color(a, &red_a, &green_a, &blue_a);
-  get_color(b, &red_b, &green_b, &blue_b);
+  a.GetRGB(&red_a, &green_a, &blue_a);
+  b.GetRGB(&red_b, &green_b, &blue_b);
 
   return Color::RGB(static_cast<uint8_t>(static_cast<float>(red_a) * (1 - t) +
                                          static_cast<float>(red_b) * t),
@@ -228,6 +367,96 @@ Color Color::Interpolate(float t, const Color& a, const Color& b) {
                                          static_cast<float>(blue_b) * t));
 }
 
+/// @brief Fill |stops| with colors going from |a| to |b|, evenly spaced. The
+/// first stop is |a|, the last one is |b|.
+///
+/// Unlike Interpolate(), the colors are interpolated in linear light, which
+/// looks more uniform. The gamma is approximated to 2, so that the conversions
+/// are only a square and a square root.
+/// @param a The first color.
+/// @param b The last color.
+/// @param stops The colors to fill.
+/// @ingroup screen
+// static
+void Color::Gradient(const Color& a, const Color& b, std::span<Color> stops) {
+  const size_t size = stops.size();
+  if (size == 0) {
+    return;
+  }
+
+  // The transparent color can't be interpolated.
+  if (a.type_ == ColorType::Palette1 ||  //
+      b.type_ == ColorType::Palette1) {
+    for (size_t i = 0; i < size; ++i) {
+      stops[i] = 2 * i < size ? a : b;
+    }
+    return;
+  }
+
+  uint8_t red_a = 0;
+  uint8_t green_a = 0;
+  uint8_t blue_a = 0;
+  uint8_t red_b = 0;
+  uint8_t green_b = 0;
+  uint8_t blue_b = 0;
+  a.GetRGB(&red_a, &green_a, &blue_a);
+  b.GetRGB(&red_b, &green_b, &blue_b);
+
+  // The channels in linear light.
+  auto linear = [](uint8_t value) { return float(value) * float(value); };
+  const float from[3] = {linear(red_a), linear(green_a), linear(blue_a)};
+  const float to[3] = {linear(red_b), linear(green_b), linear(blue_b)};
+
+  const float step = size == 1 ? 0.F : 1.F / float(size - 1);
+  for (size_t i = 0; i < size; ++i) {
+    const float t = float(i) * step;
+    float channel[3];  // NOLINT
+    for (int c = 0; c < 3; ++c) {
+      channel[c] = std::sqrt(from[c] + (to[c] - from[c]) * t);  // NOLINT
+    }
+    stops[i] = Color::RGB(uint8_t(channel[0] + 0.5F),   // NOLINT
+                          uint8_t(channel[1] + 0.5F),   // NOLINT
+                          uint8_t(channel[2] + 0.5F));  // NOLINT
+  }
+
+  // Keep the ends exact, including their palette.
+  stops.back() = b;
+  stops.front() = a;
+}
+
+/// The RGB components of a non transparent color.
+void Color::GetRGB(uint8_t* red, uint8_t* green, uint8_t* blue) const {
+  switch (type_) {
+    case ColorType::Palette1: {
+      return;
+    }
+
+    case ColorType::Palette16: {
+      const ColorInfo info = GetColorInfo(Color::Palette16(red_));
+      *red = info.red;
+      *green = info.green;
+      *blue = info.blue;
+      return;
+    }
+
+    case ColorType::Palette256: {
+      const ColorInfo info = GetColorInfo(Color::Palette256(red_));
+      *red = info.red;
+      *green = info.green;
+      *blue = info.blue;
+      return;
+    }
+
+    case ColorType::TrueColor:
+    default: {
+      *red = red_;
+      *green = green_;
+      *blue = blue_;
+      return;
+    }
+  }
+}
+
 inline namespace literals {
 
 Color operator""_rgb(unsigned long long int combined) {
@@ -1,5 +1,8 @@
 #include "ftxui/screen/color.hpp"
 #include <gtest/gtest.h>
+#include <string>  // for string, to_string
+#include <vector>  // for vector
+#include "ftxui/screen/color_info.hpp"  // for GetColorInfo, ColorInfo
 #include "ftxui/screen/terminal.hpp"
 
 namespace ftxui {
@@ -28,11 +31,59 @@ TEST(ColorTest, PrintTrueCOlor) {
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(true), "48;2;1;2;3");
 }
 
+TEST(ColorTest, PrintAppend) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  std::string out = "x";
+  Color(Color::Red).Print(out, false);
+  out += ';';
+  Color(Color::DarkRed).Print(out, true);
+  out += ';';
+  Color::RGB(1, 2, 3).Print(out, false);
+  EXPECT_EQ(out, "x31;48;5;52;38;2;1;2;3");
+}
+
 TEST(ColorTest, FallbackTo256) {
   Terminal::SetColorSupport(Terminal::Color::Palette256);
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "38;5;16");
 }
 
+TEST(ColorTest, FallbackTo256Nearest) {
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+
+  // The values around the middle of two levels of the cube, and some others.
+  std::vector<int> values = {47, 48, 114, 115, 116, 155, 195, 235, 254, 255};
+  for (int value = 0; value < 256; value += 9) {  // NOLINT
+    values.push_back(value);
+  }
+
+  // The first of the nearest colors, excluding the 16 first ones.
+  auto nearest = [](int red, int green, int blue) {
+    int best = 0;
+    int best_distance = 256 * 256 * 3;
+    for (int i = 16; i < 256; ++i) {
+      const ColorInfo info = GetColorInfo(Color::Palette256(i));
+      const int dr = info.red - red;
+      const int dg = info.green - green;
+      const int db = info.blue - blue;
+      const int distance = dr * dr + dg * dg + db * db;
+      if (distance < best_distance) {
+        best_distance = distance;
+        best = i;
+      }
+    }
+    return best;
+  };
+
+  for (int red : values) {
+    for (int green : values) {
+      for (int blue : values) {
+        EXPECT_EQ(Color::RGB(red, green, blue).Print(false),
+                  "38;5;" + std::to_string(nearest(red, green, blue)));
+      }
+    }
+  }
+}
+
 TEST(ColorTest, FallbackTo16) {
   Terminal::SetColorSupport(Terminal::Color::Palette16);
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "30");
@@ -75,9 +126,26 @@ TEST(ColorTest, Interpolate) {
             "38;2;251;195;215");
 }
 
+TEST(ColorTest, Pack) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  for (const Color color : {
+           Color(),
+           Color(Color::Red),
+           Color(Color::DarkRed),
+           Color::RGB(1, 2, 3),
+       }) {
+    EXPECT_EQ(Color::Unpack(color.Pack()), color);
+  }
+  EXPECT_NE(Color::RGB(1, 2, 3).Pack(), Color::RGB(1, 2, 4).Pack());
+  EXPECT_NE(Color(Color::Red).Pack(), Color(Color::Palette256(1)).Pack());
+}
+
 TEST(ColorTest, HSV) {
   Terminal::SetColorSupport(Terminal::Color::TrueColor);
   EXPECT_EQ(Color::HSV(0, 255, 255).Print(false), "38;2;255;0;0");
+  EXPECT_EQ(Color::HSV(85, 255, 255).Print(false), "38;2;3;255;0");
+  EXPECT_EQ(Color::HSV(0, 255, 128).Print(false), "38;2;128;0;0");
+  EXPECT_EQ(Color::HSV(200, 128, 200).Print(false), "38;2;165;99;200");
 }
 
 }  // namespace ftxui
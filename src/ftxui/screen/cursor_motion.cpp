@@ -0,0 +1,177 @@
+#include "ftxui/screen/cursor_motion.hpp"
+
+#include <cstdlib>  // for abs
+
+#include "ftxui/screen/util.hpp"  // for AppendInt, DigitCount
+
+namespace ftxui {
+
+namespace {
+
+using util::AppendInt;
+using util::DigitCount;
+
+// The cost of "CSI n <command>". The parameter is omitted when it is 1, its
+// default value.
+int SequenceCost(int n) {
+  return n == 1 ? 3 : 3 + DigitCount(n);
+}
+
+void AppendSequence(std::string& out, int n, char command) {
+  out += "\x1B[";
+  if (n != 1) {
+    AppendInt(out, n);
+  }
+  out += command;
+}
+
+enum class Vertical {
+  None,
+  Relative,  // CUU or CUD.
+  LineFeed,  // Some "\n". The column is unknown afterward.
+};
+
+enum class Horizontal {
+  None,
+  Return,         // "\r".
+  ReturnForward,  // "\r" + CUF.
+  Absolute,       // CHA.
+  Forward,        // CUF.
+  Backward,       // CUB.
+};
+
+// The shortest horizontal move from |from| (negative when unknown) to |to|.
+int HorizontalCost(int from, int to, Horizontal* choice) {
+  int cost = 0;
+  if (from == to) {
+    *choice = Horizontal::None;
+    return 0;
+  }
+
+  if (to == 0) {
+    *choice = Horizontal::Return;
+    cost = 1;
+  } else {
+    *choice = Horizontal::ReturnForward;
+    cost = 1 + SequenceCost(to);
+  }
+
+  auto consider = [&](Horizontal candidate, int candidate_cost) {
+    if (candidate_cost < cost) {
+      *choice = candidate;
+      cost = candidate_cost;
+    }
+  };
+  if (from >= 0 && to > from) {
+    consider(Horizontal::Forward, SequenceCost(to - from));
+  }
+  if (from >= 0 && to < from) {
+    consider(Horizontal::Backward, SequenceCost(from - to));
+  }
+  consider(Horizontal::Absolute, SequenceCost(to + 1));
+  return cost;
+}
+
+}  // namespace
+
+struct CursorMotion::Plan {
+  int cost = 0;
+  bool absolute = false;  // CUP.
+  Vertical vertical = Vertical::None;
+  Horizontal horizontal = Horizontal::None;
+};
+
+CursorMotion::Plan CursorMotion::Compute(CursorPosition from,
+                                         CursorPosition to) const {
+  const int dy = to.y - from.y;
+
+  // Relative vertical move, keeping the column.
+  Plan plan;
+  plan.vertical = dy == 0 ? Vertical::None : Vertical::Relative;
+  plan.cost = (dy == 0 ? 0 : SequenceCost(std::abs(dy))) +
+              HorizontalCost(from.x, to.x, &plan.horizontal);
+
+  // Line feeds. Depending on the terminal settings, they might also return to
+  // the first column, so the column is unknown afterward.
+  if (dy > 0) {
+    Plan line_feed;
+    line_feed.vertical = Vertical::LineFeed;
+    line_feed.cost = dy + HorizontalCost(-1, to.x, &line_feed.horizontal);
+    if (line_feed.cost < plan.cost) {
+      plan = line_feed;
+    }
+  }
+
+  // Absolute position.
+  if (top_ >= 0) {
+    Plan absolute;
+    absolute.absolute = true;
+    absolute.cost = 3 + DigitCount(top_ + to.y + 1) +
+                    (to.x == 0 ? 0 : 1 + DigitCount(to.x + 1));
+    if (absolute.cost < plan.cost) {
+      plan = absolute;
+    }
+  }
+
+  return plan;
+}
+
+int CursorMotion::Cost(CursorPosition from, CursorPosition to) const {
+  return Compute(from, to).cost;
+}
+
+void CursorMotion::Move(std::string& out,
+                        CursorPosition from,
+                        CursorPosition to) const {
+  const Plan plan = Compute(from, to);
+
+  if (plan.absolute) {
+    out += "\x1B[";  // CUP
+    AppendInt(out, top_ + to.y + 1);
+    if (to.x != 0) {
+      out += ';';
+      AppendInt(out, to.x + 1);
+    }
+    out += 'H';
+    return;
+  }
+
+  const int dy = to.y - from.y;
+  switch (plan.vertical) {
+    case Vertical::None:
+      break;
+    case Vertical::Relative:
+      AppendSequence(out, std::abs(dy), dy > 0 ? 'B' : 'A');  // CUD / CUU
+      break;
+    case Vertical::LineFeed:
+      out.append(dy, '\n');
+      break;
+  }
+
+  switch (plan.horizontal) {
+    case Horizontal::None:
+      break;
+    case Horizontal::Return:
+      out += '\r';
+      break;
+    case Horizontal::ReturnForward:
+      out += '\r';
+      AppendSequence(out, to.x, 'C');  // CUF
+      break;
+    case Horizontal::Absolute:
+      AppendSequence(out, to.x + 1, 'G');  // CHA
+      break;
+    case Horizontal::Forward:
+      AppendSequence(out, to.x - from.x, 'C');  // CUF
+      break;
+    case Horizontal::Backward:
+      AppendSequence(out, from.x - to.x, 'D');  // CUB
+      break;
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,52 @@
+#ifndef FTXUI_SCREEN_CURSOR_MOTION_HPP
+#define FTXUI_SCREEN_CURSOR_MOTION_HPP
+
+#include <string>  // for string
+
+namespace ftxui {
+
+// A position of the terminal cursor, relative to the top-left corner of the
+// frame. A negative |x| means the column is unknown. This is the case after
+// writing the last column of the terminal, since terminals disagree on where
+// they leave the cursor there.
+struct CursorPosition {
+  int x = 0;
+  int y = 0;
+};
+
+// Plan the shortest sequence moving the terminal cursor in between two
+// positions. This is similar to the cost model of ncurses' `mvcur`. The
+// candidates are:
+// - relative moves (CUU, CUD, CUF, CUB),
+// - line feeds and carriage returns,
+// - moving to an absolute column (CHA),
+// - moving to an absolute position (CUP), when the terminal row displaying the
+//   first row of the frame is known.
+// Rewriting the cells in between is left to the caller, comparing its cost
+// with Cost().
+class CursorMotion {
+ public:
+  // |top| is the terminal row, starting from 0, displaying the first row of
+  // the frame. It is negative when unknown.
+  explicit CursorMotion(int top = -1) : top_(top) {}
+
+  // The number of bytes of the shortest sequence moving from |from| to |to|.
+  int Cost(CursorPosition from, CursorPosition to) const;
+
+  // Append the shortest sequence moving from |from| to |to| to |out|.
+  void Move(std::string& out, CursorPosition from, CursorPosition to) const;
+
+ private:
+  struct Plan;
+  Plan Compute(CursorPosition from, CursorPosition to) const;
+
+  int top_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_SCREEN_CURSOR_MOTION_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,56 @@
+#include "ftxui/screen/cursor_motion.hpp"
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+namespace ftxui {
+
+namespace {
+std::string Move(const CursorMotion& motion,
+                 CursorPosition from,
+                 CursorPosition to) {
+  std::string out;
+  motion.Move(out, from, to);
+  EXPECT_EQ(int(out.size()), motion.Cost(from, to));
+  return out;
+}
+}  // namespace
+
+TEST(CursorMotionTest, Relative) {
+  const CursorMotion motion;
+  EXPECT_EQ(Move(motion, {3, 2}, {3, 2}), "");
+  EXPECT_EQ(Move(motion, {3, 2}, {4, 2}), "\x1B[C");
+  EXPECT_EQ(Move(motion, {3, 2}, {20, 2}), "\x1B[17C");
+  EXPECT_EQ(Move(motion, {20, 2}, {17, 2}), "\x1B[3D");
+  EXPECT_EQ(Move(motion, {3, 2}, {3, 0}), "\x1B[2A");
+  EXPECT_EQ(Move(motion, {3, 2}, {3, 15}), "\x1B[13B");
+}
+
+TEST(CursorMotionTest, CarriageReturnAndLineFeed) {
+  const CursorMotion motion;
+  EXPECT_EQ(Move(motion, {30, 2}, {0, 2}), "\r");
+  EXPECT_EQ(Move(motion, {30, 2}, {0, 3}), "\n\r");
+}
+
+TEST(CursorMotionTest, AbsoluteColumn) {
+  const CursorMotion motion;
+  // The column is unknown, after writing the last one.
+  EXPECT_EQ(Move(motion, {-1, 2}, {0, 2}), "\r");
+  EXPECT_EQ(Move(motion, {-1, 2}, {12, 2}), "\x1B[13G");
+  // Shorter than "\r\x1B[2C" and than going backward.
+  EXPECT_EQ(Move(motion, {30, 2}, {2, 2}), "\x1B[3G");
+  EXPECT_EQ(Move(motion, {200, 2}, {5, 2}), "\x1B[6G");
+}
+
+TEST(CursorMotionTest, AbsolutePosition) {
+  const CursorMotion motion(/*top=*/0);
+  EXPECT_EQ(Move(motion, {40, 30}, {0, 0}), "\x1B[1H");
+  EXPECT_EQ(Move(motion, {40, 30}, {52, 2}), "\x1B[3;53H");
+  // Relative moves are still used when shorter.
+  EXPECT_EQ(Move(motion, {40, 30}, {41, 30}), "\x1B[C");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,403 @@
+#include "ftxui/screen/frame_protocol.hpp"
+
+#include <algorithm>    // for max
+#include <cstdint>      // for uint8_t, uint32_t, uint64_t
+#include <cstring>      // for memcpy
+#include <ostream>      // for ostream
+#include <span>         // for span
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/screen/color.hpp"        // for Color
+#include "ftxui/screen/row_compare.hpp"  // for DifferingColumns
+
+namespace ftxui {
+
+namespace {
+
+// Above this size, the tables are reset by a key frame.
+constexpr size_t kMaxTableSize = 1 << 16;
+
+// The unchanged cells in between two changed ones are sent too, when there
+// are at most this many: this is cheaper than starting a new run.
+constexpr int kMaxGap = 2;
+
+// The header of the recordings, followed by their version.
+constexpr std::string_view kRecordingMagic = "FTXR";
+constexpr uint8_t kRecordingVersion = 1;
+
+enum Kind : uint8_t {
+  kKeyFrame = 0,
+  kDelta = 1,
+};
+
+enum Attribute : uint32_t {
+  kBlink = 1U << 0U,
+  kBold = 1U << 1U,
+  kDim = 1U << 2U,
+  kInverted = 1U << 3U,
+  kUnderlined = 1U << 4U,
+  kUnderlinedDouble = 1U << 5U,
+  kStrikethrough = 1U << 6U,
+};
+
+void PutVarint(std::string& out, uint64_t value) {
+  while (value >= 0x80) {                              // NOLINT
+    out += char((value & 0x7FU) | 0x80U);              // NOLINT
+    value >>= 7U;                                      // NOLINT
+  }
+  out += char(value);
+}
+
+bool GetVarint(std::string_view& in, uint64_t& value) {
+  value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {  // NOLINT
+    if (in.empty()) {
+      return false;
+    }
+    const auto byte = uint8_t(in.front());
+    in.remove_prefix(1);
+    value |= uint64_t(byte & 0x7FU) << uint64_t(shift);  // NOLINT
+    if ((byte & 0x80U) == 0) {                           // NOLINT
+      return true;
+    }
+  }
+  return false;
+}
+
+bool GetByte(std::string_view& in, uint8_t& value) {
+  if (in.empty()) {
+    return false;
+  }
+  value = uint8_t(in.front());
+  in.remove_prefix(1);
+  return true;
+}
+
+uint32_t Attributes(const Pixel& pixel) {
+  return (pixel.blink ? kBlink : 0U) |                          //
+         (pixel.bold ? kBold : 0U) |                            //
+         (pixel.dim ? kDim : 0U) |                              //
+         (pixel.inverted ? kInverted : 0U) |                    //
+         (pixel.underlined ? kUnderlined : 0U) |                //
+         (pixel.underlined_double ? kUnderlinedDouble : 0U) |  //
+         (pixel.strikethrough ? kStrikethrough : 0U);
+}
+
+// The number of components of a packed color, after its type.
+int Components(uint32_t type) {
+  return type == 0 ? 0 : type == 3 ? 3 : 1;  // NOLINT
+}
+
+// Color::Pack(), without the components unused by the type of the color. A
+// palette color converted from RGB keeps them.
+uint32_t Packed(const Color& color) {
+  const uint32_t packed = color.Pack();
+  const int components = Components(packed & 0xFFU);  // NOLINT
+  const uint64_t mask = (uint64_t(1) << uint64_t(8 * (components + 1))) - 1;
+  return packed & uint32_t(mask);
+}
+
+// The packed color: its type in the low byte, followed by its components.
+void PutColor(std::string& out, uint32_t packed) {
+  const auto type = uint8_t(packed & 0xFFU);  // NOLINT
+  out += char(type);
+  const int components = Components(type);
+  for (int i = 0; i < components; ++i) {
+    out += char(packed >> uint32_t(8 * (i + 1)));  // NOLINT
+  }
+}
+
+bool GetColor(std::string_view& in, Color& color) {
+  uint8_t type = 0;
+  if (!GetByte(in, type) || type > 3) {  // NOLINT
+    return false;
+  }
+  uint32_t packed = type;
+  const int components = Components(type);
+  for (int i = 0; i < components; ++i) {
+    uint8_t component = 0;
+    if (!GetByte(in, component)) {
+      return false;
+    }
+    packed |= uint32_t(component) << uint32_t(8 * (i + 1));  // NOLINT
+  }
+  color = Color::Unpack(packed);
+  return true;
+}
+
+}  // namespace
+
+size_t FrameEncoder::StyleHash::operator()(const Style& style) const {
+  return std::hash<uint64_t>()(style.colors ^
+                               (uint64_t(style.attributes) << 57U));  // NOLINT
+}
+
+size_t FrameEncoder::GlyphHash::operator()(const Glyph& glyph) const {
+  // The unused bytes of a Glyph are zero: its bytes identify it.
+  static_assert(sizeof(Glyph) == 2 * sizeof(uint64_t));
+  uint64_t words[2];                         // NOLINT
+  std::memcpy(words, &glyph, sizeof(Glyph));  // NOLINT
+  return std::hash<uint64_t>()(words[0] * 31 + words[1]);  // NOLINT
+}
+
+void FrameEncoder::Reset() {
+  dimx_ = -1;
+  dimy_ = -1;
+}
+
+uint32_t FrameEncoder::GlyphId(const Glyph& glyph, std::string& definitions) {
+  auto [it, inserted] = glyphs_.try_emplace(glyph, uint32_t(glyph_count_));
+  if (inserted) {
+    glyph_count_++;
+    const std::string_view view = glyph.view();
+    PutVarint(definitions, view.size());
+    definitions += view;
+  }
+  return it->second;
+}
+
+uint32_t FrameEncoder::StyleId(const Pixel& pixel, std::string& definitions) {
+  const uint32_t foreground = Packed(pixel.foreground_color);
+  const uint32_t background = Packed(pixel.background_color);
+  const Style style = {
+      uint64_t(foreground) | uint64_t(background) << 32U,  // NOLINT
+      Attributes(pixel),
+  };
+  auto [it, inserted] = styles_.try_emplace(style, uint32_t(style_count_));
+  if (inserted) {
+    style_count_++;
+    definitions += char(style.attributes);
+    PutColor(definitions, foreground);
+    PutColor(definitions, background);
+  }
+  return it->second;
+}
+
+void FrameEncoder::Encode(const Screen& screen, std::string& out) {
+  const bool key_frame = screen.dimx() != dimx_ || screen.dimy() != dimy_ ||
+                         glyph_count_ > kMaxTableSize ||
+                         style_count_ > kMaxTableSize;
+  if (key_frame) {
+    // The client clears its screen: spaces, in the default style.
+    dimx_ = screen.dimx();
+    dimy_ = screen.dimy();
+    previous_.assign(size_t(dimx_) * size_t(dimy_), Pixel());
+    glyphs_.clear();
+    styles_.clear();
+    glyph_count_ = 0;
+    style_count_ = 0;
+    key_frames_++;
+  }
+  frames_++;
+
+  const size_t glyph_count = glyph_count_;
+  const size_t style_count = style_count_;
+  new_glyphs_.clear();
+  new_styles_.clear();
+  runs_.clear();
+  size_t run_count = 0;
+  for (int y = 0; y < dimy_; ++y) {
+    const std::span<const Pixel> row = screen.Row(y);
+    const std::span<Pixel> previous(previous_.data() + size_t(y) * dimx_,
+                                    size_t(dimx_));
+    const row_compare::Span differing =
+        row_compare::DifferingColumns(row, previous);
+    int x = differing.first;
+    while (x >= 0 && x <= differing.last) {
+      if (row[x] == previous[x]) {
+        x++;
+        continue;
+      }
+      const int begin = x;
+      int end = x + 1;
+      int gap = 0;
+      for (x = end; x <= differing.last; ++x) {
+        if (row[x] == previous[x]) {
+          if (++gap > kMaxGap) {
+            break;
+          }
+        } else {
+          gap = 0;
+          end = x + 1;
+        }
+      }
+
+      PutVarint(runs_, uint64_t(y));
+      PutVarint(runs_, uint64_t(begin));
+      PutVarint(runs_, uint64_t(end - begin));
+      for (int i = begin; i < end; ++i) {
+        PutVarint(runs_, GlyphId(row[i].character, new_glyphs_));
+        PutVarint(runs_, StyleId(row[i], new_styles_));
+        previous[i] = row[i];
+      }
+      run_count++;
+      x = end;
+    }
+  }
+
+  std::string message;
+  message += char(key_frame ? kKeyFrame : kDelta);
+  if (key_frame) {
+    PutVarint(message, uint64_t(dimx_));
+    PutVarint(message, uint64_t(dimy_));
+  }
+  PutVarint(message, glyph_count_ - glyph_count);
+  message += new_glyphs_;
+  PutVarint(message, style_count_ - style_count);
+  message += new_styles_;
+  PutVarint(message, run_count);
+  message += runs_;
+  const Screen::Cursor cursor = screen.cursor();
+  PutVarint(message, uint64_t(std::max(0, cursor.x)));
+  PutVarint(message, uint64_t(std::max(0, cursor.y)));
+  const bool valid_shape = cursor.shape >= Screen::Cursor::Hidden &&
+                           cursor.shape <= Screen::Cursor::Bar;
+  message += char(valid_shape ? cursor.shape : Screen::Cursor::Hidden);
+
+  PutVarint(out, message.size());
+  out += message;
+}
+
+// A malformed message is removed from |input| anyway, so that the next ones
+// can be decoded.
+bool FrameDecoder::Decode(std::string_view& input) {
+  std::string_view in = input;
+  uint64_t size = 0;
+  if (!GetVarint(in, size) || in.size() < size) {
+    return false;
+  }
+  input = in.substr(size);
+  in = in.substr(0, size);
+
+  uint8_t kind = 0;
+  if (!GetByte(in, kind) || kind > kDelta) {
+    return false;
+  }
+  if (kind == kKeyFrame) {
+    uint64_t dimx = 0;
+    uint64_t dimy = 0;
+    if (!GetVarint(in, dimx) || !GetVarint(in, dimy) || dimx > 1 << 16 ||
+        dimy > 1 << 16) {  // NOLINT
+      return false;
+    }
+    screen_ = Screen(int(dimx), int(dimy));
+    glyphs_.clear();
+    styles_.clear();
+  }
+
+  uint64_t count = 0;
+  if (!GetVarint(in, count)) {
+    return false;
+  }
+  for (uint64_t i = 0; i < count; ++i) {
+    uint64_t length = 0;
+    if (!GetVarint(in, length) || in.size() < length) {
+      return false;
+    }
+    glyphs_.emplace_back(in.substr(0, length));
+    in.remove_prefix(length);
+  }
+
+  if (!GetVarint(in, count)) {
+    return false;
+  }
+  for (uint64_t i = 0; i < count; ++i) {
+    uint8_t attributes = 0;
+    Pixel style;
+    if (!GetByte(in, attributes) || !GetColor(in, style.foreground_color) ||
+        !GetColor(in, style.background_color)) {
+      return false;
+    }
+    style.blink = attributes & kBlink;
+    style.bold = attributes & kBold;
+    style.dim = attributes & kDim;
+    style.inverted = attributes & kInverted;
+    style.underlined = attributes & kUnderlined;
+    style.underlined_double = attributes & kUnderlinedDouble;
+    style.strikethrough = attributes & kStrikethrough;
+    styles_.push_back(style);
+  }
+
+  if (!GetVarint(in, count)) {
+    return false;
+  }
+  for (uint64_t i = 0; i < count; ++i) {
+    uint64_t y = 0;
+    uint64_t x = 0;
+    uint64_t length = 0;
+    if (!GetVarint(in, y) || !GetVarint(in, x) || !GetVarint(in, length) ||
+        y >= uint64_t(screen_.dimy()) ||
+        x + length > uint64_t(screen_.dimx())) {
+      return false;
+    }
+    for (uint64_t j = 0; j < length; ++j) {
+      uint64_t glyph = 0;
+      uint64_t style = 0;
+      if (!GetVarint(in, glyph) || !GetVarint(in, style) ||
+          glyph >= glyphs_.size() || style >= styles_.size()) {
+        return false;
+      }
+      Pixel& pixel = screen_.PixelAt(int(x + j), int(y));
+      pixel = styles_[style];
+      pixel.character = glyphs_[glyph];
+    }
+  }
+
+  uint64_t cursor_x = 0;
+  uint64_t cursor_y = 0;
+  uint8_t shape = 0;
+  if (!GetVarint(in, cursor_x) || !GetVarint(in, cursor_y) ||
+      !GetByte(in, shape) || shape > Screen::Cursor::Bar) {
+    return false;
+  }
+  screen_.SetCursor(
+      {int(cursor_x), int(cursor_y), Screen::Cursor::Shape(shape)});
+  return true;
+}
+
+FrameRecorder::FrameRecorder(std::ostream& out) : out_(out) {
+  out_ << kRecordingMagic << char(kRecordingVersion);
+}
+
+void FrameRecorder::Record(const Screen& screen,
+                           std::chrono::milliseconds elapsed) {
+  buffer_.clear();
+  PutVarint(buffer_, uint64_t(std::max<int64_t>(0, elapsed.count())));
+  encoder_.Encode(screen, buffer_);
+  out_.write(buffer_.data(), std::streamsize(buffer_.size()));
+}
+
+bool FrameReader::Open(std::string recording) {
+  recording_ = std::move(recording);
+  remaining_ = recording_;
+  decoder_ = FrameDecoder();
+  time_ = std::chrono::milliseconds(0);
+  if (remaining_.substr(0, kRecordingMagic.size()) != kRecordingMagic ||
+      remaining_.size() <= kRecordingMagic.size() ||
+      uint8_t(remaining_[kRecordingMagic.size()]) != kRecordingVersion) {
+    remaining_ = {};
+    return false;
+  }
+  remaining_.remove_prefix(kRecordingMagic.size() + 1);
+  return true;
+}
+
+bool FrameReader::Next() {
+  std::string_view in = remaining_;
+  uint64_t elapsed = 0;
+  if (!GetVarint(in, elapsed) || !decoder_.Decode(in)) {
+    remaining_ = {};
+    return false;
+  }
+  remaining_ = in;
+  time_ += std::chrono::milliseconds(elapsed);
+  return true;
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
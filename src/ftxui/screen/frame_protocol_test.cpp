@@ -0,0 +1,214 @@
+#include "ftxui/screen/frame_protocol.hpp"
+#include <gtest/gtest.h>
+#include <chrono>       // for milliseconds
+#include <sstream>      // for ostringstream
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/terminal.hpp"  // for SetColorSupport, Color
+
+namespace ftxui {
+
+namespace {
+
+void ExpectSameScreen(const Screen& a, const Screen& b) {
+  ASSERT_EQ(a.dimx(), b.dimx());
+  ASSERT_EQ(a.dimy(), b.dimy());
+  for (int y = 0; y < a.dimy(); ++y) {
+    for (int x = 0; x < a.dimx(); ++x) {
+      EXPECT_TRUE(a.Row(y)[x] == b.Row(y)[x]) << x << "," << y;
+    }
+  }
+  EXPECT_EQ(a.cursor().x, b.cursor().x);
+  EXPECT_EQ(a.cursor().y, b.cursor().y);
+}
+
+std::string Encode(FrameEncoder& encoder, const Screen& screen) {
+  std::string out;
+  encoder.Encode(screen, out);
+  return out;
+}
+
+bool Decode(FrameDecoder& decoder, const std::string& message) {
+  std::string_view input = message;
+  const bool decoded = decoder.Decode(input);
+  EXPECT_TRUE(input.empty());
+  return decoded;
+}
+
+}  // namespace
+
+TEST(FrameProtocolTest, RoundTrip) {
+  auto screen = Screen(10, 3);
+  screen.PixelAt(0, 0).character = "a";
+  screen.PixelAt(1, 0).character = "測";
+  screen.PixelAt(2, 0).character = "";
+  screen.PixelAt(9, 2).character = "z";
+  screen.SetCursor({4, 1, Screen::Cursor::Bar});
+
+  FrameEncoder encoder;
+  FrameDecoder decoder;
+  EXPECT_TRUE(Decode(decoder, Encode(encoder, screen)));
+  ExpectSameScreen(screen, decoder.screen());
+  EXPECT_EQ(decoder.screen().cursor().shape, Screen::Cursor::Bar);
+  EXPECT_EQ(encoder.frames(), 1u);
+  EXPECT_EQ(encoder.key_frames(), 1u);
+}
+
+TEST(FrameProtocolTest, Styles) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  auto screen = Screen(4, 2);
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(1, 0).underlined_double = true;
+  screen.PixelAt(1, 0).strikethrough = true;
+  screen.PixelAt(2, 0).foreground_color = Color::Red;
+  screen.PixelAt(3, 0).background_color = Color::Palette256(123);
+  screen.PixelAt(0, 1).foreground_color = Color::RGB(1, 2, 3);
+  screen.PixelAt(0, 1).inverted = true;
+  screen.PixelAt(1, 1).blink = true;
+  screen.PixelAt(1, 1).dim = true;
+
+  FrameEncoder encoder;
+  FrameDecoder decoder;
+  EXPECT_TRUE(Decode(decoder, Encode(encoder, screen)));
+  ExpectSameScreen(screen, decoder.screen());
+}
+
+TEST(FrameProtocolTest, Delta) {
+  auto screen = Screen(80, 24);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      screen.PixelAt(x, y).character = std::string(1, char('a' + (x + y) % 26));
+    }
+  }
+
+  FrameEncoder encoder;
+  FrameDecoder decoder;
+  const std::string key_frame = Encode(encoder, screen);
+  EXPECT_TRUE(Decode(decoder, key_frame));
+
+  // Nothing changed: no run, and no definition.
+  const std::string empty = Encode(encoder, screen);
+  EXPECT_LE(empty.size(), 8u);
+  EXPECT_TRUE(Decode(decoder, empty));
+  ExpectSameScreen(screen, decoder.screen());
+
+  // A few cells changed, with glyphs already in the table.
+  screen.PixelAt(3, 5).character = "b";
+  screen.PixelAt(5, 5).character = "c";
+  screen.PixelAt(70, 20).character = "d";
+  const std::string delta = Encode(encoder, screen);
+  EXPECT_LT(delta.size(), 32u);
+  EXPECT_LT(delta.size() * 50, key_frame.size());
+  EXPECT_TRUE(Decode(decoder, delta));
+  ExpectSameScreen(screen, decoder.screen());
+  EXPECT_EQ(encoder.key_frames(), 1u);
+
+  // A new size starts over with a key frame.
+  auto resized = Screen(40, 12);
+  resized.PixelAt(1, 1).character = "x";
+  EXPECT_TRUE(Decode(decoder, Encode(encoder, resized)));
+  ExpectSameScreen(resized, decoder.screen());
+  EXPECT_EQ(encoder.key_frames(), 2u);
+
+  encoder.Reset();
+  EXPECT_TRUE(Decode(decoder, Encode(encoder, resized)));
+  EXPECT_EQ(encoder.key_frames(), 3u);
+}
+
+TEST(FrameProtocolTest, Stream) {
+  auto screen = Screen(5, 1);
+  FrameEncoder encoder;
+  std::string stream;
+  screen.PixelAt(0, 0).character = "a";
+  encoder.Encode(screen, stream);
+  screen.PixelAt(1, 0).character = "b";
+  encoder.Encode(screen, stream);
+
+  // The messages are decoded once they are whole.
+  FrameDecoder decoder;
+  std::string_view input = std::string_view(stream).substr(0, 3);
+  EXPECT_FALSE(decoder.Decode(input));
+  EXPECT_EQ(input.size(), 3u);
+
+  input = stream;
+  EXPECT_TRUE(decoder.Decode(input));
+  EXPECT_EQ(decoder.screen().Row(0)[0].character, "a");
+  EXPECT_EQ(decoder.screen().Row(0)[1].character, " ");
+  EXPECT_TRUE(decoder.Decode(input));
+  EXPECT_EQ(decoder.screen().Row(0)[1].character, "b");
+  EXPECT_TRUE(input.empty());
+  EXPECT_FALSE(decoder.Decode(input));
+}
+
+TEST(FrameProtocolTest, Malformed) {
+  FrameDecoder decoder;
+  // A run referencing a glyph not defined.
+  const std::string message = {11, 0, 2, 1, 0, 0, 1, 0, 0, 1, 0, 0};
+  std::string_view input = message;
+  EXPECT_FALSE(decoder.Decode(input));
+  EXPECT_TRUE(input.empty());
+}
+
+TEST(FrameProtocolTest, Snapshot) {
+  auto screen = Screen(20, 4);
+  screen.PixelAt(0, 0).character = "a";
+  screen.PixelAt(3, 2).character = "測";
+  screen.PixelAt(4, 2).character = "";
+  screen.PixelAt(19, 3).bold = true;
+  screen.SetCursor({2, 3, Screen::Cursor::Hidden});
+
+  const std::string snapshot = screen.Serialize();
+  EXPECT_LT(snapshot.size(), screen.ToString().size());
+  Screen decoded(1, 1);
+  EXPECT_TRUE(Screen::Deserialize(snapshot, decoded));
+  ExpectSameScreen(screen, decoded);
+
+  // The same screens have the same snapshot.
+  EXPECT_EQ(decoded.Serialize(), snapshot);
+
+  // Invalid snapshots leave the screen unchanged.
+  EXPECT_FALSE(Screen::Deserialize(snapshot.substr(0, 5), decoded));
+  EXPECT_FALSE(Screen::Deserialize(snapshot + snapshot, decoded));
+  EXPECT_EQ(decoded.dimx(), 20);
+}
+
+TEST(FrameProtocolTest, Recording) {
+  std::ostringstream out;
+  FrameRecorder recorder(out);
+  auto screen = Screen(5, 1);
+  screen.PixelAt(0, 0).character = "a";
+  recorder.Record(screen, std::chrono::milliseconds(0));
+  screen.PixelAt(1, 0).character = "b";
+  recorder.Record(screen, std::chrono::milliseconds(40));
+  recorder.Record(screen, std::chrono::milliseconds(20));
+
+  FrameReader reader;
+  ASSERT_TRUE(reader.Open(out.str()));
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.screen().Row(0)[1].character, " ");
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.time(), std::chrono::milliseconds(40));
+  ExpectSameScreen(screen, reader.screen());
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.time(), std::chrono::milliseconds(60));
+  EXPECT_FALSE(reader.Next());
+
+  // A truncated recording stops at its last whole frame.
+  const std::string recording = out.str();
+  ASSERT_TRUE(reader.Open(recording.substr(0, recording.size() - 1)));
+  EXPECT_TRUE(reader.Next());
+  EXPECT_TRUE(reader.Next());
+  EXPECT_FALSE(reader.Next());
+
+  EXPECT_FALSE(reader.Open("not a recording"));
+  EXPECT_FALSE(reader.Next());
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
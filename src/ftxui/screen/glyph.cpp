@@ -0,0 +1,182 @@
+#include "ftxui/screen/glyph.hpp"
+
+#include <array>          // for array
+#include <cstdint>        // for uint32_t, uint64_t, uint8_t
+#include <deque>          // for deque
+#include <mutex>          // for mutex, lock_guard
+#include <ostream>        // for ostream
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for pair
+
+#include "ftxui/screen/string.hpp"  // for string_width
+#include "ftxui/screen/util.hpp"    // for HeapSize
+
+namespace ftxui {
+
+namespace {
+
+constexpr size_t kCacheSize = 256;
+
+// FNV-1a.
+size_t Hash(const char* data, size_t size) {
+  uint64_t hash = 0xcbf29ce484222325ULL;  // NOLINT
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= uint8_t(data[i]);   // NOLINT
+    hash *= 0x100000001b3ULL;  // NOLINT
+  }
+  return size_t(hash ^ (hash >> 32U));  // NOLINT
+}
+
+// Storage for the graphemes too long to be stored inline. Entries are never
+// removed, so the returned views remain valid forever.
+class InternTable {
+ public:
+  uint32_t Intern(std::string_view value) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(value);
+    if (it != index_.end()) {
+      return it->second;
+    }
+    const auto id = static_cast<uint32_t>(values_.size());
+    values_.emplace_back(value);
+    index_.emplace(values_.back(), id);
+    return id;
+  }
+
+  // Same as Intern(), avoiding the lock for the graphemes recently interned
+  // by the current thread.
+  uint32_t InternCached(std::string_view value) {
+    struct Entry {
+      std::string_view value;
+      uint32_t id = 0;
+    };
+    thread_local std::array<Entry, kCacheSize> cache;
+    Entry& entry = cache[Hash(value.data(), value.size()) % kCacheSize];
+    if (entry.value != value) {
+      entry.id = Intern(value);
+      entry.value = Get(entry.id);
+    }
+    return entry.id;
+  }
+
+  size_t MemoryUsage() {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    size_t bytes = index_.bucket_count() * sizeof(void*);
+    for (const std::string& value : values_) {
+      // The string, and the node of the index referencing it.
+      bytes += sizeof(value) + util::HeapSize(value) +
+               sizeof(std::pair<std::string_view, uint32_t>) + sizeof(void*);
+    }
+    return bytes;
+  }
+
+  std::string_view Get(uint32_t id) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return values_[id];
+  }
+
+ private:
+  std::mutex mutex_;
+  std::deque<std::string> values_;
+  std::unordered_map<std::string_view, uint32_t> index_;
+};
+
+InternTable& GetInternTable() {
+  // Leaked on purpose: Glyphs might be used during static destruction.
+  static auto* table = new InternTable();  // NOLINT
+  return *table;
+}
+
+}  // namespace
+
+Glyph::Glyph(const char* value) {
+  Assign(value);
+}
+
+Glyph::Glyph(const std::string& value) {
+  Assign(value);
+}
+
+Glyph::Glyph(std::string_view value) {
+  Assign(value);
+}
+
+void Glyph::Assign(std::string_view value) {
+  if (value.size() <= kInlineCapacity) {
+    std::memcpy(data_, value.data(), value.size());
+    size_ = static_cast<uint8_t>(value.size());
+  } else {
+    const uint32_t id = GetInternTable().InternCached(value);
+    std::memcpy(data_, &id, sizeof(id));
+    size_ = kInterned;
+  }
+  fullwidth_ = width() == 2;
+}
+
+/// @brief The UTF8 encoded grapheme.
+std::string_view Glyph::view() const {
+  if (size_ != kInterned) {
+    return {data_, size_};
+  }
+  uint32_t id = 0;
+  std::memcpy(&id, data_, sizeof(id));
+  return GetInternTable().Get(id);
+}
+
+Glyph::operator std::string() const {
+  return std::string(view());
+}
+
+Glyph& Glyph::operator+=(std::string_view value) {
+  // The view might point to |data_|, overwritten by Assign().
+  std::string grapheme(view());
+  grapheme += value;
+  Assign(grapheme);
+  return *this;
+}
+
+/// @brief The bytes held by the interned graphemes, shared by every Glyph.
+/// They are never freed.
+size_t Glyph::InternedMemoryUsage() {
+  return GetInternTable().MemoryUsage();
+}
+
+/// @brief The number of bytes of the UTF8 encoded grapheme.
+size_t Glyph::size() const {
+  return size_ != kInterned ? size_ : view().size();
+}
+
+/// @brief The number of cells the grapheme takes, as computed by
+/// string_width(). The width of the graphemes longer than one byte is cached.
+int Glyph::width() const {
+  if (fullwidth_) {
+    return 2;
+  }
+  if (size_ <= 1) {
+    const auto c = uint8_t(data_[0]);
+    return (size_ == 1 && c >= 0x20 && c < 0x7F) ? 1 : 0;  // NOLINT
+  }
+
+  // Direct mapped, one per thread, keyed by the bytes of the Glyph.
+  struct Entry {
+    Glyph glyph;
+    int width = 0;
+  };
+  thread_local std::array<Entry, kCacheSize> cache;
+  Entry& entry = cache[Hash(data_, sizeof(data_)) % kCacheSize];
+  if (entry.glyph != *this) {
+    entry.glyph = *this;
+    entry.width = string_width(view());
+  }
+  return entry.width;
+}
+
+std::ostream& operator<<(std::ostream& out, const Glyph& glyph) {
+  return out << glyph.view();
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,100 @@
+#include "ftxui/screen/glyph.hpp"
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/screen/string.hpp"  // for string_width
+
+namespace ftxui {
+
+TEST(GlyphTest, Default) {
+  const Glyph glyph;
+  EXPECT_TRUE(glyph.empty());
+  EXPECT_EQ(glyph.size(), 0u);
+  EXPECT_EQ(glyph, "");
+}
+
+TEST(GlyphTest, Inline) {
+  const Glyph glyph = "测";
+  EXPECT_EQ(glyph.size(), 3u);
+  EXPECT_EQ(glyph.view(), "测");
+  EXPECT_EQ(std::string(glyph), "测");
+  EXPECT_EQ(glyph, Glyph(std::string("测")));
+  EXPECT_NE(glyph, Glyph("a"));
+}
+
+TEST(GlyphTest, Interned) {
+  // A family emoji: 7 codepoints, 25 bytes. Too long to be stored inline.
+  const std::string family = "👨‍👩‍👧‍👦";
+  const Glyph a = family;
+  const Glyph b = family;
+  EXPECT_EQ(a.size(), family.size());
+  EXPECT_EQ(a.view(), family);
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, Glyph("👨‍👩‍👧"));
+}
+
+TEST(GlyphTest, Width) {
+  EXPECT_EQ(Glyph().width(), 0);
+  EXPECT_EQ(Glyph("a").width(), 1);
+  EXPECT_EQ(Glyph("\1").width(), 0);
+  EXPECT_EQ(Glyph("\x80").width(), 0);
+  EXPECT_EQ(Glyph("ā").width(), 1);
+  // Read from the cache the second time:
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(Glyph("测").width(), 2);
+    EXPECT_EQ(Glyph("👨‍👩‍👧‍👦").width(), string_width("👨‍👩‍👧‍👦"));
+  }
+}
+
+TEST(GlyphTest, Fullwidth) {
+  EXPECT_FALSE(Glyph().fullwidth());
+  EXPECT_FALSE(Glyph("a").fullwidth());
+  EXPECT_FALSE(Glyph("ā").fullwidth());
+  EXPECT_TRUE(Glyph("测").fullwidth());
+  EXPECT_TRUE(Glyph("🎅").fullwidth());
+  EXPECT_TRUE(Glyph(std::string("测")).fullwidth());
+  const Glyph copy = Glyph("测");
+  EXPECT_TRUE(copy.fullwidth());
+  EXPECT_EQ(copy.width(), 2);
+}
+
+TEST(GlyphTest, Narrow) {
+  constexpr Glyph empty = Glyph::Narrow("");
+  constexpr Glyph ascii = Glyph::Narrow("a");
+  constexpr Glyph line = Glyph::Narrow("─");
+  EXPECT_EQ(empty, Glyph());
+  EXPECT_EQ(ascii, Glyph("a"));
+  EXPECT_EQ(line, Glyph("─"));
+  EXPECT_EQ(line.view(), "─");
+  EXPECT_FALSE(line.fullwidth());
+}
+
+// Screen::at() returns a Glyph&, used by the existing code as a std::string.
+TEST(GlyphTest, StringCompatibility) {
+  Glyph glyph = std::string("e");
+  glyph += "\u0301";  // Combining acute accent.
+  EXPECT_EQ(glyph, "e\u0301");
+  EXPECT_EQ(glyph.length(), 3u);
+  EXPECT_EQ(glyph[0], 'e');
+
+  glyph = "a";
+  std::string out = "[";
+  out += glyph;
+  const std::string copy = glyph;
+  EXPECT_EQ(out, "[a");
+  EXPECT_EQ(copy, "a");
+  EXPECT_TRUE(glyph == std::string("a"));
+  EXPECT_TRUE(std::string("a") == glyph);
+  EXPECT_TRUE("a" == glyph);
+
+  // Growing past the inline capacity interns the grapheme.
+  Glyph family = "👨‍👩‍👧";
+  family += "‍👦";
+  EXPECT_EQ(family, "👨‍👩‍👧‍👦");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,133 @@
+#include "ftxui/screen/output_breakdown.hpp"
+
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <string_view>  // for string_view
+
+namespace ftxui {
+
+namespace {
+
+// Whether a CSI sequence ending with |final| moves the cursor.
+bool IsCursorMotion(char final) {
+  switch (final) {
+    case 'A':  // Up.
+    case 'B':  // Down.
+    case 'C':  // Right.
+    case 'D':  // Left.
+    case 'E':  // Next line.
+    case 'F':  // Previous line.
+    case 'G':  // Column.
+    case 'H':  // Position.
+    case 'd':  // Row.
+    case 'f':  // Position.
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Count the parameters of the SGR sequence "ESC [ |parameters| m". The
+// extended colors, like "38;5;n" and "38;2;r;g;b", are counted once.
+void CountSgrParameters(
+    std::array<size_t, OutputBreakdown::kSgrParameters>& counts,
+    std::string_view parameters) {
+  // ESC [ m is a reset.
+  if (parameters.empty()) {
+    counts[0]++;
+    return;
+  }
+
+  int skip = 0;      // The components of an extended color left to skip.
+  int previous = 0;  // The previous parameter.
+  size_t begin = 0;
+  while (begin < parameters.size()) {
+    size_t end = parameters.find(';', begin);
+    if (end == std::string_view::npos) {
+      end = parameters.size();
+    }
+    int value = 0;
+    for (size_t i = begin; i < end; ++i) {
+      if (parameters[i] >= '0' && parameters[i] <= '9' && value < 100000) {
+        value = value * 10 + (parameters[i] - '0');  // NOLINT
+      }
+    }
+
+    const bool extended_color =
+        previous == 38 || previous == 48 || previous == 58;  // NOLINT
+    if (skip == 0 && extended_color) {
+      // "5;n" or "2;r;g;b" follows.
+      skip = value == 2 ? 3 : 1;
+      previous = 0;
+    } else if (skip != 0) {
+      skip--;
+    } else {
+      if (size_t(value) < counts.size()) {
+        counts[size_t(value)]++;
+      }
+      previous = value;
+    }
+    begin = end + 1;
+  }
+}
+
+}  // namespace
+
+/// @brief Classify the bytes of |output|, and count the SGR parameters.
+void OutputBreakdown::Add(std::string_view output) {
+  const size_t size = output.size();
+  size_t i = 0;
+  while (i < size) {
+    const char c = output[i];
+    if (c == '\r' || c == '\n') {
+      motion++;
+      i++;
+      continue;
+    }
+
+    if (c != '\x1B') {
+      glyphs++;
+      i++;
+      continue;
+    }
+
+    // ESC 7 and ESC 8 save and restore the cursor position.
+    if (i + 1 >= size || output[i + 1] != '[') {
+      const size_t length = i + 1 < size ? 2 : 1;
+      const bool cursor = length == 2 &&
+                          (output[i + 1] == '7' || output[i + 1] == '8');
+      (cursor ? motion : other) += length;
+      i += length;
+      continue;
+    }
+
+    // CSI: parameters in [0x30, 0x3F], intermediates in [0x20, 0x2F], and a
+    // final byte.
+    size_t end = i + 2;
+    while (end < size && output[end] >= 0x20 && output[end] <= 0x3F) {
+      end++;
+    }
+    if (end >= size) {
+      other += size - i;
+      return;
+    }
+    const char final = output[end];
+    const size_t length = end + 1 - i;
+    if (final == 'm') {
+      style += length;
+      const std::string_view parameters = output.substr(i + 2, end - i - 2);
+      CountSgrParameters(sgr_parameters, parameters);
+    } else if (IsCursorMotion(final)) {
+      motion += length;
+    } else {
+      other += length;
+    }
+    i = end + 1;
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,49 @@
+#include "ftxui/screen/output_breakdown.hpp"
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+TEST(OutputBreakdownTest, Kinds) {
+  OutputBreakdown breakdown;
+  breakdown.Add("ab\r\n\x1B[1;38;2;1;2;3;4mc\x1B[m\x1B[2A\x1B[K\x1B""7");
+  EXPECT_EQ(breakdown.glyphs, 3u);
+  EXPECT_EQ(breakdown.style, 17u + 3u);
+  EXPECT_EQ(breakdown.motion, 2u + 4u + 2u);
+  EXPECT_EQ(breakdown.other, 3u);
+  EXPECT_EQ(breakdown.total(), 34u);
+
+  EXPECT_EQ(breakdown.sgr_parameters[0], 1u);
+  EXPECT_EQ(breakdown.sgr_parameters[1], 1u);
+  EXPECT_EQ(breakdown.sgr_parameters[38], 1u);
+  EXPECT_EQ(breakdown.sgr_parameters[2], 0u);
+  EXPECT_EQ(breakdown.sgr_parameters[3], 0u);
+  EXPECT_EQ(breakdown.sgr_parameters[4], 1u);
+}
+
+TEST(OutputBreakdownTest, Screen) {
+  auto screen = Screen(3, 2);
+  screen.PixelAt(0, 0).character = "a";
+  screen.PixelAt(1, 0).bold = true;
+  screen.PixelAt(1, 0).character = "b";
+  screen.PixelAt(0, 1).foreground_color = Color::Red;
+  screen.PixelAt(0, 1).character = "c";
+
+  const std::string output = screen.ToString();
+  OutputBreakdown breakdown;
+  breakdown.Add(output);
+  EXPECT_EQ(breakdown.total(), output.size());
+  EXPECT_EQ(breakdown.glyphs, 6u);
+  EXPECT_EQ(breakdown.motion, 2u);
+  EXPECT_EQ(breakdown.sgr_parameters[1], 1u);
+  EXPECT_EQ(breakdown.sgr_parameters[31], 1u);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,166 @@
+#include "ftxui/screen/row_compare.hpp"
+
+#include <bit>  // for countr_zero, bit_width
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>  // for _mm_loadu_si128, _mm_cmpeq_epi8, _mm_movemask_epi8
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>  // for vld1q_u8, vceqq_u8, vminvq_u8
+#endif
+
+namespace ftxui {
+namespace row_compare {
+
+size_t FirstDifferenceScalar(const uint8_t* a, const uint8_t* b, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    if (a[i] != b[i]) {  // NOLINT
+      return i;
+    }
+  }
+  return size;
+}
+
+size_t LastDifferenceScalar(const uint8_t* a, const uint8_t* b, size_t size) {
+  for (size_t i = size; i > 0; --i) {
+    if (a[i - 1] != b[i - 1]) {  // NOLINT
+      return i;
+    }
+  }
+  return 0;
+}
+
+#if defined(__AVX2__)
+
+// NOLINTBEGIN
+size_t FirstDifference(const uint8_t* a, const uint8_t* b, size_t size) {
+  const size_t width = 32;
+  size_t i = 0;
+  for (; i + width <= size; i += width) {
+    const __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+    const __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+    const auto equal = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+    if (equal != 0xFFFFFFFF) {
+      return i + std::countr_zero(~equal);
+    }
+  }
+  return i + FirstDifferenceScalar(a + i, b + i, size - i);
+}
+
+size_t LastDifference(const uint8_t* a, const uint8_t* b, size_t size) {
+  const size_t width = 32;
+  size_t end = size;
+  for (; end >= width; end -= width) {
+    const __m256i va = _mm256_loadu_si256((const __m256i*)(a + end - width));
+    const __m256i vb = _mm256_loadu_si256((const __m256i*)(b + end - width));
+    const auto equal = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+    if (equal != 0xFFFFFFFF) {
+      return end - width + std::bit_width(~equal);
+    }
+  }
+  return LastDifferenceScalar(a, b, end);
+}
+// NOLINTEND
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+// NOLINTBEGIN
+size_t FirstDifference(const uint8_t* a, const uint8_t* b, size_t size) {
+  const size_t width = 16;
+  size_t i = 0;
+  for (; i + width <= size; i += width) {
+    const __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+    const __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+    const auto equal = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+    if (equal != 0xFFFF) {
+      return i + std::countr_zero(~equal);
+    }
+  }
+  return i + FirstDifferenceScalar(a + i, b + i, size - i);
+}
+
+size_t LastDifference(const uint8_t* a, const uint8_t* b, size_t size) {
+  const size_t width = 16;
+  size_t end = size;
+  for (; end >= width; end -= width) {
+    const __m128i va = _mm_loadu_si128((const __m128i*)(a + end - width));
+    const __m128i vb = _mm_loadu_si128((const __m128i*)(b + end - width));
+    const auto equal = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+    if (equal != 0xFFFF) {
+      return end - width + std::bit_width(~equal & 0xFFFFU);
+    }
+  }
+  return LastDifferenceScalar(a, b, end);
+}
+// NOLINTEND
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+// NEON has no movemask. The blocks are compared as a whole, and the position
+// is found using the scalar code within the differing block.
+// NOLINTBEGIN
+size_t FirstDifference(const uint8_t* a, const uint8_t* b, size_t size) {
+  const size_t width = 16;
+  size_t i = 0;
+  for (; i + width <= size; i += width) {
+    const uint8x16_t equal = vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+    if (vminvq_u8(equal) != 0xFF) {
+      return i + FirstDifferenceScalar(a + i, b + i, width);
+    }
+  }
+  return i + FirstDifferenceScalar(a + i, b + i, size - i);
+}
+
+size_t LastDifference(const uint8_t* a, const uint8_t* b, size_t size) {
+  const size_t width = 16;
+  size_t end = size;
+  for (; end >= width; end -= width) {
+    const size_t begin = end - width;
+    const uint8x16_t equal = vceqq_u8(vld1q_u8(a + begin), vld1q_u8(b + begin));
+    if (vminvq_u8(equal) != 0xFF) {
+      return begin + LastDifferenceScalar(a + begin, b + begin, width);
+    }
+  }
+  return LastDifferenceScalar(a, b, end);
+}
+// NOLINTEND
+
+#else
+
+size_t FirstDifference(const uint8_t* a, const uint8_t* b, size_t size) {
+  return FirstDifferenceScalar(a, b, size);
+}
+
+size_t LastDifference(const uint8_t* a, const uint8_t* b, size_t size) {
+  return LastDifferenceScalar(a, b, size);
+}
+
+#endif
+
+Span DifferingColumns(std::span<const Pixel> a, std::span<const Pixel> b) {
+  // The pixels are compared as raw bytes. This requires Pixel not to contain
+  // padding, every field to take part in Pixel::operator==, and the unused
+  // bytes of the Glyph to be zero.
+  static_assert(sizeof(Pixel) == sizeof(Glyph) + 2 * sizeof(Color) + 1,
+                "Pixel must not contain padding");
+  const auto* bytes_a = reinterpret_cast<const uint8_t*>(a.data());  // NOLINT
+  const auto* bytes_b = reinterpret_cast<const uint8_t*>(b.data());  // NOLINT
+  const size_t size = a.size() * sizeof(Pixel);
+
+  const size_t first = FirstDifference(bytes_a, bytes_b, size);
+  if (first == size) {
+    return {};
+  }
+  const size_t last =
+      first + LastDifference(bytes_a + first, bytes_b + first, size - first);
+  return {
+      int(first / sizeof(Pixel)),
+      int((last - 1) / sizeof(Pixel)),
+  };
+}
+
+}  // namespace row_compare
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,41 @@
+#ifndef FTXUI_SCREEN_ROW_COMPARE_HPP
+#define FTXUI_SCREEN_ROW_COMPARE_HPP
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t
+#include <span>     // for span
+
+#include "ftxui/screen/screen.hpp"  // for Pixel
+
+namespace ftxui {
+namespace row_compare {
+
+// Return the index of the first byte differing in between |a| and |b|, or
+// |size| when they are equal. Vectorized using AVX2, SSE2 or NEON, when
+// available.
+size_t FirstDifference(const uint8_t* a, const uint8_t* b, size_t size);
+
+// Return one past the index of the last byte differing in between |a| and |b|,
+// or 0 when they are equal.
+size_t LastDifference(const uint8_t* a, const uint8_t* b, size_t size);
+
+// The scalar reference implementations.
+size_t FirstDifferenceScalar(const uint8_t* a, const uint8_t* b, size_t size);
+size_t LastDifferenceScalar(const uint8_t* a, const uint8_t* b, size_t size);
+
+// The range of columns [first, last] differing in between two rows of the same
+// size. Both are -1 when the rows are equal.
+struct Span {
+  int first = -1;
+  int last = -1;
+};
+Span DifferingColumns(std::span<const Pixel> a, std::span<const Pixel> b);
+
+}  // namespace row_compare
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_SCREEN_ROW_COMPARE_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,69 @@
+#include "ftxui/screen/row_compare.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>  // for uint8_t
+#include <random>   // for mt19937
+#include <vector>   // for vector
+#include "ftxui/screen/color.hpp"  // for Color
+
+namespace ftxui {
+
+TEST(RowCompareTest, MatchesScalar) {
+  std::mt19937 random(42);  // NOLINT
+  for (size_t size = 0; size < 200; ++size) {
+    std::vector<uint8_t> a(size);
+    for (auto& byte : a) {
+      byte = uint8_t(random());
+    }
+    // Equal buffers.
+    std::vector<uint8_t> b = a;
+    EXPECT_EQ(row_compare::FirstDifference(a.data(), b.data(), size), size);
+    EXPECT_EQ(row_compare::LastDifference(a.data(), b.data(), size), 0u);
+
+    // Buffers differing at one or two random positions.
+    for (int i = 0; i < 10 && size != 0; ++i) {
+      b = a;
+      b[random() % size] ^= 1;
+      b[random() % size] ^= 0x80;  // NOLINT
+      EXPECT_EQ(row_compare::FirstDifference(a.data(), b.data(), size),
+                row_compare::FirstDifferenceScalar(a.data(), b.data(), size));
+      EXPECT_EQ(row_compare::LastDifference(a.data(), b.data(), size),
+                row_compare::LastDifferenceScalar(a.data(), b.data(), size));
+    }
+  }
+}
+
+TEST(RowCompareTest, DifferingColumns) {
+  std::vector<Pixel> a(100);
+  std::vector<Pixel> b(100);
+  auto span = row_compare::DifferingColumns(a, b);
+  EXPECT_EQ(span.first, -1);
+  EXPECT_EQ(span.last, -1);
+
+  b[3].character = "x";
+  b[70].foreground_color = Color::Red;  // NOLINT
+  span = row_compare::DifferingColumns(a, b);
+  EXPECT_EQ(span.first, 3);
+  EXPECT_EQ(span.last, 70);
+
+  b[70] = a[70];
+  span = row_compare::DifferingColumns(a, b);
+  EXPECT_EQ(span.first, 3);
+  EXPECT_EQ(span.last, 3);
+}
+
+TEST(RowCompareTest, DifferingStyle) {
+  std::vector<Pixel> a(40);
+  std::vector<Pixel> b(40);
+  b[1].automerge = true;
+  b[20].bold = true;
+  b[38].background_color = Color::RGB(1, 2, 3);
+  const auto span = row_compare::DifferingColumns(a, b);
+  EXPECT_EQ(span.first, 1);
+  EXPECT_EQ(span.last, 38);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,37 +1,70 @@
-#include <cstdint>  // for uint8_t
+#include <algorithm>  // for fill, max, min
+#include <array>      // for array
+#include <atomic>     // for atomic
+#include <cstdint>    // for uint8_t, uint64_t
+#include <cstdio>     // for FILE, fwrite, fflush
+#include <cstdlib>    // for abs
 #include <iostream>  // for operator<<, stringstream, basic_ostream, flush, cout, ostream
-#include <map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
+#include <limits>    // for numeric_limits
 #include <memory>   // for allocator
+#include <memory_resource>  // for memory_resource, get_default_resource
 #include <sstream>  // IWYU pragma: keep
-#include <utility>  // for pair
+#include <string>   // for string
+#include <string_view>  // for string_view
+#include <utility>  // for pair, as_const, swap
+#include <vector>   // for vector
 
 #include "ftxui/screen/screen.hpp"
-#include "ftxui/screen/string.hpp"    // for string_width
+#include "ftxui/screen/cursor_motion.hpp"  // for CursorMotion, CursorPosition
+#include "ftxui/screen/frame_protocol.hpp"  // for FrameEncoder, FrameDecoder
+#include "ftxui/screen/row_compare.hpp"    // for DifferingColumns, Span
 #include "ftxui/screen/terminal.hpp"  // for Dimensions, Size
+#include "ftxui/screen/util.hpp"      // for AppendInt, DigitCount, HeapSize
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
+#include <io.h>  // for _write
 #include <windows.h>
+#else
+#include <unistd.h>  // for write
+#include <cerrno>    // for errno, EINTR
 #endif
 
 namespace ftxui {
 
 namespace {
 
+// The bands of rows encoded in parallel by ToString(). See SetParallelOutput().
+constexpr int kMinBandRows = 8;
+constexpr int kMaxBands = 32;
+
+// Swap the content of two buffers. Their memory is only exchanged when they
+// were allocated from the same resource.
+template <class T>
+void SwapBuffers(std::pmr::vector<T>& a, std::pmr::vector<T>& b) {
+  if (a.get_allocator() == b.get_allocator()) {
+    a.swap(b);
+    return;
+  }
+  std::pmr::vector<T> copy(a, a.get_allocator());
+  a.assign(b.begin(), b.end());
+  b.assign(copy.begin(), copy.end());
+}
+
 Pixel& dev_null_pixel() {
-  static Pixel pixel;
+  // One per thread: subscreens can be drawn into from several threads.
+  thread_local Pixel pixel;
   return pixel;
 }
 
 #if defined(_WIN32)
 void WindowsEmulateVT100Terminal() {
-  static bool done = false;
-  if (done)
+  static std::atomic<bool> done = false;
+  if (done.exchange(true))
     return;
-  done = true;
 
   // Enable VT processing on stdout and stdin
   auto stdout_handle = GetStdHandle(STD_OUTPUT_HANDLE);
@@ -49,79 +82,252 @@ void WindowsEmulateVT100Terminal() {
 }
 #endif
 
-void UpdatePixelStyle(std::stringstream& ss,
-                      Pixel& previous,
-                      const Pixel& next) {
-  if (next == previous) {
-    return;
-  }
-
-  if ((!next.bold && previous.bold) ||  //
-      (!next.dim && previous.dim)) {
-    ss << "\x1B[22m";  // BOLD_RESET and DIM_RESET
+using util::AppendInt;
+using util::DigitCount;
+
+// Append the SGR parameters turning the style of |previous| into the style of
+// |next|, each one followed by a ';'.
+void AppendIncrementalStyle(std::string& out,
+                            const Pixel& previous,
+                            const Pixel& next) {
+  bool bold = previous.bold;
+  bool dim = previous.dim;
+  bool underlined = previous.underlined;
+  bool underlined_double = previous.underlined_double;
+
+  if ((!next.bold && bold) || (!next.dim && dim)) {
+    out += "22;";  // BOLD_RESET and DIM_RESET
     // We might have wrongfully reset dim or bold because they share the same
     // resetter. Take it into account so that the side effect will cause it to
     // be set again below.
-    previous.bold = false;
-    previous.dim = false;
+    bold = false;
+    dim = false;
   }
 
-  if ((!next.underlined && previous.underlined) ||
-      (!next.underlined_double && previous.underlined_double)) {
+  if ((!next.underlined && underlined) ||
+      (!next.underlined_double && underlined_double)) {
     // We might have wrongfully reset underlined or underlinedbold because they
     // share the same resetter. Take it into account so that the side effect
     // will cause it to be set again below.
-    ss << "\x1B[24m";  // UNDERLINED_RESET
-    previous.underlined = false;
-    previous.underlined_double = false;
+    out += "24;";  // UNDERLINED_RESET
+    underlined = false;
+    underlined_double = false;
   }
 
-  if (next.bold && !previous.bold) {
-    ss << "\x1B[1m";  // BOLD_SET
+  if (next.bold && !bold) {
+    out += "1;";  // BOLD_SET
   }
 
-  if (next.dim && !previous.dim) {
-    ss << "\x1B[2m";  // DIM_SET
+  if (next.dim && !dim) {
+    out += "2;";  // DIM_SET
   }
 
-  if (next.underlined && !previous.underlined) {
-    ss << "\x1B[4m";  // UNDERLINED_SET
+  if (next.underlined && !underlined) {
+    out += "4;";  // UNDERLINED_SET
   }
 
   if (next.blink && !previous.blink) {
-    ss << "\x1B[5m";  // BLINK_SET
+    out += "5;";  // BLINK_SET
   }
 
   if (!next.blink && previous.blink) {
-    ss << "\x1B[25m";  // BLINK_RESET
+    out += "25;";  // BLINK_RESET
   }
 
   if (next.inverted && !previous.inverted) {
-    ss << "\x1B[7m";  // INVERTED_SET
+    out += "7;";  // INVERTED_SET
   }
 
   if (!next.inverted && previous.inverted) {
-    ss << "\x1B[27m";  // INVERTED_RESET
+    out += "27;";  // INVERTED_RESET
   }
 
   if (next.strikethrough && !previous.strikethrough) {
-    ss << "\x1B[9m";  // CROSSED_OUT
+    out += "9;";  // CROSSED_OUT
   }
 
   if (!next.strikethrough && previous.strikethrough) {
-    ss << "\x1B[29m";  // CROSSED_OUT_RESET
+    out += "29;";  // CROSSED_OUT_RESET
   }
 
-  if (next.underlined_double && !previous.underlined_double) {
-    ss << "\x1B[21m";  // DOUBLE_UNDERLINED_SET
+  if (next.underlined_double && !underlined_double) {
+    out += "21;";  // DOUBLE_UNDERLINED_SET
   }
 
-  if (next.foreground_color != previous.foreground_color ||
-      next.background_color != previous.background_color) {
-    ss << "\x1B[" + next.foreground_color.Print(false) + "m";
-    ss << "\x1B[" + next.background_color.Print(true) + "m";
+  if (next.foreground_color != previous.foreground_color) {
+    next.foreground_color.Print(out, false);
+    out += ';';
   }
 
+  if (next.background_color != previous.background_color) {
+    next.background_color.Print(out, true);
+    out += ';';
+  }
+}
+
+// Append the SGR parameters resetting every attribute, and then setting the
+// style of |next|, each one followed by a ';'.
+void AppendResetStyle(std::string& out, const Pixel& next) {
+  out += "0;";  // RESET
+  if (next.bold) {
+    out += "1;";
+  }
+  if (next.dim) {
+    out += "2;";
+  }
+  if (next.underlined) {
+    out += "4;";
+  }
+  if (next.blink) {
+    out += "5;";
+  }
+  if (next.inverted) {
+    out += "7;";
+  }
+  if (next.strikethrough) {
+    out += "9;";
+  }
+  if (next.underlined_double) {
+    out += "21;";
+  }
+  if (next.foreground_color != Color()) {
+    next.foreground_color.Print(out, false);
+    out += ';';
+  }
+  if (next.background_color != Color()) {
+    next.background_color.Print(out, true);
+    out += ';';
+  }
+}
+
+// Append a single SGR sequence turning the style of |previous| into the style
+// of |next|. When some attributes must be turned off, a full reset followed by
+// the attributes of |next| is used instead, if and only if it is shorter.
+void AppendStyleTransition(std::string& out,
+                           const Pixel& previous,
+                           const Pixel& next) {
+  const bool turns_off = (previous.bold && !next.bold) ||
+                         (previous.dim && !next.dim) ||
+                         (previous.underlined && !next.underlined) ||
+                         (previous.underlined_double &&
+                          !next.underlined_double) ||
+                         (previous.blink && !next.blink) ||
+                         (previous.inverted && !next.inverted) ||
+                         (previous.strikethrough && !next.strikethrough) ||
+                         (previous.foreground_color != Color() &&
+                          next.foreground_color == Color()) ||
+                         (previous.background_color != Color() &&
+                          next.background_color == Color());
+
+  const size_t start = out.size();
+  out += "\x1B[";
+  AppendIncrementalStyle(out, previous, next);
+
+  // Without anything to turn off, the incremental form is always the shortest.
+  if (turns_off) {
+    const size_t middle = out.size();
+    AppendResetStyle(out, next);
+    const size_t incremental_size = middle - start - 2;
+    const size_t reset_size = out.size() - middle;
+    if (reset_size < incremental_size) {
+      out.erase(start + 2, incremental_size);
+    } else {
+      out.resize(middle);
+    }
+  }
+
+  if (out.size() == start + 2) {
+    // Only the glyph differs.
+    out.resize(start);
+  } else {
+    out.back() = 'm';
+  }
+}
+
+// The style of a Pixel, without its glyph. Two pixels are drawn with the same
+// SGR attributes if and only if their packed styles are equal.
+struct PackedStyle {
+  uint64_t colors = 0;
+  uint8_t attributes = 0;
+  bool operator==(const PackedStyle& other) const = default;
+};
+
+PackedStyle PackStyle(const Pixel& pixel) {
+  return {
+      uint64_t(pixel.foreground_color.Pack()) << 32U |  // NOLINT
+          pixel.background_color.Pack(),
+      uint8_t(pixel.blink |                    //
+              pixel.bold << 1U |               //
+              pixel.dim << 2U |                //
+              pixel.inverted << 3U |           //
+              pixel.underlined << 4U |         //
+              pixel.underlined_double << 5U |  // NOLINT
+              pixel.strikethrough << 6U),      // NOLINT
+  };
+}
+
+// The number of style transitions cached per thread.
+constexpr size_t kStyleCacheSize = 256;
+
+// Append the SGR sequence turning the style of |previous| into the style of
+// |next|. A frame uses a few distinct styles, so the sequences between them are
+// computed once, and then copied.
+void AppendCachedTransition(std::string& out,
+                            const Pixel& previous,
+                            const Pixel& next) {
+  const PackedStyle from = PackStyle(previous);
+  const PackedStyle to = PackStyle(next);
+  if (from == to) {
+    // Only the glyph differs.
+    return;
+  }
+
+  // Direct mapped, one per thread, since the bands of rows are encoded in
+  // parallel. Zero initialized, every entry starts as a valid transition
+  // between two equal styles.
+  struct Entry {
+    PackedStyle from;
+    PackedStyle to;
+    std::string sequence;
+  };
+  thread_local std::array<Entry, kStyleCacheSize> cache;
+  const uint64_t hash =
+      (from.colors ^ (to.colors * 0x9E3779B97F4A7C15ULL) ^  // NOLINT
+       (uint64_t(from.attributes) << 8U | to.attributes)) *  // NOLINT
+      0xFF51AFD7ED558CCDULL;                                  // NOLINT
+  Entry& entry = cache[(hash >> 32U) % kStyleCacheSize];      // NOLINT
+  if (entry.from != from || entry.to != to) {
+    entry.sequence.clear();
+    AppendStyleTransition(entry.sequence, previous, next);
+    entry.from = from;
+    entry.to = to;
+  }
+  out += entry.sequence;
+}
+
+// Append the SGR sequence turning the style of |previous| into the style of
+// |next|, and update |previous|.
+void UpdatePixelStyle(std::string& out, Pixel& previous, const Pixel& next) {
+  if (next == previous) {
+    return;
+  }
+  // Without color support, the text is drawn without any style, as by
+  // ToPlainText().
+  if (Terminal::ColorSupport() == Terminal::Color::Palette1) {
+    previous = next;
+    return;
+  }
+  if (Terminal::NoColor()) {
+    // Only the colors are omitted. The other attributes, like the inverted
+    // focused entries, are kept.
+    Pixel from = previous;
+    Pixel to = next;
+    from.foreground_color = from.background_color = Color();
+    to.foreground_color = to.background_color = Color();
+    AppendCachedTransition(out, from, to);
+  } else {
+    AppendCachedTransition(out, previous, next);
+  }
   previous = next;
 }
 
@@ -132,25 +338,20 @@ struct TileEncoding {
   uint8_t down : 2;
   uint8_t round : 1;
 
-  // clang-format off
-  bool operator<(const TileEncoding& other) const {
-    if (left < other.left)   { return  true;  }
-    if (left > other.left)   { return  false; }
-    if (top < other.top)     { return  true;  }
-    if (top > other.top)     { return  false; }
-    if (right < other.right) { return  true;  }
-    if (right > other.right) { return  false; }
-    if (down < other.down)   { return  true;  }
-    if (down > other.down)   { return  false; }
-    if (round < other.round) { return  true;  }
-    if (round > other.round) { return  false; }
-      return false;
-  }
-  // clang-format on
+  // Pack the encoding into 9 bits.
+  constexpr uint16_t Pack() const {
+    return uint16_t(left | (top << 2) | (right << 4) | (down << 6) |  // NOLINT
+                    (round << 8));                                   // NOLINT
+  }
+};
+
+struct TileEntry {
+  const char* glyph;
+  TileEncoding encoding;
 };
 
 // clang-format off
-const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
+constexpr TileEntry tile_encoding[] = { // NOLINT
     {"─", {1, 0, 1, 0, 0}},
     {"━", {2, 0, 2, 0, 0}},
 
@@ -291,73 +492,128 @@ const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
 };
 // clang-format on
 
-template <class A, class B>
-std::map<B, A> InvertMap(const std::map<A, B> input) {
-  std::map<B, A> output;
-  for (const auto& it : input) {
-    output[it.second] = it.first;
+// The box drawing characters are the block U+2500-U+257F. They are encoded in
+// UTF-8 as: 0xE2 [0x94-0x95] [0x80-0xBF].
+constexpr int box_drawing_size = 128;
+constexpr int tile_encoding_size = 512;  // 9 bits.
+constexpr uint8_t no_glyph = 0xFF;
+
+// Return the offset of |glyph| in the box drawing block, or -1.
+constexpr int BoxDrawingOffset(std::string_view glyph) {
+  if (glyph.size() != 3 || uint8_t(glyph[0]) != 0xE2) {  // NOLINT
+    return -1;
+  }
+  const auto b1 = uint8_t(glyph[1]);
+  const auto b2 = uint8_t(glyph[2]);
+  if ((b1 != 0x94 && b1 != 0x95) || (b2 & 0xC0) != 0x80) {  // NOLINT
+    return -1;
+  }
+  return ((b1 - 0x94) << 6) | (b2 & 0x3F);  // NOLINT
+}
+
+Glyph BoxDrawingGlyph(int offset) {
+  const std::array<char, 3> data = {
+      char(0xE2),                    // NOLINT
+      char(0x94 + (offset >> 6)),    // NOLINT
+      char(0x80 + (offset & 0x3F)),  // NOLINT
+  };
+  return {std::string_view(data.data(), data.size())};
+}
+
+// Dense lookup tables, replacing string keyed maps.
+struct TileTables {
+  // Indexed by the offset in the box drawing block.
+  std::array<TileEncoding, box_drawing_size> encoding{};
+  std::array<bool, box_drawing_size> is_tile{};
+  // Indexed by the packed encoding. Contains the offset in the box drawing
+  // block, or |no_glyph|.
+  std::array<uint8_t, tile_encoding_size> glyph{};
+};
+
+constexpr TileTables MakeTileTables() {
+  TileTables tables;
+  for (auto& glyph : tables.glyph) {
+    glyph = no_glyph;
+  }
+  for (const auto& entry : tile_encoding) {
+    const int offset = BoxDrawingOffset(entry.glyph);
+    tables.encoding[offset] = entry.encoding;
+    tables.is_tile[offset] = true;
+    tables.glyph[entry.encoding.Pack()] = uint8_t(offset);
+  }
+  return tables;
+}
+
+constexpr TileTables tile_tables = MakeTileTables();
+
+// Return the encoding of |glyph|, or nullptr if it isn't a tile.
+const TileEncoding* FindTile(const Glyph& glyph) {
+  const int offset = BoxDrawingOffset(glyph.view());
+  if (offset < 0 || !tile_tables.is_tile[offset]) {
+    return nullptr;
   }
-  return output;
+  return &tile_tables.encoding[offset];
 }
 
-const std::map<TileEncoding, std::string> tile_encoding_inverse =  // NOLINT
-    InvertMap(tile_encoding);
+// Replace |glyph| by the tile of |encoding|, if it exists.
+void SetTile(Glyph& glyph, const TileEncoding& encoding) {
+  const uint8_t offset = tile_tables.glyph[encoding.Pack()];
+  if (offset != no_glyph) {
+    glyph = BoxDrawingGlyph(offset);
+  }
+}
 
-void UpgradeLeftRight(std::string& left, std::string& right) {
-  const auto it_left = tile_encoding.find(left);
-  if (it_left == tile_encoding.end()) {
+void UpgradeLeftRight(Glyph& left, Glyph& right) {
+  const TileEncoding* tile_left = FindTile(left);
+  if (!tile_left) {
     return;
   }
-  const auto it_right = tile_encoding.find(right);
-  if (it_right == tile_encoding.end()) {
+  const TileEncoding* tile_right = FindTile(right);
+  if (!tile_right) {
     return;
   }
 
-  if (it_left->second.right == 0 && it_right->second.left != 0) {
-    TileEncoding encoding_left = it_left->second;
-    encoding_left.right = it_right->second.left;
-    const auto it_left_upgrade = tile_encoding_inverse.find(encoding_left);
-    if (it_left_upgrade != tile_encoding_inverse.end()) {
-      left = it_left_upgrade->second;
-    }
+  // Copy, the glyphs are modified below.
+  const TileEncoding encoding_left = *tile_left;
+  const TileEncoding encoding_right = *tile_right;
+
+  if (encoding_left.right == 0 && encoding_right.left != 0) {
+    TileEncoding upgrade = encoding_left;
+    upgrade.right = encoding_right.left;
+    SetTile(left, upgrade);
   }
 
-  if (it_right->second.left == 0 && it_left->second.right != 0) {
-    TileEncoding encoding_right = it_right->second;
-    encoding_right.left = it_left->second.right;
-    const auto it_right_upgrade = tile_encoding_inverse.find(encoding_right);
-    if (it_right_upgrade != tile_encoding_inverse.end()) {
-      right = it_right_upgrade->second;
-    }
+  if (encoding_right.left == 0 && encoding_left.right != 0) {
+    TileEncoding upgrade = encoding_right;
+    upgrade.left = encoding_left.right;
+    SetTile(right, upgrade);
   }
 }
 
-void UpgradeTopDown(std::string& top, std::string& down) {
-  const auto it_top = tile_encoding.find(top);
-  if (it_top == tile_encoding.end()) {
+void UpgradeTopDown(Glyph& top, Glyph& down) {
+  const TileEncoding* tile_top = FindTile(top);
+  if (!tile_top) {
     return;
   }
-  const auto it_down = tile_encoding.find(down);
-  if (it_down == tile_encoding.end()) {
+  const TileEncoding* tile_down = FindTile(down);
+  if (!tile_down) {
     return;
   }
 
-  if (it_top->second.down == 0 && it_down->second.top != 0) {
-    TileEncoding encoding_top = it_top->second;
-    encoding_top.down = it_down->second.top;
-    const auto it_top_down = tile_encoding_inverse.find(encoding_top);
-    if (it_top_down != tile_encoding_inverse.end()) {
-      top = it_top_down->second;
-    }
+  // Copy, the glyphs are modified below.
+  const TileEncoding encoding_top = *tile_top;
+  const TileEncoding encoding_down = *tile_down;
+
+  if (encoding_top.down == 0 && encoding_down.top != 0) {
+    TileEncoding upgrade = encoding_top;
+    upgrade.down = encoding_down.top;
+    SetTile(top, upgrade);
   }
 
-  if (it_down->second.top == 0 && it_top->second.down != 0) {
-    TileEncoding encoding_down = it_down->second;
-    encoding_down.top = it_top->second.down;
-    const auto it_down_top = tile_encoding_inverse.find(encoding_down);
-    if (it_down_top != tile_encoding_inverse.end()) {
-      down = it_down_top->second;
-    }
+  if (encoding_down.top == 0 && encoding_top.down != 0) {
+    TileEncoding upgrade = encoding_down;
+    upgrade.top = encoding_top.down;
+    SetTile(down, upgrade);
   }
 }
 
@@ -365,18 +621,95 @@ bool ShouldAttemptAutoMerge(Pixel& pixel) {
   return pixel.automerge && pixel.character.size() == 3;
 }
 
+// Whether |pixel| is a blank cell, with the default style. Those are the cells
+// left by "erase in line".
+bool IsDefaultBlank(const Pixel& pixel) {
+  Pixel blank;
+  blank.automerge = pixel.automerge;
+  return pixel == blank;
+}
+
+// Whether two pixels are drawn using the same style.
+bool SameStyle(const Pixel& a, const Pixel& b) {
+  Pixel styled = a;
+  styled.character = b.character;
+  styled.automerge = b.automerge;
+  return styled == b;
+}
+
+// REP repeats the last codepoint written. Only use it for the glyphs made of a
+// single codepoint occupying a single cell: ASCII, box drawing, and block
+// elements.
+bool IsRepeatable(std::string_view glyph) {
+  if (glyph.size() == 1) {
+    return glyph[0] >= ' ' && glyph[0] < 0x7F;  // NOLINT
+  }
+  // U+2500-U+25BF.
+  return glyph.size() == 3 && uint8_t(glyph[0]) == 0xE2 &&  // NOLINT
+         uint8_t(glyph[1]) >= 0x94 && uint8_t(glyph[1]) <= 0x96;  // NOLINT
+}
+
+// A band of rows that moved vertically in between two frames: the rows
+// [begin, end) of the new frame were the rows [begin + offset, end + offset)
+// of the previous one.
+struct VerticalShift {
+  int begin = 0;
+  int end = 0;
+  int offset = 0;
+};
+
+// Find the band of rows whose vertical shift avoids rewriting the most rows,
+// by comparing their hashes. Returns an empty band when no shift is worth it.
+VerticalShift FindVerticalShift(const std::vector<uint64_t>& previous,
+                                const std::vector<uint64_t>& next) {
+  // Scrolling costs a few escape sequences. Below this number of rows moved,
+  // rewriting them is about as cheap.
+  const int min_gain = 2;
+
+  const int size = static_cast<int>(next.size());
+  VerticalShift best;
+  int best_gain = min_gain - 1;
+  for (int offset = 1 - size; offset < size; ++offset) {
+    if (offset == 0) {
+      continue;
+    }
+    const int y_min = std::max(0, -offset);
+    const int y_max = std::min(size, size - offset);
+    int begin = y_min;
+    int gain = 0;
+    for (int y = y_min; y <= y_max; ++y) {
+      if (y < y_max && next[y] == previous[y + offset]) {
+        // Rows already identical in place don't need to move.
+        if (next[y] != previous[y]) {
+          ++gain;
+        }
+        continue;
+      }
+      if (gain > best_gain) {
+        best = {begin, y, offset};
+        best_gain = gain;
+      }
+      begin = y + 1;
+      gain = 0;
+    }
+  }
+  return best;
+}
+
 }  // namespace
 
 bool Pixel::operator==(const Pixel& other) const {
-  return character == other.character &&                //
-         background_color == other.background_color &&  //
-         foreground_color == other.foreground_color &&  //
-         blink == other.blink &&                        //
-         bold == other.bold &&                          //
-         dim == other.dim &&                            //
-         inverted == other.inverted &&                  //
-         underlined == other.underlined &&              //
-         automerge == other.automerge;                  //
+  return character == other.character &&                  //
+         background_color == other.background_color &&    //
+         foreground_color == other.foreground_color &&    //
+         blink == other.blink &&                          //
+         bold == other.bold &&                            //
+         dim == other.dim &&                              //
+         inverted == other.inverted &&                    //
+         underlined == other.underlined &&                //
+         underlined_double == other.underlined_double &&  //
+         strikethrough == other.strikethrough &&          //
+         automerge == other.automerge;                    //
 }
 
 /// A fixed dimension.
@@ -406,10 +739,21 @@ Screen Screen::Create(Dimensions dimension) {
 }
 
 Screen::Screen(int dimx, int dimy)
+    : Screen(dimx, dimy, std::pmr::get_default_resource()) {}
+
+/// Create a screen with the given dimension, whose pixels are allocated from
+/// |resource| instead of the heap. For instance, a
+/// std::pmr::monotonic_buffer_resource over a buffer reserved upfront.
+/// The |resource| must outlive the screen. The copies of the screen use the
+/// default resource.
+Screen::Screen(int dimx, int dimy, std::pmr::memory_resource* resource)
     : stencil{0, dimx - 1, 0, dimy - 1},
       dimx_(dimx),
       dimy_(dimy),
-      pixels_(dimy, std::vector<Pixel>(dimx)) {
+      pixels_(size_t(dimx) * size_t(dimy), resource),
+      row_generation_(dimy, 0, resource),
+      blank_row_(dimx, resource),
+      row_spans_(dimy) {
 #if defined(_WIN32)
   // The placement of this call is a bit weird, however we can assume that
   // anybody who instantiates a Screen object eventually wants to output
@@ -425,39 +769,546 @@ Screen::Screen(int dimx, int dimy)
 /// Produce a std::string that can be used to print the Screen on the terminal.
 /// Don't forget to flush stdout. Alternatively, you can use Screen::Print();
 std::string Screen::ToString() {
-  std::stringstream ss;
+  std::string out;
+  out.reserve(output_size_hint_);
+  ToString(out);
+  return out;
+}
 
-  Pixel previous_pixel;
-  const Pixel final_pixel;
+/// Produce the text of the screen, without any style. The rows are separated
+/// by '\n', and their trailing blanks are trimmed. Unlike ToString(), nothing
+/// is compared to the style of the previous pixel: the glyphs are copied.
+std::string Screen::ToPlainText() const {
+  std::string out;
+  ToPlainText(out);
+  return out;
+}
 
+/// Same as ToPlainText(), but write into |out|. Its previous content is
+/// replaced, but its capacity is reused.
+void Screen::ToPlainText(std::string& out) const {
+  static constexpr Glyph kBlank = Glyph::Narrow(" ");
+  out.clear();
+  out.reserve(size_t(dimx_ + 1) * size_t(dimy_));
   for (int y = 0; y < dimy_; ++y) {
     if (y != 0) {
-      UpdatePixelStyle(ss, previous_pixel, final_pixel);
-      ss << "\r\n";
+      out += '\n';
+    }
+    const auto row = Row(y);
+    int end = dimx_;
+    while (end > 0 && (row[end - 1].character == kBlank ||
+                       row[end - 1].character.empty())) {
+      --end;
     }
     bool previous_fullwidth = false;
-    for (const auto& pixel : pixels_[y]) {
-      if (!previous_fullwidth) {
-        UpdatePixelStyle(ss, previous_pixel, pixel);
-        ss << pixel.character;
+    for (int x = 0; x < end; ++x) {
+      const Glyph& glyph = row[x].character;
+      if (previous_fullwidth) {
+        previous_fullwidth = glyph.fullwidth();
+        continue;
       }
-      previous_fullwidth = (string_width(pixel.character) == 2);
+      previous_fullwidth = glyph.fullwidth();
+      out += glyph.view();
+    }
+  }
+}
+
+/// Same as ToString(), but write into |out|. Its previous content is replaced,
+/// but its capacity is reused. Passing the same buffer for every frame avoids
+/// allocating a new one each time.
+void Screen::ToString(std::string& out) {
+  ResolveStyleSpans();
+  out.clear();
+
+  const size_t cells = size_t(dimx_) * size_t(dimy_);
+  if (!parallel_for_ || cells < parallel_min_cells_ || dimy_ < 2) {
+    AppendBand(0, dimy_ - 1, out);
+    output_size_hint_ = out.size();
+    return;
+  }
+
+  // Every row starts from the default style, so the bands can be encoded
+  // independently, and concatenated.
+  const int band_rows = std::max(kMinBandRows, dimy_ / kMaxBands);
+  bands_.resize(size_t((dimy_ + band_rows - 1) / band_rows));
+  parallel_for_(bands_.size(), [&](size_t i) {
+    const int y_min = int(i) * band_rows;
+    bands_[i].clear();
+    AppendBand(y_min, std::min(y_min + band_rows, dimy_) - 1, bands_[i]);
+  });
+  size_t size = 0;
+  for (const std::string& band : bands_) {
+    size += band.size();
+  }
+  out.reserve(size);
+  for (const std::string& band : bands_) {
+    out += band;
+  }
+  output_size_hint_ = out.size();
+}
+
+// Append the rows [y_min, y_max], preceded by the line break of the previous
+// one. The style is reset at the end.
+void Screen::AppendBand(int y_min, int y_max, std::string& out) const {
+  Pixel previous_pixel;
+  const Pixel final_pixel;
+
+  for (int y = y_min; y <= y_max; ++y) {
+    if (y != 0) {
+      UpdatePixelStyle(out, previous_pixel, final_pixel);
+      out += "\r\n";
+    }
+    AppendRow(y, previous_pixel, out);
+  }
+
+  UpdatePixelStyle(out, previous_pixel, final_pixel);
+}
+
+/// @brief Let ToString() encode bands of rows in parallel, using
+/// |parallel_for|, once the screen has |min_cells| cells or more. The output
+/// is identical. Pass an empty function to disable it.
+/// @param parallel_for calls its task for every index in [0, count), possibly
+///        from several threads, and returns once they all returned.
+/// @param min_cells the number of cells below which the encoding is serial.
+void Screen::SetParallelOutput(ParallelFor parallel_for, size_t min_cells) {
+  parallel_for_ = std::move(parallel_for);
+  parallel_min_cells_ = min_cells;
+}
+
+/// @brief Let ToString() shorten its output, using escape sequences not
+/// supported by every terminal. Both are disabled by default.
+/// @param erase_line Erase the trailing blanks of the lines using "erase in
+///        line" (`CSI K`), instead of writing them.
+/// @param repeat Write the runs of an identical character once, followed by
+///        REP (`CSI n b`).
+/// @see Terminal::RepeatSupport
+void Screen::SetRunLengthOutput(bool erase_line, bool repeat) {
+  erase_line_ = erase_line;
+  repeat_ = repeat;
+}
+
+/// Append the row |y| to |out|, the cursor being at its beginning. The cursor
+/// is left at its end.
+void Screen::AppendRow(int y, Pixel& previous_pixel, std::string& out) const {
+  const auto row = Row(y);
+
+  // The trailing blanks are erased instead of written, when it is shorter. On
+  // the last row, the cursor must still be moved to the end.
+  int end = dimx_;
+  if (erase_line_) {
+    while (end > 0 && IsDefaultBlank(row[end - 1])) {
+      --end;
+    }
+    const int blanks = dimx_ - end;
+    const int cost = y == dimy_ - 1 ? 6 + DigitCount(blanks) : 3;
+    if (blanks <= cost) {
+      end = dimx_;
     }
   }
 
-  UpdatePixelStyle(ss, previous_pixel, final_pixel);
+  bool previous_fullwidth = false;
+  for (int x = 0; x < end; ++x) {
+    const Pixel& pixel = row[x];
+    if (previous_fullwidth) {
+      previous_fullwidth = pixel.character.fullwidth();
+      continue;
+    }
+    const std::string_view glyph = pixel.character.view();
+    UpdatePixelStyle(out, previous_pixel, pixel);
+    out += glyph;
+    previous_fullwidth = pixel.character.fullwidth();
+
+    if (!repeat_ || !IsRepeatable(glyph)) {
+      continue;
+    }
+    int repeated = 0;
+    while (x + 1 + repeated < end && row[x + 1 + repeated] == pixel) {
+      ++repeated;
+    }
+    if (int(glyph.size()) * repeated > 3 + DigitCount(repeated)) {
+      out += "\x1B[";  // REPEAT
+      AppendInt(out, repeated);
+      out += "b";
+      x += repeated;
+    }
+  }
+
+  if (end != dimx_) {
+    UpdatePixelStyle(out, previous_pixel, Pixel());
+    out += "\x1B[K";  // ERASE_LINE
+    if (y == dimy_ - 1) {
+      out += "\x1B[";  // MOVE_RIGHT
+      AppendInt(out, dimx_ - end);
+      out += "C";
+    }
+  }
+}
 
-  return ss.str();
+/// Produce a std::string updating a terminal displaying |previous| into
+/// displaying this Screen. Only the runs of cells that differ are written,
+/// using cursor movements to jump over the unchanged ones.
+/// The cursor is expected at the beginning of the first line. It is left at the
+/// same position ToString() would have left it.
+/// If the two screens have different dimensions, this is equivalent to
+/// ToString().
+std::string Screen::ToStringDiff(const Screen& previous) {
+  std::string out;
+  ToStringDiff(previous, out);
+  return out;
+}
+
+/// Same as ToStringDiff(previous), but write into |out|. Its previous content
+/// is replaced, but its capacity is reused.
+void Screen::ToStringDiff(const Screen& previous, std::string& out) {
+  ResolveStyleSpans();
+  if (previous.dimx_ != dimx_ || previous.dimy_ != dimy_ ||  //
+      dimx_ == 0 || dimy_ == 0) {
+    ToString(out);
+    return;
+  }
+  out.clear();
+  AppendDiff(previous, /*top=*/-1, out);
+}
+
+/// Append to |out| the update from |previous| into this Screen. Both must have
+/// the same dimensions. |top| is the terminal row displaying the first row, or
+/// -1 when unknown.
+void Screen::AppendDiff(const Screen& previous,
+                        int top,
+                        std::string& out) const {
+  const CursorMotion motion(top);
+
+  Pixel previous_pixel;
+  const Pixel final_pixel;
+
+  CursorPosition cursor;
+  for (int y = 0; y < dimy_; ++y) {
+    const auto row = Row(y);
+    const auto previous_row = previous.Row(y);
+    auto changed = [&](int x) { return !(row[x] == previous_row[x]); };
+
+    // Locate the changed cells using a vectorized comparison, skipping the
+    // identical rows, and the identical prefix and suffix of the others.
+    const row_compare::Span span =
+        row_compare::DifferingColumns(row, previous_row);
+    if (span.first < 0) {
+      continue;
+    }
+    const int span_end = span.last + 1;
+
+    // The number of bytes needed to rewrite the unchanged cells [begin, end),
+    // after the cell |begin - 1|. Only the cells sharing its style are
+    // rewritten.
+    auto rewrite_cost = [&](int begin, int end) {
+      int cost = 0;
+      for (int x = begin; x < end; ++x) {
+        if (!SameStyle(row[x], row[begin - 1])) {
+          return std::numeric_limits<int>::max();
+        }
+        cost += int(row[x].character.size());
+      }
+      return cost;
+    };
+
+    int x = span.first;
+    while (x < span_end) {
+      if (!changed(x)) {
+        ++x;
+        continue;
+      }
+
+      // A run can't start in the middle of a fullwidth character.
+      int begin = x;
+      while (begin > 0 && row[begin].character.empty()) {
+        --begin;
+      }
+
+      // Extend the run, absorbing the gaps of unchanged cells when rewriting
+      // them is cheaper than moving the cursor over them.
+      int end = x + 1;
+      while (true) {
+        int next = end;
+        while (next < span_end && !changed(next)) {
+          ++next;
+        }
+        if (next == span_end ||
+            rewrite_cost(end, next) > motion.Cost({end, y}, {next, y})) {
+          break;
+        }
+        end = next + 1;
+      }
+
+      // Move the cursor to the beginning of the run.
+      motion.Move(out, cursor, {begin, y});
+
+      bool previous_fullwidth = false;
+      for (x = begin; x < end; ++x) {
+        const Pixel& pixel = row[x];
+        if (!previous_fullwidth) {
+          UpdatePixelStyle(out, previous_pixel, pixel);
+          out += pixel.character.view();
+        }
+        previous_fullwidth = pixel.character.fullwidth();
+      }
+
+      // The second half of a fullwidth character was drawn with the first.
+      if (previous_fullwidth) {
+        ++x;
+      }
+
+      // The terminal might be as wide as this screen. After writing its last
+      // column, where the cursor is depends on the terminal.
+      cursor = {x < dimx_ ? x : -1, y};
+    }
+  }
+
+  UpdatePixelStyle(out, previous_pixel, final_pixel);
+
+  // Move the cursor where ToString() would have left it.
+  motion.Move(out, cursor, {dimx_, dimy_ - 1});
+}
+
+/// Same as ToStringDiff(previous, out), but when a band of rows moved
+/// vertically, like a scrolling log, it is scrolled by the terminal using a
+/// scroll region (DECSTBM) and `CSI n S` / `CSI n T`. Only the rows it exposes
+/// are then written.
+/// @param previous The screen currently displayed by the terminal.
+/// @param top The terminal row, starting from 0, displaying the first row of
+///        this screen. Scroll regions are defined in absolute terminal rows.
+/// @param out Receives the output. Its capacity is reused.
+void Screen::ToStringScrollDiff(const Screen& previous,
+                                int top,
+                                std::string& out) {
+  ResolveStyleSpans();
+  if (previous.dimx_ != dimx_ || previous.dimy_ != dimy_ ||  //
+      dimx_ == 0 || dimy_ == 0) {
+    ToString(out);
+    return;
+  }
+
+  std::vector<uint64_t> previous_hashes(dimy_);
+  std::vector<uint64_t> hashes(dimy_);
+  for (int y = 0; y < dimy_; ++y) {
+    previous_hashes[y] = previous.RowHash(y);
+    hashes[y] = RowHash(y);
+  }
+  const VerticalShift shift = FindVerticalShift(previous_hashes, hashes);
+  if (shift.begin == shift.end) {
+    ToStringDiff(previous, out);
+    return;
+  }
+
+  // The scroll region [region_top, region_bottom) spans both the rows moved
+  // and their destination.
+  const int region_top = std::min(shift.begin, shift.begin + shift.offset);
+  const int region_bottom = std::max(shift.end, shift.end + shift.offset);
+  const int distance = std::abs(shift.offset);
+
+  out.clear();
+  out += "\x1B" "7";  // SAVE_CURSOR
+  out += "\x1B[";     // SET_SCROLL_REGION
+  AppendInt(out, top + region_top + 1);
+  out += ";";
+  AppendInt(out, top + region_bottom);
+  out += "r";
+  out += "\x1B[";  // SCROLL_UP / SCROLL_DOWN
+  AppendInt(out, distance);
+  out += shift.offset > 0 ? "S" : "T";
+  out += "\x1B[r";    // RESET_SCROLL_REGION
+  out += "\x1B" "8";  // RESTORE_CURSOR
+
+  // Replicate the scroll on a copy of |previous|, so that it matches what the
+  // terminal displays. The exposed rows are blank.
+  Screen scrolled = previous;
+  auto move_row = [&](int from, int to) {
+    const auto source = std::as_const(scrolled).Row(from);
+    std::copy(source.begin(), source.end(), scrolled.Row(to).begin());
+  };
+  auto blank_row = [&](int y) {
+    const auto row = scrolled.Row(y);
+    std::fill(row.begin(), row.end(), Pixel());
+  };
+  if (shift.offset > 0) {
+    for (int y = region_top; y < region_bottom - distance; ++y) {
+      move_row(y + distance, y);
+    }
+    for (int y = region_bottom - distance; y < region_bottom; ++y) {
+      blank_row(y);
+    }
+  } else {
+    for (int y = region_bottom - 1; y >= region_top + distance; --y) {
+      move_row(y - distance, y);
+    }
+    for (int y = region_top; y < region_top + distance; ++y) {
+      blank_row(y);
+    }
+  }
+
+  AppendDiff(scrolled, top, out);
+}
+
+/// Produce a std::string updating a terminal displaying a previous frame into
+/// displaying this Screen. The rows whose hash is the same as in the previous
+/// frame are skipped. The others are entirely rewritten.
+/// The cursor is expected at the beginning of the first line. It is left at the
+/// same position ToString() would have left it.
+/// @param previous_hashes The hashes of the rows of the previous frame. If the
+///        number of rows differs, this is equivalent to ToString().
+/// @param hashes Receives the hashes of the rows of this screen.
+/// @param out Receives the output. Its capacity is reused.
+void Screen::ToStringRowDiff(const std::vector<uint64_t>& previous_hashes,
+                             std::vector<uint64_t>& hashes,
+                             std::string& out) {
+  ResolveStyleSpans();
+  hashes.resize(dimy_);
+  for (int y = 0; y < dimy_; ++y) {
+    hashes[y] = RowHash(y);
+  }
+
+  if (previous_hashes.size() != hashes.size() || dimx_ == 0 || dimy_ == 0) {
+    ToString(out);
+    return;
+  }
+
+  out.clear();
+
+  const CursorMotion motion;
+  Pixel previous_pixel;
+  const Pixel final_pixel;
+
+  CursorPosition cursor;
+  for (int y = 0; y < dimy_; ++y) {
+    if (hashes[y] == previous_hashes[y]) {
+      continue;
+    }
+    motion.Move(out, cursor, {0, y});
+    AppendRow(y, previous_pixel, out);
+    // The terminal might be as wide as this screen. Where the cursor is after
+    // writing its last column depends on the terminal.
+    cursor = {-1, y};
+  }
+
+  UpdatePixelStyle(out, previous_pixel, final_pixel);
+
+  // Move the cursor where ToString() would have left it.
+  motion.Move(out, cursor, {dimx_, dimy_ - 1});
+}
+
+/// @brief A hash of the content of the row |y|: the characters, and their
+/// style. Two rows with the same content have the same hash.
+/// @param y The line position along the y-axis. Must be in [0, dimy()).
+uint64_t Screen::RowHash(int y) const {
+  // FNV-1a.
+  uint64_t hash = 0xcbf29ce484222325ULL;  // NOLINT
+  auto add = [&hash](uint8_t byte) {
+    hash ^= byte;
+    hash *= 0x100000001b3ULL;  // NOLINT
+  };
+
+  for (const Pixel& pixel : Row(y)) {
+    for (const char c : pixel.character.view()) {
+      add(uint8_t(c));
+    }
+    // Separate the glyphs. 0xFF never appears in UTF-8.
+    add(0xFF);  // NOLINT
+
+    // Both colors, mixed at once.
+    hash ^= uint64_t(pixel.foreground_color.Pack()) |
+            uint64_t(pixel.background_color.Pack()) << 32U;  // NOLINT
+    hash *= 0x100000001b3ULL;                                // NOLINT
+
+    add(uint8_t(pixel.blink << 0U |              // NOLINT
+                pixel.bold << 1U |               // NOLINT
+                pixel.dim << 2U |                // NOLINT
+                pixel.inverted << 3U |           // NOLINT
+                pixel.underlined << 4U |         // NOLINT
+                pixel.underlined_double << 5U |  // NOLINT
+                pixel.strikethrough << 6U));     // NOLINT
+  }
+  return hash;
+}
+
+/// @brief Encode the screen into a compact binary snapshot, independent of the
+/// terminal: a key frame of the FrameEncoder protocol. Only the cells differing
+/// from a blank screen are stored, and every glyph and style only once.
+/// @see Deserialize
+std::string Screen::Serialize() {
+  ResolveStyleSpans();
+  std::string out;
+  FrameEncoder().Encode(*this, out);
+  return out;
+}
+
+/// @brief Decode a snapshot produced by Serialize() into |screen|.
+/// @return false, leaving |screen| unchanged, when |data| isn't a snapshot.
+bool Screen::Deserialize(std::string_view data, Screen& screen) {
+  FrameDecoder decoder;
+  if (!decoder.Decode(data) || !data.empty()) {
+    return false;
+  }
+  screen = decoder.screen();
+  return true;
 }
 
 void Screen::Print() {
   std::cout << ToString() << '\0' << std::flush;
 }
 
+/// @brief Write the screen to the file descriptor |fd|, like ToString(). The
+/// output is buffered: a screen smaller than the buffer is written at once.
+void Screen::Print(int fd) {
+  Print([fd](std::string_view chunk) {
+    while (!chunk.empty()) {
+#if defined(_WIN32)
+      const int written = _write(fd, chunk.data(), unsigned(chunk.size()));
+#else
+      const ssize_t written = write(fd, chunk.data(), chunk.size());
+      if (written < 0 && errno == EINTR) {
+        continue;
+      }
+#endif
+      if (written <= 0) {
+        return;
+      }
+      chunk.remove_prefix(size_t(written));
+    }
+  });
+}
+
+/// @brief Write the screen to |file|, like ToString(), and flush it.
+void Screen::Print(std::FILE* file) {
+  Print([file](std::string_view chunk) {
+    std::fwrite(chunk.data(), 1, chunk.size(), file);
+  });
+  std::fflush(file);
+}
+
+/// @brief Stream the screen to |sink|, like ToString(). The rows are encoded
+/// one after the other into a buffer, passed to |sink| every time it holds
+/// |buffer_size| bytes or more. Only the buffer is kept in memory, however
+/// large the screen is.
+void Screen::Print(const Sink& sink, size_t buffer_size) {
+  ResolveStyleSpans();
+  std::string buffer;
+  buffer.reserve(buffer_size);
+  // Every row starts and ends in the default style, like the bands encoded by
+  // SetParallelOutput(), so they can be encoded one at a time.
+  for (int y = 0; y < dimy_; ++y) {
+    AppendBand(y, y, buffer);
+    if (buffer.size() >= buffer_size) {
+      sink(buffer);
+      buffer.clear();
+    }
+  }
+  if (!buffer.empty()) {
+    sink(buffer);
+  }
+}
+
 /// @brief Access a character a given position.
 /// @param x The character position along the x-axis.
 /// @param y The character position along the y-axis.
-std::string& Screen::at(int x, int y) {
+Glyph& Screen::at(int x, int y) {
   return PixelAt(x, y).character;
 }
 
@@ -465,7 +1316,95 @@ std::string& Screen::at(int x, int y) {
 /// @param x The pixel position along the x-axis.
 /// @param y The pixel position along the y-axis.
 Pixel& Screen::PixelAt(int x, int y) {
-  return stencil.Contain(x, y) ? pixels_[y][x] : dev_null_pixel();
+  return stencil.Contain(x, y) ? WritableRow(y)[x] : dev_null_pixel();
+}
+
+/// @brief Access the line of pixels at a given position.
+/// They are stored contiguously, from left to right.
+/// @param y The line position along the y-axis. Must be in [0, dimy()).
+std::span<Pixel> Screen::Row(int y) {
+  return {WritableRow(y), static_cast<size_t>(dimx_)};
+}
+
+/// @brief Access the line of pixels at a given position.
+/// They are stored contiguously, from left to right.
+/// @param y The line position along the y-axis. Must be in [0, dimy()).
+std::span<const Pixel> Screen::Row(int y) const {
+  if (target_ != nullptr) {
+    return std::as_const(*target_).Row(y);
+  }
+  const Pixel* row = IsBlankRow(y) ? blank_row_.data()  //
+                                   : pixels_.data() + y * dimx_;
+  return {row, static_cast<size_t>(dimx_)};
+}
+
+/// @brief Set every pixel of |box| to |pixel|. The box is clipped by the
+/// stencil.
+void Screen::FillRect(Box box, const Pixel& pixel) {
+  box = Box::Intersection(box, stencil);
+  if (box.x_min > box.x_max) {
+    return;
+  }
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    Pixel* row = WritableRow(y);
+    std::fill(row + box.x_min, row + box.x_max + 1, pixel);
+  }
+}
+
+/// @brief Copy a rectangle of pixels into |box|. The box is clipped by the
+/// stencil: the pixels falling outside are skipped.
+/// @param box The destination.
+/// @param pixels The pixels of the box, line after line. There must be one for
+///               every cell of the box.
+void Screen::BlitRect(Box box, std::span<const Pixel> pixels) {
+  const int width = box.x_max - box.x_min + 1;
+  const Box clip = Box::Intersection(box, stencil);
+  if (clip.x_min > clip.x_max) {
+    return;
+  }
+  for (int y = clip.y_min; y <= clip.y_max; ++y) {
+    const Pixel* in = pixels.data() +
+                      size_t(y - box.y_min) * size_t(width) +
+                      size_t(clip.x_min - box.x_min);
+    std::copy(in, in + (clip.x_max - clip.x_min + 1),
+              WritableRow(y) + clip.x_min);
+  }
+}
+
+// Return the row |y|, after resetting it if it has been cleared since it was
+// last written.
+Pixel* Screen::WritableRow(int y) {
+  if (target_ != nullptr) {
+    // The rows were reset by Subscreen().
+    return target_->WritableRow(y);
+  }
+  Pixel* row = pixels_.data() + y * dimx_;
+  if (IsBlankRow(y)) {
+    std::fill(row, row + dimx_, Pixel());
+    row_generation_[y] = generation_;
+  }
+  if (!rows_with_spans_.empty() && !row_spans_[y].empty()) {
+    ResolveStyleSpans(y);
+  }
+  return row;
+}
+
+/// @brief Change the dimensions of the screen. Every pixels are cleared.
+void Screen::Resize(int dimx, int dimy) {
+  // The buffers keep their capacity: resizing back and forth, like while the
+  // terminal is resized, doesn't allocate. The rows are cleared lazily.
+  dimx_ = dimx;
+  dimy_ = dimy;
+  pixels_.resize(size_t(dimx) * size_t(dimy));
+  row_generation_.resize(dimy);
+  blank_row_.assign(dimx, Pixel());
+  for (const int y : rows_with_spans_) {
+    row_spans_[y].clear();
+  }
+  rows_with_spans_.clear();
+  row_spans_.resize(dimy);
+  Clear();
+  std::fill(row_generation_.begin(), row_generation_.end(), generation_ - 1);
 }
 
 /// @brief Return a string to be printed in order to reset the cursor position
@@ -488,53 +1427,300 @@ Pixel& Screen::PixelAt(int x, int y) {
 /// @return The string to print in order to reset the cursor position to the
 ///         beginning.
 std::string Screen::ResetPosition(bool clear) const {
-  std::stringstream ss;
+  std::string out = "\r";  // MOVE_LEFT;
+  if (dimy_ > 1) {
+    out += "\x1B[";  // MOVE_UP;
+    AppendInt(out, dimy_ - 1);
+    out += "A";
+  }
   if (clear) {
-    ss << "\r";       // MOVE_LEFT;
-    ss << "\x1b[2K";  // CLEAR_SCREEN;
-    for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
-      ss << "\x1B[2K";  // CLEAR_LINE;
-    }
-  } else {
-    ss << "\r";  // MOVE_LEFT;
-    for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
-    }
+    out += "\x1B[J";  // CLEAR_SCREEN_BELOW;
   }
-  return ss.str();
+  return out;
+}
+
+/// @brief The bytes of memory held by the screen: its pixels, and the buffers
+/// reused from one frame to the next. The graphemes too long to be stored in
+/// the pixels are counted by Glyph::InternedMemoryUsage() instead.
+size_t Screen::MemoryUsage() const {
+  size_t bytes = util::HeapSize(pixels_) + util::HeapSize(row_generation_) +
+                 util::HeapSize(blank_row_) + util::HeapSize(bands_) +
+                 util::HeapSize(span_styles_) + util::HeapSize(row_spans_) +
+                 util::HeapSize(rows_with_spans_) +
+                 util::HeapSize(automerge_regions_);
+  for (const std::string& band : bands_) {
+    bytes += util::HeapSize(band);
+  }
+  for (const auto& spans : row_spans_) {
+    bytes += util::HeapSize(spans);
+  }
+  return bytes;
 }
 
 /// @brief Clear all the pixel from the screen.
+/// This is O(1). The rows are only reset when they are accessed again.
 void Screen::Clear() {
-  for (auto& line : pixels_) {
-    for (auto& cell : line) {
-      cell = Pixel();
-    }
+  ++generation_;
+  if (generation_ == 0) {
+    // The counter wrapped around. Some rows might match the new generation by
+    // accident.
+    std::fill(pixels_.begin(), pixels_.end(), Pixel());
+    std::fill(row_generation_.begin(), row_generation_.end(), generation_);
   }
+  for (const int y : rows_with_spans_) {
+    row_spans_[y].clear();
+  }
+  rows_with_spans_.clear();
+  span_styles_.clear();
+  composed_first_ = -1;
+  automerge_regions_.clear();
   cursor_.x = dimx_ - 1;
   cursor_.y = dimy_ - 1;
 }
 
-// clang-format off
+/// @brief Exchange the pixels with |other|. If needed, |other| is first resized
+/// to the dimensions of this screen. This is O(1), no pixel is copied.
+///
+/// This allows double buffering. For instance, to update a terminal with the
+/// difference in between two frames:
+/// ```cpp
+/// Screen front(0, 0);
+/// Screen back = Screen::Create(Dimension::Full(), Dimension::Full());
+/// std::string reset_position;
+/// while(true) {
+///   Render(back, document());
+///   std::cout << reset_position << back.ToStringDiff(front) << std::flush;
+///   reset_position = back.ResetPosition();
+///   back.SwapPixels(front);
+///   back.Clear();
+/// }
+/// ```
+void Screen::SwapPixels(Screen& other) {
+  ResolveStyleSpans();
+  other.ResolveStyleSpans();
+  if (other.dimx_ != dimx_ || other.dimy_ != dimy_) {
+    other.Resize(dimx_, dimy_);
+  }
+  SwapBuffers(pixels_, other.pixels_);
+  SwapBuffers(row_generation_, other.row_generation_);
+  std::swap(generation_, other.generation_);
+}
+
+Screen::Screen(Screen* target, Box clip)
+    : stencil(clip),
+      dimx_(target->dimx_),
+      dimy_(target->dimy_),
+      cursor_(target->cursor_),
+      target_(target) {}
+
+/// @brief A Screen drawing into the pixels of this one, within |box|. The
+/// subscreens of disjoint boxes can be drawn into from several threads, and
+/// only support drawing. Once drawn, merge them back with MergeSubscreen().
+/// @param box the region. It is clipped by the stencil.
+Screen Screen::Subscreen(Box box) {
+  box = Box::Intersection(box, stencil);
+  box = Box::Intersection(box, {0, dimx_ - 1, 0, dimy_ - 1});
+  // Reset the cleared rows now, instead of lazily from the threads sharing
+  // them.
+  for (int y = box.y_min; y <= box.y_max && box.x_min <= box.x_max; ++y) {
+    WritableRow(y);
+  }
+  return {this, box};
+}
+
+/// @brief Merge the cursor and the automerge regions of |subscreen|. Merging
+/// the subscreens in the order they would have been drawn into this screen
+/// gives the same result.
+void Screen::MergeSubscreen(const Screen& subscreen) {
+  automerge_regions_.insert(automerge_regions_.end(),
+                            subscreen.automerge_regions_.begin(),
+                            subscreen.automerge_regions_.end());
+  if (subscreen.cursor_set_) {
+    SetCursor(subscreen.cursor_);
+  }
+}
+
+/// @brief Register a style applied by AddStyleSpan().
+/// @return Its id, valid until ApplyShader().
+int Screen::AddSpanStyle(const SpanStyle& style) {
+  span_styles_.push_back(style);
+  return int(span_styles_.size()) - 1;
+}
+
+namespace {
+
+void ApplySpanStyle(const Screen::SpanStyle& style, Pixel* begin, Pixel* end) {
+  for (Pixel* pixel = begin; pixel != end; ++pixel) {
+    pixel->blink |= style.blink;
+    pixel->bold |= style.bold;
+    pixel->dim |= style.dim;
+    pixel->inverted ^= style.inverted;
+    pixel->underlined |= style.underlined;
+    pixel->underlined_double |= style.underlined_double;
+    pixel->strikethrough |= style.strikethrough;
+    if (style.set_foreground) {
+      pixel->foreground_color = style.foreground_color;
+    }
+    if (style.set_background) {
+      pixel->background_color = style.background_color;
+    }
+  }
+}
+
+}  // namespace
+
+/// @brief Apply a style to a run of pixels of a row, like the color() or the
+/// bold decorators. The pixels are updated lazily: a decorator adds one span
+/// per row of its box, instead of visiting every pixel. The spans of a row are
+/// applied in order, before the row is accessed again, and by ApplyShader().
+/// @param y The row.
+/// @param x_min The first column.
+/// @param x_max The last column.
+/// @param style_id The style, returned by AddSpanStyle().
+void Screen::AddStyleSpan(int y, int x_min, int x_max, int style_id) {
+  x_min = std::max(x_min, stencil.x_min);
+  x_max = std::min(x_max, stencil.x_max);
+  if (y < stencil.y_min || y > stencil.y_max || x_min > x_max) {
+    return;
+  }
+
+  // A subscreen is drawn from another thread: the rows it shares with the other
+  // subscreens can't be updated lazily.
+  if (target_ != nullptr) {
+    Pixel* row = WritableRow(y);
+    ApplySpanStyle(span_styles_[style_id], row + x_min, row + x_max + 1);
+    return;
+  }
+
+  std::vector<StyleSpan>& spans = row_spans_[y];
+  if (spans.empty()) {
+    rows_with_spans_.push_back(y);
+  } else if (spans.back().x_min == x_min && spans.back().x_max == x_max) {
+    spans.back().style = ComposeSpanStyles(spans.back().style, style_id);
+    return;
+  }
+  spans.push_back({x_min, x_max, style_id});
+}
+
+/// @brief Apply |style| to every pixel of |box|, clipped by the stencil. Like
+/// AddStyleSpan(), the pixels are updated lazily, one span per row.
+void Screen::ApplyStyleRect(Box box, const SpanStyle& style) {
+  box = Box::Intersection(box, stencil);
+  if (box.x_min > box.x_max || box.y_min > box.y_max) {
+    return;
+  }
+  const int id = AddSpanStyle(style);
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    AddStyleSpan(y, box.x_min, box.x_max, id);
+  }
+}
+
+// The style applying |first|, and then |second|.
+int Screen::ComposeSpanStyles(int first, int second) {
+  if (first == composed_first_ && second == composed_second_) {
+    return composed_result_;
+  }
+  SpanStyle style = span_styles_[first];
+  const SpanStyle& next = span_styles_[second];
+  style.blink |= next.blink;
+  style.bold |= next.bold;
+  style.dim |= next.dim;
+  style.inverted ^= next.inverted;
+  style.underlined |= next.underlined;
+  style.underlined_double |= next.underlined_double;
+  style.strikethrough |= next.strikethrough;
+  if (next.set_foreground) {
+    style.set_foreground = true;
+    style.foreground_color = next.foreground_color;
+  }
+  if (next.set_background) {
+    style.set_background = true;
+    style.background_color = next.background_color;
+  }
+  composed_first_ = first;
+  composed_second_ = second;
+  composed_result_ = AddSpanStyle(style);
+  return composed_result_;
+}
+
+// Apply the pending spans of every row.
+void Screen::ResolveStyleSpans() {
+  for (const int y : rows_with_spans_) {
+    // WritableRow() resets the row if needed, and applies its spans.
+    if (!row_spans_[y].empty()) {
+      WritableRow(y);
+    }
+  }
+  rows_with_spans_.clear();
+}
+
+// Apply the pending spans of the row |y|. It must have been reset already.
+void Screen::ResolveStyleSpans(int y) {
+  std::vector<StyleSpan>& spans = row_spans_[y];
+  Pixel* row = pixels_.data() + y * dimx_;
+  for (const StyleSpan& span : spans) {
+    ApplySpanStyle(span_styles_[span.style], row + span.x_min,
+                   row + span.x_max + 1);
+  }
+  spans.clear();
+}
+
+/// @brief Declare |box| as containing pixels with `automerge` set. When some
+/// regions have been declared, ApplyShader() only processes them, instead of
+/// scanning the whole screen. Every element setting `automerge` must declare
+/// its area: its pixels aren't merged when another element declared one.
+void Screen::AddAutoMergeRegion(Box box) {
+  box = Box::Intersection(box, {0, dimx_ - 1, 0, dimy_ - 1});
+  if (box.x_min <= box.x_max && box.y_min <= box.y_max) {
+    automerge_regions_.push_back(box);
+  }
+}
+
+/// @brief Merge the box drawing characters with `automerge` set, with their
+/// neighbors.
 void Screen::ApplyShader() {
+  ResolveStyleSpans();
+  span_styles_.clear();
+  composed_first_ = -1;
+
+  // The range of columns to process for every row. The rows are processed from
+  // top to bottom, and the columns from left to right.
+  std::vector<Box> spans;
+  if (automerge_regions_.empty()) {
+    spans.assign(dimy_, {0, dimx_ - 1, 0, 0});
+  } else {
+    spans.assign(dimy_, {dimx_, -1, 0, 0});
+    for (const Box& region : automerge_regions_) {
+      for (int y = region.y_min; y <= region.y_max; ++y) {
+        spans[y].x_min = std::min(spans[y].x_min, region.x_min);
+        spans[y].x_max = std::max(spans[y].x_max, region.x_max);
+      }
+    }
+    automerge_regions_.clear();
+  }
+
   // Merge box characters togethers.
   for (int y = 0; y < dimy_; ++y) {
-    for (int x = 0; x < dimx_; ++x) {
+    // Nothing has been drawn on the cleared rows.
+    if (IsBlankRow(y)) {
+      continue;
+    }
+    const bool top_is_blank = y == 0 || IsBlankRow(y - 1);
+    for (int x = spans[y].x_min; x <= spans[y].x_max; ++x) {
       // Box drawing character uses exactly 3 byte.
-      Pixel& cur = pixels_[y][x];
+      Pixel& cur = pixels_[y * dimx_ + x];
       if (!ShouldAttemptAutoMerge(cur)) {
         continue;
       }
 
       if (x > 0) {
-        Pixel& left = pixels_[y][x-1];
+        Pixel& left = pixels_[y * dimx_ + x - 1];
         if (ShouldAttemptAutoMerge(left)) {
           UpgradeLeftRight(left.character, cur.character);
         }
       }
-      if (y > 0) {
-        Pixel& top = pixels_[y-1][x];
+      if (!top_is_blank) {
+        Pixel& top = pixels_[(y - 1) * dimx_ + x];
         if (ShouldAttemptAutoMerge(top)) {
           UpgradeTopDown(top.character, cur.character);
         }
@@ -543,7 +1729,6 @@ void Screen::ApplyShader() {
   }
 }
 
-// clang-format on
 
 }  // namespace ftxui
 
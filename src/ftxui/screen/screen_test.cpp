@@ -0,0 +1,511 @@
+#include <gtest/gtest.h>
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t
+#include <cstdio>      // for FILE, tmpfile, fileno, fread, fclose
+#include <functional>  // for function
+#include <string>   // for allocator, string
+#include <string_view>  // for string_view
+#include <utility>  // for as_const, swap
+#include <vector>   // for vector
+
+#include "ftxui/screen/color.hpp"  // for Color
+#include "ftxui/screen/glyph.hpp"  // for Glyph
+#include "ftxui/screen/screen.hpp"
+#include "ftxui/screen/terminal.hpp"  // for ColorSupport, SetColorSupport
+
+namespace ftxui {
+
+TEST(ScreenTest, Row) {
+  Screen screen(3, 2);
+  screen.at(1, 1) = "a";
+  const auto row = screen.Row(1);
+  ASSERT_EQ(row.size(), 3u);
+  EXPECT_EQ(row[1].character, "a");
+  EXPECT_EQ(&row[0], &screen.PixelAt(0, 1));
+  EXPECT_EQ(&row[2], &screen.PixelAt(2, 1));
+}
+
+TEST(ScreenTest, MemoryUsage) {
+  Screen screen(10, 5);
+  const size_t bytes = screen.MemoryUsage();
+  EXPECT_GE(bytes, 10 * 5 * sizeof(Pixel));
+
+  Screen larger(20, 5);
+  EXPECT_GE(larger.MemoryUsage(), bytes + 10 * 5 * sizeof(Pixel));
+
+  // The long graphemes are held by the intern table, not by the screen.
+  screen.PixelAt(0, 0).character = "👨‍👩‍👧‍👦";
+  EXPECT_EQ(screen.MemoryUsage(), bytes);
+}
+
+TEST(ScreenTest, InternedMemoryUsage) {
+  // The intern table is shared by the whole program, and never shrinks. This
+  // grapheme, too long to be stored inline, is used by no other test.
+  const size_t interned = Glyph::InternedMemoryUsage();
+  Screen screen(2, 1);
+  screen.PixelAt(0, 0).character = "🧑🏿‍🤝‍🧑🏻";
+  const size_t once = Glyph::InternedMemoryUsage();
+  EXPECT_GT(once, interned);
+
+  // The long graphemes are interned once.
+  screen.PixelAt(1, 0).character = "🧑🏿‍🤝‍🧑🏻";
+  EXPECT_EQ(Glyph::InternedMemoryUsage(), once);
+}
+
+TEST(ScreenTest, Clear) {
+  Screen screen(2, 2);
+  screen.at(0, 0) = "a";
+  screen.at(1, 1) = "b";
+  screen.PixelAt(1, 1).bold = true;
+  screen.Clear();
+
+  // The cleared rows read as blank.
+  const Screen& const_screen = screen;
+  EXPECT_EQ(const_screen.Row(0)[0].character, " ");
+  EXPECT_FALSE(const_screen.Row(1)[1].bold);
+  EXPECT_EQ(screen.ToString(), "  \r\n  ");
+
+  // Writing a pixel resets the rest of its row.
+  screen.at(0, 1) = "c";
+  EXPECT_EQ(screen.PixelAt(1, 1).character, " ");
+  EXPECT_FALSE(screen.PixelAt(1, 1).bold);
+  EXPECT_EQ(screen.ToString(), "  \r\nc ");
+}
+
+TEST(ScreenTest, SwapPixels) {
+  Screen back(2, 1);
+  Screen front(0, 0);
+  back.at(0, 0) = "a";
+  back.SwapPixels(front);
+  back.Clear();
+  EXPECT_EQ(front.dimx(), 2);
+  EXPECT_EQ(front.dimy(), 1);
+  EXPECT_EQ(front.ToString(), "a ");
+  EXPECT_EQ(back.ToString(), "  ");
+
+  back.at(1, 0) = "b";
+  EXPECT_EQ(back.ToStringDiff(front), " b\x1B[3G");
+  back.SwapPixels(front);
+  back.Clear();
+  EXPECT_EQ(front.ToString(), " b");
+  EXPECT_EQ(back.ToString(), "  ");
+}
+
+TEST(ScreenTest, Subscreen) {
+  Screen screen(4, 2);
+  screen.at(3, 1) = "x";
+  screen.Clear();
+
+  Screen left = screen.Subscreen({0, 1, 0, 1});
+  Screen right = screen.Subscreen({2, 5, 0, 1});
+  EXPECT_EQ(right.stencil, (Box{2, 3, 0, 1}));
+  left.at(0, 0) = "a";
+  left.at(2, 0) = "-";  // Outside of the subscreen.
+  right.at(2, 1) = "b";
+  right.SetCursor({3, 1, Screen::Cursor::Bar});
+
+  screen.MergeSubscreen(left);
+  screen.MergeSubscreen(right);
+  EXPECT_EQ(screen.ToString(), "a   \r\n  b ");
+  EXPECT_EQ(screen.cursor().x, 3);
+  EXPECT_EQ(screen.cursor().shape, Screen::Cursor::Bar);
+}
+
+TEST(ScreenTest, ParallelOutput) {
+  Screen screen(30, 100);
+  for (int y = 0; y < 100; ++y) {
+    for (int x = 0; x < 30; x += 3) {
+      screen.at(x, y) = std::string(1, char('a' + (x + y) % 26));
+      screen.PixelAt(x, y).bold = (x + y) % 7 == 0;
+      screen.PixelAt(x, y).foreground_color = Color::Palette256((x * y) % 256);
+    }
+    // A style running across the end of the row.
+    screen.PixelAt(29, y).inverted = true;
+  }
+
+  for (const bool run_length : {false, true}) {
+    screen.SetRunLengthOutput(run_length, run_length);
+    screen.SetParallelOutput(nullptr);
+    const std::string serial = screen.ToString();
+
+    // The bands are independent: encode them in the reverse order.
+    int calls = 0;
+    screen.SetParallelOutput(
+        [&](size_t count, const std::function<void(size_t)>& task) {
+          calls++;
+          for (size_t i = count; i > 0; --i) {
+            task(i - 1);
+          }
+        },
+        /*min_cells=*/1000);
+    EXPECT_EQ(screen.ToString(), serial);
+    EXPECT_EQ(calls, 1);
+  }
+}
+
+TEST(ScreenTest, ToStringReuseBuffer) {
+  Screen screen(2, 2);
+  screen.at(0, 0) = "a";
+  std::string out = "previous content";
+  screen.ToString(out);
+  EXPECT_EQ(out, "a \r\n  ");
+  EXPECT_EQ(out, screen.ToString());
+}
+
+TEST(ScreenTest, ApplyShader) {
+  Screen screen(2, 1);
+  screen.at(0, 0) = "│";
+  screen.at(1, 0) = "─";
+  screen.PixelAt(0, 0).automerge = true;
+  screen.PixelAt(1, 0).automerge = true;
+  screen.ApplyShader();
+  EXPECT_EQ(screen.ToString(), "├─");
+}
+
+TEST(ScreenTest, ApplyShaderAutoMergeRegion) {
+  Screen screen(2, 2);
+  for (int y = 0; y < 2; ++y) {
+    screen.at(0, y) = "│";
+    screen.at(1, y) = "─";
+    screen.PixelAt(0, y).automerge = true;
+    screen.PixelAt(1, y).automerge = true;
+  }
+  // Only the first line is declared.
+  screen.AddAutoMergeRegion({0, 1, 0, 0});
+  screen.ApplyShader();
+  EXPECT_EQ(screen.ToString(), "├─\r\n│─");
+}
+
+TEST(ScreenTest, ResetPosition) {
+  EXPECT_EQ(Screen(4, 1).ResetPosition(), "\r");
+  EXPECT_EQ(Screen(4, 1).ResetPosition(/*clear=*/true), "\r\x1B[J");
+  EXPECT_EQ(Screen(4, 100).ResetPosition(), "\r\x1B[99A");
+  EXPECT_EQ(Screen(4, 100).ResetPosition(/*clear=*/true), "\r\x1B[99A\x1B[J");
+}
+
+TEST(ScreenTest, StyleMergedSequence) {
+  Screen screen(2, 1);
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(0, 0).underlined = true;
+  screen.PixelAt(0, 0).foreground_color = Color::Red;
+  EXPECT_EQ(screen.ToString(), "\x1B[1;4;31m \x1B[0m ");
+}
+
+TEST(ScreenTest, StyleIncrementalTransition) {
+  Screen screen(3, 1);
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(1, 0).bold = true;
+  screen.PixelAt(1, 0).inverted = true;
+  screen.PixelAt(2, 0).inverted = true;
+  EXPECT_EQ(screen.ToString(), "\x1B[1m \x1B[7m \x1B[22m \x1B[0m");
+}
+
+TEST(ScreenTest, StyleResetTransition) {
+  Screen screen(2, 1);
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(0, 0).blink = true;
+  screen.PixelAt(0, 0).inverted = true;
+  screen.PixelAt(1, 0).inverted = true;
+  EXPECT_EQ(screen.ToString(), "\x1B[1;5;7m \x1B[0;7m \x1B[0m");
+}
+
+// The transitions between the styles are cached. The ones from a glyph-only
+// change, and the repeated ones, are the same as the first.
+TEST(ScreenTest, StyleRepeatedTransition) {
+  Screen screen(6, 1);
+  for (int x : {0, 2, 4}) {
+    screen.PixelAt(x, 0).foreground_color = Color::Red;
+    screen.PixelAt(x + 1, 0).background_color = Color::Blue;
+  }
+  screen.PixelAt(3, 0).character = "a";
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[31m \x1B[0;44m \x1B[0;31m \x1B[0;44ma\x1B[0;31m "
+            "\x1B[0;44m \x1B[0m");
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[31m \x1B[0;44m \x1B[0;31m \x1B[0;44ma\x1B[0;31m "
+            "\x1B[0;44m \x1B[0m");
+}
+
+TEST(ScreenTest, ToPlainText) {
+  Screen screen(6, 3);
+  screen.PixelAt(0, 0).character = "a";
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(2, 0).character = "b";
+  screen.PixelAt(4, 0).background_color = Color::Red;
+  screen.PixelAt(0, 2).character = "测";
+  screen.PixelAt(1, 2).character = "";
+  screen.PixelAt(2, 2).character = "c";
+  EXPECT_EQ(screen.ToPlainText(), "a b\n\n测c");
+
+  // The buffer is reused.
+  std::string out = "previous";
+  screen.ToPlainText(out);
+  EXPECT_EQ(out, "a b\n\n测c");
+}
+
+TEST(ScreenTest, NoColorSupport) {
+  const Terminal::Color color_support = Terminal::ColorSupport();
+  Terminal::SetColorSupport(Terminal::Color::Palette1);
+  Screen screen(3, 1);
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(1, 0).character = "a";
+  screen.PixelAt(1, 0).foreground_color = Color::Red;
+  EXPECT_EQ(screen.ToString(), " a ");
+  Terminal::SetColorSupport(color_support);
+}
+
+TEST(ScreenTest, NoColor) {
+  Terminal::SetNoColor(true);
+  Screen screen(3, 1);
+  screen.PixelAt(0, 0).inverted = true;
+  screen.PixelAt(0, 0).foreground_color = Color::Red;
+  screen.PixelAt(1, 0).background_color = Color::Blue;
+  screen.PixelAt(2, 0).inverted = true;
+  EXPECT_EQ(screen.ToString(), "\x1B[7m \x1B[0m \x1B[7m \x1B[0m");
+  Terminal::SetNoColor(false);
+}
+
+TEST(ScreenTest, EraseLine) {
+  Screen screen(10, 2);
+  screen.at(0, 0) = "a";
+  screen.at(0, 1) = "b";
+  screen.SetRunLengthOutput(/*erase_line=*/true, /*repeat=*/false);
+  EXPECT_EQ(screen.ToString(), "a\x1B[K\r\nb\x1B[K\x1B[9C");
+
+  // Too few blanks to be worth erasing.
+  screen.at(7, 0) = "c";
+  EXPECT_EQ(screen.ToString(), "a      c  \r\nb\x1B[K\x1B[9C");
+}
+
+TEST(ScreenTest, Repeat) {
+  Screen screen(12, 1);
+  for (int x = 0; x < 12; ++x) {
+    screen.at(x, 0) = "─";
+  }
+  screen.at(0, 0) = "a";
+  screen.at(1, 0) = "a";
+  screen.SetRunLengthOutput(/*erase_line=*/false, /*repeat=*/true);
+  EXPECT_EQ(screen.ToString(), "aa─\x1B[9b");
+
+  // The style delimits the runs.
+  screen.PixelAt(11, 0).bold = true;
+  EXPECT_EQ(screen.ToString(), "aa─\x1B[8b\x1B[1m─\x1B[0m");
+}
+
+TEST(ScreenTest, RowHash) {
+  Screen screen(3, 3);
+  screen.at(0, 1) = "a";
+  screen.at(0, 2) = "a";
+  screen.PixelAt(0, 2).bold = true;
+  EXPECT_NE(screen.RowHash(0), screen.RowHash(1));
+  EXPECT_NE(screen.RowHash(1), screen.RowHash(2));
+  EXPECT_EQ(screen.RowHash(0), Screen(3, 1).RowHash(0));
+}
+
+TEST(ScreenTest, ToStringRowDiff) {
+  std::vector<uint64_t> previous_hashes;
+  std::vector<uint64_t> hashes;
+  std::string out;
+
+  Screen screen(2, 3);
+  screen.ToStringRowDiff(previous_hashes, hashes, out);
+  EXPECT_EQ(out, screen.ToString());
+  ASSERT_EQ(hashes.size(), 3u);
+
+  std::swap(previous_hashes, hashes);
+  screen.at(1, 1) = "a";
+  screen.ToStringRowDiff(previous_hashes, hashes, out);
+  EXPECT_EQ(out, "\n\r a\n\x1B[3G");
+
+  std::swap(previous_hashes, hashes);
+  screen.ToStringRowDiff(previous_hashes, hashes, out);
+  EXPECT_EQ(out, "\n\n\x1B[3G");
+}
+
+TEST(ScreenTest, ToStringScrollDiffUp) {
+  Screen previous(2, 4);
+  Screen next(2, 4);
+  for (int y = 0; y < 4; ++y) {
+    previous.at(0, y) = std::string(1, char('a' + y));
+    next.at(0, y) = std::string(1, char('b' + y));
+  }
+  std::string out;
+  next.ToStringScrollDiff(previous, 0, out);
+  EXPECT_EQ(out,
+            "\x1B" "7\x1B[1;4r\x1B[1S\x1B[r\x1B" "8"  // Scroll.
+            "\x1B[3Be\x1B[C");                    // Exposed row.
+}
+
+TEST(ScreenTest, ToStringScrollDiffDown) {
+  Screen previous(2, 4);
+  Screen next(2, 4);
+  for (int y = 0; y < 4; ++y) {
+    previous.at(0, y) = std::string(1, char('a' + y));
+  }
+  next.at(0, 0) = "z";
+  for (int y = 1; y < 4; ++y) {
+    next.at(0, y) = std::string(1, char('a' + y - 1));
+  }
+  std::string out;
+  next.ToStringScrollDiff(previous, 5, out);
+  EXPECT_EQ(out,
+            "\x1B" "7\x1B[6;9r\x1B[1T\x1B[r\x1B" "8"  // Scroll.
+            "z\x1B[9;3H");                         // Exposed row.
+}
+
+TEST(ScreenTest, ToStringScrollDiffNoShift) {
+  Screen previous(4, 2);
+  Screen next(4, 2);
+  next.at(2, 1) = "a";
+  std::string out;
+  next.ToStringScrollDiff(previous, 0, out);
+  EXPECT_EQ(out, next.ToStringDiff(previous));
+}
+
+TEST(ScreenTest, ToStringDiffIdentical) {
+  Screen previous(4, 2);
+  Screen next(4, 2);
+  EXPECT_EQ(next.ToStringDiff(previous), "\n\x1B[5G");
+}
+
+TEST(ScreenTest, ToStringDiffSingleCell) {
+  Screen previous(4, 2);
+  Screen next(4, 2);
+  next.at(2, 1) = "a";
+  EXPECT_EQ(next.ToStringDiff(previous), "\n\x1B[3Ga\x1B[C");
+}
+
+TEST(ScreenTest, ToStringDiffMergeSmallGaps) {
+  Screen previous(8, 1);
+  Screen next(8, 1);
+  next.at(0, 0) = "a";
+  next.at(2, 0) = "b";
+  EXPECT_EQ(next.ToStringDiff(previous), "a b\x1B[5C");
+}
+
+TEST(ScreenTest, ToStringDiffFullWidth) {
+  Screen previous(4, 1);
+  previous.at(0, 0) = "测";
+  previous.at(1, 0) = "";
+  Screen next(4, 1);
+  next.at(0, 0) = "测";
+  next.at(1, 0) = "";
+  next.PixelAt(1, 0).bold = true;
+  // The modified cell is the second half of "测". It is redrawn from its
+  // beginning.
+  EXPECT_EQ(next.ToStringDiff(previous), "测\x1B[2C");
+}
+
+TEST(ScreenTest, ToStringDiffResized) {
+  Screen previous(2, 1);
+  Screen next(3, 1);
+  EXPECT_EQ(next.ToStringDiff(previous), next.ToString());
+}
+
+TEST(ScreenTest, StyleSpans) {
+  Screen screen(4, 2);
+  Screen::SpanStyle red;
+  red.set_foreground = true;
+  red.foreground_color = Color::Red;
+  Screen::SpanStyle bold;
+  bold.bold = true;
+  bold.inverted = true;
+
+  const int red_id = screen.AddSpanStyle(red);
+  const int bold_id = screen.AddSpanStyle(bold);
+  screen.AddStyleSpan(0, 1, 10, red_id);  // Clipped.
+  screen.AddStyleSpan(0, 1, 10, bold_id);  // Merged.
+  screen.AddStyleSpan(1, 0, 1, bold_id);
+  screen.AddStyleSpan(5, 0, 1, bold_id);  // Outside.
+
+  // Writing a row applies its spans first.
+  screen.PixelAt(2, 0).foreground_color = Color::Blue;
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color, Color::Red);
+  EXPECT_TRUE(screen.PixelAt(1, 0).bold);
+  EXPECT_EQ(screen.PixelAt(2, 0).foreground_color, Color::Blue);
+  EXPECT_FALSE(screen.PixelAt(0, 0).bold);
+
+  // The spans are applied in order.
+  screen.AddStyleSpan(1, 1, 1, bold_id);
+  screen.ApplyShader();
+  const auto row = std::as_const(screen).Row(1);
+  EXPECT_TRUE(row[0].inverted);
+  EXPECT_FALSE(row[1].inverted);
+  EXPECT_TRUE(row[1].bold);
+  EXPECT_FALSE(row[2].bold);
+
+  // Clear() drops the spans not applied yet.
+  screen.AddStyleSpan(0, 0, 3, screen.AddSpanStyle(bold));
+  screen.Clear();
+  EXPECT_FALSE(screen.PixelAt(0, 0).bold);
+}
+
+TEST(ScreenTest, Rects) {
+  Screen screen(4, 3);
+  screen.stencil = {0, 2, 0, 2};
+
+  Pixel pixel;
+  pixel.character = "x";
+  screen.FillRect({1, 5, 1, 1}, pixel);  // Clipped by the stencil.
+  EXPECT_EQ(screen.ToString(), "    \r\n xx \r\n    ");
+
+  std::vector<Pixel> tile(4);
+  tile[0].character = "a";
+  tile[1].character = "b";
+  tile[2].character = "c";
+  tile[3].character = "d";
+  screen.BlitRect({-1, 0, 1, 2}, tile);  // The left column is clipped.
+  EXPECT_EQ(screen.ToString(), "    \r\nbxx \r\nd   ");
+
+  Screen::SpanStyle bold;
+  bold.bold = true;
+  screen.ApplyStyleRect({2, 3, 0, 5}, bold);
+  screen.ApplyShader();
+  EXPECT_TRUE(screen.PixelAt(2, 2).bold);
+  EXPECT_FALSE(screen.PixelAt(1, 2).bold);
+  screen.stencil = {0, 3, 0, 2};
+  EXPECT_FALSE(screen.PixelAt(3, 0).bold);
+}
+
+TEST(ScreenTest, PrintStreamed) {
+  Screen screen(30, 50);
+  for (int y = 0; y < screen.dimy(); ++y) {
+    screen.PixelAt(y % 30, y).character = "x";
+    screen.PixelAt(y % 30, y).bold = y % 2;
+    screen.PixelAt(0, y).foreground_color = Color::Red;
+  }
+  const std::string expected = screen.ToString();
+
+  std::string streamed;
+  int chunks = 0;
+  screen.Print(
+      [&](std::string_view chunk) {
+        streamed += chunk;
+        chunks++;
+      },
+      100);
+  EXPECT_EQ(streamed, expected);
+  EXPECT_GT(chunks, 10);
+}
+
+TEST(ScreenTest, PrintToFile) {
+  Screen screen(4, 2);
+  screen.at(1, 1) = "a";
+  const std::string expected = screen.ToString();
+
+  std::FILE* file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  screen.Print(file);
+  screen.Print(fileno(file));
+  std::rewind(file);
+  std::string content(2 * expected.size() + 1, ' ');
+  content.resize(std::fread(content.data(), 1, content.size(), file));
+  std::fclose(file);
+  EXPECT_EQ(content, expected + expected);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
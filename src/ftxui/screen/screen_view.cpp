@@ -0,0 +1,92 @@
+#include "ftxui/screen/screen_view.hpp"
+
+#include <cstddef>  // for size_t
+#include <span>     // for span
+
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Pixel, Screen
+
+namespace ftxui {
+
+namespace {
+
+Pixel& dev_null_pixel() {
+  thread_local Pixel pixel;
+  return pixel;
+}
+
+Box Translate(Box box, int x, int y) {
+  box.x_min += x;
+  box.x_max += x;
+  box.y_min += y;
+  box.y_max += y;
+  return box;
+}
+
+}  // namespace
+
+ScreenView::ScreenView(Screen& screen)
+    : ScreenView(screen, Box{0, screen.dimx() - 1, 0, screen.dimy() - 1}) {}
+
+ScreenView::ScreenView(Screen& screen, Box box)
+    : ScreenView(&screen,
+                 box.x_min,
+                 box.y_min,
+                 box.x_max - box.x_min + 1,
+                 box.y_max - box.y_min + 1,
+                 Translate(Box::Intersection(
+                               box, Box::Intersection(
+                                        screen.stencil,
+                                        Box{0, screen.dimx() - 1, 0,
+                                            screen.dimy() - 1})),
+                           -box.x_min, -box.y_min)) {}
+
+ScreenView::ScreenView(Screen* screen,
+                       int origin_x,
+                       int origin_y,
+                       int dimx,
+                       int dimy,
+                       Box clip)
+    : screen_(screen),
+      origin_x_(origin_x),
+      origin_y_(origin_y),
+      dimx_(dimx),
+      dimy_(dimy),
+      clip_(clip) {}
+
+/// @brief Narrow the view to |box|, expressed in the coordinates of this view.
+/// The result is clipped by this view.
+ScreenView ScreenView::View(Box box) const {
+  return {screen_,
+          origin_x_ + box.x_min,
+          origin_y_ + box.y_min,
+          box.x_max - box.x_min + 1,
+          box.y_max - box.y_min + 1,
+          Translate(Box::Intersection(box, clip_), -box.x_min, -box.y_min)};
+}
+
+/// @brief Access a pixel, in local coordinates.
+/// @return The pixel, or a dummy one when it isn't visible.
+Pixel& ScreenView::PixelAt(int x, int y) {
+  if (!clip_.Contain(x, y)) {
+    return dev_null_pixel();
+  }
+  return screen_->Row(origin_y_ + y)[origin_x_ + x];
+}
+
+/// @brief Access the visible pixels of a line, in local coordinates. They are
+/// stored contiguously, from clip().x_min to clip().x_max.
+std::span<Pixel> ScreenView::Row(int y) {
+  if (y < clip_.y_min || y > clip_.y_max || clip_.x_min > clip_.x_max) {
+    return {};
+  }
+  return screen_->Row(origin_y_ + y)
+      .subspan(static_cast<size_t>(origin_x_ + clip_.x_min),
+               static_cast<size_t>(clip_.x_max - clip_.x_min + 1));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator
+
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for Screen, Pixel
+#include "ftxui/screen/screen_view.hpp"  // for ScreenView
+
+namespace ftxui {
+
+TEST(ScreenViewTest, Basic) {
+  Screen screen(4, 3);
+  ScreenView view(screen, Box{1, 2, 1, 2});
+  EXPECT_EQ(view.dimx(), 2);
+  EXPECT_EQ(view.dimy(), 2);
+  EXPECT_EQ(view.clip(), (Box{0, 1, 0, 1}));
+  view.PixelAt(0, 0).character = "a";
+  view.PixelAt(1, 1).character = "b";
+  view.PixelAt(2, 0).character = "x";   // Outside: discarded.
+  view.PixelAt(-1, 0).character = "x";  // Outside: discarded.
+  EXPECT_EQ(screen.ToString(),
+            "    \r\n"
+            " a  \r\n"
+            "  b ");
+}
+
+TEST(ScreenViewTest, Clip) {
+  Screen screen(4, 2);
+  screen.stencil = Box{0, 2, 0, 1};
+  ScreenView view(screen, Box{2, 5, 0, 0});
+  EXPECT_EQ(view.dimx(), 4);
+  EXPECT_EQ(view.clip(), (Box{0, 0, 0, 0}));
+  EXPECT_TRUE(view.Visible(0, 0));
+  EXPECT_FALSE(view.Visible(1, 0));
+
+  EXPECT_EQ(view.Row(0).size(), 1u);
+  EXPECT_TRUE(view.Row(1).empty());
+  view.Row(0)[0].character = "a";
+  EXPECT_EQ(screen.PixelAt(2, 0).character, "a");
+}
+
+TEST(ScreenViewTest, Nested) {
+  Screen screen(5, 1);
+  ScreenView outer(screen, Box{1, 3, 0, 0});
+  ScreenView inner = outer.View(Box{1, 4, 0, 0});
+  EXPECT_EQ(inner.origin_x(), 2);
+  EXPECT_EQ(inner.dimx(), 4);
+  // Clipped by the outer view.
+  EXPECT_EQ(inner.clip(), (Box{0, 1, 0, 0}));
+  for (int x = 0; x < inner.dimx(); ++x) {
+    inner.PixelAt(x, 0).character = "x";
+  }
+  EXPECT_EQ(screen.ToString(), "  xx ");
+}
+
+TEST(ScreenViewTest, Empty) {
+  Screen screen(2, 2);
+  ScreenView view(screen, Box{3, 4, 0, 1});
+  EXPECT_TRUE(view.Row(0).empty());
+  view.PixelAt(0, 0).character = "x";
+  EXPECT_EQ(screen.ToString(), "  \r\n  ");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -7,13 +7,24 @@
 
 #include "ftxui/screen/string.hpp"
 
-#include <array>    // for array
-#include <cstdint>  // for uint32_t, uint8_t, uint16_t, int32_t
-#include <string>   // for string, basic_string, wstring
-#include <tuple>    // for _Swallow_assign, ignore
+#include <array>          // for array
+#include <bit>            // for popcount, countr_zero
+#include <cstdint>        // for uint32_t, uint8_t, uint16_t, int32_t
+#include <cstring>        // for memcpy
+#include <span>           // for span
+#include <string>         // for string, basic_string, wstring
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
 
 #include "ftxui/screen/deprecated.hpp"  // for wchar_width, wstring_width
 
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>  // for _mm_loadu_si128, _mm_movemask_epi8
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>  // for vld1q_u8, vmaxvq_u8, vcltq_u8, vaddvq_u8
+#endif
+
 namespace {
 
 struct Interval {
@@ -178,6 +189,47 @@ const std::array<Interval, 116> g_full_width_characters = {{
     {0x20000, 0x2fffd}, {0x30000, 0x3fffd},
 }};
 
+// Sorted list of the intervals of Extended_Pictographic characters, from:
+// https://www.unicode.org/Public/UCD/latest/ucd/emoji/emoji-data.txt
+const std::array<Interval, 78> g_extended_pictographic = {{
+    {0x000a9, 0x000a9}, {0x000ae, 0x000ae}, {0x0203c, 0x0203c},
+    {0x02049, 0x02049}, {0x02122, 0x02122}, {0x02139, 0x02139},
+    {0x02194, 0x02199}, {0x021a9, 0x021aa}, {0x0231a, 0x0231b},
+    {0x02328, 0x02328}, {0x02388, 0x02388}, {0x023cf, 0x023cf},
+    {0x023e9, 0x023f3}, {0x023f8, 0x023fa}, {0x024c2, 0x024c2},
+    {0x025aa, 0x025ab}, {0x025b6, 0x025b6}, {0x025c0, 0x025c0},
+    {0x025fb, 0x025fe}, {0x02600, 0x02605}, {0x02607, 0x02612},
+    {0x02614, 0x02685}, {0x02690, 0x02705}, {0x02708, 0x02712},
+    {0x02714, 0x02714}, {0x02716, 0x02716}, {0x0271d, 0x0271d},
+    {0x02721, 0x02721}, {0x02728, 0x02728}, {0x02733, 0x02734},
+    {0x02744, 0x02744}, {0x02747, 0x02747}, {0x0274c, 0x0274c},
+    {0x0274e, 0x0274e}, {0x02753, 0x02755}, {0x02757, 0x02757},
+    {0x02763, 0x02767}, {0x02795, 0x02797}, {0x027a1, 0x027a1},
+    {0x027b0, 0x027b0}, {0x027bf, 0x027bf}, {0x02934, 0x02935},
+    {0x02b05, 0x02b07}, {0x02b1b, 0x02b1c}, {0x02b50, 0x02b50},
+    {0x02b55, 0x02b55}, {0x03030, 0x03030}, {0x0303d, 0x0303d},
+    {0x03297, 0x03297}, {0x03299, 0x03299}, {0x1f000, 0x1f0ff},
+    {0x1f10d, 0x1f10f}, {0x1f12f, 0x1f12f}, {0x1f16c, 0x1f171},
+    {0x1f17e, 0x1f17f}, {0x1f18e, 0x1f18e}, {0x1f191, 0x1f19a},
+    {0x1f1ad, 0x1f1e5}, {0x1f201, 0x1f20f}, {0x1f21a, 0x1f21a},
+    {0x1f22f, 0x1f22f}, {0x1f232, 0x1f23a}, {0x1f23c, 0x1f23f},
+    {0x1f249, 0x1f3fa}, {0x1f400, 0x1f53d}, {0x1f546, 0x1f64f},
+    {0x1f680, 0x1f6ff}, {0x1f774, 0x1f77f}, {0x1f7d5, 0x1f7ff},
+    {0x1f80c, 0x1f80f}, {0x1f848, 0x1f84f}, {0x1f85a, 0x1f85f},
+    {0x1f888, 0x1f88f}, {0x1f8ae, 0x1f8ff}, {0x1f90c, 0x1f93a},
+    {0x1f93c, 0x1f945}, {0x1f947, 0x1faff}, {0x1fc00, 0x1fffd},
+}};
+
+// The Prepend characters of the grapheme cluster break property, from:
+// https://www.unicode.org/Public/UCD/latest/ucd/auxiliary/GraphemeBreakProperty.txt
+const std::array<Interval, 14> g_prepend_characters = {{
+    {0x00600, 0x00605}, {0x006dd, 0x006dd}, {0x0070f, 0x0070f},
+    {0x00890, 0x00891}, {0x008e2, 0x008e2}, {0x00d4e, 0x00d4e},
+    {0x110bd, 0x110bd}, {0x110cd, 0x110cd}, {0x111c2, 0x111c3},
+    {0x1193f, 0x1193f}, {0x11941, 0x11941}, {0x11a3a, 0x11a3a},
+    {0x11a84, 0x11a89}, {0x11d46, 0x11d46},
+}};
+
 using WBP = ftxui::WordBreakProperty;
 struct WordBreakPropertyInterval {
   uint32_t first;
@@ -1478,62 +1530,89 @@ const std::array<WordBreakPropertyInterval, 1288> g_word_break_intervals = {{
     {0xE0100, 0xE01EF, WBP::Extend},
 }};
 
-// Find a codepoint inside a sorted list of Interval.
-template <size_t N>
-bool Bisearch(uint32_t ucs, const std::array<Interval, N> table) {
-  if (ucs < table.front().first || ucs > table.back().last) {  // NOLINT
-    return false;
-  }
-
-  int min = 0;
-  int max = N - 1;
-  while (max >= min) {
-    const int mid = (min + max) / 2;
-    if (ucs > table[mid].last) {  // NOLINT
-      min = mid + 1;
-    } else if (ucs < table[mid].first) {  // NOLINT
-      max = mid - 1;
-    } else {
-      return true;
+// The properties of every codepoint, packed into a byte, and stored in a
+// two-stage lookup table: the codepoints are split into pages of |kLeafSize|,
+// and the identical pages share the same leaf.
+constexpr uint32_t kCodepointCount = 0x110000;
+constexpr uint32_t kLeafBits = 7;
+constexpr uint32_t kLeafSize = 1U << kLeafBits;
+constexpr uint8_t kWordBreakMask = 0b0001'1111;
+constexpr uint8_t kCombining = 0b0010'0000;
+constexpr uint8_t kFullWidth = 0b0100'0000;
+constexpr uint8_t kExtendedPictographic = 0b1000'0000;
+
+class CodepointTable {
+ public:
+  CodepointTable() {
+    // Expand the interval tables. Unlisted codepoints are ALetter.
+    static_assert(uint8_t(WBP::ALetter) == 0);
+    std::vector<uint8_t> properties(kCodepointCount, 0);
+    for (const auto& interval : g_word_break_intervals) {
+      for (uint32_t c = interval.first; c <= interval.last; ++c) {
+        properties[c] = uint8_t(interval.property);
+      }
+    }
+    for (const auto& interval : g_combining_characters) {
+      for (uint32_t c = interval.first; c <= interval.last; ++c) {
+        properties[c] |= kCombining;
+      }
+    }
+    for (const auto& interval : g_full_width_characters) {
+      for (uint32_t c = interval.first; c <= interval.last; ++c) {
+        properties[c] |= kFullWidth;
+      }
+    }
+    for (const auto& interval : g_extended_pictographic) {
+      for (uint32_t c = interval.first; c <= interval.last; ++c) {
+        properties[c] |= kExtendedPictographic;
+      }
     }
-  }
-
-  return false;
-}
 
-// Find a value inside a sorted list of Interval + property.
-template <class C, size_t N>
-bool Bisearch(uint32_t ucs, const std::array<C, N> table, C* out) {
-  if (ucs < table.front().first || ucs > table.back().last) {  // NOLINT
-    return false;
+    // Share the identical pages.
+    std::unordered_map<std::string_view, uint16_t> leaf_index;
+    pages_.reserve(kCodepointCount / kLeafSize);
+    for (uint32_t page = 0; page < kCodepointCount; page += kLeafSize) {
+      const std::string_view leaf(
+          reinterpret_cast<const char*>(properties.data() + page),  // NOLINT
+          kLeafSize);
+      auto [it, inserted] =
+          leaf_index.try_emplace(leaf, uint16_t(leaf_index.size()));
+      if (inserted) {
+        leaves_.insert(leaves_.end(), leaf.begin(), leaf.end());
+      }
+      pages_.push_back(it->second);
+    }
   }
 
-  int min = 0;
-  int max = N - 1;
-  while (max >= min) {
-    const int mid = (min + max) / 2;
-    if (ucs > table[mid].last) {  // NOLINT
-      min = mid + 1;
-    } else if (ucs < table[mid].first) {  // NOLINT
-      max = mid - 1;
-    } else {
-      *out = table[mid];  // NOLINT
-      return true;
+  uint8_t Get(uint32_t ucs) const {
+    if (ucs >= kCodepointCount) {
+      return 0;
     }
+    return leaves_[size_t(pages_[ucs >> kLeafBits]) << kLeafBits |  // NOLINT
+                   (ucs & (kLeafSize - 1))];                        // NOLINT
   }
 
-  return false;
+ private:
+  std::vector<uint16_t> pages_;
+  std::vector<uint8_t> leaves_;
+};
+
+// The table is built once, on first use, from the interval tables above.
+uint8_t CodepointProperties(uint32_t ucs) {
+  static const CodepointTable table;
+  return table.Get(ucs);
 }
 
 bool IsCombining(uint32_t ucs) {
-  return Bisearch(ucs, g_combining_characters);
+  return (CodepointProperties(ucs) & kCombining) != 0;
 }
 
 bool IsFullWidth(uint32_t ucs) {
-  if (ucs < 0x0300)  // Quick path: // NOLINT
-    return false;
+  return (CodepointProperties(ucs) & kFullWidth) != 0;
+}
 
-  return Bisearch(ucs, g_full_width_characters);
+WBP CodepointWordBreakProperty(uint32_t ucs) {
+  return WBP(CodepointProperties(ucs) & kWordBreakMask);
 }
 
 bool IsControl(uint32_t ucs) {
@@ -1549,6 +1628,160 @@ bool IsControl(uint32_t ucs) {
   return false;
 }
 
+// The Grapheme_Cluster_Break property of UAX#29. The spacing marks are merged
+// into Extend: only the rule GB9c, not implemented, distinguishes them.
+enum class GCB : uint8_t {
+  Other,
+  CR,
+  LF,
+  Control,
+  Extend,
+  ZWJ,
+  Regional_Indicator,
+  Prepend,
+  L,
+  V,
+  T,
+  LV,
+  LVT,
+};
+
+bool IsPrepend(uint32_t ucs) {
+  for (const auto& interval : g_prepend_characters) {
+    if (ucs < interval.first) {
+      return false;
+    }
+    if (ucs <= interval.last) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Derived from the word break property, the combining characters, and the
+// Hangul syllables layout.
+GCB CodepointGraphemeBreak(uint32_t ucs, uint8_t properties) {
+  // NOLINTBEGIN
+  if (ucs < 0x80) {
+    return ucs == '\r'       ? GCB::CR
+           : ucs == '\n'     ? GCB::LF
+           : IsControl(ucs) ? GCB::Control
+                            : GCB::Other;
+  }
+  if (ucs >= 0x1100 && ucs <= 0x11FF) {
+    return ucs < 0x1160 ? GCB::L : ucs < 0x11A8 ? GCB::V : GCB::T;
+  }
+  if (ucs >= 0xAC00 && ucs <= 0xD7A3) {
+    return (ucs - 0xAC00) % 28 == 0 ? GCB::LV : GCB::LVT;
+  }
+  if (ucs >= 0xA960 && ucs <= 0xA97C) {
+    return GCB::L;
+  }
+  if (ucs >= 0xD7B0 && ucs <= 0xD7C6) {
+    return GCB::V;
+  }
+  if (ucs >= 0xD7CB && ucs <= 0xD7FB) {
+    return GCB::T;
+  }
+  // NOLINTEND
+  if (IsControl(ucs)) {
+    return GCB::Control;
+  }
+  if (IsPrepend(ucs)) {
+    return GCB::Prepend;
+  }
+  switch (WBP(properties & kWordBreakMask)) {
+    case WBP::ZWJ:
+      return GCB::ZWJ;
+    case WBP::Extend:
+      return GCB::Extend;
+    case WBP::Regional_Indicator:
+      return GCB::Regional_Indicator;
+    case WBP::Newline:
+    case WBP::Format:
+      return GCB::Control;
+    default:
+      break;
+  }
+  return (properties & kCombining) ? GCB::Extend : GCB::Other;
+}
+
+// Find the extended grapheme cluster boundaries of UAX#29, in a single pass
+// over the codepoints.
+class GraphemeBreaker {
+ public:
+  // Whether a cluster boundary precedes |ucs|, the next codepoint.
+  bool Next(uint32_t ucs) {
+    const uint8_t properties = CodepointProperties(ucs);
+    const GCB current = CodepointGraphemeBreak(ucs, properties);
+    const bool pictographic = (properties & kExtendedPictographic) != 0;
+    const bool boundary = first_ || IsBoundary(current, pictographic);
+
+    first_ = false;
+    emoji_zwj_ = emoji_ && current == GCB::ZWJ;
+    emoji_ = pictographic || (emoji_ && current == GCB::Extend);
+    regional_indicators_ =
+        current == GCB::Regional_Indicator ? regional_indicators_ + 1 : 0;
+    previous_ = current;
+    return boundary;
+  }
+
+ private:
+  bool IsBoundary(GCB current, bool pictographic) const {
+    // GB3, GB4, GB5: Around the controls.
+    if (previous_ == GCB::CR && current == GCB::LF) {
+      return false;
+    }
+    if (previous_ == GCB::CR || previous_ == GCB::LF ||
+        previous_ == GCB::Control || current == GCB::CR ||
+        current == GCB::LF || current == GCB::Control) {
+      return true;
+    }
+
+    // GB6, GB7, GB8: Hangul syllables.
+    if (previous_ == GCB::L &&
+        (current == GCB::L || current == GCB::V || current == GCB::LV ||
+         current == GCB::LVT)) {
+      return false;
+    }
+    if ((previous_ == GCB::LV || previous_ == GCB::V) &&
+        (current == GCB::V || current == GCB::T)) {
+      return false;
+    }
+    if ((previous_ == GCB::LVT || previous_ == GCB::T) && current == GCB::T) {
+      return false;
+    }
+
+    // GB9, GB9a, GB9b: Extending characters and prepended concatenation marks.
+    if (current == GCB::Extend || current == GCB::ZWJ ||
+        previous_ == GCB::Prepend) {
+      return false;
+    }
+
+    // GB11: Emoji ZWJ sequences.
+    if (emoji_zwj_ && pictographic) {
+      return false;
+    }
+
+    // GB12, GB13: Pairs of regional indicators, forming flags.
+    if (current == GCB::Regional_Indicator && regional_indicators_ % 2 == 1) {
+      return false;
+    }
+
+    // GB999
+    return true;
+  }
+
+  bool first_ = true;
+  GCB previous_ = GCB::Other;
+  // Whether the cluster so far is an Extended_Pictographic character followed
+  // by Extend characters, and then a ZWJ for |emoji_zwj_|.
+  bool emoji_ = false;
+  bool emoji_zwj_ = false;
+  // The number of consecutive regional indicators.
+  int regional_indicators_ = 0;
+};
+
 int codepoint_width(uint32_t ucs) {
   if (IsControl(ucs)) {
     return -1;
@@ -1569,7 +1802,7 @@ int codepoint_width(uint32_t ucs) {
 // one codepoint. Put the codepoint into |ucs|. Start at |start| and update
 // |end| to represent the beginning of the next byte to eat for consecutive
 // executions.
-bool EatCodePoint(const std::string& input,
+bool EatCodePoint(std::string_view input,
                   size_t start,
                   size_t* end,
                   uint32_t* ucs) {
@@ -1639,7 +1872,7 @@ bool EatCodePoint(const std::string& input,
 // one codepoint. Put the codepoint into |ucs|. Start at |start| and update
 // |end| to represent the beginning of the next byte to eat for consecutive
 // executions.
-bool EatCodePoint(const std::wstring& input,
+bool EatCodePoint(std::wstring_view input,
                   size_t start,
                   size_t* end,
                   uint32_t* ucs) {
@@ -1677,6 +1910,172 @@ bool EatCodePoint(const std::wstring& input,
   return true;
 }
 
+// Encode |codepoint| in UTF8 into |out|, and return the number of bytes
+// written. Nothing is written for codepoints beyond the Unicode range.
+size_t EncodeUtf8(uint32_t codepoint, char* out) {
+  // Code point <-> UTF-8 conversion
+  //
+  // ┏━━━━━━━━┳━━━━━━━━┳━━━━━━━━┳━━━━━━━━┓
+  // ┃Byte 1  ┃Byte 2  ┃Byte 3  ┃Byte 4  ┃
+  // ┡━━━━━━━━╇━━━━━━━━╇━━━━━━━━╇━━━━━━━━┩
+  // │0xxxxxxx│        │        │        │
+  // ├────────┼────────┼────────┼────────┤
+  // │110xxxxx│10xxxxxx│        │        │
+  // ├────────┼────────┼────────┼────────┤
+  // │1110xxxx│10xxxxxx│10xxxxxx│        │
+  // ├────────┼────────┼────────┼────────┤
+  // │11110xxx│10xxxxxx│10xxxxxx│10xxxxxx│
+  // └────────┴────────┴────────┴────────┘
+  // NOLINTBEGIN
+
+  // 1 byte UTF8
+  if (codepoint <= 0b000'0000'0111'1111) {
+    out[0] = char(codepoint);
+    return 1;
+  }
+
+  // 2 bytes UTF8
+  if (codepoint <= 0b000'0111'1111'1111) {
+    out[0] = char(0b11000000 + (codepoint >> 6));
+    out[1] = char(0b10000000 + (codepoint & 0b111111));
+    return 2;
+  }
+
+  // 3 bytes UTF8
+  if (codepoint <= 0b1111'1111'1111'1111) {
+    out[0] = char(0b11100000 + (codepoint >> 12));
+    out[1] = char(0b10000000 + ((codepoint >> 6) & 0b111111));
+    out[2] = char(0b10000000 + (codepoint & 0b111111));
+    return 3;
+  }
+
+  // 4 bytes UTF8
+  if (codepoint <= 0b1'0000'1111'1111'1111'1111) {
+    out[0] = char(0b11110000 + (codepoint >> 18));
+    out[1] = char(0b10000000 + ((codepoint >> 12) & 0b111111));
+    out[2] = char(0b10000000 + ((codepoint >> 6) & 0b111111));
+    out[3] = char(0b10000000 + (codepoint & 0b111111));
+    return 4;
+  }
+
+  // NOLINTEND
+  // Something else?
+  return 0;
+}
+
+// The end of the grapheme cluster starting with |first|, whose encoding ends at
+// |next|.
+size_t GraphemeEnd(std::string_view input, uint32_t first, size_t next) {
+  GraphemeBreaker breaker;
+  breaker.Next(first);
+  size_t end = 0;
+  uint32_t codepoint = 0;
+  while (EatCodePoint(input, next, &end, &codepoint) &&
+         !breaker.Next(codepoint)) {
+    next = end;
+  }
+  return next;
+}
+
+// The number of cells taken by the grapheme |cluster| starting with |first|.
+// The flags, made of two regional indicators, take two cells.
+int GraphemeWidth(uint32_t first, std::string_view cluster) {
+  if (IsFullWidth(first)) {
+    return 2;
+  }
+  constexpr size_t kRegionalIndicatorSize = 4;
+  if (first >= 0x1F1E6 && first <= 0x1F1FF &&  // NOLINT
+      cluster.size() > kRegionalIndicatorSize) {
+    return 2;
+  }
+  return 1;
+}
+
+// Whether the 8 bytes at |data| are all ASCII.
+bool IsAscii8(const uint8_t* data) {
+  uint64_t block = 0;
+  std::memcpy(&block, data, sizeof(block));
+  return (block & 0x8080'8080'8080'8080ULL) == 0;  // NOLINT
+}
+
+// Count the printable characters among the |size| ASCII bytes at |data|. The
+// control characters (below 0x20, and 0x7F) have no width.
+int AsciiWidth(const uint8_t* data, size_t size) {
+  int width = 0;
+  for (size_t i = 0; i < size; ++i) {
+    const uint8_t c = data[i];                  // NOLINT
+    width += (c >= 0x20 && c != 0x7F) ? 1 : 0;  // NOLINT
+  }
+  return width;
+}
+
+// From UTF8 encoded string |input|, eat the longest run of ASCII bytes starting
+// at |*start|, and return its width. |*start| is updated to the first non ASCII
+// byte. The run is scanned using SIMD when available.
+int EatAsciiWidth(std::string_view input, size_t* start) {
+  const auto* data = reinterpret_cast<const uint8_t*>(input.data());  // NOLINT
+  const size_t size = input.size();
+  size_t i = *start;
+  int width = 0;
+
+  // NOLINTBEGIN
+#if defined(__AVX2__)
+  const __m256i space = _mm256_set1_epi8(0x20);
+  const __m256i del = _mm256_set1_epi8(0x7F);
+  for (; i + 32 <= size; i += 32) {
+    const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+    const auto non_ascii = uint32_t(_mm256_movemask_epi8(v));
+    if (non_ascii != 0) {
+      const int count = std::countr_zero(non_ascii);
+      width += AsciiWidth(data + i, count);
+      *start = i + count;
+      return width;
+    }
+    // Bytes are signed, but every byte of |v| is positive here.
+    const __m256i control = _mm256_or_si256(_mm256_cmpgt_epi8(space, v),
+                                            _mm256_cmpeq_epi8(v, del));
+    width += 32 - std::popcount(uint32_t(_mm256_movemask_epi8(control)));
+  }
+#elif defined(__SSE2__) || defined(_M_X64)
+  const __m128i space = _mm_set1_epi8(0x20);
+  const __m128i del = _mm_set1_epi8(0x7F);
+  for (; i + 16 <= size; i += 16) {
+    const __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+    const auto non_ascii = uint32_t(_mm_movemask_epi8(v));
+    if (non_ascii != 0) {
+      const int count = std::countr_zero(non_ascii);
+      width += AsciiWidth(data + i, count);
+      *start = i + count;
+      return width;
+    }
+    // Bytes are signed, but every byte of |v| is positive here.
+    const __m128i control =
+        _mm_or_si128(_mm_cmplt_epi8(v, space), _mm_cmpeq_epi8(v, del));
+    width += 16 - std::popcount(uint32_t(_mm_movemask_epi8(control)));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const uint8x16_t space = vdupq_n_u8(0x20);
+  const uint8x16_t del = vdupq_n_u8(0x7F);
+  for (; i + 16 <= size; i += 16) {
+    const uint8x16_t v = vld1q_u8(data + i);
+    if (vmaxvq_u8(v) >= 0x80) {
+      break;
+    }
+    const uint8x16_t control = vorrq_u8(vcltq_u8(v, space), vceqq_u8(v, del));
+    width += 16 - vaddvq_u8(vshrq_n_u8(control, 7));
+  }
+#endif
+  // NOLINTEND
+
+  const size_t begin = i;
+  while (i < size && data[i] < 0x80) {  // NOLINT
+    ++i;
+  }
+  width += AsciiWidth(data + begin, i - begin);  // NOLINT
+  *start = i;
+  return width;
+}
+
 }  // namespace
 
 namespace ftxui {
@@ -1697,72 +2096,99 @@ int wstring_width(const std::wstring& text) {
   return width;
 }
 
-int string_width(const std::string& input) {
+int string_width(std::string_view input) {
   int width = 0;
   size_t start = 0;
   while (start < input.size()) {
-    uint32_t codepoint = 0;
-    if (!EatCodePoint(input, start, &start, &codepoint)) {
-      continue;
-    }
-
-    if (IsControl(codepoint)) {
-      continue;
+    const size_t ascii = start;
+    width += EatAsciiWidth(input, &start);
+    if (start >= input.size()) {
+      break;
     }
 
-    if (IsCombining(codepoint)) {
+    // The last ASCII character might start a grapheme cluster continued by the
+    // following codepoints.
+    if (start > ascii && !IsControl(uint8_t(input[start - 1]))) {
+      start = GraphemeEnd(input, uint8_t(input[start - 1]), start);
       continue;
     }
 
-    if (IsFullWidth(codepoint)) {
-      width += 2;
+    uint32_t codepoint = 0;
+    size_t end = 0;
+    if (!EatCodePoint(input, start, &end, &codepoint) ||
+        IsControl(codepoint) || IsCombining(codepoint)) {
+      start = end;
       continue;
     }
 
-    width += 1;
+    const size_t next = GraphemeEnd(input, codepoint, end);
+    width += GraphemeWidth(codepoint, input.substr(start, next - start));
+    start = next;
   }
   return width;
 }
 
-std::vector<std::string> Utf8ToGlyphs(const std::string& input) {
-  std::vector<std::string> out;
-  const std::string current;
-  out.reserve(input.size());
-  size_t start = 0;
-  size_t end = 0;
-  while (start < input.size()) {
+GlyphIterator::GlyphIterator(std::string_view input, size_t start)
+    : input_(input), start_(start) {
+  // Skip to the first glyph starting at |start|.
+  ++(*this);
+}
+
+GlyphIterator& GlyphIterator::operator++() {
+  size_t start = start_ + glyph_.text.size();
+  while (start < input_.size()) {
+    // Fast path: a printable ASCII character followed by an ASCII byte is a
+    // glyph on its own.
+    const auto c = uint8_t(input_[start]);
+    if (c >= 0x20 && c < 0x7F &&  // NOLINT
+        (start + 1 == input_.size() || uint8_t(input_[start + 1]) < 0x80)) {
+      start_ = start;
+      glyph_ = {input_.substr(start, 1), 1};
+      return *this;
+    }
+
     uint32_t codepoint = 0;
-    if (!EatCodePoint(input, start, &end, &codepoint)) {
+    size_t end = 0;
+    const bool eaten = EatCodePoint(input_, start, &end, &codepoint);
+
+    // Ignore invalid, control characters, and the combining characters not
+    // following a glyph.
+    if (!eaten || IsControl(codepoint) || IsCombining(codepoint)) {
       start = end;
       continue;
     }
 
-    const std::string append = input.substr(start, end - start);
-    start = end;
+    // The codepoints following the first one of the grapheme cluster, like
+    // the combining characters, are put with it.
+    const size_t next = GraphemeEnd(input_, codepoint, end);
+    const std::string_view text = input_.substr(start, next - start);
+    start_ = start;
+    glyph_ = {text, GraphemeWidth(codepoint, text)};
+    return *this;
+  }
 
-    // Ignore control characters.
-    if (IsControl(codepoint)) {
-      continue;
-    }
+  start_ = input_.size();
+  glyph_ = {};
+  return *this;
+}
 
-    // Combining characters are put with the previous glyph they are modifying.
-    if (IsCombining(codepoint)) {
-      if (!out.empty()) {
-        out.back() += append;
-      }
-      continue;
-    }
+GlyphIterator GlyphIterator::operator++(int) {
+  GlyphIterator copy = *this;
+  ++(*this);
+  return copy;
+}
+
+std::vector<std::string> Utf8ToGlyphs(const std::string& input) {
+  std::vector<std::string> out;
+  out.reserve(input.size());
+  for (const GlyphView& glyph : Glyphs(input)) {
+    out.emplace_back(glyph.text);
 
     // Fullwidth characters take two cells. The second is made of the empty
     // string to reserve the space the first is taking.
-    if (IsFullWidth(codepoint)) {
-      out.push_back(append);
+    if (glyph.width == 2) {
       out.emplace_back("");
-      continue;
     }
-
-    // Normal characters:
-    out.push_back(append);
   }
   return out;
 }
@@ -1790,7 +2216,7 @@ int GlyphPosition(const std::string& input, size_t glyph_index, size_t start) {
 
     // Otherwise, skip this glyph and iterate:
     glyph_index--;
-    start = end;
+    start = GraphemeEnd(input, codepoint, end);
   }
   return static_cast<int>(input.size());
 }
@@ -1804,10 +2230,10 @@ std::vector<int> CellToGlyphIndex(const std::string& input) {
   while (start < input.size()) {
     uint32_t codepoint = 0;
     const bool eaten = EatCodePoint(input, start, &end, &codepoint);
-    start = end;
 
     // Ignore invalid / control characters.
     if (!eaten || IsControl(codepoint)) {
+      start = end;
       continue;
     }
 
@@ -1817,21 +2243,21 @@ std::vector<int> CellToGlyphIndex(const std::string& input) {
         ++x;
         out.push_back(x);
       }
+      start = end;
       continue;
     }
 
     // Fullwidth characters take two cells. The second is made of the empty
     // string to reserve the space the first is taking.
-    if (IsFullWidth(codepoint)) {
-      ++x;
-      out.push_back(x);
-      out.push_back(x);
-      continue;
-    }
-
-    // Normal characters:
+    const size_t next = GraphemeEnd(input, codepoint, end);
     ++x;
     out.push_back(x);
+    if (GraphemeWidth(codepoint,
+                      std::string_view(input).substr(start, next - start)) ==
+        2) {
+      out.push_back(x);
+    }
+    start = next;
   }
   return out;
 }
@@ -1843,10 +2269,10 @@ int GlyphCount(const std::string& input) {
   while (start < input.size()) {
     uint32_t codepoint = 0;
     const bool eaten = EatCodePoint(input, start, &end, &codepoint);
-    start = end;
 
     // Ignore invalid characters:
     if (!eaten || IsControl(codepoint)) {
+      start = end;
       continue;
     }
 
@@ -1856,10 +2282,12 @@ int GlyphCount(const std::string& input) {
       if (size == 0) {
         size++;
       }
+      start = end;
       continue;
     }
 
     size++;
+    start = GraphemeEnd(input, codepoint, end);
   }
   return size;
 }
@@ -1876,107 +2304,116 @@ std::vector<WordBreakProperty> Utf8ToWordBreakProperty(
       start = end;
       continue;
     }
-    start = end;
 
-    // Ignore control characters.
-    if (IsControl(codepoint)) {
-      continue;
-    }
-
-    // Ignore combining characters.
-    if (IsCombining(codepoint)) {
+    // Ignore control characters and combining characters.
+    if (IsControl(codepoint) || IsCombining(codepoint)) {
+      start = end;
       continue;
     }
 
-    WordBreakPropertyInterval interval = {0, 0, WBP::ALetter};
-    std::ignore = Bisearch(codepoint, g_word_break_intervals, &interval);
-    out.push_back(interval.property);
+    // One property per glyph, given by its first codepoint.
+    out.push_back(CodepointWordBreakProperty(codepoint));
+    start = GraphemeEnd(input, codepoint, end);
   }
   return out;
 }
 
-/// Convert a UTF8 std::string into a std::wstring.
+/// The word break property of |glyph|, given by its first codepoint. Same as
+/// Utf8ToWordBreakProperty(glyph)[0], without allocating.
+WordBreakProperty GlyphWordBreakProperty(std::string_view glyph) {
+  uint32_t codepoint = 0;
+  size_t end = 0;
+  if (!EatCodePoint(glyph, 0, &end, &codepoint)) {
+    return WordBreakProperty::Extend;
+  }
+  return CodepointWordBreakProperty(codepoint);
+}
+
+/// Convert a std::wstring into a UTF8 std::string.
 std::string to_string(const std::wstring& s) {
-  std::string out;
+  std::string out(4 * s.size(), '\0');
+  out.resize(to_string(s, out));
+  return out;
+}
 
+/// Convert a std::wstring into UTF8, written into |out|, without allocating.
+/// Returns the number of bytes written. The conversion stops before the first
+/// codepoint not fitting into |out|. A buffer of 4 * s.size() bytes is always
+/// large enough.
+size_t to_string(std::wstring_view s, std::span<char> out) {
+  size_t written = 0;
   size_t i = 0;
   uint32_t codepoint = 0;
-  while (EatCodePoint(s, i, &i, &codepoint)) {
-    // Code point <-> UTF-8 conversion
-    //
-    // ┏━━━━━━━━┳━━━━━━━━┳━━━━━━━━┳━━━━━━━━┓
-    // ┃Byte 1  ┃Byte 2  ┃Byte 3  ┃Byte 4  ┃
-    // ┡━━━━━━━━╇━━━━━━━━╇━━━━━━━━╇━━━━━━━━┩
-    // │0xxxxxxx│        │        │        │
-    // ├────────┼────────┼────────┼────────┤
-    // │110xxxxx│10xxxxxx│        │        │
-    // ├────────┼────────┼────────┼────────┤
-    // │1110xxxx│10xxxxxx│10xxxxxx│        │
-    // ├────────┼────────┼────────┼────────┤
-    // │11110xxx│10xxxxxx│10xxxxxx│10xxxxxx│
-    // └────────┴────────┴────────┴────────┘
-
-    // 1 byte UTF8
-    if (codepoint <= 0b000'0000'0111'1111) {  // NOLINT
-      const uint8_t p1 = codepoint;
-      out.push_back(p1);  // NOLINT
-      continue;
+  while (i < s.size()) {
+    // ASCII fast path:
+    while (i < s.size() && written < out.size() &&
+           uint32_t(s[i]) < 0x80) {  // NOLINT
+      out[written++] = char(s[i++]);
     }
-
-    // 2 bytes UTF8
-    if (codepoint <= 0b000'0111'1111'1111) {  // NOLINT
-      uint8_t p2 = codepoint & 0b111111;      // NOLINT
-      codepoint >>= 6;                        // NOLINT
-      uint8_t p1 = codepoint;                 // NOLINT
-      out.push_back(0b11000000 + p1);         // NOLINT
-      out.push_back(0b10000000 + p2);         // NOLINT
-      continue;
+    if (i >= s.size() || uint32_t(s[i]) < 0x80) {  // NOLINT
+      break;
     }
 
-    // 3 bytes UTF8
-    if (codepoint <= 0b1111'1111'1111'1111) {  // NOLINT
-      uint8_t p3 = codepoint & 0b111111;       // NOLINT
-      codepoint >>= 6;                         // NOLINT
-      uint8_t p2 = codepoint & 0b111111;       // NOLINT
-      codepoint >>= 6;                         // NOLINT
-      uint8_t p1 = codepoint;                  // NOLINT
-      out.push_back(0b11100000 + p1);          // NOLINT
-      out.push_back(0b10000000 + p2);          // NOLINT
-      out.push_back(0b10000000 + p3);          // NOLINT
-      continue;
+    size_t end = i;
+    if (!EatCodePoint(s, i, &end, &codepoint)) {
+      break;
     }
-
-    // 4 bytes UTF8
-    if (codepoint <= 0b1'0000'1111'1111'1111'1111) {  // NOLINT
-      uint8_t p4 = codepoint & 0b111111;              // NOLINT
-      codepoint >>= 6;                                // NOLINT
-      uint8_t p3 = codepoint & 0b111111;              // NOLINT
-      codepoint >>= 6;                                // NOLINT
-      uint8_t p2 = codepoint & 0b111111;              // NOLINT
-      codepoint >>= 6;                                // NOLINT
-      uint8_t p1 = codepoint;                         // NOLINT
-      out.push_back(0b11110000 + p1);                 // NOLINT
-      out.push_back(0b10000000 + p2);                 // NOLINT
-      out.push_back(0b10000000 + p3);                 // NOLINT
-      out.push_back(0b10000000 + p4);                 // NOLINT
-      continue;
+    std::array<char, 4> encoded = {};
+    const size_t size = EncodeUtf8(codepoint, encoded.data());
+    if (written + size > out.size()) {
+      break;
     }
-
-    // Something else?
+    for (size_t k = 0; k < size; ++k) {
+      out[written++] = encoded[k];  // NOLINT
+    }
+    i = end;
   }
-  return out;
+  return written;
 }
 
-/// Convert a std::wstring into a UTF8 std::string.
+/// Convert a UTF8 std::string into a std::wstring.
 std::wstring to_wstring(const std::string& s) {
-  std::wstring out;
+  std::wstring out(s.size(), L'\0');
+  out.resize(to_wstring(s, out));
+  return out;
+}
 
+/// Convert a UTF8 string into a wide string, written into |out|, without
+/// allocating. Returns the number of wchar_t written. The conversion stops
+/// before the first codepoint not fitting into |out|. A buffer of s.size()
+/// wchar_t is always large enough.
+size_t to_wstring(std::string_view s, std::span<wchar_t> out) {
+  const auto* data = reinterpret_cast<const uint8_t*>(s.data());  // NOLINT
+  size_t written = 0;
   size_t i = 0;
   uint32_t codepoint = 0;
-  while (EatCodePoint(s, i, &i, &codepoint)) {
+  while (i < s.size()) {
+    // ASCII fast path, checking 8 bytes at a time:
+    while (i + 8 <= s.size() && written + 8 <= out.size() &&
+           IsAscii8(data + i)) {  // NOLINT
+      for (size_t k = 0; k < 8; ++k) {
+        out[written++] = wchar_t(data[i++]);  // NOLINT
+      }
+    }
+    while (i < s.size() && written < out.size() && data[i] < 0x80) {  // NOLINT
+      out[written++] = wchar_t(data[i++]);  // NOLINT
+    }
+    if (i >= s.size() || data[i] < 0x80) {  // NOLINT
+      break;
+    }
+
+    size_t end = i;
+    if (!EatCodePoint(s, i, &end, &codepoint)) {
+      break;
+    }
+
     // On linux wstring are UTF32 encoded:
     if constexpr (sizeof(wchar_t) == 4) {
-      out.push_back(codepoint);  // NOLINT
+      if (written + 1 > out.size()) {
+        break;
+      }
+      out[written++] = wchar_t(codepoint);  // NOLINT
+      i = end;
       continue;
     }
 
@@ -1985,19 +2422,26 @@ std::wstring to_wstring(const std::string& s) {
     // Codepoint encoded using 1 word:
     // NOLINTNEXTLINE
     if (codepoint < 0xD800 || (codepoint > 0xDFFF && codepoint < 0x10000)) {
-      uint16_t p0 = codepoint;  // NOLINT
-      out.push_back(p0);        // NOLINT
+      if (written + 1 > out.size()) {
+        break;
+      }
+      out[written++] = wchar_t(uint16_t(codepoint));  // NOLINT
+      i = end;
       continue;
     }
 
     // Codepoint encoded using 2 words:
+    if (written + 2 > out.size()) {
+      break;
+    }
     codepoint -= 0x010000;                               // NOLINT
     uint16_t p0 = (((codepoint << 12) >> 22) + 0xD800);  // NOLINT
     uint16_t p1 = (((codepoint << 22) >> 22) + 0xDC00);  // NOLINT
-    out.push_back(p0);                                   // NOLINT
-    out.push_back(p1);                                   // NOLINT
+    out[written++] = wchar_t(p0);                        // NOLINT
+    out[written++] = wchar_t(p1);                        // NOLINT
+    i = end;
   }
-  return out;
+  return written;
 }
 
 }  // namespace ftxui
@@ -1,5 +1,6 @@
 #include "ftxui/screen/string.hpp"
 #include <gtest/gtest.h>
+#include <array>   // for array
 #include <string>  // for allocator, string
 
 namespace ftxui {
@@ -24,6 +25,37 @@ TEST(StringTest, StringWidth) {
   // Control characters:
   EXPECT_EQ(0, string_width("\1"));
   EXPECT_EQ(2, string_width("a\1a"));
+  EXPECT_EQ(0, string_width("\x7F"));
+}
+
+TEST(StringTest, StringWidthTableBoundaries) {
+  EXPECT_EQ(1, string_width("\u02FF"));
+  EXPECT_EQ(0, string_width("\u0300"));
+  EXPECT_EQ(0, string_width("\u036F"));
+  EXPECT_EQ(1, string_width("\u0370"));
+  EXPECT_EQ(2, string_width("\u1100"));
+  EXPECT_EQ(2, string_width("\u115F"));
+  EXPECT_EQ(2, string_width("\U0003FFFD"));
+  EXPECT_EQ(1, string_width("\U0003FFFE"));
+  EXPECT_EQ(0, string_width("\U000E01EF"));
+  EXPECT_EQ(1, string_width("\U000E01F0"));
+  EXPECT_EQ(1, string_width("\U0010FFFF"));
+  // Beyond the Unicode range:
+  EXPECT_EQ(1, string_width("\xF7\xBF\xBF\xBF"));
+}
+
+TEST(StringTest, StringWidthLongAscii) {
+  // Longer than the SIMD blocks, with non ASCII characters at every offsets.
+  const std::string ascii =
+      "The quick brown fox jumps over the lazy dog.\t\x7F";
+  EXPECT_EQ(44, string_width(ascii));
+  for (size_t i = 0; i <= ascii.size(); ++i) {
+    std::string input = ascii;
+    input.insert(i, "测");
+    EXPECT_EQ(46, string_width(input));
+    input.insert(0, ascii);
+    EXPECT_EQ(90, string_width(input));
+  }
 }
 
 TEST(StringTest, Utf8ToGlyphs) {
@@ -44,6 +76,57 @@ TEST(StringTest, Utf8ToGlyphs) {
   EXPECT_EQ(Utf8ToGlyphs("a\1a"), T({"a", "a"}));
 }
 
+TEST(StringTest, GraphemeClusters) {
+  using T = std::vector<std::string>;
+  // Emoji ZWJ sequence: family.
+  const std::string family = "\U0001F468‍\U0001F469‍\U0001F467";
+  EXPECT_EQ(Utf8ToGlyphs(family), T({family, ""}));
+  EXPECT_EQ(string_width(family), 2);
+  // Emoji modifier.
+  const std::string wave = "\U0001F44B\U0001F3FD";
+  EXPECT_EQ(Utf8ToGlyphs(wave), T({wave, ""}));
+  // Regional indicators pair into flags.
+  const std::string fr = "\U0001F1EB\U0001F1F7";
+  const std::string jp = "\U0001F1EF\U0001F1F5";
+  EXPECT_EQ(Utf8ToGlyphs(fr + jp), T({fr, "", jp, ""}));
+  EXPECT_EQ(string_width(fr + jp), 4);
+  // Hangul jamos form a syllable.
+  const std::string han = "\u1112\u1161\u11AB";
+  EXPECT_EQ(Utf8ToGlyphs(han), T({han, ""}));
+  EXPECT_EQ(string_width("a" + han + "b"), 4);
+  // A ZWJ extends the ASCII character preceding it.
+  EXPECT_EQ(Utf8ToGlyphs("a‍b"), T({"a‍", "b"}));
+  EXPECT_EQ(string_width("a‍b"), 2);
+  // The other functions agree with the glyphs.
+  const std::string text = "x" + family + fr + "y";
+  EXPECT_EQ(GlyphCount(text), 4);
+  EXPECT_EQ(GlyphPosition(text, 2), 1 + int(family.size()));
+  EXPECT_EQ(CellToGlyphIndex(text), std::vector<int>({0, 1, 1, 2, 2, 3}));
+  EXPECT_EQ(Utf8ToWordBreakProperty(text).size(), 4u);
+}
+
+TEST(StringTest, Glyphs) {
+  const std::string input = "a\1测ā";
+  std::vector<std::string_view> texts;
+  std::vector<int> widths;
+  for (const GlyphView& glyph : Glyphs(input)) {
+    texts.push_back(glyph.text);
+    widths.push_back(glyph.width);
+    // The glyphs are views inside the original buffer.
+    EXPECT_GE(glyph.text.data(), input.data());
+    EXPECT_LE(glyph.text.data() + glyph.text.size(),
+              input.data() + input.size());
+  }
+  EXPECT_EQ(texts, std::vector<std::string_view>({"a", "测", "ā"}));
+  EXPECT_EQ(widths, std::vector<int>({1, 2, 1}));
+
+  // Leading combining and control characters are skipped:
+  const GlyphRange empty = Glyphs("\u0300\1");
+  EXPECT_EQ(empty.begin(), empty.end());
+  const GlyphRange range = Glyphs("\u0300b");
+  EXPECT_EQ(range.begin()->text, "b");
+}
+
 TEST(StringTest, GlyphCount) {
   // Basic:
   EXPECT_EQ(GlyphCount(""), 0);
@@ -160,6 +243,28 @@ TEST(StringTest, to_wstring) {
   EXPECT_EQ(to_wstring(std::string("🎅🎄")), L"🎅🎄");
 }
 
+TEST(StringTest, ConversionLong) {
+  // Longer than the ASCII fast path blocks, with non ASCII characters in
+  // between.
+  const std::string utf8 = "The quick brown fox €jumps over ÿ the 🎅 dog.";
+  const std::wstring wide = L"The quick brown fox €jumps over ÿ the 🎅 dog.";
+  EXPECT_EQ(to_wstring(utf8), wide);
+  EXPECT_EQ(to_string(wide), utf8);
+}
+
+TEST(StringTest, ConversionBuffer) {
+  std::array<char, 4> utf8 = {};
+  EXPECT_EQ(to_string(L"ab€", utf8), 2);  // "€" doesn't fit.
+  EXPECT_EQ(std::string(utf8.data(), 2), "ab");
+  EXPECT_EQ(to_string(L"€", utf8), 3);
+  EXPECT_EQ(std::string(utf8.data(), 3), "€");
+
+  std::array<wchar_t, 2> wide = {};
+  EXPECT_EQ(to_wstring("abc", wide), 2);
+  EXPECT_EQ(std::wstring(wide.data(), 2), L"ab");
+  EXPECT_EQ(to_wstring("", wide), 0);
+}
+
 }  // namespace ftxui
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
@@ -1,4 +1,7 @@
+#include <atomic>   // for atomic
 #include <cstdlib>  // for getenv
+#include <map>      // for map
+#include <mutex>    // for mutex, lock_guard
 #include <string>   // for string, allocator
 
 #include "ftxui/screen/terminal.hpp"
@@ -20,10 +23,47 @@ namespace ftxui {
 
 namespace {
 
-bool g_cached = false;                     // NOLINT
-Terminal::Color g_cached_supported_color;  // NOLINT
+// The state below is shared by every thread: the screens can be rendered and
+// printed from several threads at once.
 
-Dimensions& FallbackSize() {
+// The ColorSupport() and RepeatSupport() detected or overridden. -1 until
+// then.
+std::atomic<int> g_color_support = -1;   // NOLINT
+std::atomic<int> g_repeat_support = -1;  // NOLINT
+// The NoColor() detected or overridden. -1 until then.
+std::atomic<int> g_no_color = -1;  // NOLINT
+
+// The result of Size(), valid until InvalidateSize() is called. The validity is
+// an atomic flag, so that it can be reset from a signal handler.
+std::atomic<bool> g_cached_size_valid = false;  // NOLINT
+std::atomic<Dimensions> g_cached_size;          // NOLINT
+
+// The capabilities probed, per value of $TERM.
+struct ProbedCapabilities {
+  std::mutex mutex;
+  std::map<std::string, Terminal::Capabilities> map;
+};
+ProbedCapabilities& GetProbedCapabilities() {
+  static ProbedCapabilities capabilities;
+  return capabilities;
+}
+
+// Return the value of |cache|, after computing it with |compute| the first
+// time. A value stored meanwhile by another thread wins.
+template <class Compute>
+int CachedValue(std::atomic<int>& cache, Compute compute) {
+  int value = cache.load();
+  if (value < 0) {
+    int expected = -1;
+    value = int(compute());
+    if (!cache.compare_exchange_strong(expected, value)) {
+      value = expected;
+    }
+  }
+  return value;
+}
+
+std::atomic<Dimensions>& FallbackSize() {
 #if defined(__EMSCRIPTEN__)
   // This dimension was chosen arbitrarily to be able to display:
   // https://arthursonzogni.com/FTXUI/examples
@@ -38,10 +78,10 @@ Dimensions& FallbackSize() {
   constexpr int fallback_width = 80;
   constexpr int fallback_height = 24;
 #endif
-  static Dimensions g_fallback_size{
+  static std::atomic<Dimensions> g_fallback_size(Dimensions{
       fallback_width,
       fallback_height,
-  };
+  });
   return g_fallback_size;
 }
 
@@ -81,6 +121,41 @@ Terminal::Color ComputeColorSupport() {
   return Terminal::Color::Palette16;
 }
 
+// https://no-color.org: set to a non-empty value, the colors are omitted.
+bool ComputeNoColor() {
+  const std::string NO_COLOR = Safe(std::getenv("NO_COLOR"));  // NOLINT
+  return !NO_COLOR.empty();
+}
+
+bool ComputeRepeatSupport() {
+#if defined(__EMSCRIPTEN__)
+  // xterm.js supports REP.
+  return true;
+#endif
+
+  // Windows Terminal.
+  if (std::getenv("WT_SESSION") != nullptr) {  // NOLINT
+    return true;
+  }
+
+  // Terminal.app declares itself as xterm, but doesn't support REP.
+  std::string TERM_PROGRAM = Safe(std::getenv("TERM_PROGRAM"));  // NOLINT
+  if (TERM_PROGRAM == "Apple_Terminal") {
+    return false;
+  }
+
+  // Terminal multiplexers, like tmux and screen, and the linux console are not
+  // listed.
+  std::string TERM = Safe(std::getenv("TERM"));  // NOLINT
+  for (const char* name : {"xterm", "vte", "kitty", "alacritty", "foot",
+                           "wezterm", "contour"}) {
+    if (Contains(TERM, name)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 }  // namespace
 
 namespace Terminal {
@@ -90,7 +165,7 @@ Dimensions Size() {
   // https://arthursonzogni.com/FTXUI/examples
   // This will have to be improved when someone has time to implement and need
   // it.
-  return FallbackSize();
+  return FallbackSize().load();
 #elif defined(_WIN32)
   CONSOLE_SCREEN_BUFFER_INFO csbi;
 
@@ -99,14 +174,14 @@ Dimensions Size() {
                       csbi.srWindow.Bottom - csbi.srWindow.Top + 1};
   }
 
-  return FallbackSize();
+  return FallbackSize().load();
 #else
   winsize w{};
   const int status = ioctl(STDOUT_FILENO, TIOCGWINSZ, &w);  // NOLINT
   // The ioctl return value result should be checked. Some operating systems
   // don't support TIOCGWINSZ.
   if (w.ws_col == 0 || w.ws_row == 0 || status < 0) {
-    return FallbackSize();
+    return FallbackSize().load();
   }
   return Dimensions{w.ws_col, w.ws_row};
 #endif
@@ -116,19 +191,95 @@ Dimensions Size() {
 /// @param fallbackSize Terminal dimensions to fallback to
 void SetFallbackSize(const Dimensions& fallbackSize) {
   FallbackSize() = fallbackSize;
+  InvalidateSize();
 }
 
-Color ColorSupport() {
-  if (!g_cached) {
-    g_cached = true;
-    g_cached_supported_color = ComputeColorSupport();
+/// @brief Same as Size(), but the result is cached until InvalidateSize() is
+/// called. This avoids querying the terminal on every frame.
+/// ScreenInteractive invalidates it when the terminal is resized, so the value
+/// is only kept up to date while a ScreenInteractive is running.
+Dimensions CachedSize() {
+  // Validate before querying, so that an invalidation happening in between
+  // causes a new query next time.
+  if (!g_cached_size_valid.exchange(true)) {
+    g_cached_size = Size();
   }
-  return g_cached_supported_color;
+  return g_cached_size.load();
+}
+
+/// @brief Discard the value cached by CachedSize(). This is async signal safe,
+/// it can be called from a SIGWINCH handler.
+void InvalidateSize() {
+  g_cached_size_valid = false;
+}
+
+Color ColorSupport() {
+  return Color(CachedValue(g_color_support, ComputeColorSupport));
 }
 
 void SetColorSupport(Color color) {
-  g_cached = true;
-  g_cached_supported_color = color;
+  g_color_support = int(color);
+}
+
+/// @brief Whether the terminal supports REP (`CSI n b`), repeating the
+/// preceding character. This is guessed from the environment variables.
+bool RepeatSupport() {
+  return CachedValue(g_repeat_support, ComputeRepeatSupport) != 0;
+}
+
+/// @brief Override the detection of RepeatSupport().
+void SetRepeatSupport(bool supported) {
+  g_repeat_support = int(supported);
+}
+
+/// @brief Whether the colors are omitted, because NO_COLOR is set. The other
+/// attributes, like bold or inverted, are still drawn. Unlike the Palette1
+/// ColorSupport(), drawing the text without any style.
+bool NoColor() {
+  return CachedValue(g_no_color, ComputeNoColor) != 0;
+}
+
+/// @brief Override the detection of NoColor().
+void SetNoColor(bool no_color) {
+  g_no_color = int(no_color);
+}
+
+/// @brief The capabilities of the terminal named by $TERM, as probed by
+/// SetCapabilities(). Until then, they are guessed from the environment
+/// variables, and the synchronized update is assumed unsupported.
+Capabilities GetCapabilities() {
+  const std::string TERM = Safe(std::getenv("TERM"));  // NOLINT
+  {
+    auto& probed = GetProbedCapabilities();
+    const std::lock_guard<std::mutex> lock(probed.mutex);
+    auto it = probed.map.find(TERM);
+    if (it != probed.map.end()) {
+      return it->second;
+    }
+  }
+  Capabilities capabilities;
+  capabilities.repeat = RepeatSupport();
+  capabilities.true_color = ColorSupport() == Color::TrueColor;
+  return capabilities;
+}
+
+/// @brief Record the |capabilities| of the terminal named by $TERM, probed from
+/// its replies. They are returned by GetCapabilities() from now on, and
+/// override RepeatSupport(), and ColorSupport() when truecolor is supported,
+/// unless the colors are disabled by NoColor() or Palette1.
+void SetCapabilities(const Capabilities& capabilities) {
+  const std::string TERM = Safe(std::getenv("TERM"));  // NOLINT
+  {
+    auto& probed = GetProbedCapabilities();
+    const std::lock_guard<std::mutex> lock(probed.mutex);
+    probed.map[TERM] = capabilities;
+  }
+  SetRepeatSupport(capabilities.repeat);
+  // The colors stay disabled, whatever the terminal supports.
+  if (capabilities.true_color && !NoColor() &&
+      ColorSupport() != Color::Palette1) {
+    SetColorSupport(Color::TrueColor);
+  }
 }
 
 }  // namespace Terminal
@@ -1,3 +1,12 @@
+#ifndef FTXUI_SCREEN_UTIL_HPP
+#define FTXUI_SCREEN_UTIL_HPP
+
+#include <array>     // for array
+#include <charconv>  // for to_chars
+#include <cstddef>   // for size_t
+#include <string>    // for string
+#include <vector>    // for vector
+
 namespace ftxui {
 namespace util {
 
@@ -7,9 +16,40 @@ constexpr const T& clamp(const T& v, const T& lo, const T& hi) {
   return v < lo ? lo : hi < v ? hi : v;
 }
 
+// The bytes allocated by |value|, besides the object itself. The short strings
+// are stored inline.
+inline size_t HeapSize(const std::string& value) {
+  return value.capacity() > std::string().capacity() ? value.capacity() + 1
+                                                      : 0;
+}
+template <class T, class Allocator>
+size_t HeapSize(const std::vector<T, Allocator>& value) {
+  return value.capacity() * sizeof(T);
+}
+
+// The number of decimal digits of |value| >= 0.
+inline int DigitCount(int value) {
+  int count = 1;
+  while (value >= 10) {  // NOLINT
+    value /= 10;         // NOLINT
+    ++count;
+  }
+  return count;
+}
+
+// Append the decimal representation of |value| to |out|, without allocating.
+inline void AppendInt(std::string& out, int value) {
+  std::array<char, 16> buffer;  // NOLINT
+  const auto result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  out.append(buffer.data(), result.ptr);
+}
+
 }  // namespace util
 }  // namespace ftxui
 
+#endif  // FTXUI_SCREEN_UTIL_HPP
+
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.